@@ -128,6 +128,33 @@ void KeyValueStoreXdsDelegate::onConfigUpdated(
   }
 }
 
+void KeyValueStoreXdsDelegate::onConfigUpdated(
+    const XdsSourceId& source_id,
+    const std::vector<envoy::service::discovery::v3::Resource>& added_resources,
+    const Protobuf::RepeatedPtrField<std::string>& removed_resources) {
+  for (const auto& resource : added_resources) {
+    // The resources arrive in the delta transport form, so they can be persisted as-is.
+    absl::optional<std::chrono::seconds> ttl = absl::nullopt;
+    if (resource.has_ttl()) {
+      ttl = std::chrono::seconds(Protobuf::util::TimeUtil::DurationToSeconds(resource.ttl()));
+    }
+    std::string serialized_resource;
+    if (resource.SerializeToString(&serialized_resource)) {
+      xds_config_store_->addOrUpdate(constructKey(source_id, resource.name()),
+                                     std::move(serialized_resource), ttl);
+    } else {
+      stats_.serialization_failed_.inc();
+      ENVOY_LOG_MISC(
+          warn,
+          "KeyValueStore xDS delegate didn't persist xDS update {}: resource serialiation failed",
+          resource.name());
+    }
+  }
+  for (const std::string& resource_name : removed_resources) {
+    xds_config_store_->remove(constructKey(source_id, resource_name));
+  }
+}
+
 void KeyValueStoreXdsDelegate::onResourceLoadFailed(
     const XdsSourceId& source_id, const std::string& resource_name,
     const absl::optional<EnvoyException>& exception) {
@@ -51,6 +51,10 @@ public:
   void onConfigUpdated(const Envoy::Config::XdsSourceId& source_id,
                        const std::vector<Envoy::Config::DecodedResourceRef>& resources) override;
 
+  void onConfigUpdated(const Envoy::Config::XdsSourceId& source_id,
+                       const std::vector<envoy::service::discovery::v3::Resource>& added_resources,
+                       const Protobuf::RepeatedPtrField<std::string>& removed_resources) override;
+
   void onResourceLoadFailed(const Envoy::Config::XdsSourceId& source_id,
                             const std::string& resource_name,
                             const absl::optional<EnvoyException>& exception) override;
@@ -121,6 +121,49 @@ TEST_F(KeyValueStoreXdsDelegateTest, SaveAndRetrieve) {
   EXPECT_EQ(0, store_.counter("xds.kv_store.parse_failed").value());
 }
 
+TEST_F(KeyValueStoreXdsDelegateTest, DeltaSaveAndRemove) {
+  const std::string authority = "rtds_cluster";
+  const XdsConfigSourceId source_id{authority, Config::TypeUrl::get().Runtime};
+
+  auto runtime_resource_1 = parseYamlIntoRuntimeResource(R"EOF(
+    name: some_resource_1
+    layer:
+      foo: bar
+  )EOF");
+  auto runtime_resource_2 = parseYamlIntoRuntimeResource(R"EOF(
+    name: some_resource_2
+    layer:
+      abc: xyz
+  )EOF");
+
+  // Save delta xDS resources, which already arrive in the transport form.
+  std::vector<envoy::service::discovery::v3::Resource> added_resources;
+  for (const auto* runtime : {&runtime_resource_1, &runtime_resource_2}) {
+    envoy::service::discovery::v3::Resource resource;
+    resource.set_name(runtime->name());
+    resource.set_version("1");
+    resource.mutable_resource()->PackFrom(*runtime);
+    added_resources.push_back(std::move(resource));
+  }
+  xds_delegate_->onConfigUpdated(source_id, added_resources,
+                                 Protobuf::RepeatedPtrField<std::string>());
+
+  auto retrieved_resources =
+      xds_delegate_->getResources(source_id, {"some_resource_1", "some_resource_2"});
+  EXPECT_EQ(2, retrieved_resources.size());
+
+  // A delta removal erases the resource from the store.
+  Protobuf::RepeatedPtrField<std::string> removed_resources;
+  *removed_resources.Add() = "some_resource_1";
+  xds_delegate_->onConfigUpdated(source_id, {}, removed_resources);
+
+  retrieved_resources =
+      xds_delegate_->getResources(source_id, {"some_resource_1", "some_resource_2"});
+  EXPECT_EQ(1, retrieved_resources.size());
+  EXPECT_EQ("some_resource_2", retrieved_resources[0].name());
+  EXPECT_EQ(1, store_.counter("xds.kv_store.resource_missing").value());
+}
+
 TEST_F(KeyValueStoreXdsDelegateTest, MultipleAuthoritiesAndTypes) {
   const std::string authority_1 = "rtds_cluster";
   const std::string authority_2 = "127.0.0.1:8585";
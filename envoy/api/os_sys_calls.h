@@ -84,6 +84,19 @@ public:
    */
   virtual SysCallSizeResult pread(os_fd_t fd, void* buffer, size_t length, off_t offset) const PURE;
 
+  /**
+   * @see man 2 sendfile. Transfers up to count bytes from in_fd, starting at *offset, to out_fd
+   * inside the kernel without staging the data in userspace. On success *offset is advanced by
+   * the number of bytes transferred. Callers should check supportsSendfile() first.
+   */
+  virtual SysCallSizeResult sendfile(os_fd_t out_fd, os_fd_t in_fd, off_t* offset,
+                                     size_t count) PURE;
+
+  /**
+   * return true if the OS supports sendfile().
+   */
+  virtual bool supportsSendfile() const PURE;
+
   /**
    * @see send (man 2 send)
    */
@@ -2,6 +2,7 @@
 
 #include <functional>
 
+#include "envoy/buffer/buffer.h"
 #include "envoy/common/pure.h"
 #include "envoy/network/address.h"
 #include "envoy/thread_local/thread_local.h"
@@ -133,6 +134,20 @@ public:
    */
   virtual IoUringResult prepareClose(os_fd_t fd, Request* user_data) PURE;
 
+  /**
+   * Prepares a cancellation for a previously submitted request and puts it into the
+   * submission queue. Returns IoUringResult::Failed in case the submission queue is
+   * full already and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareCancel(Request* cancelling_user_data, Request* user_data) PURE;
+
+  /**
+   * Prepares a shutdown system call and puts it into the submission queue.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareShutdown(os_fd_t fd, int how, Request* user_data) PURE;
+
   /**
    * Submits the entries in the submission queue to the kernel using the
    * `io_uring_enter()` system call.
@@ -251,10 +266,75 @@ public:
    * @param type the request type of injected completion.
    */
   virtual void injectCompletion(Request::RequestType type) PURE;
+
+  /**
+   * Close the socket. Any pending requests are canceled and the file descriptor is
+   * closed through the ring; the socket removes itself from the worker afterwards.
+   */
+  virtual void close() PURE;
+
+  /**
+   * Write the data to the socket. The data is owned by the socket until all of it has
+   * been written through the ring.
+   * @param data the data to write.
+   */
+  virtual void write(Buffer::Instance& data) PURE;
 };
 
 using IoUringSocketPtr = std::unique_ptr<IoUringSocket>;
 
+/**
+ * The parameters of a socket accepted through the ring, passed to the IoUringHandler.
+ */
+struct AcceptedSocketParam {
+  os_fd_t fd_;
+  struct sockaddr_storage* remote_addr_;
+  socklen_t remote_addr_len_;
+};
+
+/**
+ * The parameters of completed socket read, passed to the IoUringHandler. `buf_` holds
+ * all the data gathered so far and `result_` is the return code of the latest read.
+ */
+struct ReadParam {
+  Buffer::Instance& buf_;
+  int32_t result_;
+};
+
+/**
+ * The parameters of completed socket write, passed to the IoUringHandler.
+ */
+struct WriteParam {
+  int32_t result_;
+};
+
+/**
+ * The handler for events of sockets running on an io_uring worker. This is the
+ * integration point for the upper layers (listener and IoHandle).
+ */
+class IoUringHandler {
+public:
+  virtual ~IoUringHandler() = default;
+
+  /**
+   * Called when a socket has been accepted through the ring.
+   * @param param the parameters of the accepted socket.
+   */
+  virtual void onAcceptSocket(AcceptedSocketParam& param) PURE;
+
+  /**
+   * Called when a read completes through the ring.
+   * @param param the parameters of the completed read.
+   */
+  virtual void onRead(ReadParam& param) PURE;
+
+  /**
+   * Called when a write completes through the ring.
+   * @param param the parameters of the completed write.
+   */
+  virtual void onWrite(WriteParam& param) PURE;
+};
+
 /**
  * Abstract for per-thread worker.
  */
@@ -262,6 +342,19 @@ class IoUringWorker : public ThreadLocal::ThreadLocalObject {
 public:
   ~IoUringWorker() override = default;
 
+  /**
+   * Add a listening socket to the worker. The worker keeps accept requests on the ring
+   * for it and passes accepted sockets to the handler.
+   */
+  virtual IoUringSocket& addAcceptSocket(os_fd_t fd, IoUringHandler& handler) PURE;
+
+  /**
+   * Add a server (accepted connection) socket to the worker. The worker keeps a read
+   * request on the ring for it and passes the gathered data to the handler.
+   */
+  virtual IoUringSocket& addServerSocket(os_fd_t fd, IoUringHandler& handler,
+                                         uint32_t read_buffer_size) PURE;
+
   /**
    * Return the current thread's dispatcher.
    */
@@ -65,6 +65,15 @@ public:
    * @return optional ref<envoy::config::core::v3::Metadata> of a resource.
    */
   virtual const OptRef<const envoy::config::core::v3::Metadata> metadata() const PURE;
+
+  /**
+   * @return absl::optional<uint64_t> a hash of the serialized resource bytes as received from the
+   *         wire, if known, or absl::nullopt for resources that were not decoded from wire bytes.
+   *         Equal hashes mean the resource content is unchanged, allowing consumers to cheaply
+   *         skip re-processing; unequal hashes do not imply that the content differs, since the
+   *         same message may serialize differently.
+   */
+  virtual absl::optional<uint64_t> contentHash() const PURE;
 };
 
 using DecodedResourcePtr = std::unique_ptr<DecodedResource>;
@@ -32,8 +32,8 @@ public:
 };
 
 /**
- * An interface for hooking into xDS resource fetch and update events.
- * Currently, this interface only supports the SotW (state-of-the-world) xDS protocol.
+ * An interface for hooking into xDS resource fetch and update events, for both the SotW
+ * (state-of-the-world) and delta xDS protocols.
  *
  * Instances of this interface get invoked on the main Envoy thread. Thus, it is important for
  * implementations of this interface to not execute any blocking operations on the same thread.
@@ -72,6 +72,22 @@ public:
   virtual void onConfigUpdated(const XdsSourceId& source_id,
                                const std::vector<DecodedResourceRef>& resources) PURE;
 
+  /**
+   * Invoked when delta xDS configuration updates have been received from an xDS authority, have
+   * been applied on the Envoy instance, and are about to be ACK'ed. The added resources arrive in
+   * the versioned delta transport form and carry a resource payload; heartbeat and alias-only
+   * entries are filtered out by the caller. Implementations that do not support the delta xDS
+   * protocol can rely on the default no-op implementation.
+   *
+   * @param source_id The xDS source of the update.
+   * @param added_resources The resources added or updated by the delta response.
+   * @param removed_resources The names of the resources removed by the delta response.
+   */
+  virtual void
+  onConfigUpdated(const XdsSourceId& /*source_id*/,
+                  const std::vector<envoy::service::discovery::v3::Resource>& /*added_resources*/,
+                  const Protobuf::RepeatedPtrField<std::string>& /*removed_resources*/) {}
+
   /**
    * Invoked when loading a resource obtained from the getResources() call resulted in a failure.
    * This would typically happen when there is a parsing or validation error on the xDS resource
@@ -291,6 +291,15 @@ public:
       return *this;
     }
 
+    // If true, this worker's connection pools for the cluster are drained whenever the async
+    // client has no more active streams, so that connections do not sit idle between calls.
+    // Intended for low-rate calls to control-plane style services, where an idle connection held
+    // by every worker multiplies the connection count against the service.
+    StreamOptions& setDrainPoolsWhenIdle(bool v) {
+      drain_pools_when_idle = v;
+      return *this;
+    }
+
     // For gmock test
     bool operator==(const StreamOptions& src) const {
       return timeout == src.timeout && buffer_body_for_retry == src.buffer_body_for_retry &&
@@ -328,6 +337,8 @@ public:
     OptRef<Router::FilterConfig> filter_config_;
 
     bool is_shadow{false};
+
+    bool drain_pools_when_idle{false};
   };
 
   /**
@@ -371,6 +382,10 @@ public:
       StreamOptions::setIsShadow(s);
       return *this;
     }
+    RequestOptions& setDrainPoolsWhenIdle(bool v) {
+      StreamOptions::setDrainPoolsWhenIdle(v);
+      return *this;
+    }
     RequestOptions& setParentSpan(Tracing::Span& parent_span) {
       parent_span_ = &parent_span;
       return *this;
@@ -794,6 +794,25 @@ public:
    */
   virtual void onMatchCallback(const Matcher::Action&) {}
 
+  /**
+   * Filters that neither inspect nor modify body data may return true to declare themselves
+   * body pass-through. When every filter in a chain makes this declaration the filter manager
+   * is free to hand intermediate data frames straight to the codec without iterating the
+   * chain, so the filters' data callbacks will not be invoked for those frames. Headers,
+   * trailers, metadata and the end-of-stream frame are always delivered normally. Filters
+   * returning true here must not buffer, stop iteration on, or inject body data.
+   */
+  virtual bool isBodyPassThrough() const { return false; }
+
+  /**
+   * Filters that neither inspect nor modify trailers may return true to declare themselves
+   * trailer pass-through. The filter manager skips such filters when iterating a trailer
+   * frame, so their trailer callbacks will not be invoked; decodeComplete()/encodeComplete()
+   * are still delivered so the filter observes end of stream. Filters returning true here
+   * must not read, mutate, stop iteration on, or add trailers.
+   */
+  virtual bool isTrailerPassThrough() const { return false; }
+
   struct LocalReplyData {
     // The error code which (barring reset) will be sent to the client.
     Http::Code code_;
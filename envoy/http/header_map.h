@@ -21,6 +21,7 @@
 
 #include "absl/container/inlined_vector.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 
 namespace Envoy {
 namespace Http {
@@ -397,6 +398,21 @@ public:
    */
   virtual void addCopy(const LowerCaseString& key, absl::string_view value) PURE;
 
+  /**
+   * Add a batch of headers by copying both keys and values. Keys MUST already be lower case.
+   * Semantically equivalent to calling addCopy() once per element in order, but implementations
+   * may amortize per-header work (O(1) header classification, size accounting) across the whole
+   * batch. This is the expected bulk population path for codecs that decode a complete header
+   * block before building the map.
+   * @param headers supplies the key/value pairs to add; both WILL be copied.
+   */
+  virtual void
+  addCopyBulk(absl::Span<const std::pair<absl::string_view, absl::string_view>> headers) {
+    for (const auto& header : headers) {
+      addCopy(LowerCaseString(header.first), header.second);
+    }
+  }
+
   /**
    * Appends data to header. If header already has a value, the string "," is added between the
    * existing value and data.
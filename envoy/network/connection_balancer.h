@@ -40,6 +40,14 @@ public:
 /**
  * An implementation of a connection balancer. This abstracts the underlying policy (e.g., exact,
  * fuzzy, etc.).
+ *
+ * Balancing happens at accept time only: a socket can be handed to a different worker via
+ * BalancedConnectionHandler::post() while it is still a bare accepted fd. Once a Connection has
+ * been created its state (transport socket, codec, filter chains) is bound to the worker's
+ * dispatcher and cannot be migrated, so per-worker load skew that builds up from long-lived
+ * connections closing unevenly cannot be corrected after the fact. Deployments sensitive to such
+ * skew should bound connection lifetime (e.g. max_connection_duration) so that accept-time
+ * balancing gets a chance to reapply.
  */
 class ConnectionBalancer {
 public:
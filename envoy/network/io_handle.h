@@ -191,6 +191,27 @@ public:
    */
   virtual Api::IoCallUint64Result recv(void* buffer, size_t length, int flags) PURE;
 
+  /**
+   * Transfer up to length bytes from the file referenced by in_fd, starting at offset, directly
+   * to this handle inside the kernel without staging the data in userspace. On success offset is
+   * advanced by the number of bytes written, which may be fewer than requested. This is only
+   * meaningful for handles backed by a kernel socket whose bytes are not transformed in
+   * userspace (e.g. plaintext connections); transports that must see the bytes (e.g. TLS)
+   * should use the regular buffered write path instead. Callers should check supportsSendfile()
+   * first and fall back to a copy path when it returns false.
+   * @param in_fd the file descriptor to read from.
+   * @param offset the offset in the file to start from; updated on success.
+   * @param length the maximum number of bytes to transfer.
+   * @return a Api::IoCallUint64Result with err_ = an Api::IoError instance or
+   * err_ = nullptr and rc_ = the bytes written for success.
+   */
+  virtual Api::IoCallUint64Result sendFile(os_fd_t in_fd, off_t& offset, uint64_t length) PURE;
+
+  /**
+   * return true if the platform and handle support sendFile().
+   */
+  virtual bool supportsSendfile() const PURE;
+
   /**
    * return true if the platform supports recvmmsg() and sendmmsg().
    */
@@ -296,19 +296,33 @@ public:
 struct UdpRecvData {
   struct LocalPeerAddresses {
     bool operator==(const LocalPeerAddresses& rhs) const {
-      // TODO(mattklein123): Implement a hash directly on Address that does not use strings.
-      return local_->asStringView() == rhs.local_->asStringView() &&
-             peer_->asStringView() == rhs.peer_->asStringView();
+      return addressesEqual(*local_, *rhs.local_) && addressesEqual(*peer_, *rhs.peer_);
     }
 
     template <typename H> friend H AbslHashValue(H h, const LocalPeerAddresses& addresses) {
-      // TODO(mattklein123): Implement a hash directly on Address that does not use strings.
-      return H::combine(std::move(h), addresses.local_->asStringView(),
-                        addresses.peer_->asStringView());
+      return H::combine(std::move(h), addressKey(*addresses.local_), addressKey(*addresses.peer_));
     }
 
     Address::InstanceConstSharedPtr local_;
     Address::InstanceConstSharedPtr peer_;
+
+  private:
+    // The hash/equality key for an address: the raw sockaddr bytes when the address has them,
+    // so that per-packet session lookups do not hash the formatted address strings. Address
+    // types without a sockaddr (envoy internal addresses) fall back to their string form.
+    static absl::string_view addressKey(const Address::Instance& address) {
+      const sockaddr* sa = address.sockAddr();
+      if (sa != nullptr) {
+        return {reinterpret_cast<const char*>(sa), static_cast<size_t>(address.sockAddrLen())};
+      }
+      return address.asStringView();
+    }
+
+    static bool addressesEqual(const Address::Instance& lhs, const Address::Instance& rhs) {
+      // Receive paths reuse address instances for recently seen peers, so identity frequently
+      // decides equality without touching the sockaddr bytes.
+      return &lhs == &rhs || addressKey(lhs) == addressKey(rhs);
+    }
   };
 
   LocalPeerAddresses addresses_;
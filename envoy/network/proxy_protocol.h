@@ -19,7 +19,9 @@ using ProxyProtocolTLVVector = std::vector<ProxyProtocolTLV>;
 struct ProxyProtocolData {
   const Network::Address::InstanceConstSharedPtr src_addr_;
   const Network::Address::InstanceConstSharedPtr dst_addr_;
-  const ProxyProtocolTLVVector tlv_vector_{};
+  // Not const so that a fully parsed TLV vector can be moved in rather than copied; consumers
+  // only see the vector through const access to this struct.
+  ProxyProtocolTLVVector tlv_vector_{};
   std::string asStringForHash() const {
     return std::string(src_addr_ ? src_addr_->asString() : "null") +
            (dst_addr_ ? dst_addr_->asString() : "null");
@@ -64,6 +64,15 @@ public:
   virtual ConfigConstSharedPtr createConfig(const Protobuf::Message& rc,
                                             Server::Configuration::ServerFactoryContext& context,
                                             bool validate_clusters_default) const PURE;
+
+  /**
+   * Returns a hash covering any traits state that influences the output of createConfig() beyond
+   * the route configuration proto itself. Compiled static configs are shared between providers
+   * whose proto and seed both match, so traits carrying per-provider state (for example optional
+   * filter sets or validation visitors) must fold that state into the seed. Traits whose
+   * createConfig() depends only on the proto can rely on the default.
+   */
+  virtual uint64_t staticConfigSeed() const { return 0; }
 };
 
 } // namespace Rds
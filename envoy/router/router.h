@@ -133,6 +133,14 @@ public:
    */
   virtual const std::vector<Matchers::StringMatcherPtr>& allowOrigins() const PURE;
 
+  /**
+   * @param origin the value of the Origin request header.
+   * @return bool whether the origin matches one of the allowOrigins() matchers. Implementations
+   *         may answer from a representation compiled at configuration load time instead of
+   *         evaluating the matchers one by one.
+   */
+  virtual bool originAllowed(absl::string_view origin) const PURE;
+
   /**
    * @return std::string access-control-allow-methods value.
    */
@@ -1350,6 +1358,17 @@ public:
   virtual RouteConstSharedPtr route(const RouteCallback& cb, const Http::RequestHeaderMap& headers,
                                     const StreamInfo::StreamInfo& stream_info,
                                     uint64_t random_value) const PURE;
+
+  /**
+   * @return bool whether a route returned by route() may be cached and reused for a later request
+   *         carrying the same :method, :authority and :path. This is only true when every virtual
+   *         host resolves routes purely from those inputs: any header, query-parameter, runtime,
+   *         TLS-context or dynamic-metadata predicate, any weighted-cluster, cluster-header or
+   *         cluster-specifier-plugin route, any matcher-tree virtual host, or any SSL requirement
+   *         makes route resolution depend on per-request or per-stream state and disqualifies the
+   *         whole configuration.
+   */
+  virtual bool supportsRouteMemoization() const PURE;
 };
 
 using ConfigConstSharedPtr = std::shared_ptr<const Config>;
@@ -51,13 +51,13 @@ public:
   bool operator==(const ScopeKey& other) const;
 
 private:
-  // Update the key's hash with the new fragment hash.
+  // Update the key's hash with the new fragment hash. This runs on the request path for every
+  // fragment, so the concatenation of the two hashes is built on the stack rather than through a
+  // heap-backed buffer.
   void updateHash(const ScopeKeyFragmentBase& fragment) {
-    std::stringbuf buffer;
-    buffer.sputn(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
-    const auto& fragment_hash = fragment.hash();
-    buffer.sputn(reinterpret_cast<const char*>(&fragment_hash), sizeof(fragment_hash));
-    hash_ = HashUtil::xxHash64(buffer.str());
+    const uint64_t buffer[2] = {hash_, fragment.hash()};
+    hash_ = HashUtil::xxHash64(
+        absl::string_view(reinterpret_cast<const char*>(buffer), sizeof(buffer)));
   }
 
   uint64_t hash_{0};
@@ -66,16 +66,15 @@ private:
 
 using ScopeKeyPtr = std::unique_ptr<ScopeKey>;
 
-// String fragment.
+// String fragment. Only the hash participates in fragment identity, so the value itself is not
+// retained; this keeps per-request fragment construction free of string copies.
 class StringKeyFragment : public ScopeKeyFragmentBase {
 public:
-  explicit StringKeyFragment(absl::string_view value)
-      : value_(value), hash_(HashUtil::xxHash64(value_)) {}
+  explicit StringKeyFragment(absl::string_view value) : hash_(HashUtil::xxHash64(value)) {}
 
   uint64_t hash() const override { return hash_; }
 
 private:
-  const std::string value_;
   const uint64_t hash_;
 };
 
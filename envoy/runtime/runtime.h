@@ -61,7 +61,9 @@ public:
     virtual const std::string& name() const PURE;
   };
 
-  using OverrideLayerConstPtr = std::unique_ptr<const OverrideLayer>;
+  // Layers are immutable once built and may be structurally shared by consecutive snapshots when
+  // their contents did not change between snapshot rebuilds.
+  using OverrideLayerConstPtr = std::shared_ptr<const OverrideLayer>;
 
   /**
    * Returns true if a deprecated feature is allowed.
@@ -39,16 +39,24 @@ public:
   // Overload action to reset streams using excessive memory.
   const std::string ResetStreams = "envoy.overload_actions.reset_high_memory_stream";
 
+  // Overload action to shrink the per-worker caches of recycled connection buffer memory.
+  const std::string ShrinkConnectionBuffers = "envoy.overload_actions.shrink_connection_buffers";
+
+  // Overload action to reduce the compression level used for response compression.
+  const std::string ReduceCompressionLevel = "envoy.overload_actions.reduce_compression_level";
+
   // This should be kept current with the Overload actions available.
   // This is the last member of this class to duplicating the strings with
   // proper lifetime guarantees.
-  const std::array<absl::string_view, 7> WellKnownActions = {StopAcceptingRequests,
+  const std::array<absl::string_view, 9> WellKnownActions = {StopAcceptingRequests,
                                                              DisableHttpKeepAlive,
                                                              StopAcceptingConnections,
                                                              RejectIncomingConnections,
                                                              ShrinkHeap,
                                                              ReduceTimeouts,
-                                                             ResetStreams};
+                                                             ResetStreams,
+                                                             ShrinkConnectionBuffers,
+                                                             ReduceCompressionLevel};
 };
 
 using OverloadActionNames = ConstSingleton<OverloadActionNameValues>;
@@ -8,6 +8,8 @@
 #include "envoy/stats/refcount_ptr.h"
 #include "envoy/stats/stats.h"
 
+#include "absl/types/optional.h"
+
 namespace Envoy {
 namespace Stats {
 
@@ -24,6 +26,13 @@ public:
    * @return The buckets for the histogram. Each value is an upper bound of a bucket.
    */
   virtual ConstSupportedBuckets& buckets(absl::string_view stat_name) const PURE;
+
+  /**
+   * @return the configured relative accuracy if the named histogram should use a
+   * sketch-based backend with a relative-error guarantee, or nullopt to use the
+   * default fixed-bin implementation.
+   */
+  virtual absl::optional<double> sketchAccuracy(absl::string_view stat_name) const PURE;
 };
 
 using HistogramSettingsConstPtr = std::unique_ptr<const HistogramSettings>;
@@ -32,6 +32,21 @@ public:
    */
   virtual const std::vector<std::reference_wrapper<const Gauge>>& gauges() PURE;
 
+  /**
+   * @return a snapshot of the counters whose value changed since the previous
+   *         flush, with pre-latched deltas. Sinks whose backends retain the
+   *         last reported value can iterate this instead of counters() to skip
+   *         serializing the (typically large) unchanged majority.
+   */
+  virtual const std::vector<CounterSnapshot>& changedCounters() PURE;
+
+  /**
+   * @return a snapshot of the gauges whose value changed since the previous
+   *         flush. Note that a gauge that has stayed at its initial value of 0
+   *         is never reported as changed.
+   */
+  virtual const std::vector<std::reference_wrapper<const Gauge>>& changedGauges() PURE;
+
   /**
    * @return a snapshot of all histograms.
    */
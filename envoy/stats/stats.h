@@ -152,6 +152,17 @@ public:
   virtual void sub(uint64_t amount) PURE;
   virtual uint64_t value() const PURE;
 
+  /**
+   * Like Counter::latch(), this is called once per flush on the main thread,
+   * letting sinks skip gauges whose value did not change since the previous
+   * flush. A gauge whose value moved and returned to its latched value within
+   * one flush interval reports unchanged.
+   *
+   * @return whether the value differs from the value at the previous call,
+   *         and latches the current value for the next call.
+   */
+  virtual bool latchChanged() PURE;
+
   /**
    * Sets a value from a hot-restart parent. This parent contribution must be
    * kept distinct from the child value, so that when we erase the value it
@@ -56,6 +56,9 @@ using ThreadPtr = std::unique_ptr<Thread>;
 // Options specified during thread creation.
 struct Options {
   std::string name_; // A name supplied for the thread. On Linux this is limited to 15 chars.
+  // The CPU to pin the thread to, if set. Best effort: only supported on Linux, ignored
+  // elsewhere, and a failure to apply the affinity is logged rather than fatal.
+  absl::optional<uint32_t> cpu_affinity_{};
 };
 
 using OptionsOptConstRef = const absl::optional<Options>&;
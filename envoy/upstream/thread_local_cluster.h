@@ -151,6 +151,14 @@ public:
   virtual Tcp::AsyncTcpClientPtr
   tcpAsyncClient(LoadBalancerContext* context,
                  Tcp::AsyncTcpClientOptionsConstSharedPtr options) PURE;
+
+  /**
+   * Drain all connection pools owned by this cluster on this thread. Existing streams complete
+   * before their connections are closed. Unlike ClusterManager::drainConnections(), this only
+   * affects the calling worker's pools.
+   * @param drain_behavior supplies how to drain the connections.
+   */
+  virtual void drainConnPools(ConnectionPool::DrainBehavior drain_behavior) PURE;
 };
 
 using ThreadLocalClusterOptRef = absl::optional<std::reference_wrapper<ThreadLocalCluster>>;
@@ -210,16 +210,29 @@ void AccessLogFileImpl::flush() {
 }
 
 void AccessLogFileImpl::write(absl::string_view data) {
-  Thread::LockGuard lock(write_lock_);
+  bool wake_flush_thread = false;
+
+  {
+    Thread::LockGuard lock(write_lock_);
+
+    if (flush_thread_ == nullptr) {
+      createFlushStructures();
+    }
 
-  if (flush_thread_ == nullptr) {
-    createFlushStructures();
+    const uint64_t previous_length = flush_buffer_.length();
+    flush_buffer_.add(data.data(), data.size());
+    // Only signal on the crossing of the flush threshold. Once woken, the flush thread keeps
+    // draining until the buffer is empty, so signaling again for every line written above the
+    // threshold would just burn a wakeup syscall per log line on the request path.
+    wake_flush_thread =
+        previous_length <= MIN_FLUSH_SIZE && flush_buffer_.length() > MIN_FLUSH_SIZE;
   }
 
+  // Stats are atomics and the condition variable has its own synchronization, so neither needs
+  // to be touched while holding write_lock_.
   stats_.write_buffered_.inc();
   stats_.write_total_buffered_.add(data.length());
-  flush_buffer_.add(data.data(), data.size());
-  if (flush_buffer_.length() > MIN_FLUSH_SIZE) {
+  if (wake_flush_thread) {
     flush_event_.notifyOne();
   }
 }
@@ -2,6 +2,10 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
+
 #include <cerrno>
 #include <string>
 
@@ -65,6 +69,28 @@ SysCallSizeResult OsSysCallsImpl::pread(os_fd_t fd, void* buffer, size_t length,
   return {rc, rc != -1 ? 0 : errno};
 }
 
+SysCallSizeResult OsSysCallsImpl::sendfile(os_fd_t out_fd, os_fd_t in_fd, off_t* offset,
+                                           size_t count) {
+#if defined(__linux__)
+  const ssize_t rc = ::sendfile(out_fd, in_fd, offset, count);
+  return {rc, rc != -1 ? 0 : errno};
+#else
+  UNREFERENCED_PARAMETER(out_fd);
+  UNREFERENCED_PARAMETER(in_fd);
+  UNREFERENCED_PARAMETER(offset);
+  UNREFERENCED_PARAMETER(count);
+  return {-1, EOPNOTSUPP};
+#endif
+}
+
+bool OsSysCallsImpl::supportsSendfile() const {
+#if defined(__linux__)
+  return true;
+#else
+  return false;
+#endif
+}
+
 SysCallSizeResult OsSysCallsImpl::send(os_fd_t socket, void* buffer, size_t length, int flags) {
   const ssize_t rc = ::send(socket, buffer, length, flags);
   return {rc, rc != -1 ? 0 : errno};
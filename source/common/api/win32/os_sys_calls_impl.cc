@@ -158,6 +158,17 @@ SysCallSizeResult OsSysCallsImpl::pread(os_fd_t fd, void* buffer, size_t length,
   PANIC("not implemented");
 }
 
+SysCallSizeResult OsSysCallsImpl::sendfile(os_fd_t out_fd, os_fd_t in_fd, off_t* offset,
+                                           size_t count) {
+  UNREFERENCED_PARAMETER(out_fd);
+  UNREFERENCED_PARAMETER(in_fd);
+  UNREFERENCED_PARAMETER(offset);
+  UNREFERENCED_PARAMETER(count);
+  return {-1, WSAEOPNOTSUPP};
+}
+
+bool OsSysCallsImpl::supportsSendfile() const { return false; }
+
 SysCallSizeResult OsSysCallsImpl::send(os_fd_t socket, void* buffer, size_t length, int flags) {
   const ssize_t rc = ::send(socket, static_cast<char*>(buffer), length, flags);
   return {rc, rc != -1 ? 0 : ::WSAGetLastError()};
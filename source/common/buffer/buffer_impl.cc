@@ -19,9 +19,71 @@ namespace {
 constexpr uint64_t CopyThreshold = 512;
 } // namespace
 
-thread_local absl::InlinedVector<Slice::StoragePtr,
-                                 OwnedImpl::OwnedImplReservationSlicesOwnerMultiple::free_list_max_>
-    OwnedImpl::OwnedImplReservationSlicesOwnerMultiple::free_list_;
+Slice::Slice(uint64_t min_capacity, const BufferMemoryAccountSharedPtr& account)
+    : capacity_(sliceSize(min_capacity)) {
+  if (capacity_ == default_slice_size_) {
+    storage_ = ThreadLocalSliceCache::instance().acquireDefaultSizeStorage().mem_;
+  } else {
+    storage_.reset(new uint8_t[capacity_]);
+  }
+  base_ = storage_.get();
+  if (account) {
+    account->charge(capacity_);
+    account_ = account;
+  }
+}
+
+Slice::SizedStorage Slice::newStorage(uint64_t min_capacity) {
+  const uint64_t slice_size = sliceSize(min_capacity);
+  if (slice_size == default_slice_size_) {
+    return ThreadLocalSliceCache::instance().acquireDefaultSizeStorage();
+  }
+  return {StoragePtr{new uint8_t[slice_size]}, static_cast<size_t>(slice_size)};
+}
+
+void Slice::recycleStorage() {
+  if (storage_ != nullptr && capacity_ == default_slice_size_) {
+    ThreadLocalSliceCache::instance().releaseStorage(std::move(storage_), capacity_);
+  }
+}
+
+ThreadLocalSliceCache& ThreadLocalSliceCache::instance() {
+  static thread_local ThreadLocalSliceCache cache;
+  return cache;
+}
+
+Slice::SizedStorage ThreadLocalSliceCache::acquireDefaultSizeStorage() {
+  Slice::SizedStorage storage{nullptr, Slice::default_slice_size_};
+  if (!free_list_.empty()) {
+    storage.mem_ = std::move(free_list_.back());
+    free_list_.pop_back();
+  } else {
+    storage.mem_.reset(new uint8_t[Slice::default_slice_size_]);
+  }
+  return storage;
+}
+
+void ThreadLocalSliceCache::releaseStorage(Slice::StoragePtr&& storage, uint64_t capacity) {
+  if (storage == nullptr || capacity != Slice::default_slice_size_ ||
+      (free_list_.size() + 1) * Slice::default_slice_size_ > max_bytes_) {
+    // Fall through and let the storage be freed normally.
+    return;
+  }
+  free_list_.push_back(std::move(storage));
+}
+
+void ThreadLocalSliceCache::setMaxBytes(uint64_t max_bytes) {
+  max_bytes_ = max_bytes;
+  while (!free_list_.empty() && free_list_.size() * Slice::default_slice_size_ > max_bytes_) {
+    free_list_.pop_back();
+  }
+}
+
+uint64_t ThreadLocalSliceCache::bytesHeldForTest() const {
+  return free_list_.size() * Slice::default_slice_size_;
+}
+
+void ThreadLocalSliceCache::clearForTest() { free_list_.clear(); }
 
 void OwnedImpl::addImpl(const void* data, uint64_t size) {
   const char* src = static_cast<const char*>(data);
@@ -360,7 +422,7 @@ void OwnedImpl::move(Instance& rhs, uint64_t length, bool reset_drain_trackers_a
 }
 
 Reservation OwnedImpl::reserveForRead() {
-  return reserveWithMaxLength(default_read_reservation_size_);
+  return reserveWithMaxLength(target_read_reservation_size_);
 }
 
 Reservation OwnedImpl::reserveWithMaxLength(uint64_t max_length) {
@@ -411,6 +473,7 @@ Reservation OwnedImpl::reserveWithMaxLength(uint64_t max_length) {
   }
 
   ASSERT(reservation_slices.size() == slices_owner->owned_storages_.size());
+  slices_owner->read_reservation_length_ = reserved;
   reservation.bufferImplUseOnlySlicesOwner() = std::move(slices_owner);
   reservation.bufferImplUseOnlySetLength(reserved);
 
@@ -460,6 +523,10 @@ void OwnedImpl::commit(uint64_t length, absl::Span<RawSlice> slices,
   absl::Span<Slice::SizedStorage> owned_storages = slices_owner->ownedStorages();
   ASSERT(slices.size() == owned_storages.size());
 
+  if (slices_owner->read_reservation_length_ > 0) {
+    adaptTargetReadReservationSize(slices_owner->read_reservation_length_, length);
+  }
+
   uint64_t bytes_remaining = length;
   for (uint32_t i = 0; i < slices.size() && bytes_remaining > 0; i++) {
     slices[i].len_ = std::min<uint64_t>(slices[i].len_, bytes_remaining);
@@ -477,11 +544,22 @@ void OwnedImpl::commit(uint64_t length, absl::Span<RawSlice> slices,
   }
 }
 
+void OwnedImpl::adaptTargetReadReservationSize(uint64_t reserved, uint64_t committed) {
+  if (committed >= reserved) {
+    target_read_reservation_size_ =
+        std::min(target_read_reservation_size_ * 2, default_read_reservation_size_);
+  } else if (committed * 4 <= reserved) {
+    target_read_reservation_size_ = std::max(target_read_reservation_size_ / 2,
+                                             static_cast<uint64_t>(Slice::default_slice_size_));
+  }
+}
+
 ssize_t OwnedImpl::search(const void* data, uint64_t size, size_t start, size_t length) const {
   // This implementation uses the same search algorithm as evbuffer_search(), a naive
-  // scan that requires O(M*N) comparisons in the worst case.
-  // TODO(brian-pane): replace this with a more efficient search if it shows up
-  // prominently in CPU profiling.
+  // scan that requires O(M*N) comparisons in the worst case. Candidate positions are located
+  // with memchr() and verified with run-wise memcmp() so that the bulk of the scanning happens
+  // in the vectorized libc primitives rather than byte-at-a-time loops; matches spanning slice
+  // boundaries are handled by carrying the needle offset over to the next slice.
   if (size == 0) {
     return (start <= length_) ? start : -1;
   }
@@ -542,11 +620,15 @@ ssize_t OwnedImpl::search(const void* data, uint64_t size, size_t start, size_t
           match_end = match_next + match_slice.dataSize();
           continue;
         }
-        left_to_search--;
-        if (*match_next++ != needle[i]) {
+        // Compare the longest contiguous run available in this slice in one shot.
+        const size_t run_length = std::min(
+            {size - i, static_cast<size_t>(match_end - match_next), left_to_search});
+        if (memcmp(match_next, needle + i, run_length) != 0) {
           break;
         }
-        i++;
+        left_to_search -= run_length;
+        match_next += run_length;
+        i += run_length;
       }
       if (i == size) {
         // Successful match of the entire needle.
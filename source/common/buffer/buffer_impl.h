@@ -49,19 +49,12 @@ public:
 
   /**
    * Create an empty mutable Slice that owns its storage, which it charges to the provided account,
-   * if any.
+   * if any. Default-size storage is drawn from the calling thread's slice cache when available.
    * @param min_capacity number of bytes of space the slice should have. Actual capacity is rounded
    * up to the next multiple of 4kb.
    * @param account the account to charge.
    */
-  Slice(uint64_t min_capacity, const BufferMemoryAccountSharedPtr& account)
-      : capacity_(sliceSize(min_capacity)), storage_(new uint8_t[capacity_]),
-        base_(storage_.get()) {
-    if (account) {
-      account->charge(capacity_);
-      account_ = account;
-    }
-  }
+  Slice(uint64_t min_capacity, const BufferMemoryAccountSharedPtr& account);
 
   /**
    * Create an empty mutable Slice that owns its storage, which it charges to the provided account,
@@ -111,6 +104,7 @@ public:
   Slice& operator=(Slice&& rhs) noexcept {
     if (this != &rhs) {
       callAndClearDrainTrackersAndCharges();
+      recycleStorage();
 
       capacity_ = rhs.capacity_;
       storage_ = std::move(rhs.storage_);
@@ -129,7 +123,10 @@ public:
     return *this;
   }
 
-  ~Slice() { callAndClearDrainTrackersAndCharges(); }
+  ~Slice() {
+    callAndClearDrainTrackersAndCharges();
+    recycleStorage();
+  }
 
   /**
    * @return true if the data in the slice is mutable
@@ -363,16 +360,19 @@ public:
   /**
    * Create new backend storage with min capacity. This method will create a recommended capacity
    * which will bigger or equal to the min capacity and create new backend storage based on the
-   * recommended capacity.
+   * recommended capacity. Default-size storage is drawn from the calling thread's slice cache.
    * @param min_capacity the min capacity of new created backend storage.
    * @return a backend storage for slice.
    */
-  static inline SizedStorage newStorage(uint64_t min_capacity) {
-    const uint64_t slice_size = sliceSize(min_capacity);
-    return {StoragePtr{new uint8_t[slice_size]}, static_cast<size_t>(slice_size)};
-  }
+  static SizedStorage newStorage(uint64_t min_capacity);
 
 protected:
+  /**
+   * Return default-size storage to the calling thread's slice cache. Storage of any other
+   * capacity is left alone and freed as usual when storage_ is destroyed or reassigned.
+   */
+  void recycleStorage();
+
   /** Length of the byte array that base_ points to. This is also the offset in bytes from the start
    * of the slice to the end of the Reservable section. */
   uint64_t capacity_ = 0;
@@ -399,6 +399,56 @@ protected:
   BufferMemoryAccountSharedPtr account_;
 };
 
+/**
+ * A per-thread cache of recycled default-size slice storage.
+ *
+ * High throughput data paths create and destroy default-size (16kB) slices at a very high
+ * rate, which makes the global allocator a significant source of cycles. Each thread keeps a
+ * bounded free list of default-size storage blocks that slices are drawn from and returned to,
+ * with no cross-thread synchronization since the cache is only touched from its owning
+ * (dispatcher) thread. The cache is capped so that a worker that goes idle releases memory
+ * back to the allocator instead of holding it indefinitely.
+ */
+class ThreadLocalSliceCache {
+public:
+  /**
+   * @return the cache for the calling thread.
+   */
+  static ThreadLocalSliceCache& instance();
+
+  /**
+   * Take a default-size storage block from the cache, allocating a new block if the cache is
+   * empty.
+   */
+  Slice::SizedStorage acquireDefaultSizeStorage();
+
+  /**
+   * Return a storage block to the cache. Blocks that are not default-size, or that would push
+   * the cache above its byte limit, are freed instead.
+   * @param storage the storage block to return. May be null, in which case this is a no-op.
+   * @param capacity the capacity of the storage block in bytes.
+   */
+  void releaseStorage(Slice::StoragePtr&& storage, uint64_t capacity);
+
+  /**
+   * Set the maximum number of bytes the calling thread's cache may hold, trimming the cache
+   * if it is already above the new limit.
+   */
+  void setMaxBytes(uint64_t max_bytes);
+
+  uint64_t bytesHeldForTest() const;
+  void clearForTest();
+
+  // Cap each worker's cache at 64 default-size slices (1MiB) by default. This is large enough
+  // to absorb the per-event-loop-iteration alloc/free churn of a busy connection without
+  // pinning a significant amount of memory on idle workers.
+  static constexpr uint64_t DefaultMaxBytes = 64 * Slice::default_slice_size_;
+
+private:
+  absl::InlinedVector<Slice::StoragePtr, 16> free_list_;
+  uint64_t max_bytes_{DefaultMaxBytes};
+};
+
 class OwnedImpl;
 
 class SliceDataImpl : public SliceData {
@@ -729,6 +779,12 @@ protected:
    */
   Reservation reserveWithMaxLength(uint64_t max_length);
 
+  /**
+   * @return the current target length for read reservations, adapted by commit() toward the
+   *         amount of reserved space recent reads actually used.
+   */
+  uint64_t targetReadReservationSize() const { return target_read_reservation_size_; }
+
   void commit(uint64_t length, absl::Span<RawSlice> slices,
               ReservationSlicesOwnerPtr slices_owner) override;
 
@@ -743,6 +799,16 @@ private:
   void addImpl(const void* data, uint64_t size);
   void drainImpl(uint64_t size);
 
+  /**
+   * Adjust the target size of subsequent read reservations based on how much of a read
+   * reservation was committed. The target halves (down to one default-size slice) when most of a
+   * reservation goes unused and doubles (up to default_read_reservation_size_) when a reservation
+   * is filled completely, so buffers on mostly-idle connections do not cycle the maximum
+   * reservation through the thread local slice cache on every small read, while fast-filling
+   * buffers quickly return to large reservations that amortize syscall overhead.
+   */
+  void adaptTargetReadReservationSize(uint64_t reserved, uint64_t committed);
+
   /**
    * Moves contents of the `other_slice` by either taking its ownership or coalescing it
    * into an existing slice.
@@ -758,38 +824,35 @@ private:
 
   BufferMemoryAccountSharedPtr account_;
 
+  /** Target length for the next read reservation, see adaptTargetReadReservationSize(). */
+  uint64_t target_read_reservation_size_{default_read_reservation_size_};
+
   struct OwnedImplReservationSlicesOwner : public ReservationSlicesOwner {
     virtual absl::Span<Slice::SizedStorage> ownedStorages() PURE;
+
+    // Nonzero for reservations created through reserveWithMaxLength(): the reserved length, which
+    // commit() compares against the committed length to adapt the target size of subsequent read
+    // reservations.
+    uint64_t read_reservation_length_{0};
   };
 
   struct OwnedImplReservationSlicesOwnerMultiple : public OwnedImplReservationSlicesOwner {
   public:
-    static constexpr uint32_t free_list_max_ = Buffer::Reservation::MAX_SLICES_;
-
-    OwnedImplReservationSlicesOwnerMultiple() : free_list_ref_(free_list_) {}
+    // Thread local resolving introduces additional overhead. Initialize this reference once when
+    // constructing the owner to reduce thread local resolving to improve performance.
+    OwnedImplReservationSlicesOwnerMultiple() : cache_ref_(ThreadLocalSliceCache::instance()) {}
     ~OwnedImplReservationSlicesOwnerMultiple() override {
       for (auto r = owned_storages_.rbegin(); r != owned_storages_.rend(); r++) {
         if (r->mem_ != nullptr) {
           ASSERT(r->len_ == Slice::default_slice_size_);
-          if (free_list_ref_.size() < free_list_max_) {
-            free_list_ref_.push_back(std::move(r->mem_));
-          }
+          cache_ref_.releaseStorage(std::move(r->mem_), r->len_);
         }
       }
     }
 
     Slice::SizedStorage newStorage() {
       ASSERT(Slice::sliceSize(Slice::default_slice_size_) == Slice::default_slice_size_);
-
-      Slice::SizedStorage storage{nullptr, Slice::default_slice_size_};
-      if (!free_list_ref_.empty()) {
-        storage.mem_ = std::move(free_list_ref_.back());
-        free_list_ref_.pop_back();
-      } else {
-        storage.mem_.reset(new uint8_t[Slice::default_slice_size_]);
-      }
-
-      return storage;
+      return cache_ref_.acquireDefaultSizeStorage();
     }
 
     absl::Span<Slice::SizedStorage> ownedStorages() override {
@@ -799,14 +862,7 @@ private:
     absl::InlinedVector<Slice::SizedStorage, Buffer::Reservation::MAX_SLICES_> owned_storages_;
 
   private:
-    // Thread local resolving introduces additional overhead. Initialize this reference once when
-    // constructing the owner to reduce thread local resolving to improve performance.
-    absl::InlinedVector<Slice::StoragePtr, free_list_max_>& free_list_ref_;
-
-    // Simple thread local cache to reduce unnecessary memory allocation and release. This cache
-    // is currently only used for multiple slices reservation because of the additional overhead
-    // that thread local resolving would introduce.
-    static thread_local absl::InlinedVector<Slice::StoragePtr, free_list_max_> free_list_;
+    ThreadLocalSliceCache& cache_ref_;
   };
 
   struct OwnedImplReservationSlicesOwnerSingle : public OwnedImplReservationSlicesOwner {
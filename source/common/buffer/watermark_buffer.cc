@@ -19,6 +19,12 @@ constexpr uint32_t kEffectivelyDisableTrackingBitshift = 63;
 // 50 is an arbitrary limit, and is meant to both limit the number of streams
 // Envoy ends up resetting and avoid triggering the Watchdog system.
 constexpr uint32_t kMaxNumberOfStreamsToResetPerInvocation = 50;
+// Length of the window over which the drain rate is measured for adaptive watermark tuning.
+constexpr std::chrono::milliseconds kAdaptiveSampleWindow{100};
+// Amount of drain time the tuned high watermark should be able to absorb at the observed drain
+// rate. This plays the role of the RTT in a BDP computation: a consumer draining at rate R gets
+// a buffer of roughly R * kAdaptiveTargetHorizon.
+constexpr std::chrono::milliseconds kAdaptiveTargetHorizon{50};
 } // end namespace
 
 void WatermarkBuffer::add(const void* data, uint64_t size) {
@@ -54,6 +60,9 @@ void WatermarkBuffer::commit(uint64_t length, absl::Span<RawSlice> slices,
 
 void WatermarkBuffer::drain(uint64_t size) {
   OwnedImpl::drain(size);
+  if (adaptive_state_ != nullptr) {
+    recordAdaptiveDrain(size);
+  }
   checkLowWatermark();
 }
 
@@ -83,7 +92,7 @@ SliceDataPtr WatermarkBuffer::extractMutableFrontSlice() {
 // the high watermark to avoid overshooting by a lot and thus violating the limits
 // the watermark is imposing.
 Reservation WatermarkBuffer::reserveForRead() {
-  constexpr auto preferred_length = default_read_reservation_size_;
+  const uint64_t preferred_length = targetReadReservationSize();
   uint64_t adjusted_length = preferred_length;
 
   if (high_watermark_ > 0 && preferred_length > 0) {
@@ -133,6 +142,56 @@ void WatermarkBuffer::setWatermarks(uint32_t high_watermark,
   checkLowWatermark();
 }
 
+void WatermarkBuffer::enableAdaptiveWatermarks(TimeSource& time_source,
+                                               uint32_t min_high_watermark,
+                                               uint32_t max_high_watermark,
+                                               uint32_t overflow_watermark_multiplier) {
+  ASSERT(min_high_watermark > 0 && min_high_watermark <= max_high_watermark);
+  adaptive_state_ = std::make_unique<AdaptiveTuningState>(
+      time_source, min_high_watermark, max_high_watermark, overflow_watermark_multiplier);
+  // Start from the most permissive setting; subsequent samples shrink the buffer if the
+  // consumer turns out to be slow.
+  setWatermarks(max_high_watermark, overflow_watermark_multiplier);
+}
+
+void WatermarkBuffer::setAdaptiveWatermarkRange(uint32_t min_high_watermark,
+                                                uint32_t max_high_watermark) {
+  ASSERT(adaptive_state_ != nullptr);
+  ASSERT(min_high_watermark > 0 && min_high_watermark <= max_high_watermark);
+  adaptive_state_->min_high_watermark_ = min_high_watermark;
+  adaptive_state_->max_high_watermark_ = max_high_watermark;
+  const uint32_t clamped =
+      std::min(std::max(high_watermark_, min_high_watermark), max_high_watermark);
+  if (clamped != high_watermark_) {
+    setWatermarks(clamped, adaptive_state_->overflow_watermark_multiplier_);
+  }
+}
+
+void WatermarkBuffer::recordAdaptiveDrain(uint64_t size) {
+  adaptive_state_->drained_in_window_ += size;
+  const MonotonicTime now = adaptive_state_->time_source_.monotonicTime();
+  const auto elapsed =
+      std::chrono::duration_cast<std::chrono::milliseconds>(now - adaptive_state_->window_start_);
+  if (elapsed < kAdaptiveSampleWindow) {
+    return;
+  }
+
+  // Size the buffer to hold kAdaptiveTargetHorizon worth of drain at the observed rate, and
+  // smooth adjustments so a single quiet or bursty window doesn't swing the limit.
+  const uint64_t target = adaptive_state_->drained_in_window_ * kAdaptiveTargetHorizon.count() /
+                          std::max<int64_t>(1, elapsed.count());
+  const uint64_t smoothed = (3 * static_cast<uint64_t>(high_watermark_) + target) / 4;
+  const uint32_t clamped =
+      std::min<uint64_t>(std::max<uint64_t>(smoothed, adaptive_state_->min_high_watermark_),
+                         adaptive_state_->max_high_watermark_);
+
+  adaptive_state_->window_start_ = now;
+  adaptive_state_->drained_in_window_ = 0;
+  if (clamped != high_watermark_) {
+    setWatermarks(clamped, adaptive_state_->overflow_watermark_multiplier_);
+  }
+}
+
 void WatermarkBuffer::checkLowWatermark() {
   if (!above_high_watermark_called_ ||
       (high_watermark_ != 0 && OwnedImpl::length() > low_watermark_)) {
@@ -5,6 +5,7 @@
 
 #include "envoy/buffer/buffer.h"
 #include "envoy/common/optref.h"
+#include "envoy/common/time.h"
 #include "envoy/config/overload/v3/overload.pb.h"
 
 #include "source/common/buffer/buffer_impl.h"
@@ -51,6 +52,30 @@ public:
   // than the low watermark callbacks.
   bool highWatermarkTriggered() const override { return above_high_watermark_called_; }
 
+  /**
+   * Enable adaptive tuning of the high watermark. While enabled, the buffer measures its drain
+   * rate over a sliding sample window and sizes the high watermark to hold roughly a target
+   * horizon worth of drained bytes (a BDP-style estimate), so fast consumers get deep buffers
+   * and slow consumers get shallow ones. The computed value is clamped to
+   * [min_high_watermark, max_high_watermark]; the range can be tightened later (e.g. by an
+   * overload action under memory pressure) with setAdaptiveWatermarkRange().
+   * @param time_source time source used to measure the drain rate; must outlive the buffer.
+   * @param min_high_watermark lower bound for the tuned high watermark.
+   * @param max_high_watermark upper bound for the tuned high watermark; used as the initial
+   * value.
+   * @param overflow_watermark_multiplier overflow multiplier applied on each adjustment, as in
+   * setWatermarks().
+   */
+  void enableAdaptiveWatermarks(TimeSource& time_source, uint32_t min_high_watermark,
+                                uint32_t max_high_watermark,
+                                uint32_t overflow_watermark_multiplier = 0);
+
+  /**
+   * Adjust the bounds used by adaptive tuning, immediately re-clamping the current high
+   * watermark into the new range. Only valid after enableAdaptiveWatermarks().
+   */
+  void setAdaptiveWatermarkRange(uint32_t min_high_watermark, uint32_t max_high_watermark);
+
 protected:
   virtual void checkHighAndOverflowWatermarks();
   virtual void checkLowWatermark();
@@ -59,6 +84,28 @@ private:
   void commit(uint64_t length, absl::Span<RawSlice> slices,
               ReservationSlicesOwnerPtr slices_owner) override;
 
+  void recordAdaptiveDrain(uint64_t size);
+
+  struct AdaptiveTuningState {
+    AdaptiveTuningState(TimeSource& time_source, uint32_t min_high_watermark,
+                        uint32_t max_high_watermark, uint32_t overflow_watermark_multiplier)
+        : time_source_(time_source), min_high_watermark_(min_high_watermark),
+          max_high_watermark_(max_high_watermark),
+          overflow_watermark_multiplier_(overflow_watermark_multiplier),
+          window_start_(time_source.monotonicTime()) {}
+
+    TimeSource& time_source_;
+    uint32_t min_high_watermark_;
+    uint32_t max_high_watermark_;
+    const uint32_t overflow_watermark_multiplier_;
+    MonotonicTime window_start_;
+    uint64_t drained_in_window_{0};
+  };
+
+  // Allocated only when adaptive tuning is enabled so the common static-watermark case pays
+  // nothing beyond a null check on drain.
+  std::unique_ptr<AdaptiveTuningState> adaptive_state_;
+
   std::function<void()> below_low_watermark_;
   std::function<void()> above_high_watermark_;
   std::function<void()> above_overflow_watermark_;
@@ -17,8 +17,8 @@ namespace LinkedList {
  * @param item supplies the item to move in.
  * @param list supplies the list to move the item into.
  */
-template <typename T, typename U>
-void moveIntoList(std::unique_ptr<T>&& item, std::list<std::unique_ptr<U>>& list) {
+template <typename T, typename D, typename U, typename E>
+void moveIntoList(std::unique_ptr<T, D>&& item, std::list<std::unique_ptr<U, E>>& list) {
   ASSERT(!item->inserted_);
   item->inserted_ = true;
   auto position = list.emplace(list.begin(), std::move(item));
@@ -30,8 +30,8 @@ void moveIntoList(std::unique_ptr<T>&& item, std::list<std::unique_ptr<U>>& list
  * @param item supplies the item to move in.
  * @param list supplies the list to move the item into.
  */
-template <typename T, typename U>
-void moveIntoListBack(std::unique_ptr<T>&& item, std::list<std::unique_ptr<U>>& list) {
+template <typename T, typename D, typename U, typename E>
+void moveIntoListBack(std::unique_ptr<T, D>&& item, std::list<std::unique_ptr<U, E>>& list) {
   ASSERT(!item->inserted_);
   item->inserted_ = true;
   auto position = list.emplace(list.end(), std::move(item));
@@ -44,9 +44,9 @@ void moveIntoListBack(std::unique_ptr<T>&& item, std::list<std::unique_ptr<U>>&
  * Mixin class that allows an object contained in a unique pointer to be easily linked and unlinked
  * from lists.
  */
-template <class T> class LinkedObject {
+template <class T, class D = std::default_delete<T>> class LinkedObject {
 public:
-  using ListType = std::list<std::unique_ptr<T>>;
+  using ListType = std::list<std::unique_ptr<T, D>>;
 
   /**
    * @return the list iterator for the object.
@@ -77,11 +77,11 @@ public:
    * Remove this item from a list.
    * @param list supplies the list to remove from. This item should be in this list.
    */
-  std::unique_ptr<T> removeFromList(ListType& list) {
+  std::unique_ptr<T, D> removeFromList(ListType& list) {
     ASSERT(inserted_);
     ASSERT(std::find(list.begin(), list.end(), *entry_) != list.end());
 
-    std::unique_ptr<T> removed = std::move(*entry_);
+    std::unique_ptr<T, D> removed = std::move(*entry_);
     list.erase(entry_);
     inserted_ = false;
     return removed;
@@ -91,10 +91,11 @@ protected:
   LinkedObject() = default;
 
 private:
-  template <typename U, typename V>
-  friend void LinkedList::moveIntoList(std::unique_ptr<U>&&, std::list<std::unique_ptr<V>>&);
-  template <typename U, typename V>
-  friend void LinkedList::moveIntoListBack(std::unique_ptr<U>&&, std::list<std::unique_ptr<V>>&);
+  template <typename U, typename V, typename W, typename X>
+  friend void LinkedList::moveIntoList(std::unique_ptr<U, V>&&, std::list<std::unique_ptr<W, X>>&);
+  template <typename U, typename V, typename W, typename X>
+  friend void LinkedList::moveIntoListBack(std::unique_ptr<U, V>&&,
+                                           std::list<std::unique_ptr<W, X>>&);
 
   typename ListType::iterator entry_;
   bool inserted_{false}; // iterators do not have any "invalid" value so we need this boolean for
@@ -4,6 +4,7 @@
 #include "absl/strings/str_cat.h"
 
 #if defined(__linux__)
+#include <sched.h>
 #include <sys/syscall.h>
 #endif
 
@@ -52,6 +53,19 @@ public:
         this);
     RELEASE_ASSERT(rc == 0, "");
 
+#if defined(__linux__)
+    if (options && options->cpu_affinity_.has_value()) {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      CPU_SET(options->cpu_affinity_.value(), &cpu_set);
+      const int set_affinity_rc = pthread_setaffinity_np(thread_handle_, sizeof(cpu_set), &cpu_set);
+      if (set_affinity_rc != 0) {
+        ENVOY_LOG_MISC(warn, "Error {} pinning thread `{}' to CPU {}", set_affinity_rc, name_,
+                       options->cpu_affinity_.value());
+      }
+    }
+#endif
+
 #if SUPPORTS_PTHREAD_NAMING
     // If the name was not specified, get it from the OS. If the name was
     // specified, write it into the thread, and assert that the OS sees it the
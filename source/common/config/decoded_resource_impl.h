@@ -4,6 +4,7 @@
 #include "envoy/config/subscription.h"
 #include "envoy/service/discovery/v3/discovery.pb.h"
 
+#include "source/common/common/hash.h"
 #include "source/common/protobuf/utility.h"
 
 #include "xds/core/v3/collection_entry.pb.h"
@@ -67,7 +68,8 @@ public:
   DecodedResourceImpl(ProtobufTypes::MessagePtr resource, const std::string& name,
                       const std::vector<std::string>& aliases, const std::string& version)
       : resource_(std::move(resource)), has_resource_(true), name_(name), aliases_(aliases),
-        version_(version), ttl_(absl::nullopt), metadata_(absl::nullopt) {}
+        version_(version), ttl_(absl::nullopt), metadata_(absl::nullopt),
+        content_hash_(absl::nullopt) {}
 
   // Config::DecodedResource
   const std::string& name() const override { return name_; }
@@ -79,6 +81,7 @@ public:
   const OptRef<const envoy::config::core::v3::Metadata> metadata() const override {
     return metadata_.has_value() ? makeOptRef(metadata_.value()) : absl::nullopt;
   }
+  absl::optional<uint64_t> contentHash() const override { return content_hash_; }
 
 private:
   DecodedResourceImpl(OpaqueResourceDecoder& resource_decoder, absl::optional<std::string> name,
@@ -89,7 +92,7 @@ private:
       : resource_(resource_decoder.decodeResource(resource)), has_resource_(has_resource),
         name_(name ? *name : resource_decoder.resourceName(*resource_)),
         aliases_(repeatedPtrFieldToVector(aliases)), version_(version), ttl_(ttl),
-        metadata_(metadata) {}
+        metadata_(metadata), content_hash_(HashUtil::xxHash64(resource.value())) {}
 
   const ProtobufTypes::MessagePtr resource_;
   const bool has_resource_;
@@ -102,6 +105,10 @@ private:
   // This is the metadata info under the Resource wrapper.
   // It is intended to be consumed in the xds_config_tracker extension.
   const absl::optional<envoy::config::core::v3::Metadata> metadata_;
+
+  // Hash of the serialized resource bytes as received from the wire; unset when the resource was
+  // constructed from an already decoded message.
+  const absl::optional<uint64_t> content_hash_;
 };
 
 struct DecodedResourcesWrapper {
@@ -105,13 +105,12 @@ bool Metadata::metadataLabelMatch(const LabelSet& label_set,
   return true;
 }
 
-ConstMetadataSharedPoolSharedPtr
-Metadata::getConstMetadataSharedPool(Singleton::Manager& manager, Event::Dispatcher& dispatcher) {
-  return manager.getTyped<SharedPool::ObjectSharedPool<const envoy::config::core::v3::Metadata,
-                                                       MessageUtil, MessageUtil>>(
-      SINGLETON_MANAGER_REGISTERED_NAME(const_metadata_shared_pool), [&dispatcher] {
-        return std::make_shared<SharedPool::ObjectSharedPool<
-            const envoy::config::core::v3::Metadata, MessageUtil, MessageUtil>>(dispatcher);
+ConstMetadataSharedPoolSharedPtr Metadata::getConstMetadataSharedPool(Singleton::Manager& manager) {
+  return manager.getTyped<SharedPool::ShardedObjectSharedPool<
+      const envoy::config::core::v3::Metadata, MessageUtil, MessageUtil>>(
+      SINGLETON_MANAGER_REGISTERED_NAME(const_metadata_shared_pool), [] {
+        return std::make_shared<SharedPool::ShardedObjectSharedPool<
+            const envoy::config::core::v3::Metadata, MessageUtil, MessageUtil>>();
       });
 }
 
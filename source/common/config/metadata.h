@@ -5,7 +5,6 @@
 
 #include "envoy/config/core/v3/base.pb.h"
 #include "envoy/config/typed_metadata.h"
-#include "envoy/event/dispatcher.h"
 #include "envoy/registry/registry.h"
 #include "envoy/singleton/manager.h"
 #include "envoy/type/metadata/v3/metadata.pb.h"
@@ -19,8 +18,8 @@ namespace Envoy {
 namespace Config {
 
 using ConstMetadataSharedPoolSharedPtr =
-    std::shared_ptr<SharedPool::ObjectSharedPool<const envoy::config::core::v3::Metadata,
-                                                 MessageUtil, MessageUtil>>;
+    std::shared_ptr<SharedPool::ShardedObjectSharedPool<const envoy::config::core::v3::Metadata,
+                                                        MessageUtil, MessageUtil>>;
 
 /**
  * MetadataKey presents the key name and path to retrieve value from metadata.
@@ -91,13 +90,12 @@ public:
                                  const envoy::config::core::v3::Metadata* host_metadata,
                                  const std::string& filter_key, bool list_as_any);
   /**
-   * Returns an ObjectSharedPool to store const Metadata
+   * Returns a ShardedObjectSharedPool to store const Metadata. The pool may be used from any
+   * thread; host metadata deduplication during large endpoint updates contends only within a
+   * shard rather than funneling through the main dispatcher.
    * @param manager used to create singleton
-   * @param dispatcher the dispatcher object reference to the thread that created the
-   * ObjectSharedPool
    */
-  static ConstMetadataSharedPoolSharedPtr getConstMetadataSharedPool(Singleton::Manager& manager,
-                                                                     Event::Dispatcher& dispatcher);
+  static ConstMetadataSharedPoolSharedPtr getConstMetadataSharedPool(Singleton::Manager& manager);
 };
 
 template <typename factoryClass> class TypedMetadataImpl : public TypedMetadata {
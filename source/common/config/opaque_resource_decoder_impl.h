@@ -2,7 +2,11 @@
 
 #include "envoy/config/subscription.h"
 
+#include "source/common/common/hash.h"
 #include "source/common/protobuf/utility.h"
+#include "source/common/runtime/runtime_features.h"
+
+#include "absl/container/flat_hash_set.h"
 
 namespace Envoy {
 namespace Config {
@@ -19,7 +23,8 @@ public:
     // If the Any is a synthetic empty message (e.g. because the resource field was not set in
     // Resource, this might be empty, so we shouldn't decode.
     if (!resource.type_url().empty()) {
-      MessageUtil::anyConvertAndValidate<Current>(resource, *typed_message, validation_visitor_);
+      MessageUtil::anyConvert<Current>(resource, *typed_message);
+      validateIfChanged(resource, *typed_message);
     }
     return typed_message;
   }
@@ -29,8 +34,36 @@ public:
   }
 
 private:
+  // Validates the decoded message, skipping the (expensive, recursive) validation if a resource
+  // with identical serialized bytes has already passed validation through this decoder. SotW
+  // servers resend every resource on each push, so on a typical update most resources are
+  // unchanged and hit the cache.
+  void validateIfChanged(const ProtobufWkt::Any& resource, Current& typed_message) {
+    if (!Runtime::runtimeFeatureEnabled(
+            "envoy.reloadable_features.skip_revalidation_of_unchanged_xds_resources")) {
+      MessageUtil::validate(typed_message, validation_visitor_);
+      return;
+    }
+    const uint64_t hash = HashUtil::xxHash64(resource.value());
+    if (validated_resource_hashes_.contains(hash)) {
+      return;
+    }
+    MessageUtil::validate(typed_message, validation_visitor_);
+    // Bound the memory used to remember validation results when resource contents churn and never
+    // repeat; re-validating after a reset is cheap relative to unbounded growth.
+    if (validated_resource_hashes_.size() >= MaxValidatedResourceHashes) {
+      validated_resource_hashes_.clear();
+    }
+    validated_resource_hashes_.insert(hash);
+  }
+
+  // ~64KiB per decoder when full; large enough to cover every resource of a big singleton
+  // subscription (e.g. a multi-thousand cluster CDS push).
+  static constexpr size_t MaxValidatedResourceHashes = 4096;
+
   ProtobufMessage::ValidationVisitor& validation_visitor_;
   const std::string name_field_;
+  absl::flat_hash_set<uint64_t> validated_resource_hashes_;
 };
 
 } // namespace Config
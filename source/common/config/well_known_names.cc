@@ -62,10 +62,10 @@ TagNameValues::TagNameValues() {
   // - Typical * notation will be used to denote an arbitrary set of characters.
 
   // *_rq(_<response_code>)
-  addRe2(RESPONSE_CODE, R"(_rq(_(\d{3}))$)", "_rq_");
+  addCompiled(RESPONSE_CODE, CompiledPattern::ResponseCode);
 
   // *_rq_(<response_code_class>)xx
-  addRe2(RESPONSE_CODE_CLASS, R"(_rq_((\d))xx$)", "_rq_");
+  addCompiled(RESPONSE_CODE_CLASS, CompiledPattern::ResponseCodeClass);
 
   // http.[<stat_prefix>.]dynamodb.table.[<table_name>.]capacity.[<operation_name>.](__partition_id=<last_seven_characters_from_partition_id>)
   addRe2(
@@ -168,7 +168,7 @@ TagNameValues::TagNameValues() {
       "");
 
   // listener.(<address|stat_prefix>.)*, but specifically excluding "admin"
-  addRe2(LISTENER_ADDRESS, R"(^listener\.((<ADDRESS>|<TAG_VALUE>)\.))", "", "admin");
+  addCompiled(LISTENER_ADDRESS, CompiledPattern::ListenerAddress);
 
   // vhost.(<virtual host name>.)*
   addTokenized(VIRTUAL_HOST, "vhost.$.**");
@@ -210,5 +210,9 @@ void TagNameValues::addTokenized(const std::string& name, const std::string& tok
   tokenized_descriptor_vec_.emplace_back(TokenizedDescriptor{name, tokens});
 }
 
+void TagNameValues::addCompiled(const std::string& name, CompiledPattern pattern) {
+  compiled_descriptor_vec_.emplace_back(CompiledDescriptor{name, pattern});
+}
+
 } // namespace Config
 } // namespace Envoy
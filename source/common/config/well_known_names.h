@@ -63,10 +63,10 @@ public:
   TagNameValues();
 
   /**
-   * Represents a tag extraction. This structure may be extended to
-   * allow for an faster pattern-matching engine to be used as an
-   * alternative to regexes, on an individual tag basis. Some of the
-   * tags, such as "_rq_(\\d)xx$", will probably stay as regexes.
+   * Represents a tag extraction performed with a regex. The hottest
+   * built-in patterns have been migrated to TokenizedDescriptor or
+   * CompiledDescriptor below; this remains for the built-in patterns that
+   * genuinely need a regex, and for user-supplied custom patterns.
    */
   struct Descriptor {
     const std::string name_;
@@ -81,6 +81,21 @@ public:
     const std::string pattern_;
   };
 
+  // Built-in patterns that run against every stat name but cannot be
+  // expressed as dot-separated tokens, so they get hand-written matchers
+  // rather than regexes. Each value corresponds to a TagExtractor class in
+  // source/common/stats/tag_extractor_impl.h.
+  enum class CompiledPattern {
+    ResponseCode,
+    ResponseCodeClass,
+    ListenerAddress,
+  };
+
+  struct CompiledDescriptor {
+    const std::string name_;
+    const CompiledPattern pattern_;
+  };
+
   // Cluster name tag
   const std::string CLUSTER_NAME = "envoy.cluster_name";
   // Listener port tag
@@ -165,6 +180,11 @@ public:
     return tokenized_descriptor_vec_;
   }
 
+  // Returns the list of compiled (non-regex) descriptors.
+  const std::vector<CompiledDescriptor>& compiledDescriptorVec() const {
+    return compiled_descriptor_vec_;
+  }
+
 private:
   void addRe2(const std::string& name, const std::string& regex, const std::string& substr = "",
               const std::string& negative_matching_value = "");
@@ -174,11 +194,16 @@ private:
   // tokens.
   void addTokenized(const std::string& name, const std::string& tokens);
 
+  void addCompiled(const std::string& name, CompiledPattern pattern);
+
   // Collection of tag descriptors.
   std::vector<Descriptor> descriptor_vec_;
 
   // Collection of tokenized tag descriptors.
   std::vector<TokenizedDescriptor> tokenized_descriptor_vec_;
+
+  // Collection of compiled tag descriptors.
+  std::vector<CompiledDescriptor> compiled_descriptor_vec_;
 };
 
 using TagNames = ConstSingleton<TagNameValues>;
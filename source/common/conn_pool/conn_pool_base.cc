@@ -26,7 +26,8 @@ ConnPoolImplBase::ConnPoolImplBase(
     Upstream::ClusterConnectivityState& state)
     : state_(state), host_(host), priority_(priority), dispatcher_(dispatcher),
       socket_options_(options), transport_socket_options_(transport_socket_options),
-      upstream_ready_cb_(dispatcher_.createSchedulableCallback([this]() { onUpstreamReady(); })) {}
+      upstream_ready_cb_(dispatcher_.createSchedulableCallback([this]() { onUpstreamReady(); })),
+      per_upstream_preconnect_ratio_(host->cluster().perUpstreamPreconnectRatio()) {}
 
 ConnPoolImplBase::~ConnPoolImplBase() {
   ASSERT(isIdleImpl());
@@ -102,10 +103,6 @@ bool ConnPoolImplBase::shouldCreateNewConnection(float global_preconnect_ratio)
   }
 }
 
-float ConnPoolImplBase::perUpstreamPreconnectRatio() const {
-  return host_->cluster().perUpstreamPreconnectRatio();
-}
-
 ConnPoolImplBase::ConnectionResult ConnPoolImplBase::tryCreateNewConnections() {
   ConnPoolImplBase::ConnectionResult result;
   // Somewhat arbitrarily cap the number of connections preconnected due to new
@@ -343,7 +343,9 @@ protected:
   // connection preconnect.
   bool shouldCreateNewConnection(float global_preconnect_ratio) const;
 
-  float perUpstreamPreconnectRatio() const;
+  // The cluster's preconnect ratio is immutable for the lifetime of the pool, so it is latched at
+  // construction rather than re-fetched through the host on every stream event.
+  float perUpstreamPreconnectRatio() const { return per_upstream_preconnect_ratio_; }
 
   ConnectionPool::Cancellable*
   addPendingStream(Envoy::ConnectionPool::PendingStreamPtr&& pending_stream) {
@@ -409,6 +411,7 @@ private:
   bool deferred_deleting_{false};
 
   Event::SchedulableCallbackPtr upstream_ready_cb_;
+  const float per_upstream_preconnect_ratio_;
   Common::DebugRecursionChecker recursion_checker_;
 };
 
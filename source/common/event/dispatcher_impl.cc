@@ -133,6 +133,10 @@ void DispatcherImpl::clearDeferredDeleteList() {
 
   touchWatchdog();
   deferred_deleting_ = true;
+  absl::optional<MonotonicTime> phase_start;
+  if (stats_ != nullptr) {
+    phase_start = time_source_.monotonicTime();
+  }
 
   // Calling clear() on the vector does not specify which order destructors run in. We want to
   // destroy in FIFO order so just do it manually. This required 2 passes over the vector which is
@@ -143,6 +147,9 @@ void DispatcherImpl::clearDeferredDeleteList() {
 
   to_delete->clear();
   deferred_deleting_ = false;
+  if (phase_start.has_value()) {
+    recordDispatcherPhaseDuration(stats_->deferred_delete_duration_us_, *phase_start, time_source_);
+  }
 }
 
 Network::ServerConnectionPtr
@@ -254,14 +261,13 @@ SignalEventPtr DispatcherImpl::listenForSignal(signal_t signal_num, SignalCb cb)
 }
 
 void DispatcherImpl::post(PostCb callback) {
-  bool do_post;
-  {
-    Thread::LockGuard lock(post_lock_);
-    do_post = post_callbacks_.empty();
-    post_callbacks_.push_back(std::move(callback));
+  if (post_queue_.push(std::move(callback))) {
+    post_cb_->scheduleCallbackCurrentIteration();
   }
+}
 
-  if (do_post) {
+void DispatcherImpl::post(absl::Span<PostCb> callbacks) {
+  if (post_queue_.push(callbacks)) {
     post_cb_->scheduleCallbackCurrentIteration();
   }
 }
@@ -301,11 +307,7 @@ void DispatcherImpl::shutdown() {
   // callbacks and dispatcher thread deletable objects.
   ASSERT(isThreadSafe());
   auto deferred_deletables_size = current_to_delete_->size();
-  std::list<std::function<void()>>::size_type post_callbacks_size;
-  {
-    Thread::LockGuard lock(post_lock_);
-    post_callbacks_size = post_callbacks_.size();
-  }
+  const uint64_t post_callbacks_size = post_queue_.approximateSize();
 
   std::list<DispatcherThreadDeletableConstPtr> local_deletables;
   {
@@ -351,27 +353,29 @@ void DispatcherImpl::runPostCallbacks() {
   // objects that is being deferred deleted.
   clearDeferredDeleteList();
 
-  std::list<PostCb> callbacks;
-  {
-    // Take ownership of the callbacks under the post_lock_. The lock must be released before
-    // callbacks execute. Callbacks added after this transfer will re-arm post_cb_ and will execute
-    // later in the event loop.
-    Thread::LockGuard lock(post_lock_);
-    callbacks = std::move(post_callbacks_);
-    // post_callbacks_ should be empty after the move.
-    ASSERT(post_callbacks_.empty());
+  uint64_t popped = 0;
+  absl::optional<MonotonicTime> phase_start;
+  if (stats_ != nullptr) {
+    phase_start = time_source_.monotonicTime();
   }
-  // It is important that the execution and deletion of the callback happen while post_lock_ is not
-  // held. Either the invocation or destructor of the callback can call post() on this dispatcher.
-  while (!callbacks.empty()) {
+  // Pop and run callbacks one at a time so that the destructor of each callback runs before the
+  // next callback executes. Either the invocation or destructor of a callback can call post() on
+  // this dispatcher; new callbacks are simply linked behind the ones being drained.
+  while (absl::optional<PostCb> callback = post_queue_.pop()) {
     // Touch the watchdog before executing the callback to avoid spurious watchdog miss events when
     // executing a long list of callbacks.
     touchWatchdog();
-    // Run the callback.
-    callbacks.front()();
-    // Pop the front so that the destructor of the callback that just executed runs before the next
-    // callback executes.
-    callbacks.pop_front();
+    (*callback)();
+    popped++;
+  }
+  if (popped > 0 && phase_start.has_value()) {
+    recordDispatcherPhaseDuration(stats_->post_callbacks_duration_us_, *phase_start, time_source_);
+  }
+  // A producer that saw a non-empty queue does not schedule a wakeup, and a producer that was
+  // preempted mid-push leaves its callback invisible to pop() for a moment; in either case
+  // drained() reports leftovers and we re-arm to pick them up in a later iteration.
+  if (popped > 0 && post_queue_.drained(popped)) {
+    post_cb_->scheduleCallbackCurrentIteration();
   }
 }
 
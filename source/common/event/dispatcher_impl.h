@@ -18,6 +18,7 @@
 #include "source/common/common/thread.h"
 #include "source/common/event/libevent.h"
 #include "source/common/event/libevent_scheduler.h"
+#include "source/common/event/mpsc_post_queue.h"
 #include "source/common/signal/fatal_error_handler.h"
 
 #include "absl/container/inlined_vector.h"
@@ -55,6 +56,12 @@ public:
    */
   event_base& base() { return base_scheduler_.base(); }
 
+  /**
+   * @return DispatcherStats* the dispatcher's stats, or nullptr if initializeStats has not been
+   * called. Used by the owned event objects to record per-phase loop durations.
+   */
+  DispatcherStats* stats() { return stats_.get(); }
+
   // Event::Dispatcher
   const std::string& name() override { return name_; }
   void registerWatchdog(const Server::WatchDogSharedPtr& watchdog,
@@ -88,8 +95,12 @@ public:
   void exit() override;
   SignalEventPtr listenForSignal(signal_t signal_num, SignalCb cb) override;
   void post(PostCb callback) override;
+  void post(absl::Span<PostCb> callbacks) override;
   void deleteInDispatcherThread(DispatcherThreadDeletableConstPtr deletable) override;
   void run(RunType type) override;
+  void enableBusyPolling(std::chrono::microseconds idle_budget) override {
+    base_scheduler_.enableBusyPolling(idle_budget);
+  }
   Buffer::WatermarkFactory& getWatermarkFactory() override { return *buffer_factory_; }
   void pushTrackedObject(const ScopeTrackedObject* object) override;
   void popTrackedObject(const ScopeTrackedObject* expected_object) override;
@@ -166,8 +177,7 @@ private:
   SchedulableCallbackPtr deferred_delete_cb_;
 
   SchedulableCallbackPtr post_cb_;
-  Thread::MutexBasicLockable post_lock_;
-  std::list<PostCb> post_callbacks_ ABSL_GUARDED_BY(post_lock_);
+  MpscPostQueue post_queue_;
 
   std::vector<DeferredDeletablePtr> to_delete_1_;
   std::vector<DeferredDeletablePtr> to_delete_2_;
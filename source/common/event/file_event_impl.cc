@@ -158,7 +158,17 @@ void FileEventImpl::mergeInjectedEventsAndRunCb(uint32_t events) {
     }
   }
 
+  // The callback may destroy this event, so anything needed after cb_() runs must be captured
+  // into locals before invoking it.
+  DispatcherStats* stats = dispatcher_.stats();
+  if (stats == nullptr) {
+    cb_(events);
+    return;
+  }
+  TimeSource& time_source = dispatcher_.timeSource();
+  const MonotonicTime start = time_source.monotonicTime();
   cb_(events);
+  recordDispatcherPhaseDuration(stats->file_event_duration_us_, start, time_source);
 }
 
 } // namespace Event
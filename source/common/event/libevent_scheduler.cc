@@ -36,7 +36,9 @@ LibeventScheduler::LibeventScheduler() {
 }
 
 TimerPtr LibeventScheduler::createTimer(const TimerCb& cb, Dispatcher& dispatcher) {
-  return std::make_unique<TimerImpl>(libevent_, cb, dispatcher);
+  // Pass the address of stats_ so timers created before initializeStats start recording their
+  // callback durations once stats are available.
+  return std::make_unique<TimerImpl>(libevent_, cb, dispatcher, &stats_);
 };
 
 SchedulableCallbackPtr
@@ -54,12 +56,36 @@ void LibeventScheduler::run(Dispatcher::RunType mode) {
     // http://www.wangafu.net/~nickm/libevent-book/Ref3_eventloop.html
     break;
   case Dispatcher::RunType::RunUntilExit:
+    if (busy_poll_idle_budget_.count() > 0) {
+      runBusyPollLoop();
+      return;
+    }
     flag = EVLOOP_NO_EXIT_ON_EMPTY;
     break;
   }
   event_base_loop(libevent_.get(), flag);
 }
 
+void LibeventScheduler::runBusyPollLoop() {
+  // Alternate nonblocking event loop passes with a blocking fallback: after every wakeup the
+  // loop spins for the idle budget so that events arriving close together are picked up without
+  // paying the poller wakeup latency, then blocks in the kernel until the next event and resumes
+  // spinning. Expired timers are still serviced by each nonblocking pass.
+  while (true) {
+    const auto spin_deadline = std::chrono::steady_clock::now() + busy_poll_idle_budget_;
+    do {
+      event_base_loop(libevent_.get(), flagsBasedOnEventType());
+      if (event_base_got_exit(libevent_.get()) || event_base_got_break(libevent_.get())) {
+        return;
+      }
+    } while (std::chrono::steady_clock::now() < spin_deadline);
+    event_base_loop(libevent_.get(), EVLOOP_ONCE | EVLOOP_NO_EXIT_ON_EMPTY);
+    if (event_base_got_exit(libevent_.get()) || event_base_got_break(libevent_.get())) {
+      return;
+    }
+  }
+}
+
 void LibeventScheduler::loopExit() { event_base_loopexit(libevent_.get(), nullptr); }
 
 void LibeventScheduler::registerOnPrepareCallback(OnPrepareCallback&& callback) {
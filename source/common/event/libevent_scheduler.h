@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 
 #include "envoy/event/dispatcher.h"
@@ -75,6 +76,15 @@ public:
    */
   void loopExit();
 
+  /**
+   * Makes Dispatcher::RunType::RunUntilExit busy poll for new events for `idle_budget` after
+   * the loop goes idle, before blocking in the kernel poller. See
+   * Dispatcher::enableBusyPolling.
+   */
+  void enableBusyPolling(std::chrono::microseconds idle_budget) {
+    busy_poll_idle_budget_ = idle_budget;
+  }
+
   /**
    * TODO(jmarantz): consider strengthening this abstraction and instead of
    * exposing the libevent base pointer, provide API abstractions for the calls
@@ -100,6 +110,8 @@ public:
   void initializeStats(DispatcherStats* stats);
 
 private:
+  void runBusyPollLoop();
+
   static void onPrepareForCallback(evwatch*, const evwatch_prepare_cb_info* info, void* arg);
   static void onPrepareForStats(evwatch*, const evwatch_prepare_cb_info* info, void* arg);
   static void onCheckForStats(evwatch*, const evwatch_check_cb_info*, void* arg);
@@ -115,6 +127,9 @@ private:
   }
 
   Libevent::BasePtr libevent_;
+  // When non-zero, RunType::RunUntilExit busy polls for this long after the loop goes idle
+  // before blocking in the kernel poller.
+  std::chrono::microseconds busy_poll_idle_budget_{0};
   DispatcherStats* stats_{}; // stats owned by the containing DispatcherImpl
   bool timeout_set_{};       // whether there is a poll timeout in the current event loop iteration
   timeval timeout_{};        // the poll timeout for the current event loop iteration, if available
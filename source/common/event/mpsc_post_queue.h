@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+
+#include "envoy/event/dispatcher.h"
+
+#include "source/common/common/non_copyable.h"
+
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * A lock free multi producer, single consumer queue of post callbacks, based on Vyukov's MPSC
+ * node queue. Producers link a heap allocated node per callback (or one chain per batch) with a
+ * single atomic exchange, so cross thread posts never contend on a mutex; only the dispatcher
+ * thread pops.
+ *
+ * A producer can be preempted between publishing the queue size and linking its node, so pop()
+ * may transiently find nothing even though callbacks are outstanding. The consumer compensates
+ * by calling drained() with the number of callbacks it popped: when that reports leftovers it
+ * must re-arm its wakeup and try again, which also covers callbacks pushed mid-drain whose
+ * producers saw a non-empty queue and therefore did not schedule a wakeup.
+ */
+class MpscPostQueue : NonCopyable {
+public:
+  MpscPostQueue() : head_(&stub_), tail_(&stub_) {}
+
+  ~MpscPostQueue() {
+    // Drop any callbacks that were posted but never ran, along with the consumed dummy node at
+    // the tail.
+    Node* node = tail_;
+    while (node != nullptr) {
+      Node* next = node->next_.load(std::memory_order_acquire);
+      if (node != &stub_) {
+        delete node;
+      }
+      node = next;
+    }
+  }
+
+  /**
+   * Enqueue a callback. Safe to call from any thread.
+   * @return true if the queue transitioned from empty to non-empty, i.e. the caller should
+   *         schedule a consumer wakeup.
+   */
+  bool push(PostCb&& callback) {
+    Node* node = new Node(std::move(callback));
+    const bool was_empty = size_.fetch_add(1, std::memory_order_acq_rel) == 0;
+    pushChain(node, node);
+    return was_empty;
+  }
+
+  /**
+   * Enqueue a batch of callbacks, linked into the queue with a single atomic exchange. The
+   * callbacks are consumed (moved from). Safe to call from any thread.
+   * @return true if the queue transitioned from empty to non-empty, i.e. the caller should
+   *         schedule a consumer wakeup.
+   */
+  bool push(absl::Span<PostCb> callbacks) {
+    if (callbacks.empty()) {
+      return false;
+    }
+    Node* first = nullptr;
+    Node* last = nullptr;
+    for (PostCb& callback : callbacks) {
+      Node* node = new Node(std::move(callback));
+      if (first == nullptr) {
+        first = node;
+      } else {
+        last->next_.store(node, std::memory_order_relaxed);
+      }
+      last = node;
+    }
+    const bool was_empty = size_.fetch_add(callbacks.size(), std::memory_order_acq_rel) == 0;
+    pushChain(first, last);
+    return was_empty;
+  }
+
+  /**
+   * Pop the oldest callback, or nullopt if none is currently linked. Consumer thread only.
+   */
+  absl::optional<PostCb> pop() {
+    Node* tail = tail_;
+    Node* next = tail->next_.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      return absl::nullopt;
+    }
+    // `next` becomes the new consumed dummy node; the old one is freed.
+    tail_ = next;
+    if (tail != &stub_) {
+      delete tail;
+    }
+    return std::move(next->cb_);
+  }
+
+  /**
+   * Report that the consumer popped `popped` callbacks since the last call. Consumer thread
+   * only.
+   * @return true when callbacks remain outstanding, in which case the consumer must re-arm its
+   *         wakeup.
+   */
+  bool drained(uint64_t popped) {
+    return size_.fetch_sub(popped, std::memory_order_acq_rel) != popped;
+  }
+
+  /**
+   * @return the number of outstanding callbacks; approximate since producers may be mid-push.
+   */
+  uint64_t approximateSize() const { return size_.load(std::memory_order_relaxed); }
+
+private:
+  struct Node {
+    Node() = default;
+    explicit Node(PostCb&& callback) : cb_(std::move(callback)) {}
+    std::atomic<Node*> next_{nullptr};
+    PostCb cb_;
+  };
+
+  void pushChain(Node* first, Node* last) {
+    Node* prev = head_.exchange(last, std::memory_order_acq_rel);
+    prev->next_.store(first, std::memory_order_release);
+  }
+
+  Node stub_;
+  std::atomic<Node*> head_;  // Most recently pushed node; shared by producers.
+  Node* tail_;               // Consumed dummy node whose next_ is the oldest live node.
+  std::atomic<uint64_t> size_{0};
+};
+
+} // namespace Event
+} // namespace Envoy
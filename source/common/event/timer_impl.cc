@@ -9,20 +9,34 @@
 namespace Envoy {
 namespace Event {
 
-TimerImpl::TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Dispatcher& dispatcher)
-    : cb_(cb), dispatcher_(dispatcher) {
+TimerImpl::TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Dispatcher& dispatcher,
+                     DispatcherStats* const* stats_source)
+    : cb_(cb), dispatcher_(dispatcher), stats_source_(stats_source) {
   ASSERT(cb_);
   evtimer_assign(
       &raw_event_, libevent.get(),
       [](evutil_socket_t, short, void* arg) -> void {
         TimerImpl* timer = static_cast<TimerImpl*>(arg);
+        // The callback may destroy the timer, so anything needed after cb_() runs must be captured
+        // into locals before invoking it.
+        DispatcherStats* stats =
+            timer->stats_source_ != nullptr ? *timer->stats_source_ : nullptr;
+        TimeSource* time_source = nullptr;
+        absl::optional<MonotonicTime> start;
+        if (stats != nullptr) {
+          time_source = &timer->dispatcher_.timeSource();
+          start = time_source->monotonicTime();
+        }
         if (timer->object_ == nullptr) {
           timer->cb_();
-          return;
+        } else {
+          ScopeTrackerScopeState scope(timer->object_, timer->dispatcher_);
+          timer->object_ = nullptr;
+          timer->cb_();
+        }
+        if (start.has_value()) {
+          recordDispatcherPhaseDuration(stats->timer_duration_us_, *start, *time_source);
         }
-        ScopeTrackerScopeState scope(timer->object_, timer->dispatcher_);
-        timer->object_ = nullptr;
-        timer->cb_();
       },
       this);
 }
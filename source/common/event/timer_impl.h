@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "envoy/event/dispatcher.h"
 #include "envoy/event/timer.h"
 
 #include "source/common/common/scope_tracker.h"
@@ -52,7 +53,10 @@ public:
  */
 class TimerImpl : public Timer, ImplBase {
 public:
-  TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Event::Dispatcher& dispatcher);
+  // stats_source, when non-null, points at the owning scheduler's DispatcherStats pointer, which
+  // becomes non-null once Dispatcher::initializeStats runs; until then callbacks are not timed.
+  TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Event::Dispatcher& dispatcher,
+            DispatcherStats* const* stats_source = nullptr);
 
   // Timer
   void disableTimer() override;
@@ -66,6 +70,7 @@ private:
   void internalEnableTimer(const timeval& tv, const ScopeTrackedObject* scope);
   TimerCb cb_;
   Dispatcher& dispatcher_;
+  DispatcherStats* const* const stats_source_;
   // This has to be atomic for alarms which are handled out of thread, for
   // example if the DispatcherImpl::post is called by two threads, they race to
   // both set this to null.
@@ -0,0 +1,216 @@
+#include "source/common/event/timer_wheel_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "source/common/common/assert.h"
+#include "source/common/common/scope_tracker.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * Implementation of Timer linked into a bucket of the backing wheel while enabled. The wheel
+ * tracks the timer's position (level, slot and list iterator) through the members below so both
+ * removal and re-insertion on cascade are O(1).
+ */
+class TimerWheelScheduler::WheelTimerImpl final : public Timer {
+public:
+  WheelTimerImpl(TimerCb cb, TimerWheelScheduler& scheduler, Dispatcher& dispatcher)
+      : cb_(std::move(cb)), scheduler_(scheduler), dispatcher_(dispatcher) {
+    ASSERT(cb_);
+  }
+
+  ~WheelTimerImpl() override { disableTimer(); }
+
+  // Timer
+  void disableTimer() override {
+    if (armed_) {
+      scheduler_.removeTimer(*this);
+    }
+    scope_ = nullptr;
+  }
+
+  void enableTimer(const std::chrono::milliseconds ms, const ScopeTrackedObject* scope) override {
+    disableTimer();
+    scope_ = scope;
+    scheduler_.scheduleTimer(*this, ms);
+  }
+
+  void enableHRTimer(const std::chrono::microseconds us, const ScopeTrackedObject* scope) override {
+    // This is a coarse scheduler; the sub-millisecond part of the requested duration is absorbed
+    // by the rounding up to the next tick.
+    enableTimer(std::chrono::ceil<std::chrono::milliseconds>(us), scope);
+  }
+
+  bool enabled() override { return armed_; }
+
+  void trigger() {
+    ASSERT(!armed_);
+    if (scope_ == nullptr) {
+      cb_();
+    } else {
+      ScopeTrackerScopeState scope(scope_, dispatcher_);
+      scope_ = nullptr;
+      cb_();
+    }
+  }
+
+private:
+  friend class TimerWheelScheduler;
+
+  const TimerCb cb_;
+  TimerWheelScheduler& scheduler_;
+  Dispatcher& dispatcher_;
+  const ScopeTrackedObject* scope_{nullptr};
+  bool armed_{false};
+  uint64_t expiry_tick_{0};
+  uint32_t level_{0};
+  uint32_t slot_{0};
+  Bucket::iterator position_;
+};
+
+TimerWheelScheduler::TimerWheelScheduler(Dispatcher& dispatcher,
+                                         std::chrono::milliseconds tick_interval)
+    : dispatcher_(dispatcher), tick_interval_(tick_interval),
+      start_time_(dispatcher.timeSource().monotonicTime()),
+      tick_timer_(dispatcher.createTimer([this] { onTickTimerFired(); })) {
+  ASSERT(tick_interval_.count() > 0);
+}
+
+TimerWheelScheduler::~TimerWheelScheduler() {
+  // Timers created by this scheduler shouldn't outlive it. This is necessary but not sufficient
+  // to guarantee that.
+  ASSERT(armed_timers_ == 0);
+}
+
+TimerPtr TimerWheelScheduler::createTimer(const TimerCb& cb, Dispatcher& dispatcher) {
+  return std::make_unique<WheelTimerImpl>(cb, *this, dispatcher);
+}
+
+void TimerWheelScheduler::scheduleTimer(WheelTimerImpl& timer, std::chrono::milliseconds duration) {
+  ASSERT(dispatcher_.isThreadSafe());
+  // Round the duration up to whole ticks; a timer can never fire on the tick it was enabled on,
+  // so a zero duration still waits out the current tick.
+  const std::chrono::milliseconds clamped = std::max(duration, std::chrono::milliseconds::zero());
+  const uint64_t ticks = std::max<uint64_t>(
+      1, (clamped + tick_interval_ - std::chrono::milliseconds(1)) / tick_interval_);
+  insert(timer, current_tick_ + ticks);
+  // A level 0 timer fires at its own deadline; a higher level timer cannot fire before its slot
+  // is first cascaded, so waking for the cascade boundary is sufficient.
+  maybeRearmTickTimer(timer.level_ == 0 ? timer.expiry_tick_ : cascadeBoundary(timer.level_));
+}
+
+void TimerWheelScheduler::removeTimer(WheelTimerImpl& timer) {
+  ASSERT(dispatcher_.isThreadSafe());
+  ASSERT(timer.armed_);
+  wheel_[timer.level_][timer.slot_].erase(timer.position_);
+  timer.armed_ = false;
+  --level_sizes_[timer.level_];
+  --armed_timers_;
+  if (armed_timers_ == 0) {
+    tick_timer_->disableTimer();
+    wake_tick_ = 0;
+  }
+}
+
+void TimerWheelScheduler::insert(WheelTimerImpl& timer, uint64_t expiry_tick) {
+  constexpr uint64_t max_delta = uint64_t{1} << (WheelBits * NumLevels);
+  uint64_t delta = expiry_tick - current_tick_;
+  if (delta >= max_delta) {
+    delta = max_delta - 1;
+    expiry_tick = current_tick_ + delta;
+  }
+  uint32_t level = 0;
+  while (delta >= (uint64_t{1} << (WheelBits * (level + 1)))) {
+    ++level;
+  }
+  const uint32_t slot = (expiry_tick >> (WheelBits * level)) & WheelMask;
+  Bucket& bucket = wheel_[level][slot];
+  bucket.push_back(&timer);
+  timer.armed_ = true;
+  timer.expiry_tick_ = expiry_tick;
+  timer.level_ = level;
+  timer.slot_ = slot;
+  timer.position_ = --bucket.end();
+  ++level_sizes_[level];
+  ++armed_timers_;
+}
+
+void TimerWheelScheduler::cascade(uint32_t level) {
+  Bucket bucket;
+  bucket.swap(wheel_[level][(current_tick_ >> (WheelBits * level)) & WheelMask]);
+  level_sizes_[level] -= bucket.size();
+  armed_timers_ -= bucket.size();
+  for (WheelTimerImpl* timer : bucket) {
+    // Timers in the expiring slot are at most one level span away, so they reinsert below this
+    // level (or into the level 0 slot about to fire, when the deadline is the current tick).
+    insert(*timer, timer->expiry_tick_);
+  }
+}
+
+void TimerWheelScheduler::onTickTimerFired() {
+  ASSERT(dispatcher_.isThreadSafe());
+  wake_tick_ = 0;
+  const uint64_t now_tick = (dispatcher_.timeSource().monotonicTime() - start_time_) /
+                            std::chrono::duration_cast<MonotonicTime::duration>(tick_interval_);
+  while (current_tick_ < now_tick) {
+    ++current_tick_;
+    for (uint32_t level = 1; level < NumLevels; ++level) {
+      if (current_tick_ % (uint64_t{1} << (WheelBits * level)) != 0) {
+        break;
+      }
+      cascade(level);
+    }
+    Bucket& bucket = wheel_[0][current_tick_ & WheelMask];
+    while (!bucket.empty()) {
+      WheelTimerImpl* timer = bucket.front();
+      removeTimer(*timer);
+      timer->trigger();
+    }
+  }
+  const uint64_t next = nextWakeTick();
+  if (next != 0) {
+    maybeRearmTickTimer(next);
+  }
+}
+
+void TimerWheelScheduler::maybeRearmTickTimer(uint64_t wake_tick) {
+  if (wake_tick_ != 0 && wake_tick_ <= wake_tick) {
+    return;
+  }
+  wake_tick_ = wake_tick;
+  const MonotonicTime target = start_time_ + tick_interval_ * static_cast<int64_t>(wake_tick);
+  const MonotonicTime now = dispatcher_.timeSource().monotonicTime();
+  tick_timer_->enableTimer(
+      target <= now ? std::chrono::milliseconds::zero()
+                    : std::chrono::duration_cast<std::chrono::milliseconds>(target - now));
+}
+
+uint64_t TimerWheelScheduler::nextWakeTick() const {
+  if (armed_timers_ == 0) {
+    return 0;
+  }
+  // Level 0 only holds deadlines within the next rotation, so this scan is exhaustive for it.
+  for (uint32_t i = 1; i < WheelSize; ++i) {
+    if (!wheel_[0][(current_tick_ + i) & WheelMask].empty()) {
+      return current_tick_ + i;
+    }
+  }
+  ASSERT(level_sizes_[0] == 0);
+  // Cascade boundaries are monotone in the level, so the lowest populated level is due first.
+  for (uint32_t level = 1; level < NumLevels; ++level) {
+    if (level_sizes_[level] != 0) {
+      return cascadeBoundary(level);
+    }
+  }
+  return 0; // Unreachable: armed_timers_ > 0 implies some level is populated.
+}
+
+uint64_t TimerWheelScheduler::cascadeBoundary(uint32_t level) const {
+  const uint64_t span = uint64_t{1} << (WheelBits * level);
+  return current_tick_ + span - (current_tick_ % span);
+}
+
+} // namespace Event
+} // namespace Envoy
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <list>
+
+#include "envoy/event/dispatcher.h"
+#include "envoy/event/timer.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * Implementation of Scheduler backed by a hierarchical timer wheel. Enabling, resetting and
+ * disabling a timer are O(1) bucket list operations, which makes this scheduler a good fit for
+ * large numbers of frequently reset coarse timers (e.g. per-connection idle and drain timeouts);
+ * the libevent min-heap scheduler pays O(log n) heap churn per reset. The cost is precision:
+ * expiration is quantized to the tick interval, so a callback can fire up to one tick late.
+ * Timers that need precise expiration should keep using the dispatcher's regular scheduler.
+ *
+ * The wheel is driven by a single timer on the backing dispatcher which is armed for the next
+ * tick at which a timer can fire or a higher wheel level needs cascading, so an idle wheel adds
+ * no per-iteration work to the event loop.
+ */
+class TimerWheelScheduler : public Scheduler {
+public:
+  static constexpr std::chrono::milliseconds DefaultTickInterval{100};
+
+  TimerWheelScheduler(Dispatcher& dispatcher,
+                      std::chrono::milliseconds tick_interval = DefaultTickInterval);
+  ~TimerWheelScheduler() override;
+
+  // Scheduler
+  TimerPtr createTimer(const TimerCb& cb, Dispatcher& dispatcher) override;
+
+private:
+  class WheelTimerImpl;
+
+  // 64 slots per level and 4 levels cover about 19 days of deadlines at the default 100ms tick.
+  // Deadlines beyond the top level are clamped to the furthest representable tick.
+  static constexpr uint32_t WheelBits = 6;
+  static constexpr uint32_t WheelSize = 1 << WheelBits;
+  static constexpr uint32_t WheelMask = WheelSize - 1;
+  static constexpr uint32_t NumLevels = 4;
+
+  using Bucket = std::list<WheelTimerImpl*>;
+
+  // Insert an enabled timer into the bucket matching its deadline and make sure the tick timer
+  // is armed early enough for it.
+  void scheduleTimer(WheelTimerImpl& timer, std::chrono::milliseconds duration);
+
+  // Unlink a timer from its bucket.
+  void removeTimer(WheelTimerImpl& timer);
+
+  void insert(WheelTimerImpl& timer, uint64_t expiry_tick);
+
+  // Reinsert the timers of the expiring higher level slot into the levels below, now that the
+  // wheel has turned far enough to resolve their deadlines at finer granularity.
+  void cascade(uint32_t level);
+
+  void onTickTimerFired();
+
+  // Arm the tick timer for wake_tick unless it is already armed for an earlier tick.
+  void maybeRearmTickTimer(uint64_t wake_tick);
+
+  // The next tick at which a timer can fire or a cascade is due, or 0 if the wheel is empty.
+  uint64_t nextWakeTick() const;
+
+  // The next tick at which the given level's expiring slot is cascaded.
+  uint64_t cascadeBoundary(uint32_t level) const;
+
+  Dispatcher& dispatcher_;
+  const std::chrono::milliseconds tick_interval_;
+  // The time tick 0 corresponds to; all deadlines are tick counts relative to this.
+  const MonotonicTime start_time_;
+  uint64_t current_tick_{0};
+  // The tick the tick timer is armed for, or 0 if it is not armed.
+  uint64_t wake_tick_{0};
+  uint64_t armed_timers_{0};
+  std::array<uint64_t, NumLevels> level_sizes_{};
+  std::array<std::array<Bucket, WheelSize>, NumLevels> wheel_;
+  // The timer on the backing dispatcher that drives the wheel.
+  const TimerPtr tick_timer_;
+};
+
+} // namespace Event
+} // namespace Envoy
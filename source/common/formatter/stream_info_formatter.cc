@@ -702,6 +702,25 @@ const StreamInfoFormatterProviderLookupTable& getKnownStreamInfoFormatterProvide
                     return timing.lastDownstreamAckReceived();
                   });
             }}},
+          {"CUSTOM_TIMING_DURATION",
+           {CommandSyntaxChecker::PARAMS_REQUIRED,
+            [](const std::string& format, absl::optional<size_t>) {
+              return std::make_unique<StreamInfoDurationFormatterProvider>(
+                  [key = format](const StreamInfo::StreamInfo& stream_info)
+                      -> absl::optional<std::chrono::nanoseconds> {
+                    OptRef<const StreamInfo::DownstreamTiming> timing =
+                        stream_info.downstreamTiming();
+                    if (!timing.has_value()) {
+                      return absl::nullopt;
+                    }
+                    const absl::optional<MonotonicTime> value = timing->getValue(key);
+                    if (!value.has_value()) {
+                      return absl::nullopt;
+                    }
+                    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        value.value() - stream_info.startTimeMonotonic());
+                  });
+            }}},
           {"BYTES_RECEIVED",
            {CommandSyntaxChecker::COMMAND_ONLY,
             [](const std::string&, absl::optional<size_t>) {
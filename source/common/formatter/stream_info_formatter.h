@@ -221,6 +221,10 @@ public:
     return str_;
   }
 
+  // The literal value. Used by formatter implementations to append literal runs directly
+  // instead of paying for a virtual call and a temporary string per log line.
+  absl::string_view value() const { return str_.string_value(); }
+
 private:
   ProtobufWkt::Value str_;
 };
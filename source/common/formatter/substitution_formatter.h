@@ -15,6 +15,7 @@
 #include "source/common/formatter/http_specific_formatter.h"
 #include "source/common/formatter/stream_info_formatter.h"
 #include "source/common/json/json_loader.h"
+#include "source/common/json/json_sanitizer.h"
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/types/optional.h"
@@ -187,12 +188,14 @@ public:
       : empty_value_string_(omit_empty_values ? absl::string_view{}
                                               : DefaultUnspecifiedValueStringView) {
     providers_ = SubstitutionFormatParser::parse<FormatterContext>(format);
+    compileSteps();
   }
   CommonFormatterBaseImpl(const std::string& format, bool omit_empty_values,
                           const CommandParsers& command_parsers)
       : empty_value_string_(omit_empty_values ? absl::string_view{}
                                               : DefaultUnspecifiedValueStringView) {
     providers_ = SubstitutionFormatParser::parse<FormatterContext>(format, command_parsers);
+    compileSteps();
   }
 
   // FormatterBase
@@ -201,8 +204,12 @@ public:
     std::string log_line;
     log_line.reserve(256);
 
-    for (const auto& provider : providers_) {
-      const auto bit = provider->formatWithContext(context, stream_info);
+    for (const auto& step : steps_) {
+      if (step.provider_ == nullptr) {
+        log_line += step.literal_;
+        continue;
+      }
+      const auto bit = step.provider_->formatWithContext(context, stream_info);
       log_line += bit.value_or(empty_value_string_);
     }
 
@@ -210,8 +217,33 @@ public:
   }
 
 private:
+  // One entry of the pre-compiled format plan: either a literal run appended directly, or a
+  // provider evaluated through its virtual interface.
+  struct Step {
+    const FormatterProviderBase<FormatterContext>* provider_{nullptr};
+    absl::string_view literal_;
+  };
+
+  // Resolve literal providers once at construction so that the per-log-line loop appends them
+  // without a virtual call or a temporary std::string. Literal providers always return a value,
+  // so bypassing the empty-value substitution is behavior preserving. The views point into the
+  // providers, which this object owns.
+  void compileSteps() {
+    steps_.reserve(providers_.size());
+    for (const auto& provider : providers_) {
+      const auto* literal =
+          dynamic_cast<const CommonPlainStringFormatterBase<FormatterContext>*>(provider.get());
+      if (literal != nullptr) {
+        steps_.push_back(Step{nullptr, literal->value()});
+      } else {
+        steps_.push_back(Step{provider.get(), {}});
+      }
+    }
+  }
+
   const std::string empty_value_string_;
   std::vector<FormatterProviderBasePtr<FormatterContext>> providers_;
+  std::vector<Step> steps_;
 };
 
 template <class FormatterContext>
@@ -257,6 +289,25 @@ public:
     return structFormatMapCallback(struct_output_format_, visitor).struct_value();
   }
 
+  /**
+   * Whether the format can be serialized by emitJsonWithContext(). Only pure string output
+   * qualifies: preserved types need proto values, and omitting empty values requires knowing
+   * whether a nested struct ends up empty before its key has been written.
+   */
+  bool canEmitJsonDirectly() const { return !preserve_types_ && !omit_empty_values_; }
+
+  /**
+   * Streams the formatted output straight into a JSON log line, bypassing the intermediate
+   * Struct. Keys of every emitted object follow the sorted iteration order of the pre-compiled
+   * format map. Only valid when canEmitJsonDirectly() returns true.
+   */
+  void emitJsonWithContext(const FormatterContext& context, const StreamInfo::StreamInfo& info,
+                           std::string& log_line) const {
+    ASSERT(canEmitJsonDirectly());
+    std::string sanitize_buffer;
+    emitJsonMap(struct_output_format_, context, info, sanitize_buffer, log_line);
+  }
+
 private:
   struct StructFormatMapWrapper;
   struct StructFormatListWrapper;
@@ -416,6 +467,65 @@ private:
     return ValueUtil::listValue(output);
   }
 
+  // Methods for streaming the format map out as JSON without the Struct detour.
+  void emitJsonValue(const StructFormatValue& value, const FormatterContext& context,
+                     const StreamInfo::StreamInfo& info, std::string& sanitize_buffer,
+                     std::string& out) const {
+    if (const auto* providers =
+            absl::get_if<const std::vector<FormatterProviderBasePtr<FormatterContext>>>(&value)) {
+      emitJsonProviders(*providers, context, info, sanitize_buffer, out);
+    } else if (const auto* format_map = absl::get_if<const StructFormatMapWrapper>(&value)) {
+      emitJsonMap(*format_map, context, info, sanitize_buffer, out);
+    } else {
+      emitJsonList(absl::get<const StructFormatListWrapper>(value), context, info, sanitize_buffer,
+                   out);
+    }
+  }
+  void
+  emitJsonProviders(const std::vector<FormatterProviderBasePtr<FormatterContext>>& providers,
+                    const FormatterContext& context, const StreamInfo::StreamInfo& info,
+                    std::string& sanitize_buffer, std::string& out) const {
+    ASSERT(!providers.empty());
+    out.push_back('"');
+    for (const auto& provider : providers) {
+      const absl::optional<std::string> bit = provider->formatWithContext(context, info);
+      // JSON escaping is per character, so each piece can be sanitized on its own.
+      absl::StrAppend(&out, Json::sanitize(sanitize_buffer, bit.has_value() ? *bit : empty_value_));
+    }
+    out.push_back('"');
+  }
+  void emitJsonMap(const StructFormatMapWrapper& format_map, const FormatterContext& context,
+                   const StreamInfo::StreamInfo& info, std::string& sanitize_buffer,
+                   std::string& out) const {
+    out.push_back('{');
+    bool first = true;
+    for (const auto& pair : *format_map.value_) {
+      if (!first) {
+        out.push_back(',');
+      }
+      first = false;
+      out.push_back('"');
+      absl::StrAppend(&out, Json::sanitize(sanitize_buffer, pair.first));
+      absl::StrAppend(&out, "\":");
+      emitJsonValue(pair.second, context, info, sanitize_buffer, out);
+    }
+    out.push_back('}');
+  }
+  void emitJsonList(const StructFormatListWrapper& format_list, const FormatterContext& context,
+                    const StreamInfo::StreamInfo& info, std::string& sanitize_buffer,
+                    std::string& out) const {
+    out.push_back('[');
+    bool first = true;
+    for (const auto& val : *format_list.value_) {
+      if (!first) {
+        out.push_back(',');
+      }
+      first = false;
+      emitJsonValue(val, context, info, sanitize_buffer, out);
+    }
+    out.push_back(']');
+  }
+
   const bool omit_empty_values_;
   const bool preserve_types_;
   const std::string empty_value_;
@@ -440,6 +550,16 @@ public:
   // FormatterBase
   std::string formatWithContext(const FormatterContext& context,
                                 const StreamInfo::StreamInfo& info) const override {
+    if (struct_formatter_.canEmitJsonDirectly()) {
+      // Fast path: stream the providers' output straight into the log line. Emitted objects
+      // inherit the sorted iteration order of the pre-compiled format map, so this also covers
+      // sort_properties_.
+      std::string log_line;
+      struct_formatter_.emitJsonWithContext(context, info, log_line);
+      log_line.push_back('\n');
+      return log_line;
+    }
+
     const ProtobufWkt::Struct output_struct = struct_formatter_.formatWithContext(context, info);
 
     std::string log_line = "";
@@ -51,7 +51,8 @@ AsyncClientFactoryImpl::AsyncClientFactoryImpl(Upstream::ClusterManager& cm,
 
 AsyncClientManagerImpl::AsyncClientManagerImpl(Upstream::ClusterManager& cm,
                                                ThreadLocal::Instance& tls, TimeSource& time_source,
-                                               Api::Api& api, const StatNames& stat_names)
+                                               Api::Api& api, const StatNames& stat_names,
+                                               uint32_t google_grpc_completion_queue_count)
     : cm_(cm), tls_(tls), time_source_(time_source), api_(api), stat_names_(stat_names),
       raw_async_client_cache_(tls_) {
   raw_async_client_cache_.set([](Event::Dispatcher& dispatcher) {
@@ -59,10 +60,13 @@ AsyncClientManagerImpl::AsyncClientManagerImpl(Upstream::ClusterManager& cm,
   });
 #ifdef ENVOY_GOOGLE_GRPC
   google_tls_slot_ = tls.allocateSlot();
-  google_tls_slot_->set(
-      [&api](Event::Dispatcher&) { return std::make_shared<GoogleAsyncClientThreadLocal>(api); });
+  google_tls_slot_->set([&api, google_grpc_completion_queue_count](Event::Dispatcher&) {
+    return std::make_shared<GoogleAsyncClientThreadLocal>(api,
+                                                          google_grpc_completion_queue_count);
+  });
 #else
   UNREFERENCED_PARAMETER(api_);
+  UNREFERENCED_PARAMETER(google_grpc_completion_queue_count);
 #endif
 }
 
@@ -46,8 +46,12 @@ private:
 
 class AsyncClientManagerImpl : public AsyncClientManager {
 public:
+  // google_grpc_completion_queue_count controls how many completion queues (each with a
+  // dedicated completion thread) the Google C++ gRPC library uses per worker; see
+  // Bootstrap.google_grpc_completion_queue_count.
   AsyncClientManagerImpl(Upstream::ClusterManager& cm, ThreadLocal::Instance& tls,
-                         TimeSource& time_source, Api::Api& api, const StatNames& stat_names);
+                         TimeSource& time_source, Api::Api& api, const StatNames& stat_names,
+                         uint32_t google_grpc_completion_queue_count = 1);
   RawAsyncClientSharedPtr
   getOrCreateRawAsyncClient(const envoy::config::core::v3::GrpcService& config, Stats::Scope& scope,
                             bool skip_cluster_check) override;
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "source/common/buffer/buffer_impl.h"
+#include "source/common/common/safe_memcpy.h"
 
 #include "absl/container/fixed_array.h"
 
@@ -34,12 +35,125 @@ void Encoder::prependFrameHeader(uint8_t flags, Buffer::Instance& buffer, uint32
 bool Decoder::decode(Buffer::Instance& input, std::vector<Frame>& output) {
   decoding_error_ = false;
   output_ = &output;
-  inspect(input);
-  output_ = nullptr;
-  if (decoding_error_) {
+
+  if (!hasValidFrameHeaders(input)) {
+    // Fall back to the copying scan, which stops at the invalid frame. This
+    // preserves the historical error contract: frames preceding the error are
+    // emitted and the input buffer is left untouched.
+    inspect(input);
+    output_ = nullptr;
     return false;
   }
-  input.drain(input.length());
+
+  // All frame headers in the input are valid, so the payload slices can be
+  // moved out of the input buffer instead of copied. This keeps large messages
+  // (e.g. xDS responses) from being duplicated in memory between the receive
+  // buffer and the decoded frame; the frame retains the input's fragmented
+  // slices and can be parsed through a zero-copy stream.
+  while (input.length() != 0) {
+    if (state_ == State::Data) {
+      const uint64_t data_length = std::min<uint64_t>(input.length(), length_);
+      frame_.data_->move(input, data_length);
+      length_ -= data_length;
+      if (length_ == 0) {
+        frameDataEnd();
+        state_ = State::FhFlag;
+      }
+      continue;
+    }
+    uint8_t byte;
+    input.copyOut(0, 1, &byte);
+    input.drain(1);
+    switch (state_) {
+    case State::FhFlag:
+      // The flags were validated above, so this cannot fail.
+      frameStart(byte);
+      count_ += 1;
+      state_ = State::FhLen0;
+      break;
+    case State::FhLen0:
+      length_as_bytes_[0] = byte;
+      state_ = State::FhLen1;
+      break;
+    case State::FhLen1:
+      length_as_bytes_[1] = byte;
+      state_ = State::FhLen2;
+      break;
+    case State::FhLen2:
+      length_as_bytes_[2] = byte;
+      state_ = State::FhLen3;
+      break;
+    case State::FhLen3:
+      length_as_bytes_[3] = byte;
+      length_ = absl::big_endian::Load32(length_as_bytes_);
+      frameDataStart();
+      if (length_ == 0) {
+        frameDataEnd();
+        state_ = State::FhFlag;
+      } else {
+        state_ = State::Data;
+      }
+      break;
+    case State::Data:
+      break; // Handled above.
+    }
+  }
+  output_ = nullptr;
+  return true;
+}
+
+bool Decoder::hasValidFrameHeaders(const Buffer::Instance& input) const {
+  // Replays the frame state machine over the input without copying any data or
+  // mutating the decoder, checking only the flag byte of each frame header.
+  State state = state_;
+  uint8_t length_bytes[4];
+  safeMemcpy(&length_bytes, &length_as_bytes_);
+  uint64_t remaining = length_;
+  for (const Buffer::RawSlice& slice : input.getRawSlices()) {
+    const uint8_t* mem = reinterpret_cast<uint8_t*>(slice.mem_);
+    const uint8_t* end = mem + slice.len_;
+    while (mem < end) {
+      switch (state) {
+      case State::FhFlag:
+        if (*mem & ~GRPC_FH_COMPRESSED) {
+          return false;
+        }
+        state = State::FhLen0;
+        mem++;
+        break;
+      case State::FhLen0:
+        length_bytes[0] = *mem;
+        state = State::FhLen1;
+        mem++;
+        break;
+      case State::FhLen1:
+        length_bytes[1] = *mem;
+        state = State::FhLen2;
+        mem++;
+        break;
+      case State::FhLen2:
+        length_bytes[2] = *mem;
+        state = State::FhLen3;
+        mem++;
+        break;
+      case State::FhLen3:
+        length_bytes[3] = *mem;
+        remaining = absl::big_endian::Load32(length_bytes);
+        state = remaining == 0 ? State::FhFlag : State::Data;
+        mem++;
+        break;
+      case State::Data: {
+        const uint64_t skip = std::min<uint64_t>(end - mem, remaining);
+        mem += skip;
+        remaining -= skip;
+        if (remaining == 0) {
+          state = State::FhFlag;
+        }
+        break;
+      }
+      }
+    }
+  }
   return true;
 }
 
@@ -121,6 +121,10 @@ public:
   // decoding succeeded (returns true). If the input is not sufficient to make a
   // complete GRPC data frame, it will be buffered in the decoder. If a decoding
   // error happened, the input buffer remains unchanged.
+  //
+  // On success, frame payloads are moved out of the input buffer rather than
+  // copied: each output frame holds the input's slices, so large messages are
+  // not duplicated in memory and can be parsed via a zero-copy stream.
   // @param input supplies the binary octets wrapped in a GRPC data frame.
   // @param output supplies the buffer to store the decoded data.
   // @return bool whether the decoding succeeded or not.
@@ -141,6 +145,11 @@ protected:
   void frameDataEnd() override;
 
 private:
+  // Walks the frame state machine over the input without copying data or
+  // mutating the decoder, verifying the flag byte of every frame header.
+  // @return false if an invalid frame header is present in the input.
+  bool hasValidFrameHeaders(const Buffer::Instance& input) const;
+
   Frame frame_;
   std::vector<Frame>* output_{nullptr};
   bool decoding_error_{false};
@@ -25,9 +25,21 @@ namespace {
 static constexpr int DefaultBufferLimitBytes = 1024 * 1024;
 }
 
-GoogleAsyncClientThreadLocal::GoogleAsyncClientThreadLocal(Api::Api& api)
-    : completion_thread_(api.threadFactory().createThread([this] { completionThread(); },
-                                                          Thread::Options{"GrpcGoogClient"})) {}
+GoogleAsyncClientThreadLocal::GoogleAsyncClientThreadLocal(Api::Api& api,
+                                                           uint32_t completion_queue_count) {
+  ASSERT(completion_queue_count > 0);
+  cqs_.reserve(completion_queue_count);
+  completion_threads_.reserve(completion_queue_count);
+  for (uint32_t i = 0; i < completion_queue_count; ++i) {
+    cqs_.emplace_back(std::make_unique<grpc::CompletionQueue>());
+    grpc::CompletionQueue& cq = *cqs_.back();
+    // Keep the historical thread name in the single-queue case; number the threads otherwise.
+    const std::string thread_name =
+        completion_queue_count == 1 ? "GrpcGoogClient" : fmt::format("GrpcGoogCq{}", i);
+    completion_threads_.emplace_back(api.threadFactory().createThread(
+        [this, &cq] { completionThread(cq); }, Thread::Options{thread_name}));
+  }
+}
 
 GoogleAsyncClientThreadLocal::~GoogleAsyncClientThreadLocal() {
   // Force streams to shutdown and invoke TryCancel() to start the drain of
@@ -40,21 +52,25 @@ GoogleAsyncClientThreadLocal::~GoogleAsyncClientThreadLocal() {
     // we point to the next one first.
     (*it++)->resetStream();
   }
-  cq_.Shutdown();
-  ENVOY_LOG(debug, "Joining completionThread");
-  completion_thread_->join();
-  ENVOY_LOG(debug, "Joined completionThread");
-  // Ensure that we have cleaned up all orphan streams, now that CQ is gone.
+  for (auto& cq : cqs_) {
+    cq->Shutdown();
+  }
+  ENVOY_LOG(debug, "Joining completion threads");
+  for (auto& completion_thread : completion_threads_) {
+    completion_thread->join();
+  }
+  ENVOY_LOG(debug, "Joined completion threads");
+  // Ensure that we have cleaned up all orphan streams, now that the CQs are gone.
   while (!streams_.empty()) {
     (*streams_.begin())->onCompletedOps();
   }
 }
 
-void GoogleAsyncClientThreadLocal::completionThread() {
+void GoogleAsyncClientThreadLocal::completionThread(grpc::CompletionQueue& cq) {
   ENVOY_LOG(debug, "completionThread running");
   void* tag;
   bool ok;
-  while (cq_.Next(&tag, &ok)) {
+  while (cq.Next(&tag, &ok)) {
     const auto& google_async_tag = *reinterpret_cast<GoogleAsyncTag*>(tag);
     const GoogleAsyncTag::Operation op = google_async_tag.op_;
     GoogleAsyncStreamImpl& stream = google_async_tag.stream_;
@@ -198,7 +214,7 @@ void GoogleAsyncStreamImpl::initialize(bool /*buffer_body_for_retry*/) {
   });
   // Invoke stub call.
   rw_ = parent_.stub_->PrepareCall(&ctxt_, "/" + service_full_name_ + "/" + method_name_,
-                                   &parent_.tls_.completionQueue());
+                                   &parent_.tls_.nextCompletionQueue());
   if (rw_ == nullptr) {
     notifyRemoteClose(Status::WellKnownGrpcStatus::Unavailable, nullptr, EMPTY_STRING);
     call_failed_ = true;
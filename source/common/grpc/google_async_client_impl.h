@@ -71,10 +71,13 @@ struct GoogleAsyncTag {
 class GoogleAsyncClientThreadLocal : public ThreadLocal::ThreadLocalObject,
                                      Logger::Loggable<Logger::Id::grpc> {
 public:
-  GoogleAsyncClientThreadLocal(Api::Api& api);
+  GoogleAsyncClientThreadLocal(Api::Api& api, uint32_t completion_queue_count = 1);
   ~GoogleAsyncClientThreadLocal() override;
 
-  grpc::CompletionQueue& completionQueue() { return cq_; }
+  // Returns the completion queue to use for a new stream. When more than one queue is
+  // configured, streams are spread over the queues round-robin so that a single completion
+  // thread does not become the bottleneck for all Google gRPC services on this worker.
+  grpc::CompletionQueue& nextCompletionQueue() { return *cqs_[next_cq_++ % cqs_.size()]; }
 
   void registerStream(GoogleAsyncStreamImpl* stream) {
     ASSERT(streams_.find(stream) == streams_.end());
@@ -88,7 +91,7 @@ public:
   }
 
 private:
-  void completionThread();
+  void completionThread(grpc::CompletionQueue& cq);
 
   // There is blanket google-grpc initialization in MainCommonBase, but that
   // doesn't cover unit tests. However, putting blanket coverage in ProcessWide
@@ -98,20 +101,23 @@ private:
   // https://github.com/envoyproxy/envoy/issues/8282 for details.
   GoogleGrpcContext google_grpc_context_;
 
-  // The CompletionQueue for in-flight operations. This must precede completion_thread_ to ensure it
-  // is constructed before the thread runs.
-  grpc::CompletionQueue cq_;
+  // The CompletionQueues for in-flight operations. These must precede completion_threads_ to
+  // ensure they are constructed before the threads run.
+  std::vector<std::unique_ptr<grpc::CompletionQueue>> cqs_;
   // The threading model for the Google gRPC C++ library is not directly compatible with Envoy's
   // siloed model. We resolve this by issuing non-blocking asynchronous
   // operations on the GoogleAsyncClientImpl silo thread, and then synchronously
-  // blocking on a completion queue, cq_, on a distinct thread. When cq_ events
-  // are delivered, we cross-post to the silo dispatcher to continue the
+  // blocking on a completion queue on a distinct thread. When completion queue
+  // events are delivered, we cross-post to the silo dispatcher to continue the
   // operation.
   //
-  // We have an independent completion thread for each TLS silo (i.e. one per worker and
-  // also one for the main thread).
-  Thread::ThreadPtr completion_thread_;
-  // Track all streams that are currently using this CQ, so we can notify them
+  // Each TLS silo (i.e. one per worker and also one for the main thread) has its own set of
+  // completion threads, one per completion queue.
+  std::vector<Thread::ThreadPtr> completion_threads_;
+  // Index used to assign new streams to completion queues round-robin. Only accessed from the
+  // silo thread.
+  uint32_t next_cq_{};
+  // Track all streams that are currently using these CQs, so we can notify them
   // on shutdown.
   absl::node_hash_set<GoogleAsyncStreamImpl*> streams_;
 };
@@ -68,6 +68,19 @@ AsyncClientImpl::startRequest(RequestHeaderMapPtr&& request_headers, Callbacks&
   return internalStartRequest(async_request);
 }
 
+void AsyncClientImpl::maybeDrainConnPools() {
+  if (!active_streams_.empty()) {
+    return;
+  }
+  // Only this worker's pools are touched; each worker drains independently as its own last
+  // stream completes, so a busy worker keeps its connections while idle workers give theirs up.
+  Upstream::ThreadLocalCluster* tls_cluster =
+      config_.cm_.getThreadLocalCluster(cluster_->name());
+  if (tls_cluster != nullptr) {
+    tls_cluster->drainConnPools(Envoy::ConnectionPool::DrainBehavior::DrainExistingConnections);
+  }
+}
+
 AsyncClient::Stream* AsyncClientImpl::start(AsyncClient::StreamCallbacks& callbacks,
                                             const AsyncClient::StreamOptions& options) {
   std::unique_ptr<AsyncStreamImpl> new_stream{new AsyncStreamImpl(*this, callbacks, options)};
@@ -86,7 +99,7 @@ AsyncStreamImpl::AsyncStreamImpl(AsyncClientImpl& parent, AsyncClient::StreamCal
                                              options.timeout, options.hash_policy,
                                              options.retry_policy)),
       account_(options.account_), buffer_limit_(options.buffer_limit_),
-      send_xff_(options.send_xff) {
+      send_xff_(options.send_xff), drain_pools_when_idle_(options.drain_pools_when_idle) {
   stream_info_.dynamicMetadata().MergeFrom(options.metadata);
   stream_info_.setIsShadow(options.is_shadow);
   stream_info_.setUpstreamClusterInfo(parent_.cluster_);
@@ -246,6 +259,9 @@ void AsyncStreamImpl::cleanup() {
   // the immediate failure case.
   if (inserted()) {
     dispatcher().deferredDelete(removeFromList(parent_.active_streams_));
+    if (drain_pools_when_idle_) {
+      parent_.maybeDrainConnPools();
+    }
   }
 }
 
@@ -77,6 +77,9 @@ public:
 
 private:
   template <typename T> T* internalStartRequest(T* async_request);
+  // Drains this worker's connection pools for the cluster if no streams remain active. Called
+  // when a stream created with drain_pools_when_idle completes.
+  void maybeDrainConnPools();
   Router::FilterConfig config_;
   Event::Dispatcher& dispatcher_;
   std::list<std::unique_ptr<AsyncStreamImpl>> active_streams_;
@@ -279,6 +282,7 @@ private:
   bool is_grpc_request_{};
   bool is_head_request_{false};
   bool send_xff_{true};
+  const bool drain_pools_when_idle_{false};
 
   friend class AsyncClientImpl;
   friend class AsyncClientImplUnitTest;
@@ -18,10 +18,20 @@
 namespace Envoy {
 namespace Http {
 
+CodeStatsImpl::CategoryStatNames::CategoryStatNames(Stats::StatNamePool& pool, uint32_t index,
+                                                    absl::string_view category)
+    : index_(index), prefix_(absl::StrCat(category, ".")),
+      upstream_rq_completed_(pool.add(absl::StrCat(category, ".upstream_rq_completed"))),
+      upstream_rq_unknown_(pool.add(absl::StrCat(category, ".upstream_rq_unknown"))),
+      upstream_rq_time_(pool.add(absl::StrCat(category, ".upstream_rq_time"))),
+      upstream_rq_group_{pool.add(absl::StrCat(category, ".upstream_rq_1xx")),
+                         pool.add(absl::StrCat(category, ".upstream_rq_2xx")),
+                         pool.add(absl::StrCat(category, ".upstream_rq_3xx")),
+                         pool.add(absl::StrCat(category, ".upstream_rq_4xx")),
+                         pool.add(absl::StrCat(category, ".upstream_rq_5xx"))} {}
+
 CodeStatsImpl::CodeStatsImpl(Stats::SymbolTable& symbol_table)
     : stat_name_pool_(symbol_table), symbol_table_(symbol_table),
-      canary_(stat_name_pool_.add("canary")), external_(stat_name_pool_.add("external")),
-      internal_(stat_name_pool_.add("internal")),
       upstream_rq_1xx_(stat_name_pool_.add("upstream_rq_1xx")),
       upstream_rq_2xx_(stat_name_pool_.add("upstream_rq_2xx")),
       upstream_rq_3xx_(stat_name_pool_.add("upstream_rq_3xx")),
@@ -32,7 +42,10 @@ CodeStatsImpl::CodeStatsImpl(Stats::SymbolTable& symbol_table)
       upstream_rq_completed_(stat_name_pool_.add("upstream_rq_completed")),
       upstream_rq_time_(stat_name_pool_.add("upstream_rq_time")),
       vcluster_(stat_name_pool_.add("vcluster")), vhost_(stat_name_pool_.add("vhost")),
-      route_(stat_name_pool_.add("route")), zone_(stat_name_pool_.add("zone")) {
+      route_(stat_name_pool_.add("route")), zone_(stat_name_pool_.add("zone")),
+      canary_category_(stat_name_pool_, 1, "canary"),
+      internal_category_(stat_name_pool_, 2, "internal"),
+      external_category_(stat_name_pool_, 3, "external") {
 
   // Pre-allocate response codes 200, 404, and 503, as those seem quite likely.
   // We don't pre-allocate all the HTTP codes because the first 127 allocations
@@ -49,6 +62,12 @@ void CodeStatsImpl::incCounter(Stats::Scope& scope, const Stats::StatNameVec& na
 }
 
 void CodeStatsImpl::incCounter(Stats::Scope& scope, Stats::StatName a, Stats::StatName b) const {
+  if (a.empty()) {
+    // Cluster traffic stats are usually charged with an empty prefix, in which case the
+    // pre-joined suffix already is the full counter name.
+    scope.counterFromStatName(b).inc();
+    return;
+  }
   const Stats::SymbolTable::StoragePtr stat_name_storage = symbol_table_.join({a, b});
   scope.counterFromStatName(Stats::StatName(stat_name_storage.get())).inc();
 }
@@ -59,6 +78,16 @@ void CodeStatsImpl::recordHistogram(Stats::Scope& scope, const Stats::StatNameVe
   scope.histogramFromStatName(Stats::StatName(stat_name_storage.get()), unit).recordValue(count);
 }
 
+void CodeStatsImpl::recordHistogram(Stats::Scope& scope, Stats::StatName a, Stats::StatName b,
+                                    Stats::Histogram::Unit unit, uint64_t count) const {
+  if (a.empty()) {
+    scope.histogramFromStatName(b, unit).recordValue(count);
+    return;
+  }
+  const Stats::SymbolTable::StoragePtr stat_name_storage = symbol_table_.join({a, b});
+  scope.histogramFromStatName(Stats::StatName(stat_name_storage.get()), unit).recordValue(count);
+}
+
 void CodeStatsImpl::chargeBasicResponseStat(Stats::Scope& scope, Stats::StatName prefix,
                                             Code response_code,
                                             bool exclude_http_code_stats) const {
@@ -88,14 +117,14 @@ void CodeStatsImpl::chargeResponseStat(const ResponseStatInfo& info,
 
   // If the response is from a canary, also create canary stats.
   if (info.upstream_canary_) {
-    writeCategory(info, rq_group, rq_code, canary_);
+    writeCategory(info, code, canary_category_);
   }
 
   // Split stats into external vs. internal.
   if (info.internal_request_) {
-    writeCategory(info, rq_group, rq_code, internal_);
+    writeCategory(info, code, internal_category_);
   } else {
-    writeCategory(info, rq_group, rq_code, external_);
+    writeCategory(info, code, external_category_);
   }
 
   // Handle request virtual cluster.
@@ -128,29 +157,30 @@ void CodeStatsImpl::chargeResponseStat(const ResponseStatInfo& info,
   }
 }
 
-void CodeStatsImpl::writeCategory(const ResponseStatInfo& info, Stats::StatName rq_group,
-                                  Stats::StatName rq_code, Stats::StatName category) const {
-  incCounter(info.cluster_scope_, {info.prefix_, category, upstream_rq_completed_});
-  if (!rq_group.empty()) {
-    incCounter(info.cluster_scope_, {info.prefix_, category, rq_group});
+void CodeStatsImpl::writeCategory(const ResponseStatInfo& info, Code code,
+                                  const CategoryStatNames& category) const {
+  incCounter(info.cluster_scope_, info.prefix_, category.upstream_rq_completed_);
+  const uint64_t group_index = enumToInt(code) / 100;
+  if (group_index >= 1 && group_index <= NumResponseCodeClasses) {
+    incCounter(info.cluster_scope_, info.prefix_, category.upstream_rq_group_[group_index - 1]);
   }
-  incCounter(info.cluster_scope_, {info.prefix_, category, rq_code});
+  incCounter(info.cluster_scope_, info.prefix_, categoryRqStatName(category, code));
 }
 
 void CodeStatsImpl::chargeResponseTiming(const ResponseTimingInfo& info) const {
   const uint64_t count = info.response_time_.count();
-  recordHistogram(info.cluster_scope_, {info.prefix_, upstream_rq_time_},
+  recordHistogram(info.cluster_scope_, info.prefix_, upstream_rq_time_,
                   Stats::Histogram::Unit::Milliseconds, count);
   if (info.upstream_canary_) {
-    recordHistogram(info.cluster_scope_, {info.prefix_, canary_, upstream_rq_time_},
+    recordHistogram(info.cluster_scope_, info.prefix_, canary_category_.upstream_rq_time_,
                     Stats::Histogram::Unit::Milliseconds, count);
   }
 
   if (info.internal_request_) {
-    recordHistogram(info.cluster_scope_, {info.prefix_, internal_, upstream_rq_time_},
+    recordHistogram(info.cluster_scope_, info.prefix_, internal_category_.upstream_rq_time_,
                     Stats::Histogram::Unit::Milliseconds, count);
   } else {
-    recordHistogram(info.cluster_scope_, {info.prefix_, external_, upstream_rq_time_},
+    recordHistogram(info.cluster_scope_, info.prefix_, external_category_.upstream_rq_time_,
                     Stats::Histogram::Unit::Milliseconds, count);
   }
 
@@ -204,6 +234,20 @@ Stats::StatName CodeStatsImpl::upstreamRqStatName(Code response_code) const {
   }));
 }
 
+Stats::StatName CodeStatsImpl::categoryRqStatName(const CategoryStatNames& category,
+                                                  Code response_code) const {
+  const uint32_t rc_index = static_cast<uint32_t>(response_code) - HttpCodeOffset;
+  if (rc_index >= NumHttpCodes) {
+    return category.upstream_rq_unknown_;
+  }
+  return Stats::StatName(rc_stat_names_.get(
+      category.index_ * NumHttpCodes + rc_index,
+      [this, &category, response_code]() -> const uint8_t* {
+        return stat_name_pool_.addReturningStorage(
+            absl::StrCat(category.prefix_, "upstream_rq_", enumToInt(response_code)));
+      }));
+}
+
 std::string CodeUtility::groupStringForResponseCode(Code response_code) {
   // Note: this is only used in the unit test and in dynamo_filter.cc, which
   // needs the same sort of symbolization treatment we are doing here.
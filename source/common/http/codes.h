@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <string>
@@ -56,23 +57,41 @@ public:
 private:
   friend class CodeStatsTest;
 
-  void writeCategory(const ResponseStatInfo& info, Stats::StatName rq_group,
-                     Stats::StatName rq_code, Stats::StatName category) const;
+  static constexpr uint32_t NumResponseCodeClasses = 5; // 1xx .. 5xx.
+  static constexpr uint32_t NumCategories = 4;          // Plain, canary, internal and external.
+
+  // Pre-joined "<category>.<suffix>" stat names for the canary/internal/external breakouts of a
+  // response, built once at construction. With these, charging a response only joins symbols when
+  // a stat prefix is present; with the empty prefix that cluster traffic stats use, the suffix
+  // already is the full counter name.
+  struct CategoryStatNames {
+    CategoryStatNames(Stats::StatNamePool& pool, uint32_t index, absl::string_view category);
+
+    const uint32_t index_;     // This category's block of per-code names in rc_stat_names_.
+    const std::string prefix_; // E.g. "canary.", used to build the per-code names on demand.
+    const Stats::StatName upstream_rq_completed_;
+    const Stats::StatName upstream_rq_unknown_;
+    const Stats::StatName upstream_rq_time_;
+    const std::array<Stats::StatName, NumResponseCodeClasses> upstream_rq_group_;
+  };
+
+  void writeCategory(const ResponseStatInfo& info, Code code,
+                     const CategoryStatNames& category) const;
   void incCounter(Stats::Scope& scope, const Stats::StatNameVec& names) const;
   void incCounter(Stats::Scope& scope, Stats::StatName a, Stats::StatName b) const;
   void recordHistogram(Stats::Scope& scope, const Stats::StatNameVec& names,
                        Stats::Histogram::Unit unit, uint64_t count) const;
+  void recordHistogram(Stats::Scope& scope, Stats::StatName a, Stats::StatName b,
+                       Stats::Histogram::Unit unit, uint64_t count) const;
 
   Stats::StatName upstreamRqGroup(Code response_code) const;
   Stats::StatName upstreamRqStatName(Code response_code) const;
+  Stats::StatName categoryRqStatName(const CategoryStatNames& category, Code response_code) const;
 
   mutable Stats::StatNamePool stat_name_pool_;
   Stats::SymbolTable& symbol_table_;
 
-  const Stats::StatName canary_;
   const Stats::StatName empty_; // Used for the group-name for invalid http codes.
-  const Stats::StatName external_;
-  const Stats::StatName internal_;
   const Stats::StatName upstream_;
   const Stats::StatName upstream_rq_1xx_;
   const Stats::StatName upstream_rq_2xx_;
@@ -87,6 +106,10 @@ private:
   const Stats::StatName route_;
   const Stats::StatName zone_;
 
+  const CategoryStatNames canary_category_;
+  const CategoryStatNames internal_category_;
+  const CategoryStatNames external_category_;
+
   // Use an array of atomic pointers to hold StatNameStorage objects for
   // every conceivable HTTP response code. In the hot-path we'll reference
   // these with a null-check, and if we need to allocate a symbol for a
@@ -112,7 +135,11 @@ private:
 
   static constexpr uint32_t NumHttpCodes = 500;
   static constexpr uint32_t HttpCodeOffset = 100; // code 100 is at index 0.
-  mutable Thread::AtomicPtrArray<const uint8_t, NumHttpCodes,
+  // One block of NumHttpCodes entries per category: the plain per-code names first, then the
+  // "canary."/"internal."/"external." prefixed variants at the blocks given by
+  // CategoryStatNames::index_. Sharing one array keeps all lazy symbol allocations behind a
+  // single mutex.
+  mutable Thread::AtomicPtrArray<const uint8_t, NumHttpCodes * NumCategories,
                                  Thread::AtomicPtrAllocMode::DoNotDelete>
       rc_stat_names_;
 };
@@ -64,6 +64,12 @@ const absl::string_view ConnectionManagerImpl::PrematureResetMinStreamLifetimeSe
 // I/O cycle. Requests over this limit are deferred until the next I/O cycle.
 const absl::string_view ConnectionManagerImpl::MaxRequestsPerIoCycle =
     "http.max_requests_per_io_cycle";
+// Runtime key for the percentage of streams that record per-filter wall time histograms.
+const absl::string_view ConnectionManagerImpl::FilterTimingSamplePercentKey =
+    "http.filter_timing_sample_percent";
+// DownstreamTiming key recording when route resolution completed.
+const absl::string_view ConnectionManagerImpl::RouteMatchTimingKey =
+    "envoy.conn_manager.route_match_complete";
 
 bool requestWasConnect(const RequestHeaderMapSharedPtr& headers, Protocol protocol) {
   if (!headers) {
@@ -128,6 +134,12 @@ ConnectionManagerImpl::ConnectionManagerImpl(ConnectionManagerConfig& config,
       trace, accept_new_http_stream_ == nullptr,
       "LoadShedPoint envoy.load_shed_points.http_connection_manager_decode_headers is not "
       "found. Is it configured?");
+
+  if (Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.per_connection_route_memoization")) {
+    route_memoization_cache_ =
+        std::make_unique<RouteMemoizationCache>(RouteMemoizationCacheMaxEntries);
+  }
 }
 
 const ResponseHeaderMap& ConnectionManagerImpl::continueHeader() {
@@ -859,6 +871,15 @@ ConnectionManagerImpl::ActiveStream::ActiveStream(ConnectionManagerImpl& connect
     filter_manager_.addAccessLogHandler(access_log);
   }
 
+  // Opt-in, sampled per-filter wall time attribution. The runtime key holds the percentage of
+  // streams to record, so a low value keeps the overhead off the common path while still
+  // populating the histograms during an investigation.
+  if (connection_manager_.runtime_.snapshot().featureEnabled(
+          ConnectionManagerImpl::FilterTimingSamplePercentKey, 0)) {
+    filter_manager_.enableFilterTiming(connection_manager_.stats_.scope_,
+                                       connection_manager_.stats_.prefixStatName());
+  }
+
   filter_manager_.streamInfo().setStreamIdProvider(
       std::make_shared<HttpStreamIdProviderImpl>(*this));
 
@@ -1659,12 +1680,31 @@ void ConnectionManagerImpl::ActiveStream::refreshCachedRoute(const Router::Route
       snapScopedRouteConfig();
     }
     if (snapped_route_config_ != nullptr) {
-      route = snapped_route_config_->route(cb, *request_headers_, filter_manager_.streamInfo(),
-                                           stream_id_);
+      // The memoization cache is only usable for plain lookups against configurations whose
+      // route resolution is a pure function of :method, :authority and :path; a RouteCallback
+      // must observe every route evaluation and so always takes the full match.
+      RouteMemoizationCache* memoization_cache = connection_manager_.route_memoization_cache_.get();
+      if (cb != nullptr || memoization_cache == nullptr ||
+          !snapped_route_config_->supportsRouteMemoization()) {
+        memoization_cache = nullptr;
+      }
+      if (memoization_cache != nullptr) {
+        route = memoization_cache->lookup(snapped_route_config_, *request_headers_);
+      }
+      if (route == nullptr) {
+        route = snapped_route_config_->route(cb, *request_headers_, filter_manager_.streamInfo(),
+                                             stream_id_);
+        if (memoization_cache != nullptr && route != nullptr) {
+          memoization_cache->insert(snapped_route_config_, *request_headers_, route);
+        }
+      }
     }
   }
 
   setRoute(route);
+  filter_manager_.streamInfo().downstreamTiming().setValue(
+      ConnectionManagerImpl::RouteMatchTimingKey,
+      connection_manager_.timeSource().monotonicTime());
 }
 
 void ConnectionManagerImpl::ActiveStream::refreshCachedTracingCustomTags() {
@@ -2165,10 +2205,13 @@ void ConnectionManagerImpl::ActiveStream::recreateStream(
   ResponseEncoder* response_encoder = response_encoder_;
   response_encoder_ = nullptr;
 
-  Buffer::InstancePtr request_data = std::make_unique<Buffer::OwnedImpl>();
   const auto& buffered_request_data = filter_manager_.bufferedRequestData();
   const bool proxy_body = buffered_request_data != nullptr && buffered_request_data->length() > 0;
+  Buffer::InstancePtr request_data;
   if (proxy_body) {
+    // The buffered body is moved, not copied, so redispatching the request does not duplicate
+    // the payload.
+    request_data = std::make_unique<Buffer::OwnedImpl>();
     request_data->move(*buffered_request_data);
   }
 
@@ -41,6 +41,7 @@
 #include "source/common/grpc/common.h"
 #include "source/common/http/conn_manager_config.h"
 #include "source/common/http/filter_manager.h"
+#include "source/common/http/route_memoization_cache.h"
 #include "source/common/http/user_agent.h"
 #include "source/common/http/utility.h"
 #include "source/common/local_reply/local_reply.h"
@@ -127,6 +128,16 @@ public:
   static const absl::string_view PrematureResetMinStreamLifetimeSecondsKey;
   static const absl::string_view MaxRequestsPerIoCycle;
 
+  // This runtime key configures the percentage of streams that record per-filter wall time
+  // spent in each filter callback into histograms named
+  // <stat_prefix>.filter_timing.<filter config name>.<callback>. Zero (the default) disables
+  // the feature entirely.
+  static const absl::string_view FilterTimingSamplePercentKey;
+
+  // DownstreamTiming key under which the time route resolution completed for the stream is
+  // recorded. Exportable in access logs via %CUSTOM_TIMING_DURATION(<key>)%.
+  static const absl::string_view RouteMatchTimingKey;
+
 private:
   struct ActiveStream;
   class MobileConnectionManagerImpl;
@@ -652,6 +663,11 @@ private:
   // the definition given in `isPrematureRstStream()`.
   uint64_t number_premature_stream_resets_{0};
   const std::string proxy_name_; // for Proxy-Status.
+  // Optional per-connection memoization of route-match results, allocated only when
+  // envoy.reloadable_features.per_connection_route_memoization is enabled. Consulted by
+  // ActiveStream::refreshCachedRoute() when the active route configuration supports it.
+  static constexpr size_t RouteMemoizationCacheMaxEntries = 64;
+  std::unique_ptr<RouteMemoizationCache> route_memoization_cache_;
   uint32_t requests_during_dispatch_count_{0};
   const uint32_t max_requests_during_dispatch_{UINT32_MAX};
   Event::SchedulableCallbackPtr deferred_request_processing_callback_;
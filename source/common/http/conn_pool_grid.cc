@@ -304,6 +304,12 @@ ConnectionPool::Cancellable* ConnectivityGrid::newStream(Http::ResponseDecoder&
   Instance::StreamOptions overriding_options = options;
   bool delay_tcp_attempt = true;
   if (shouldAttemptHttp3() && options.can_use_http3_) {
+    // Requests the route's early data policy has vetted as replay-safe arrive with
+    // can_send_early_data_ set and are dispatched on the HTTP/3 pool before the handshake
+    // confirms whenever the shared crypto config holds a resumption ticket for this origin:
+    // the session raises ConnectedZeroRtt once 0-RTT keys are derived and the pool attaches
+    // such streams to the connecting client right away. Only a recent 0-RTT failure opts the
+    // request out of early data and starts the TCP attempt immediately.
     if (getHttp3StatusTracker().hasHttp3FailedRecently()) {
       overriding_options.can_send_early_data_ = false;
       delay_tcp_attempt = false;
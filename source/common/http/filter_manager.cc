@@ -12,6 +12,7 @@
 #include "source/common/http/header_map_impl.h"
 #include "source/common/http/header_utility.h"
 #include "source/common/http/utility.h"
+#include "source/common/stats/utility.h"
 
 #include "matching/data_impl.h"
 
@@ -522,6 +523,32 @@ void FilterManager::applyFilterFactoryCb(FilterContext context, FilterFactoryCb&
   factory(callbacks);
 }
 
+FilterManager::ScopedFilterTimer::ScopedFilterTimer(FilterManager& parent,
+                                                    const FilterContext& filter_context,
+                                                    absl::string_view callback)
+    : parent_(parent), filter_context_(filter_context), callback_(callback),
+      enabled_(parent.filter_timing_scope_ != nullptr) {
+  if (enabled_) {
+    start_ = parent_.dispatcher_.timeSource().monotonicTime();
+  }
+}
+
+FilterManager::ScopedFilterTimer::~ScopedFilterTimer() {
+  if (!enabled_) {
+    return;
+  }
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      parent_.dispatcher_.timeSource().monotonicTime() - start_);
+  // The histogram is looked up by name on each record; this only runs for sampled streams so the
+  // lookup cost is acceptable and avoids pre-creating histograms for filters that never run.
+  Stats::Utility::histogramFromElements(
+      *parent_.filter_timing_scope_,
+      {parent_.filter_timing_prefix_, Stats::DynamicName("filter_timing"),
+       Stats::DynamicName(filter_context_.config_name), Stats::DynamicName(callback_)},
+      Stats::Histogram::Unit::Microseconds)
+      .recordValue(elapsed.count());
+}
+
 void FilterManager::maybeContinueDecoding(
     const std::list<ActiveStreamDecoderFilterPtr>::iterator& continue_data_entry) {
   if (continue_data_entry != decoder_filters_.end()) {
@@ -546,7 +573,9 @@ void FilterManager::decodeHeaders(ActiveStreamDecoderFilter* filter, RequestHead
     ASSERT(!(state_.filter_call_state_ & FilterCallState::DecodeHeaders));
     state_.filter_call_state_ |= FilterCallState::DecodeHeaders;
     (*entry)->end_stream_ = (end_stream && continue_data_entry == decoder_filters_.end());
-    FilterHeadersStatus status = (*entry)->decodeHeaders(headers, (*entry)->end_stream_);
+    FilterHeadersStatus status = timedFilterCallback(
+        (*entry)->filter_context_, "decode_headers",
+        [&] { return (*entry)->decodeHeaders(headers, (*entry)->end_stream_); });
     state_.filter_call_state_ &= ~FilterCallState::DecodeHeaders;
     if (state_.decoder_filter_chain_aborted_) {
       executeLocalReplyIfPrepared();
@@ -633,6 +662,15 @@ void FilterManager::decodeData(ActiveStreamDecoderFilter* filter, Buffer::Instan
   std::list<ActiveStreamDecoderFilterPtr>::iterator entry =
       commonDecodePrefix(filter, filter_iteration_start_state);
 
+  // Established upgrade fast path: every non-terminal decoder filter declared itself body
+  // pass-through when the tunnel was established, so hand tunneled payload straight to the
+  // terminal filter, which is what pumps it upstream. The end-of-stream frame still walks the
+  // full chain so decodeComplete() and end-of-stream bookkeeping run unchanged.
+  if (state_.decoder_upgrade_pass_through_active_ && filter == nullptr && !end_stream &&
+      !decoder_filters_.empty() && entry == decoder_filters_.begin()) {
+    entry = std::prev(decoder_filters_.end());
+  }
+
   for (; entry != decoder_filters_.end(); entry++) {
     // If the filter pointed by entry has stopped for all frame types, return now.
     if (handleDataIfStopAll(**entry, data, state_.decoder_filters_streaming_)) {
@@ -684,7 +722,9 @@ void FilterManager::decodeData(ActiveStreamDecoderFilter* filter, Buffer::Instan
 
     state_.filter_call_state_ |= FilterCallState::DecodeData;
     (*entry)->end_stream_ = end_stream && !filter_manager_callbacks_.requestTrailers();
-    FilterDataStatus status = (*entry)->handle_->decodeData(data, (*entry)->end_stream_);
+    FilterDataStatus status = timedFilterCallback(
+        (*entry)->filter_context_, "decode_data",
+        [&] { return (*entry)->handle_->decodeData(data, (*entry)->end_stream_); });
     if ((*entry)->end_stream_) {
       (*entry)->handle_->decodeComplete();
     }
@@ -776,9 +816,20 @@ void FilterManager::decodeTrailers(ActiveStreamDecoderFilter* filter, RequestTra
     if ((*entry)->stoppedAll()) {
       return;
     }
+    // Trailer pass-through filters are not consulted for trailer frames; they still observe
+    // end of stream via decodeComplete().
+    if ((*entry)->handle_->isTrailerPassThrough() && (*entry)->canIterate()) {
+      (*entry)->handle_->decodeComplete();
+      (*entry)->end_stream_ = true;
+      ENVOY_STREAM_LOG(trace, "decode trailers skipped for pass-through filter={}", *this,
+                       (*entry)->filter_context_.config_name);
+      continue;
+    }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::DecodeTrailers));
     state_.filter_call_state_ |= FilterCallState::DecodeTrailers;
-    FilterTrailersStatus status = (*entry)->handle_->decodeTrailers(trailers);
+    FilterTrailersStatus status =
+        timedFilterCallback((*entry)->filter_context_, "decode_trailers",
+                            [&] { return (*entry)->handle_->decodeTrailers(trailers); });
     (*entry)->handle_->decodeComplete();
     (*entry)->end_stream_ = true;
     state_.filter_call_state_ &= ~FilterCallState::DecodeTrailers;
@@ -822,7 +873,9 @@ void FilterManager::decodeMetadata(ActiveStreamDecoderFilter* filter, MetadataMa
       return;
     }
     state_.filter_call_state_ |= FilterCallState::DecodeMetadata;
-    FilterMetadataStatus status = (*entry)->handle_->decodeMetadata(metadata_map);
+    FilterMetadataStatus status =
+        timedFilterCallback((*entry)->filter_context_, "decode_metadata",
+                            [&] { return (*entry)->handle_->decodeMetadata(metadata_map); });
     state_.filter_call_state_ &= ~FilterCallState::DecodeMetadata;
 
     ENVOY_STREAM_LOG(trace, "decode metadata called: filter={} status={}, metadata: {}", *this,
@@ -1122,7 +1175,9 @@ void FilterManager::encode1xxHeaders(ActiveStreamEncoderFilter* filter,
   for (; entry != encoder_filters_.end(); entry++) {
     ASSERT(!(state_.filter_call_state_ & FilterCallState::Encode1xxHeaders));
     state_.filter_call_state_ |= FilterCallState::Encode1xxHeaders;
-    const Filter1xxHeadersStatus status = (*entry)->handle_->encode1xxHeaders(headers);
+    const Filter1xxHeadersStatus status =
+        timedFilterCallback((*entry)->filter_context_, "encode_1xx_headers",
+                            [&] { return (*entry)->handle_->encode1xxHeaders(headers); });
     state_.filter_call_state_ &= ~FilterCallState::Encode1xxHeaders;
 
     ENVOY_STREAM_LOG(trace, "encode 1xx continue headers called: filter={} status={}", *this,
@@ -1172,7 +1227,9 @@ void FilterManager::encodeHeaders(ActiveStreamEncoderFilter* filter, ResponseHea
     ASSERT(!(state_.filter_call_state_ & FilterCallState::EncodeHeaders));
     state_.filter_call_state_ |= FilterCallState::EncodeHeaders;
     (*entry)->end_stream_ = (end_stream && continue_data_entry == encoder_filters_.end());
-    FilterHeadersStatus status = (*entry)->handle_->encodeHeaders(headers, (*entry)->end_stream_);
+    FilterHeadersStatus status = timedFilterCallback(
+        (*entry)->filter_context_, "encode_headers",
+        [&] { return (*entry)->handle_->encodeHeaders(headers, (*entry)->end_stream_); });
     if (state_.encoder_filter_chain_aborted_) {
       ENVOY_STREAM_LOG(trace,
                        "encodeHeaders filter iteration aborted due to local reply: filter={}",
@@ -1228,6 +1285,18 @@ void FilterManager::encodeHeaders(ActiveStreamEncoderFilter* filter, ResponseHea
 
   const bool modified_end_stream = (end_stream && continue_data_entry == encoder_filters_.end());
   state_.non_100_response_headers_encoded_ = true;
+  // Headers have iterated through the entire chain without any filter stopping, so if every
+  // encoder filter is body pass-through, subsequent data frames can skip filter iteration.
+  state_.encoder_body_pass_through_active_ = state_.all_encoder_filters_body_pass_through_;
+  // Once an upgrade/CONNECT tunnel is established, tunneled request payload can likewise skip
+  // the non-terminal decoder filters if they are all body pass-through. The terminal filter
+  // (the router) still runs for every frame since it is what pumps the payload upstream.
+  if (state_.upgrade_filter_chain_ && !modified_end_stream &&
+      (Utility::isUpgrade(headers) ||
+       HeaderUtility::isConnectResponse(filter_manager_callbacks_.requestHeaders().ptr(),
+                                        headers))) {
+    state_.decoder_upgrade_pass_through_active_ = nonTerminalDecoderFiltersArePassThrough();
+  }
   filter_manager_callbacks_.encodeHeaders(headers, modified_end_stream);
   if (state_.saw_downstream_reset_) {
     return;
@@ -1258,7 +1327,9 @@ void FilterManager::encodeMetadata(ActiveStreamEncoderFilter* filter,
 
     state_.filter_call_state_ |= FilterCallState::EncodeMetadata;
 
-    FilterMetadataStatus status = (*entry)->handle_->encodeMetadata(*metadata_map_ptr);
+    FilterMetadataStatus status =
+        timedFilterCallback((*entry)->filter_context_, "encode_metadata",
+                            [&] { return (*entry)->handle_->encodeMetadata(*metadata_map_ptr); });
 
     state_.filter_call_state_ &= ~FilterCallState::EncodeMetadata;
 
@@ -1328,6 +1399,18 @@ void FilterManager::encodeData(ActiveStreamEncoderFilter* filter, Buffer::Instan
                                FilterIterationStartState filter_iteration_start_state) {
   filter_manager_callbacks_.resetIdleTimer();
 
+  // Fast path: every encoder filter has declared itself body pass-through and response headers
+  // have already iterated through the full chain, so intermediate data frames can be handed
+  // straight to the codec without per-filter iteration. The final frame (end_stream, or the
+  // data frame preceding trailers) still takes the normal path below so that encodeComplete()
+  // and end-of-stream bookkeeping run unchanged.
+  if (filter == nullptr && !end_stream && state_.encoder_body_pass_through_active_ &&
+      !state_.encoder_filter_chain_aborted_ && buffered_response_data_ == nullptr) {
+    ENVOY_STREAM_LOG(trace, "encode data pass-through: size={}", *this, data.length());
+    filter_manager_callbacks_.encodeData(data, false);
+    return;
+  }
+
   // Filter iteration may start at the current filter.
   std::list<ActiveStreamEncoderFilterPtr>::iterator entry =
       commonEncodePrefix(filter, end_stream, filter_iteration_start_state);
@@ -1357,7 +1440,9 @@ void FilterManager::encodeData(ActiveStreamEncoderFilter* filter, Buffer::Instan
     recordLatestDataFilter(entry, state_.latest_data_encoding_filter_, encoder_filters_);
 
     (*entry)->end_stream_ = end_stream && !filter_manager_callbacks_.responseTrailers();
-    FilterDataStatus status = (*entry)->handle_->encodeData(data, (*entry)->end_stream_);
+    FilterDataStatus status = timedFilterCallback(
+        (*entry)->filter_context_, "encode_data",
+        [&] { return (*entry)->handle_->encodeData(data, (*entry)->end_stream_); });
     if (state_.encoder_filter_chain_aborted_) {
       ENVOY_STREAM_LOG(trace, "encodeData filter iteration aborted due to local reply: filter={}",
                        *this, (*entry)->filter_context_.config_name);
@@ -1409,9 +1494,20 @@ void FilterManager::encodeTrailers(ActiveStreamEncoderFilter* filter,
     if ((*entry)->stoppedAll()) {
       return;
     }
+    // Trailer pass-through filters are not consulted for trailer frames; they still observe
+    // end of stream via encodeComplete().
+    if ((*entry)->handle_->isTrailerPassThrough() && (*entry)->canIterate()) {
+      (*entry)->handle_->encodeComplete();
+      (*entry)->end_stream_ = true;
+      ENVOY_STREAM_LOG(trace, "encode trailers skipped for pass-through filter={}", *this,
+                       (*entry)->filter_context_.config_name);
+      continue;
+    }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::EncodeTrailers));
     state_.filter_call_state_ |= FilterCallState::EncodeTrailers;
-    FilterTrailersStatus status = (*entry)->handle_->encodeTrailers(trailers);
+    FilterTrailersStatus status =
+        timedFilterCallback((*entry)->filter_context_, "encode_trailers",
+                            [&] { return (*entry)->handle_->encodeTrailers(trailers); });
     (*entry)->handle_->encodeComplete();
     (*entry)->end_stream_ = true;
     state_.filter_call_state_ &= ~FilterCallState::EncodeTrailers;
@@ -1460,6 +1556,18 @@ bool FilterManager::handleDataIfStopAll(ActiveStreamFilterBase& filter, Buffer::
   return false;
 }
 
+bool FilterManager::nonTerminalDecoderFiltersArePassThrough() {
+  for (auto entry = decoder_filters_.begin(); entry != decoder_filters_.end(); entry++) {
+    if (std::next(entry) == decoder_filters_.end()) {
+      break;
+    }
+    if (!(*entry)->handle_->isBodyPassThrough() || !(*entry)->canIterate()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void FilterManager::callHighWatermarkCallbacks() {
   ++high_watermark_count_;
   for (auto watermark_callbacks : watermark_callbacks_) {
@@ -1514,6 +1622,7 @@ bool FilterManager::createFilterChain() {
 
     if (filter_chain_factory_.createUpgradeFilterChain(upgrade->value().getStringView(),
                                                        upgrade_map, *this)) {
+      state_.upgrade_filter_chain_ = true;
       filter_manager_callbacks_.upgradeFilterChainCreated();
       return true;
     } else {
@@ -12,6 +12,7 @@
 #include "envoy/matcher/matcher.h"
 #include "envoy/network/socket.h"
 #include "envoy/protobuf/message_validator.h"
+#include "envoy/stats/scope.h"
 
 #include "source/common/buffer/watermark_buffer.h"
 #include "source/common/common/dump_state_utils.h"
@@ -24,8 +25,10 @@
 #include "source/common/http/utility.h"
 #include "source/common/local_reply/local_reply.h"
 #include "source/common/matcher/matcher.h"
+#include "source/common/memory/arena.h"
 #include "source/common/protobuf/utility.h"
 #include "source/common/runtime/runtime_features.h"
+#include "source/common/stats/symbol_table.h"
 #include "source/common/stream_info/stream_info_impl.h"
 
 namespace Envoy {
@@ -171,7 +174,8 @@ struct ActiveStreamFilterBase : public virtual StreamFilterCallbacks,
  */
 struct ActiveStreamDecoderFilter : public ActiveStreamFilterBase,
                                    public StreamDecoderFilterCallbacks,
-                                   LinkedObject<ActiveStreamDecoderFilter> {
+                                   LinkedObject<ActiveStreamDecoderFilter,
+                                                Memory::Arena::DestructOnlyDeleter> {
   ActiveStreamDecoderFilter(FilterManager& parent, StreamDecoderFilterSharedPtr filter,
                             bool is_encoder_decoder_filter, FilterContext filter_context)
       : ActiveStreamFilterBase(parent, is_encoder_decoder_filter, std::move(filter_context)),
@@ -258,14 +262,15 @@ struct ActiveStreamDecoderFilter : public ActiveStreamFilterBase,
   bool is_grpc_request_{};
 };
 
-using ActiveStreamDecoderFilterPtr = std::unique_ptr<ActiveStreamDecoderFilter>;
+using ActiveStreamDecoderFilterPtr = Memory::ArenaPtr<ActiveStreamDecoderFilter>;
 
 /**
  * Wrapper for a stream encoder filter.
  */
 struct ActiveStreamEncoderFilter : public ActiveStreamFilterBase,
                                    public StreamEncoderFilterCallbacks,
-                                   LinkedObject<ActiveStreamEncoderFilter> {
+                                   LinkedObject<ActiveStreamEncoderFilter,
+                                                Memory::Arena::DestructOnlyDeleter> {
   ActiveStreamEncoderFilter(FilterManager& parent, StreamEncoderFilterSharedPtr filter,
                             bool is_encoder_decoder_filter, FilterContext filter_context)
       : ActiveStreamFilterBase(parent, is_encoder_decoder_filter, std::move(filter_context)),
@@ -317,7 +322,7 @@ struct ActiveStreamEncoderFilter : public ActiveStreamFilterBase,
   StreamEncoderFilterSharedPtr handle_;
 };
 
-using ActiveStreamEncoderFilterPtr = std::unique_ptr<ActiveStreamEncoderFilter>;
+using ActiveStreamEncoderFilterPtr = Memory::ArenaPtr<ActiveStreamEncoderFilter>;
 
 /**
  * Callbacks invoked by the FilterManager to pass filter data/events back to the caller.
@@ -654,6 +659,9 @@ public:
     //     - B
     //     - C
     // The encoder filter chain will iterate through filters C, B, A.
+    if (!filter->handle_->isBodyPassThrough()) {
+      state_.all_encoder_filters_body_pass_through_ = false;
+    }
     LinkedList::moveIntoList(std::move(filter), encoder_filters_);
   }
   void addStreamFilterBase(StreamFilterBase* filter) { filters_.push_back(filter); }
@@ -828,6 +836,18 @@ public:
   void onDownstreamReset() { state_.saw_downstream_reset_ = true; }
   bool sawDownstreamReset() { return state_.saw_downstream_reset_; }
 
+  /**
+   * Attribute the wall time spent in each filter callback of this stream to per-filter-config
+   * histograms rooted at the given scope, named
+   * <prefix>.filter_timing.<filter config name>.<callback>. Expected to be enabled only for a
+   * sampled subset of streams since every filter invocation pays for two time source reads and a
+   * histogram lookup.
+   */
+  void enableFilterTiming(Stats::Scope& scope, Stats::StatName prefix) {
+    filter_timing_scope_ = &scope;
+    filter_timing_prefix_ = prefix;
+  }
+
 protected:
   struct State {
     State()
@@ -835,7 +855,9 @@ protected:
           has_1xx_headers_(false), created_filter_chain_(false), is_head_request_(false),
           is_grpc_request_(false), non_100_response_headers_encoded_(false),
           under_on_local_reply_(false), decoder_filter_chain_aborted_(false),
-          encoder_filter_chain_aborted_(false), saw_downstream_reset_(false) {}
+          encoder_filter_chain_aborted_(false), saw_downstream_reset_(false),
+          all_encoder_filters_body_pass_through_(true), encoder_body_pass_through_active_(false),
+          upgrade_filter_chain_(false), decoder_upgrade_pass_through_active_(false) {}
     uint32_t filter_call_state_{0};
 
     bool remote_decode_complete_ : 1;
@@ -859,6 +881,19 @@ protected:
     bool decoder_filter_chain_aborted_ : 1;
     bool encoder_filter_chain_aborted_ : 1;
     bool saw_downstream_reset_ : 1;
+    // True while every encoder filter added to the chain has declared itself body
+    // pass-through via StreamFilterBase::isBodyPassThrough().
+    bool all_encoder_filters_body_pass_through_ : 1;
+    // Latched once response headers have completed iteration through a fully pass-through
+    // encoder filter chain; enables the encodeData() fast path for intermediate frames.
+    bool encoder_body_pass_through_active_ : 1;
+    // True when the chain was created via createUpgradeFilterChain().
+    bool upgrade_filter_chain_ : 1;
+    // Latched once an upgrade/CONNECT tunnel is established (successful upgrade response
+    // headers have iterated the chain) and every non-terminal decoder filter is body
+    // pass-through; enables the decodeData() fast path that hands tunneled payload straight
+    // to the terminal filter.
+    bool decoder_upgrade_pass_through_active_ : 1;
 
     // The following 3 members are booleans rather than part of the space-saving bitfield as they
     // are passed as arguments to functions expecting bools. Extend State using the bitfield
@@ -883,13 +918,13 @@ private:
 
     void addStreamDecoderFilter(Http::StreamDecoderFilterSharedPtr filter) override {
       manager_.addStreamFilterBase(filter.get());
-      manager_.addStreamDecoderFilter(std::make_unique<ActiveStreamDecoderFilter>(
+      manager_.addStreamDecoderFilter(manager_.arena_.makeUnique<ActiveStreamDecoderFilter>(
           manager_, std::move(filter), false, context_));
     }
 
     void addStreamEncoderFilter(Http::StreamEncoderFilterSharedPtr filter) override {
       manager_.addStreamFilterBase(filter.get());
-      manager_.addStreamEncoderFilter(std::make_unique<ActiveStreamEncoderFilter>(
+      manager_.addStreamEncoderFilter(manager_.arena_.makeUnique<ActiveStreamEncoderFilter>(
           manager_, std::move(filter), false, context_));
     }
 
@@ -898,9 +933,9 @@ private:
       manager_.addStreamFilterBase(decoder_filter);
 
       manager_.addStreamDecoderFilter(
-          std::make_unique<ActiveStreamDecoderFilter>(manager_, filter, true, context_));
-      manager_.addStreamEncoderFilter(
-          std::make_unique<ActiveStreamEncoderFilter>(manager_, std::move(filter), true, context_));
+          manager_.arena_.makeUnique<ActiveStreamDecoderFilter>(manager_, filter, true, context_));
+      manager_.addStreamEncoderFilter(manager_.arena_.makeUnique<ActiveStreamEncoderFilter>(
+          manager_, std::move(filter), true, context_));
     }
 
     void addAccessLogHandler(AccessLog::InstanceSharedPtr handler) override {
@@ -969,6 +1004,29 @@ private:
   void encodeTrailers(ActiveStreamEncoderFilter* filter, ResponseTrailerMap& trailers);
   void encodeMetadata(ActiveStreamEncoderFilter* filter, MetadataMapPtr&& metadata_map_ptr);
 
+  // Measures a single filter callback invocation when filter timing is enabled and records it on
+  // destruction. This is wall time as seen from the filter manager: work a filter triggers
+  // inline (e.g. continuing iteration from within its own callback) is attributed to that filter.
+  struct ScopedFilterTimer {
+    ScopedFilterTimer(FilterManager& parent, const FilterContext& filter_context,
+                      absl::string_view callback);
+    ~ScopedFilterTimer();
+
+    FilterManager& parent_;
+    const FilterContext& filter_context_;
+    const absl::string_view callback_;
+    const bool enabled_;
+    MonotonicTime start_;
+  };
+
+  // Invokes a single filter callback under a ScopedFilterTimer and returns its status.
+  template <class Callback>
+  auto timedFilterCallback(const FilterContext& filter_context, absl::string_view callback,
+                           Callback cb) {
+    ScopedFilterTimer filter_timer(*this, filter_context, callback);
+    return cb();
+  }
+
   // Returns true if new metadata is decoded. Otherwise, returns false.
   bool processNewlyAddedMetadata();
 
@@ -978,6 +1036,11 @@ private:
   bool handleDataIfStopAll(ActiveStreamFilterBase& filter, Buffer::Instance& data,
                            bool& filter_streaming);
 
+  // Returns true if every decoder filter other than the terminal one has declared itself body
+  // pass-through and is currently able to iterate. Evaluated once when an upgrade tunnel is
+  // established to decide whether tunneled payload can skip straight to the terminal filter.
+  bool nonTerminalDecoderFiltersArePassThrough();
+
   MetadataMapVector* getRequestMetadataMapVector() {
     if (request_metadata_map_vector_ == nullptr) {
       request_metadata_map_vector_ = std::make_unique<MetadataMapVector>();
@@ -994,6 +1057,11 @@ private:
   Buffer::BufferMemoryAccountSharedPtr account_;
   const bool proxy_100_continue_;
 
+  // Per-stream arena that the filter wrapper entries below are carved from. Declared before
+  // the filter lists so that it is destroyed after them: the list entries run the wrapper
+  // destructors while the arena reclaims their storage in one shot.
+  Memory::Arena arena_;
+
   std::list<ActiveStreamDecoderFilterPtr> decoder_filters_;
   std::list<ActiveStreamEncoderFilterPtr> encoder_filters_;
   std::list<StreamFilterBase*> filters_;
@@ -1012,6 +1080,11 @@ private:
       std::make_shared<Network::Socket::Options>();
   absl::optional<absl::string_view> upstream_override_host_;
 
+  // Unset unless per-filter timing was enabled for this (sampled) stream. The prefix stat name is
+  // owned by the connection manager stats, which outlive the stream.
+  Stats::Scope* filter_timing_scope_{nullptr};
+  Stats::StatName filter_timing_prefix_;
+
   const FilterChainFactory& filter_chain_factory_;
   // TODO(snowp): Once FM has been moved to its own file we'll make these private classes of FM,
   // at which point they no longer need to be friends.
@@ -305,6 +305,39 @@ void HeaderMapImpl::addCopy(const LowerCaseString& key, absl::string_view value)
   ASSERT(new_value.empty()); // NOLINT(bugprone-use-after-move)
 }
 
+void HeaderMapImpl::addCopyBulk(
+    absl::Span<const std::pair<absl::string_view, absl::string_view>> headers) {
+  // Single pass over the batch: classify each key against the O(1) header table once and
+  // accumulate size accounting for the non-inline entries so addSize() runs once for the whole
+  // batch instead of per header. Unlike addCopy() this also avoids the temporary key
+  // HeaderString (and its lowercasing copy) for inline headers.
+  uint64_t added_size = 0;
+  for (const auto& header : headers) {
+    ASSERT(LowerCaseString(header.first).get() == header.first);
+    auto lookup = staticLookup(header.first);
+    if (lookup.has_value()) {
+      if (*lookup.value().entry_ == nullptr) {
+        HeaderString new_value;
+        new_value.setCopy(header.second);
+        maybeCreateInline(lookup.value().entry_, *lookup.value().key_, std::move(new_value));
+      } else {
+        const auto delimiter = delimiterByHeader(*lookup.value().key_);
+        added_size +=
+            appendToHeader((*lookup.value().entry_)->value(), header.second, delimiter);
+      }
+    } else {
+      HeaderString new_key;
+      new_key.setCopy(header.first);
+      HeaderString new_value;
+      new_value.setCopy(header.second);
+      added_size += new_key.size() + new_value.size();
+      HeaderNode i = headers_.insert(std::move(new_key), std::move(new_value));
+      i->entry_ = i;
+    }
+  }
+  addSize(added_size);
+}
+
 void HeaderMapImpl::appendCopy(const LowerCaseString& key, absl::string_view value) {
   // TODO(#9221): converge on and document a policy for coalescing multiple headers.
   auto entry = getExisting(key);
@@ -15,6 +15,8 @@
 #include "source/common/http/headers.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Http {
 
@@ -89,6 +91,7 @@ public:
   void addReferenceKey(const LowerCaseString& key, absl::string_view value);
   void addCopy(const LowerCaseString& key, uint64_t value);
   void addCopy(const LowerCaseString& key, absl::string_view value);
+  void addCopyBulk(absl::Span<const std::pair<absl::string_view, absl::string_view>> headers);
   void appendCopy(const LowerCaseString& key, absl::string_view value);
   void setReference(const LowerCaseString& key, absl::string_view value);
   void setReferenceKey(const LowerCaseString& key, absl::string_view value);
@@ -141,19 +144,27 @@ protected:
   };
 
   /**
-   * Base class for a static lookup table that converts a string key into an O(1) header.
+   * Base class for a static lookup table that converts a string key into an O(1) header. The
+   * table is a flat hash index built once over all registered inline headers when the singleton
+   * is created; after that point lookups are a single probe rather than a per-byte trie walk.
+   * Keys reference the registry's (finalized, stable) header strings so the index holds no
+   * string storage of its own.
    */
-  template <class Interface>
-  struct StaticLookupTable
-      : public TrieLookupTable<std::function<StaticLookupResponse(HeaderMapImpl&)>> {
+  template <class Interface> struct StaticLookupTable {
     StaticLookupTable();
 
+    void add(absl::string_view key, std::function<StaticLookupResponse(HeaderMapImpl&)> cb) {
+      map_.emplace(key, std::move(cb));
+    }
+
     void finalizeTable() {
       CustomInlineHeaderRegistry::finalize<Interface::header_map_type>();
       auto& headers = CustomInlineHeaderRegistry::headers<Interface::header_map_type>();
       size_ = headers.size();
+      // +1 leaves room for the legacy Host alias added after finalization for request maps.
+      map_.reserve(size_ + 1);
       for (const auto& header : headers) {
-        this->add(header.first.get().c_str(), [&header](HeaderMapImpl& h) -> StaticLookupResponse {
+        this->add(header.first.get(), [&header](HeaderMapImpl& h) -> StaticLookupResponse {
           return {&h.inlineHeaders()[header.second], &header.first};
         });
       }
@@ -172,14 +183,17 @@ protected:
 
     static absl::optional<StaticLookupResponse> lookup(HeaderMapImpl& header_map,
                                                        absl::string_view key) {
-      const auto& entry = ConstSingleton<StaticLookupTable>::get().find(key);
-      if (entry != nullptr) {
-        return entry(header_map);
+      const auto& table = ConstSingleton<StaticLookupTable>::get();
+      const auto entry = table.map_.find(key);
+      if (entry != table.map_.end()) {
+        return entry->second(header_map);
       } else {
         return absl::nullopt;
       }
     }
 
+    absl::flat_hash_map<absl::string_view, std::function<StaticLookupResponse(HeaderMapImpl&)>>
+        map_;
     size_t size_;
   };
 
@@ -381,6 +395,10 @@ public:
   void addCopy(const LowerCaseString& key, absl::string_view value) override {
     HeaderMapImpl::addCopy(key, value);
   }
+  void
+  addCopyBulk(absl::Span<const std::pair<absl::string_view, absl::string_view>> headers) override {
+    HeaderMapImpl::addCopyBulk(headers);
+  }
   void appendCopy(const LowerCaseString& key, absl::string_view value) override {
     HeaderMapImpl::appendCopy(key, value);
   }
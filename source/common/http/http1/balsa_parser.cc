@@ -1,11 +1,13 @@
 #include "source/common/http/http1/balsa_parser.h"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <cstdint>
 
 #include "source/common/common/assert.h"
 #include "source/common/common/regex.h"
+#include "source/common/http/character_set_validation.h"
 #include "source/common/http/headers.h"
 
 #include "absl/strings/match.h"
@@ -23,13 +25,24 @@ constexpr absl::string_view kColonSlashSlash = "://";
 // Response must start with "HTTP".
 constexpr char kResponseFirstByte = 'H';
 
-// Allowed characters for field names according to Section 5.1
-// and for methods according to Section 9.1 of RFC 9110:
-// https://www.rfc-editor.org/rfc/rfc9110.html
-constexpr absl::string_view kValidCharacters =
-    "!#$%&'*+-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ^_`abcdefghijklmnopqrstuvwxyz|~";
-constexpr absl::string_view::iterator kValidCharactersBegin = kValidCharacters.begin();
-constexpr absl::string_view::iterator kValidCharactersEnd = kValidCharacters.end();
+// Characters allowed in a path or query according to http-parser: HTAB, FF and all of
+// printable ASCII except space. Kept here rather than in character_set_validation.h because it
+// reflects http-parser compatibility, not an RFC character class.
+constexpr std::array<uint32_t, 8> kPathQueryCharTable = {
+    // control characters (HTAB and FF allowed)
+    0b00000000010010000000000000000000,
+    // !"#$%&'()*+,-./0123456789:;<=>?
+    0b01111111111111111111111111111111,
+    //@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_
+    0b11111111111111111111111111111111,
+    //`abcdefghijklmnopqrstuvwxyz{|}~
+    0b11111111111111111111111111111110,
+    // extended ascii
+    0b00000000000000000000000000000000,
+    0b00000000000000000000000000000000,
+    0b00000000000000000000000000000000,
+    0b00000000000000000000000000000000,
+};
 
 bool isFirstCharacterOfValidMethod(char c) {
   static constexpr char kValidFirstCharacters[] = {'A', 'B', 'C', 'D', 'G', 'H', 'L', 'M',
@@ -44,10 +57,9 @@ bool isFirstCharacterOfValidMethod(char c) {
 // enabled.
 bool isMethodValid(absl::string_view method, bool allow_custom_methods) {
   if (allow_custom_methods) {
-    return !method.empty() &&
-           std::all_of(method.begin(), method.end(), [](absl::string_view::value_type c) {
-             return std::binary_search(kValidCharactersBegin, kValidCharactersEnd, c);
-           });
+    // Allowed characters for methods according to Section 9.1 of RFC 9110 are the same token
+    // characters as for field names: https://www.rfc-editor.org/rfc/rfc9110.html
+    return !method.empty() && testStringInTable(kGenericHeaderNameCharTable, method);
   }
 
   static constexpr absl::string_view kValidMethods[] = {
@@ -68,15 +80,9 @@ bool isUrlValid(absl::string_view url, bool is_connect) {
     return false;
   }
 
-  // Same set of characters are allowed for path and query.
-  const auto is_valid_path_query_char = [](char c) {
-    return c == 9 || c == 12 || ('!' <= c && c <= 126);
-  };
-
   // The URL may start with a path.
-  if (auto it = url.begin(); *it == '/' || *it == '*') {
-    ++it;
-    return std::all_of(it, url.end(), is_valid_path_query_char);
+  if (url[0] == '/' || url[0] == '*') {
+    return testStringInTable(kPathQueryCharTable, url.substr(1));
   }
 
   // If method is not CONNECT, parse scheme.
@@ -117,7 +123,7 @@ bool isUrlValid(absl::string_view url, bool is_connect) {
   // Match http-parser's quirk of allowing any number of '@' characters in host
   // as long as they are not consecutive.
   return std::all_of(host.begin(), host.end(), valid_host_char) && !absl::StrContains(host, "@@") &&
-         std::all_of(path_query.begin(), path_query.end(), is_valid_path_query_char);
+         testStringInTable(kPathQueryCharTable, path_query);
 }
 
 bool isVersionValid(absl::string_view version_input) {
@@ -136,9 +142,7 @@ bool isVersionValid(absl::string_view version_input) {
 }
 
 bool isHeaderNameValid(absl::string_view name) {
-  return std::all_of(name.begin(), name.end(), [](absl::string_view::value_type c) {
-    return std::binary_search(kValidCharactersBegin, kValidCharactersEnd, c);
-  });
+  return testStringInTable(kGenericHeaderNameCharTable, name);
 }
 
 } // anonymous namespace
@@ -1,5 +1,6 @@
 #include "source/common/http/http1/codec_impl.h"
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -401,6 +402,30 @@ const Network::ConnectionInfoProvider& StreamEncoderImpl::connectionInfoProvider
 static constexpr absl::string_view RESPONSE_PREFIX = "HTTP/1.1 ";
 static constexpr absl::string_view HTTP_10_RESPONSE_PREFIX = "HTTP/1.0 ";
 
+// Returns the pre-rendered "<code> <reason-phrase>\r\n" status line tail for `code`, or an empty
+// view if Envoy has no reason phrase for that code. The tails for all known codes are rendered
+// once on first use so that serializing a status line is two pre-sized fragment copies instead of
+// formatting the code and taking strlen() of the reason phrase per response.
+static absl::string_view preRenderedStatusLineTail(uint64_t code) {
+  if (code < 100 || code >= 600) {
+    return {};
+  }
+  const auto& tails = []() -> const std::array<std::string, 500>& {
+    CONSTRUCT_ON_FIRST_USE(std::array<std::string, 500>, ([] {
+                             std::array<std::string, 500> tails;
+                             for (uint64_t code = 100; code < 600; ++code) {
+                               const absl::string_view reason =
+                                   CodeUtility::toString(static_cast<Code>(code));
+                               if (reason != "Unknown") {
+                                 tails[code - 100] = absl::StrCat(code, " ", reason, CRLF);
+                               }
+                             }
+                             return tails;
+                           })());
+  }();
+  return tails[code - 100];
+}
+
 void ResponseEncoderImpl::encodeHeaders(const ResponseHeaderMap& headers, bool end_stream) {
   started_response_ = true;
 
@@ -420,14 +445,20 @@ void ResponseEncoderImpl::encodeHeaders(const ResponseHeaderMap& headers, bool e
   absl::string_view reason_phrase;
   if (formatter.has_value() && !formatter->getReasonPhrase().empty()) {
     reason_phrase = formatter->getReasonPhrase();
-  } else {
-    const char* status_string = CodeUtility::toString(static_cast<Code>(numeric_status));
-    uint32_t status_string_len = strlen(status_string);
-    reason_phrase = {status_string, status_string_len};
   }
 
-  connection_.buffer().addFragments(
-      {response_prefix, absl::StrCat(numeric_status), SPACE, reason_phrase, CRLF});
+  const absl::string_view rendered_tail = preRenderedStatusLineTail(numeric_status);
+  if (reason_phrase.empty() && !rendered_tail.empty()) {
+    connection_.buffer().addFragments({response_prefix, rendered_tail});
+  } else {
+    if (reason_phrase.empty()) {
+      const char* status_string = CodeUtility::toString(static_cast<Code>(numeric_status));
+      uint32_t status_string_len = strlen(status_string);
+      reason_phrase = {status_string, status_string_len};
+    }
+    connection_.buffer().addFragments(
+        {response_prefix, absl::StrCat(numeric_status), SPACE, reason_phrase, CRLF});
+  }
 
   if (numeric_status >= 300) {
     // Don't do special CONNECT logic if the CONNECT was rejected.
@@ -2,10 +2,15 @@
 
 #include <string>
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Http {
 namespace Http1 {
-std::string ProperCaseHeaderKeyFormatter::format(absl::string_view key) const {
+
+namespace {
+
+std::string properCase(absl::string_view key) {
   auto copy = std::string(key);
 
   bool should_capitalize = true;
@@ -19,6 +24,30 @@ std::string ProperCaseHeaderKeyFormatter::format(absl::string_view key) const {
 
   return copy;
 }
+
+} // namespace
+
+std::string ProperCaseHeaderKeyFormatter::format(absl::string_view key) const {
+  // Proper casing is a pure function of the key and a connection serializes the same small set
+  // of keys on every message, so intern the results in a bounded per-worker cache keyed by the
+  // lowered key. The bound exists only to contain pathological configurations that emit
+  // unbounded distinct keys; ordinary traffic stays far below it and keys past the bound are
+  // formatted without being cached.
+  static constexpr size_t MaxCachedKeys = 512;
+  static thread_local absl::flat_hash_map<std::string, std::string> cache;
+
+  const auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+
+  std::string formatted = properCase(key);
+  if (cache.size() < MaxCachedKeys) {
+    cache.emplace(std::string(key), formatted);
+  }
+  return formatted;
+}
+
 } // namespace Http1
 } // namespace Http
 } // namespace Envoy
@@ -200,6 +200,11 @@ void ConnectionImpl::ServerStreamImpl::destroy() {
   StreamImpl::destroy();
 }
 
+// Headers are handed to the adapter as name/value pairs; all HPACK processing (indexing,
+// Huffman coding, dynamic table management) happens inside nghttp2/oghttp2. Pre-encoded or
+// cross-connection encoder state cannot be supplied here: RFC 7541 dynamic tables are strictly
+// per-connection and are synchronized with the peer through the byte stream, so seeding an
+// encoder with entries the peer never decoded would desynchronize the connection.
 static void insertHeader(std::vector<nghttp2_nv>& headers, const HeaderEntry& header) {
   uint8_t flags = 0;
   if (header.key().isReference()) {
@@ -674,7 +679,11 @@ bool ConnectionImpl::StreamDataFrameSource::Send(absl::string_view frame_header,
                                                  size_t payload_length) {
   stream_.parent_.protocol_constraints_.incrementOutboundDataFrameCount();
 
-  Buffer::OwnedImpl output;
+  // With batched frame writes DATA frames join the connection-wide burst flushed by
+  // sendPendingFrames(); otherwise each frame is written to the connection on its own.
+  Buffer::OwnedImpl local_output;
+  Buffer::OwnedImpl& output =
+      stream_.parent_.batch_frame_writes_ ? stream_.parent_.pending_send_output_ : local_output;
   stream_.parent_.addOutboundFrameFragment(
       output, reinterpret_cast<const uint8_t*>(frame_header.data()), frame_header.size());
   if (!stream_.parent_.protocol_constraints_.checkOutboundFrameLimits().ok()) {
@@ -685,7 +694,9 @@ bool ConnectionImpl::StreamDataFrameSource::Send(absl::string_view frame_header,
 
   stream_.parent_.stats_.pending_send_bytes_.sub(payload_length);
   output.move(*stream_.pending_send_data_, payload_length);
-  stream_.parent_.connection_.write(output, false);
+  if (!stream_.parent_.batch_frame_writes_) {
+    stream_.parent_.connection_.write(local_output, false);
+  }
   return true;
 }
 
@@ -860,7 +871,10 @@ ConnectionImpl::ConnectionImpl(Network::Connection& connection, CodecStats& stat
       per_stream_buffer_limit_(http2_options.initial_stream_window_size().value()),
       stream_error_on_invalid_http_messaging_(
           http2_options.override_stream_error_on_invalid_http_message().value()),
-      protocol_constraints_(stats, http2_options), dispatching_(false), raised_goaway_(false),
+      protocol_constraints_(stats, http2_options),
+      batch_frame_writes_(
+          Runtime::runtimeFeatureEnabled("envoy.reloadable_features.http2_batch_frame_writes")),
+      dispatching_(false), raised_goaway_(false),
       random_(random_generator),
       last_received_data_time_(connection_.dispatcher().timeSource().monotonicTime()) {
   if (http2_options.has_use_oghttp2_codec()) {
@@ -1335,6 +1349,12 @@ void ConnectionImpl::addOutboundFrameFragment(Buffer::OwnedImpl& output, const u
 
 ssize_t ConnectionImpl::onSend(const uint8_t* data, size_t length) {
   ENVOY_CONN_LOG(trace, "send data: bytes={}", connection_, length);
+  if (batch_frame_writes_) {
+    // Coalesce with any other frames serialized by the current adapter Send() pass. The burst is
+    // written to the connection in sendPendingFrames() once the pass completes.
+    addOutboundFrameFragment(pending_send_output_, data, length);
+    return length;
+  }
   Buffer::OwnedImpl buffer;
   addOutboundFrameFragment(buffer, data, length);
 
@@ -1511,6 +1531,17 @@ Status ConnectionImpl::sendPendingFrames() {
   }
 
   const int rc = adapter_->Send();
+
+  // When batching is enabled every frame serialized by the Send() call above was coalesced into
+  // pending_send_output_, so a multiplexed burst reaches the network (and any TLS transport
+  // socket) as a single large write within the same dispatcher iteration instead of one write
+  // per frame. The flush happens even if Send() failed so that frames serialized before the
+  // failure are still delivered, matching the per-frame write path. The lifetime note in
+  // onSend() about the connection's write_buffer_ applies here as well.
+  if (pending_send_output_.length() > 0) {
+    connection_.write(pending_send_output_, false);
+  }
+
   if (rc != 0) {
     ASSERT(rc == NGHTTP2_ERR_CALLBACK_FAILURE);
     return codecProtocolError(nghttp2_strerror(rc));
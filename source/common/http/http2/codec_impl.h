@@ -661,6 +661,11 @@ protected:
   bool is_outbound_flood_monitored_control_frame_ = 0;
   ProtocolConstraints protocol_constraints_;
 
+  // True if all frames serialized by a single adapter Send() pass are coalesced into one
+  // connection write instead of one write per frame. Latched from
+  // `envoy.reloadable_features.http2_batch_frame_writes`.
+  const bool batch_frame_writes_;
+
   // For the flood mitigation to work the onSend callback must be called once for each outbound
   // frame. This is what the nghttp2 library is doing, however this is not documented. The
   // Http2FloodMitigationTest.* tests in test/integration/http2_integration_test.cc will break if
@@ -722,6 +727,10 @@ private:
   // remove streams from the map when they are closed in order to avoid calls to resetStreamWorker
   // after the stream has been removed from the active list.
   std::map<int32_t, StreamImpl*> pending_deferred_reset_streams_;
+  // Coalesces the frames serialized by a single adapter Send() pass when batch_frame_writes_ is
+  // enabled. Both onSend() and StreamDataFrameSource::Send() append here and
+  // sendPendingFrames() hands the whole burst to the network as one write.
+  Buffer::OwnedImpl pending_send_output_;
   bool dispatching_ : 1;
   bool raised_goaway_ : 1;
   Event::SchedulableCallbackPtr protocol_constraint_violation_callback_;
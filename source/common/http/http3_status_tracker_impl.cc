@@ -1,5 +1,7 @@
 #include "source/common/http/http3_status_tracker_impl.h"
 
+#include <algorithm>
+
 namespace Envoy {
 namespace Http {
 
@@ -11,8 +13,11 @@ const std::chrono::minutes DefaultExpirationTime{5};
 const int MaxConsecutiveBrokenCount = 8;
 } // namespace
 
-Http3StatusTrackerImpl::Http3StatusTrackerImpl(Event::Dispatcher& dispatcher)
-    : expiration_timer_(dispatcher.createTimer([this]() -> void { onExpirationTimeout(); })) {}
+Http3StatusTrackerImpl::Http3StatusTrackerImpl(Event::Dispatcher& dispatcher,
+                                               StateChangedCallback state_changed_callback)
+    : dispatcher_(dispatcher),
+      expiration_timer_(dispatcher.createTimer([this]() -> void { onExpirationTimeout(); })),
+      state_changed_callback_(std::move(state_changed_callback)) {}
 
 bool Http3StatusTrackerImpl::isHttp3Broken() const { return state_ == State::Broken; }
 
@@ -27,12 +32,14 @@ void Http3StatusTrackerImpl::markHttp3Broken() {
   if (!expiration_timer_->enabled()) {
     std::chrono::minutes expiration_in_min =
         DefaultExpirationTime * (1 << consecutive_broken_count_);
+    broken_until_ = dispatcher_.timeSource().monotonicTime() + expiration_in_min;
     expiration_timer_->enableTimer(
         std::chrono::duration_cast<std::chrono::milliseconds>(expiration_in_min));
     if (consecutive_broken_count_ < MaxConsecutiveBrokenCount) {
       ++consecutive_broken_count_;
     }
   }
+  notifyStateChanged();
 }
 
 void Http3StatusTrackerImpl::markHttp3Confirmed() {
@@ -41,15 +48,40 @@ void Http3StatusTrackerImpl::markHttp3Confirmed() {
   if (expiration_timer_->enabled()) {
     expiration_timer_->disableTimer();
   }
+  notifyStateChanged();
 }
 
-void Http3StatusTrackerImpl::markHttp3FailedRecently() { state_ = State::FailedRecently; }
+void Http3StatusTrackerImpl::markHttp3FailedRecently() {
+  state_ = State::FailedRecently;
+  notifyStateChanged();
+}
+
+void Http3StatusTrackerImpl::restoreBrokenState(MonotonicTime broken_until,
+                                                int consecutive_broken_count) {
+  consecutive_broken_count_ = std::min(consecutive_broken_count, MaxConsecutiveBrokenCount);
+  const MonotonicTime now = dispatcher_.timeSource().monotonicTime();
+  if (broken_until <= now) {
+    // The broken period has already elapsed; only the backoff history is kept.
+    return;
+  }
+  state_ = State::Broken;
+  broken_until_ = broken_until;
+  expiration_timer_->enableTimer(
+      std::chrono::duration_cast<std::chrono::milliseconds>(broken_until - now));
+}
 
 void Http3StatusTrackerImpl::onExpirationTimeout() {
   if (state_ != State::Broken) {
     return;
   }
   state_ = State::FailedRecently;
+  notifyStateChanged();
+}
+
+void Http3StatusTrackerImpl::notifyStateChanged() {
+  if (state_changed_callback_ != nullptr) {
+    state_changed_callback_();
+  }
 }
 
 } // namespace Http
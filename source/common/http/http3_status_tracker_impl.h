@@ -13,7 +13,12 @@ namespace Http {
 // subject to exponential backoff.
 class Http3StatusTrackerImpl : public HttpServerPropertiesCache::Http3StatusTracker {
 public:
-  explicit Http3StatusTrackerImpl(Event::Dispatcher& dispatcher);
+  // Called whenever the tracked status changes, e.g. so the owning cache can flush the new
+  // status to its key value store.
+  using StateChangedCallback = std::function<void()>;
+
+  explicit Http3StatusTrackerImpl(Event::Dispatcher& dispatcher,
+                                  StateChangedCallback state_changed_callback = nullptr);
 
   // Returns true if HTTP/3 is broken.
   bool isHttp3Broken() const override;
@@ -28,6 +33,14 @@ public:
   // Marks HTTP/3 as failed recently.
   void markHttp3FailedRecently() override;
 
+  // The time at which the current broken period expires. Only meaningful while isHttp3Broken().
+  MonotonicTime brokenUntil() const { return broken_until_; }
+  // The number of consecutive times HTTP/3 has been marked broken.
+  int consecutiveBrokenCount() const { return consecutive_broken_count_; }
+  // Restores broken state loaded from a cache: if |broken_until| is still in the future HTTP/3
+  // is marked broken until then, otherwise only the backoff history is kept.
+  void restoreBrokenState(MonotonicTime broken_until, int consecutive_broken_count);
+
 private:
   enum class State {
     Pending,
@@ -39,11 +52,18 @@ private:
   // Called when the expiration timer fires.
   void onExpirationTimeout();
 
+  // Invokes the state changed callback, if one is set.
+  void notifyStateChanged();
+
+  Event::Dispatcher& dispatcher_;
   State state_{State::Pending};
   // The number of consecutive times HTTP/3 has been marked broken.
   int consecutive_broken_count_{};
+  // The time at which the current broken period expires, if HTTP/3 is broken.
+  MonotonicTime broken_until_{};
   // The timer which tracks when HTTP/3 broken status should expire
   Event::TimerPtr expiration_timer_;
+  StateChangedCallback state_changed_callback_;
 };
 
 } // namespace Http
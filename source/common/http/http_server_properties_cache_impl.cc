@@ -20,6 +20,34 @@ struct RegexHolder {
 
 using ConstRegexHolder = ConstSingleton<RegexHolder>;
 
+// The HTTP/3 status of a cached entry, parsed from its optional h3_status field.
+struct CachedHttp3Status {
+  // True if HTTP/3 was confirmed working, in which case the broken fields are unused.
+  bool confirmed{false};
+  // The absolute time from the epoch at which the broken period expires.
+  int64_t broken_until_s{0};
+  // The number of consecutive times HTTP/3 was marked broken.
+  int32_t consecutive_broken_count{0};
+};
+
+// Parses the h3_status field of a cached entry, or returns absl::nullopt if it
+// is malformed.
+absl::optional<CachedHttp3Status> cachedHttp3StatusFromString(absl::string_view status) {
+  CachedHttp3Status parsed;
+  if (status == "confirmed") {
+    parsed.confirmed = true;
+    return parsed;
+  }
+  const std::vector<absl::string_view> parts = absl::StrSplit(status, ';');
+  if (parts.size() == 3 && parts[0] == "broken" &&
+      absl::SimpleAtoi(parts[1], &parsed.broken_until_s) &&
+      absl::SimpleAtoi(parts[2], &parsed.consecutive_broken_count) &&
+      parsed.consecutive_broken_count >= 0) {
+    return parsed;
+  }
+  return {};
+}
+
 } // namespace
 
 std::string
@@ -58,6 +86,24 @@ std::string HttpServerPropertiesCacheImpl::originDataToStringForCache(const Orig
     }
   }
   absl::StrAppend(&value, "|", data.srtt.count(), "|", data.concurrent_streams);
+  if (data.h3_status_tracker != nullptr) {
+    if (data.h3_status_tracker->isHttp3Confirmed()) {
+      absl::StrAppend(&value, "|confirmed");
+    } else if (data.h3_status_tracker->isHttp3Broken()) {
+      // The broken expiry and backoff count are only known for the concrete tracker
+      // implementation; other trackers serialize without HTTP/3 status.
+      const auto* tracker =
+          dynamic_cast<const Http3StatusTrackerImpl*>(data.h3_status_tracker.get());
+      if (tracker != nullptr) {
+        // As with ma= above, the expiry is serialized as absolute time from the epoch.
+        absl::StrAppend(&value, "|broken;",
+                        std::chrono::duration_cast<std::chrono::seconds>(
+                            tracker->brokenUntil().time_since_epoch())
+                            .count(),
+                        ";", tracker->consecutiveBrokenCount());
+      }
+    }
+  }
   return value;
 }
 
@@ -65,7 +111,12 @@ absl::optional<HttpServerPropertiesCacheImpl::OriginData>
 HttpServerPropertiesCacheImpl::originDataFromString(absl::string_view origin_data_string,
                                                     TimeSource& time_source, bool from_cache) {
   const std::vector<absl::string_view> parts = absl::StrSplit(origin_data_string, '|');
-  if (parts.size() != 3) {
+  // The HTTP/3 status field is optional. It requires a dispatcher to turn into a
+  // tracker, so it is only validated here; the cache constructor rebuilds the tracker.
+  if (parts.size() != 3 && parts.size() != 4) {
+    return {};
+  }
+  if (parts.size() == 4 && !cachedHttp3StatusFromString(parts[3]).has_value()) {
     return {};
   }
 
@@ -134,7 +185,12 @@ HttpServerPropertiesCacheImpl::HttpServerPropertiesCacheImpl(
         if (origin_data->protocols.has_value()) {
           protocols = *origin_data->protocols;
         }
-        OriginDataWithOptRef data(protocols, origin_data->srtt, nullptr,
+        Http3StatusTrackerPtr tracker;
+        const std::vector<absl::string_view> parts = absl::StrSplit(value, '|');
+        if (parts.size() == 4) {
+          tracker = http3StatusTrackerFromCachedString(*origin, parts[3]);
+        }
+        OriginDataWithOptRef data(protocols, origin_data->srtt, std::move(tracker),
                                   origin_data->concurrent_streams);
         setPropertiesImpl(*origin, data);
       } else {
@@ -283,17 +339,53 @@ HttpServerPropertiesCacheImpl::getOrCreateHttp3StatusTracker(const Origin& origi
   auto entry_it = protocols_.find(origin);
   if (entry_it != protocols_.end()) {
     if (entry_it->second.h3_status_tracker == nullptr) {
-      entry_it->second.h3_status_tracker = std::make_unique<Http3StatusTrackerImpl>(dispatcher_);
+      entry_it->second.h3_status_tracker = createHttp3StatusTracker(origin);
     }
     return *entry_it->second.h3_status_tracker;
   }
 
   OriginDataWithOptRef data;
-  data.h3_status_tracker = std::make_unique<Http3StatusTrackerImpl>(dispatcher_);
+  data.h3_status_tracker = createHttp3StatusTracker(origin);
   auto it = setPropertiesImpl(origin, data);
   return *it->second.h3_status_tracker;
 }
 
+std::unique_ptr<Http3StatusTrackerImpl>
+HttpServerPropertiesCacheImpl::createHttp3StatusTracker(const Origin& origin) {
+  return std::make_unique<Http3StatusTrackerImpl>(
+      dispatcher_, [this, origin]() { onHttp3StatusChanged(origin); });
+}
+
+Http3StatusTrackerPtr
+HttpServerPropertiesCacheImpl::http3StatusTrackerFromCachedString(const Origin& origin,
+                                                                  absl::string_view status) {
+  absl::optional<CachedHttp3Status> parsed = cachedHttp3StatusFromString(status);
+  if (!parsed.has_value()) {
+    // originDataFromString already validated the status field.
+    return nullptr;
+  }
+  auto tracker = createHttp3StatusTracker(origin);
+  if (parsed->confirmed) {
+    tracker->markHttp3Confirmed();
+  } else {
+    tracker->restoreBrokenState(MonotonicTime(std::chrono::seconds(parsed->broken_until_s)),
+                                parsed->consecutive_broken_count);
+  }
+  return tracker;
+}
+
+void HttpServerPropertiesCacheImpl::onHttp3StatusChanged(const Origin& origin) {
+  if (!key_value_store_) {
+    return;
+  }
+  auto entry_it = protocols_.find(origin);
+  if (entry_it == protocols_.end()) {
+    return;
+  }
+  key_value_store_->addOrUpdate(originToString(origin), originDataToStringForCache(entry_it->second),
+                                absl::nullopt);
+}
+
 absl::string_view HttpServerPropertiesCacheImpl::getCanonicalSuffix(absl::string_view hostname) {
   for (const std::string& suffix : canonical_suffixes_) {
     if (absl::EndsWith(hostname, suffix)) {
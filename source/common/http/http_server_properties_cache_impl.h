@@ -64,7 +64,9 @@ public:
   // This function also does not do standards-required normalization. Entries requiring
   // normalization will simply not be read from cache.
   // The string format is:
-  // protocols|rtt
+  // protocols|rtt|concurrent_streams[|h3_status]
+  // where h3_status is only present when HTTP/3 is confirmed ("confirmed") or
+  // broken ("broken;<expiry_from_epoch_s>;<consecutive_broken_count>").
   static std::string originDataToStringForCache(const OriginData& data);
   // Parse an origin data into structured data, or absl::nullopt
   // if it is empty or invalid.
@@ -142,6 +144,19 @@ private:
   // If `origin` matches a canonical suffix then updates canonical_alt_svc_map_ accordingly.
   void maybeSetCanonicalOrigin(const Origin& origin);
 
+  // Creates an HTTP/3 status tracker for `origin` which flushes status changes to the
+  // key value store.
+  std::unique_ptr<Http3StatusTrackerImpl> createHttp3StatusTracker(const Origin& origin);
+
+  // Rebuilds an HTTP/3 status tracker for `origin` from the serialized h3_status field of a
+  // cached entry, or nullptr if the field cannot be parsed.
+  Http3StatusTrackerPtr http3StatusTrackerFromCachedString(const Origin& origin,
+                                                           absl::string_view status);
+
+  // Flushes the current state of `origin` to the key value store, if any. Invoked by the
+  // origin's HTTP/3 status tracker whenever its state changes.
+  void onHttp3StatusChanged(const Origin& origin);
+
   // The key value store, if flushing to persistent storage.
   std::unique_ptr<KeyValueStore> key_value_store_;
 
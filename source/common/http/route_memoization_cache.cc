@@ -0,0 +1,53 @@
+#include "source/common/http/route_memoization_cache.h"
+
+#include "absl/strings/str_cat.h"
+
+namespace Envoy {
+namespace Http {
+
+std::string RouteMemoizationCache::makeKey(const RequestHeaderMap& headers) {
+  // A newline cannot appear in a header value, so it is a safe separator.
+  return absl::StrCat(headers.getMethodValue(), "\n", headers.getHostValue(), "\n",
+                      headers.getPathValue());
+}
+
+Router::RouteConstSharedPtr
+RouteMemoizationCache::lookup(const Router::ConfigConstSharedPtr& config,
+                              const RequestHeaderMap& headers) {
+  const auto it = index_.find(makeKey(headers));
+  if (it == index_.end()) {
+    return nullptr;
+  }
+  Entry& entry = *it->second;
+  Router::RouteConstSharedPtr route = entry.route_.lock();
+  if (entry.config_.lock() != config || route == nullptr) {
+    // The entry was produced by a configuration that has since been replaced.
+    remove(it->second);
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return route;
+}
+
+void RouteMemoizationCache::insert(const Router::ConfigConstSharedPtr& config,
+                                   const RequestHeaderMap& headers,
+                                   const Router::RouteConstSharedPtr& route) {
+  std::string key = makeKey(headers);
+  const auto it = index_.find(key);
+  if (it != index_.end()) {
+    remove(it->second);
+  }
+  if (entries_.size() >= max_entries_) {
+    remove(std::prev(entries_.end()));
+  }
+  entries_.push_front(Entry{std::move(key), config, route});
+  index_[absl::string_view(entries_.front().key_)] = entries_.begin();
+}
+
+void RouteMemoizationCache::remove(EntryList::iterator it) {
+  index_.erase(absl::string_view(it->key_));
+  entries_.erase(it);
+}
+
+} // namespace Http
+} // namespace Envoy
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "envoy/http/header_map.h"
+#include "envoy/router/router.h"
+
+#include "absl/container/flat_hash_map.h"
+
+namespace Envoy {
+namespace Http {
+
+/**
+ * Per-connection memoization of route-match results, keyed on the request's :method, :authority
+ * and :path together with the identity of the route configuration that produced the route. Only
+ * consulted when the active configuration reports Router::Config::supportsRouteMemoization(),
+ * i.e. when route resolution is a pure function of those three headers. An RDS or VHDS update
+ * installs a new configuration object, so entries produced by a replaced configuration simply
+ * stop matching and are dropped on their next lookup or eviction; the cache holds only weak
+ * references and never extends the lifetime of a replaced configuration.
+ */
+class RouteMemoizationCache {
+public:
+  explicit RouteMemoizationCache(size_t max_entries) : max_entries_(max_entries) {}
+
+  /**
+   * @return the memoized route for config and headers, or nullptr if the key was never inserted
+   *         or the entry was produced by a different configuration object.
+   */
+  Router::RouteConstSharedPtr lookup(const Router::ConfigConstSharedPtr& config,
+                                     const RequestHeaderMap& headers);
+
+  /**
+   * Memoizes route under config and headers, evicting the least recently used entry when the
+   * cache is full.
+   */
+  void insert(const Router::ConfigConstSharedPtr& config, const RequestHeaderMap& headers,
+              const Router::RouteConstSharedPtr& route);
+
+private:
+  struct Entry {
+    std::string key_;
+    std::weak_ptr<const Router::Config> config_;
+    std::weak_ptr<const Router::Route> route_;
+  };
+  using EntryList = std::list<Entry>;
+
+  static std::string makeKey(const RequestHeaderMap& headers);
+  void remove(EntryList::iterator it);
+
+  // Most recently used entries first. The index views the key strings owned by the list entries;
+  // list nodes are stable under splice and erase, so the views stay valid.
+  EntryList entries_;
+  absl::flat_hash_map<absl::string_view, EntryList::iterator> index_;
+  const size_t max_entries_;
+};
+
+} // namespace Http
+} // namespace Envoy
@@ -16,6 +16,12 @@ namespace Init {
  * Init::ManagerImpl coordinates initialization of one or more "targets." See comments in
  * include/envoy/init/manager.h for an overview.
  *
+ * Note that initialization is not serialized across targets: initialize() starts every registered
+ * target before waiting on any of them, and the manager merely counts ready callbacks. Targets
+ * with no mutual dependency (for example many SDS secret subscriptions sharing one manager)
+ * therefore initialize concurrently; ordering between stages of server startup is imposed by the
+ * callers that chain separate managers, not by this class.
+ *
  * When the logging level is set to "debug" or "trace," the log will contain entries for all
  * significant events in the initialization flow:
  *
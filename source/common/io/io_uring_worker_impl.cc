@@ -1,8 +1,22 @@
 #include "source/common/io/io_uring_worker_impl.h"
 
+#include "source/common/api/os_sys_calls_impl.h"
+
 namespace Envoy {
 namespace Io {
 
+ReadRequest::ReadRequest(IoUringSocket& socket, uint32_t size)
+    : Request(RequestType::Read, socket), buf_(new uint8_t[size]),
+      iov_(new struct iovec{buf_.get(), size}) {}
+
+WriteRequest::WriteRequest(IoUringSocket& socket, const Buffer::RawSliceVector& slices)
+    : Request(RequestType::Write, socket), iov_(new struct iovec[slices.size()]) {
+  for (size_t i = 0; i < slices.size(); i++) {
+    iov_[i].iov_base = slices[i].mem_;
+    iov_[i].iov_len = slices[i].len_;
+  }
+}
+
 IoUringSocketEntry::IoUringSocketEntry(os_fd_t fd, IoUringWorkerImpl& parent)
     : fd_(fd), parent_(parent) {}
 
@@ -47,6 +61,107 @@ IoUringWorkerImpl::~IoUringWorkerImpl() {
 
 Event::Dispatcher& IoUringWorkerImpl::dispatcher() { return dispatcher_; }
 
+IoUringSocket& IoUringWorkerImpl::addAcceptSocket(os_fd_t fd, IoUringHandler& handler) {
+  ENVOY_LOG(trace, "add accept socket, fd = {}", fd);
+  // Kept small; each completed accept re-arms itself so the ring never runs dry of
+  // accept requests under load.
+  static constexpr uint32_t DefaultAcceptSize = 5;
+  return addSocket(std::make_unique<IoUringAcceptSocket>(fd, *this, handler, DefaultAcceptSize));
+}
+
+IoUringSocket& IoUringWorkerImpl::addServerSocket(os_fd_t fd, IoUringHandler& handler,
+                                                  uint32_t read_buffer_size) {
+  ENVOY_LOG(trace, "add server socket, fd = {}", fd);
+  return addSocket(std::make_unique<IoUringServerSocket>(fd, *this, handler, read_buffer_size));
+}
+
+Request* IoUringWorkerImpl::submitAcceptRequest(IoUringSocket& socket) {
+  AcceptRequest* req = new AcceptRequest(socket);
+
+  ENVOY_LOG(trace, "submit accept request, fd = {}, req = {}", socket.fd(), fmt::ptr(req));
+
+  auto res = io_uring_->prepareAccept(
+      socket.fd(), reinterpret_cast<struct sockaddr*>(&req->remote_addr_), &req->remote_addr_len_,
+      req);
+  if (res == IoUringResult::Failed) {
+    // Fall back to posting the prepared entries and trying again.
+    submit();
+    res = io_uring_->prepareAccept(socket.fd(),
+                                   reinterpret_cast<struct sockaddr*>(&req->remote_addr_),
+                                   &req->remote_addr_len_, req);
+    RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare accept");
+  }
+  submit();
+  return req;
+}
+
+Request* IoUringWorkerImpl::submitReadRequest(IoUringSocket& socket, uint32_t size) {
+  ReadRequest* req = new ReadRequest(socket, size);
+
+  ENVOY_LOG(trace, "submit read request, fd = {}, req = {}", socket.fd(), fmt::ptr(req));
+
+  auto res = io_uring_->prepareReadv(socket.fd(), req->iov_.get(), 1, 0, req);
+  if (res == IoUringResult::Failed) {
+    // Fall back to posting the prepared entries and trying again.
+    submit();
+    res = io_uring_->prepareReadv(socket.fd(), req->iov_.get(), 1, 0, req);
+    RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare readv");
+  }
+  submit();
+  return req;
+}
+
+Request* IoUringWorkerImpl::submitWriteRequest(IoUringSocket& socket,
+                                               const Buffer::RawSliceVector& slices) {
+  WriteRequest* req = new WriteRequest(socket, slices);
+
+  ENVOY_LOG(trace, "submit write request, fd = {}, req = {}", socket.fd(), fmt::ptr(req));
+
+  auto res = io_uring_->prepareWritev(socket.fd(), req->iov_.get(), slices.size(), 0, req);
+  if (res == IoUringResult::Failed) {
+    // Fall back to posting the prepared entries and trying again.
+    submit();
+    res = io_uring_->prepareWritev(socket.fd(), req->iov_.get(), slices.size(), 0, req);
+    RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare writev");
+  }
+  submit();
+  return req;
+}
+
+Request* IoUringWorkerImpl::submitCancelRequest(IoUringSocket& socket,
+                                                Request* request_to_cancel) {
+  Request* req = new Request(Request::RequestType::Cancel, socket);
+
+  ENVOY_LOG(trace, "submit cancel request, fd = {}, canceling req = {}", socket.fd(),
+            fmt::ptr(request_to_cancel));
+
+  auto res = io_uring_->prepareCancel(request_to_cancel, req);
+  if (res == IoUringResult::Failed) {
+    // Fall back to posting the prepared entries and trying again.
+    submit();
+    res = io_uring_->prepareCancel(request_to_cancel, req);
+    RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare cancel");
+  }
+  submit();
+  return req;
+}
+
+Request* IoUringWorkerImpl::submitCloseRequest(IoUringSocket& socket) {
+  Request* req = new Request(Request::RequestType::Close, socket);
+
+  ENVOY_LOG(trace, "submit close request, fd = {}, req = {}", socket.fd(), fmt::ptr(req));
+
+  auto res = io_uring_->prepareClose(socket.fd(), req);
+  if (res == IoUringResult::Failed) {
+    // Fall back to posting the prepared entries and trying again.
+    submit();
+    res = io_uring_->prepareClose(socket.fd(), req);
+    RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare close");
+  }
+  submit();
+  return req;
+}
+
 IoUringSocketEntry& IoUringWorkerImpl::addSocket(IoUringSocketEntryPtr&& socket) {
   LinkedList::moveIntoListBack(std::move(socket), sockets_);
   return *sockets_.back();
@@ -123,5 +238,172 @@ void IoUringWorkerImpl::submit() {
   }
 }
 
+IoUringAcceptSocket::IoUringAcceptSocket(os_fd_t fd, IoUringWorkerImpl& parent,
+                                         IoUringHandler& handler, uint32_t accept_size)
+    : IoUringSocketEntry(fd, parent), handler_(handler), accept_size_(accept_size) {
+  submitRequests();
+}
+
+void IoUringAcceptSocket::close() {
+  ENVOY_LOG(trace, "close the accept socket, fd = {}", fd_);
+  closed_ = true;
+  if (requests_.empty()) {
+    parent_.submitCloseRequest(*this);
+    return;
+  }
+  // The close is submitted once the canceled accept requests have completed.
+  for (Request* req : requests_) {
+    parent_.submitCancelRequest(*this, req);
+  }
+}
+
+void IoUringAcceptSocket::onAccept(Request* req, int32_t result, bool injected) {
+  IoUringSocketEntry::onAccept(req, result, injected);
+  ENVOY_LOG(trace, "onAccept with result {}, fd = {}, injected = {}", result, fd_, injected);
+  ASSERT(!injected);
+  requests_.erase(req);
+
+  if (closed_) {
+    // A connection accepted in the window between close() and the cancel completing
+    // still has to be closed.
+    if (result >= 0) {
+      Api::OsSysCallsSingleton::get().close(result);
+    }
+    if (requests_.empty()) {
+      parent_.submitCloseRequest(*this);
+    }
+    return;
+  }
+
+  // Re-arm the completed request to keep accept_size_ requests on the ring.
+  submitRequests();
+
+  if (result >= 0) {
+    AcceptRequest* accept_req = static_cast<AcceptRequest*>(req);
+    AcceptedSocketParam param{result, &accept_req->remote_addr_, accept_req->remote_addr_len_};
+    handler_.onAcceptSocket(param);
+  }
+}
+
+void IoUringAcceptSocket::onCancel(Request* req, int32_t result, bool injected) {
+  IoUringSocketEntry::onCancel(req, result, injected);
+  ENVOY_LOG(trace, "onCancel with result {}, fd = {}", result, fd_);
+}
+
+void IoUringAcceptSocket::onClose(Request* req, int32_t result, bool injected) {
+  IoUringSocketEntry::onClose(req, result, injected);
+  ENVOY_LOG(trace, "onClose with result {}, fd = {}", result, fd_);
+  cleanup();
+}
+
+void IoUringAcceptSocket::submitRequests() {
+  while (requests_.size() < accept_size_) {
+    requests_.insert(parent_.submitAcceptRequest(*this));
+  }
+}
+
+IoUringServerSocket::IoUringServerSocket(os_fd_t fd, IoUringWorkerImpl& parent,
+                                         IoUringHandler& handler, uint32_t read_buffer_size)
+    : IoUringSocketEntry(fd, parent), handler_(handler), read_buffer_size_(read_buffer_size) {
+  submitReadRequest();
+}
+
+void IoUringServerSocket::close() {
+  ENVOY_LOG(trace, "close the server socket, fd = {}", fd_);
+  closed_ = true;
+  if (read_req_ != nullptr) {
+    parent_.submitCancelRequest(*this, read_req_);
+  }
+  closeIfDrained();
+}
+
+void IoUringServerSocket::write(Buffer::Instance& data) {
+  ASSERT(!closed_);
+  ENVOY_LOG(trace, "write {} bytes, fd = {}", data.length(), fd_);
+  write_buf_.move(data);
+  if (write_req_ == nullptr) {
+    submitWriteRequest();
+  }
+}
+
+void IoUringServerSocket::onRead(Request* req, int32_t result, bool injected) {
+  IoUringSocketEntry::onRead(req, result, injected);
+  ENVOY_LOG(trace, "onRead with result {}, fd = {}, injected = {}", result, fd_, injected);
+  ASSERT(!injected);
+  read_req_ = nullptr;
+
+  if (closed_) {
+    closeIfDrained();
+    return;
+  }
+
+  if (result > 0) {
+    read_buf_.add(static_cast<ReadRequest*>(req)->buf_.get(), result);
+    // Re-arm the read before notifying the handler to keep data flowing from the
+    // kernel while the handler processes the gathered buffer.
+    submitReadRequest();
+  }
+
+  // result == 0 signals the remote close; negative results are delivered as-is so the
+  // handler can map them to the matching error behavior.
+  ReadParam param{read_buf_, result};
+  handler_.onRead(param);
+}
+
+void IoUringServerSocket::onWrite(Request* req, int32_t result, bool injected) {
+  IoUringSocketEntry::onWrite(req, result, injected);
+  ENVOY_LOG(trace, "onWrite with result {}, fd = {}, injected = {}", result, fd_, injected);
+  ASSERT(!injected);
+  write_req_ = nullptr;
+
+  if (result > 0) {
+    write_buf_.drain(result);
+  }
+
+  if (closed_) {
+    closeIfDrained();
+    return;
+  }
+
+  if (write_buf_.length() > 0) {
+    submitWriteRequest();
+  }
+
+  WriteParam param{result};
+  handler_.onWrite(param);
+}
+
+void IoUringServerSocket::onCancel(Request* req, int32_t result, bool injected) {
+  IoUringSocketEntry::onCancel(req, result, injected);
+  ENVOY_LOG(trace, "onCancel with result {}, fd = {}", result, fd_);
+}
+
+void IoUringServerSocket::onClose(Request* req, int32_t result, bool injected) {
+  IoUringSocketEntry::onClose(req, result, injected);
+  ENVOY_LOG(trace, "onClose with result {}, fd = {}", result, fd_);
+  cleanup();
+}
+
+void IoUringServerSocket::submitReadRequest() {
+  ASSERT(read_req_ == nullptr);
+  read_req_ = parent_.submitReadRequest(*this, read_buffer_size_);
+}
+
+void IoUringServerSocket::submitWriteRequest() {
+  ASSERT(write_req_ == nullptr);
+  ASSERT(write_buf_.length() > 0);
+  Buffer::RawSliceVector slices = write_buf_.getRawSlices();
+  write_req_ = parent_.submitWriteRequest(*this, slices);
+}
+
+void IoUringServerSocket::closeIfDrained() {
+  ASSERT(closed_);
+  if (read_req_ == nullptr && write_req_ == nullptr && !close_submitted_) {
+    close_submitted_ = true;
+    parent_.submitCloseRequest(*this);
+  }
+}
+
 } // namespace Io
 } // namespace Envoy
+
@@ -2,15 +2,46 @@
 
 #include "envoy/common/io/io_uring.h"
 
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/common/assert.h"
 #include "source/common/common/linked_object.h"
 #include "source/common/io/io_uring_impl.h"
 
+#include "absl/container/flat_hash_set.h"
+
 namespace Envoy {
 namespace Io {
 
 class IoUringSocketEntry;
 using IoUringSocketEntryPtr = std::unique_ptr<IoUringSocketEntry>;
 
+// A request for an accept operation. The remote address storage has to live as long
+// as the request is on the ring.
+class AcceptRequest : public Request {
+public:
+  AcceptRequest(IoUringSocket& socket) : Request(RequestType::Accept, socket) {}
+
+  struct sockaddr_storage remote_addr_ {};
+  socklen_t remote_addr_len_{sizeof(remote_addr_)};
+};
+
+// A request for a read operation, owning the buffer the kernel reads into.
+class ReadRequest : public Request {
+public:
+  ReadRequest(IoUringSocket& socket, uint32_t size);
+
+  std::unique_ptr<uint8_t[]> buf_;
+  std::unique_ptr<struct iovec> iov_;
+};
+
+// A request for a write operation, owning the iovecs pointing at the data being written.
+class WriteRequest : public Request {
+public:
+  WriteRequest(IoUringSocket& socket, const Buffer::RawSliceVector& slices);
+
+  std::unique_ptr<struct iovec[]> iov_;
+};
+
 class IoUringWorkerImpl : public IoUringWorker, private Logger::Loggable<Logger::Id::io> {
 public:
   IoUringWorkerImpl(uint32_t io_uring_size, bool use_submission_queue_polling,
@@ -19,6 +50,9 @@ public:
   ~IoUringWorkerImpl() override;
 
   // IoUringWorker
+  IoUringSocket& addAcceptSocket(os_fd_t fd, IoUringHandler& handler) override;
+  IoUringSocket& addServerSocket(os_fd_t fd, IoUringHandler& handler,
+                                 uint32_t read_buffer_size) override;
   Event::Dispatcher& dispatcher() override;
 
   // Remove a socket from this worker.
@@ -30,6 +64,14 @@ public:
   // Return the number of sockets in this worker.
   size_t getNumOfSockets() const { return sockets_.size(); }
 
+  // Submit requests for a specific socket. On submission queue overflow the pending
+  // entries are flushed to the kernel and the preparation is retried once.
+  Request* submitAcceptRequest(IoUringSocket& socket);
+  Request* submitReadRequest(IoUringSocket& socket, uint32_t size);
+  Request* submitWriteRequest(IoUringSocket& socket, const Buffer::RawSliceVector& slices);
+  Request* submitCancelRequest(IoUringSocket& socket, Request* request_to_cancel);
+  Request* submitCloseRequest(IoUringSocket& socket);
+
 protected:
   // Add a socket to the worker.
   IoUringSocketEntry& addSocket(IoUringSocketEntryPtr&& socket);
@@ -97,6 +139,9 @@ public:
     }
   }
   void injectCompletion(Request::RequestType type) override;
+  // Sockets with pending requests must override this to cancel them first.
+  void close() override { cleanup(); }
+  void write(Buffer::Instance&) override { PANIC("not implemented"); }
 
 protected:
   /**
@@ -111,5 +156,64 @@ protected:
   uint8_t injected_completions_{0};
 };
 
+// A socket accepting connections through the ring. Multiple accept requests are kept on
+// the ring and each one is re-armed as it completes, which keeps accepts flowing without
+// a per-connection submit round trip. (The vendored liburing wrapper does not expose
+// multishot accept; the re-armed requests emulate it.)
+class IoUringAcceptSocket : public IoUringSocketEntry {
+public:
+  IoUringAcceptSocket(os_fd_t fd, IoUringWorkerImpl& parent, IoUringHandler& handler,
+                      uint32_t accept_size);
+
+  // IoUringSocket
+  void close() override;
+  void onAccept(Request* req, int32_t result, bool injected) override;
+  void onCancel(Request* req, int32_t result, bool injected) override;
+  void onClose(Request* req, int32_t result, bool injected) override;
+
+private:
+  void submitRequests();
+
+  IoUringHandler& handler_;
+  // The number of accept requests kept on the ring.
+  const uint32_t accept_size_;
+  // The accept requests currently on the ring.
+  absl::flat_hash_set<Request*> requests_;
+  bool closed_{false};
+};
+
+// An accepted connection socket reading and writing through the ring. A read request is
+// kept on the ring and re-armed as it completes, emulating multishot receive; writes are
+// buffered in the socket until their writev requests complete.
+class IoUringServerSocket : public IoUringSocketEntry {
+public:
+  IoUringServerSocket(os_fd_t fd, IoUringWorkerImpl& parent, IoUringHandler& handler,
+                      uint32_t read_buffer_size);
+
+  // IoUringSocket
+  void close() override;
+  void write(Buffer::Instance& data) override;
+  void onRead(Request* req, int32_t result, bool injected) override;
+  void onWrite(Request* req, int32_t result, bool injected) override;
+  void onCancel(Request* req, int32_t result, bool injected) override;
+  void onClose(Request* req, int32_t result, bool injected) override;
+
+private:
+  void submitReadRequest();
+  void submitWriteRequest();
+  void closeIfDrained();
+
+  IoUringHandler& handler_;
+  const uint32_t read_buffer_size_;
+  // Data read through the ring which has not been consumed by the handler yet.
+  Buffer::OwnedImpl read_buf_;
+  // Data submitted through write() which has not been written through the ring yet.
+  Buffer::OwnedImpl write_buf_;
+  Request* read_req_{nullptr};
+  Request* write_req_{nullptr};
+  bool closed_{false};
+  bool close_submitted_{false};
+};
+
 } // namespace Io
 } // namespace Envoy
@@ -54,38 +54,42 @@ Streamer::ArrayPtr Streamer::makeRootArray() {
 
 Streamer::MapPtr Streamer::Level::addMap() {
   ASSERT_THIS_IS_TOP_LEVEL;
-  nextField();
+  const absl::string_view separator = nextField();
+  if (!separator.empty()) {
+    streamer_.addConstantString(separator);
+  }
   return std::make_unique<Map>(streamer_);
 }
 
 Streamer::ArrayPtr Streamer::Level::addArray() {
   ASSERT_THIS_IS_TOP_LEVEL;
-  nextField();
+  const absl::string_view separator = nextField();
+  if (!separator.empty()) {
+    streamer_.addConstantString(separator);
+  }
   return std::make_unique<Array>(streamer_);
 }
 
 void Streamer::Level::addNumber(double number) {
   ASSERT_THIS_IS_TOP_LEVEL;
-  nextField();
-  streamer_.addNumber(number);
+  streamer_.addNumber(nextField(), number);
 }
 
 void Streamer::Level::addNumber(uint64_t number) {
   ASSERT_THIS_IS_TOP_LEVEL;
-  nextField();
-  streamer_.addNumber(number);
+  streamer_.addNumber(nextField(), number);
 }
 
 void Streamer::Level::addNumber(int64_t number) {
   ASSERT_THIS_IS_TOP_LEVEL;
-  nextField();
-  streamer_.addNumber(number);
+  streamer_.addNumber(nextField(), number);
 }
 
 void Streamer::Level::addString(absl::string_view str) {
   ASSERT_THIS_IS_TOP_LEVEL;
-  nextField();
-  streamer_.addSanitized("\"", str, "\"");
+  // The separator, open-quote, sanitized value, and close-quote are emitted
+  // in one buffer write; the separator/quote combinations are static strings.
+  streamer_.addSanitized(nextField().empty() ? "\"" : ",\"", str, "\"");
 }
 
 #ifndef NDEBUG
@@ -97,27 +101,26 @@ void Streamer::pop(Level* level) {
 void Streamer::push(Level* level) { levels_.push(level); }
 #endif
 
-void Streamer::Level::nextField() {
+absl::string_view Streamer::Level::nextField() {
   if (is_first_) {
     is_first_ = false;
-  } else {
-    streamer_.addConstantString(",");
+    return "";
   }
+  return ",";
 }
 
-void Streamer::Map::nextField() {
+absl::string_view Streamer::Map::nextField() {
   if (expecting_value_) {
     expecting_value_ = false;
-  } else {
-    Level::nextField();
+    return "";
   }
+  return Level::nextField();
 }
 
 void Streamer::Map::addKey(absl::string_view key) {
   ASSERT_THIS_IS_TOP_LEVEL;
   ASSERT(!expecting_value_);
-  nextField();
-  streamer_.addSanitized("\"", key, "\":");
+  streamer_.addSanitized(nextField().empty() ? "\"" : ",\"", key, "\":");
   expecting_value_ = true;
 }
 
@@ -154,17 +157,24 @@ void Streamer::Array::addEntries(const Entries& values) {
   }
 }
 
-void Streamer::addNumber(double number) {
+void Streamer::addNumber(absl::string_view separator, double number) {
   if (std::isnan(number)) {
-    response_.addFragments({"null"});
+    response_.addFragments({separator, "null"});
   } else {
+    if (!separator.empty()) {
+      addConstantString(separator);
+    }
     Buffer::Util::serializeDouble(number, response_);
   }
 }
 
-void Streamer::addNumber(uint64_t number) { response_.addFragments({absl::StrCat(number)}); }
+void Streamer::addNumber(absl::string_view separator, uint64_t number) {
+  response_.addFragments({separator, absl::StrCat(number)});
+}
 
-void Streamer::addNumber(int64_t number) { response_.addFragments({absl::StrCat(number)}); }
+void Streamer::addNumber(absl::string_view separator, int64_t number) {
+  response_.addFragments({separator, absl::StrCat(number)});
+}
 
 void Streamer::addSanitized(absl::string_view prefix, absl::string_view str,
                             absl::string_view suffix) {
@@ -87,10 +87,12 @@ public:
 
   protected:
     /**
-     * Initiates a new field, serializing a comma separator if this is not the
-     * first one.
+     * Initiates a new field, returning the separator that must precede it:
+     * a comma if this is not the first entry, otherwise an empty string. The
+     * separator is returned rather than serialized immediately so callers can
+     * emit it in the same buffer write as the field itself.
      */
-    virtual void nextField();
+    virtual absl::string_view nextField();
 
     /**
      * Renders a string or a number in json format. Doubles that are NaN are
@@ -141,7 +143,7 @@ public:
     void addEntries(const Entries& entries);
 
   protected:
-    void nextField() override;
+    absl::string_view nextField() override;
 
   private:
     bool expecting_value_{false};
@@ -191,16 +193,18 @@ private:
 
   /**
    * Takes a raw string, sanitizes it using JSON syntax, surrounds it
-   * with a prefix and suffix, and streams it out.
+   * with a prefix and suffix, and streams it out in a single buffer write.
+   * The sanitized string is copied directly from the sanitizer's output into
+   * the response buffer without further intermediate strings.
    */
   void addSanitized(absl::string_view prefix, absl::string_view token, absl::string_view suffix);
 
   /**
-   * Serializes a number.
+   * Serializes a number, preceded by the provided separator.
    */
-  void addNumber(double d);
-  void addNumber(uint64_t u);
-  void addNumber(int64_t i);
+  void addNumber(absl::string_view separator, double d);
+  void addNumber(absl::string_view separator, uint64_t u);
+  void addNumber(absl::string_view separator, int64_t i);
 
   /**
    * Flushes out any pending fragments.
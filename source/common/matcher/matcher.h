@@ -18,6 +18,8 @@
 #include "source/common/matcher/validation_visitor.h"
 #include "source/common/matcher/value_input_matcher.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
@@ -114,32 +116,74 @@ private:
     const CommonProtocolInputPtr common_protocol_input_;
   };
 
+  // Wrapper around a DataInput instance shared by every matcher node that was configured with
+  // an identical input config. Inputs are stateless and extract from const data, so sharing one
+  // instance is safe and avoids a per-node copy in large match trees.
+  class SharedDataInputWrapper : public DataInput<DataType> {
+  public:
+    explicit SharedDataInputWrapper(std::shared_ptr<const DataInput<DataType>> input)
+        : input_(std::move(input)) {}
+
+    DataInputGetResult get(const DataType& data) const override { return input_->get(data); }
+    absl::string_view dataInputType() const override { return input_->dataInputType(); }
+
+  private:
+    const std::shared_ptr<const DataInput<DataType>> input_;
+  };
+
   template <class TypedExtensionConfigType>
   DataInputFactoryCb<DataType> createDataInputBase(const TypedExtensionConfigType& config) {
     auto* factory = Config::Utility::getFactory<DataInputFactory<DataType>>(config);
     if (factory != nullptr) {
       validation_visitor_.validateDataInput(*factory, config.typed_config().type_url());
+    }
 
+    // Large match trees commonly repeat the same input across many predicates (e.g. every
+    // matcher in a list keyed on one header). Memoize on the serialized input config so the
+    // config is unpacked and translated once, and so that all nodes created from the resulting
+    // factory share a single input instance instead of each owning an identical copy.
+    const std::string cache_key =
+        absl::StrCat(config.typed_config().type_url(), config.typed_config().value());
+    auto it = data_input_cache_.find(cache_key);
+    if (it != data_input_cache_.end()) {
+      return it->second;
+    }
+
+    DataInputFactoryCb<DataType> data_input;
+    if (factory != nullptr) {
       ProtobufTypes::MessagePtr message =
           Config::Utility::translateAnyToFactoryConfig(config.typed_config(), validator_, *factory);
-      auto data_input = factory->createDataInputFactoryCb(*message, validator_);
-      return data_input;
+      data_input = factory->createDataInputFactoryCb(*message, validator_);
+    } else {
+      // If the provided config doesn't match a typed input, assume that this is one of the common
+      // inputs.
+      auto& common_input_factory =
+          Config::Utility::getAndCheckFactory<CommonProtocolInputFactory>(config);
+      ProtobufTypes::MessagePtr message = Config::Utility::translateAnyToFactoryConfig(
+          config.typed_config(), validator_, common_input_factory);
+      auto common_input =
+          common_input_factory.createCommonProtocolInputFactoryCb(*message, validator_);
+      data_input =
+          [common_input]() { return std::make_unique<CommonProtocolInputWrapper>(common_input()); };
     }
 
-    // If the provided config doesn't match a typed input, assume that this is one of the common
-    // inputs.
-    auto& common_input_factory =
-        Config::Utility::getAndCheckFactory<CommonProtocolInputFactory>(config);
-    ProtobufTypes::MessagePtr message = Config::Utility::translateAnyToFactoryConfig(
-        config.typed_config(), validator_, common_input_factory);
-    auto common_input =
-        common_input_factory.createCommonProtocolInputFactoryCb(*message, validator_);
-    return
-        [common_input]() { return std::make_unique<CommonProtocolInputWrapper>(common_input()); };
+    // The underlying input is created lazily on first use and then handed out through
+    // delegating wrappers, which keeps the DataInputPtr ownership contract intact.
+    auto shared_input = std::make_shared<std::shared_ptr<const DataInput<DataType>>>();
+    DataInputFactoryCb<DataType> shared_cb = [data_input = std::move(data_input),
+                                              shared_input]() -> DataInputPtr<DataType> {
+      if (*shared_input == nullptr) {
+        *shared_input = data_input();
+      }
+      return std::make_unique<SharedDataInputWrapper>(*shared_input);
+    };
+    data_input_cache_[cache_key] = shared_cb;
+    return shared_cb;
   }
 
   ProtobufMessage::ValidationVisitor& validator_;
   MatchTreeValidationVisitor<DataType>& validation_visitor_;
+  absl::flat_hash_map<std::string, DataInputFactoryCb<DataType>> data_input_cache_;
 };
 
 /**
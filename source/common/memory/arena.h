@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "envoy/event/deferred_deletable.h"
+
+#include "source/common/common/assert.h"
+#include "source/common/common/non_copyable.h"
+
+namespace Envoy {
+namespace Memory {
+
+/**
+ * A simple bump allocator that carves small objects out of larger chunks and releases all of
+ * its memory in one shot when destroyed.
+ *
+ * This is intended for groups of small allocations that share a lifetime (e.g. the per-stream
+ * control objects created by the HTTP connection manager), where it replaces many individual
+ * malloc/free pairs with pointer bumps plus a single chunk free. The arena is not thread safe;
+ * it is expected to be owned by an object that is only used on one thread.
+ */
+class Arena : NonCopyable {
+public:
+  static constexpr size_t DefaultChunkSize = 4096;
+
+  explicit Arena(size_t chunk_size = DefaultChunkSize) : chunk_size_(chunk_size) {}
+
+  ~Arena() {
+    // Run registered destructors in reverse order of allocation. The chunks themselves are
+    // freed when chunks_ is destroyed.
+    while (cleanups_ != nullptr) {
+      Cleanup* cleanup = cleanups_;
+      cleanups_ = cleanup->next_;
+      cleanup->destroy_(cleanup->object_);
+    }
+  }
+
+  /**
+   * Allocate raw storage from the arena. The storage is reclaimed when the arena is destroyed;
+   * no destructor is run.
+   * @param size number of bytes to allocate.
+   * @param alignment required alignment; must be a power of two.
+   */
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    ASSERT((alignment & (alignment - 1)) == 0);
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(next_) + alignment - 1) & ~(alignment - 1);
+    if (aligned + size > reinterpret_cast<uintptr_t>(end_)) {
+      newChunk(size + alignment);
+      aligned = (reinterpret_cast<uintptr_t>(next_) + alignment - 1) & ~(alignment - 1);
+      ASSERT(aligned + size <= reinterpret_cast<uintptr_t>(end_));
+    }
+    next_ = reinterpret_cast<uint8_t*>(aligned + size);
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  /**
+   * Construct an object of type T in the arena. If T is not trivially destructible its
+   * destructor is run when the arena is destroyed, in reverse order of allocation.
+   */
+  template <class T, class... Args> T* make(Args&&... args) {
+    T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      auto* cleanup = static_cast<Cleanup*>(allocate(sizeof(Cleanup), alignof(Cleanup)));
+      cleanup->object_ = object;
+      cleanup->destroy_ = [](void* raw) { static_cast<T*>(raw)->~T(); };
+      cleanup->next_ = cleanups_;
+      cleanups_ = cleanup;
+    }
+    return object;
+  }
+
+  /**
+   * Deleter for unique_ptrs to arena allocated objects: runs the destructor but leaves the
+   * storage to be reclaimed along with the rest of the arena.
+   */
+  struct DestructOnlyDeleter {
+    template <class T> void operator()(T* object) const { object->~T(); }
+  };
+
+  /**
+   * Construct an object of type T in the arena, owned by the returned unique_ptr. The pointer
+   * runs the destructor when reset; the storage is reclaimed when the arena is destroyed. The
+   * arena must outlive the returned pointer.
+   */
+  template <class T, class... Args>
+  std::unique_ptr<T, DestructOnlyDeleter> makeUnique(Args&&... args) {
+    return std::unique_ptr<T, DestructOnlyDeleter>(
+        new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...));
+  }
+
+  size_t bytesAllocatedForTest() const { return total_bytes_; }
+
+private:
+  struct Cleanup {
+    void (*destroy_)(void*);
+    void* object_;
+    Cleanup* next_;
+  };
+
+  void newChunk(size_t min_size) {
+    const size_t size = std::max(chunk_size_, min_size);
+    chunks_.emplace_back(new uint8_t[size]);
+    next_ = chunks_.back().get();
+    end_ = next_ + size;
+    total_bytes_ += size;
+  }
+
+  const size_t chunk_size_;
+  std::vector<std::unique_ptr<uint8_t[]>> chunks_;
+  uint8_t* next_{nullptr};
+  uint8_t* end_{nullptr};
+  Cleanup* cleanups_{nullptr};
+  size_t total_bytes_{0};
+};
+
+template <class T> using ArenaPtr = std::unique_ptr<T, Arena::DestructOnlyDeleter>;
+
+/**
+ * An arena that can be handed to Event::Dispatcher::deferredDelete, so that a group of objects
+ * carved from it is reclaimed as a single deferred deletion entry: the registered destructors
+ * run and the chunks are freed in one shot, instead of the dispatcher's deletion list carrying
+ * (and individually destroying) one entry per object.
+ */
+class DeferredArena : public Event::DeferredDeletable, public Arena {
+public:
+  using Arena::Arena;
+};
+
+} // namespace Memory
+} // namespace Envoy
@@ -11,12 +11,18 @@ namespace Memory {
 // TODO(eziskind): make this configurable
 constexpr std::chrono::milliseconds kTimerInterval = std::chrono::milliseconds(10000);
 
+// The maximum number of bytes to ask the allocator to release on each timer tick while the
+// action is in the scaling state. The actual amount released per tick is this value scaled
+// by the action state, so the release rate ramps up with resource pressure instead of all
+// retained free memory being returned at once at saturation.
+constexpr uint64_t kMaxBytesToReleasePerTick = 100 * 1024 * 1024;
+
 HeapShrinker::HeapShrinker(Event::Dispatcher& dispatcher, Server::OverloadManager& overload_manager,
                            Stats::Scope& stats) {
   const auto action_name = Server::OverloadActionNames::get().ShrinkHeap;
   if (overload_manager.registerForAction(
           action_name, dispatcher,
-          [this](Server::OverloadActionState state) { active_ = state.isSaturated(); })) {
+          [this](Server::OverloadActionState state) { state_ = state; })) {
     Envoy::Stats::StatNameManagedStorage stat_name(
         absl::StrCat("overload.", action_name, ".shrink_count"), stats.symbolTable());
     shrink_counter_ = &stats.counterFromStatName(stat_name.statName());
@@ -29,9 +35,13 @@ HeapShrinker::HeapShrinker(Event::Dispatcher& dispatcher, Server::OverloadManage
 }
 
 void HeapShrinker::shrinkHeap() {
-  if (active_) {
+  if (state_.isSaturated()) {
     Utils::releaseFreeMemory();
     shrink_counter_->inc();
+  } else if (state_.value() > UnitFloat::min()) {
+    Utils::releaseFreeMemory(
+        static_cast<uint64_t>(state_.value().value() * kMaxBytesToReleasePerTick));
+    shrink_counter_->inc();
   }
 }
 
@@ -11,6 +11,9 @@ namespace Memory {
 /**
  * A utility class to periodically attempt to shrink the heap by releasing free memory
  * to the system if the "shrink heap" overload action has been configured and triggered.
+ * When the action is configured with a scaled trigger, free memory is released gradually
+ * at a rate proportional to the action state; at saturation all retained free memory is
+ * released.
  */
 class HeapShrinker {
 public:
@@ -20,7 +23,7 @@ public:
 private:
   void shrinkHeap();
 
-  bool active_{false};
+  Server::OverloadActionState state_{Server::OverloadActionState::inactive()};
   Envoy::Stats::Counter* shrink_counter_;
   Envoy::Event::TimerPtr timer_;
 };
@@ -42,6 +42,8 @@ uint64_t Stats::totalPhysicalBytes() {
   return tcmalloc::MallocExtension::GetProperties()["generic.physical_memory_used"].value;
 }
 
+std::string Stats::detailedStats() { return tcmalloc::MallocExtension::GetStats(); }
+
 void Stats::dumpStatsToLog() {
   ENVOY_LOG_MISC(debug, "TCMalloc stats:\n{}", tcmalloc::MallocExtension::GetStats());
 }
@@ -93,6 +95,13 @@ uint64_t Stats::totalPhysicalBytes() {
   return value;
 }
 
+std::string Stats::detailedStats() {
+  constexpr int buffer_size = 100000;
+  auto buffer = std::make_unique<char[]>(buffer_size);
+  MallocExtension::instance()->GetStats(buffer.get(), buffer_size);
+  return {buffer.get()};
+}
+
 void Stats::dumpStatsToLog() {
   constexpr int buffer_size = 100000;
   auto buffer = std::make_unique<char[]>(buffer_size);
@@ -114,6 +123,7 @@ uint64_t Stats::totalCurrentlyReserved() { return 0; }
 uint64_t Stats::totalPageHeapUnmapped() { return 0; }
 uint64_t Stats::totalPageHeapFree() { return 0; }
 uint64_t Stats::totalPhysicalBytes() { return 0; }
+std::string Stats::detailedStats() { return {}; }
 void Stats::dumpStatsToLog() {}
 
 } // namespace Memory
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 
 namespace Envoy {
 namespace Memory {
@@ -45,6 +46,13 @@ public:
    */
   static uint64_t totalPhysicalBytes();
 
+  /**
+   * @return std::string the allocator's detailed human readable self-report, including
+   *         per-size-class statistics and page heap free/unmapped span counts. Returns an
+   *         empty string when no tcmalloc implementation is in use.
+   */
+  static std::string detailedStats();
+
   /**
    * Log detailed stats about current memory allocation. Intended for debugging purposes.
    */
@@ -1,6 +1,7 @@
 #include "source/common/memory/utils.h"
 
 #include "source/common/common/assert.h"
+#include "source/common/common/macros.h"
 #include "source/common/memory/stats.h"
 
 #if defined(TCMALLOC)
@@ -27,6 +28,16 @@ void Utils::releaseFreeMemory() {
 #endif
 }
 
+void Utils::releaseFreeMemory(uint64_t bytes_to_release) {
+#if defined(TCMALLOC)
+  tcmalloc::MallocExtension::ReleaseMemoryToSystem(bytes_to_release);
+#elif defined(GPERFTOOLS_TCMALLOC)
+  MallocExtension::instance()->ReleaseToSystem(bytes_to_release);
+#else
+  UNREFERENCED_PARAMETER(bytes_to_release);
+#endif
+}
+
 /*
   The purpose of this function is to release the cache introduced by tcmalloc,
   mainly in xDS config updates, admin handler, and so on. all work on the main thread,
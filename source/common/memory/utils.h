@@ -1,11 +1,17 @@
 #pragma once
 
+#include <cstdint>
+
 namespace Envoy {
 namespace Memory {
 
 class Utils {
 public:
   static void releaseFreeMemory();
+  // Asks the allocator to return up to `bytes_to_release` bytes of free memory to the
+  // system. This allows callers to pace releases over time instead of returning all
+  // retained free memory at once.
+  static void releaseFreeMemory(uint64_t bytes_to_release);
   static void tryShrinkHeap();
 };
 
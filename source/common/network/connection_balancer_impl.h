@@ -31,6 +31,11 @@ public:
  * incorrect, but this should be rectified on the next accept. This balancer sacrifices accept
  * throughput for accuracy and should be used when there are a small number of connections that
  * rarely cycle (e.g., service mesh gRPC egress).
+ *
+ * Note that exact balancing of connection counts does not imply balanced per-worker load over
+ * time: long-lived connections that close unevenly leave the counts balanced at accept while CPU
+ * usage drifts apart. Established connections cannot be moved between workers (see the note on
+ * ConnectionBalancer), so the mitigation is to bound connection lifetime upstream of this class.
  */
 class ExactConnectionBalancerImpl : public ConnectionBalancer {
 public:
@@ -227,8 +227,30 @@ Api::IoCallUint64Result IoSocketHandleImpl::sendmsg(const Buffer::RawSlice* slic
   }
 }
 
+Address::InstanceConstSharedPtr IoSocketHandleImpl::getOrCreateAddress(const sockaddr_storage& ss,
+                                                                       socklen_t ss_len) {
+  for (auto it = recent_recv_addresses_.begin(); it != recent_recv_addresses_.end(); ++it) {
+    if (it->ss_len_ == ss_len && memcmp(&it->ss_, &ss, ss_len) == 0) {
+      // Keep the cache in MRU order so the common single-peer case hits on the first compare.
+      std::rotate(recent_recv_addresses_.begin(), it, it + 1);
+      return recent_recv_addresses_.front().address_;
+    }
+  }
+  Address::InstanceConstSharedPtr address = Address::addressFromSockAddrOrDie(
+      ss, ss_len, fd_, socket_v6only_ || !udp_read_normalize_addresses_);
+  if (recent_recv_addresses_.size() == MaxCachedRecvAddresses) {
+    recent_recv_addresses_.pop_back();
+  }
+  CachedRecvAddress entry;
+  memcpy(&entry.ss_, &ss, ss_len);
+  entry.ss_len_ = ss_len;
+  entry.address_ = address;
+  recent_recv_addresses_.insert(recent_recv_addresses_.begin(), std::move(entry));
+  return address;
+}
+
 Address::InstanceConstSharedPtr
-maybeGetDstAddressFromHeader(const cmsghdr& cmsg, uint32_t self_port, os_fd_t fd, bool v6only) {
+IoSocketHandleImpl::maybeGetDstAddressFromHeader(const cmsghdr& cmsg, uint32_t self_port) {
   if (cmsg.cmsg_type == IPV6_PKTINFO) {
     auto info = reinterpret_cast<const in6_pktinfo*>(CMSG_DATA(&cmsg));
     sockaddr_storage ss;
@@ -237,7 +259,7 @@ maybeGetDstAddressFromHeader(const cmsghdr& cmsg, uint32_t self_port, os_fd_t fd
     ipv6_addr->sin6_family = AF_INET6;
     ipv6_addr->sin6_addr = info->ipi6_addr;
     ipv6_addr->sin6_port = htons(self_port);
-    return Address::addressFromSockAddrOrDie(ss, sizeof(sockaddr_in6), fd, v6only);
+    return getOrCreateAddress(ss, sizeof(sockaddr_in6));
   }
 
   if (cmsg.cmsg_type == messageTypeContainsIP()) {
@@ -247,7 +269,7 @@ maybeGetDstAddressFromHeader(const cmsghdr& cmsg, uint32_t self_port, os_fd_t fd
     ipv4_addr->sin_family = AF_INET;
     ipv4_addr->sin_addr = addressFromMessage(cmsg);
     ipv4_addr->sin_port = htons(self_port);
-    return Address::addressFromSockAddrOrDie(ss, sizeof(sockaddr_in), fd, v6only);
+    return getOrCreateAddress(ss, sizeof(sockaddr_in));
   }
 
   return nullptr;
@@ -309,8 +331,7 @@ Api::IoCallUint64Result IoSocketHandleImpl::recvmsg(Buffer::RawSlice* slices,
                  fmt::format("Incorrectly set control message length: {}", hdr.msg_controllen));
   RELEASE_ASSERT(hdr.msg_namelen > 0,
                  fmt::format("Unable to get remote address from recvmsg() for fd: {}", fd_));
-  output.msg_[0].peer_address_ = Address::addressFromSockAddrOrDie(
-      peer_addr, hdr.msg_namelen, fd_, socket_v6only_ || !udp_read_normalize_addresses_);
+  output.msg_[0].peer_address_ = getOrCreateAddress(peer_addr, hdr.msg_namelen);
   output.msg_[0].gso_size_ = 0;
 
   if (hdr.msg_controllen > 0) {
@@ -319,8 +340,7 @@ Api::IoCallUint64Result IoSocketHandleImpl::recvmsg(Buffer::RawSlice* slices,
          cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
 
       if (output.msg_[0].local_address_ == nullptr) {
-        Address::InstanceConstSharedPtr addr = maybeGetDstAddressFromHeader(
-            *cmsg, self_port, fd_, socket_v6only_ || !udp_read_normalize_addresses_);
+        Address::InstanceConstSharedPtr addr = maybeGetDstAddressFromHeader(*cmsg, self_port);
         if (addr != nullptr) {
           // This is a IP packet info message.
           output.msg_[0].local_address_ = std::move(addr);
@@ -409,13 +429,11 @@ Api::IoCallUint64Result IoSocketHandleImpl::recvmmsg(RawSliceArrays& slices, uin
 
     output.msg_[i].msg_len_ = mmsg_hdr[i].msg_len;
     // Get local and peer addresses for each packet.
-    output.msg_[i].peer_address_ = Address::addressFromSockAddrOrDie(
-        raw_addresses[i], hdr.msg_namelen, fd_, socket_v6only_ || !udp_read_normalize_addresses_);
+    output.msg_[i].peer_address_ = getOrCreateAddress(raw_addresses[i], hdr.msg_namelen);
     if (hdr.msg_controllen > 0) {
       struct cmsghdr* cmsg;
       for (cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
-        Address::InstanceConstSharedPtr addr = maybeGetDstAddressFromHeader(
-            *cmsg, self_port, fd_, socket_v6only_ || !udp_read_normalize_addresses_);
+        Address::InstanceConstSharedPtr addr = maybeGetDstAddressFromHeader(*cmsg, self_port);
         if (addr != nullptr) {
           // This is a IP packet info message.
           output.msg_[i].local_address_ = std::move(addr);
@@ -446,6 +464,17 @@ Api::IoCallUint64Result IoSocketHandleImpl::recv(void* buffer, size_t length, in
   return sysCallResultToIoCallResult(result);
 }
 
+Api::IoCallUint64Result IoSocketHandleImpl::sendFile(os_fd_t in_fd, off_t& offset,
+                                                     uint64_t length) {
+  const Api::SysCallSizeResult result =
+      Api::OsSysCallsSingleton::get().sendfile(fd_, in_fd, &offset, length);
+  return sysCallResultToIoCallResult(result);
+}
+
+bool IoSocketHandleImpl::supportsSendfile() const {
+  return Api::OsSysCallsSingleton::get().supportsSendfile();
+}
+
 bool IoSocketHandleImpl::supportsMmsg() const {
   return Api::OsSysCallsSingleton::get().supportsMmsg();
 }
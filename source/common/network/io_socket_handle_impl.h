@@ -10,6 +10,8 @@
 #include "source/common/network/io_socket_error_impl.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/inlined_vector.h"
+
 namespace Envoy {
 namespace Network {
 
@@ -55,6 +57,9 @@ public:
                                    RecvMsgOutput& output) override;
   Api::IoCallUint64Result recv(void* buffer, size_t length, int flags) override;
 
+  Api::IoCallUint64Result sendFile(os_fd_t in_fd, off_t& offset, uint64_t length) override;
+
+  bool supportsSendfile() const override;
   bool supportsMmsg() const override;
   bool supportsUdpGro() const override;
 
@@ -117,6 +122,30 @@ protected:
                            CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(uint16_t))};
 
   const bool udp_read_normalize_addresses_;
+
+  /**
+   * Returns the address instance for a raw sockaddr seen on the UDP receive path, reusing a
+   * recently constructed instance when the bytes match. recvmsg()/recvmmsg() produce a peer and
+   * a local address per packet, and most sockets only ever see a few distinct addresses, so the
+   * cache eliminates nearly all of the per-packet allocations and the string formatting done by
+   * the address constructors. The io handle is owned by a single worker, so no locking is needed.
+   */
+  Address::InstanceConstSharedPtr getOrCreateAddress(const sockaddr_storage& ss, socklen_t ss_len);
+
+  /**
+   * Extracts the destination address from a control message header, if the header carries one.
+   */
+  Address::InstanceConstSharedPtr maybeGetDstAddressFromHeader(const cmsghdr& cmsg,
+                                                               uint32_t self_port);
+
+  struct CachedRecvAddress {
+    sockaddr_storage ss_;
+    socklen_t ss_len_;
+    Address::InstanceConstSharedPtr address_;
+  };
+  static constexpr size_t MaxCachedRecvAddresses = 4;
+  // Most recently used entry first.
+  absl::InlinedVector<CachedRecvAddress, MaxCachedRecvAddresses> recent_recv_addresses_;
 };
 } // namespace Network
 } // namespace Envoy
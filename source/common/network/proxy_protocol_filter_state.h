@@ -11,7 +11,7 @@ namespace Network {
  */
 class ProxyProtocolFilterState : public StreamInfo::FilterState::Object {
 public:
-  ProxyProtocolFilterState(Network::ProxyProtocolData options) : options_(options) {}
+  ProxyProtocolFilterState(Network::ProxyProtocolData options) : options_(std::move(options)) {}
   const Network::ProxyProtocolData& value() const { return options_; }
   static const std::string& key();
 
@@ -1,15 +1,61 @@
 #include "source/common/network/socket_option_factory.h"
 
+#include <algorithm>
+#include <array>
+
 #include "envoy/config/core/v3/base.pb.h"
 
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(__linux__)
+#include <linux/filter.h>
+#endif
+
 #include "source/common/common/fmt.h"
 #include "source/common/network/addr_family_aware_socket_option_impl.h"
 #include "source/common/network/socket_option_impl.h"
 #include "source/common/network/win32_redirect_records_option_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
 namespace Envoy {
 namespace Network {
 
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(__linux__)
+namespace {
+
+struct CpuSteeringProgram {
+  std::array<sock_filter, 3> filter_;
+  sock_fprog prog_;
+};
+
+// Returns the CPU steering program for the given reuse_port group size. The kernel reads the
+// program through the pointer in sock_fprog, so the instruction storage must outlive every socket
+// the option is applied to; programs are kept in immortal function-local storage, one per group
+// size.
+const sock_fprog& cpuSteeringProgram(uint32_t group_size) {
+  static absl::Mutex lock;
+  static auto* programs =
+      new absl::flat_hash_map<uint32_t, std::unique_ptr<CpuSteeringProgram>>();
+  absl::MutexLock guard(&lock);
+  auto& program = (*programs)[group_size];
+  if (program == nullptr) {
+    program = std::make_unique<CpuSteeringProgram>();
+    // SPELLCHECKER(off)
+    program->filter_ = {{
+        {0x20, 0, 0, static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)}, // ld cpu
+        {0x94, 0, 0, group_size},                                     // mod #group_size
+        {0x16, 0, 0, 0x00000000},                                     // ret a
+    }};
+    // SPELLCHECKER(on)
+    program->prog_ = {static_cast<unsigned short>(program->filter_.size()),
+                      program->filter_.data()};
+  }
+  return program->prog_;
+}
+
+} // namespace
+#endif
+
 std::unique_ptr<Socket::Options>
 SocketOptionFactory::buildTcpKeepaliveOptions(Network::TcpKeepaliveConfig keepalive_config) {
   std::unique_ptr<Socket::Options> options = std::make_unique<Socket::Options>();
@@ -142,6 +188,32 @@ std::unique_ptr<Socket::Options> SocketOptionFactory::buildReusePortOptions() {
   return options;
 }
 
+std::unique_ptr<Socket::Options>
+SocketOptionFactory::buildCpuPinnedReusePortOptions(uint32_t concurrency) {
+  std::unique_ptr<Socket::Options> options = std::make_unique<Socket::Options>();
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(__linux__)
+  // The BPF filter returns the CPU the connection's initial packet is processed on, modulo the
+  // reuse_port group size. Workers join the group in index order, so with worker N pinned to
+  // CPU N the connection lands on the worker sharing the CPU with the kernel's socket work.
+  const sock_fprog& prog = cpuSteeringProgram(std::max(concurrency, 1u));
+  options->push_back(std::make_shared<Network::SocketOptionImpl>(
+      envoy::config::core::v3::SocketOption::STATE_BOUND, ENVOY_ATTACH_REUSEPORT_CBPF,
+      absl::string_view(reinterpret_cast<const char*>(&prog), sizeof(prog))));
+#else
+  UNREFERENCED_PARAMETER(concurrency);
+#endif
+  return options;
+}
+
+std::unique_ptr<Socket::Options>
+SocketOptionFactory::buildBusyPollOptions(std::chrono::microseconds duration) {
+  std::unique_ptr<Socket::Options> options = std::make_unique<Socket::Options>();
+  options->push_back(std::make_shared<Network::SocketOptionImpl>(
+      envoy::config::core::v3::SocketOption::STATE_PREBIND, ENVOY_SOCKET_SO_BUSY_POLL,
+      static_cast<int>(duration.count())));
+  return options;
+}
+
 std::unique_ptr<Socket::Options> SocketOptionFactory::buildUdpGroOptions() {
   std::unique_ptr<Socket::Options> options = std::make_unique<Socket::Options>();
   options->push_back(std::make_shared<SocketOptionImpl>(
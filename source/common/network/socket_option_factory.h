@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include "envoy/common/platform.h"
 #include "envoy/config/core/v3/base.pb.h"
 #include "envoy/network/socket.h"
@@ -35,6 +37,16 @@ public:
   static std::unique_ptr<Socket::Options> buildIpPacketInfoOptions();
   static std::unique_ptr<Socket::Options> buildRxQueueOverFlowOptions();
   static std::unique_ptr<Socket::Options> buildReusePortOptions();
+  // Build the SO_ATTACH_REUSEPORT_CBPF option steering each incoming connection of a reuse_port
+  // socket group to the member whose index matches the CPU handling the connection, modulo
+  // concurrency. Intended for use with pinned worker threads, where group member N belongs to
+  // the worker pinned to CPU N. Only supported on Linux; returns empty options elsewhere.
+  static std::unique_ptr<Socket::Options> buildCpuPinnedReusePortOptions(uint32_t concurrency);
+  // Build the SO_BUSY_POLL option making the kernel busy poll the device queue for this long
+  // before falling back to interrupt driven delivery. Applying the returned option fails on
+  // platforms without SO_BUSY_POLL support.
+  static std::unique_ptr<Socket::Options>
+  buildBusyPollOptions(std::chrono::microseconds duration);
   static std::unique_ptr<Socket::Options> buildUdpGroOptions();
   static std::unique_ptr<Socket::Options> buildZeroSoLingerOptions();
 };
@@ -22,8 +22,12 @@ class UdpListenerImpl : public BaseListenerImpl,
                         public UdpPacketProcessor,
                         protected Logger::Loggable<Logger::Id::udp> {
 public:
+  // `prefer_gro_default` applies when the config does not set prefer_gro explicitly: raw UDP
+  // listeners default to per-datagram reads while QUIC listeners pass true to read coalesced
+  // packet trains in one recvmsg when the OS supports UDP GRO.
   UdpListenerImpl(Event::Dispatcher& dispatcher, SocketSharedPtr socket, UdpListenerCallbacks& cb,
-                  TimeSource& time_source, const envoy::config::core::v3::UdpSocketConfig& config);
+                  TimeSource& time_source, const envoy::config::core::v3::UdpSocketConfig& config,
+                  bool prefer_gro_default = false);
   ~UdpListenerImpl() override;
   uint32_t packetsDropped() { return packets_dropped_; }
 
@@ -597,11 +597,37 @@ void passPayloadToProcessor(uint64_t bytes_read, Buffer::InstancePtr buffer,
                                      std::move(buffer), receive_time);
 }
 
+UdpRecvBufferPool::BufferAndReservation::BufferAndReservation(uint64_t max_rx_datagram_size)
+    : buffer_(std::make_unique<Buffer::OwnedImpl>()),
+      reservation_(buffer_->reserveSingleSlice(max_rx_datagram_size, true)) {}
+
+void UdpRecvBufferPool::replenish(uint64_t max_rx_datagram_size) {
+  if (reserved_datagram_size_ != max_rx_datagram_size) {
+    buffers_.clear();
+    reserved_datagram_size_ = max_rx_datagram_size;
+  }
+  buffers_.resize(NUM_DATAGRAMS_PER_RECEIVE);
+  for (auto& slot : buffers_) {
+    if (slot == nullptr) {
+      slot = std::make_unique<BufferAndReservation>(max_rx_datagram_size);
+    }
+  }
+}
+
+Buffer::InstancePtr UdpRecvBufferPool::commitAndTakeBuffer(uint64_t index, uint64_t length) {
+  BufferAndReservation& slot = *buffers_[index];
+  slot.reservation_.commit(length);
+  Buffer::InstancePtr buffer = std::move(slot.buffer_);
+  buffers_[index] = nullptr;
+  return buffer;
+}
+
 Api::IoCallUint64Result Utility::readFromSocket(IoHandle& handle,
                                                 const Address::Instance& local_address,
                                                 UdpPacketProcessor& udp_packet_processor,
                                                 MonotonicTime receive_time, bool use_gro,
-                                                uint32_t* packets_dropped) {
+                                                uint32_t* packets_dropped,
+                                                UdpRecvBufferPool* recv_buffer_pool) {
 
   if (use_gro) {
     Buffer::InstancePtr buffer = std::make_unique<Buffer::OwnedImpl>();
@@ -648,24 +674,17 @@ Api::IoCallUint64Result Utility::readFromSocket(IoHandle& handle,
   if (handle.supportsMmsg()) {
     const auto max_rx_datagram_size = udp_packet_processor.maxDatagramSize();
 
-    // Buffer::ReservationSingleSlice is always passed by value, and can only be constructed
-    // by Buffer::Instance::reserve(), so this is needed to keep a fixed array
-    // in which all elements are legally constructed.
-    struct BufferAndReservation {
-      BufferAndReservation(uint64_t max_rx_datagram_size)
-          : buffer_(std::make_unique<Buffer::OwnedImpl>()),
-            reservation_(buffer_->reserveSingleSlice(max_rx_datagram_size, true)) {}
-
-      Buffer::InstancePtr buffer_;
-      Buffer::ReservationSingleSlice reservation_;
-    };
+    // Draw the batch's preallocated buffers from the caller's pool if one was provided so that
+    // slots the previous batch did not fill are reused; otherwise the batch gets a throwaway pool.
+    UdpRecvBufferPool local_pool;
+    UdpRecvBufferPool& pool = recv_buffer_pool != nullptr ? *recv_buffer_pool : local_pool;
+    pool.replenish(max_rx_datagram_size);
+
     constexpr uint32_t num_slices_per_packet = 1u;
-    absl::InlinedVector<BufferAndReservation, NUM_DATAGRAMS_PER_RECEIVE> buffers;
     RawSliceArrays slices(NUM_DATAGRAMS_PER_RECEIVE,
                           absl::FixedArray<Buffer::RawSlice>(num_slices_per_packet));
     for (uint32_t i = 0; i < NUM_DATAGRAMS_PER_RECEIVE; i++) {
-      buffers.push_back(max_rx_datagram_size);
-      slices[i][0] = buffers[i].reservation_.slice();
+      slices[i][0] = pool.slice(i);
     }
 
     IoHandle::RecvMsgOutput output(NUM_DATAGRAMS_PER_RECEIVE, packets_dropped);
@@ -689,10 +708,10 @@ Api::IoCallUint64Result Utility::readFromSocket(IoHandle& handle,
       ENVOY_LOG_MISC(debug, "Receive a packet with {} bytes from {}", msg_len,
                      output.msg_[i].peer_address_->asString());
 
-      buffers[i].reservation_.commit(std::min(max_rx_datagram_size, msg_len));
-
-      passPayloadToProcessor(msg_len, std::move(buffers[i].buffer_), output.msg_[i].peer_address_,
-                             output.msg_[i].local_address_, udp_packet_processor, receive_time);
+      passPayloadToProcessor(
+          msg_len, pool.commitAndTakeBuffer(i, std::min(max_rx_datagram_size, msg_len)),
+          output.msg_[i].peer_address_, output.msg_[i].local_address_, udp_packet_processor,
+          receive_time);
     }
     return result;
   }
@@ -732,11 +751,15 @@ Api::IoErrorPtr Utility::readPacketsFromSocket(IoHandle& handle,
                                        : num_packets_to_read);
   // Make sure to read at least once.
   num_reads = std::max<size_t>(1, num_reads);
+  // Share one buffer pool across the reads so each batch reuses the buffers the previous batch
+  // left unfilled.
+  UdpRecvBufferPool recv_buffer_pool;
   do {
     const uint32_t old_packets_dropped = packets_dropped;
     const MonotonicTime receive_time = time_source.monotonicTime();
-    Api::IoCallUint64Result result = Utility::readFromSocket(
-        handle, local_address, udp_packet_processor, receive_time, use_gro, &packets_dropped);
+    Api::IoCallUint64Result result =
+        Utility::readFromSocket(handle, local_address, udp_packet_processor, receive_time, use_gro,
+                                &packets_dropped, &recv_buffer_pool);
 
     if (!result.ok()) {
       // No more to read or encountered a system error.
@@ -771,7 +794,10 @@ ResolvedUdpSocketConfig::ResolvedUdpSocketConfig(
     : max_rx_datagram_size_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, max_rx_datagram_size,
                                                             DEFAULT_UDP_MAX_DATAGRAM_SIZE)),
       prefer_gro_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, prefer_gro, prefer_gro_default)) {
-  if (prefer_gro_ && !Api::OsSysCallsSingleton::get().supportsUdpGro()) {
+  // Only warn when GRO was explicitly requested; consumers that merely default prefer_gro to
+  // true (e.g. QUIC listeners) silently fall back to per-datagram reads.
+  if (config.has_prefer_gro() && config.prefer_gro().value() &&
+      !Api::OsSysCallsSingleton::get().supportsUdpGro()) {
     ENVOY_LOG_MISC(
         warn, "GRO requested but not supported by the OS. Check OS config or disable prefer_gro.");
   }
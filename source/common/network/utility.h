@@ -4,6 +4,7 @@
 #include <list>
 #include <string>
 
+#include "envoy/buffer/buffer.h"
 #include "envoy/common/platform.h"
 #include "envoy/config/core/v3/address.pb.h"
 #include "envoy/network/connection.h"
@@ -11,6 +12,7 @@
 
 #include "source/common/common/statusor.h"
 
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/string_view.h"
 
 namespace Envoy {
@@ -74,6 +76,46 @@ static const uint64_t DEFAULT_UDP_MAX_DATAGRAM_SIZE = 1500;
 static const uint64_t NUM_DATAGRAMS_PER_RECEIVE = 16;
 static const uint64_t MAX_NUM_PACKETS_PER_EVENT_LOOP = 6000;
 
+/**
+ * A pool of preallocated receive buffers for the batched (recvmmsg) UDP receive path. Each slot
+ * holds a buffer with a single slice of the max datagram size reserved up front. A slot whose
+ * datagram is handed off to the UdpPacketProcessor gives up its buffer and is replaced on the
+ * next replenish(); slots a batch did not fill keep their reservation, so consecutive batches
+ * only pay allocation cost for the datagrams actually received rather than for the full batch.
+ */
+class UdpRecvBufferPool {
+public:
+  /**
+   * Top the pool up to NUM_DATAGRAMS_PER_RECEIVE buffers, each with a reservation of
+   * max_rx_datagram_size bytes. The whole pool is rebuilt if the datagram size changed since the
+   * last call.
+   */
+  void replenish(uint64_t max_rx_datagram_size);
+
+  /**
+   * @return the reserved slice backing the given slot. Only valid until the slot's buffer is
+   * taken.
+   */
+  Buffer::RawSlice slice(uint64_t index) { return buffers_[index]->reservation_.slice(); }
+
+  /**
+   * Commit length received bytes into the slot's buffer and hand the buffer off. The slot stays
+   * empty until the next replenish().
+   */
+  Buffer::InstancePtr commitAndTakeBuffer(uint64_t index, uint64_t length);
+
+private:
+  struct BufferAndReservation {
+    BufferAndReservation(uint64_t max_rx_datagram_size);
+
+    Buffer::InstancePtr buffer_;
+    Buffer::ReservationSingleSlice reservation_;
+  };
+
+  uint64_t reserved_datagram_size_{0};
+  absl::InlinedVector<std::unique_ptr<BufferAndReservation>, NUM_DATAGRAMS_PER_RECEIVE> buffers_;
+};
+
 /**
  * Wrapper which resolves UDP socket proto config with defaults.
  */
@@ -355,12 +397,16 @@ public:
    * @param prefer_gro supplies whether to use GRO if the OS supports it.
    * @param packets_dropped is the output parameter for number of packets dropped in kernel. If the
    * caller is not interested in it, nullptr can be passed in.
+   * @param recv_buffer_pool is an optional pool the batched receive path draws its preallocated
+   * buffers from. When reading in a loop, passing the same pool to every read lets a batch reuse
+   * the buffers the previous batch did not fill. If nullptr, each batch allocates its own buffers.
    */
   static Api::IoCallUint64Result readFromSocket(IoHandle& handle,
                                                 const Address::Instance& local_address,
                                                 UdpPacketProcessor& udp_packet_processor,
                                                 MonotonicTime receive_time, bool use_gro,
-                                                uint32_t* packets_dropped);
+                                                uint32_t* packets_dropped,
+                                                UdpRecvBufferPool* recv_buffer_pool = nullptr);
 
   /**
    * Read some packets from a given UDP socket and pass the packet to a given
@@ -772,6 +772,11 @@ uint64_t DurationUtil::durationToSeconds(const ProtobufWkt::Duration& duration)
   return Protobuf::util::TimeUtil::DurationToSeconds(duration);
 }
 
+uint64_t DurationUtil::durationToMicroseconds(const ProtobufWkt::Duration& duration) {
+  validateDurationAsMilliseconds(duration);
+  return Protobuf::util::TimeUtil::DurationToMicroseconds(duration);
+}
+
 void TimestampUtil::systemClockToTimestamp(const SystemTime system_clock_time,
                                            ProtobufWkt::Timestamp& timestamp) {
   // Converts to millisecond-precision Timestamp by explicitly casting to millisecond-precision
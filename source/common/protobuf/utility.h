@@ -710,6 +710,15 @@ public:
    * @throw OutOfRangeException when duration is out-of-range.
    */
   static uint64_t durationToSeconds(const ProtobufWkt::Duration& duration);
+
+  /**
+   * Same as Protobuf::util::TimeUtil::DurationToMicroseconds but with extra validation logic.
+   * Specifically, we ensure that the duration is positive.
+   * @param duration protobuf.
+   * @return duration in microseconds.
+   * @throw OutOfRangeException when duration is out-of-range.
+   */
+  static uint64_t durationToMicroseconds(const ProtobufWkt::Duration& duration);
 };
 
 class TimestampUtil {
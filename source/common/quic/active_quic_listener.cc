@@ -39,7 +39,10 @@ ActiveQuicListener::ActiveQuicListener(
           worker_index, concurrency, parent, *listen_socket,
           std::make_unique<Network::UdpListenerImpl>(
               dispatcher, listen_socket, *this, dispatcher.timeSource(),
-              listener_config.udpListenerConfig()->config().downstream_socket_config()),
+              listener_config.udpListenerConfig()->config().downstream_socket_config(),
+              // QUIC bulk traffic arrives as kernel-coalesced packet trains, so prefer GRO
+              // reads unless the listener's socket config explicitly disables them.
+              /*prefer_gro_default=*/true),
           &listener_config),
       dispatcher_(dispatcher), version_manager_(quic::CurrentSupportedHttp3Versions()),
       kernel_worker_routing_(kernel_worker_routing),
@@ -91,6 +94,18 @@ ActiveQuicListener::ActiveQuicListener(
 
 ActiveQuicListener::~ActiveQuicListener() { onListenerShutdown(); }
 
+void ActiveQuicListener::maybeEnableOffThreadProofSigning(Thread::ThreadFactory& thread_factory) {
+  if (!Runtime::runtimeFeatureEnabled("envoy.reloadable_features.quic_async_proof_signing")) {
+    return;
+  }
+  // Custom proof sources configured via proof_source_config are left untouched; only the
+  // default filter chain proof source knows how to sign off-thread.
+  auto* proof_source = dynamic_cast<EnvoyQuicProofSource*>(crypto_config_->proof_source());
+  if (proof_source != nullptr) {
+    proof_source->enableOffThreadSigning(dispatcher_, thread_factory);
+  }
+}
+
 void ActiveQuicListener::onListenerShutdown() {
   ENVOY_LOG(info, "Quic listener {} shutdown.", config_->name());
   quic_dispatcher_->Shutdown();
@@ -216,12 +231,12 @@ void ActiveQuicListener::closeConnectionsWithFilterChain(const Network::FilterCh
 ActiveQuicListenerFactory::ActiveQuicListenerFactory(
     const envoy::config::listener::v3::QuicProtocolOptions& config, uint32_t concurrency,
     QuicStatNames& quic_stat_names, ProtobufMessage::ValidationVisitor& validation_visitor,
-    ProcessContextOptRef context)
+    ProcessContextOptRef context, OptRef<Thread::ThreadFactory> thread_factory)
     : concurrency_(concurrency), enabled_(config.enabled()), quic_stat_names_(quic_stat_names),
       packets_to_read_to_connection_count_ratio_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, packets_to_read_to_connection_count_ratio,
                                           DEFAULT_PACKETS_TO_READ_PER_CONNECTION)),
-      context_(context) {
+      context_(context), thread_factory_(thread_factory) {
   const int64_t idle_network_timeout_ms =
       config.has_idle_timeout() ? DurationUtil::durationToMilliseconds(config.idle_timeout())
                                 : 300000;
@@ -340,12 +355,19 @@ Network::ConnectionHandler::ActiveUdpListenerPtr ActiveQuicListenerFactory::crea
     }
   }
 
-  return createActiveQuicListener(
+  Network::ConnectionHandler::ActiveUdpListenerPtr listener = createActiveQuicListener(
       runtime, worker_index, concurrency_, dispatcher, parent, std::move(listen_socket_ptr), config,
       quic_config_, kernel_worker_routing_, enabled_, quic_stat_names_,
       packets_to_read_to_connection_count_ratio_, crypto_server_stream_factory_.value(),
       proof_source_factory_.value(),
       quic_cid_generator_factory_->createQuicConnectionIdGenerator(worker_index));
+  if (thread_factory_.has_value()) {
+    auto* quic_listener = dynamic_cast<ActiveQuicListener*>(listener.get());
+    if (quic_listener != nullptr) {
+      quic_listener->maybeEnableOffThreadProofSigning(thread_factory_.ref());
+    }
+  }
+  return listener;
 }
 Network::ConnectionHandler::ActiveUdpListenerPtr
 ActiveQuicListenerFactory::createActiveQuicListener(
@@ -6,6 +6,7 @@
 #include "envoy/network/socket.h"
 #include "envoy/runtime/runtime.h"
 #include "envoy/server/process_context.h"
+#include "envoy/thread/thread.h"
 
 #include "source/common/protobuf/utility.h"
 #include "source/common/quic/envoy_quic_connection_id_generator_factory.h"
@@ -48,6 +49,11 @@ public:
     return event_loops_with_buffered_chlo_for_test_;
   }
 
+  // Offloads proof source private key signing onto a dedicated thread if
+  // envoy.reloadable_features.quic_async_proof_signing is enabled and the configured proof
+  // source supports it. Must be called before the listener starts processing handshakes.
+  void maybeEnableOffThreadProofSigning(Thread::ThreadFactory& thread_factory);
+
   // Network::UdpListenerCallbacks
   void onReadReady() override;
   void onWriteReady(const Network::Socket& socket) override;
@@ -103,10 +109,14 @@ using ActiveQuicListenerPtr = std::unique_ptr<ActiveQuicListener>;
 class ActiveQuicListenerFactory : public Network::ActiveUdpListenerFactory,
                                   Logger::Loggable<Logger::Id::quic> {
 public:
+  // |thread_factory| is used to spawn a proof signing thread per listener when
+  // envoy.reloadable_features.quic_async_proof_signing is enabled; when unset, signing always
+  // happens inline on the worker thread.
   ActiveQuicListenerFactory(const envoy::config::listener::v3::QuicProtocolOptions& config,
                             uint32_t concurrency, QuicStatNames& quic_stat_names,
                             ProtobufMessage::ValidationVisitor& validation_visitor,
-                            ProcessContextOptRef context);
+                            ProcessContextOptRef context,
+                            OptRef<Thread::ThreadFactory> thread_factory = {});
 
   // Network::ActiveUdpListenerFactory.
   Network::ConnectionHandler::ActiveUdpListenerPtr
@@ -151,6 +161,7 @@ private:
   QuicConnectionIdWorkerSelector worker_selector_;
   bool kernel_worker_routing_{};
   ProcessContextOptRef context_;
+  OptRef<Thread::ThreadFactory> thread_factory_;
 
   static bool disable_kernel_bpf_packet_routing_for_test_;
 };
@@ -14,6 +14,24 @@
 namespace Envoy {
 namespace Quic {
 
+EnvoyQuicProofSource::~EnvoyQuicProofSource() {
+  if (signing_thread_ != nullptr) {
+    {
+      absl::MutexLock guard(&mutex_);
+      shutting_down_ = true;
+    }
+    signing_thread_->join();
+  }
+}
+
+void EnvoyQuicProofSource::enableOffThreadSigning(Event::Dispatcher& dispatcher,
+                                                  Thread::ThreadFactory& thread_factory) {
+  ASSERT(signing_thread_ == nullptr);
+  dispatcher_ = &dispatcher;
+  signing_thread_ = thread_factory.createThread([this]() { signThreadRoutine(); },
+                                                Thread::Options{"quic_proof_sign"});
+}
+
 quiche::QuicheReferenceCountedPointer<quic::ProofSource::Chain>
 EnvoyQuicProofSource::GetCertChain(const quic::QuicSocketAddress& server_address,
                                    const quic::QuicSocketAddress& client_address,
@@ -30,6 +48,10 @@ EnvoyQuicProofSource::GetCertChain(const quic::QuicSocketAddress& server_address
   }
   auto& cert_config = cert_config_ref.value().get();
   const std::string& chain_str = cert_config.certificateChain();
+  auto cached_chain = chain_cache_.find(chain_str);
+  if (cached_chain != chain_cache_.end()) {
+    return cached_chain->second;
+  }
   std::stringstream pem_stream(chain_str);
   std::vector<std::string> chain = quic::CertificateView::LoadPemFromStream(&pem_stream);
 
@@ -49,6 +71,10 @@ EnvoyQuicProofSource::GetCertChain(const quic::QuicSocketAddress& server_address
                                  error_details));
     return nullptr;
   }
+  if (chain_cache_.size() >= MaxParsedCacheEntries) {
+    chain_cache_.clear();
+  }
+  chain_cache_.emplace(chain_str, cert_chain);
   return cert_chain;
 }
 
@@ -66,19 +92,33 @@ void EnvoyQuicProofSource::signPayload(
     return;
   }
   auto& cert_config = cert_config_ref.value().get();
-  // Load private key.
+  // Load private key, reusing the parsed key from a previous handshake when the PEM is
+  // unchanged.
   const std::string& pkey = cert_config.privateKey();
-  std::stringstream pem_str(pkey);
-  std::unique_ptr<quic::CertificatePrivateKey> pem_key =
-      quic::CertificatePrivateKey::LoadPemFromStream(&pem_str);
-  if (pem_key == nullptr) {
-    ENVOY_LOG(warn, "Failed to load private key.");
-    callback->Run(false, "", nullptr);
-    return;
+  std::shared_ptr<quic::CertificatePrivateKey> pem_key;
+  int sign_alg = 0;
+  std::string error_details;
+  auto cached_key = key_cache_.find(pkey);
+  if (cached_key != key_cache_.end()) {
+    pem_key = cached_key->second.key_;
+    sign_alg = cached_key->second.sign_alg_;
+  } else {
+    std::stringstream pem_str(pkey);
+    pem_key = quic::CertificatePrivateKey::LoadPemFromStream(&pem_str);
+    if (pem_key == nullptr) {
+      ENVOY_LOG(warn, "Failed to load private key.");
+      callback->Run(false, "", nullptr);
+      return;
+    }
+    sign_alg = deduceSignatureAlgorithmFromPublicKey(pem_key->private_key(), &error_details);
+    if (sign_alg != 0) {
+      if (key_cache_.size() >= MaxParsedCacheEntries) {
+        key_cache_.clear();
+      }
+      key_cache_.emplace(pkey, ParsedPrivateKey{pem_key, sign_alg});
+    }
   }
   // Verify the signature algorithm is as expected.
-  std::string error_details;
-  int sign_alg = deduceSignatureAlgorithmFromPublicKey(pem_key->private_key(), &error_details);
   if (sign_alg != signature_algorithm) {
     ENVOY_LOG(warn,
               fmt::format("The signature algorithm {} from the private key is not expected: {}",
@@ -87,12 +127,51 @@ void EnvoyQuicProofSource::signPayload(
     return;
   }
 
+  ASSERT(res.filter_chain_.has_value());
+  auto details = std::make_unique<EnvoyQuicProofSourceDetails>(res.filter_chain_.value().get());
+
+  if (signing_thread_ != nullptr) {
+    // Hand the already-loaded key over to the signing thread. The filter chain lookup and key
+    // parsing above have to stay on the worker thread because they touch per-listener state;
+    // the expensive private key operation is the only part offloaded.
+    auto pending = std::make_shared<PendingSignature>(
+        PendingSignature{std::move(pem_key), signature_algorithm, std::string(in),
+                         std::move(details), std::move(callback)});
+    absl::MutexLock guard(&mutex_);
+    pending_signatures_.emplace_back(std::move(pending));
+    return;
+  }
+
   // Sign.
   std::string sig = pem_key->Sign(in, signature_algorithm);
   bool success = !sig.empty();
-  ASSERT(res.filter_chain_.has_value());
-  callback->Run(success, sig,
-                std::make_unique<EnvoyQuicProofSourceDetails>(res.filter_chain_.value().get()));
+  callback->Run(success, sig, std::move(details));
+}
+
+void EnvoyQuicProofSource::signThreadRoutine() {
+  while (true) {
+    PendingSignatureSharedPtr pending;
+    {
+      absl::MutexLock guard(&mutex_);
+      auto condition = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+        return shutting_down_ || !pending_signatures_.empty();
+      };
+      mutex_.Await(absl::Condition(&condition));
+      if (shutting_down_) {
+        // Pending callbacks are dropped without running; the listener owning this proof source
+        // is being torn down along with the connections waiting on them.
+        return;
+      }
+      pending = pending_signatures_.front();
+      pending_signatures_.pop_front();
+    }
+    std::string sig = pending->key_->Sign(pending->payload_, pending->signature_algorithm_);
+    // The posted closure owns everything it needs and does not touch this proof source, so it
+    // is safe even if the proof source is destroyed before the event loop runs it.
+    dispatcher_->post([pending, sig]() {
+      pending->callback_->Run(!sig.empty(), sig, std::move(pending->details_));
+    });
+  }
 }
 
 EnvoyQuicProofSource::CertConfigWithFilterChain
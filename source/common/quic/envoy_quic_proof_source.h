@@ -1,9 +1,17 @@
 #pragma once
 
+#include <list>
+
+#include "envoy/event/dispatcher.h"
+#include "envoy/thread/thread.h"
+
 #include "source/common/quic/envoy_quic_proof_source_base.h"
 #include "source/common/quic/quic_transport_socket_factory.h"
 #include "source/server/listener_stats.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
 namespace Envoy {
 namespace Quic {
 
@@ -16,7 +24,13 @@ public:
       : listen_socket_(listen_socket), filter_chain_manager_(&filter_chain_manager),
         listener_stats_(listener_stats), time_source_(time_source) {}
 
-  ~EnvoyQuicProofSource() override = default;
+  ~EnvoyQuicProofSource() override;
+
+  // Moves the private key operation in signPayload() onto a dedicated signing thread. The
+  // signature callback is posted back to |dispatcher|, so |dispatcher| must be the event loop
+  // driving the QUIC listener which owns this proof source. Must be called before any
+  // handshake uses this proof source.
+  void enableOffThreadSigning(Event::Dispatcher& dispatcher, Thread::ThreadFactory& thread_factory);
 
   // quic::ProofSource
   quiche::QuicheReferenceCountedPointer<quic::ProofSource::Chain>
@@ -39,15 +53,55 @@ private:
     absl::optional<std::reference_wrapper<const Network::FilterChain>> filter_chain_;
   };
 
+  // A signature request handed over to the signing thread. Everything the signing thread and
+  // the completion callback need is captured here so that neither has to touch the proof
+  // source once the request is queued.
+  struct PendingSignature {
+    // Shared with the parsed key cache. Sign() calls on a shared key are serialized on the
+    // single signing thread, so the sharing is safe.
+    std::shared_ptr<quic::CertificatePrivateKey> key_;
+    uint16_t signature_algorithm_;
+    std::string payload_;
+    std::unique_ptr<EnvoyQuicProofSourceDetails> details_;
+    std::unique_ptr<quic::ProofSource::SignatureCallback> callback_;
+  };
+  // Must be a shared_ptr for passing around via post.
+  using PendingSignatureSharedPtr = std::shared_ptr<PendingSignature>;
+
   CertConfigWithFilterChain
   getTlsCertConfigAndFilterChain(const quic::QuicSocketAddress& server_address,
                                  const quic::QuicSocketAddress& client_address,
                                  const std::string& hostname);
 
+  void signThreadRoutine();
+
   Network::Socket& listen_socket_;
   Network::FilterChainManager* filter_chain_manager_{nullptr};
   Server::ListenerStats& listener_stats_;
   TimeSource& time_source_;
+
+  // Parsed artifacts reused across handshakes. The PEM contents only change on SDS rotation, so
+  // re-parsing the chain and private key for every handshake is wasted work during handshake
+  // storms. Keyed by the PEM string so that a rotation naturally misses and re-parses. Only
+  // touched on the worker thread driving this proof source, so no synchronization is needed.
+  struct ParsedPrivateKey {
+    std::shared_ptr<quic::CertificatePrivateKey> key_;
+    int sign_alg_;
+  };
+  // In steady state the caches hold one entry per configured cert; entries only accumulate
+  // across SDS rotations. A full clear on overflow is simpler than LRU and just costs a
+  // re-parse.
+  static constexpr size_t MaxParsedCacheEntries = 32;
+  absl::flat_hash_map<std::string, quiche::QuicheReferenceCountedPointer<quic::ProofSource::Chain>>
+      chain_cache_;
+  absl::flat_hash_map<std::string, ParsedPrivateKey> key_cache_;
+
+  // Set iff off-thread signing has been enabled.
+  Event::Dispatcher* dispatcher_{nullptr};
+  Thread::ThreadPtr signing_thread_;
+  absl::Mutex mutex_;
+  std::list<PendingSignatureSharedPtr> pending_signatures_ ABSL_GUARDED_BY(mutex_);
+  bool shutting_down_ ABSL_GUARDED_BY(mutex_){false};
 };
 
 } // namespace Quic
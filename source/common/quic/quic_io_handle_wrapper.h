@@ -81,6 +81,13 @@ public:
     }
     return io_handle_.recv(buffer, length, flags);
   }
+  Api::IoCallUint64Result sendFile(os_fd_t in_fd, off_t& offset, uint64_t length) override {
+    if (closed_) {
+      return {0, Network::IoSocketError::getIoSocketEbadfError()};
+    }
+    return io_handle_.sendFile(in_fd, offset, length);
+  }
+  bool supportsSendfile() const override { return io_handle_.supportsSendfile(); }
   bool supportsMmsg() const override { return io_handle_.supportsMmsg(); }
   bool supportsUdpGro() const override { return io_handle_.supportsUdpGro(); }
   Api::SysCallIntResult bind(Network::Address::InstanceConstSharedPtr address) override {
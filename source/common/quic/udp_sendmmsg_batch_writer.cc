@@ -0,0 +1,114 @@
+#include "source/common/quic/udp_sendmmsg_batch_writer.h"
+
+#include "source/common/network/io_socket_error_impl.h"
+#include "source/common/quic/envoy_quic_utils.h"
+
+namespace Envoy {
+namespace Quic {
+namespace {
+Api::IoCallUint64Result convertQuicWriteResult(quic::WriteResult quic_result, size_t payload_len) {
+  switch (quic_result.status) {
+  case quic::WRITE_STATUS_OK:
+    if (quic_result.bytes_written == 0) {
+      ENVOY_LOG_MISC(trace, "sendmmsg successful, message buffered to send");
+    } else {
+      ENVOY_LOG_MISC(trace, "sendmmsg successful, flushed bytes {}", quic_result.bytes_written);
+    }
+    // Return payload_len as rc & nullptr as error on success
+    return {/*rc=*/payload_len,
+            /*err=*/Api::IoError::none()};
+  case quic::WRITE_STATUS_BLOCKED_DATA_BUFFERED:
+    // Data was buffered, Return payload_len as rc & nullptr as error
+    ENVOY_LOG_MISC(trace, "sendmmsg blocked, message buffered to send");
+    return {/*rc=*/payload_len,
+            /*err=*/Api::IoError::none()};
+  case quic::WRITE_STATUS_BLOCKED:
+    // Writer blocked, return error
+    ENVOY_LOG_MISC(trace, "sendmmsg blocked, message not buffered");
+    return {/*rc=*/0,
+            /*err=*/Network::IoSocketError::getIoSocketEagainError()};
+  default:
+    // Write Failed, return {0 and error_code}
+    ENVOY_LOG_MISC(trace, "sendmmsg failed with error code {}",
+                   static_cast<int>(quic_result.error_code));
+    return {/*rc=*/0,
+            /*err=*/Network::IoSocketError::create(quic_result.error_code)};
+  }
+}
+
+} // namespace
+
+UdpSendmmsgBatchWriter::UdpSendmmsgBatchWriter(Network::IoHandle& io_handle, Stats::Scope& scope)
+    : quic::QuicSendmmsgBatchWriter(std::make_unique<quic::QuicBatchWriterBuffer>(),
+                                    io_handle.fdDoNotUse()),
+      stats_(generateStats(scope)) {}
+
+Api::IoCallUint64Result
+UdpSendmmsgBatchWriter::writePacket(const Buffer::Instance& buffer,
+                                    const Network::Address::Ip* local_ip,
+                                    const Network::Address::Instance& peer_address) {
+  quic::QuicSocketAddress peer_addr = envoyIpAddressToQuicSocketAddress(peer_address.ip());
+  quic::QuicSocketAddress self_addr = envoyIpAddressToQuicSocketAddress(local_ip);
+  ASSERT(buffer.getRawSlices().size() == 1);
+  size_t payload_len = static_cast<size_t>(buffer.frontSlice().len_);
+
+  // Include the packet being written when computing how many buffered packets a full internal
+  // buffer may force WritePacket() to flush.
+  const uint64_t num_buffered_before = buffered_writes().size() + 1;
+  quic::QuicPacketWriterParams params;
+  quic::WriteResult quic_result = WritePacket(static_cast<char*>(buffer.frontSlice().mem_),
+                                              payload_len, self_addr.host(), peer_addr,
+                                              /*quic::PerPacketOptions=*/nullptr, params);
+  updateUdpSendmmsgBatchWriterStats(quic_result, num_buffered_before - buffered_writes().size());
+
+  return convertQuicWriteResult(quic_result, payload_len);
+}
+
+uint64_t
+UdpSendmmsgBatchWriter::getMaxPacketSize(const Network::Address::Instance& peer_address) const {
+  quic::QuicSocketAddress peer_addr = envoyIpAddressToQuicSocketAddress(peer_address.ip());
+  return static_cast<uint64_t>(GetMaxPacketSize(peer_addr));
+}
+
+Network::UdpPacketWriterBuffer
+UdpSendmmsgBatchWriter::getNextWriteLocation(const Network::Address::Ip* local_ip,
+                                             const Network::Address::Instance& peer_address) {
+  quic::QuicSocketAddress peer_addr = envoyIpAddressToQuicSocketAddress(peer_address.ip());
+  quic::QuicSocketAddress self_addr = envoyIpAddressToQuicSocketAddress(local_ip);
+  quic::QuicPacketBuffer quic_buf = GetNextWriteLocation(self_addr.host(), peer_addr);
+  return {reinterpret_cast<uint8_t*>(quic_buf.buffer), Network::UdpMaxOutgoingPacketSize,
+          quic_buf.release_buffer};
+}
+
+Api::IoCallUint64Result UdpSendmmsgBatchWriter::flush() {
+  const uint64_t num_buffered_before = buffered_writes().size();
+  quic::WriteResult quic_result = Flush();
+  updateUdpSendmmsgBatchWriterStats(quic_result, num_buffered_before - buffered_writes().size());
+
+  return convertQuicWriteResult(quic_result, /*payload_len=*/0);
+}
+
+void UdpSendmmsgBatchWriter::updateUdpSendmmsgBatchWriterStats(quic::WriteResult quic_result,
+                                                               uint64_t pkts_flushed) {
+  if (quic_result.status == quic::WRITE_STATUS_OK && quic_result.bytes_written > 0) {
+    if (pkts_flushed > 0) {
+      stats_.pkts_sent_per_batch_.recordValue(pkts_flushed);
+    }
+    stats_.total_bytes_sent_.add(quic_result.bytes_written);
+  }
+  stats_.internal_buffer_size_.set(batch_buffer().SizeInUse());
+}
+
+UdpSendmmsgBatchWriterStats UdpSendmmsgBatchWriter::generateStats(Stats::Scope& scope) {
+  return {UDP_SENDMMSG_BATCH_WRITER_STATS(POOL_COUNTER(scope), POOL_GAUGE(scope),
+                                          POOL_HISTOGRAM(scope))};
+}
+
+Network::UdpPacketWriterPtr
+UdpSendmmsgBatchWriterFactory::createUdpPacketWriter(Network::IoHandle& io_handle,
+                                                     Stats::Scope& scope) {
+  return std::make_unique<UdpSendmmsgBatchWriter>(io_handle, scope);
+}
+
+} // namespace Quic
+} // namespace Envoy
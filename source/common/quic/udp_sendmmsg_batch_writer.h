@@ -0,0 +1,96 @@
+#pragma once
+
+#if !defined(__linux__) || defined(__ANDROID_API__)
+#define UDP_SENDMMSG_BATCH_WRITER_COMPILETIME_SUPPORT 0
+#else
+#define UDP_SENDMMSG_BATCH_WRITER_COMPILETIME_SUPPORT 1
+
+#include "envoy/network/udp_packet_writer_handler.h"
+
+#include "source/common/protobuf/utility.h"
+#include "source/common/runtime/runtime_protos.h"
+
+#include "quiche/quic/core/batch_writer/quic_sendmmsg_batch_writer.h"
+
+namespace Envoy {
+namespace Quic {
+
+/**
+ * @brief Statistics for UdpSendmmsgBatchWriter:
+ *
+ * @total_bytes_sent: Count of total bytes sent via the
+ * UdpSendmmsgBatchWriter on the current ioHandle via both
+ * WritePacket() and Flush() functions.
+ *
+ * @internal_buffer_size: Gauge tracking the total bytes currently
+ * buffered in the writer. Resets whenever the buffered packets are
+ * sent to the client.
+ *
+ * @pkts_sent_per_batch: Histogram of the number of packets flushed
+ * by each sendmmsg() call.
+ */
+#define UDP_SENDMMSG_BATCH_WRITER_STATS(COUNTER, GAUGE, HISTOGRAM)                                 \
+  COUNTER(total_bytes_sent)                                                                        \
+  GAUGE(internal_buffer_size, NeverImport)                                                         \
+  HISTOGRAM(pkts_sent_per_batch, Unspecified)
+
+/**
+ * Wrapper struct for udp sendmmsg batch writer stats. @see stats_macros.h
+ */
+struct UdpSendmmsgBatchWriterStats {
+  UDP_SENDMMSG_BATCH_WRITER_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT,
+                                  GENERATE_HISTOGRAM_STRUCT)
+};
+
+/**
+ * UdpPacketWriter implementation based on quic::QuicSendmmsgBatchWriter. Packets are buffered
+ * as individual msghdrs and flushed with a single sendmmsg() syscall. Used as the batching
+ * fallback on hosts where UDP GSO is not available.
+ */
+class UdpSendmmsgBatchWriter : public quic::QuicSendmmsgBatchWriter,
+                               public Network::UdpPacketWriter {
+public:
+  UdpSendmmsgBatchWriter(Network::IoHandle& io_handle, Stats::Scope& scope);
+
+  // writePacket performs batched sends based on QuicSendmmsgBatchWriter::WritePacket
+  Api::IoCallUint64Result writePacket(const Buffer::Instance& buffer,
+                                      const Network::Address::Ip* local_ip,
+                                      const Network::Address::Instance& peer_address) override;
+
+  // UdpPacketWriter Implementations
+  bool isWriteBlocked() const override { return IsWriteBlocked(); }
+  void setWritable() override { return SetWritable(); }
+  bool isBatchMode() const override { return IsBatchMode(); }
+  uint64_t getMaxPacketSize(const Network::Address::Instance& peer_address) const override;
+  Network::UdpPacketWriterBuffer
+  getNextWriteLocation(const Network::Address::Ip* local_ip,
+                       const Network::Address::Instance& peer_address) override;
+  Api::IoCallUint64Result flush() override;
+
+private:
+  /**
+   * @brief Update stats_ field for the udp packet writer
+   * @param quic_result is the result from Flush/WritePacket
+   * @param pkts_flushed is the number of buffered packets drained by the call
+   */
+  void updateUdpSendmmsgBatchWriterStats(quic::WriteResult quic_result, uint64_t pkts_flushed);
+
+  /**
+   * @brief Generate UdpSendmmsgBatchWriterStats object from scope
+   * @param scope for stats
+   * @return UdpSendmmsgBatchWriterStats for scope
+   */
+  UdpSendmmsgBatchWriterStats generateStats(Stats::Scope& scope);
+  UdpSendmmsgBatchWriterStats stats_;
+};
+
+class UdpSendmmsgBatchWriterFactory : public Network::UdpPacketWriterFactory {
+public:
+  Network::UdpPacketWriterPtr createUdpPacketWriter(Network::IoHandle& io_handle,
+                                                    Stats::Scope& scope) override;
+};
+
+} // namespace Quic
+} // namespace Envoy
+
+#endif // defined(__linux__)
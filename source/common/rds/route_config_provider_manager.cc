@@ -24,6 +24,31 @@ void RouteConfigProviderManager::eraseStaticProvider(RouteConfigProvider* provid
   static_route_config_providers_.erase(provider);
 }
 
+ConfigConstSharedPtr RouteConfigProviderManager::getOrCreateStaticConfig(
+    const Protobuf::Message& route_config_proto, const ConfigTraits& config_traits,
+    std::function<ConfigConstSharedPtr()> create_config) {
+  const uint64_t manager_identifier =
+      MessageUtil::hash(route_config_proto) ^ config_traits.staticConfigSeed();
+  const auto it = static_config_cache_.find(manager_identifier);
+  if (it != static_config_cache_.end()) {
+    if (ConfigConstSharedPtr existing_config = it->second.lock()) {
+      return existing_config;
+    }
+  }
+  ConfigConstSharedPtr config = create_config();
+  // Compiling a config is rare and expensive relative to scanning this (small) cache, so expired
+  // entries are purged here rather than eagerly on provider destruction.
+  for (auto cache_it = static_config_cache_.begin(); cache_it != static_config_cache_.end();) {
+    if (cache_it->second.expired()) {
+      static_config_cache_.erase(cache_it++);
+    } else {
+      ++cache_it;
+    }
+  }
+  static_config_cache_[manager_identifier] = config;
+  return config;
+}
+
 void RouteConfigProviderManager::eraseDynamicProvider(uint64_t manager_identifier) {
   dynamic_route_config_providers_.erase(manager_identifier);
 }
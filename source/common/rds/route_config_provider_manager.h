@@ -13,6 +13,7 @@
 #include "source/common/common/matchers.h"
 #include "source/common/protobuf/utility.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/container/node_hash_set.h"
 
@@ -34,6 +35,21 @@ public:
 
   RouteConfigProviderPtr
   addStaticProvider(std::function<RouteConfigProviderPtr()> create_static_provider);
+
+  /**
+   * Returns the compiled config for a static route configuration, sharing one compiled config
+   * between all static providers whose protos (and traits seeds, see
+   * ConfigTraits::staticConfigSeed()) hash identically. Listeners commonly repeat the same inline
+   * route configuration, and compiling it once per distinct content rather than once per listener
+   * saves both config-load CPU and steady-state memory.
+   * @param route_config_proto supplies the route configuration.
+   * @param config_traits supplies the traits the config will be compiled with.
+   * @param create_config is invoked to compile the config on a cache miss.
+   */
+  ConfigConstSharedPtr
+  getOrCreateStaticConfig(const Protobuf::Message& route_config_proto,
+                          const ConfigTraits& config_traits,
+                          std::function<ConfigConstSharedPtr()> create_config);
   RouteConfigProviderSharedPtr
   addDynamicProvider(const Protobuf::Message& rds, const std::string& route_config_name,
                      Init::Manager& init_manager,
@@ -48,6 +64,10 @@ private:
   absl::node_hash_map<uint64_t, std::pair<std::weak_ptr<RouteConfigProvider>, const Init::Target*>>
       dynamic_route_config_providers_;
   absl::node_hash_set<RouteConfigProvider*> static_route_config_providers_;
+  // Compiled static configs keyed by the deterministic hash of their proto. Entries are weak: a
+  // compiled config lives only as long as some provider references it, and expired entries are
+  // purged on the next miss, so draining all listeners that used a config releases it.
+  absl::flat_hash_map<uint64_t, std::weak_ptr<const Config>> static_config_cache_;
   Server::ConfigTracker::EntryOwnerPtr config_tracker_entry_;
   ProtoTraits& proto_traits_;
 
@@ -11,8 +11,12 @@ StaticRouteConfigProviderImpl::StaticRouteConfigProviderImpl(
     RouteConfigProviderManager& route_config_provider_manager)
     : route_config_proto_(
           cloneProto(route_config_provider_manager.protoTraits(), route_config_proto)),
-      config_(config_traits.createConfig(*route_config_proto_, factory_context,
-                                         true /* validate unknown cluster */)),
+      config_(route_config_provider_manager.getOrCreateStaticConfig(
+          *route_config_proto_, config_traits,
+          [&]() {
+            return config_traits.createConfig(*route_config_proto_, factory_context,
+                                              true /* validate unknown cluster */);
+          })),
       last_updated_(factory_context.timeSource().systemTime()),
       config_info_(ConfigInfo{*route_config_proto_, ""}),
       route_config_provider_manager_(route_config_provider_manager) {}
@@ -59,20 +59,6 @@ namespace {
 
 constexpr uint32_t DEFAULT_MAX_DIRECT_RESPONSE_BODY_SIZE_BYTES = 4096;
 
-void mergeTransforms(Http::HeaderTransforms& dest, const Http::HeaderTransforms& src) {
-  dest.headers_to_append_or_add.insert(dest.headers_to_append_or_add.end(),
-                                       src.headers_to_append_or_add.begin(),
-                                       src.headers_to_append_or_add.end());
-  dest.headers_to_overwrite_or_add.insert(dest.headers_to_overwrite_or_add.end(),
-                                          src.headers_to_overwrite_or_add.begin(),
-                                          src.headers_to_overwrite_or_add.end());
-  dest.headers_to_add_if_absent.insert(dest.headers_to_add_if_absent.end(),
-                                       src.headers_to_add_if_absent.begin(),
-                                       src.headers_to_add_if_absent.end());
-  dest.headers_to_remove.insert(dest.headers_to_remove.end(), src.headers_to_remove.begin(),
-                                src.headers_to_remove.end());
-}
-
 RouteEntryImplBaseConstSharedPtr createAndValidateRoute(
     const envoy::config::route::v3::Route& route_config, const CommonVirtualHostSharedPtr& vhost,
     const OptionalHttpFilters& optional_http_filters,
@@ -594,9 +580,9 @@ RouteEntryImplBase::RouteEntryImplBase(const CommonVirtualHostSharedPtr& vhost,
       throw EnvoyException("Sum of weights in the weighted_cluster must be greater than 0.");
     }
 
-    weighted_clusters_config_ =
-        std::make_unique<WeightedClustersConfig>(std::move(weighted_clusters), total_weight,
-                                                 route.route().weighted_clusters().header_name());
+    weighted_clusters_config_ = std::make_unique<WeightedClustersConfig>(
+        std::move(weighted_clusters), total_weight, route.route().weighted_clusters().header_name(),
+        /*fixed_weights=*/runtime_key_prefix.empty());
 
   } else if (route.route().cluster_specifier_case() ==
              envoy::config::route::v3::RouteAction::ClusterSpecifierCase::
@@ -716,6 +702,13 @@ RouteEntryImplBase::RouteEntryImplBase(const CommonVirtualHostSharedPtr& vhost,
   } else {
     early_data_policy_ = std::make_unique<DefaultEarlyDataPolicy>(/*allow_safe_request*/ true);
   }
+
+  // Compile the global, virtual-host and route-level header mutations into flat programs so that
+  // request finalization applies them in a single pass.
+  const bool specificity_ascend = vhost_->globalRouteConfig().mostSpecificHeaderMutationsWins();
+  merged_request_header_parser_ = HeaderParser::merge(getRequestHeaderParsers(specificity_ascend));
+  merged_response_header_parser_ =
+      HeaderParser::merge(getResponseHeaderParsers(specificity_ascend));
 }
 
 bool RouteEntryImplBase::evaluateRuntimeMatch(const uint64_t random_value) const {
@@ -808,17 +801,29 @@ bool RouteEntryImplBase::matchRoute(const Http::RequestHeaderMap& headers,
   return matches;
 }
 
+bool RouteEntryImplBase::memoizable() const {
+  // matchRoute() must consume nothing beyond the path (and, for CONNECT routes, the method), and
+  // clusterEntry() must return the shared route object rather than building one per request.
+  return runtime_ == nullptr && !match_grpc_ && config_headers_.empty() &&
+         config_query_parameters_.empty() && tls_context_match_criteria_ == nullptr &&
+         dynamic_metadata_.empty() && weighted_clusters_config_ == nullptr &&
+         cluster_header_name_.get().empty() && cluster_specifier_plugin_ == nullptr;
+}
+
 const std::string& RouteEntryImplBase::clusterName() const { return cluster_name_; }
 
 void RouteEntryImplBase::finalizeRequestHeaders(Http::RequestHeaderMap& headers,
                                                 const StreamInfo::StreamInfo& stream_info,
                                                 bool insert_envoy_original_path) const {
-  for (const HeaderParser* header_parser : getRequestHeaderParsers(
-           /*specificity_ascend=*/vhost_->globalRouteConfig().mostSpecificHeaderMutationsWins())) {
-    // Later evaluated header parser wins.
-    header_parser->evaluateHeaders(headers, stream_info);
-  }
+  // In the compiled program a later phase wins over an earlier one, matching the old
+  // least-to-most (or most-to-least) specific parser evaluation order.
+  merged_request_header_parser_->evaluateHeaders(headers, stream_info);
+  finalizeRequestRewrites(headers, stream_info, insert_envoy_original_path);
+}
 
+void RouteEntryImplBase::finalizeRequestRewrites(Http::RequestHeaderMap& headers,
+                                                 const StreamInfo::StreamInfo& stream_info,
+                                                 bool insert_envoy_original_path) const {
   // Restore the port if this was a CONNECT request.
   // Note this will restore the port for HTTP/2 CONNECT-upgrades as well as as HTTP/1.1 style
   // CONNECT requests.
@@ -861,39 +866,23 @@ void RouteEntryImplBase::finalizeRequestHeaders(Http::RequestHeaderMap& headers,
 
 void RouteEntryImplBase::finalizeResponseHeaders(Http::ResponseHeaderMap& headers,
                                                  const StreamInfo::StreamInfo& stream_info) const {
-  for (const HeaderParser* header_parser : getResponseHeaderParsers(
-           /*specificity_ascend=*/vhost_->globalRouteConfig().mostSpecificHeaderMutationsWins())) {
-    // Later evaluated header parser wins.
-    header_parser->evaluateHeaders(headers,
-                                   stream_info.getRequestHeaders() == nullptr
-                                       ? *Http::StaticEmptyHeaders::get().request_headers
-                                       : *stream_info.getRequestHeaders(),
-                                   headers, stream_info);
-  }
+  merged_response_header_parser_->evaluateHeaders(headers,
+                                                  stream_info.getRequestHeaders() == nullptr
+                                                      ? *Http::StaticEmptyHeaders::get().request_headers
+                                                      : *stream_info.getRequestHeaders(),
+                                                  headers, stream_info);
 }
 
 Http::HeaderTransforms
 RouteEntryImplBase::responseHeaderTransforms(const StreamInfo::StreamInfo& stream_info,
                                              bool do_formatting) const {
-  Http::HeaderTransforms transforms;
-  for (const HeaderParser* header_parser : getResponseHeaderParsers(
-           /*specificity_ascend=*/vhost_->globalRouteConfig().mostSpecificHeaderMutationsWins())) {
-    // Later evaluated header parser wins.
-    mergeTransforms(transforms, header_parser->getHeaderTransforms(stream_info, do_formatting));
-  }
-  return transforms;
+  return merged_response_header_parser_->getHeaderTransforms(stream_info, do_formatting);
 }
 
 Http::HeaderTransforms
 RouteEntryImplBase::requestHeaderTransforms(const StreamInfo::StreamInfo& stream_info,
                                             bool do_formatting) const {
-  Http::HeaderTransforms transforms;
-  for (const HeaderParser* header_parser : getRequestHeaderParsers(
-           /*specificity_ascend=*/vhost_->globalRouteConfig().mostSpecificHeaderMutationsWins())) {
-    // Later evaluated header parser wins.
-    mergeTransforms(transforms, header_parser->getHeaderTransforms(stream_info, do_formatting));
-  }
-  return transforms;
+  return merged_request_header_parser_->getHeaderTransforms(stream_info, do_formatting);
 }
 
 absl::InlinedVector<const HeaderParser*, 3>
@@ -1272,9 +1261,8 @@ RouteConstSharedPtr RouteEntryImplBase::pickWeightedCluster(const Http::HeaderMa
   // weighted_clusters_config_ is known not to be nullptr here. If it were, pickWeightedCluster
   // would not be called.
   ASSERT(weighted_clusters_config_ != nullptr);
-  if (!weighted_clusters_config_->random_value_header_name_.empty()) {
-    const auto header_value = headers.get(
-        Envoy::Http::LowerCaseString(weighted_clusters_config_->random_value_header_name_));
+  if (!weighted_clusters_config_->random_value_header_name_.get().empty()) {
+    const auto header_value = headers.get(weighted_clusters_config_->random_value_header_name_);
     if (!header_value.empty() && header_value.size() == 1) {
       // We expect single-valued header here, otherwise it will potentially cause inconsistent
       // weighted cluster picking throughout the process because different values are used to
@@ -1297,6 +1285,35 @@ RouteConstSharedPtr RouteEntryImplBase::pickWeightedCluster(const Http::HeaderMa
   const uint64_t selected_value =
       (random_value_from_header.has_value() ? random_value_from_header.value() : random_value) %
       weighted_clusters_config_->total_cluster_weight_;
+
+  const auto cluster_to_route =
+      [this, &headers](const WeightedClusterEntrySharedPtr& cluster) -> RouteConstSharedPtr {
+    if (!cluster->clusterHeaderName().get().empty() &&
+        !headers.get(cluster->clusterHeaderName()).empty()) {
+      return pickClusterViaClusterHeader(cluster->clusterHeaderName(), headers,
+                                         static_cast<RouteEntryAndRoute*>(cluster.get()));
+    }
+    // The WeightedClusterEntry does not contain reference to the RouteEntryImplBase to
+    // avoid circular reference. To ensure that the RouteEntryImplBase is not destructed
+    // before the WeightedClusterEntry, additional wrapper is used to hold the reference
+    // to the RouteEntryImplBase.
+    return std::make_shared<DynamicRouteEntry>(cluster.get(), shared_from_this(),
+                                               cluster->clusterName());
+  };
+
+  // When the weights are fixed at config load, the interval bounds were precomputed and the
+  // matching cluster can be found with a binary search over the same
+  // [0, cluster1_weight), [cluster1_weight, cluster1_weight+cluster2_weight),.. layout the
+  // accumulating walk below produces.
+  const std::vector<uint64_t>& cumulative_weights = weighted_clusters_config_->cumulative_weights_;
+  if (!cumulative_weights.empty()) {
+    const size_t index =
+        std::upper_bound(cumulative_weights.begin(), cumulative_weights.end(), selected_value) -
+        cumulative_weights.begin();
+    ASSERT(index < cumulative_weights.size());
+    return cluster_to_route(weighted_clusters_config_->weighted_clusters_[index]);
+  }
+
   uint64_t begin = 0;
   uint64_t end = 0;
 
@@ -1314,17 +1331,7 @@ RouteConstSharedPtr RouteEntryImplBase::pickWeightedCluster(const Http::HeaderMa
     }
 
     if (selected_value >= begin && selected_value < end) {
-      if (!cluster->clusterHeaderName().get().empty() &&
-          !headers.get(cluster->clusterHeaderName()).empty()) {
-        return pickClusterViaClusterHeader(cluster->clusterHeaderName(), headers,
-                                           static_cast<RouteEntryAndRoute*>(cluster.get()));
-      }
-      // The WeightedClusterEntry does not contain reference to the RouteEntryImplBase to
-      // avoid circular reference. To ensure that the RouteEntryImplBase is not destructed
-      // before the WeightedClusterEntry, additional wrapper is used to hold the reference
-      // to the RouteEntryImplBase.
-      return std::make_shared<DynamicRouteEntry>(cluster.get(), shared_from_this(),
-                                                 cluster->clusterName());
+      return cluster_to_route(cluster);
     }
     begin = end;
   }
@@ -1393,7 +1400,7 @@ RouteEntryImplBase::WeightedClusterEntry::WeightedClusterEntry(
     const envoy::config::route::v3::WeightedCluster::ClusterWeight& cluster,
     const OptionalHttpFilters& optional_http_filters)
     : DynamicRouteEntry(parent, nullptr, validateWeightedClusterSpecifier(cluster).name()),
-      runtime_key_(runtime_key), loader_(factory_context.runtime()),
+      parent_route_(parent), runtime_key_(runtime_key), loader_(factory_context.runtime()),
       cluster_weight_(PROTOBUF_GET_WRAPPED_REQUIRED(cluster, weight)),
       per_filter_configs_(cluster.typed_per_filter_config(), optional_http_filters, factory_context,
                           validator),
@@ -1421,22 +1428,31 @@ RouteEntryImplBase::WeightedClusterEntry::WeightedClusterEntry(
       }
     }
   }
+
+  // Compile the weighted-cluster level mutations together with the parent route's chain, which
+  // is always evaluated after them.
+  const bool specificity_ascend =
+      parent->vhost_->globalRouteConfig().mostSpecificHeaderMutationsWins();
+  absl::InlinedVector<const HeaderParser*, 4> request_parsers{&requestHeaderParser()};
+  const auto parent_request_parsers = parent->getRequestHeaderParsers(specificity_ascend);
+  request_parsers.insert(request_parsers.end(), parent_request_parsers.begin(),
+                         parent_request_parsers.end());
+  merged_request_header_parser_ = HeaderParser::merge(request_parsers);
+  absl::InlinedVector<const HeaderParser*, 4> response_parsers{&responseHeaderParser()};
+  const auto parent_response_parsers = parent->getResponseHeaderParsers(specificity_ascend);
+  response_parsers.insert(response_parsers.end(), parent_response_parsers.begin(),
+                          parent_response_parsers.end());
+  merged_response_header_parser_ = HeaderParser::merge(response_parsers);
 }
 
 Http::HeaderTransforms RouteEntryImplBase::WeightedClusterEntry::requestHeaderTransforms(
     const StreamInfo::StreamInfo& stream_info, bool do_formatting) const {
-  auto transforms = requestHeaderParser().getHeaderTransforms(stream_info, do_formatting);
-  mergeTransforms(transforms,
-                  DynamicRouteEntry::requestHeaderTransforms(stream_info, do_formatting));
-  return transforms;
+  return merged_request_header_parser_->getHeaderTransforms(stream_info, do_formatting);
 }
 
 Http::HeaderTransforms RouteEntryImplBase::WeightedClusterEntry::responseHeaderTransforms(
     const StreamInfo::StreamInfo& stream_info, bool do_formatting) const {
-  auto transforms = responseHeaderParser().getHeaderTransforms(stream_info, do_formatting);
-  mergeTransforms(transforms,
-                  DynamicRouteEntry::responseHeaderTransforms(stream_info, do_formatting));
-  return transforms;
+  return merged_response_header_parser_->getHeaderTransforms(stream_info, do_formatting);
 }
 
 void RouteEntryImplBase::WeightedClusterEntry::traversePerFilterConfig(
@@ -1701,12 +1717,15 @@ CommonVirtualHostImpl::CommonVirtualHostImpl(
     vcluster_scope_ = Stats::Utility::scopeFromStatNames(
         scope, {stat_name_storage_.statName(),
                 factory_context.routerContext().virtualClusterStatNames().vcluster_});
+    const bool defer_stat_creation = factory_context.statsConfig().enableDeferredCreationStats();
     virtual_cluster_catch_all_ = std::make_unique<CatchAllVirtualCluster>(
-        *vcluster_scope_, factory_context.routerContext().virtualClusterStatNames());
+        *vcluster_scope_, factory_context.routerContext().virtualClusterStatNames(),
+        defer_stat_creation);
     for (const auto& virtual_cluster : virtual_host.virtual_clusters()) {
       virtual_clusters_.push_back(
           VirtualClusterEntry(virtual_cluster, *vcluster_scope_,
-                              factory_context.routerContext().virtualClusterStatNames()));
+                              factory_context.routerContext().virtualClusterStatNames(),
+                              defer_stat_creation));
     }
   }
 
@@ -1717,10 +1736,11 @@ CommonVirtualHostImpl::CommonVirtualHostImpl(
 
 CommonVirtualHostImpl::VirtualClusterEntry::VirtualClusterEntry(
     const envoy::config::route::v3::VirtualCluster& virtual_cluster, Stats::Scope& scope,
-    const VirtualClusterStatNames& stat_names)
+    const VirtualClusterStatNames& stat_names, bool defer_stat_creation)
     : StatNameProvider(virtual_cluster.name(), scope.symbolTable()),
       VirtualClusterBase(virtual_cluster.name(), stat_name_storage_.statName(),
-                         scope.scopeFromStatName(stat_name_storage_.statName()), stat_names) {
+                         scope.scopeFromStatName(stat_name_storage_.statName()), stat_names,
+                         defer_stat_creation) {
   if (virtual_cluster.headers().empty()) {
     throw EnvoyException("virtual clusters must define 'headers'");
   }
@@ -1802,12 +1822,67 @@ VirtualHostImpl::VirtualHostImpl(
                                                   optional_http_filters, factory_context, validator,
                                                   validation_clusters));
     }
+    if (routes_.size() >= RouteMatchIndexThreshold) {
+      route_match_index_ = std::make_unique<RouteMatchIndex>(routes_);
+    }
+    memoizable_ = ssl_requirements_ == SslRequirements::None &&
+                  std::all_of(routes_.begin(), routes_.end(),
+                              [](const RouteEntryImplBaseConstSharedPtr& route) {
+                                return route->memoizable();
+                              });
   }
 }
 
 const std::shared_ptr<const SslRedirectRoute> VirtualHostImpl::SSL_REDIRECT_ROUTE{
     new SslRedirectRoute()};
 
+RouteMatchIndex::RouteMatchIndex(absl::Span<const RouteEntryImplBaseConstSharedPtr> routes) {
+  for (uint32_t i = 0; i < routes.size(); ++i) {
+    const RouteEntryImplBase& route = *routes[i];
+    switch (route.matchType()) {
+    case PathMatchType::Exact:
+      if (route.case_sensitive()) {
+        exact_routes_[route.matcher()].push_back(i);
+        continue;
+      }
+      break;
+    case PathMatchType::Prefix:
+    case PathMatchType::PathSeparatedPrefix:
+      // An empty prefix matches every path; keep it with the unindexed rules.
+      if (route.case_sensitive() && !route.matcher().empty()) {
+        prefix_routes_by_length_[route.matcher().size()][route.matcher()].push_back(i);
+        continue;
+      }
+      break;
+    default:
+      // Regex, URI-template and CONNECT rules cannot be pre-filtered by path.
+      break;
+    }
+    unindexed_routes_.push_back(i);
+  }
+}
+
+void RouteMatchIndex::findCandidates(absl::string_view match_path,
+                                     CandidateIndexVec& candidates) const {
+  candidates.insert(candidates.end(), unindexed_routes_.begin(), unindexed_routes_.end());
+  const auto exact = exact_routes_.find(match_path);
+  if (exact != exact_routes_.end()) {
+    candidates.insert(candidates.end(), exact->second.begin(), exact->second.end());
+  }
+  for (const auto& [length, prefixes] : prefix_routes_by_length_) {
+    if (length > match_path.size()) {
+      break; // The map is ordered by length, so no longer prefix can match.
+    }
+    const auto prefix = prefixes.find(match_path.substr(0, length));
+    if (prefix != prefixes.end()) {
+      candidates.insert(candidates.end(), prefix->second.begin(), prefix->second.end());
+    }
+  }
+  // The per-bucket vectors are each ordered and a route appears in exactly one
+  // bucket, so sorting restores route-table order across the buckets.
+  std::sort(candidates.begin(), candidates.end());
+}
+
 RouteConstSharedPtr VirtualHostImpl::getRouteFromRoutes(
     const RouteCallback& cb, const Http::RequestHeaderMap& headers,
     const StreamInfo::StreamInfo& stream_info, uint64_t random_value,
@@ -1893,10 +1968,62 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
     return nullptr;
   }
 
-  // Check for a route that matches the request.
+  // Check for a route that matches the request. The compiled index is only
+  // used for plain lookups: RouteCallback consumers observe a per-route
+  // evaluation status that is only well-defined for a full linear scan.
+  if (route_match_index_ != nullptr && cb == nullptr && headers.Path() != nullptr) {
+    return getRouteFromIndex(headers, stream_info, random_value);
+  }
   return getRouteFromRoutes(cb, headers, stream_info, random_value, routes_);
 }
 
+RouteConstSharedPtr VirtualHostImpl::getRouteFromIndex(const Http::RequestHeaderMap& headers,
+                                                       const StreamInfo::StreamInfo& stream_info,
+                                                       uint64_t random_value) const {
+  // Reproduce the sanitization the individual path matchers apply, so that
+  // index keys are compared against exactly the bytes the matchers would see.
+  absl::string_view match_path = headers.getPathValue();
+  if (shared_virtual_host_->globalRouteConfig().ignorePathParametersInPathMatching()) {
+    const auto pos = match_path.find_first_of(';');
+    if (pos != absl::string_view::npos) {
+      match_path.remove_suffix(match_path.length() - pos);
+    }
+  }
+  match_path = Http::PathUtil::removeQueryAndFragment(match_path);
+
+  RouteMatchIndex::CandidateIndexVec candidates;
+  route_match_index_->findCandidates(match_path, candidates);
+
+  absl::optional<uint32_t> matched_index;
+  RouteConstSharedPtr route_entry;
+  for (const uint32_t index : candidates) {
+    route_entry = routes_[index]->matches(headers, stream_info, random_value);
+    if (route_entry != nullptr) {
+      matched_index = index;
+      break;
+    }
+  }
+
+  if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.check_route_match_index_parity")) {
+    // matches() is deterministic for a fixed random_value, so re-running the
+    // scan linearly must select the same route-table entry.
+    absl::optional<uint32_t> linear_index;
+    for (uint32_t i = 0; i < routes_.size(); ++i) {
+      if (routes_[i]->matches(headers, stream_info, random_value) != nullptr) {
+        linear_index = i;
+        break;
+      }
+    }
+    ENVOY_BUG(matched_index == linear_index,
+              "route match index diverged from linear route matching");
+  }
+
+  if (route_entry == nullptr) {
+    ENVOY_LOG(debug, "route was resolved but final route list did not match incoming request");
+  }
+  return route_entry;
+}
+
 const VirtualHostImpl* RouteMatcher::findWildcardVirtualHost(
     absl::string_view host, const RouteMatcher::WildcardVirtualHosts& wildcard_virtual_hosts,
     RouteMatcher::SubstringFunction substring_function) const {
@@ -1923,18 +2050,37 @@ RouteMatcher::RouteMatcher(const envoy::config::route::v3::RouteConfiguration& r
                            const OptionalHttpFilters& optional_http_filters,
                            const CommonConfigSharedPtr& global_route_config,
                            Server::Configuration::ServerFactoryContext& factory_context,
-                           ProtobufMessage::ValidationVisitor& validator, bool validate_clusters)
+                           ProtobufMessage::ValidationVisitor& validator, bool validate_clusters,
+                           const RouteMatcher* previous_route_matcher)
     : vhost_scope_(factory_context.scope().scopeFromStatName(
           factory_context.routerContext().virtualClusterStatNames().vhost_)),
       ignore_port_in_host_matching_(route_config.ignore_port_in_host_matching()) {
   absl::optional<Upstream::ClusterManager::ClusterInfoMaps> validation_clusters;
   if (validate_clusters) {
     validation_clusters = factory_context.clusterManager().clusters();
+    // Cluster validation must re-run against the current cluster set, so previously built virtual
+    // hosts cannot be reused.
+    previous_route_matcher = nullptr;
   }
   for (const auto& virtual_host_config : route_config.virtual_hosts()) {
-    VirtualHostSharedPtr virtual_host = std::make_shared<VirtualHostImpl>(
-        virtual_host_config, optional_http_filters, global_route_config, factory_context,
-        *vhost_scope_, validator, validation_clusters);
+    const uint64_t virtual_host_hash = MessageUtil::hash(virtual_host_config);
+    VirtualHostSharedPtr virtual_host;
+    if (previous_route_matcher != nullptr) {
+      // Hashing the proto is much cheaper than rebuilding the virtual host (route parsing, regex
+      // compilation, per-filter config resolution, ..), so unchanged virtual hosts are shared
+      // with the previous config generation.
+      const auto it = previous_route_matcher->virtual_hosts_by_hash_.find(virtual_host_hash);
+      if (it != previous_route_matcher->virtual_hosts_by_hash_.end()) {
+        virtual_host = it->second;
+      }
+    }
+    if (virtual_host == nullptr) {
+      virtual_host = std::make_shared<VirtualHostImpl>(
+          virtual_host_config, optional_http_filters, global_route_config, factory_context,
+          *vhost_scope_, validator, validation_clusters);
+    }
+    virtual_hosts_by_hash_.emplace(virtual_host_hash, virtual_host);
+    all_virtual_hosts_memoizable_ &= virtual_host->memoizable();
     for (const std::string& domain_name : virtual_host_config.domains()) {
       const Http::LowerCaseString lower_case_domain_name(domain_name);
       absl::string_view domain = lower_case_domain_name;
@@ -2096,18 +2242,40 @@ CommonConfigImpl::clusterSpecifierPlugin(absl::string_view provider) const {
   return iter->second;
 }
 
+namespace {
+
+// Hash of the route configuration with the virtual_hosts field cleared. Two config generations
+// may only share virtual hosts when these hashes match: a shared virtual host keeps referencing
+// its own generation's CommonConfigImpl (global header mutations, shadow policies, ..), which is
+// only equivalent to the new one when everything outside the virtual hosts is unchanged.
+uint64_t virtualHostIndependentConfigHash(const envoy::config::route::v3::RouteConfiguration& config) {
+  envoy::config::route::v3::RouteConfiguration stripped(config);
+  stripped.clear_virtual_hosts();
+  return MessageUtil::hash(stripped);
+}
+
+} // namespace
+
 ConfigImpl::ConfigImpl(const envoy::config::route::v3::RouteConfiguration& config,
                        const OptionalHttpFilters& optional_http_filters,
                        Server::Configuration::ServerFactoryContext& factory_context,
-                       ProtobufMessage::ValidationVisitor& validator,
-                       bool validate_clusters_default) {
+                       ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default,
+                       const ConfigImpl* previous_config) {
 
   shared_config_ =
       std::make_shared<CommonConfigImpl>(config, optional_http_filters, factory_context, validator);
 
+  vhost_independent_config_hash_ = virtualHostIndependentConfigHash(config);
+  const RouteMatcher* previous_route_matcher = nullptr;
+  if (previous_config != nullptr &&
+      previous_config->vhost_independent_config_hash_ == vhost_independent_config_hash_) {
+    previous_route_matcher = previous_config->route_matcher_.get();
+  }
+
   route_matcher_ = std::make_unique<RouteMatcher>(
       config, optional_http_filters, shared_config_, factory_context, validator,
-      PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, validate_clusters, validate_clusters_default));
+      PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, validate_clusters, validate_clusters_default),
+      previous_route_matcher);
 }
 
 RouteConstSharedPtr ConfigImpl::route(const RouteCallback& cb,
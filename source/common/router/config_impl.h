@@ -34,8 +34,12 @@
 #include "source/common/router/metadatamatchcriteria_impl.h"
 #include "source/common/router/router_ratelimit.h"
 #include "source/common/router/tls_context_match_criteria_impl.h"
+#include "source/common/stats/deferred_creation.h"
 #include "source/common/stats/symbol_table.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -169,6 +173,22 @@ public:
       allow_origins_.push_back(
           std::make_unique<Matchers::StringMatcherImpl<envoy::type::matcher::v3::StringMatcher>>(
               string_match));
+      // Compile the matcher into a form that can be probed in ~constant time by originAllowed().
+      // A matcher that matches the literal "*" allows any origin; case-sensitive exact and
+      // suffix matchers go into hash sets; everything else is evaluated one by one.
+      if (allow_origins_.back()->match("*")) {
+        allow_any_origin_ = true;
+      } else if (string_match.match_pattern_case() ==
+                     envoy::type::matcher::v3::StringMatcher::MatchPatternCase::kExact &&
+                 !string_match.ignore_case()) {
+        exact_allow_origins_.insert(string_match.exact());
+      } else if (string_match.match_pattern_case() ==
+                     envoy::type::matcher::v3::StringMatcher::MatchPatternCase::kSuffix &&
+                 !string_match.ignore_case()) {
+        suffix_allow_origins_.insert(string_match.suffix());
+      } else {
+        other_allow_origins_.push_back(allow_origins_.back().get());
+      }
     }
     if (config.has_allow_credentials()) {
       allow_credentials_ = PROTOBUF_GET_WRAPPED_REQUIRED(config, allow_credentials);
@@ -183,6 +203,26 @@ public:
   const std::vector<Matchers::StringMatcherPtr>& allowOrigins() const override {
     return allow_origins_;
   };
+  bool originAllowed(absl::string_view origin) const override {
+    if (allow_any_origin_ || exact_allow_origins_.contains(origin)) {
+      return true;
+    }
+    if (!suffix_allow_origins_.empty()) {
+      // Probe the set with every suffix of the origin so that the cost scales with the origin
+      // length rather than with the number of configured suffix patterns.
+      for (size_t i = 0; i < origin.size(); ++i) {
+        if (suffix_allow_origins_.contains(origin.substr(i))) {
+          return true;
+        }
+      }
+    }
+    for (const auto* matcher : other_allow_origins_) {
+      if (matcher->match(origin)) {
+        return true;
+      }
+    }
+    return false;
+  };
   const std::string& allowMethods() const override { return allow_methods_; };
   const std::string& allowHeaders() const override { return allow_headers_; };
   const std::string& exposeHeaders() const override { return expose_headers_; };
@@ -212,6 +252,13 @@ private:
   const ProtoType config_;
   Runtime::Loader& loader_;
   std::vector<Matchers::StringMatcherPtr> allow_origins_;
+  // Compiled view of allow_origins_: each matcher is represented in exactly one of
+  // allow_any_origin_, exact_allow_origins_, suffix_allow_origins_ or other_allow_origins_.
+  // The raw pointers are owned by allow_origins_.
+  bool allow_any_origin_{false};
+  absl::flat_hash_set<std::string> exact_allow_origins_;
+  absl::flat_hash_set<std::string> suffix_allow_origins_;
+  std::vector<const Matchers::StringMatcher*> other_allow_origins_;
   const std::string allow_methods_;
   const std::string allow_headers_;
   const std::string expose_headers_;
@@ -299,34 +346,39 @@ private:
   struct VirtualClusterBase : public VirtualCluster {
   public:
     VirtualClusterBase(const absl::optional<std::string>& name, Stats::StatName stat_name,
-                       Stats::ScopeSharedPtr&& scope, const VirtualClusterStatNames& stat_names)
+                       Stats::ScopeSharedPtr&& scope, const VirtualClusterStatNames& stat_names,
+                       bool defer_stat_creation)
         : name_(name), stat_name_(stat_name), scope_(std::move(scope)),
-          stats_(generateStats(*scope_, stat_names)) {}
+          stats_(Stats::createDeferredCompatibleStats<VirtualClusterStats>(scope_, stat_names,
+                                                                           defer_stat_creation)) {}
 
     // Router::VirtualCluster
     // name_ and stat_name_ are two different representations for the same string, retained in
     // memory to avoid symbol-table locks that would be needed when converting on-the-fly.
     const absl::optional<std::string>& name() const override { return name_; }
     Stats::StatName statName() const override { return stat_name_; }
-    VirtualClusterStats& stats() const override { return stats_; }
+    VirtualClusterStats& stats() const override { return *stats_; }
 
   private:
     const absl::optional<std::string> name_;
     const Stats::StatName stat_name_;
     Stats::ScopeSharedPtr scope_;
-    mutable VirtualClusterStats stats_;
+    mutable Stats::DeferredCreationCompatibleStats<VirtualClusterStats> stats_;
   };
 
   struct VirtualClusterEntry : public StatNameProvider, public VirtualClusterBase {
     VirtualClusterEntry(const envoy::config::route::v3::VirtualCluster& virtual_cluster,
-                        Stats::Scope& scope, const VirtualClusterStatNames& stat_names);
+                        Stats::Scope& scope, const VirtualClusterStatNames& stat_names,
+                        bool defer_stat_creation);
     std::vector<Http::HeaderUtility::HeaderDataPtr> headers_;
   };
 
   struct CatchAllVirtualCluster : public VirtualClusterBase {
-    CatchAllVirtualCluster(Stats::Scope& scope, const VirtualClusterStatNames& stat_names)
+    CatchAllVirtualCluster(Stats::Scope& scope, const VirtualClusterStatNames& stat_names,
+                           bool defer_stat_creation)
         : VirtualClusterBase(absl::nullopt, stat_names.other_,
-                             scope.scopeFromStatName(stat_names.other_), stat_names) {}
+                             scope.scopeFromStatName(stat_names.other_), stat_names,
+                             defer_stat_creation) {}
   };
 
   const Stats::StatNameManagedStorage stat_name_storage_;
@@ -353,6 +405,46 @@ private:
 
 using CommonVirtualHostSharedPtr = std::shared_ptr<CommonVirtualHostImpl>;
 
+/**
+ * Compiled index over a virtual host's route table, built at config-load time
+ * when the table is large. For a request path it yields the ordered subset of
+ * routes whose path criterion could match: exact-path rules via a hash lookup,
+ * prefix-style rules via length-bucketed hash lookups (mirroring the
+ * wildcard-domain matching in RouteMatcher), and rules that cannot be
+ * pre-filtered by path (regex, URI-template, CONNECT, case-insensitive, empty
+ * prefix) unconditionally. Every candidate still runs the full
+ * Matchable::matches() check, so header, query-parameter and runtime
+ * predicates behave exactly as in a linear scan, and candidates are produced
+ * in route-table order to preserve first-match-wins semantics.
+ */
+class RouteMatchIndex {
+public:
+  using CandidateIndexVec = absl::InlinedVector<uint32_t, 16>;
+
+  explicit RouteMatchIndex(absl::Span<const RouteEntryImplBaseConstSharedPtr> routes);
+
+  /**
+   * Appends to candidates, in route-table order, the index of every route
+   * whose path criterion could match match_path. match_path must already have
+   * the query, fragment and (when so configured) path-parameters removed, as
+   * the individual path matchers would do before comparing.
+   */
+  void findCandidates(absl::string_view match_path, CandidateIndexVec& candidates) const;
+
+private:
+  using RouteIndexVec = std::vector<uint32_t>;
+  using PathMap = absl::flat_hash_map<std::string, RouteIndexVec>;
+
+  // Case-sensitive exact-path rules, keyed by the full path.
+  PathMap exact_routes_;
+  // Case-sensitive prefix and path-separated-prefix rules, bucketed by prefix
+  // length, so a lookup probes one hash-map per distinct length present in the
+  // route table rather than examining every rule.
+  std::map<size_t, PathMap> prefix_routes_by_length_;
+  // Rules that cannot be pre-filtered by path; always candidates.
+  RouteIndexVec unindexed_routes_;
+};
+
 /**
  * Virtual host that holds a collection of routes.
  */
@@ -376,17 +468,33 @@ public:
                      const StreamInfo::StreamInfo& stream_info, uint64_t random_value,
                      absl::Span<const RouteEntryImplBaseConstSharedPtr> routes) const;
 
+  // Whether every route in this virtual host is RouteEntryImplBase::memoizable() and route
+  // selection itself consumes nothing beyond :path and :method. Matcher-tree virtual hosts and
+  // virtual hosts with an SSL requirement (whose redirect decision reads x-forwarded-proto) do
+  // not qualify.
+  bool memoizable() const { return memoizable_; }
+
 private:
   enum class SslRequirements : uint8_t { None, ExternalOnly, All };
 
   static const std::shared_ptr<const SslRedirectRoute> SSL_REDIRECT_ROUTE;
 
+  // Route tables below this size are matched with a plain linear scan; the
+  // compiled index only pays off once tables get large.
+  static constexpr size_t RouteMatchIndexThreshold = 32;
+
+  RouteConstSharedPtr getRouteFromIndex(const Http::RequestHeaderMap& headers,
+                                        const StreamInfo::StreamInfo& stream_info,
+                                        uint64_t random_value) const;
+
   CommonVirtualHostSharedPtr shared_virtual_host_;
 
   SslRequirements ssl_requirements_;
 
   std::vector<RouteEntryImplBaseConstSharedPtr> routes_;
+  std::unique_ptr<RouteMatchIndex> route_match_index_;
   Matcher::MatchTreeSharedPtr<Http::HttpMatchingData> matcher_;
+  bool memoizable_{false};
 };
 
 using VirtualHostSharedPtr = std::shared_ptr<VirtualHostImpl>;
@@ -629,6 +737,15 @@ public:
                   uint64_t random_value) const;
   void validateClusters(const Upstream::ClusterManager::ClusterInfoMaps& cluster_info_maps) const;
 
+  bool case_sensitive() const { return case_sensitive_; }
+
+  // Whether a successful match of this route depends only on the request's :path and :method, and
+  // yields a route object that is shared rather than built per request. Routes with header,
+  // query-parameter, runtime, gRPC, TLS-context or dynamic-metadata predicates, weighted clusters,
+  // a cluster header or a cluster specifier plugin do not qualify. Used to decide whether
+  // per-connection route memoization is safe; see Config::supportsRouteMemoization().
+  bool memoizable() const;
+
   // Router::RouteEntry
   const std::string& clusterName() const override;
   const RouteStatsContextOptRef routeStatsContext() const override {
@@ -993,10 +1110,14 @@ public:
     void finalizeRequestHeaders(Http::RequestHeaderMap& headers,
                                 const StreamInfo::StreamInfo& stream_info,
                                 bool insert_envoy_original_path) const override {
-      requestHeaderParser().evaluateHeaders(headers, stream_info);
-      if (!host_rewrite_.empty()) {
-        headers.setHost(host_rewrite_);
+      if (host_rewrite_.empty()) {
+        // The weighted-cluster and route-chain mutations were compiled into a single program.
+        merged_request_header_parser_->evaluateHeaders(headers, stream_info);
+        parent_route_->finalizeRequestRewrites(headers, stream_info, insert_envoy_original_path);
+        return;
       }
+      requestHeaderParser().evaluateHeaders(headers, stream_info);
+      headers.setHost(host_rewrite_);
       DynamicRouteEntry::finalizeRequestHeaders(headers, stream_info, insert_envoy_original_path);
     }
     Http::HeaderTransforms requestHeaderTransforms(const StreamInfo::StreamInfo& stream_info,
@@ -1007,8 +1128,8 @@ public:
           stream_info.getRequestHeaders() == nullptr
               ? *Http::StaticEmptyHeaders::get().request_headers
               : *stream_info.getRequestHeaders();
-      responseHeaderParser().evaluateHeaders(headers, request_headers, headers, stream_info);
-      DynamicRouteEntry::finalizeResponseHeaders(headers, stream_info);
+      merged_response_header_parser_->evaluateHeaders(headers, request_headers, headers,
+                                                      stream_info);
     }
     Http::HeaderTransforms responseHeaderTransforms(const StreamInfo::StreamInfo& stream_info,
                                                     bool do_formatting = true) const override;
@@ -1033,12 +1154,19 @@ public:
     const Http::LowerCaseString& clusterHeaderName() const { return cluster_header_name_; }
 
   private:
+    const RouteEntryImplBase* parent_route_;
     const std::string runtime_key_;
     Runtime::Loader& loader_;
     const uint64_t cluster_weight_;
     MetadataMatchCriteriaConstPtr cluster_metadata_match_criteria_;
     HeaderParserPtr request_headers_parser_;
     HeaderParserPtr response_headers_parser_;
+    // The weighted-cluster level mutations above together with the parent route's chain, compiled
+    // into single flat programs at config time; see HeaderParser::merge(). The request program is
+    // only usable for finalization when there is no host_rewrite_, which must apply between the
+    // weighted-cluster and route-level mutations.
+    HeaderParserPtr merged_request_header_parser_;
+    HeaderParserPtr merged_response_header_parser_;
     PerFilterConfigs per_filter_configs_;
     const std::string host_rewrite_;
     const Http::LowerCaseString cluster_header_name_;
@@ -1051,13 +1179,26 @@ public:
   struct WeightedClustersConfig {
     WeightedClustersConfig(const std::vector<WeightedClusterEntrySharedPtr>&& weighted_clusters,
                            uint64_t total_cluster_weight,
-                           const std::string& random_value_header_name)
+                           const std::string& random_value_header_name, bool fixed_weights)
         : weighted_clusters_(std::move(weighted_clusters)),
           total_cluster_weight_(total_cluster_weight),
-          random_value_header_name_(random_value_header_name) {}
+          random_value_header_name_(random_value_header_name) {
+      if (fixed_weights) {
+        cumulative_weights_.reserve(weighted_clusters_.size());
+        uint64_t end = 0;
+        for (const WeightedClusterEntrySharedPtr& cluster : weighted_clusters_) {
+          end += cluster->clusterWeight();
+          cumulative_weights_.push_back(end);
+        }
+      }
+    }
     const std::vector<WeightedClusterEntrySharedPtr> weighted_clusters_;
     const uint64_t total_cluster_weight_;
-    const std::string random_value_header_name_;
+    const Http::LowerCaseString random_value_header_name_;
+    // Upper interval bounds per cluster, precomputed when no runtime_key_prefix is configured
+    // (i.e. the weights cannot change after config load). Empty when weights are runtime-keyed,
+    // in which case selection falls back to accumulating the weights per request.
+    std::vector<uint64_t> cumulative_weights_;
   };
 
 protected:
@@ -1069,7 +1210,6 @@ protected:
   const std::string host_rewrite_;
   std::unique_ptr<ConnectConfig> connect_config_;
 
-  bool case_sensitive() const { return case_sensitive_; }
   RouteConstSharedPtr clusterEntry(const Http::RequestHeaderMap& headers,
                                    uint64_t random_value) const;
 
@@ -1117,6 +1257,15 @@ private:
   absl::InlinedVector<const HeaderParser*, 3>
   getResponseHeaderParsers(bool specificity_ascend) const;
 
+  /**
+   * Applies the non-header-mutation part of request finalization: CONNECT port restoration and
+   * the host and path rewrites. Split out of finalizeRequestHeaders() so that entries whose
+   * header mutations were compiled into a merged parser can run it separately.
+   */
+  void finalizeRequestRewrites(Http::RequestHeaderMap& headers,
+                               const StreamInfo::StreamInfo& stream_info,
+                               bool insert_envoy_original_path) const;
+
   std::unique_ptr<const RuntimeData>
   loadRuntimeData(const envoy::config::route::v3::RouteMatch& route);
 
@@ -1204,6 +1353,10 @@ private:
   TlsContextMatchCriteriaConstPtr tls_context_match_criteria_;
   HeaderParserPtr request_headers_parser_;
   HeaderParserPtr response_headers_parser_;
+  // The global, virtual-host and route-level header mutations above, compiled into single flat
+  // programs at config time; see HeaderParser::merge().
+  HeaderParserPtr merged_request_header_parser_;
+  HeaderParserPtr merged_response_header_parser_;
   std::unique_ptr<const envoy::config::core::v3::Metadata> metadata_;
   std::unique_ptr<const RouteTypedMetadata> typed_metadata_;
   const std::vector<Envoy::Matchers::MetadataMatcher> dynamic_metadata_;
@@ -1495,17 +1648,26 @@ DECLARE_FACTORY(RouteListMatchActionFactory);
  */
 class RouteMatcher {
 public:
+  // When previous_route_matcher is provided, virtual hosts whose protos are unchanged since the
+  // previous config generation are shared rather than rebuilt. The caller must guarantee that
+  // doing so is safe, i.e. that the virtual-host independent parts of the route configuration are
+  // unchanged and that no cluster re-validation is required; see ConfigImpl's constructor.
   RouteMatcher(const envoy::config::route::v3::RouteConfiguration& config,
                const OptionalHttpFilters& optional_http_filters,
                const CommonConfigSharedPtr& global_route_config,
                Server::Configuration::ServerFactoryContext& factory_context,
-               ProtobufMessage::ValidationVisitor& validator, bool validate_clusters);
+               ProtobufMessage::ValidationVisitor& validator, bool validate_clusters,
+               const RouteMatcher* previous_route_matcher = nullptr);
 
   RouteConstSharedPtr route(const RouteCallback& cb, const Http::RequestHeaderMap& headers,
                             const StreamInfo::StreamInfo& stream_info, uint64_t random_value) const;
 
   const VirtualHostImpl* findVirtualHost(const Http::RequestHeaderMap& headers) const;
 
+  // Whether every virtual host in the table is VirtualHostImpl::memoizable(). Virtual host
+  // selection itself depends only on :authority.
+  bool allVirtualHostsMemoizable() const { return all_virtual_hosts_memoizable_; }
+
 private:
   using WildcardVirtualHosts =
       std::map<int64_t, absl::node_hash_map<std::string, VirtualHostSharedPtr>, std::greater<>>;
@@ -1530,7 +1692,13 @@ private:
   WildcardVirtualHosts wildcard_virtual_host_prefixes_;
 
   VirtualHostSharedPtr default_virtual_host_;
+  // Virtual hosts keyed by the hash of their config proto, so that an unchanged virtual host can
+  // be structurally shared with the next config generation instead of being rebuilt. Virtual
+  // hosts keep their own generation's CommonConfigImpl alive through a shared_ptr, so sharing is
+  // lifetime-safe.
+  absl::flat_hash_map<uint64_t, VirtualHostSharedPtr> virtual_hosts_by_hash_;
   const bool ignore_port_in_host_matching_{false};
+  bool all_virtual_hosts_memoizable_{true};
 };
 
 /**
@@ -1603,10 +1771,15 @@ private:
  */
 class ConfigImpl : public Config {
 public:
+  // previous_config, when provided, is the config generation being replaced (e.g. by an RDS
+  // push). Virtual hosts whose protos are unchanged are then shared with the previous generation
+  // instead of being rebuilt, provided the virtual-host independent parts of the configuration
+  // are also unchanged and no cluster validation is requested.
   ConfigImpl(const envoy::config::route::v3::RouteConfiguration& config,
              const OptionalHttpFilters& optional_http_filters,
              Server::Configuration::ServerFactoryContext& factory_context,
-             ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default);
+             ProtobufMessage::ValidationVisitor& validator, bool validate_clusters_default,
+             const ConfigImpl* previous_config = nullptr);
 
   bool virtualHostExists(const Http::RequestHeaderMap& headers) const {
     return route_matcher_->findVirtualHost(headers) != nullptr;
@@ -1638,10 +1811,16 @@ public:
   bool ignorePathParametersInPathMatching() const {
     return shared_config_->ignorePathParametersInPathMatching();
   }
+  bool supportsRouteMemoization() const override {
+    return route_matcher_->allVirtualHostsMemoizable();
+  }
 
 private:
   CommonConfigSharedPtr shared_config_;
   std::unique_ptr<RouteMatcher> route_matcher_;
+  // Hash of the configuration proto with virtual_hosts cleared; two generations may share
+  // virtual hosts only when these match.
+  uint64_t vhost_independent_config_hash_{};
 };
 
 /**
@@ -1668,6 +1847,7 @@ public:
   bool usesVhds() const override { return false; }
   bool mostSpecificHeaderMutationsWins() const override { return false; }
   uint32_t maxDirectResponseBodySizeBytes() const override { return 0; }
+  bool supportsRouteMemoization() const override { return false; }
 
 private:
   std::list<Http::LowerCaseString> internal_only_headers_;
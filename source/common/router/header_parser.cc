@@ -14,6 +14,7 @@
 #include "source/common/json/json_loader.h"
 #include "source/common/protobuf/utility.h"
 
+#include "absl/container/flat_hash_set.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_replace.h"
 
@@ -77,13 +78,20 @@ HeadersToAddEntry::HeadersToAddEntry(const HeaderValue& header_value,
   formatter_ = parseHttpHeaderFormatter(header_value);
 }
 
+HeaderParser::MutationPhase& HeaderParser::singlePhase() {
+  if (phases_.empty()) {
+    phases_.emplace_back();
+  }
+  return phases_.front();
+}
+
 HeaderParserPtr
 HeaderParser::configure(const Protobuf::RepeatedPtrField<HeaderValueOption>& headers_to_add) {
   HeaderParserPtr header_parser(new HeaderParser());
   for (const auto& header_value_option : headers_to_add) {
-    header_parser->headers_to_add_.emplace_back(
+    header_parser->singlePhase().headers_to_add_.emplace_back(
         Http::LowerCaseString(header_value_option.header().key()),
-        HeadersToAddEntry{header_value_option});
+        std::make_shared<const HeadersToAddEntry>(header_value_option));
   }
 
   return header_parser;
@@ -95,8 +103,9 @@ HeaderParserPtr HeaderParser::configure(
   HeaderParserPtr header_parser(new HeaderParser());
 
   for (const auto& header_value : headers_to_add) {
-    header_parser->headers_to_add_.emplace_back(Http::LowerCaseString(header_value.key()),
-                                                HeadersToAddEntry{header_value, append_action});
+    header_parser->singlePhase().headers_to_add_.emplace_back(
+        Http::LowerCaseString(header_value.key()),
+        std::make_shared<const HeadersToAddEntry>(header_value, append_action));
   }
 
   return header_parser;
@@ -114,12 +123,50 @@ HeaderParser::configure(const Protobuf::RepeatedPtrField<HeaderValueOption>& hea
     if (!Http::HeaderUtility::isRemovableHeader(header)) {
       throw EnvoyException(":-prefixed or host headers may not be removed");
     }
-    header_parser->headers_to_remove_.emplace_back(header);
+    header_parser->singlePhase().headers_to_remove_.emplace_back(header);
   }
 
   return header_parser;
 }
 
+HeaderParserPtr HeaderParser::merge(absl::Span<const HeaderParser* const> parsers) {
+  HeaderParserPtr merged(new HeaderParser());
+  // Keys that an earlier phase has removed and no later phase has added back; a removal of such
+  // a key is a no-op and can be dropped from the compiled program.
+  absl::flat_hash_set<absl::string_view> already_removed;
+  for (const HeaderParser* parser : parsers) {
+    for (const MutationPhase& phase : parser->phases_) {
+      MutationPhase compiled;
+      for (const auto& header : phase.headers_to_remove_) {
+        if (already_removed.insert(header.get()).second) {
+          compiled.headers_to_remove_.push_back(header);
+        }
+      }
+      for (const auto& entry : phase.headers_to_add_) {
+        // The key may exist again, so a later removal of it must be kept.
+        already_removed.erase(entry.first.get());
+        compiled.headers_to_add_.push_back(entry);
+      }
+      if (compiled.headers_to_remove_.empty() && compiled.headers_to_add_.empty()) {
+        continue;
+      }
+      // A preceding phase without additions cannot influence what this phase's formatters
+      // observe, so the two can be folded together.
+      if (!merged->phases_.empty() && merged->phases_.back().headers_to_add_.empty()) {
+        MutationPhase& back = merged->phases_.back();
+        back.headers_to_remove_.insert(back.headers_to_remove_.end(),
+                                       compiled.headers_to_remove_.begin(),
+                                       compiled.headers_to_remove_.end());
+        back.headers_to_add_ = std::move(compiled.headers_to_add_);
+      } else {
+        merged->phases_.push_back(std::move(compiled));
+      }
+    }
+  }
+
+  return merged;
+}
+
 void HeaderParser::evaluateHeaders(Http::HeaderMap& headers,
                                    const Http::RequestHeaderMap& request_headers,
                                    const Http::ResponseHeaderMap& response_headers,
@@ -131,14 +178,8 @@ void HeaderParser::evaluateHeaders(Http::HeaderMap& headers,
                                    const Http::RequestHeaderMap& request_headers,
                                    const Http::ResponseHeaderMap& response_headers,
                                    const StreamInfo::StreamInfo* stream_info) const {
-  // Removing headers in the headers_to_remove_ list first makes
-  // remove-before-add the default behavior as expected by users.
-  for (const auto& header : headers_to_remove_) {
-    headers.remove(header);
-  }
-
   // Temporary storage to hold evaluated values of headers to add and replace. This is required
-  // to execute all formatters using the original received headers.
+  // to execute all formatters of a phase using the headers as received at the start of the phase.
   // Only after all the formatters produced the new values of the headers, the headers are set.
   // absl::InlinedVector is optimized for 4 headers. After that it behaves as normal std::vector.
   // It is assumed that most of the use cases will add or modify fairly small number of headers
@@ -156,45 +197,55 @@ void HeaderParser::evaluateHeaders(Http::HeaderMap& headers,
   // header_formatter_speed_test.cc this approach strikes the best balance between performance and
   // readability.
   std::string value_buffer;
-  for (const auto& [key, entry] : headers_to_add_) {
-    absl::string_view value;
-    if (stream_info != nullptr) {
-      value_buffer = entry.formatter_->format(request_headers, response_headers, *stream_info);
-      value = value_buffer;
-    } else {
-      value = entry.original_value_;
+  for (const MutationPhase& phase : phases_) {
+    // Removing a phase's headers first makes remove-before-add the default behavior as expected
+    // by users.
+    for (const auto& header : phase.headers_to_remove_) {
+      headers.remove(header);
     }
-    if (!value.empty() || entry.add_if_empty_) {
-      switch (entry.append_action_) {
-        PANIC_ON_PROTO_ENUM_SENTINEL_VALUES;
-      case HeaderValueOption::APPEND_IF_EXISTS_OR_ADD:
-        headers_to_add.emplace_back(key, value);
-        break;
-      case HeaderValueOption::ADD_IF_ABSENT:
-        if (auto header_entry = headers.get(key); header_entry.empty()) {
+
+    headers_to_add.clear();
+    headers_to_overwrite.clear();
+    for (const auto& [key, entry] : phase.headers_to_add_) {
+      absl::string_view value;
+      if (stream_info != nullptr) {
+        value_buffer = entry->formatter_->format(request_headers, response_headers, *stream_info);
+        value = value_buffer;
+      } else {
+        value = entry->original_value_;
+      }
+      if (!value.empty() || entry->add_if_empty_) {
+        switch (entry->append_action_) {
+          PANIC_ON_PROTO_ENUM_SENTINEL_VALUES;
+        case HeaderValueOption::APPEND_IF_EXISTS_OR_ADD:
           headers_to_add.emplace_back(key, value);
-        }
-        break;
-      case HeaderValueOption::OVERWRITE_IF_EXISTS:
-        if (headers.get(key).empty()) {
+          break;
+        case HeaderValueOption::ADD_IF_ABSENT:
+          if (auto header_entry = headers.get(key); header_entry.empty()) {
+            headers_to_add.emplace_back(key, value);
+          }
+          break;
+        case HeaderValueOption::OVERWRITE_IF_EXISTS:
+          if (headers.get(key).empty()) {
+            break;
+          }
+          FALLTHRU;
+        case HeaderValueOption::OVERWRITE_IF_EXISTS_OR_ADD:
+          headers_to_overwrite.emplace_back(key, value);
           break;
         }
-        FALLTHRU;
-      case HeaderValueOption::OVERWRITE_IF_EXISTS_OR_ADD:
-        headers_to_overwrite.emplace_back(key, value);
-        break;
       }
     }
-  }
 
-  // First overwrite all headers which need to be overwritten.
-  for (const auto& header : headers_to_overwrite) {
-    headers.setReferenceKey(header.first, header.second);
-  }
+    // First overwrite all headers which need to be overwritten.
+    for (const auto& header : headers_to_overwrite) {
+      headers.setReferenceKey(header.first, header.second);
+    }
 
-  // Now add headers which should be added.
-  for (const auto& header : headers_to_add) {
-    headers.addReferenceKey(header.first, header.second);
+    // Now add headers which should be added.
+    for (const auto& header : headers_to_add) {
+      headers.addReferenceKey(header.first, header.second);
+    }
   }
 }
 
@@ -202,44 +253,48 @@ Http::HeaderTransforms HeaderParser::getHeaderTransforms(const StreamInfo::Strea
                                                          bool do_formatting) const {
   Http::HeaderTransforms transforms;
 
-  for (const auto& [key, entry] : headers_to_add_) {
-    if (do_formatting) {
-      const std::string value =
-          entry.formatter_->format(*Http::StaticEmptyHeaders::get().request_headers,
-                                   *Http::StaticEmptyHeaders::get().response_headers, stream_info);
-      if (!value.empty() || entry.add_if_empty_) {
-        switch (entry.append_action_) {
+  for (const MutationPhase& phase : phases_) {
+    for (const auto& [key, entry] : phase.headers_to_add_) {
+      if (do_formatting) {
+        const std::string value = entry->formatter_->format(
+            *Http::StaticEmptyHeaders::get().request_headers,
+            *Http::StaticEmptyHeaders::get().response_headers, stream_info);
+        if (!value.empty() || entry->add_if_empty_) {
+          switch (entry->append_action_) {
+          case HeaderValueOption::APPEND_IF_EXISTS_OR_ADD:
+            transforms.headers_to_append_or_add.push_back({key, value});
+            break;
+          case HeaderValueOption::OVERWRITE_IF_EXISTS_OR_ADD:
+            transforms.headers_to_overwrite_or_add.push_back({key, value});
+            break;
+          case HeaderValueOption::ADD_IF_ABSENT:
+            transforms.headers_to_add_if_absent.push_back({key, value});
+            break;
+          default:
+            break;
+          }
+        }
+      } else {
+        switch (entry->append_action_) {
         case HeaderValueOption::APPEND_IF_EXISTS_OR_ADD:
-          transforms.headers_to_append_or_add.push_back({key, value});
+          transforms.headers_to_append_or_add.push_back({key, entry->original_value_});
           break;
         case HeaderValueOption::OVERWRITE_IF_EXISTS_OR_ADD:
-          transforms.headers_to_overwrite_or_add.push_back({key, value});
+          transforms.headers_to_overwrite_or_add.push_back({key, entry->original_value_});
           break;
         case HeaderValueOption::ADD_IF_ABSENT:
-          transforms.headers_to_add_if_absent.push_back({key, value});
+          transforms.headers_to_add_if_absent.push_back({key, entry->original_value_});
           break;
         default:
           break;
         }
       }
-    } else {
-      switch (entry.append_action_) {
-      case HeaderValueOption::APPEND_IF_EXISTS_OR_ADD:
-        transforms.headers_to_append_or_add.push_back({key, entry.original_value_});
-        break;
-      case HeaderValueOption::OVERWRITE_IF_EXISTS_OR_ADD:
-        transforms.headers_to_overwrite_or_add.push_back({key, entry.original_value_});
-        break;
-      case HeaderValueOption::ADD_IF_ABSENT:
-        transforms.headers_to_add_if_absent.push_back({key, entry.original_value_});
-        break;
-      default:
-        break;
-      }
     }
-  }
 
-  transforms.headers_to_remove = headers_to_remove_;
+    transforms.headers_to_remove.insert(transforms.headers_to_remove.end(),
+                                        phase.headers_to_remove_.begin(),
+                                        phase.headers_to_remove_.end());
+  }
 
   return transforms;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -12,6 +13,8 @@
 #include "source/common/protobuf/protobuf.h"
 #include "source/common/router/header_formatter.h"
 
+#include "absl/types/span.h"
+
 namespace Envoy {
 namespace Router {
 
@@ -66,6 +69,18 @@ public:
   configure(const Protobuf::RepeatedPtrField<HeaderValueOption>& headers_to_add,
             const Protobuf::RepeatedPtrField<std::string>& headers_to_remove);
 
+  /*
+   * Compiles an ordered list of parsers into a single parser that applies the same mutations in
+   * the same order, as if evaluateHeaders() had been invoked on each input parser in sequence.
+   * Each input parser contributes its phases unchanged, so formatters still observe the mutations
+   * of all earlier levels; the add entries are shared with the input parsers rather than
+   * re-parsed, removals an earlier phase has already performed are dropped, and empty phases
+   * disappear entirely. The returned parser is self-contained and does not reference the inputs.
+   * @param parsers defines the parsers to combine, in evaluation order.
+   * @return HeaderParserPtr the combined parser.
+   */
+  static HeaderParserPtr merge(absl::Span<const HeaderParser* const> parsers);
+
   static const HeaderParser& defaultParser() {
     static HeaderParser* instance = new HeaderParser();
     return *instance;
@@ -117,8 +132,19 @@ protected:
   HeaderParser() = default;
 
 private:
-  std::vector<std::pair<Http::LowerCaseString, HeadersToAddEntry>> headers_to_add_;
-  std::vector<Http::LowerCaseString> headers_to_remove_;
+  struct MutationPhase {
+    std::vector<Http::LowerCaseString> headers_to_remove_;
+    std::vector<std::pair<Http::LowerCaseString, std::shared_ptr<const HeadersToAddEntry>>>
+        headers_to_add_;
+  };
+
+  MutationPhase& singlePhase();
+
+  // The compiled mutation program, applied phase by phase: each phase removes its headers first
+  // and then evaluates and applies its additions, so that formatters in a phase observe the
+  // mutations of all earlier phases but not those of their own. Parsers built by configure() hold
+  // at most one phase; merge() concatenates the phases of several parsers.
+  std::vector<MutationPhase> phases_;
 };
 
 } // namespace Router
@@ -77,6 +77,8 @@ RetryStateImpl::RetryStateImpl(const RetryPolicy& route_policy,
       reset_headers_(route_policy.resetHeaders()),
       reset_max_interval_(route_policy.resetMaxInterval()), retry_on_(route_policy.retryOn()),
       retries_remaining_(route_policy.numRetries()), priority_(priority),
+      policy_base_interval_(route_policy.baseInterval()),
+      policy_max_interval_(route_policy.maxInterval()),
       auto_configured_for_http3_(auto_configured_for_http3) {
   if ((cluster.features() & Upstream::ClusterInfo::Features::HTTP3) &&
       Http::Utility::isSafeRequest(request_headers)) {
@@ -88,21 +90,6 @@ RetryStateImpl::RetryStateImpl(const RetryPolicy& route_policy,
     retry_on_ |= RetryPolicy::RETRY_ON_RETRIABLE_STATUS_CODES;
     retriable_status_codes_.push_back(static_cast<uint32_t>(Http::Code::TooEarly));
   }
-  std::chrono::milliseconds base_interval(
-      runtime_.snapshot().getInteger("upstream.base_retry_backoff_ms", 25));
-  if (route_policy.baseInterval()) {
-    base_interval = *route_policy.baseInterval();
-  }
-
-  // By default, cap the max interval to 10 times the base interval to ensure reasonable back-off
-  // intervals.
-  std::chrono::milliseconds max_interval = base_interval * 10;
-  if (route_policy.maxInterval()) {
-    max_interval = *route_policy.maxInterval();
-  }
-
-  backoff_strategy_ = std::make_unique<JitteredExponentialBackOffStrategy>(
-      base_interval.count(), max_interval.count(), random_);
   host_selection_max_attempts_ = route_policy.hostSelectionMaxAttempts();
 
   // Merge in the headers.
@@ -169,6 +156,26 @@ void RetryStateImpl::enableBackoffTimer() {
     retry_timer_ = dispatcher_.createTimer([this]() -> void { backoff_callback_(); });
   }
 
+  if (backoff_strategy_ == nullptr) {
+    // The vast majority of requests with a retry policy never actually retry, so the strategy (and
+    // the runtime lookup feeding it) is built on the first backoff rather than per request.
+    std::chrono::milliseconds base_interval(
+        runtime_.snapshot().getInteger("upstream.base_retry_backoff_ms", 25));
+    if (policy_base_interval_) {
+      base_interval = *policy_base_interval_;
+    }
+
+    // By default, cap the max interval to 10 times the base interval to ensure reasonable back-off
+    // intervals.
+    std::chrono::milliseconds max_interval = base_interval * 10;
+    if (policy_max_interval_) {
+      max_interval = *policy_max_interval_;
+    }
+
+    backoff_strategy_ = std::make_unique<JitteredExponentialBackOffStrategy>(
+        base_interval.count(), max_interval.count(), random_);
+  }
+
   if (ratelimited_backoff_strategy_ != nullptr) {
     // If we have a backoff strategy based on rate limit feedback from the response we use it.
     retry_timer_->enableTimer(
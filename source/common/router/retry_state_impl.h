@@ -125,6 +125,7 @@ private:
   DoRetryCallback backoff_callback_;
   Event::SchedulableCallbackPtr next_loop_callback_;
   Event::TimerPtr retry_timer_;
+  // Built lazily by enableBackoffTimer(); most requests never take a backoff.
   BackOffStrategyPtr backoff_strategy_;
   BackOffStrategyPtr ratelimited_backoff_strategy_{};
   std::vector<Upstream::RetryHostPredicateSharedPtr> retry_host_predicates_;
@@ -139,6 +140,8 @@ private:
   uint32_t retries_remaining_{};
   uint32_t host_selection_max_attempts_;
   Upstream::ResourcePriority priority_;
+  const absl::optional<std::chrono::milliseconds> policy_base_interval_;
+  const absl::optional<std::chrono::milliseconds> policy_max_interval_;
   const bool auto_configured_for_http3_{};
 };
 
@@ -1,13 +1,16 @@
 #include "source/common/router/route_config_update_receiver_impl.h"
 
+#include <algorithm>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "envoy/config/route/v3/route.pb.h"
 #include "envoy/service/discovery/v3/discovery.pb.h"
 
 #include "source/common/common/assert.h"
 #include "source/common/common/fmt.h"
+#include "source/common/common/hash.h"
 #include "source/common/common/thread.h"
 #include "source/common/config/resource_name.h"
 #include "source/common/protobuf/utility.h"
@@ -44,9 +47,28 @@ ConfigTraitsImpl::createConfig(const Protobuf::Message& rc,
                                Server::Configuration::ServerFactoryContext& factory_context,
                                bool validate_clusters_default) const {
   ASSERT(dynamic_cast<const envoy::config::route::v3::RouteConfiguration*>(&rc));
-  return std::make_shared<ConfigImpl>(
+  // Hand the generation being replaced to the new one so that unchanged virtual hosts can be
+  // structurally shared instead of rebuilt. The reference is weak: the receiver owns the current
+  // config, so it is still alive here when the next update arrives, but nothing keeps old
+  // generations around once the workers drop them.
+  auto config = std::make_shared<ConfigImpl>(
       static_cast<const envoy::config::route::v3::RouteConfiguration&>(rc), optional_http_filters_,
-      factory_context, validator_, validate_clusters_default);
+      factory_context, validator_, validate_clusters_default, last_config_.lock().get());
+  last_config_ = config;
+  return config;
+}
+
+uint64_t ConfigTraitsImpl::staticConfigSeed() const {
+  // Compiled static configs may only be shared between providers with the same optional filter
+  // set and the same validation visitor; both influence how a route configuration compiles.
+  std::vector<absl::string_view> filters(optional_http_filters_.begin(),
+                                         optional_http_filters_.end());
+  std::sort(filters.begin(), filters.end());
+  uint64_t seed = reinterpret_cast<uintptr_t>(&validator_);
+  for (const absl::string_view name : filters) {
+    seed = HashUtil::xxHash64(name, seed);
+  }
+  return seed;
 }
 
 bool RouteConfigUpdateReceiverImpl::onRdsUpdate(const Protobuf::Message& rc,
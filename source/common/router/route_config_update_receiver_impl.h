@@ -28,10 +28,14 @@ public:
   Rds::ConfigConstSharedPtr createConfig(const Protobuf::Message& rc,
                                          Server::Configuration::ServerFactoryContext& context,
                                          bool validate_clusters_default) const override;
+  uint64_t staticConfigSeed() const override;
 
 private:
   const OptionalHttpFilters optional_http_filters_;
   ProtobufMessage::ValidationVisitor& validator_;
+  // The most recently created config, used as the donor for virtual-host structural sharing on
+  // the next update. Only touched on the main thread.
+  mutable std::weak_ptr<const ConfigImpl> last_config_;
 };
 
 class RouteConfigUpdateReceiverImpl : public RouteConfigUpdateReceiver {
@@ -16,6 +16,7 @@
 #include "envoy/upstream/health_check_host_monitor.h"
 #include "envoy/upstream/upstream.h"
 
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/common/assert.h"
 #include "source/common/common/cleanup.h"
 #include "source/common/common/empty_string.h"
@@ -62,6 +63,39 @@ bool schemeIsHttp(const Http::RequestHeaderMap& downstream_headers,
 
 constexpr uint64_t TimeoutPrecisionFactor = 100;
 
+// A read-only view of one slice of a shared shadow body. The fragment shares ownership of the
+// underlying buffer, so the bytes stay alive until every shadow request has drained them, and it
+// deletes itself once the referencing buffer is done with the slice.
+class SharedBodySliceFragment : public Buffer::BufferFragment {
+public:
+  SharedBodySliceFragment(std::shared_ptr<Buffer::Instance> body, const void* data, size_t size)
+      : body_(std::move(body)), data_(data), size_(size) {}
+
+  // Buffer::BufferFragment
+  const void* data() const override { return data_; }
+  size_t size() const override { return size_; }
+  void done() override { delete this; }
+
+private:
+  const std::shared_ptr<Buffer::Instance> body_;
+  const void* const data_;
+  const size_t size_;
+};
+
+// Appends a read-only view of `body` to `dest` without copying the payload. Each shadow request
+// references the same slices, so the body is materialized once no matter how many shadow targets
+// are configured; anything that needs to mutate the destination buffer (e.g. linearization)
+// copies the externally owned slices first.
+void addSharedBodyView(Buffer::Instance& dest, const std::shared_ptr<Buffer::Instance>& body) {
+  for (const Buffer::RawSlice& slice : body->getRawSlices()) {
+    if (slice.len_ == 0) {
+      continue;
+    }
+    auto* fragment = new SharedBodySliceFragment(body, slice.mem_, slice.len_);
+    dest.addBufferFragment(*fragment);
+  }
+}
+
 } // namespace
 
 FilterConfig::FilterConfig(Stats::StatName stat_prefix,
@@ -877,13 +911,19 @@ Http::FilterDataStatus Filter::decodeData(Buffer::Instance& data, bool end_strea
   // already.
   ASSERT(buffering || !upstream_requests_.empty());
 
-  for (auto* shadow_stream : shadow_streams_) {
-    if (end_stream) {
-      shadow_stream->removeDestructorCallback();
-      shadow_stream->removeWatermarkCallbacks();
+  if (!shadow_streams_.empty()) {
+    // Materialize the chunk once and let every shadow stream reference it read-only instead of
+    // copying it per target.
+    const auto shared_chunk = std::make_shared<Buffer::OwnedImpl>(data);
+    for (auto* shadow_stream : shadow_streams_) {
+      if (end_stream) {
+        shadow_stream->removeDestructorCallback();
+        shadow_stream->removeWatermarkCallbacks();
+      }
+      Buffer::OwnedImpl view;
+      addSharedBodyView(view, shared_chunk);
+      shadow_stream->sendData(view, end_stream);
     }
-    Buffer::OwnedImpl copy(data);
-    shadow_stream->sendData(copy, end_stream);
   }
   if (end_stream) {
     shadow_streams_.clear();
@@ -992,6 +1032,13 @@ absl::optional<absl::string_view> Filter::getShadowCluster(const ShadowPolicy& p
 }
 
 void Filter::maybeDoShadowing() {
+  // Materialize the shadow body once up front; each shadow request references it read-only
+  // rather than copying the buffered body per target.
+  std::shared_ptr<Buffer::Instance> shadow_body;
+  if (callbacks_->decodingBuffer() != nullptr) {
+    shadow_body = std::make_shared<Buffer::OwnedImpl>(*callbacks_->decodingBuffer());
+  }
+
   for (const auto& shadow_policy_wrapper : active_shadow_policies_) {
     const auto& shadow_policy = shadow_policy_wrapper.get();
 
@@ -1005,8 +1052,8 @@ void Filter::maybeDoShadowing() {
 
     Http::RequestMessagePtr request(new Http::RequestMessageImpl(
         Http::createHeaderMap<Http::RequestHeaderMapImpl>(*shadow_headers_)));
-    if (callbacks_->decodingBuffer()) {
-      request->body().add(*callbacks_->decodingBuffer());
+    if (shadow_body != nullptr) {
+      addSharedBodyView(request->body(), shadow_body);
     }
     if (shadow_trailers_) {
       request->trailers(Http::createHeaderMap<Http::RequestTrailerMapImpl>(*shadow_trailers_));
@@ -346,8 +346,10 @@ public:
   Filter(FilterConfig& config, FilterStats& stats)
       : config_(config), stats_(stats), grpc_request_(false), exclude_http_code_stats_(false),
         downstream_response_started_(false), downstream_end_stream_(false), is_retry_(false),
-        request_buffer_overflowed_(false), streaming_shadows_(Runtime::runtimeFeatureEnabled(
-                                               "envoy.reloadable_features.streaming_shadow")) {}
+        request_buffer_overflowed_(false),
+        streaming_shadows_(
+            Runtime::runtimeFeatureEnabled("envoy.reloadable_features.streaming_shadow")),
+        hash_key_computed_(false) {}
 
   ~Filter() override;
 
@@ -367,20 +369,27 @@ public:
 
   // Upstream::LoadBalancerContext
   absl::optional<uint64_t> computeHashKey() override {
-    if (route_entry_ && downstream_headers_) {
-      auto hash_policy = route_entry_->hashPolicy();
-      if (hash_policy) {
-        return hash_policy->generateHash(
-            callbacks_->streamInfo().downstreamAddressProvider().remoteAddress().get(),
-            *downstream_headers_,
-            [this](const std::string& key, const std::string& path, std::chrono::seconds max_age,
-                   Http::CookieAttributeRefVector attributes) {
-              return addDownstreamSetCookie(key, path, max_age, attributes);
-            },
-            callbacks_->streamInfo().filterState());
+    // The hash inputs (route entry, downstream headers and downstream address) are all fixed by
+    // the time the load balancer first asks for the hash, so compute it once and reuse it across
+    // host picks, retries and hedged requests. Recomputing would re-hash headers/cookies per try
+    // and could generate the affinity set-cookie more than once.
+    if (!hash_key_computed_) {
+      hash_key_computed_ = true;
+      if (route_entry_ && downstream_headers_) {
+        auto hash_policy = route_entry_->hashPolicy();
+        if (hash_policy) {
+          hash_key_ = hash_policy->generateHash(
+              callbacks_->streamInfo().downstreamAddressProvider().remoteAddress().get(),
+              *downstream_headers_,
+              [this](const std::string& key, const std::string& path, std::chrono::seconds max_age,
+                     Http::CookieAttributeRefVector attributes) {
+                return addDownstreamSetCookie(key, path, max_age, attributes);
+              },
+              callbacks_->streamInfo().filterState());
+        }
       }
     }
-    return {};
+    return hash_key_;
   }
   const Router::MetadataMatchCriteria* metadataMatchCriteria() override {
     if (route_entry_) {
@@ -619,6 +628,8 @@ private:
   Http::RequestTrailerMap* downstream_trailers_{};
   MonotonicTime downstream_request_complete_time_;
   MetadataMatchCriteriaConstPtr metadata_match_;
+  // Memoized result of computeHashKey(); valid once hash_key_computed_ is set.
+  absl::optional<uint64_t> hash_key_;
   std::function<void(Http::ResponseHeaderMap&)> modify_headers_;
   std::vector<std::reference_wrapper<const ShadowPolicy>> active_shadow_policies_{};
   std::unique_ptr<Http::RequestHeaderMap> shadow_headers_;
@@ -648,6 +659,7 @@ private:
   bool include_timeout_retry_header_in_request_ : 1;
   bool request_buffer_overflowed_ : 1;
   const bool streaming_shadows_ : 1;
+  bool hash_key_computed_ : 1;
 };
 
 class ProdFilter : public Filter {
@@ -50,6 +50,8 @@ public:
 private:
   const ScopedRoutes::ScopeKeyBuilder::FragmentBuilder::HeaderValueExtractor&
       header_value_extractor_config_;
+  // Lower-cased at config time so per-request fragment computation does not allocate.
+  const Http::LowerCaseString header_name_;
 };
 
 /**
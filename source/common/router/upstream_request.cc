@@ -41,42 +41,26 @@
 namespace Envoy {
 namespace Router {
 
-// The upstream filter manager class.
-class UpstreamFilterManager : public Http::FilterManager {
-public:
-  UpstreamFilterManager(Http::FilterManagerCallbacks& filter_manager_callbacks,
-                        Event::Dispatcher& dispatcher, OptRef<const Network::Connection> connection,
-                        uint64_t stream_id, Buffer::BufferMemoryAccountSharedPtr account,
-                        bool proxy_100_continue, uint32_t buffer_limit,
-                        const Http::FilterChainFactory& filter_chain_factory,
-                        UpstreamRequest& request)
-      : FilterManager(filter_manager_callbacks, dispatcher, connection, stream_id, account,
-                      proxy_100_continue, buffer_limit, filter_chain_factory),
-        upstream_request_(request) {}
-
-  StreamInfo::StreamInfo& streamInfo() override {
-    return upstream_request_.parent_.callbacks()->streamInfo();
-  }
-  const StreamInfo::StreamInfo& streamInfo() const override {
-    return upstream_request_.parent_.callbacks()->streamInfo();
-  }
-  // Send local replies via the downstream filter manager.
-  // Local replies will not be seen by upstream filters.
-  void sendLocalReply(Http::Code code, absl::string_view body,
-                      const std::function<void(Http::ResponseHeaderMap& headers)>& modify_headers,
-                      const absl::optional<Grpc::Status::GrpcStatus> grpc_status,
-                      absl::string_view details) override {
-    state().decoder_filter_chain_aborted_ = true;
-    state().encoder_filter_chain_aborted_ = true;
-    state().remote_encode_complete_ = true;
-    state().local_complete_ = true;
-    // TODO(alyssawilk) this should be done through the router to play well with hedging.
-    upstream_request_.parent_.callbacks()->sendLocalReply(code, body, modify_headers, grpc_status,
-                                                          details);
-  }
-  void executeLocalReplyIfPrepared() override {}
-  UpstreamRequest& upstream_request_;
-};
+StreamInfo::StreamInfo& UpstreamFilterManager::streamInfo() {
+  return upstream_request_.parent_.callbacks()->streamInfo();
+}
+
+const StreamInfo::StreamInfo& UpstreamFilterManager::streamInfo() const {
+  return upstream_request_.parent_.callbacks()->streamInfo();
+}
+
+void UpstreamFilterManager::sendLocalReply(
+    Http::Code code, absl::string_view body,
+    const std::function<void(Http::ResponseHeaderMap& headers)>& modify_headers,
+    const absl::optional<Grpc::Status::GrpcStatus> grpc_status, absl::string_view details) {
+  state().decoder_filter_chain_aborted_ = true;
+  state().encoder_filter_chain_aborted_ = true;
+  state().remote_encode_complete_ = true;
+  state().local_complete_ = true;
+  // TODO(alyssawilk) this should be done through the router to play well with hedging.
+  upstream_request_.parent_.callbacks()->sendLocalReply(code, body, modify_headers, grpc_status,
+                                                        details);
+}
 
 UpstreamRequest::UpstreamRequest(RouterFilterInterface& parent,
                                  std::unique_ptr<GenericConnPool>&& conn_pool,
@@ -84,6 +68,11 @@ UpstreamRequest::UpstreamRequest(RouterFilterInterface& parent,
     : parent_(parent), conn_pool_(std::move(conn_pool)),
       stream_info_(parent_.callbacks()->dispatcher().timeSource(), nullptr),
       start_time_(parent_.callbacks()->dispatcher().timeSource().monotonicTime()),
+      filter_manager_callbacks_(std::make_unique<UpstreamRequestFilterManagerCallbacks>(*this)),
+      filter_manager_(*filter_manager_callbacks_, parent_.callbacks()->dispatcher(),
+                      parent_.callbacks()->connection(), parent_.callbacks()->streamId(),
+                      parent_.callbacks()->account(), true,
+                      parent_.callbacks()->decoderBufferLimit(), *parent_.cluster(), *this),
       calling_encode_headers_(false), upstream_canary_(false), router_sent_end_stream_(false),
       encode_trailers_(false), retried_(false), awaiting_headers_(true),
       outlier_detection_timeout_recorded_(false),
@@ -130,24 +119,17 @@ UpstreamRequest::UpstreamRequest(RouterFilterInterface& parent,
     stream_info_.setUpstreamClusterInfo(*cluster_info);
   }
 
-  // Set up the upstream filter manager.
-  filter_manager_callbacks_ = std::make_unique<UpstreamRequestFilterManagerCallbacks>(*this);
-  filter_manager_ = std::make_unique<UpstreamFilterManager>(
-      *filter_manager_callbacks_, parent_.callbacks()->dispatcher(),
-      parent_.callbacks()->connection(), parent_.callbacks()->streamId(),
-      parent_.callbacks()->account(), true, parent_.callbacks()->decoderBufferLimit(),
-      *parent_.cluster(), *this);
   // Attempt to create custom cluster-specified filter chain
-  bool created = parent_.cluster()->createFilterChain(*filter_manager_,
+  bool created = parent_.cluster()->createFilterChain(filter_manager_,
                                                       /*only_create_if_configured=*/true);
   if (!created) {
     // Attempt to create custom router-specified filter chain.
-    created = parent_.config().createFilterChain(*filter_manager_);
+    created = parent_.config().createFilterChain(filter_manager_);
   }
   if (!created) {
     // Neither cluster nor router have a custom filter chain; add the default
     // cluster filter chain, which only consists of the codec filter.
-    created = parent_.cluster()->createFilterChain(*filter_manager_, false);
+    created = parent_.cluster()->createFilterChain(filter_manager_, false);
   }
   // There will always be a codec filter present, which sets the upstream
   // interface. Fast-fail any tests that don't set up mocks correctly.
@@ -162,7 +144,7 @@ void UpstreamRequest::cleanUp() {
   }
   cleaned_up_ = true;
 
-  filter_manager_->destroyFilters();
+  filter_manager_.destroyFilters();
 
   if (span_ != nullptr) {
     auto tracing_config = parent_.callbacks()->tracingConfig();
@@ -334,9 +316,7 @@ void UpstreamRequest::dumpState(std::ostream& os, int indent_level) const {
   }
   const Http::RequestHeaderMap* request_headers = parent_.downstreamHeaders();
   DUMP_DETAILS(request_headers);
-  if (filter_manager_) {
-    filter_manager_->dumpState(os, indent_level);
-  }
+  filter_manager_.dumpState(os, indent_level);
 }
 
 const Route& UpstreamRequest::route() const { return *parent_.route(); }
@@ -406,16 +386,16 @@ void UpstreamRequest::acceptHeadersFromRouter(bool end_stream) {
     resetUpstreamLogFlushTimer();
   }
 
-  filter_manager_->requestHeadersInitialized();
-  filter_manager_->streamInfo().setRequestHeaders(*parent_.downstreamHeaders());
-  filter_manager_->decodeHeaders(*parent_.downstreamHeaders(), end_stream);
+  filter_manager_.requestHeadersInitialized();
+  filter_manager_.streamInfo().setRequestHeaders(*parent_.downstreamHeaders());
+  filter_manager_.decodeHeaders(*parent_.downstreamHeaders(), end_stream);
 }
 
 void UpstreamRequest::acceptDataFromRouter(Buffer::Instance& data, bool end_stream) {
   ASSERT(!router_sent_end_stream_);
   router_sent_end_stream_ = end_stream;
 
-  filter_manager_->decodeData(data, end_stream);
+  filter_manager_.decodeData(data, end_stream);
 }
 
 void UpstreamRequest::acceptTrailersFromRouter(Http::RequestTrailerMap& trailers) {
@@ -423,11 +403,11 @@ void UpstreamRequest::acceptTrailersFromRouter(Http::RequestTrailerMap& trailers
   router_sent_end_stream_ = true;
   encode_trailers_ = true;
 
-  filter_manager_->decodeTrailers(trailers);
+  filter_manager_.decodeTrailers(trailers);
 }
 
 void UpstreamRequest::acceptMetadataFromRouter(Http::MetadataMapPtr&& metadata_map_ptr) {
-  filter_manager_->decodeMetadata(*metadata_map_ptr);
+  filter_manager_.decodeMetadata(*metadata_map_ptr);
 }
 
 void UpstreamRequest::onResetStream(Http::StreamResetReason reason,
@@ -35,9 +35,34 @@ class GenericConnectionPoolCallbacks;
 class RouterFilterInterface;
 class UpstreamRequest;
 class UpstreamRequestFilterManagerCallbacks;
-class UpstreamFilterManager;
 class UpstreamCodecFilter;
 
+// The upstream filter manager class. Held by value in the UpstreamRequest to
+// avoid a heap allocation on every upstream attempt.
+class UpstreamFilterManager : public Http::FilterManager {
+public:
+  UpstreamFilterManager(Http::FilterManagerCallbacks& filter_manager_callbacks,
+                        Event::Dispatcher& dispatcher, OptRef<const Network::Connection> connection,
+                        uint64_t stream_id, Buffer::BufferMemoryAccountSharedPtr account,
+                        bool proxy_100_continue, uint32_t buffer_limit,
+                        const Http::FilterChainFactory& filter_chain_factory,
+                        UpstreamRequest& request)
+      : FilterManager(filter_manager_callbacks, dispatcher, connection, stream_id, account,
+                      proxy_100_continue, buffer_limit, filter_chain_factory),
+        upstream_request_(request) {}
+
+  StreamInfo::StreamInfo& streamInfo() override;
+  const StreamInfo::StreamInfo& streamInfo() const override;
+  // Send local replies via the downstream filter manager.
+  // Local replies will not be seen by upstream filters.
+  void sendLocalReply(Http::Code code, absl::string_view body,
+                      const std::function<void(Http::ResponseHeaderMap& headers)>& modify_headers,
+                      const absl::optional<Grpc::Status::GrpcStatus> grpc_status,
+                      absl::string_view details) override;
+  void executeLocalReplyIfPrepared() override {}
+  UpstreamRequest& upstream_request_;
+};
+
 /* The Upstream request is the base class for forwarding HTTP upstream.
  *
  * On the new request path, payload (headers/body/metadata/data) still arrives via
@@ -214,8 +239,11 @@ private:
   // and will log to all access logs once per trigger.
   Event::TimerPtr upstream_log_flush_timer_;
 
+  // The filter manager callbacks must stay heap allocated: they own response
+  // headers/trailers while those traverse the filter chain, and are handed to
+  // deferredDelete() in cleanUp() so the maps outlive stream teardown.
   std::unique_ptr<UpstreamRequestFilterManagerCallbacks> filter_manager_callbacks_;
-  std::unique_ptr<Http::FilterManager> filter_manager_;
+  UpstreamFilterManager filter_manager_;
 
   // The number of outstanding readDisable to be called with parameter value true.
   // When downstream send buffers get above high watermark before response headers arrive, we
@@ -38,6 +38,9 @@ RUNTIME_GUARD(envoy_reloadable_features_copy_response_code_to_downstream_stream_
 RUNTIME_GUARD(envoy_reloadable_features_count_unused_mapped_pages_as_free);
 RUNTIME_GUARD(envoy_reloadable_features_detect_and_raise_rst_tcp_connection);
 RUNTIME_GUARD(envoy_reloadable_features_dfp_mixed_scheme);
+// Buffers DogStatsD histogram samples per worker and emits them as multi-value
+// packets at the stats flush interval instead of a datagram per sample.
+RUNTIME_GUARD(envoy_reloadable_features_dog_statsd_aggregate_histograms);
 RUNTIME_GUARD(envoy_reloadable_features_enable_aws_credentials_file);
 RUNTIME_GUARD(envoy_reloadable_features_enable_compression_bomb_protection);
 RUNTIME_GUARD(envoy_reloadable_features_enable_connect_udp_support);
@@ -69,14 +72,20 @@ RUNTIME_GUARD(envoy_reloadable_features_no_full_scan_certs_on_sni_mismatch);
 RUNTIME_GUARD(envoy_reloadable_features_oauth_make_token_cookie_httponly);
 RUNTIME_GUARD(envoy_reloadable_features_oauth_use_standard_max_age_value);
 RUNTIME_GUARD(envoy_reloadable_features_oauth_use_url_encoding);
+// Skips ClusterStats entries with no locality stats and no dropped requests in LRS reports.
+RUNTIME_GUARD(envoy_reloadable_features_omit_empty_lrs_cluster_stats);
 RUNTIME_GUARD(envoy_reloadable_features_original_dst_rely_on_idle_timeout);
 RUNTIME_GUARD(envoy_reloadable_features_overload_manager_error_unknown_action);
 RUNTIME_GUARD(envoy_reloadable_features_prohibit_route_refresh_after_response_headers_sent);
 RUNTIME_GUARD(envoy_reloadable_features_proxy_status_upstream_request_timeout);
+// Selects the sendmmsg batch writer for QUIC listeners without an explicitly configured
+// writer when UDP GSO is unsupported.
+RUNTIME_GUARD(envoy_reloadable_features_quic_sendmmsg_batch_writer);
 RUNTIME_GUARD(envoy_reloadable_features_sanitize_original_path);
 RUNTIME_GUARD(envoy_reloadable_features_send_header_raw_value);
 RUNTIME_GUARD(envoy_reloadable_features_service_sanitize_non_utf8_strings);
 RUNTIME_GUARD(envoy_reloadable_features_skip_dns_lookup_for_proxied_requests);
+RUNTIME_GUARD(envoy_reloadable_features_skip_revalidation_of_unchanged_xds_resources);
 RUNTIME_GUARD(envoy_reloadable_features_stateful_session_encode_ttl_in_cookie);
 RUNTIME_GUARD(envoy_reloadable_features_test_feature_true);
 RUNTIME_GUARD(envoy_reloadable_features_thrift_allow_negative_field_ids);
@@ -106,6 +115,12 @@ FALSE_RUNTIME_GUARD(envoy_reloadable_features_unified_mux);
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_defer_processing_backedup_streams);
 // TODO(birenroy) flip after a burn-in period
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_http2_use_oghttp2);
+// Coalesces all HTTP/2 frames serialized in one send pass into a single connection write.
+// Off by default while the change in write sizes soaks.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_http2_batch_frame_writes);
+// Caps early TLS records at ~MTU size and ramps to full 16KB records once the connection is in
+// bulk transfer. Off by default while the time-to-first-byte/CPU trade-off soaks.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_tls_dynamic_record_sizing);
 // Used to track if runtime is initialized.
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_runtime_initialized);
 // TODO(mattklein123): Flip this to true and/or remove completely once verified by Envoy Mobile.
@@ -118,6 +133,9 @@ FALSE_RUNTIME_GUARD(envoy_reloadable_features_enable_include_histograms);
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_refresh_rtt_after_request);
 // TODO(danzh) false deprecate it once QUICHE has its own enable/disable flag.
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_quic_reject_all);
+// Moves QUIC proof source private key signing off the worker thread onto a dedicated per-listener
+// signing thread. Off by default while the handshake latency impact soaks.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_quic_async_proof_signing);
 // TODO(adisuissa): enable by default once this is tested in prod.
 FALSE_RUNTIME_GUARD(envoy_restart_features_use_eds_cache_for_ads);
 // TODO(#10646) change to true when UHV is sufficiently tested
@@ -128,6 +146,32 @@ FALSE_RUNTIME_GUARD(envoy_reloadable_features_enable_universal_header_validator)
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_no_downgrade_to_canonical_name);
 // TODO(pksohn): enable after fixing https://github.com/envoyproxy/envoy/issues/29930
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_quic_defer_logging_to_ack_listener);
+// Makes the statsd sinks serialize only counters and gauges that changed since
+// the previous flush. Off by default because some statsd backends expire
+// series that are not periodically refreshed.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_statsd_flush_only_changed_metrics);
+// Cross-checks the compiled per-virtual-host route match index against a
+// linear scan on every indexed lookup. Debugging aid only; doubles route
+// match cost while enabled.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_check_route_match_index_parity);
+// Memoizes route-match results per downstream connection, keyed on :method,
+// :authority and :path. Only consulted for route configurations whose route
+// resolution is a pure function of those headers; see
+// Router::Config::supportsRouteMemoization(). Off by default while the
+// optimization soaks.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_per_connection_route_memoization);
+// Drives all of a health checker's interval probes from one shared dispatcher
+// timer instead of one timer per host. Off by default while the change in
+// probe scheduling soaks on large clusters.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_health_check_shared_interval_timer);
+// Skips HDS reporting intervals whose endpoint health state is identical to the
+// last response sent, re-sending a full snapshot periodically for resync. Off by
+// default because management servers may expect a response every interval.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_hds_suppress_unchanged_responses);
+// Coalesces the bandwidth limit filter's per-stream fill timers into one shared
+// timer per worker. Off by default while the change in token release timing
+// soaks with large numbers of concurrently limited streams.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_bandwidth_limit_shared_fill_timer);
 
 // Block of non-boolean flags. Use of int flags is deprecated. Do not add more.
 ABSL_FLAG(uint64_t, re2_max_program_size_error_level, 100, ""); // NOLINT
@@ -547,7 +547,10 @@ LoaderImpl::LoaderImpl(Event::Dispatcher& dispatcher, ThreadLocal::SlotAllocator
         watcher_ = dispatcher.createFilesystemWatcher();
       }
       watcher_->addWatch(layer.disk_layer().symlink_root(), Filesystem::Watcher::Events::MovedTo,
-                         [this](uint32_t) -> void { loadNewSnapshot(); });
+                         [this](uint32_t) -> void {
+                           disk_layers_dirty_ = true;
+                           loadNewSnapshot();
+                         });
       break;
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kRtdsLayer:
       subscriptions_.emplace_back(
@@ -611,6 +614,7 @@ RtdsSubscription::onConfigUpdate(const std::vector<Config::DecodedResourceRef>&
   }
   ENVOY_LOG(debug, "Reloading RTDS snapshot for onConfigUpdate");
   proto_.CopyFrom(runtime.layer());
+  layer_dirty_ = true;
   parent_.loadNewSnapshot();
   init_target_.ready();
   return absl::OkStatus();
@@ -665,6 +669,7 @@ absl::Status RtdsSubscription::onConfigRemoved(
   }
   ENVOY_LOG(debug, "Clear RTDS snapshot for onConfigUpdate");
   proto_.Clear();
+  layer_dirty_ = true;
   parent_.loadNewSnapshot();
   init_target_.ready();
   return absl::OkStatus();
@@ -706,6 +711,7 @@ void LoaderImpl::mergeValues(const absl::node_hash_map<std::string, std::string>
     throw EnvoyException("No admin layer specified");
   }
   admin_layer_->mergeValues(values);
+  admin_layer_dirty_ = true;
   loadNewSnapshot();
 }
 
@@ -725,45 +731,77 @@ SnapshotImplPtr LoaderImpl::createNewSnapshot() {
   uint32_t disk_layers = 0;
   uint32_t error_layers = 0;
   uint32_t rtds_layer = 0;
-  for (const auto& layer : config_.layers()) {
+  for (uint32_t i = 0; i < static_cast<uint32_t>(config_.layers_size()); ++i) {
+    const auto& layer = config_.layers(i);
     switch (layer.layer_specifier_case()) {
-    case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kStaticLayer:
-      layers.emplace_back(std::make_unique<const ProtoLayer>(layer.name(), layer.static_layer()));
+    case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kStaticLayer: {
+      // Static layers never change, so every snapshot shares the same layer object.
+      auto& cached_layer = layer_cache_[i];
+      if (cached_layer == nullptr) {
+        cached_layer = std::make_shared<const ProtoLayer>(layer.name(), layer.static_layer());
+      }
+      layers.push_back(cached_layer);
       break;
+    }
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kDiskLayer: {
-      std::string path =
-          layer.disk_layer().symlink_root() + "/" + layer.disk_layer().subdirectory();
-      if (layer.disk_layer().append_service_cluster()) {
-        absl::StrAppend(&path, "/", service_cluster_);
-      }
-      if (api_.fileSystem().directoryExists(path)) {
-        TRY_ASSERT_MAIN_THREAD {
-          layers.emplace_back(std::make_unique<DiskLayer>(layer.name(), path, api_));
-          ++disk_layers;
+      // Disk layers are only re-read after the filesystem watcher observed a symlink swap; a
+      // layer that failed to load (or whose directory does not exist) is not cached, so it is
+      // retried on every snapshot as before.
+      auto& cached_layer = layer_cache_[i];
+      if (disk_layers_dirty_ || cached_layer == nullptr) {
+        cached_layer = nullptr;
+        std::string path =
+            layer.disk_layer().symlink_root() + "/" + layer.disk_layer().subdirectory();
+        if (layer.disk_layer().append_service_cluster()) {
+          absl::StrAppend(&path, "/", service_cluster_);
+        }
+        if (api_.fileSystem().directoryExists(path)) {
+          TRY_ASSERT_MAIN_THREAD {
+            cached_layer = std::make_shared<const DiskLayer>(layer.name(), path, api_);
+          }
+          END_TRY
+          CATCH(EnvoyException & e, {
+            // TODO(htuch): Consider latching here, rather than ignoring the
+            // layer. This would be consistent with filesystem RTDS.
+            ++error_layers;
+            ENVOY_LOG(debug, "error loading runtime values for layer {} from disk: {}",
+                      layer.DebugString(), e.what());
+          });
         }
-        END_TRY
-        CATCH(EnvoyException & e, {
-          // TODO(htuch): Consider latching here, rather than ignoring the
-          // layer. This would be consistent with filesystem RTDS.
-          ++error_layers;
-          ENVOY_LOG(debug, "error loading runtime values for layer {} from disk: {}",
-                    layer.DebugString(), e.what());
-        });
+      }
+      if (cached_layer != nullptr) {
+        layers.push_back(cached_layer);
+        ++disk_layers;
       }
       break;
     }
-    case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kAdminLayer:
-      layers.push_back(std::make_unique<AdminLayer>(*admin_layer_));
+    case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kAdminLayer: {
+      // The admin layer copy only needs to be refreshed after mergeValues() changed it.
+      auto& cached_layer = layer_cache_[i];
+      if (admin_layer_dirty_ || cached_layer == nullptr) {
+        cached_layer = std::make_shared<const AdminLayer>(*admin_layer_);
+        admin_layer_dirty_ = false;
+      }
+      layers.push_back(cached_layer);
       break;
+    }
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kRtdsLayer: {
       auto* subscription = subscriptions_[rtds_layer++].get();
-      layers.emplace_back(std::make_unique<const ProtoLayer>(layer.name(), subscription->proto_));
+      auto& cached_layer = layer_cache_[i];
+      if (subscription->layer_dirty_ || cached_layer == nullptr) {
+        // On an invalid layer this throws before the dirty flag is cleared, so the offending
+        // update is NACKed and the next snapshot retries the rebuild, as before.
+        cached_layer = std::make_shared<const ProtoLayer>(layer.name(), subscription->proto_);
+        subscription->layer_dirty_ = false;
+      }
+      layers.push_back(cached_layer);
       break;
     }
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::LAYER_SPECIFIER_NOT_SET:
       PANIC_DUE_TO_PROTO_UNSET;
     }
   }
+  disk_layers_dirty_ = false;
   stats_.num_layers_.set(layers.size());
   if (error_layers == 0) {
     stats_.load_success_.inc();
@@ -29,6 +29,7 @@
 #include "source/common/init/target_impl.h"
 #include "source/common/singleton/threadsafe_singleton.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "spdlog/spdlog.h"
 
@@ -200,6 +201,9 @@ struct RtdsSubscription : Envoy::Config::SubscriptionBase<envoy::service::runtim
   std::string resource_name_;
   Init::TargetImpl init_target_;
   ProtobufWkt::Struct proto_;
+  // Tells the loader that proto_ changed and the cached layer built from it must be rebuilt on
+  // the next snapshot. Cleared by LoaderImpl::createNewSnapshot().
+  bool layer_dirty_{true};
 };
 
 using RtdsSubscriptionPtr = std::unique_ptr<RtdsSubscription>;
@@ -252,6 +256,15 @@ private:
   Upstream::ClusterManager* cm_{};
   Stats::Store& store_;
 
+  // Layers are immutable once built, so snapshots share them instead of rebuilding them when
+  // their contents are known to be unchanged. The cache is keyed by the layer's index in
+  // config_.layers(). Static layers are cached forever, disk layers until the filesystem watcher
+  // fires, RTDS layers until their subscription receives an update, and the admin layer copy
+  // until mergeValues() changes it.
+  absl::flat_hash_map<uint32_t, Snapshot::OverrideLayerConstPtr> layer_cache_;
+  bool disk_layers_dirty_{true};
+  bool admin_layer_dirty_{true};
+
   absl::Mutex snapshot_mutex_;
   SnapshotConstSharedPtr thread_safe_snapshot_ ABSL_GUARDED_BY(snapshot_mutex_);
 };
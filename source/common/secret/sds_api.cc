@@ -93,7 +93,10 @@ absl::Status SdsApi::onConfigUpdate(const std::vector<Config::DecodedResourceRef
         fmt::format("Unexpected SDS secret (expecting {}): {}", sds_config_name_, secret.name()));
   }
 
-  const uint64_t new_hash = MessageUtil::hash(secret);
+  // Prefer the hash of the wire bytes, which avoids a deterministic re-serialization of a
+  // potentially large secret; resources that did not come off the wire fall back to the proto
+  // hash.
+  const uint64_t new_hash = resources[0].get().contentHash().value_or(MessageUtil::hash(secret));
 
   if (new_hash != secret_hash_) {
     validateConfig(secret);
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "envoy/event/dispatcher.h"
 #include "envoy/singleton/instance.h"
@@ -12,11 +14,60 @@
 #include "source/common/common/non_copyable.h"
 #include "source/common/common/thread_synchronizer.h"
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/synchronization/mutex.h"
 
 namespace Envoy {
 namespace SharedPool {
 
+/**
+ * Pool storage element shared by the pool implementations below: a weak reference to a pooled
+ * object along with its raw pointer, used to speed up hashing and comparisons without locking
+ * the weak_ptr.
+ */
+template <typename T, typename HashFunc, typename EqualFunc> class PoolElement {
+public:
+  PoolElement(const std::shared_ptr<T>& ptr) : ptr_{ptr.get()}, weak_ptr_{ptr} {}
+
+  PoolElement() = delete;
+  PoolElement(const PoolElement&) = delete;
+
+  PoolElement(PoolElement&&) noexcept = default;
+
+  std::shared_ptr<T> lock() const { return weak_ptr_.lock(); }
+  long use_count() const { return weak_ptr_.use_count(); }
+
+  friend struct Hash;
+  friend struct Compare;
+
+  struct Hash {
+    using is_transparent = void; // NOLINT(readability-identifier-naming)
+    constexpr size_t operator()(const T* ptr) const { return HashFunc{}(*ptr); }
+    constexpr size_t operator()(const PoolElement& element) const {
+      return HashFunc{}(*element.ptr_);
+    }
+  };
+  struct Compare {
+    using is_transparent = void; // NOLINT(readability-identifier-naming)
+    bool operator()(const PoolElement& a, const PoolElement& b) const {
+      ASSERT(a.ptr_ != nullptr && b.ptr_ != nullptr);
+      return a.ptr_ == b.ptr_ ||
+             (a.ptr_ != nullptr && b.ptr_ != nullptr && EqualFunc{}(*a.ptr_, *b.ptr_));
+    }
+    bool operator()(const PoolElement& a, const T* ptr) const {
+      ASSERT(a.ptr_ != nullptr && ptr != nullptr);
+      return a.ptr_ == ptr || (a.ptr_ != nullptr && ptr != nullptr && EqualFunc{}(*a.ptr_, *ptr));
+    }
+  };
+
+private:
+  const T* const ptr_ = nullptr; ///< This is only used to speed up
+                                 ///< comparisons and should never be
+                                 ///< made available outside this class.
+  std::weak_ptr<T> weak_ptr_;
+};
+
 /**
  * Used to share objects that have the same content.
  * control the life cycle of shared objects by reference counting
@@ -110,47 +161,7 @@ private:
     delete ptr;
   }
 
-  class Element {
-  public:
-    Element(const std::shared_ptr<T>& ptr) : ptr_{ptr.get()}, weak_ptr_{ptr} {}
-
-    Element() = delete;
-    Element(const Element&) = delete;
-
-    Element(Element&&) noexcept = default;
-
-    std::shared_ptr<T> lock() const { return weak_ptr_.lock(); }
-    long use_count() const { return weak_ptr_.use_count(); }
-
-    friend struct Hash;
-    friend struct Compare;
-
-    struct Hash {
-      using is_transparent = void; // NOLINT(readability-identifier-naming)
-      constexpr size_t operator()(const T* ptr) const { return HashFunc{}(*ptr); }
-      constexpr size_t operator()(const Element& element) const {
-        return HashFunc{}(*element.ptr_);
-      }
-    };
-    struct Compare {
-      using is_transparent = void; // NOLINT(readability-identifier-naming)
-      bool operator()(const Element& a, const Element& b) const {
-        ASSERT(a.ptr_ != nullptr && b.ptr_ != nullptr);
-        return a.ptr_ == b.ptr_ ||
-               (a.ptr_ != nullptr && b.ptr_ != nullptr && EqualFunc{}(*a.ptr_, *b.ptr_));
-      }
-      bool operator()(const Element& a, const T* ptr) const {
-        ASSERT(a.ptr_ != nullptr && ptr != nullptr);
-        return a.ptr_ == ptr || (a.ptr_ != nullptr && ptr != nullptr && EqualFunc{}(*a.ptr_, *ptr));
-      }
-    };
-
-  private:
-    const T* const ptr_ = nullptr; ///< This is only used to speed up
-                                   ///< comparisons and should never be
-                                   ///< made available outside this class.
-    std::weak_ptr<T> weak_ptr_;
-  };
+  using Element = PoolElement<T, HashFunc, EqualFunc>;
 
   const std::thread::id thread_id_;
   absl::flat_hash_set<Element, typename Element::Hash, typename Element::Compare> object_pool_;
@@ -167,5 +178,98 @@ const char ObjectSharedPool<T, HashFunc, EqualFunc, V>::DeleteObjectOnMainThread
 template <typename T, typename HashFunc, typename EqualFunc, class V>
 const char ObjectSharedPool<T, HashFunc, EqualFunc, V>::ObjectDeleterEntry[] = "deleter-entry";
 
+/**
+ * A sharded variant of ObjectSharedPool that may be used from any thread. Objects are
+ * distributed over a fixed number of shards by their hash and each shard is guarded by its own
+ * mutex, so concurrent deduplication contends only within a shard. Unlike ObjectSharedPool
+ * there is no owning dispatcher: object destruction erases the entry directly on the
+ * destroying thread under the shard lock instead of posting to another thread, which keeps
+ * large updates (e.g. host metadata dedup during big EDS pushes) from funneling through a
+ * single dispatcher.
+ */
+template <typename T, typename HashFunc = std::hash<T>, typename EqualFunc = std::equal_to<T>,
+          class = typename std::enable_if<std::is_copy_constructible<T>::value>::type>
+class ShardedObjectSharedPool
+    : public Singleton::Instance,
+      public std::enable_shared_from_this<ShardedObjectSharedPool<T, HashFunc, EqualFunc>>,
+      NonCopyable {
+public:
+  static constexpr uint32_t DefaultShardCount = 16;
+
+  explicit ShardedObjectSharedPool(uint32_t shard_count = DefaultShardCount)
+      : shard_mask_(roundUpToPowerOfTwo(shard_count) - 1),
+        shards_(roundUpToPowerOfTwo(shard_count)) {}
+
+  std::shared_ptr<T> getObject(const T& obj) {
+    const size_t hash = HashFunc{}(obj);
+    Shard& shard = shards_[hash & shard_mask_];
+    absl::MutexLock lock(&shard.mutex_);
+
+    // Return from the shard if we find the object there.
+    if (auto iter = shard.object_pool_.find(&obj); iter != shard.object_pool_.end()) {
+      if (auto lock_object = iter->lock(); static_cast<bool>(lock_object) == true) {
+        return lock_object;
+      } else {
+        // Remove the weak_ptr since all associated shared_ptrs have been destroyed.
+        shard.object_pool_.erase(iter);
+      }
+    }
+
+    // Create a shared_ptr and add the object to its shard. The hash is captured so the deleter
+    // finds the same shard without re-hashing a partially destroyed object.
+    auto this_shared_ptr = this->shared_from_this();
+    std::shared_ptr<T> obj_shared(
+        new T(obj), [this_shared_ptr, hash](T* ptr) { this_shared_ptr->deleteObject(ptr, hash); });
+    shard.object_pool_.emplace(obj_shared);
+    return obj_shared;
+  }
+
+  std::size_t poolSize() const {
+    std::size_t size = 0;
+    for (const Shard& shard : shards_) {
+      absl::MutexLock lock(&shard.mutex_);
+      size += shard.object_pool_.size();
+    }
+    return size;
+  }
+
+private:
+  static uint32_t roundUpToPowerOfTwo(uint32_t count) {
+    uint32_t rounded = 1;
+    while (rounded < count) {
+      rounded <<= 1;
+    }
+    return rounded;
+  }
+
+  void deleteObject(T* ptr, size_t hash) {
+    {
+      Shard& shard = shards_[hash & shard_mask_];
+      absl::MutexLock lock(&shard.mutex_);
+      if (auto iter = shard.object_pool_.find(ptr); iter != shard.object_pool_.end()) {
+        // The entry may correspond to a different, newer weak_ptr if another thread re-inserted
+        // an equal object after our reference count hit zero; in that case leave it alone.
+        if (iter->use_count() == 0) {
+          shard.object_pool_.erase(iter);
+        }
+      }
+    }
+    // Delete outside the lock, but only after the erase, so the allocator cannot reuse this
+    // address for a concurrent insertion while our entry still references it.
+    delete ptr;
+  }
+
+  using Element = PoolElement<T, HashFunc, EqualFunc>;
+
+  struct Shard {
+    mutable absl::Mutex mutex_;
+    absl::flat_hash_set<Element, typename Element::Hash, typename Element::Compare>
+        object_pool_ ABSL_GUARDED_BY(mutex_);
+  };
+
+  const size_t shard_mask_;
+  std::vector<Shard> shards_;
+};
+
 } // namespace SharedPool
 } // namespace Envoy
@@ -24,37 +24,41 @@ namespace Stats {
 const char AllocatorImpl::DecrementToZeroSyncPoint[] = "decrement-zero";
 
 AllocatorImpl::~AllocatorImpl() {
-  ASSERT(counters_.empty());
-  ASSERT(gauges_.empty());
+  for (Shard& shard : shards_) {
+    ASSERT(shard.counters_.empty());
+    ASSERT(shard.gauges_.empty());
 
 #ifndef NDEBUG
-  // Move deleted stats into the sets for the ASSERTs in removeFromSetLockHeld to function.
-  for (auto& counter : deleted_counters_) {
-    auto insertion = counters_.insert(counter.get());
-    // Assert that there were no duplicates.
-    ASSERT(insertion.second);
-  }
-  for (auto& gauge : deleted_gauges_) {
-    auto insertion = gauges_.insert(gauge.get());
-    // Assert that there were no duplicates.
-    ASSERT(insertion.second);
-  }
-  for (auto& text_readout : deleted_text_readouts_) {
-    auto insertion = text_readouts_.insert(text_readout.get());
-    // Assert that there were no duplicates.
-    ASSERT(insertion.second);
-  }
+    // Move deleted stats into the sets for the ASSERTs in removeFromSetLockHeld to function.
+    for (auto& counter : shard.deleted_counters_) {
+      auto insertion = shard.counters_.insert(counter.get());
+      // Assert that there were no duplicates.
+      ASSERT(insertion.second);
+    }
+    for (auto& gauge : shard.deleted_gauges_) {
+      auto insertion = shard.gauges_.insert(gauge.get());
+      // Assert that there were no duplicates.
+      ASSERT(insertion.second);
+    }
+    for (auto& text_readout : shard.deleted_text_readouts_) {
+      auto insertion = shard.text_readouts_.insert(text_readout.get());
+      // Assert that there were no duplicates.
+      ASSERT(insertion.second);
+    }
 #endif
+  }
 }
 
 #ifndef ENVOY_CONFIG_COVERAGE
 void AllocatorImpl::debugPrint() {
-  Thread::LockGuard lock(mutex_);
-  for (Counter* counter : counters_) {
-    ENVOY_LOG_MISC(info, "counter: {}", symbolTable().toString(counter->statName()));
-  }
-  for (Gauge* gauge : gauges_) {
-    ENVOY_LOG_MISC(info, "gauge: {}", symbolTable().toString(gauge->statName()));
+  for (Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (Counter* counter : shard.counters_) {
+      ENVOY_LOG_MISC(info, "counter: {}", symbolTable().toString(counter->statName()));
+    }
+    for (Gauge* gauge : shard.gauges_) {
+      ENVOY_LOG_MISC(info, "gauge: {}", symbolTable().toString(gauge->statName()));
+    }
   }
 }
 #endif
@@ -101,11 +105,12 @@ public:
     // destruct anything. But it seems preferable at to be conservative here,
     // as stats will only go out of scope when a scope is destructed (during
     // xDS) or during admin stats operations.
-    Thread::LockGuard lock(alloc_.mutex_);
+    AllocatorImpl::Shard& shard = alloc_.shardForName(this->statName());
+    Thread::LockGuard lock(shard.mutex_);
     ASSERT(ref_count_ >= 1);
     if (--ref_count_ == 0) {
       alloc_.sync().syncPoint(AllocatorImpl::DecrementToZeroSyncPoint);
-      removeFromSetLockHeld();
+      removeFromSetLockHeld(shard);
       return true;
     }
     return false;
@@ -113,11 +118,12 @@ public:
   uint32_t use_count() const override { return ref_count_; }
 
   /**
-   * We must atomically remove the counter/gauges from the allocator's sets when
+   * We must atomically remove the counter/gauges from the shard's sets when
    * our ref-count decrement hits zero. The counters and gauges are held in
    * distinct sets so we virtualize this removal helper.
    */
-  virtual void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) PURE;
+  virtual void removeFromSetLockHeld(AllocatorImpl::Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) PURE;
 
 protected:
   AllocatorImpl& alloc_;
@@ -128,9 +134,9 @@ protected:
   // but these are always in transition to ref-count 2 or higher, and thus
   // cannot race with a decrement to zero.
   //
-  // However, we must hold alloc_.mutex_ when decrementing ref_count_ so that
-  // when it hits zero we can atomically remove it from alloc_.counters_ or
-  // alloc_.gauges_. We leave it atomic to avoid taking the lock on increment.
+  // However, we must hold the shard mutex when decrementing ref_count_ so that
+  // when it hits zero we can atomically remove it from the shard's counters_ or
+  // gauges_ set. We leave it atomic to avoid taking the lock on increment.
   std::atomic<uint32_t> ref_count_{0};
 
   std::atomic<uint16_t> flags_{0};
@@ -142,10 +148,11 @@ public:
               const StatNameTagVector& stat_name_tags)
       : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags) {}
 
-  void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
-    const size_t count = alloc_.counters_.erase(statName());
+  void removeFromSetLockHeld(AllocatorImpl::Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) override {
+    const size_t count = shard.counters_.erase(statName());
     ASSERT(count == 1);
-    alloc_.sinked_counters_.erase(this);
+    shard.sinked_counters_.erase(this);
   }
 
   // Stats::Counter
@@ -191,10 +198,11 @@ public:
     }
   }
 
-  void removeFromSetLockHeld() override ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) {
-    const size_t count = alloc_.gauges_.erase(statName());
+  void removeFromSetLockHeld(AllocatorImpl::Shard& shard)
+      override ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) {
+    const size_t count = shard.gauges_.erase(statName());
     ASSERT(count == 1);
-    alloc_.sinked_gauges_.erase(this);
+    shard.sinked_gauges_.erase(this);
   }
 
   // Stats::Gauge
@@ -262,9 +270,19 @@ public:
 
   void setParentValue(uint64_t value) override { parent_value_ = value; }
 
+  bool latchChanged() override {
+    // Only called from the main thread during each stats flush, so the latched
+    // value needs no synchronization beyond the atomic value() reads.
+    const uint64_t current_value = value();
+    const bool changed = current_value != latched_value_;
+    latched_value_ = current_value;
+    return changed;
+  }
+
 private:
   std::atomic<uint64_t> parent_value_{0};
   std::atomic<uint64_t> child_value_{0};
+  uint64_t latched_value_{0};
 };
 
 class TextReadoutImpl : public StatsSharedImpl<TextReadout> {
@@ -273,10 +291,11 @@ public:
                   const StatNameTagVector& stat_name_tags)
       : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags) {}
 
-  void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
-    const size_t count = alloc_.text_readouts_.erase(statName());
+  void removeFromSetLockHeld(AllocatorImpl::Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) override {
+    const size_t count = shard.text_readouts_.erase(statName());
     ASSERT(count == 1);
-    alloc_.sinked_text_readouts_.erase(this);
+    shard.sinked_text_readouts_.erase(this);
   }
 
   // Stats::TextReadout
@@ -298,18 +317,19 @@ private:
 
 CounterSharedPtr AllocatorImpl::makeCounter(StatName name, StatName tag_extracted_name,
                                             const StatNameTagVector& stat_name_tags) {
-  Thread::LockGuard lock(mutex_);
-  ASSERT(gauges_.find(name) == gauges_.end());
-  ASSERT(text_readouts_.find(name) == text_readouts_.end());
-  auto iter = counters_.find(name);
-  if (iter != counters_.end()) {
+  Shard& shard = shardForName(name);
+  Thread::LockGuard lock(shard.mutex_);
+  ASSERT(shard.gauges_.find(name) == shard.gauges_.end());
+  ASSERT(shard.text_readouts_.find(name) == shard.text_readouts_.end());
+  auto iter = shard.counters_.find(name);
+  if (iter != shard.counters_.end()) {
     return {*iter};
   }
   auto counter = CounterSharedPtr(makeCounterInternal(name, tag_extracted_name, stat_name_tags));
-  counters_.insert(counter.get());
+  shard.counters_.insert(counter.get());
   // Add counter to sinked_counters_ if it matches the sink predicate.
   if (sink_predicates_ != nullptr && sink_predicates_->includeCounter(*counter)) {
-    auto val = sinked_counters_.insert(counter.get());
+    auto val = shard.sinked_counters_.insert(counter.get());
     ASSERT(val.second);
   }
   return counter;
@@ -318,19 +338,20 @@ CounterSharedPtr AllocatorImpl::makeCounter(StatName name, StatName tag_extracte
 GaugeSharedPtr AllocatorImpl::makeGauge(StatName name, StatName tag_extracted_name,
                                         const StatNameTagVector& stat_name_tags,
                                         Gauge::ImportMode import_mode) {
-  Thread::LockGuard lock(mutex_);
-  ASSERT(counters_.find(name) == counters_.end());
-  ASSERT(text_readouts_.find(name) == text_readouts_.end());
-  auto iter = gauges_.find(name);
-  if (iter != gauges_.end()) {
+  Shard& shard = shardForName(name);
+  Thread::LockGuard lock(shard.mutex_);
+  ASSERT(shard.counters_.find(name) == shard.counters_.end());
+  ASSERT(shard.text_readouts_.find(name) == shard.text_readouts_.end());
+  auto iter = shard.gauges_.find(name);
+  if (iter != shard.gauges_.end()) {
     return {*iter};
   }
   auto gauge =
       GaugeSharedPtr(new GaugeImpl(name, *this, tag_extracted_name, stat_name_tags, import_mode));
-  gauges_.insert(gauge.get());
+  shard.gauges_.insert(gauge.get());
   // Add gauge to sinked_gauges_ if it matches the sink predicate.
   if (sink_predicates_ != nullptr && sink_predicates_->includeGauge(*gauge)) {
-    auto val = sinked_gauges_.insert(gauge.get());
+    auto val = shard.sinked_gauges_.insert(gauge.get());
     ASSERT(val.second);
   }
   return gauge;
@@ -338,30 +359,35 @@ GaugeSharedPtr AllocatorImpl::makeGauge(StatName name, StatName tag_extracted_na
 
 TextReadoutSharedPtr AllocatorImpl::makeTextReadout(StatName name, StatName tag_extracted_name,
                                                     const StatNameTagVector& stat_name_tags) {
-  Thread::LockGuard lock(mutex_);
-  ASSERT(counters_.find(name) == counters_.end());
-  ASSERT(gauges_.find(name) == gauges_.end());
-  auto iter = text_readouts_.find(name);
-  if (iter != text_readouts_.end()) {
+  Shard& shard = shardForName(name);
+  Thread::LockGuard lock(shard.mutex_);
+  ASSERT(shard.counters_.find(name) == shard.counters_.end());
+  ASSERT(shard.gauges_.find(name) == shard.gauges_.end());
+  auto iter = shard.text_readouts_.find(name);
+  if (iter != shard.text_readouts_.end()) {
     return {*iter};
   }
   auto text_readout =
       TextReadoutSharedPtr(new TextReadoutImpl(name, *this, tag_extracted_name, stat_name_tags));
-  text_readouts_.insert(text_readout.get());
+  shard.text_readouts_.insert(text_readout.get());
   // Add text_readout to sinked_text_readouts_ if it matches the sink predicate.
   if (sink_predicates_ != nullptr && sink_predicates_->includeTextReadout(*text_readout)) {
-    auto val = sinked_text_readouts_.insert(text_readout.get());
+    auto val = shard.sinked_text_readouts_.insert(text_readout.get());
     ASSERT(val.second);
   }
   return text_readout;
 }
 
 bool AllocatorImpl::isMutexLockedForTest() {
-  bool locked = mutex_.tryLock();
-  if (locked) {
-    mutex_.unlock();
+  for (Shard& shard : shards_) {
+    const bool locked = shard.mutex_.tryLock();
+    if (locked) {
+      shard.mutex_.unlock();
+    } else {
+      return true;
+    }
   }
-  return !locked;
+  return false;
 }
 
 Counter* AllocatorImpl::makeCounterInternal(StatName name, StatName tag_extracted_name,
@@ -370,41 +396,72 @@ Counter* AllocatorImpl::makeCounterInternal(StatName name, StatName tag_extracte
 }
 
 void AllocatorImpl::forEachCounter(SizeFn f_size, StatFn<Counter> f_stat) const {
-  Thread::LockGuard lock(mutex_);
   if (f_size != nullptr) {
-    f_size(counters_.size());
+    // The total is a sizing hint for the caller; stats created or destroyed
+    // in other shards while we iterate below are captured best-effort, just
+    // as they were with a single set when created after iteration.
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.counters_.size();
+    }
+    f_size(total);
   }
-  for (auto& counter : counters_) {
-    f_stat(*counter);
+  for (const Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (auto& counter : shard.counters_) {
+      f_stat(*counter);
+    }
   }
 }
 
 void AllocatorImpl::forEachGauge(SizeFn f_size, StatFn<Gauge> f_stat) const {
-  Thread::LockGuard lock(mutex_);
   if (f_size != nullptr) {
-    f_size(gauges_.size());
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.gauges_.size();
+    }
+    f_size(total);
   }
-  for (auto& gauge : gauges_) {
-    f_stat(*gauge);
+  for (const Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (auto& gauge : shard.gauges_) {
+      f_stat(*gauge);
+    }
   }
 }
 
 void AllocatorImpl::forEachTextReadout(SizeFn f_size, StatFn<TextReadout> f_stat) const {
-  Thread::LockGuard lock(mutex_);
   if (f_size != nullptr) {
-    f_size(text_readouts_.size());
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.text_readouts_.size();
+    }
+    f_size(total);
   }
-  for (auto& text_readout : text_readouts_) {
-    f_stat(*text_readout);
+  for (const Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (auto& text_readout : shard.text_readouts_) {
+      f_stat(*text_readout);
+    }
   }
 }
 
 void AllocatorImpl::forEachSinkedCounter(SizeFn f_size, StatFn<Counter> f_stat) const {
   if (sink_predicates_ != nullptr) {
-    Thread::LockGuard lock(mutex_);
-    f_size(sinked_counters_.size());
-    for (auto counter : sinked_counters_) {
-      f_stat(*counter);
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.sinked_counters_.size();
+    }
+    f_size(total);
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      for (auto counter : shard.sinked_counters_) {
+        f_stat(*counter);
+      }
     }
   } else {
     forEachCounter(f_size, f_stat);
@@ -413,10 +470,17 @@ void AllocatorImpl::forEachSinkedCounter(SizeFn f_size, StatFn<Counter> f_stat)
 
 void AllocatorImpl::forEachSinkedGauge(SizeFn f_size, StatFn<Gauge> f_stat) const {
   if (sink_predicates_ != nullptr) {
-    Thread::LockGuard lock(mutex_);
-    f_size(sinked_gauges_.size());
-    for (auto gauge : sinked_gauges_) {
-      f_stat(*gauge);
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.sinked_gauges_.size();
+    }
+    f_size(total);
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      for (auto gauge : shard.sinked_gauges_) {
+        f_stat(*gauge);
+      }
     }
   } else {
     forEachGauge(f_size, [&f_stat](Gauge& gauge) {
@@ -429,83 +493,105 @@ void AllocatorImpl::forEachSinkedGauge(SizeFn f_size, StatFn<Gauge> f_stat) cons
 
 void AllocatorImpl::forEachSinkedTextReadout(SizeFn f_size, StatFn<TextReadout> f_stat) const {
   if (sink_predicates_ != nullptr) {
-    Thread::LockGuard lock(mutex_);
-    f_size(sinked_text_readouts_.size());
-    for (auto text_readout : sinked_text_readouts_) {
-      f_stat(*text_readout);
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.sinked_text_readouts_.size();
+    }
+    f_size(total);
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      for (auto text_readout : shard.sinked_text_readouts_) {
+        f_stat(*text_readout);
+      }
     }
   } else {
     forEachTextReadout(f_size, f_stat);
   }
 }
 
-void AllocatorImpl::setSinkPredicates(std::unique_ptr<SinkPredicates>&& sink_predicates) {
-  Thread::LockGuard lock(mutex_);
+void AllocatorImpl::setSinkPredicates(std::unique_ptr<SinkPredicates>&& sink_predicates)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  // Hold every shard mutex while installing the predicate so that the factory
+  // methods, which read sink_predicates_ under a single shard mutex, cannot
+  // observe a partially applied update. Shards are locked in index order; no
+  // other code path holds more than one shard mutex at a time.
+  for (Shard& shard : shards_) {
+    shard.mutex_.lock();
+  }
   ASSERT(sink_predicates_ == nullptr);
   sink_predicates_ = std::move(sink_predicates);
-  sinked_counters_.clear();
-  sinked_gauges_.clear();
-  sinked_text_readouts_.clear();
-  // Add counters to the set of sinked counters.
-  for (auto& counter : counters_) {
-    if (sink_predicates_->includeCounter(*counter)) {
-      sinked_counters_.emplace(counter);
+  for (Shard& shard : shards_) {
+    shard.sinked_counters_.clear();
+    shard.sinked_gauges_.clear();
+    shard.sinked_text_readouts_.clear();
+    // Add counters to the set of sinked counters.
+    for (auto& counter : shard.counters_) {
+      if (sink_predicates_->includeCounter(*counter)) {
+        shard.sinked_counters_.emplace(counter);
+      }
     }
-  }
-  // Add gauges to the set of sinked gauges.
-  for (auto& gauge : gauges_) {
-    if (sink_predicates_->includeGauge(*gauge)) {
-      sinked_gauges_.insert(gauge);
+    // Add gauges to the set of sinked gauges.
+    for (auto& gauge : shard.gauges_) {
+      if (sink_predicates_->includeGauge(*gauge)) {
+        shard.sinked_gauges_.insert(gauge);
+      }
     }
-  }
-  // Add text_readouts to the set of sinked text readouts.
-  for (auto& text_readout : text_readouts_) {
-    if (sink_predicates_->includeTextReadout(*text_readout)) {
-      sinked_text_readouts_.insert(text_readout);
+    // Add text_readouts to the set of sinked text readouts.
+    for (auto& text_readout : shard.text_readouts_) {
+      if (sink_predicates_->includeTextReadout(*text_readout)) {
+        shard.sinked_text_readouts_.insert(text_readout);
+      }
     }
   }
+  for (Shard& shard : shards_) {
+    shard.mutex_.unlock();
+  }
 }
 
 void AllocatorImpl::markCounterForDeletion(const CounterSharedPtr& counter) {
-  Thread::LockGuard lock(mutex_);
-  auto iter = counters_.find(counter->statName());
-  if (iter == counters_.end()) {
+  Shard& shard = shardForName(counter->statName());
+  Thread::LockGuard lock(shard.mutex_);
+  auto iter = shard.counters_.find(counter->statName());
+  if (iter == shard.counters_.end()) {
     // This has already been marked for deletion.
     return;
   }
   ASSERT(counter.get() == *iter);
   // Duplicates are ASSERTed in ~AllocatorImpl.
-  deleted_counters_.emplace_back(*iter);
-  counters_.erase(iter);
-  sinked_counters_.erase(counter.get());
+  shard.deleted_counters_.emplace_back(*iter);
+  shard.counters_.erase(iter);
+  shard.sinked_counters_.erase(counter.get());
 }
 
 void AllocatorImpl::markGaugeForDeletion(const GaugeSharedPtr& gauge) {
-  Thread::LockGuard lock(mutex_);
-  auto iter = gauges_.find(gauge->statName());
-  if (iter == gauges_.end()) {
+  Shard& shard = shardForName(gauge->statName());
+  Thread::LockGuard lock(shard.mutex_);
+  auto iter = shard.gauges_.find(gauge->statName());
+  if (iter == shard.gauges_.end()) {
     // This has already been marked for deletion.
     return;
   }
   ASSERT(gauge.get() == *iter);
   // Duplicates are ASSERTed in ~AllocatorImpl.
-  deleted_gauges_.emplace_back(*iter);
-  gauges_.erase(iter);
-  sinked_gauges_.erase(gauge.get());
+  shard.deleted_gauges_.emplace_back(*iter);
+  shard.gauges_.erase(iter);
+  shard.sinked_gauges_.erase(gauge.get());
 }
 
 void AllocatorImpl::markTextReadoutForDeletion(const TextReadoutSharedPtr& text_readout) {
-  Thread::LockGuard lock(mutex_);
-  auto iter = text_readouts_.find(text_readout->statName());
-  if (iter == text_readouts_.end()) {
+  Shard& shard = shardForName(text_readout->statName());
+  Thread::LockGuard lock(shard.mutex_);
+  auto iter = shard.text_readouts_.find(text_readout->statName());
+  if (iter == shard.text_readouts_.end()) {
     // This has already been marked for deletion.
     return;
   }
   ASSERT(text_readout.get() == *iter);
   // Duplicates are ASSERTed in ~AllocatorImpl.
-  deleted_text_readouts_.emplace_back(*iter);
-  text_readouts_.erase(iter);
-  sinked_text_readouts_.erase(text_readout.get());
+  shard.deleted_text_readouts_.emplace_back(*iter);
+  shard.text_readouts_.erase(iter);
+  shard.sinked_text_readouts_.erase(text_readout.get());
 }
 
 } // namespace Stats
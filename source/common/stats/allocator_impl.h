@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <vector>
 
 #include "envoy/common/optref.h"
@@ -20,6 +21,12 @@ class AllocatorImpl : public Allocator {
 public:
   static const char DecrementToZeroSyncPoint[];
 
+  // Number of shards for the central stat sets. Stat creation bursts (e.g. a
+  // CDS update instantiating thousands of cluster scopes) arrive concurrently
+  // from every worker thread, so the sets and their mutex are sharded by
+  // stat-name hash to keep those threads from serializing on a single lock.
+  static constexpr size_t NumShards = 16;
+
   AllocatorImpl(SymbolTable& symbol_table) : symbol_table_(symbol_table) {}
   ~AllocatorImpl() override;
 
@@ -55,7 +62,8 @@ public:
   Thread::ThreadSynchronizer& sync() { return sync_; }
 
   /**
-   * @return whether the allocator's mutex is locked, exposed for testing purposes.
+   * @return whether any of the allocator's shard mutexes is locked, exposed for
+   * testing purposes.
    */
   bool isMutexLockedForTest();
 
@@ -74,39 +82,52 @@ private:
   friend class TextReadoutImpl;
   friend class NotifyingAllocatorImpl;
 
-  // A mutex is needed here to protect both the stats_ object from both
-  // alloc() and free() operations. Although alloc() operations are called under existing locking,
-  // free() operations are made from the destructors of the individual stat objects, which are not
-  // protected by locks.
-  mutable Thread::MutexBasicLockable mutex_;
-
-  StatSet<Counter> counters_ ABSL_GUARDED_BY(mutex_);
-  StatSet<Gauge> gauges_ ABSL_GUARDED_BY(mutex_);
-  StatSet<TextReadout> text_readouts_ ABSL_GUARDED_BY(mutex_);
-
   template <typename StatType> using StatPointerSet = absl::flat_hash_set<StatType*>;
-  // Stat pointers that participate in the flush to sink process.
-  StatPointerSet<Counter> sinked_counters_ ABSL_GUARDED_BY(mutex_);
-  StatPointerSet<Gauge> sinked_gauges_ ABSL_GUARDED_BY(mutex_);
-  StatPointerSet<TextReadout> sinked_text_readouts_ ABSL_GUARDED_BY(mutex_);
 
-  // Predicates used to filter stats to be flushed.
+  // A mutex is needed here to protect the stat sets from both alloc() and
+  // free() operations. Although alloc() operations are called under existing
+  // locking, free() operations are made from the destructors of the individual
+  // stat objects, which are not protected by locks.
+  //
+  // A stat's name determines its shard for its whole lifetime; the cross-type
+  // ASSERTs in the factory methods remain valid because all sets for a given
+  // name live in the same shard.
+  struct Shard {
+    mutable Thread::MutexBasicLockable mutex_;
+
+    StatSet<Counter> counters_ ABSL_GUARDED_BY(mutex_);
+    StatSet<Gauge> gauges_ ABSL_GUARDED_BY(mutex_);
+    StatSet<TextReadout> text_readouts_ ABSL_GUARDED_BY(mutex_);
+
+    // Stat pointers that participate in the flush to sink process.
+    StatPointerSet<Counter> sinked_counters_ ABSL_GUARDED_BY(mutex_);
+    StatPointerSet<Gauge> sinked_gauges_ ABSL_GUARDED_BY(mutex_);
+    StatPointerSet<TextReadout> sinked_text_readouts_ ABSL_GUARDED_BY(mutex_);
+
+    // Retain storage for deleted stats; these are no longer in maps because
+    // the matcher-pattern was established after they were created. Since the
+    // stats are held by reference in code that expects them to be there, we
+    // can't actually delete the stats.
+    //
+    // It seems like it would be better to have each client that expects a stat
+    // to exist to hold it as (e.g.) a CounterSharedPtr rather than a Counter&
+    // but that would be fairly complex to change.
+    std::vector<CounterSharedPtr> deleted_counters_ ABSL_GUARDED_BY(mutex_);
+    std::vector<GaugeSharedPtr> deleted_gauges_ ABSL_GUARDED_BY(mutex_);
+    std::vector<TextReadoutSharedPtr> deleted_text_readouts_ ABSL_GUARDED_BY(mutex_);
+  };
+
+  Shard& shardForName(StatName name) { return shards_[name.hash() % NumShards]; }
+
+  std::array<Shard, NumShards> shards_;
+
+  // Predicates used to filter stats to be flushed. Written only while every
+  // shard mutex is held (see setSinkPredicates), so reads under any single
+  // shard mutex are race-free.
   std::unique_ptr<SinkPredicates> sink_predicates_;
   SymbolTable& symbol_table_;
 
   Thread::ThreadSynchronizer sync_;
-
-  // Retain storage for deleted stats; these are no longer in maps because
-  // the matcher-pattern was established after they were created. Since the
-  // stats are held by reference in code that expects them to be there, we
-  // can't actually delete the stats.
-  //
-  // It seems like it would be better to have each client that expects a stat
-  // to exist to hold it as (e.g.) a CounterSharedPtr rather than a Counter&
-  // but that would be fairly complex to change.
-  std::vector<CounterSharedPtr> deleted_counters_ ABSL_GUARDED_BY(mutex_);
-  std::vector<GaugeSharedPtr> deleted_gauges_ ABSL_GUARDED_BY(mutex_);
-  std::vector<TextReadoutSharedPtr> deleted_text_readouts_ ABSL_GUARDED_BY(mutex_);
 };
 
 } // namespace Stats
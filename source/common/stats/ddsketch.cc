@@ -0,0 +1,104 @@
+#include "source/common/stats/ddsketch.h"
+
+#include <cmath>
+
+#include "source/common/common/assert.h"
+
+namespace Envoy {
+namespace Stats {
+
+DDSketch::DDSketch(double relative_accuracy)
+    : relative_accuracy_(relative_accuracy),
+      gamma_((1.0 + relative_accuracy) / (1.0 - relative_accuracy)),
+      inv_log_gamma_(1.0 / std::log(gamma_)) {
+  ASSERT(relative_accuracy > 0.0 && relative_accuracy < 1.0);
+}
+
+int32_t DDSketch::key(double value) const {
+  return static_cast<int32_t>(std::ceil(std::log(value) * inv_log_gamma_));
+}
+
+double DDSketch::representativeValue(int32_t key) const {
+  // The geometric midpoint 2 * gamma^k / (gamma + 1) is within
+  // relative_accuracy_ of every value in (gamma^(k-1), gamma^k].
+  return 2.0 * std::pow(gamma_, key) / (gamma_ + 1.0);
+}
+
+void DDSketch::insert(double value, uint64_t count) {
+  if (count == 0) {
+    return;
+  }
+  if (value <= 0.0) {
+    zero_count_ += count;
+  } else {
+    bins_[key(value)] += count;
+  }
+  count_ += count;
+  sum_ += value * count;
+}
+
+void DDSketch::accumulate(const DDSketch& other) {
+  // Bins are only compatible between sketches with identical mappings.
+  ASSERT(gamma_ == other.gamma_);
+  zero_count_ += other.zero_count_;
+  count_ += other.count_;
+  sum_ += other.sum_;
+  for (const auto& [key, count] : other.bins_) {
+    bins_[key] += count;
+  }
+}
+
+void DDSketch::clear() {
+  zero_count_ = 0;
+  count_ = 0;
+  sum_ = 0;
+  bins_.clear();
+}
+
+double DDSketch::quantile(double q) const {
+  if (count_ == 0) {
+    return 0.0;
+  }
+  const double rank = q * static_cast<double>(count_ - 1);
+  uint64_t running = zero_count_;
+  if (static_cast<double>(running) > rank) {
+    return 0.0;
+  }
+  for (const auto& [key, count] : bins_) {
+    running += count;
+    if (static_cast<double>(running) > rank) {
+      return representativeValue(key);
+    }
+  }
+  // count_ > 0 guarantees the loop returned unless rounding put the rank at
+  // the very end; report the highest bin in that case.
+  return bins_.empty() ? 0.0 : representativeValue(bins_.rbegin()->first);
+}
+
+uint64_t DDSketch::countBelow(double value) const {
+  uint64_t below = zero_count_;
+  for (const auto& [key, count] : bins_) {
+    if (representativeValue(key) > value) {
+      break;
+    }
+    below += count;
+  }
+  return below;
+}
+
+std::vector<DDSketch::Bin> DDSketch::bins() const {
+  std::vector<Bin> bins;
+  bins.reserve(bins_.size() + (zero_count_ > 0 ? 1 : 0));
+  if (zero_count_ > 0) {
+    bins.push_back({0.0, 0.0, zero_count_});
+  }
+  for (const auto& [key, count] : bins_) {
+    const double upper_bound = std::pow(gamma_, key);
+    const double lower_bound = upper_bound / gamma_;
+    bins.push_back({lower_bound, upper_bound - lower_bound, count});
+  }
+  return bins;
+}
+
+} // namespace Stats
+} // namespace Envoy
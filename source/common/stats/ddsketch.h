@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/container/btree_map.h"
+
+namespace Envoy {
+namespace Stats {
+
+/**
+ * A quantile sketch with a relative-error guarantee, following the DDSketch
+ * construction (Masson et al., VLDB 2019). Values are assigned to
+ * logarithmically sized bins so that any quantile estimate is within
+ * `relative_accuracy` of the true value regardless of the value range, which
+ * keeps high quantiles (p99.99) accurate for latency measurements. Bins are
+ * allocated on demand, so memory is proportional to the spread of observed
+ * values rather than a fixed bin layout, and two sketches built with the same
+ * accuracy merge without loss of accuracy.
+ *
+ * This class is not thread-safe; like histogram_t it relies on the
+ * thread-local collection and main-thread merge discipline in
+ * ThreadLocalStoreImpl.
+ */
+class DDSketch {
+public:
+  static constexpr double DefaultRelativeAccuracy = 0.01;
+
+  explicit DDSketch(double relative_accuracy = DefaultRelativeAccuracy);
+
+  /**
+   * Records `count` occurrences of `value`. Values <= 0 are collapsed into a
+   * dedicated zero bin; stats values are non-negative integers so this only
+   * aggregates exact zeros in practice.
+   */
+  void insert(double value, uint64_t count = 1);
+
+  /**
+   * Adds all values recorded in `other` into this sketch. Both sketches must
+   * have been constructed with the same relative accuracy.
+   */
+  void accumulate(const DDSketch& other);
+
+  /**
+   * Discards all recorded values, retaining the configured accuracy.
+   */
+  void clear();
+
+  /**
+   * @return an estimate of the q-th quantile (q in [0, 1]), within the
+   * configured relative accuracy of the true value. Returns 0 for an empty
+   * sketch.
+   */
+  double quantile(double q) const;
+
+  /**
+   * @return an estimate of the number of recorded values <= `value`.
+   */
+  uint64_t countBelow(double value) const;
+
+  uint64_t count() const { return count_; }
+  double sum() const { return sum_; }
+  double relativeAccuracy() const { return relative_accuracy_; }
+
+  /**
+   * One allocated bin of the sketch, in the same shape as the detailed bucket
+   * view of the default histogram backend.
+   */
+  struct Bin {
+    double lower_bound_;
+    double width_;
+    uint64_t count_;
+  };
+
+  /**
+   * @return the allocated bins in increasing value order, including the zero
+   * bin when present.
+   */
+  std::vector<Bin> bins() const;
+
+private:
+  // Bin index for a positive value: ceil(log(value) / log(gamma)). A value in
+  // bin k satisfies gamma^(k-1) < value <= gamma^k.
+  int32_t key(double value) const;
+
+  // Representative value for bin k, chosen so that the relative error against
+  // any value in the bin is at most relative_accuracy_.
+  double representativeValue(int32_t key) const;
+
+  double relative_accuracy_;
+  double gamma_;
+  double inv_log_gamma_;
+  uint64_t zero_count_{0};
+  uint64_t count_{0};
+  double sum_{0};
+  // Ordered map so that quantiles and cumulative bucket counts are a single
+  // in-order pass over the allocated bins.
+  absl::btree_map<int32_t, uint64_t> bins_;
+};
+
+} // namespace Stats
+} // namespace Envoy
@@ -22,7 +22,13 @@ HistogramStatisticsImpl::HistogramStatisticsImpl(const histogram_t* histogram_pt
                                                  ConstSupportedBuckets& supported_buckets)
     : supported_buckets_(supported_buckets),
       computed_quantiles_(HistogramStatisticsImpl::supportedQuantiles().size(), 0.0), unit_(unit) {
-  refresh(histogram_ptr);
+  // Sketch-backed histograms pass a null histogram and refresh from the sketch
+  // on each merge instead.
+  if (histogram_ptr != nullptr) {
+    refresh(histogram_ptr);
+  } else {
+    computed_buckets_.assign(supported_buckets_.size(), 0);
+  }
 }
 
 const std::vector<double>& HistogramStatisticsImpl::supportedQuantiles() const {
@@ -97,6 +103,40 @@ void HistogramStatisticsImpl::refresh(const histogram_t* new_histogram_ptr) {
   }
 }
 
+/**
+ * Clears the old computed values and refreshes it with values computed from the passed sketch.
+ */
+void HistogramStatisticsImpl::refresh(const DDSketch& sketch) {
+  constexpr double percent_scale = Histogram::PercentScale;
+
+  ASSERT(supportedQuantiles().size() == computed_quantiles_.size());
+  const std::vector<double>& supported_quantiles = supportedQuantiles();
+  for (size_t i = 0; i < supported_quantiles.size(); ++i) {
+    computed_quantiles_[i] = sketch.quantile(supported_quantiles[i]);
+  }
+  if (unit_ == Histogram::Unit::Percent) {
+    for (double& val : computed_quantiles_) {
+      val /= percent_scale;
+    }
+  }
+
+  sample_count_ = sketch.count();
+  sample_sum_ = sketch.sum();
+  if (unit_ == Histogram::Unit::Percent) {
+    sample_sum_ /= percent_scale;
+  }
+
+  computed_buckets_.clear();
+  ConstSupportedBuckets& supported_buckets = supportedBuckets();
+  computed_buckets_.reserve(supported_buckets.size());
+  for (auto bucket : supported_buckets) {
+    if (unit_ == Histogram::Unit::Percent) {
+      bucket *= percent_scale;
+    }
+    computed_buckets_.emplace_back(sketch.countBelow(bucket));
+  }
+}
+
 HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::StatsConfig& config)
     : configs_([&config]() {
         std::vector<Config> configs;
@@ -106,6 +146,17 @@ HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::S
           configs.emplace_back(matcher.match(), std::move(buckets));
         }
 
+        return configs;
+      }()),
+      sketch_configs_([&config]() {
+        std::vector<SketchConfig> configs;
+        for (const auto& matcher : config.histogram_sketch_settings()) {
+          const double accuracy = matcher.relative_accuracy() != 0
+                                      ? matcher.relative_accuracy()
+                                      : DDSketch::DefaultRelativeAccuracy;
+          configs.emplace_back(matcher.match(), accuracy);
+        }
+
         return configs;
       }()) {}
 
@@ -118,6 +169,15 @@ const ConstSupportedBuckets& HistogramSettingsImpl::buckets(absl::string_view st
   return defaultBuckets();
 }
 
+absl::optional<double> HistogramSettingsImpl::sketchAccuracy(absl::string_view stat_name) const {
+  for (const auto& config : sketch_configs_) {
+    if (config.first.match(stat_name)) {
+      return config.second;
+    }
+  }
+  return absl::nullopt;
+}
+
 const ConstSupportedBuckets& HistogramSettingsImpl::defaultBuckets() {
   CONSTRUCT_ON_FIRST_USE(ConstSupportedBuckets,
                          {0.5, 1, 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 30000,
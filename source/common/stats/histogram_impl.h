@@ -10,6 +10,7 @@
 
 #include "source/common/common/matchers.h"
 #include "source/common/common/non_copyable.h"
+#include "source/common/stats/ddsketch.h"
 #include "source/common/stats/metric_impl.h"
 
 #include "circllhist.h"
@@ -24,13 +25,17 @@ public:
 
   // HistogramSettings
   const ConstSupportedBuckets& buckets(absl::string_view stat_name) const override;
+  absl::optional<double> sketchAccuracy(absl::string_view stat_name) const override;
 
   static ConstSupportedBuckets& defaultBuckets();
 
 private:
   using Config = std::pair<Matchers::StringMatcherImpl<envoy::type::matcher::v3::StringMatcher>,
                            ConstSupportedBuckets>;
+  using SketchConfig =
+      std::pair<Matchers::StringMatcherImpl<envoy::type::matcher::v3::StringMatcher>, double>;
   const std::vector<Config> configs_{};
+  const std::vector<SketchConfig> sketch_configs_{};
 };
 
 /**
@@ -50,6 +55,7 @@ public:
       ConstSupportedBuckets& supported_buckets = HistogramSettingsImpl::defaultBuckets());
 
   void refresh(const histogram_t* new_histogram_ptr);
+  void refresh(const DDSketch& sketch);
 
   // HistogramStatistics
   std::string quantileSummary() const override;
@@ -34,10 +34,10 @@ public:
   FastResult fastRejects(StatName name) const override;
   bool slowRejects(FastResult, StatName name) const override;
   bool acceptsAll() const override {
-    return is_inclusive_ && matchers_.empty() && prefixes_.empty();
+    return is_inclusive_ && matchers_.empty() && prefix_trie_.empty() && exact_names_.empty();
   }
   bool rejectsAll() const override {
-    return !is_inclusive_ && matchers_.empty() && prefixes_.empty();
+    return !is_inclusive_ && matchers_.empty() && prefix_trie_.empty() && exact_names_.empty();
   }
 
 private:
@@ -53,7 +53,13 @@ private:
   std::unique_ptr<StatNamePool> stat_name_pool_;
 
   std::vector<Matchers::StringMatcherImpl<envoy::type::matcher::v3::StringMatcher>> matchers_;
-  std::vector<StatName> prefixes_;
+
+  // Case-sensitive prefix and exact rules, lifted out of matchers_ by
+  // optimizeLastMatcher() and compiled into StatName form, so that they can be
+  // evaluated without elaborating the name into a string, in time independent
+  // of the number of rules.
+  StatNamePrefixTrie prefix_trie_;
+  StatNameHashSet exact_names_;
 };
 
 } // namespace Stats
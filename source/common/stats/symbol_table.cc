@@ -259,9 +259,51 @@ bool StatName::startsWith(StatName prefix) const {
   return true; // not reached
 }
 
+void StatNamePrefixTrie::insert(StatName symbolic_prefix) {
+  using TokenIter = SymbolTable::Encoding::TokenIter;
+  Node* node = &root_;
+  TokenIter iter(symbolic_prefix);
+  TokenIter::TokenType type;
+  while ((type = iter.next()) != TokenIter::TokenType::End) {
+    // Dynamic segments are disallowed in prefixes, matching startsWith().
+    ASSERT(type == TokenIter::TokenType::Symbol);
+    if (node->terminal_) {
+      return; // An already-inserted prefix covers this one.
+    }
+    std::unique_ptr<Node>& child = node->children_[iter.symbol()];
+    if (child == nullptr) {
+      child = std::make_unique<Node>();
+    }
+    node = child.get();
+  }
+  node->terminal_ = true;
+  node->children_.clear(); // This prefix covers any longer ones already inserted.
+}
+
+bool StatNamePrefixTrie::containsPrefixOf(StatName stat_name) const {
+  using TokenIter = SymbolTable::Encoding::TokenIter;
+  const Node* node = &root_;
+  TokenIter iter(stat_name);
+  TokenIter::TokenType type;
+  while ((type = iter.next()) != TokenIter::TokenType::End) {
+    if (node->terminal_) {
+      return true; // "a.b.c" starts with "a.b"; dynamic segments may follow.
+    }
+    if (type != TokenIter::TokenType::Symbol) {
+      return false; // As in startsWith(), dynamic segments never match a prefix.
+    }
+    auto child = node->children_.find(iter.symbol());
+    if (child == node->children_.end()) {
+      return false;
+    }
+    node = child->second.get();
+  }
+  return node->terminal_; // "a.b" starts with "a.b" but not with "a.b.c".
+}
+
 std::vector<absl::string_view> SymbolTable::decodeStrings(StatName stat_name) const {
   std::vector<absl::string_view> strings;
-  Thread::LockGuard lock(lock_);
+  absl::ReaderMutexLock lock(&lock_);
   Encoding::decodeTokens(
       stat_name,
       [this, &strings](Symbol symbol)
@@ -312,11 +354,39 @@ void SymbolTable::addTokensToEncoding(const absl::string_view name, Encoding& en
   std::vector<Symbol> symbols;
   symbols.reserve(tokens.size());
 
-  // Now take the lock and populate the Symbol objects, which involves bumping
-  // ref-counts in this.
   {
-    Thread::LockGuard lock(lock_);
+    absl::MutexLock lock(&recent_lookups_lock_);
     recent_lookups_.lookup(name);
+  }
+
+  // Fast path: every token is already interned, so a shared lock and atomic
+  // ref-count bumps suffice. Entries cannot be erased or moved by a rehash
+  // while the shared lock is held, so the collected pointers stay valid.
+  {
+    absl::ReaderMutexLock lock(&lock_);
+    absl::InlinedVector<SharedSymbol*, 8> shared_symbols;
+    for (auto& token : tokens) {
+      auto encode_find = encode_map_.find(token);
+      if (encode_find == encode_map_.end()) {
+        shared_symbols.clear();
+        break;
+      }
+      shared_symbols.push_back(&encode_find->second);
+    }
+    if (shared_symbols.size() == tokens.size()) {
+      for (SharedSymbol* shared_symbol : shared_symbols) {
+        shared_symbol->ref_count_.fetch_add(1, std::memory_order_relaxed);
+        symbols.push_back(shared_symbol->symbol_);
+      }
+      encoding.addSymbols(symbols);
+      return;
+    }
+  }
+
+  // Slow path: at least one token is new; take the exclusive lock to intern
+  // it, which involves bumping ref-counts in this.
+  {
+    absl::MutexLock lock(&lock_);
     for (auto& token : tokens) {
       // TODO(jmarantz): consider using StatNameDynamicStorage for tokens with
       // length below some threshold, say 4 bytes. It might be preferable not to
@@ -331,7 +401,7 @@ void SymbolTable::addTokensToEncoding(const absl::string_view name, Encoding& en
 }
 
 uint64_t SymbolTable::numSymbols() const {
-  Thread::LockGuard lock(lock_);
+  absl::ReaderMutexLock lock(&lock_);
   ASSERT(encode_map_.size() == decode_map_.size());
   return encode_map_.size();
 }
@@ -344,7 +414,7 @@ void SymbolTable::incRefCount(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name);
 
-  Thread::LockGuard lock(lock_);
+  absl::ReaderMutexLock lock(&lock_);
   for (Symbol symbol : symbols) {
     auto decode_search = decode_map_.find(symbol);
 
@@ -358,7 +428,7 @@ void SymbolTable::incRefCount(const StatName& stat_name) {
            "https://github.com/envoyproxy/envoy/blob/main/source/docs/stats.md#"
            "debugging-symbol-table-assertions");
 
-    ++encode_search->second.ref_count_;
+    encode_search->second.ref_count_.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
@@ -366,21 +436,41 @@ void SymbolTable::free(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name);
 
-  Thread::LockGuard lock(lock_);
-  for (Symbol symbol : symbols) {
-    auto decode_search = decode_map_.find(symbol);
-    ASSERT(decode_search != decode_map_.end());
+  // Decrement the ref-counts under the shared lock; freeing a symbol that is
+  // still referenced elsewhere, the common case, then needs no exclusive
+  // lock. Symbols whose count reaches zero are erased below.
+  absl::InlinedVector<Symbol, 8> zero_ref_symbols;
+  {
+    absl::ReaderMutexLock lock(&lock_);
+    for (Symbol symbol : symbols) {
+      auto decode_search = decode_map_.find(symbol);
+      ASSERT(decode_search != decode_map_.end());
+
+      auto encode_search = encode_map_.find(decode_search->second->toStringView());
+      ASSERT(encode_search != encode_map_.end());
+
+      if (encode_search->second.ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        zero_ref_symbols.push_back(symbol);
+      }
+    }
+  }
+  if (zero_ref_symbols.empty()) {
+    return;
+  }
 
+  // Erase the mappings for now-unused symbols and return them to the reuse
+  // pool. This requires the exclusive lock, and must tolerate both a
+  // concurrent encode having revived the symbol since we dropped the shared
+  // lock and a concurrent free having already erased it.
+  absl::MutexLock lock(&lock_);
+  for (Symbol symbol : zero_ref_symbols) {
+    auto decode_search = decode_map_.find(symbol);
+    if (decode_search == decode_map_.end()) {
+      continue; // Another releaser already recycled this symbol.
+    }
     auto encode_search = encode_map_.find(decode_search->second->toStringView());
     ASSERT(encode_search != encode_map_.end());
-
-    // If that was the last remaining client usage of the symbol, erase the
-    // current mappings and add the now-unused symbol to the reuse pool.
-    //
-    // The "if (--EXPR.ref_count_)" pattern speeds up BM_CreateRace by 20% in
-    // symbol_table_speed_test.cc, relative to breaking out the decrement into a
-    // separate step, likely due to the non-trivial dereferences in EXPR.
-    if (--encode_search->second.ref_count_ == 0) {
+    if (encode_search->second.ref_count_.load(std::memory_order_acquire) == 0) {
       decode_map_.erase(decode_search);
       encode_map_.erase(encode_search);
       pool_.push(symbol);
@@ -392,10 +482,10 @@ uint64_t SymbolTable::getRecentLookups(const RecentLookupsFn& iter) const {
   uint64_t total = 0;
   absl::flat_hash_map<std::string, uint64_t> name_count_map;
 
-  // We don't want to hold lock_ while calling the iterator, but we need it to
-  // access recent_lookups_, so we buffer in name_count_map.
+  // We don't want to hold the lock while calling the iterator, but we need it
+  // to access recent_lookups_, so we buffer in name_count_map.
   {
-    Thread::LockGuard lock(lock_);
+    absl::MutexLock lock(&recent_lookups_lock_);
     recent_lookups_.forEach(
         [&name_count_map](absl::string_view str, uint64_t count)
             ABSL_NO_THREAD_SAFETY_ANALYSIS { name_count_map[std::string(str)] += count; });
@@ -445,17 +535,17 @@ DynamicSpans SymbolTable::getDynamicSpans(StatName stat_name) const {
 }
 
 void SymbolTable::setRecentLookupCapacity(uint64_t capacity) {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&recent_lookups_lock_);
   recent_lookups_.setCapacity(capacity);
 }
 
 void SymbolTable::clearRecentLookups() {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&recent_lookups_lock_);
   recent_lookups_.clear();
 }
 
 uint64_t SymbolTable::recentLookupCapacity() const {
-  Thread::LockGuard lock(lock_);
+  absl::MutexLock lock(&recent_lookups_lock_);
   return recent_lookups_.capacity();
 }
 
@@ -492,7 +582,7 @@ Symbol SymbolTable::toSymbol(absl::string_view sv) {
 }
 
 absl::string_view SymbolTable::fromSymbol(const Symbol symbol) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    ABSL_SHARED_LOCKS_REQUIRED(lock_) {
   auto search = decode_map_.find(symbol);
   RELEASE_ASSERT(search != decode_map_.end(), "no such symbol");
   return search->second->toStringView();
@@ -513,12 +603,12 @@ bool SymbolTable::lessThan(const StatName& a, const StatName& b) const {
   // Proactively take the table lock in anticipation that we'll need to
   // convert at least one symbol to a string_view, and it's easier not to
   // bother to lazily take the lock.
-  Thread::LockGuard lock(lock_);
+  absl::ReaderMutexLock lock(&lock_);
   return lessThanLockHeld(a, b);
 }
 
 bool SymbolTable::lessThanLockHeld(const StatName& a, const StatName& b) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    ABSL_SHARED_LOCKS_REQUIRED(lock_) {
   Encoding::TokenIter a_iter(a), b_iter(b);
   while (true) {
     Encoding::TokenIter::TokenType a_type = a_iter.next();
@@ -548,7 +638,7 @@ bool SymbolTable::lessThanLockHeld(const StatName& a, const StatName& b) const
 
 #ifndef ENVOY_CONFIG_COVERAGE
 void SymbolTable::debugPrint() const {
-  Thread::LockGuard lock(lock_);
+  absl::ReaderMutexLock lock(&lock_);
   std::vector<Symbol> symbols;
   for (const auto& p : decode_map_) {
     symbols.push_back(p.first);
@@ -557,7 +647,8 @@ void SymbolTable::debugPrint() const {
   for (Symbol symbol : symbols) {
     const InlineString& token = *decode_map_.find(symbol)->second;
     const SharedSymbol& shared_symbol = encode_map_.find(token.toStringView())->second;
-    ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token.toStringView(), shared_symbol.ref_count_);
+    ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token.toStringView(),
+                   shared_symbol.ref_count_.load(std::memory_order_relaxed));
   }
 }
 #endif
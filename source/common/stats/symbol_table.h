@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <stack>
 #include <string>
@@ -19,6 +20,7 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/str_split.h"
+#include "absl/synchronization/mutex.h"
 
 namespace Envoy {
 namespace Stats {
@@ -197,6 +199,7 @@ public:
 
   private:
     friend class StatName;
+    friend class StatNamePrefixTrie;
     friend class SymbolTable;
     class TokenIter;
 
@@ -349,7 +352,7 @@ public:
   void sortByStatNames(Iter begin, Iter end, GetStatName get_stat_name) const {
     // Grab the lock once before sorting begins, so we don't have to re-take
     // it on every comparison.
-    Thread::LockGuard lock(lock_);
+    absl::ReaderMutexLock lock(&lock_);
     StatNameCompare<GetStatName, Obj> compare(*this, get_stat_name);
     std::sort(begin, end, compare);
   }
@@ -398,12 +401,25 @@ private:
   struct SharedSymbol {
     SharedSymbol(Symbol symbol) : symbol_(symbol) {}
 
+    // flat_hash_map needs to move values on rehash, which atomics do not allow.
+    // Rehashes only happen under the exclusive lock, so a plain load/store of
+    // the count during the move is safe.
+    SharedSymbol(SharedSymbol&& other) noexcept
+        : symbol_(other.symbol_), ref_count_(other.ref_count_.load(std::memory_order_relaxed)) {}
+
     Symbol symbol_;
-    uint32_t ref_count_{1};
+
+    // Incremented and decremented under the shared lock; entries are only
+    // erased (when the count reaches zero) under the exclusive lock.
+    std::atomic<uint32_t> ref_count_{1};
   };
 
-  // This must be held during both encode() and free().
-  mutable Thread::MutexBasicLockable lock_;
+  // Reader/writer lock over the symbol maps. Encoding names whose tokens are
+  // all already interned, decoding, and ref-count maintenance take this
+  // shared so that hot-path lookups do not contend with each other; only
+  // interning a new symbol or erasing a no-longer-referenced one requires the
+  // exclusive lock.
+  mutable absl::Mutex lock_;
 
   /**
    * Decodes a uint8_t array into an array of period-delimited strings. Note
@@ -434,7 +450,7 @@ private:
    * @param symbol the individual symbol to be decoded.
    * @return absl::string_view the decoded string.
    */
-  absl::string_view fromSymbol(Symbol symbol) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  absl::string_view fromSymbol(Symbol symbol) const ABSL_SHARED_LOCKS_REQUIRED(lock_);
 
   /**
    * Stages a new symbol for use. To be called after a successful insertion.
@@ -451,7 +467,7 @@ private:
   void addTokensToEncoding(absl::string_view name, Encoding& encoding);
 
   Symbol monotonicCounter() {
-    Thread::LockGuard lock(lock_);
+    absl::ReaderMutexLock lock(&lock_);
     return monotonic_counter_;
   }
 
@@ -474,7 +490,12 @@ private:
   // TODO(ambuc): There might be an optimization here relating to storing ranges of freed symbols
   // using an Envoy::IntervalSet.
   std::stack<Symbol> pool_ ABSL_GUARDED_BY(lock_);
-  RecentLookups recent_lookups_ ABSL_GUARDED_BY(lock_);
+
+  // Guarded separately from the symbol maps so that recording a lookup does
+  // not force encoders onto the exclusive lock. Never held together with
+  // lock_.
+  mutable absl::Mutex recent_lookups_lock_;
+  RecentLookups recent_lookups_ ABSL_GUARDED_BY(recent_lookups_lock_);
 };
 
 // Base class for holding the backing-storing for a StatName. The two derived
@@ -875,6 +896,47 @@ private:
   SymbolTable::StoragePtr storage_;
 };
 
+// Holds a compiled set of symbolic prefixes, answering prefix-of queries in
+// time proportional to the number of tokens in the queried name, independent
+// of how many prefixes are stored. This is useful when evaluating large
+// inclusion/exclusion rule-sets against every created stat, where scanning a
+// vector of prefixes with StatName::startsWith would be linear in the number
+// of rules.
+//
+// The trie records only the Symbols of each inserted prefix; it does not take
+// symbol references, so the inserted StatNames must out-live the trie, e.g. by
+// retaining them in a StatNamePool.
+class StatNamePrefixTrie {
+public:
+  /**
+   * Adds a prefix to the trie. As with StatName::startsWith, the prefix must
+   * be composed entirely of symbolic segments; dynamic segments are not
+   * supported.
+   *
+   * @param symbolic_prefix the prefix to add.
+   */
+  void insert(StatName symbolic_prefix);
+
+  /**
+   * @param stat_name the name to test.
+   * @return true if stat_name.startsWith(prefix) holds for any inserted prefix.
+   */
+  bool containsPrefixOf(StatName stat_name) const;
+
+  /**
+   * @return whether the trie has no prefixes.
+   */
+  bool empty() const { return !root_.terminal_ && root_.children_.empty(); }
+
+private:
+  struct Node {
+    absl::flat_hash_map<Symbol, std::unique_ptr<Node>> children_;
+    bool terminal_{false};
+  };
+
+  Node root_;
+};
+
 // Value-templatized hash-map with StatName key.
 template <class T> using StatNameHashMap = absl::flat_hash_map<StatName, T>;
 
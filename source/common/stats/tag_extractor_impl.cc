@@ -300,6 +300,156 @@ bool TagExtractorTokensImpl::searchTags(const std::vector<absl::string_view>& in
   return pattern_index == tokens_.size() && input_index == input_tokens.size();
 }
 
+namespace {
+
+// Returns true if the stat name ends in "_rq_" followed by the given number
+// of trailing characters, e.g. suffix_chars == 3 checks "*_rq_???".
+bool endsInRqSuffix(absl::string_view name, size_t suffix_chars) {
+  const size_t rq_size = 4 + suffix_chars; // "_rq_" plus the suffix.
+  return name.size() >= rq_size && name.substr(name.size() - rq_size, 4) == "_rq_";
+}
+
+// Advances past a maximal run of digits starting at index i, returning the
+// index of the first non-digit (or str.size()).
+size_t consumeDigits(absl::string_view str, size_t i) {
+  while (i < str.size() && absl::ascii_isdigit(str[i])) {
+    ++i;
+  }
+  return i;
+}
+
+// Returns the length of an address at the start of str as rendered into stat
+// names -- "127.0.0.1_3012" or "[fe80__1]_3012" -- or 0 if str does not
+// start with one. This mirrors the <ADDRESS> pattern in
+// source/common/config/well_known_names.cc.
+size_t addressLength(absl::string_view str) {
+  size_t i = 0;
+  if (!str.empty() && str[0] == '[') {
+    // Bracketed IPv6 form: "[" followed by hex digits and underscores.
+    for (i = 1; i < str.size() && (absl::ascii_isxdigit(str[i]) || str[i] == '_'); ++i) {
+    }
+    if (i == 1 || i >= str.size() || str[i] != ']') {
+      return 0;
+    }
+    ++i;
+  } else {
+    // Dotted IPv4 form: four runs of 1-3 digits separated by dots.
+    for (int group = 0; group < 4; ++group) {
+      if (group > 0) {
+        if (i >= str.size() || str[i] != '.') {
+          return 0;
+        }
+        ++i;
+      }
+      const size_t digits_end = consumeDigits(str, i);
+      const size_t num_digits = digits_end - i;
+      if (num_digits < 1 || num_digits > 3) {
+        return 0;
+      }
+      i = digits_end;
+    }
+  }
+  // The port is appended after an underscore.
+  if (i >= str.size() || str[i] != '_') {
+    return 0;
+  }
+  const size_t port_end = consumeDigits(str, i + 1);
+  if (port_end == i + 1) {
+    return 0;
+  }
+  return port_end;
+}
+
+} // namespace
+
+TagExtractorResponseCodeImpl::TagExtractorResponseCodeImpl(absl::string_view name)
+    : TagExtractorImplBase(name, "") {}
+
+bool TagExtractorResponseCodeImpl::extractTag(TagExtractionContext& context,
+                                              std::vector<Tag>& tags,
+                                              IntervalSet<size_t>& remove_characters) const {
+  PERF_OPERATION(perf);
+
+  const absl::string_view name = context.name();
+  if (!endsInRqSuffix(name, 3) || !absl::ascii_isdigit(name[name.size() - 3]) ||
+      !absl::ascii_isdigit(name[name.size() - 2]) || !absl::ascii_isdigit(name[name.size() - 1])) {
+    PERF_RECORD(perf, "compiled-miss", name_);
+    PERF_TAG_INC(missed_);
+    return false;
+  }
+  addTagReturningValueRef(tags) = std::string(name.substr(name.size() - 3));
+
+  // Remove "_<code>", leaving the name ending in "_rq".
+  remove_characters.insert(name.size() - 4, name.size());
+  PERF_RECORD(perf, "compiled-match", name_);
+  PERF_TAG_INC(matched_);
+  return true;
+}
+
+TagExtractorResponseCodeClassImpl::TagExtractorResponseCodeClassImpl(absl::string_view name)
+    : TagExtractorImplBase(name, "") {}
+
+bool TagExtractorResponseCodeClassImpl::extractTag(TagExtractionContext& context,
+                                                   std::vector<Tag>& tags,
+                                                   IntervalSet<size_t>& remove_characters) const {
+  PERF_OPERATION(perf);
+
+  const absl::string_view name = context.name();
+  if (!endsInRqSuffix(name, 3) || !absl::ascii_isdigit(name[name.size() - 3]) ||
+      name[name.size() - 2] != 'x' || name[name.size() - 1] != 'x') {
+    PERF_RECORD(perf, "compiled-miss", name_);
+    PERF_TAG_INC(missed_);
+    return false;
+  }
+  addTagReturningValueRef(tags) = std::string(name.substr(name.size() - 3, 1));
+
+  // Remove only the digit, leaving the name ending in "_rq_xx".
+  remove_characters.insert(name.size() - 3, name.size() - 2);
+  PERF_RECORD(perf, "compiled-match", name_);
+  PERF_TAG_INC(matched_);
+  return true;
+}
+
+TagExtractorListenerAddressImpl::TagExtractorListenerAddressImpl(absl::string_view name)
+    : TagExtractorImplBase(name, "") {
+  prefix_ = "listener";
+}
+
+bool TagExtractorListenerAddressImpl::extractTag(TagExtractionContext& context,
+                                                 std::vector<Tag>& tags,
+                                                 IntervalSet<size_t>& remove_characters) const {
+  PERF_OPERATION(perf);
+
+  const absl::string_view name = context.name();
+  constexpr absl::string_view prefix = "listener.";
+  if (absl::StartsWith(name, prefix)) {
+    const absl::string_view remainder = name.substr(prefix.size());
+
+    // An address spans several dot-separated tokens ("127.0.0.1_3012"), so
+    // try the address forms first and fall back to a single token, mirroring
+    // the alternation order of the regex this replaces.
+    size_t len = addressLength(remainder);
+    if (len == 0 || len >= remainder.size() || remainder[len] != '.') {
+      len = remainder.find('.');
+    }
+    if (len != absl::string_view::npos && len > 0) {
+      const absl::string_view value = remainder.substr(0, len);
+      if (value != "admin") {
+        addTagReturningValueRef(tags) = std::string(value);
+
+        // Remove the address and its trailing dot.
+        remove_characters.insert(prefix.size(), prefix.size() + len + 1);
+        PERF_RECORD(perf, "compiled-match", name_);
+        PERF_TAG_INC(matched_);
+        return true;
+      }
+    }
+  }
+  PERF_RECORD(perf, "compiled-miss", name_);
+  PERF_TAG_INC(missed_);
+  return false;
+}
+
 TagExtractorFixedImpl::TagExtractorFixedImpl(absl::string_view name, absl::string_view value)
     : TagExtractorImplBase(name, value), value_(std::string(value)) {}
 
@@ -170,6 +170,50 @@ private:
   const uint32_t match_index_;
 };
 
+/**
+ * Extracts a 3-digit response-code from stat names ending in
+ * "_rq_<code>". The tag value is the code, and "_<code>" is removed from
+ * the stat name, matching the retired regex "_rq(_(\d{3}))$". This pattern
+ * runs against every stat name but matches within the final dot-separated
+ * token, so it cannot use TagExtractorTokensImpl; a hand-written scan keeps
+ * the regex engines off this hot path.
+ */
+class TagExtractorResponseCodeImpl : public TagExtractorImplBase {
+public:
+  explicit TagExtractorResponseCodeImpl(absl::string_view name);
+
+  bool extractTag(TagExtractionContext& context, std::vector<Tag>& tags,
+                  IntervalSet<size_t>& remove_characters) const override;
+};
+
+/**
+ * Extracts a response-code class from stat names ending in "_rq_<digit>xx".
+ * The tag value is the digit, and only the digit is removed from the stat
+ * name (leaving "_rq_xx"), matching the retired regex "_rq_((\d))xx$".
+ */
+class TagExtractorResponseCodeClassImpl : public TagExtractorImplBase {
+public:
+  explicit TagExtractorResponseCodeClassImpl(absl::string_view name);
+
+  bool extractTag(TagExtractionContext& context, std::vector<Tag>& tags,
+                  IntervalSet<size_t>& remove_characters) const override;
+};
+
+/**
+ * Extracts the address (or stat prefix) following "listener." in a stat
+ * name, matching the retired regex "^listener\.((<ADDRESS>|<TAG_VALUE>)\.)"
+ * with negative-match "admin". An IPv4 address rendered as
+ * "127.0.0.1_3012" spans several dot-separated tokens, which is why this
+ * cannot use TagExtractorTokensImpl.
+ */
+class TagExtractorListenerAddressImpl : public TagExtractorImplBase {
+public:
+  explicit TagExtractorListenerAddressImpl(absl::string_view name);
+
+  bool extractTag(TagExtractionContext& context, std::vector<Tag>& tags,
+                  IntervalSet<size_t>& remove_characters) const override;
+};
+
 /**
  * Implements a tag with a fixed value. These are added unconditionally, but
  * participate in duplicate reduction.
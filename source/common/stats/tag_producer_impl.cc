@@ -5,12 +5,29 @@
 #include "envoy/common/exception.h"
 #include "envoy/config/metrics/v3/stats.pb.h"
 
+#include "source/common/common/assert.h"
 #include "source/common/common/utility.h"
 #include "source/common/stats/tag_extractor_impl.h"
 
 namespace Envoy {
 namespace Stats {
 
+namespace {
+
+TagExtractorPtr createCompiledExtractor(const Config::TagNameValues::CompiledDescriptor& desc) {
+  switch (desc.pattern_) {
+  case Config::TagNameValues::CompiledPattern::ResponseCode:
+    return std::make_unique<TagExtractorResponseCodeImpl>(desc.name_);
+  case Config::TagNameValues::CompiledPattern::ResponseCodeClass:
+    return std::make_unique<TagExtractorResponseCodeClassImpl>(desc.name_);
+  case Config::TagNameValues::CompiledPattern::ListenerAddress:
+    return std::make_unique<TagExtractorListenerAddressImpl>(desc.name_);
+  }
+  PANIC_DUE_TO_CORRUPT_ENUM;
+}
+
+} // namespace
+
 TagProducerImpl::TagProducerImpl(const envoy::config::metrics::v3::StatsConfig& config)
     : TagProducerImpl(config, {}) {}
 
@@ -62,6 +79,12 @@ int TagProducerImpl::addExtractorsMatching(absl::string_view name) {
       ++num_found;
     }
   }
+  for (const auto& desc : Config::TagNames::get().compiledDescriptorVec()) {
+    if (desc.name_ == name) {
+      addExtractor(createCompiledExtractor(desc));
+      ++num_found;
+    }
+  }
   return num_found;
 }
 
@@ -139,6 +162,9 @@ void TagProducerImpl::addDefaultExtractors(const envoy::config::metrics::v3::Sta
     for (const auto& desc : Config::TagNames::get().tokenizedDescriptorVec()) {
       addExtractor(std::make_unique<TagExtractorTokensImpl>(desc.name_, desc.pattern_));
     }
+    for (const auto& desc : Config::TagNames::get().compiledDescriptorVec()) {
+      addExtractor(createCompiledExtractor(desc));
+    }
   }
 }
 
@@ -37,6 +37,9 @@ ThreadLocalStoreImpl::ThreadLocalStoreImpl(Allocator& alloc)
   for (const auto& desc : Config::TagNames::get().descriptorVec()) {
     well_known_tags_->rememberBuiltin(desc.name_);
   }
+  for (const auto& desc : Config::TagNames::get().compiledDescriptorVec()) {
+    well_known_tags_->rememberBuiltin(desc.name_);
+  }
   StatNameManagedStorage empty("", alloc.symbolTable());
   auto new_scope = std::make_shared<ScopeImpl>(*this, StatName(empty.statName()));
   addScope(new_scope);
@@ -230,6 +233,21 @@ void ThreadLocalStoreImpl::mergeHistograms(PostMergeCb merge_complete_cb) {
   if (!shutting_down_) {
     ASSERT(!merge_in_progress_);
     merge_in_progress_ = true;
+    // Snapshot which histograms have recorded values since the last merge before the TLS
+    // histograms swap their write buffers, so that the expensive merge only visits active
+    // histograms. The refcounts keep the selected histograms alive across the cross-thread
+    // posts even if they are deleted mid-cycle.
+    auto histograms_to_merge = std::make_shared<std::vector<ParentHistogramImplSharedPtr>>();
+    {
+      Thread::LockGuard lock(hist_mutex_);
+      for (ParentHistogramImpl* histogram : histogram_set_) {
+        if (histogram->shouldMerge()) {
+          histograms_to_merge->emplace_back(histogram);
+        } else {
+          histogram->clearIdleInterval();
+        }
+      }
+    }
     tls_cache_->runOnAllThreads(
         [](OptRef<TlsCache> tls_cache) {
           for (const auto& id_hist : tls_cache->tls_histogram_cache_) {
@@ -237,16 +255,22 @@ void ThreadLocalStoreImpl::mergeHistograms(PostMergeCb merge_complete_cb) {
             tls_hist->beginMerge();
           }
         },
-        [this, merge_complete_cb]() -> void { mergeInternal(merge_complete_cb); });
+        [this, merge_complete_cb, histograms_to_merge]() -> void {
+          mergeInternal(merge_complete_cb, *histograms_to_merge);
+        });
   } else {
     // If server is shutting down, just call the callback to allow flush to continue.
     merge_complete_cb();
   }
 }
 
-void ThreadLocalStoreImpl::mergeInternal(PostMergeCb merge_complete_cb) {
+void ThreadLocalStoreImpl::mergeInternal(
+    PostMergeCb merge_complete_cb,
+    const std::vector<ParentHistogramImplSharedPtr>& histograms_to_merge) {
   if (!shutting_down_) {
-    forEachHistogram(nullptr, [](ParentHistogram& histogram) { histogram.merge(); });
+    for (const ParentHistogramImplSharedPtr& histogram : histograms_to_merge) {
+      histogram->merge();
+    }
     merge_complete_cb();
     merge_in_progress_ = false;
   }
@@ -668,8 +692,10 @@ Histogram& ThreadLocalStoreImpl::ScopeImpl::histogramFromStatNameWithTags(
   } else {
     StatNameTagHelper tag_helper(parent_, joiner.tagExtractedName(), stat_name_tags);
 
-    ConstSupportedBuckets* buckets = nullptr;
-    buckets = &parent_.histogram_settings_->buckets(symbolTable().toString(final_stat_name));
+    const std::string stat_name_str = symbolTable().toString(final_stat_name);
+    ConstSupportedBuckets* buckets = &parent_.histogram_settings_->buckets(stat_name_str);
+    const absl::optional<double> sketch_accuracy =
+        parent_.histogram_settings_->sketchAccuracy(stat_name_str);
 
     RefcountPtr<ParentHistogramImpl> stat;
     {
@@ -680,7 +706,7 @@ Histogram& ThreadLocalStoreImpl::ScopeImpl::histogramFromStatNameWithTags(
       } else {
         stat = new ParentHistogramImpl(final_stat_name, unit, parent_,
                                        tag_helper.tagExtractedName(), tag_helper.statNameTags(),
-                                       *buckets, parent_.next_histogram_id_++);
+                                       *buckets, sketch_accuracy, parent_.next_histogram_id_++);
         if (!parent_.shutting_down_) {
           parent_.histogram_set_.insert(stat.get());
           if (parent_.sink_predicates_.has_value() &&
@@ -787,7 +813,8 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 
   TlsHistogramSharedPtr hist_tls_ptr(
       new ThreadLocalHistogramImpl(parent.statName(), parent.unit(), tag_helper.tagExtractedName(),
-                                   tag_helper.statNameTags(), symbolTable()));
+                                   tag_helper.statNameTags(), symbolTable(),
+                                   parent.sketchAccuracy()));
 
   parent.addTlsHistogram(hist_tls_ptr);
 
@@ -801,39 +828,65 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 ThreadLocalHistogramImpl::ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit,
                                                    StatName tag_extracted_name,
                                                    const StatNameTagVector& stat_name_tags,
-                                                   SymbolTable& symbol_table)
+                                                   SymbolTable& symbol_table,
+                                                   absl::optional<double> sketch_accuracy)
     : HistogramImplHelper(name, tag_extracted_name, stat_name_tags, symbol_table), unit_(unit),
       used_(false), created_thread_id_(std::this_thread::get_id()), symbol_table_(symbol_table) {
-  histograms_[0] = hist_alloc();
-  histograms_[1] = hist_alloc();
+  if (sketch_accuracy.has_value()) {
+    sketches_[0] = std::make_unique<DDSketch>(*sketch_accuracy);
+    sketches_[1] = std::make_unique<DDSketch>(*sketch_accuracy);
+  } else {
+    histograms_[0] = hist_alloc();
+    histograms_[1] = hist_alloc();
+  }
 }
 
 ThreadLocalHistogramImpl::~ThreadLocalHistogramImpl() {
   MetricImpl::clear(symbol_table_);
-  hist_free(histograms_[0]);
-  hist_free(histograms_[1]);
+  if (histograms_[0] != nullptr) {
+    hist_free(histograms_[0]);
+    hist_free(histograms_[1]);
+  }
 }
 
 void ThreadLocalHistogramImpl::recordValue(uint64_t value) {
   ASSERT(std::this_thread::get_id() == created_thread_id_);
-  hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  if (sketches_[0] != nullptr) {
+    sketches_[current_active_]->insert(value);
+  } else {
+    hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  }
   used_ = true;
 }
 
 void ThreadLocalHistogramImpl::merge(histogram_t* target) {
+  ASSERT(histograms_[0] != nullptr);
   histogram_t** other_histogram = &histograms_[otherHistogramIndex()];
   hist_accumulate(target, other_histogram, 1);
   hist_clear(*other_histogram);
 }
 
+void ThreadLocalHistogramImpl::merge(DDSketch& target) {
+  ASSERT(sketches_[0] != nullptr);
+  DDSketch& other_sketch = *sketches_[otherHistogramIndex()];
+  target.accumulate(other_sketch);
+  other_sketch.clear();
+}
+
 ParentHistogramImpl::ParentHistogramImpl(StatName name, Histogram::Unit unit,
                                          ThreadLocalStoreImpl& thread_local_store,
                                          StatName tag_extracted_name,
                                          const StatNameTagVector& stat_name_tags,
-                                         ConstSupportedBuckets& supported_buckets, uint64_t id)
+                                         ConstSupportedBuckets& supported_buckets,
+                                         absl::optional<double> sketch_accuracy, uint64_t id)
     : MetricImpl(name, tag_extracted_name, stat_name_tags, thread_local_store.symbolTable()),
-      unit_(unit), thread_local_store_(thread_local_store), interval_histogram_(hist_alloc()),
-      cumulative_histogram_(hist_alloc()),
+      unit_(unit), thread_local_store_(thread_local_store),
+      interval_histogram_(sketch_accuracy.has_value() ? nullptr : hist_alloc()),
+      cumulative_histogram_(sketch_accuracy.has_value() ? nullptr : hist_alloc()),
+      interval_sketch_(sketch_accuracy.has_value() ? std::make_unique<DDSketch>(*sketch_accuracy)
+                                                   : nullptr),
+      cumulative_sketch_(sketch_accuracy.has_value() ? std::make_unique<DDSketch>(*sketch_accuracy)
+                                                     : nullptr),
       interval_statistics_(interval_histogram_, unit, supported_buckets),
       cumulative_statistics_(cumulative_histogram_, unit, supported_buckets), id_(id) {}
 
@@ -841,8 +894,10 @@ ParentHistogramImpl::~ParentHistogramImpl() {
   thread_local_store_.releaseHistogramCrossThread(id_);
   ASSERT(ref_count_ == 0);
   MetricImpl::clear(thread_local_store_.symbolTable());
-  hist_free(interval_histogram_);
-  hist_free(cumulative_histogram_);
+  if (interval_histogram_ != nullptr) {
+    hist_free(interval_histogram_);
+    hist_free(cumulative_histogram_);
+  }
 }
 
 void ParentHistogramImpl::incRefCount() { ++ref_count_; }
@@ -898,9 +953,31 @@ Histogram::Unit ParentHistogramImpl::unit() const { return unit_; }
 void ParentHistogramImpl::recordValue(uint64_t value) {
   Histogram& tls_histogram = thread_local_store_.tlsHistogram(*this, id_);
   tls_histogram.recordValue(value);
+  dirty_.store(true, std::memory_order_release);
   thread_local_store_.deliverHistogramToSinks(*this, value);
 }
 
+bool ParentHistogramImpl::shouldMerge() {
+  const bool dirty = dirty_.exchange(false, std::memory_order_acq_rel);
+  const bool merge = dirty || drain_extra_cycle_;
+  drain_extra_cycle_ = dirty;
+  return merge;
+}
+
+void ParentHistogramImpl::clearIdleInterval() {
+  Thread::LockGuard lock(merge_lock_);
+  if (!interval_empty_) {
+    if (interval_sketch_ != nullptr) {
+      interval_sketch_->clear();
+      interval_statistics_.refresh(*interval_sketch_);
+    } else {
+      hist_clear(interval_histogram_);
+      interval_statistics_.refresh(interval_histogram_);
+    }
+    interval_empty_ = true;
+  }
+}
+
 bool ParentHistogramImpl::used() const {
   // Consider ParentHistogram used only if has ever been merged.
   return merged_;
@@ -911,6 +988,19 @@ bool ParentHistogramImpl::hidden() const { return false; }
 void ParentHistogramImpl::merge() {
   Thread::ReleasableLockGuard lock(merge_lock_);
   if (merged_ || usedLockHeld()) {
+    if (interval_sketch_ != nullptr) {
+      interval_sketch_->clear();
+      for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
+        tls_histogram->merge(*interval_sketch_);
+      }
+      interval_empty_ = false;
+      lock.release();
+      cumulative_sketch_->accumulate(*interval_sketch_);
+      cumulative_statistics_.refresh(*cumulative_sketch_);
+      interval_statistics_.refresh(*interval_sketch_);
+      merged_ = true;
+      return;
+    }
     hist_clear(interval_histogram_);
     // Here we could copy all the pointers to TLS histograms in the tls_histogram_ list,
     // then release the lock before we do the actual merge. However it is not a big deal
@@ -919,6 +1009,7 @@ void ParentHistogramImpl::merge() {
     for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
       tls_histogram->merge(interval_histogram_);
     }
+    interval_empty_ = false;
     // Since TLS merge is done, we can release the lock here.
     lock.release();
     hist_accumulate(cumulative_histogram_, &interval_histogram_, 1);
@@ -974,6 +1065,15 @@ ParentHistogramImpl::detailedlBucketsHelper(const histogram_t& histogram) {
   return buckets;
 }
 
+std::vector<Stats::ParentHistogram::Bucket>
+ParentHistogramImpl::detailedlBucketsHelper(const DDSketch& sketch) {
+  std::vector<Stats::ParentHistogram::Bucket> buckets;
+  for (const DDSketch::Bin& bin : sketch.bins()) {
+    buckets.push_back(Bucket{bin.lower_bound_, bin.width_, bin.count_});
+  }
+  return buckets;
+}
+
 void ParentHistogramImpl::addTlsHistogram(const TlsHistogramSharedPtr& hist_ptr) {
   Thread::LockGuard lock(merge_lock_);
   tls_histograms_.emplace_back(hist_ptr);
@@ -13,6 +13,7 @@
 #include "source/common/common/hash.h"
 #include "source/common/common/thread_synchronizer.h"
 #include "source/common/stats/allocator_impl.h"
+#include "source/common/stats/ddsketch.h"
 #include "source/common/stats/histogram_impl.h"
 #include "source/common/stats/null_counter.h"
 #include "source/common/stats/null_gauge.h"
@@ -34,10 +35,12 @@ namespace Stats {
 class ThreadLocalHistogramImpl : public HistogramImplHelper {
 public:
   ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit, StatName tag_extracted_name,
-                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table);
+                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table,
+                           absl::optional<double> sketch_accuracy);
   ~ThreadLocalHistogramImpl() override;
 
   void merge(histogram_t* target);
+  void merge(DDSketch& target);
 
   /**
    * Called in the beginning of merge process. Swaps the histogram used for collection so that we do
@@ -66,7 +69,10 @@ private:
   Histogram::Unit unit_;
   uint64_t otherHistogramIndex() const { return 1 - current_active_; }
   uint64_t current_active_{0};
-  histogram_t* histograms_[2];
+  // Exactly one backend is allocated, matching the parent histogram: either
+  // the circllhist pair or the sketch pair; the other stays null.
+  histogram_t* histograms_[2]{nullptr, nullptr};
+  std::unique_ptr<DDSketch> sketches_[2];
   std::atomic<bool> used_;
   std::thread::id created_thread_id_;
   SymbolTable& symbol_table_;
@@ -83,7 +89,8 @@ class ParentHistogramImpl : public MetricImpl<ParentHistogram> {
 public:
   ParentHistogramImpl(StatName name, Histogram::Unit unit, ThreadLocalStoreImpl& parent,
                       StatName tag_extracted_name, const StatNameTagVector& stat_name_tags,
-                      ConstSupportedBuckets& supported_buckets, uint64_t id);
+                      ConstSupportedBuckets& supported_buckets,
+                      absl::optional<double> sketch_accuracy, uint64_t id);
   ~ParentHistogramImpl() override;
 
   void addTlsHistogram(const TlsHistogramSharedPtr& hist_ptr);
@@ -100,6 +107,23 @@ public:
    */
   void merge() override;
 
+  /**
+   * Called on the main thread at the start of each merge cycle. @return whether this histogram
+   * needs to be merged this cycle, consuming the dirty flag set by recordValue. Histograms with
+   * no new values are skipped entirely, keeping flush cost proportional to the number of active
+   * histograms rather than the total number. A value recorded while a merge cycle is underway can
+   * land in the TLS write buffer that cycle does not drain, so a dirty histogram stays in the
+   * merge set for one extra cycle to pick up stragglers from the other buffer.
+   */
+  bool shouldMerge();
+
+  /**
+   * Clears the interval histogram of a histogram skipped by the incremental merge, so that an
+   * idle histogram reports an empty interval rather than repeating its last one. A no-op once the
+   * interval is already empty.
+   */
+  void clearIdleInterval();
+
   const HistogramStatistics& intervalStatistics() const override { return interval_statistics_; }
   const HistogramStatistics& cumulativeStatistics() const override {
     return cumulative_statistics_;
@@ -107,10 +131,22 @@ public:
   std::string quantileSummary() const override;
   std::string bucketSummary() const override;
   std::vector<Bucket> detailedTotalBuckets() const override {
-    return detailedlBucketsHelper(*cumulative_histogram_);
+    return cumulative_sketch_ != nullptr ? detailedlBucketsHelper(*cumulative_sketch_)
+                                         : detailedlBucketsHelper(*cumulative_histogram_);
   }
   std::vector<Bucket> detailedIntervalBuckets() const override {
-    return detailedlBucketsHelper(*interval_histogram_);
+    return interval_sketch_ != nullptr ? detailedlBucketsHelper(*interval_sketch_)
+                                       : detailedlBucketsHelper(*interval_histogram_);
+  }
+
+  /**
+   * @return the relative accuracy of the sketch backend for this histogram, or
+   * nullopt when using the default circllhist backend. TLS histograms are
+   * created with the same backend as their parent.
+   */
+  absl::optional<double> sketchAccuracy() const {
+    return interval_sketch_ != nullptr ? absl::optional<double>(interval_sketch_->relativeAccuracy())
+                                       : absl::nullopt;
   }
 
   // Stats::Metric
@@ -131,16 +167,27 @@ private:
   bool usedLockHeld() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(merge_lock_);
   static std::vector<Stats::ParentHistogram::Bucket>
   detailedlBucketsHelper(const histogram_t& histogram);
+  static std::vector<Stats::ParentHistogram::Bucket> detailedlBucketsHelper(const DDSketch& sketch);
 
   Histogram::Unit unit_;
   ThreadLocalStoreImpl& thread_local_store_;
-  histogram_t* interval_histogram_;
-  histogram_t* cumulative_histogram_;
+  // Exactly one backend is allocated, selected by the histogram settings for
+  // this stat name: either the circllhist pair or the sketch pair; the other
+  // stays null.
+  histogram_t* interval_histogram_{nullptr};
+  histogram_t* cumulative_histogram_{nullptr};
+  std::unique_ptr<DDSketch> interval_sketch_;
+  std::unique_ptr<DDSketch> cumulative_sketch_;
   HistogramStatisticsImpl interval_statistics_;
   HistogramStatisticsImpl cumulative_statistics_;
   mutable Thread::MutexBasicLockable merge_lock_;
   std::list<TlsHistogramSharedPtr> tls_histograms_ ABSL_GUARDED_BY(merge_lock_);
   bool merged_{false};
+  // Set by recordValue on any thread, consumed by shouldMerge on the main thread.
+  std::atomic<bool> dirty_{false};
+  // Main thread only; whether to merge one extra cycle after the last dirty observation.
+  bool drain_extra_cycle_{false};
+  bool interval_empty_ ABSL_GUARDED_BY(merge_lock_){true};
   std::atomic<bool> shutting_down_{false};
   std::atomic<uint32_t> ref_count_{0};
   const uint64_t id_; // Index into TlsCache::histogram_cache_.
@@ -488,7 +535,8 @@ private:
   void clearScopesFromCaches();
   void clearHistogramsFromCaches();
   void releaseScopeCrossThread(ScopeImpl* scope);
-  void mergeInternal(PostMergeCb merge_cb);
+  void mergeInternal(PostMergeCb merge_cb,
+                     const std::vector<ParentHistogramImplSharedPtr>& histograms_to_merge);
   bool slowRejects(StatsMatcher::FastResult fast_reject_result, StatName name) const;
   bool rejects(StatName name) const { return stats_matcher_->rejects(name); }
   StatsMatcher::FastResult fastRejects(StatName name) const;
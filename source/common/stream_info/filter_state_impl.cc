@@ -5,6 +5,14 @@
 namespace Envoy {
 namespace StreamInfo {
 
+InlineMapDescriptor<std::string>& FilterStateImpl::inlineMapDescriptor() {
+  MUTABLE_CONSTRUCT_ON_FIRST_USE(InlineMapDescriptor<std::string>);
+}
+
+FilterStateImpl::InlineKey FilterStateImpl::registerInlineKey(absl::string_view key) {
+  return {key, inlineMapDescriptor().addInlineKey(key)};
+}
+
 void FilterStateImpl::setData(absl::string_view data_name, std::shared_ptr<Object> data,
                               FilterState::StateType state_type, FilterState::LifeSpan life_span,
                               StreamSharingMayImpactPooling stream_sharing) {
@@ -23,12 +31,11 @@ void FilterStateImpl::setData(absl::string_view data_name, std::shared_ptr<Objec
                  "conflicting life_span on the same data_name.");
     return;
   }
-  const auto& it = data_storage_.find(data_name);
-  if (it != data_storage_.end()) {
+  if (const auto entry = data_storage_->get(data_name); entry.has_value()) {
     // We have another object with same data_name. Check for mutability
     // violations namely: readonly data cannot be overwritten, mutable data
     // cannot be overwritten by readonly data.
-    const FilterStateImpl::FilterObject* current = it->second.get();
+    const FilterStateImpl::FilterObject* current = entry->get();
     if (current->state_type_ == FilterState::StateType::ReadOnly) {
       IS_ENVOY_BUG("FilterStateAccessViolation: FilterState::setData<T> called twice on same "
                    "ReadOnly state.");
@@ -46,7 +53,7 @@ void FilterStateImpl::setData(absl::string_view data_name, std::shared_ptr<Objec
   filter_object->data_ = data;
   filter_object->state_type_ = state_type;
   filter_object->stream_sharing_ = stream_sharing;
-  data_storage_[data_name] = std::move(filter_object);
+  (*data_storage_)[std::string(data_name)] = std::move(filter_object);
 }
 
 bool FilterStateImpl::hasDataWithName(absl::string_view data_name) const {
@@ -55,17 +62,29 @@ bool FilterStateImpl::hasDataWithName(absl::string_view data_name) const {
 
 const FilterState::Object*
 FilterStateImpl::getDataReadOnlyGeneric(absl::string_view data_name) const {
-  const auto it = data_storage_.find(data_name);
+  const auto entry = data_storage_->get(data_name);
 
-  if (it == data_storage_.end()) {
+  if (!entry.has_value()) {
     if (parent_) {
       return parent_->getDataReadOnlyGeneric(data_name);
     }
     return nullptr;
   }
 
-  const FilterStateImpl::FilterObject* current = it->second.get();
-  return current->data_.get();
+  return entry->get()->data_.get();
+}
+
+const FilterState::Object* FilterStateImpl::getDataReadOnlyGeneric(InlineKey key) const {
+  const auto entry = data_storage_->get(key.handle_);
+
+  if (!entry.has_value()) {
+    if (parent_) {
+      return parent_->getDataReadOnlyGeneric(key.name_);
+    }
+    return nullptr;
+  }
+
+  return entry->get()->data_.get();
 }
 
 FilterState::Object* FilterStateImpl::getDataMutableGeneric(absl::string_view data_name) {
@@ -74,16 +93,36 @@ FilterState::Object* FilterStateImpl::getDataMutableGeneric(absl::string_view da
 
 std::shared_ptr<FilterState::Object>
 FilterStateImpl::getDataSharedMutableGeneric(absl::string_view data_name) {
-  const auto& it = data_storage_.find(data_name);
+  const auto entry = data_storage_->get(data_name);
 
-  if (it == data_storage_.end()) {
+  if (!entry.has_value()) {
     if (parent_) {
       return parent_->getDataSharedMutableGeneric(data_name);
     }
     return nullptr;
   }
 
-  FilterStateImpl::FilterObject* current = it->second.get();
+  FilterStateImpl::FilterObject* current = entry->get();
+  if (current->state_type_ == FilterState::StateType::ReadOnly) {
+    IS_ENVOY_BUG("FilterStateAccessViolation: FilterState accessed immutable data as mutable.");
+    // To reduce the chances of a crash, allow the mutation in this case instead of returning a
+    // nullptr.
+  }
+
+  return current->data_;
+}
+
+std::shared_ptr<FilterState::Object> FilterStateImpl::getDataSharedMutableGeneric(InlineKey key) {
+  const auto entry = data_storage_->get(key.handle_);
+
+  if (!entry.has_value()) {
+    if (parent_) {
+      return parent_->getDataSharedMutableGeneric(key.name_);
+    }
+    return nullptr;
+  }
+
+  FilterStateImpl::FilterObject* current = entry->get();
   if (current->state_type_ == FilterState::StateType::ReadOnly) {
     IS_ENVOY_BUG("FilterStateAccessViolation: FilterState accessed immutable data as mutable.");
     // To reduce the chances of a crash, allow the mutation in this case instead of returning a
@@ -97,30 +136,32 @@ bool FilterStateImpl::hasDataAtOrAboveLifeSpan(FilterState::LifeSpan life_span)
   if (life_span > life_span_) {
     return parent_ && parent_->hasDataAtOrAboveLifeSpan(life_span);
   }
-  return !data_storage_.empty() || (parent_ && parent_->hasDataAtOrAboveLifeSpan(life_span));
+  return !data_storage_->empty() || (parent_ && parent_->hasDataAtOrAboveLifeSpan(life_span));
 }
 
 FilterState::ObjectsPtr FilterStateImpl::objectsSharedWithUpstreamConnection() const {
   auto objects = parent_ ? parent_->objectsSharedWithUpstreamConnection()
                          : std::make_unique<FilterState::Objects>();
-  for (const auto& [name, object] : data_storage_) {
-    switch (object->stream_sharing_) {
-    case StreamSharingMayImpactPooling::SharedWithUpstreamConnection:
-      objects->push_back({object->data_, object->state_type_, object->stream_sharing_, name});
-      break;
-    case StreamSharingMayImpactPooling::SharedWithUpstreamConnectionOnce:
-      objects->push_back(
-          {object->data_, object->state_type_, StreamSharingMayImpactPooling::None, name});
-      break;
-    default:
-      break;
-    }
-  }
+  data_storage_->iterate(
+      [&objects](const std::string& name, const std::unique_ptr<FilterObject>& object) -> bool {
+        switch (object->stream_sharing_) {
+        case StreamSharingMayImpactPooling::SharedWithUpstreamConnection:
+          objects->push_back({object->data_, object->state_type_, object->stream_sharing_, name});
+          break;
+        case StreamSharingMayImpactPooling::SharedWithUpstreamConnectionOnce:
+          objects->push_back(
+              {object->data_, object->state_type_, StreamSharingMayImpactPooling::None, name});
+          break;
+        default:
+          break;
+        }
+        return true;
+      });
   return objects;
 }
 
 bool FilterStateImpl::hasDataWithNameInternally(absl::string_view data_name) const {
-  return data_storage_.contains(data_name);
+  return data_storage_->get(data_name).has_value();
 }
 
 void FilterStateImpl::maybeCreateParent(ParentAccessMode parent_access_mode) {
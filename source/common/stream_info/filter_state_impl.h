@@ -6,7 +6,8 @@
 
 #include "envoy/stream_info/filter_state.h"
 
-#include "absl/container/flat_hash_map.h"
+#include "source/common/common/inline_map.h"
+
 #include "absl/strings/string_view.h"
 
 namespace Envoy {
@@ -14,6 +15,26 @@ namespace StreamInfo {
 
 class FilterStateImpl : public FilterState {
 public:
+  /**
+   * A handle for a filter state key registered at static initialization time. Local lookups with
+   * a handle index the flat inline array directly instead of hashing the key.
+   */
+  struct InlineKey {
+    // The registered key. Used when a lookup has to be delegated to an ancestor through the
+    // string based FilterState interface.
+    absl::string_view name_;
+    InlineMapDescriptor<std::string>::Handle handle_;
+  };
+
+  /**
+   * Registers a well-known filter state key. Objects stored under a registered key live in a flat
+   * array shared by all FilterStateImpl instances instead of the hash map that backs dynamic
+   * keys. This must be called before any FilterStateImpl is created, typically from a static
+   * initializer, and the given key must have static storage duration. Registering the same key
+   * more than once returns the same handle.
+   */
+  static InlineKey registerInlineKey(absl::string_view key);
+
   FilterStateImpl(FilterState::LifeSpan life_span) : life_span_(life_span) {
     maybeCreateParent(ParentAccessMode::ReadOnly);
   }
@@ -54,16 +75,41 @@ public:
   FilterState::LifeSpan lifeSpan() const override { return life_span_; }
   FilterStateSharedPtr parent() const override { return parent_; }
 
+  // O(1) overloads of the lookups above for keys registered with registerInlineKey(). The local
+  // lookup is a direct array index without hashing; only lookups that have to be delegated to an
+  // ancestor fall back to the string based interface.
+  const Object* getDataReadOnlyGeneric(InlineKey key) const;
+  std::shared_ptr<Object> getDataSharedMutableGeneric(InlineKey key);
+  template <typename T> const T* getDataReadOnly(InlineKey key) const {
+    return dynamic_cast<const T*>(getDataReadOnlyGeneric(key));
+  }
+  template <typename T> T* getDataMutable(InlineKey key) {
+    return dynamic_cast<T*>(getDataSharedMutableGeneric(key).get());
+  }
+
+  // Keep the string based templated accessors visible next to the InlineKey overloads.
+  using FilterState::getDataMutable;
+  using FilterState::getDataReadOnly;
+
 private:
   // This only checks the local data_storage_ for data_name existence.
   bool hasDataWithNameInternally(absl::string_view data_name) const;
   enum class ParentAccessMode { ReadOnly, ReadWrite };
   void maybeCreateParent(ParentAccessMode parent_access_mode);
 
+  using DataStorage = InlineMap<std::string, std::unique_ptr<FilterObject>>;
+
+  // The process wide descriptor holding all keys registered by registerInlineKey(). It is
+  // finalized when the first FilterStateImpl is created.
+  static InlineMapDescriptor<std::string>& inlineMapDescriptor();
+
   absl::variant<FilterStateSharedPtr, LazyCreateAncestor> ancestor_;
   FilterStateSharedPtr parent_;
   const FilterState::LifeSpan life_span_;
-  absl::flat_hash_map<std::string, std::unique_ptr<FilterObject>> data_storage_;
+  // Objects with registered keys live in the flat inline array of the map, everything else in
+  // the dynamic hash map.
+  InlineMapPtr<std::string, std::unique_ptr<FilterObject>> data_storage_ =
+      DataStorage::create(inlineMapDescriptor());
 };
 
 } // namespace StreamInfo
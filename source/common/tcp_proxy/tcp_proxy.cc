@@ -678,6 +678,12 @@ void Filter::onConnectTimeout() {
   upstream_callbacks_->onEvent(Network::ConnectionEvent::LocalClose);
 }
 
+// Proxied bytes are never copied in user space: the read path fills buffer slices directly from
+// the socket and encodeData() moves those slices onto the upstream connection's write buffer by
+// pointer. The remaining per-byte cost is the kernel<->user crossing; eliminating it with
+// splice(2) would require a kernel-side data path in the core connection machinery itself, since
+// filters cannot reach the io handles and the transport socket, watermark and byte-metering
+// abstractions all assume data passes through buffers.
 Network::FilterStatus Filter::onData(Buffer::Instance& data, bool end_stream) {
   ENVOY_CONN_LOG(trace, "downstream connection received {} bytes, end_stream={}",
                  read_callbacks_->connection(), data.length(), end_stream);
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include "envoy/upstream/scheduler.h"
+
+#include "source/common/common/assert.h"
+#include "source/common/common/logger.h"
+
+#include "absl/container/flat_hash_map.h"
+
+namespace Envoy {
+namespace Upstream {
+
+// Bucketed Stride Scheduler
+// -------------------------
+// This scheduler groups objects that share a weight into a bucket backed by a contiguous array and
+// round-robins within each bucket. Across buckets it performs stride scheduling: each bucket keeps
+// a "pass" value which is advanced by 1 / (weight * bucket size) on every pick, and the bucket with
+// the smallest pass is picked next. Picking is therefore O(b), where b is the number of unique
+// weights -- effectively O(1) in the number of objects, with no heap to rebalance and no
+// per-pick reinsertion. Memory use is O(n) with a single pointer per object.
+//
+// Weights are quantized to kWeightScale steps so that objects with nearly identical weights share a
+// bucket; this bounds b and introduces a relative selection-probability error of at most
+// 0.5 / kWeightScale for weights >= 1. Within a bucket the quantization error is zero since
+// bucket members are picked in strict rotation.
+//
+// For the case where all object weights are the same, this scheduler behaves identical to vanilla
+// round-robin. Like EdfScheduler, consecutive picks with stable weights produce a deterministic,
+// maximally interleaved sequence.
+//
+// NOTE: While the base scheduler interface allows for mutation of object weights with each pick,
+// a weight change moves the object between buckets and resets its position in the rotation. This
+// implementation will perform poorly if the object weights change with each pick (like in the
+// least request LB).
+template <class C>
+class BucketedScheduler : public Scheduler<C>, protected Logger::Loggable<Logger::Id::upstream> {
+public:
+  // See scheduler.h for an explanation of each public method.
+  std::shared_ptr<C> peekAgain(std::function<double(const C&)> calculate_weight) override {
+    std::shared_ptr<C> picked{pickInternal(calculate_weight)};
+    if (picked != nullptr) {
+      prepick_queue_.emplace(picked);
+    }
+    return picked;
+  }
+
+  std::shared_ptr<C> pickAndAdd(std::function<double(const C&)> calculate_weight) override {
+    // Burn through the pre-pick queue.
+    while (!prepick_queue_.empty()) {
+      std::shared_ptr<C> prepicked_obj = prepick_queue_.front().lock();
+      prepick_queue_.pop();
+      if (prepicked_obj != nullptr) {
+        return prepicked_obj;
+      }
+    }
+
+    return pickInternal(calculate_weight);
+  }
+
+  void add(double weight, std::shared_ptr<C> entry) override {
+    ASSERT(weight > 0);
+    bucketFor(quantizeWeight(weight)).objs.emplace_back(std::move(entry));
+  }
+
+  bool empty() const override { return buckets_.empty(); }
+
+private:
+  // The weight quantization resolution. Larger values reduce the selection-probability error at
+  // the cost of more buckets when weights are fractional (e.g. during slow start).
+  static constexpr double kWeightScale = 100.0;
+
+  struct Bucket {
+    // The common (quantized) weight of every object in this bucket.
+    uint64_t quantized_weight;
+    // Stride scheduling pass value; the bucket with the smallest pass is picked next.
+    double pass;
+    // Objects of this weight, stored contiguously. Only weak pointers are held, since there is no
+    // remove operation. This allows entries to be lazily unloaded as they are encountered.
+    std::vector<std::weak_ptr<C>> objs;
+    // Round-robin position within objs.
+    size_t cursor{0};
+  };
+
+  static uint64_t quantizeWeight(double weight) {
+    return std::max<int64_t>(1, std::llround(weight * kWeightScale));
+  }
+
+  Bucket& bucketFor(uint64_t quantized_weight) {
+    auto it = bucket_index_.find(quantized_weight);
+    if (it != bucket_index_.end()) {
+      return buckets_[it->second];
+    }
+    bucket_index_[quantized_weight] = buckets_.size();
+    // A new bucket joins at the pass of the most recent pick so that it neither monopolizes the
+    // schedule (pass too small) nor starves (pass too large).
+    buckets_.push_back(Bucket{quantized_weight, current_pass_, {}, 0});
+    return buckets_.back();
+  }
+
+  // Swap-removes the bucket at the given index, keeping the index map consistent.
+  void removeBucket(size_t index) {
+    bucket_index_.erase(buckets_[index].quantized_weight);
+    if (index != buckets_.size() - 1) {
+      buckets_[index] = std::move(buckets_.back());
+      bucket_index_[buckets_[index].quantized_weight] = index;
+    }
+    buckets_.pop_back();
+  }
+
+  // Round-robins within the bucket, swap-removing expired entries as they are encountered.
+  // Returns nullptr if the bucket was drained to empty.
+  std::shared_ptr<C> pickFromBucket(Bucket& bucket) {
+    while (!bucket.objs.empty()) {
+      if (bucket.cursor >= bucket.objs.size()) {
+        bucket.cursor = 0;
+      }
+      std::shared_ptr<C> obj = bucket.objs[bucket.cursor].lock();
+      if (obj == nullptr) {
+        bucket.objs[bucket.cursor] = std::move(bucket.objs.back());
+        bucket.objs.pop_back();
+        continue;
+      }
+      ++bucket.cursor;
+      return obj;
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<C> pickInternal(std::function<double(const C&)> calculate_weight) {
+    while (!buckets_.empty()) {
+      // Linear scan for the minimum pass. The number of buckets is the number of unique weights,
+      // which is a small constant in practice, and the scan is over a contiguous array.
+      size_t best = 0;
+      for (size_t i = 1; i < buckets_.size(); ++i) {
+        if (buckets_[i].pass < buckets_[best].pass) {
+          best = i;
+        }
+      }
+
+      Bucket& bucket = buckets_[best];
+      std::shared_ptr<C> obj = pickFromBucket(bucket);
+      if (obj == nullptr) {
+        // The chosen bucket contained only expired entries. Drop it and try again.
+        removeBucket(best);
+        continue;
+      }
+
+      current_pass_ = bucket.pass;
+      bucket.pass +=
+          1.0 / (static_cast<double>(bucket.quantized_weight) * bucket.objs.size() / kWeightScale);
+
+      if (calculate_weight) {
+        const uint64_t new_quantized_weight = quantizeWeight(calculate_weight(*obj));
+        if (new_quantized_weight != bucket.quantized_weight) {
+          ENVOY_LOG_EVERY_POW_2(
+              warn,
+              "bucketed scheduler is used with a load balancer that mutates host weights with "
+              "each selection, this will likely result in poor selection performance");
+          // Move the object to the bucket matching its new weight. pickFromBucket() left the
+          // cursor one past the picked entry.
+          const size_t picked_index = bucket.cursor - 1;
+          bucket.objs[picked_index] = std::move(bucket.objs.back());
+          bucket.objs.pop_back();
+          bucket.cursor = picked_index;
+          if (bucket.objs.empty()) {
+            removeBucket(best);
+          }
+          // NOTE: this may grow buckets_ and invalidate the bucket reference, which is not
+          // touched again below.
+          bucketFor(new_quantized_weight).objs.emplace_back(obj);
+        }
+      }
+
+      return obj;
+    }
+
+    return nullptr;
+  }
+
+  // Objects already picked via peekAgain().
+  std::queue<std::weak_ptr<C>> prepick_queue_;
+
+  // Contiguous bucket storage plus an index from quantized weight to bucket position.
+  std::vector<Bucket> buckets_;
+  absl::flat_hash_map<uint64_t, size_t> bucket_index_;
+
+  // The pass value of the most recent pick, used to seed newly created buckets.
+  double current_pass_{0};
+};
+
+} // namespace Upstream
+} // namespace Envoy
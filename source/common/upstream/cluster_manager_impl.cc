@@ -317,7 +317,8 @@ ClusterManagerImpl::ClusterManagerImpl(
         });
   }
   async_client_manager_ = std::make_unique<Grpc::AsyncClientManagerImpl>(
-      *this, tls, time_source_, api, grpc_context.statNames());
+      *this, tls, time_source_, api, grpc_context.statNames(),
+      PROTOBUF_GET_WRAPPED_OR_DEFAULT(bootstrap, google_grpc_completion_queue_count, 1));
   const auto& cm_config = bootstrap.cluster_manager();
   if (cm_config.has_outlier_detection()) {
     const std::string event_log_file_path = cm_config.outlier_detection().event_log_path();
@@ -1179,7 +1180,13 @@ void ClusterManagerImpl::postThreadLocalClusterUpdate(ClusterManagerCluster& cm_
       addOrUpdateClusterInitializationObjectIfSupported(params, cm_cluster.cluster().info(),
                                                         load_balancer_factory, host_map);
 
-  tls_.runOnAllThreads([info = cm_cluster.cluster().info(), params = std::move(params),
+  // The update parameters are immutable once posted, so share a single copy across all workers
+  // rather than copying the host vectors into every worker's callback. During large CDS/EDS
+  // bursts this makes the per-worker fan-out cost a reference count bump instead of a deep copy.
+  auto shared_params =
+      std::make_shared<const ThreadLocalClusterUpdateParams>(std::move(params));
+
+  tls_.runOnAllThreads([info = cm_cluster.cluster().info(), params = std::move(shared_params),
                         add_or_update_cluster, load_balancer_factory, map = std::move(host_map),
                         cluster_initialization_object = std::move(cluster_initialization_object)](
                            OptRef<ThreadLocalClusterManagerImpl> cluster_manager) {
@@ -1238,7 +1245,7 @@ void ClusterManagerImpl::postThreadLocalClusterUpdate(ClusterManagerCluster& cm_
             cluster_manager->thread_local_clusters_.size());
       }
 
-      for (const auto& per_priority : params.per_priority_update_params_) {
+      for (const auto& per_priority : params->per_priority_update_params_) {
         cluster_manager->updateClusterMembership(
             info->name(), per_priority.priority_, per_priority.update_hosts_params_,
             per_priority.locality_weights_, per_priority.hosts_added_, per_priority.hosts_removed_,
@@ -1508,6 +1515,11 @@ void ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::drainConnP
   }
 }
 
+void ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::drainConnPools(
+    ConnectionPool::DrainBehavior behavior) {
+  drainConnPools(nullptr, behavior);
+}
+
 ClusterUpdateCallbacksHandlePtr
 ClusterManagerImpl::addThreadLocalClusterUpdateCallbacks(ClusterUpdateCallbacks& cb) {
   ThreadLocalClusterManagerImpl& cluster_manager = *tls_;
@@ -572,6 +572,7 @@ private:
       Tcp::AsyncTcpClientPtr
       tcpAsyncClient(LoadBalancerContext* context,
                      Tcp::AsyncTcpClientOptionsConstSharedPtr options) override;
+      void drainConnPools(ConnectionPool::DrainBehavior behavior) override;
 
       // Updates the hosts in the priority set.
       void updateHosts(const std::string& name, uint32_t priority,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <list>
 #include <vector>
 
 #include "envoy/common/conn_pool.h"
@@ -70,8 +71,16 @@ public:
   void drainConnections(Envoy::ConnectionPool::DrainBehavior drain_behavior);
 
 private:
+  struct PoolEntry {
+    std::unique_ptr<POOL_TYPE> pool_;
+    // Position of this pool's key in `lru_keys_`, kept so that recency updates
+    // and evictions are O(1).
+    typename std::list<KEY_TYPE>::iterator lru_position_;
+  };
+
   /**
-   * Frees the first idle pool in `active_pools_`.
+   * Frees the least recently used pool in `active_pools_` that has no active
+   * connections.
    * @return false if no pool was freed.
    */
   bool freeOnePool();
@@ -81,7 +90,10 @@ private:
    **/
   void clearActivePools();
 
-  absl::flat_hash_map<KEY_TYPE, std::unique_ptr<POOL_TYPE>> active_pools_;
+  absl::flat_hash_map<KEY_TYPE, PoolEntry> active_pools_;
+  // Pool keys ordered from most to least recently used. A pool is "used" when
+  // it is returned from getPool().
+  std::list<KEY_TYPE> lru_keys_;
   Event::Dispatcher& thread_local_dispatcher_;
   std::vector<IdleCb> cached_callbacks_;
   const HostConstSharedPtr host_;
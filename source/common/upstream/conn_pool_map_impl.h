@@ -28,7 +28,10 @@ ConnPoolMap<KEY_TYPE, POOL_TYPE>::getPool(const KEY_TYPE& key, const PoolFactory
   // here. Maybe we'll pass them to the factory function?
   auto pool_iter = active_pools_.find(key);
   if (pool_iter != active_pools_.end()) {
-    return std::ref(*(pool_iter->second));
+    // Refresh recency so that freeOnePool() evicts the pool that has gone
+    // longest without a lookup.
+    lru_keys_.splice(lru_keys_.begin(), lru_keys_, pool_iter->second.lru_position_);
+    return std::ref(*(pool_iter->second.pool_));
   }
   ResourceLimit& connPoolResource = host_->cluster().resourceManager(priority_).connectionPools();
   // We need a new pool. Check if we have room.
@@ -56,8 +59,9 @@ ConnPoolMap<KEY_TYPE, POOL_TYPE>::getPool(const KEY_TYPE& key, const PoolFactory
     new_pool->addIdleCallback(cb);
   }
 
-  auto inserted = active_pools_.emplace(key, std::move(new_pool));
-  return std::ref(*inserted.first->second);
+  lru_keys_.push_front(key);
+  auto inserted = active_pools_.emplace(key, PoolEntry{std::move(new_pool), lru_keys_.begin()});
+  return std::ref(*inserted.first->second.pool_);
 }
 
 template <typename KEY_TYPE, typename POOL_TYPE>
@@ -66,7 +70,8 @@ bool ConnPoolMap<KEY_TYPE, POOL_TYPE>::erasePool(const KEY_TYPE& key) {
   auto pool_iter = active_pools_.find(key);
 
   if (pool_iter != active_pools_.end()) {
-    thread_local_dispatcher_.deferredDelete(std::move(pool_iter->second));
+    thread_local_dispatcher_.deferredDelete(std::move(pool_iter->second.pool_));
+    lru_keys_.erase(pool_iter->second.lru_position_);
     active_pools_.erase(pool_iter);
     host_->cluster().resourceManager(priority_).connectionPools().dec();
     return true;
@@ -88,7 +93,7 @@ bool ConnPoolMap<KEY_TYPE, POOL_TYPE>::empty() const {
 template <typename KEY_TYPE, typename POOL_TYPE> void ConnPoolMap<KEY_TYPE, POOL_TYPE>::clear() {
   Common::AutoDebugRecursionChecker assert_not_in(recursion_checker_);
   for (auto& pool_pair : active_pools_) {
-    thread_local_dispatcher_.deferredDelete(std::move(pool_pair.second));
+    thread_local_dispatcher_.deferredDelete(std::move(pool_pair.second.pool_));
   }
   clearActivePools();
 }
@@ -97,7 +102,7 @@ template <typename KEY_TYPE, typename POOL_TYPE>
 void ConnPoolMap<KEY_TYPE, POOL_TYPE>::addIdleCallback(const IdleCb& cb) {
   Common::AutoDebugRecursionChecker assert_not_in(recursion_checker_);
   for (auto& pool_pair : active_pools_) {
-    pool_pair.second->addIdleCallback(cb);
+    pool_pair.second.pool_->addIdleCallback(cb);
   }
 
   cached_callbacks_.emplace_back(std::move(cb));
@@ -111,7 +116,7 @@ void ConnPoolMap<KEY_TYPE, POOL_TYPE>::drainConnections(
   std::vector<POOL_TYPE*> pools;
   pools.reserve(active_pools_.size());
   for (auto& pool_pair : active_pools_) {
-    pools.push_back(pool_pair.second.get());
+    pools.push_back(pool_pair.second.pool_.get());
   }
 
   for (auto* pool : pools) {
@@ -121,20 +126,20 @@ void ConnPoolMap<KEY_TYPE, POOL_TYPE>::drainConnections(
 
 template <typename KEY_TYPE, typename POOL_TYPE>
 bool ConnPoolMap<KEY_TYPE, POOL_TYPE>::freeOnePool() {
-  // Try to find a pool that isn't doing anything.
-  auto pool_iter = active_pools_.begin();
-  while (pool_iter != active_pools_.end()) {
-    if (!pool_iter->second->hasActiveConnections()) {
-      break;
+  // Walk from the least recently used pool towards the most recently used one,
+  // evicting the first pool that isn't doing anything. In the common case the
+  // tail of the list is idle, making eviction O(1); busy pools are only
+  // scanned past when the oldest pools still have active connections.
+  for (auto key_iter = lru_keys_.rbegin(); key_iter != lru_keys_.rend(); ++key_iter) {
+    auto pool_iter = active_pools_.find(*key_iter);
+    ASSERT(pool_iter != active_pools_.end());
+    if (!pool_iter->second.pool_->hasActiveConnections()) {
+      // We found one. Free it up, and let the caller know.
+      lru_keys_.erase(pool_iter->second.lru_position_);
+      active_pools_.erase(pool_iter);
+      host_->cluster().resourceManager(priority_).connectionPools().dec();
+      return true;
     }
-    ++pool_iter;
-  }
-
-  if (pool_iter != active_pools_.end()) {
-    // We found one. Free it up, and let the caller know.
-    active_pools_.erase(pool_iter);
-    host_->cluster().resourceManager(priority_).connectionPools().dec();
-    return true;
   }
 
   return false;
@@ -144,6 +149,7 @@ template <typename KEY_TYPE, typename POOL_TYPE>
 void ConnPoolMap<KEY_TYPE, POOL_TYPE>::clearActivePools() {
   host_->cluster().resourceManager(priority_).connectionPools().decBy(active_pools_.size());
   active_pools_.clear();
+  lru_keys_.clear();
 }
 } // namespace Upstream
 } // namespace Envoy
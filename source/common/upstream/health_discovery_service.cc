@@ -12,6 +12,7 @@
 #include "source/common/protobuf/message_validator_impl.h"
 #include "source/common/protobuf/protobuf.h"
 #include "source/common/protobuf/utility.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/upstream/upstream_impl.h"
 
 namespace Envoy {
@@ -37,7 +38,9 @@ HdsDelegate::HdsDelegate(Server::Configuration::ServerFactoryContext& server_con
       async_client_(std::move(async_client)), dispatcher_(server_context.mainThreadDispatcher()),
       server_context_(server_context), store_stats_(stats),
       ssl_context_manager_(ssl_context_manager), info_factory_(info_factory),
-      tls_(server_context_.threadLocal()) {
+      tls_(server_context_.threadLocal()),
+      suppress_unchanged_responses_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.hds_suppress_unchanged_responses")) {
   health_check_request_.mutable_health_check_request()->mutable_node()->MergeFrom(
       server_context.localInfo().node());
   backoff_strategy_ = std::make_unique<JitteredExponentialBackOffStrategy>(
@@ -89,7 +92,11 @@ void HdsDelegate::handleFailure() {
 }
 
 envoy::service::health::v3::HealthCheckRequestOrEndpointHealthResponse HdsDelegate::sendResponse() {
-  envoy::service::health::v3::HealthCheckRequestOrEndpointHealthResponse response;
+  // Rebuild into the same response proto every interval; Clear() retains the repeated field
+  // memory from the previous build.
+  envoy::service::health::v3::HealthCheckRequestOrEndpointHealthResponse& response =
+      endpoint_health_response_;
+  response.Clear();
 
   for (const auto& cluster : hds_clusters_) {
     // Add cluster health response and set name.
@@ -131,6 +138,22 @@ envoy::service::health::v3::HealthCheckRequestOrEndpointHealthResponse HdsDelega
       }
     }
   }
+  // If nothing changed since the last response the server received, skip this reporting interval
+  // instead of re-sending the same health state. A full snapshot is still sent periodically so
+  // the server can resync.
+  if (suppress_unchanged_responses_) {
+    const uint64_t response_hash = MessageUtil::hash(response);
+    if (response_hash == endpoint_health_response_hash_ &&
+        ++suppressed_response_count_ < SuppressedResponseSnapshotCount) {
+      ENVOY_LOG(debug, "Endpoint health unchanged since last EndpointHealthResponse, not sending");
+      stats_.responses_suppressed_.inc();
+      setHdsStreamResponseTimer();
+      return response;
+    }
+    endpoint_health_response_hash_ = response_hash;
+    suppressed_response_count_ = 0;
+  }
+
   ENVOY_LOG(debug, "Sending EndpointHealthResponse to server {}", response.DebugString());
   stream_->sendMessage(response, false);
   stats_.responses_.inc();
@@ -337,6 +360,9 @@ void HdsDelegate::onRemoteClose(Grpc::Status::GrpcStatus status, const std::stri
   stream_ = nullptr;
   server_response_ms_ = 0;
   specifier_hash_ = 0;
+  // A new stream starts from scratch, so the first response on it must be a full snapshot.
+  endpoint_health_response_hash_ = 0;
+  suppressed_response_count_ = 0;
   handleFailure();
 }
 
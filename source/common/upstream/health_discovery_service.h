@@ -114,6 +114,7 @@ using HdsClusterPtr = std::shared_ptr<HdsCluster>;
 #define ALL_HDS_STATS(COUNTER)                                                                     \
   COUNTER(requests)                                                                                \
   COUNTER(responses)                                                                               \
+  COUNTER(responses_suppressed)                                                                    \
   COUNTER(errors)                                                                                  \
   COUNTER(updates)
 
@@ -182,7 +183,15 @@ private:
   ThreadLocal::SlotAllocator& tls_;
 
   envoy::service::health::v3::HealthCheckRequestOrEndpointHealthResponse health_check_request_;
+  // Response proto reused across reporting intervals so that repeated field memory is retained
+  // instead of reallocated on every tick.
+  envoy::service::health::v3::HealthCheckRequestOrEndpointHealthResponse endpoint_health_response_;
   uint64_t specifier_hash_{0};
+  // Hash of the last response actually sent to the server and the number of responses suppressed
+  // since then. Only used when unchanged responses are suppressed.
+  uint64_t endpoint_health_response_hash_{0};
+  uint32_t suppressed_response_count_{0};
+  const bool suppress_unchanged_responses_;
 
   std::vector<std::string> clusters_;
   std::vector<HdsClusterPtr> hds_clusters_;
@@ -200,6 +209,10 @@ private:
   // The timeout for new network connections to hosts in the cluster.
   static constexpr uint32_t ClusterTimeoutSeconds = 1;
 
+  // When unchanged responses are suppressed, a full snapshot is still sent after this many
+  // consecutive suppressed reporting intervals so the management server can resync.
+  static constexpr uint32_t SuppressedResponseSnapshotCount = 10;
+
   // How often envoy reports the healthcheck results to the server
   uint32_t server_response_ms_ = 0;
 };
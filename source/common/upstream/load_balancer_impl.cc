@@ -1298,6 +1298,7 @@ HostConstSharedPtr LeastRequestLoadBalancer::unweightedHostPeek(const HostVector
 HostConstSharedPtr LeastRequestLoadBalancer::unweightedHostPick(const HostVector& hosts_to_use,
                                                                 const HostsSource&) {
   HostSharedPtr candidate_host = nullptr;
+  uint64_t candidate_active_rq = 0;
 
   for (uint32_t choice_idx = 0; choice_idx < choice_count_; ++choice_idx) {
     const int rand_idx = random_.random() % hosts_to_use.size();
@@ -1307,13 +1308,17 @@ HostConstSharedPtr LeastRequestLoadBalancer::unweightedHostPick(const HostVector
 
       // Make a first choice to start the comparisons.
       candidate_host = sampled_host;
+      candidate_active_rq = candidate_host->stats().rq_active_.value();
       continue;
     }
 
-    const auto candidate_active_rq = candidate_host->stats().rq_active_.value();
+    // The candidate's active request count is carried across iterations rather than re-read: the
+    // comparison should be against the value the candidate was selected with, and re-reading the
+    // gauge costs an extra atomic load per choice.
     const auto sampled_active_rq = sampled_host->stats().rq_active_.value();
     if (sampled_active_rq < candidate_active_rq) {
       candidate_host = sampled_host;
+      candidate_active_rq = sampled_active_rq;
     }
   }
 
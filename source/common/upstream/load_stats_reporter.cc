@@ -4,6 +4,7 @@
 #include "envoy/stats/scope.h"
 
 #include "source/common/protobuf/protobuf.h"
+#include "source/common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Upstream {
@@ -58,6 +59,11 @@ void LoadStatsReporter::sendLoadStatsRequest() {
   // added to the cluster manager. When we get the notification, we record the current time in
   // clusters_ as the start time for the load reporting window for that cluster.
   request_.mutable_cluster_stats()->Clear();
+  // Clearing a repeated field retains the allocated messages for reuse, so reserving up front
+  // means steady-state reports do not allocate per-cluster entries at all.
+  request_.mutable_cluster_stats()->Reserve(clusters_.size());
+  const bool omit_empty_clusters =
+      Runtime::runtimeFeatureEnabled("envoy.reloadable_features.omit_empty_lrs_cluster_stats");
   auto all_clusters = cm_.clusters();
   for (const auto& cluster_name_and_timestamp : clusters_) {
     const std::string& cluster_name = cluster_name_and_timestamp.first;
@@ -123,6 +129,15 @@ void LoadStatsReporter::sendLoadStatsRequest() {
     }
     cluster_stats->set_total_dropped_requests(
         cluster.info()->loadReportStats().upstream_rq_dropped_.latch());
+    if (omit_empty_clusters && cluster_stats->upstream_locality_stats().empty() &&
+        cluster_stats->total_dropped_requests() == 0) {
+      // Nothing happened for this cluster since the last report; drop the entry rather than
+      // serializing an empty delta. The tracking timestamp is deliberately left alone so that the
+      // next non-empty report covers the whole window since the cluster was last included. All
+      // latches above returned zero, so no data is lost.
+      request_.mutable_cluster_stats()->RemoveLast();
+      continue;
+    }
     const auto now = time_source_.monotonicTime().time_since_epoch();
     const auto measured_interval = now - cluster_name_and_timestamp.second;
     cluster_stats->mutable_load_report_interval()->MergeFrom(
@@ -708,13 +708,15 @@ void DetectorImpl::processSuccessRateEjections(
     getSRNums(monitor_type) = successRateEjectionThreshold(
         success_rate_sum, valid_success_rate_hosts, success_rate_stdev_factor);
     const double success_rate_ejection_threshold = getSRNums(monitor_type).ejection_threshold_;
+    // The ejection type of a success rate monitor is determined by its origin, so it can be
+    // derived directly from the monitor type without a per-host monitor lookup.
+    const envoy::data::cluster::v3::OutlierEjectionType type =
+        (monitor_type == DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin)
+            ? envoy::data::cluster::v3::SUCCESS_RATE
+            : envoy::data::cluster::v3::SUCCESS_RATE_LOCAL_ORIGIN;
     for (const auto& host_success_rate_pair : valid_success_rate_hosts) {
       if (host_success_rate_pair.success_rate_ < success_rate_ejection_threshold) {
         stats_.ejections_success_rate_.inc(); // Deprecated.
-        const envoy::data::cluster::v3::OutlierEjectionType type =
-            host_monitors_[host_success_rate_pair.host_]
-                ->getSRMonitor(monitor_type)
-                .getEjectionType();
         updateDetectedEjectionStats(type);
         ejectHost(host_success_rate_pair.host_, type);
       }
@@ -746,7 +748,7 @@ void DetectorImpl::processSuccessRateEjections(
 void DetectorImpl::onIntervalTimer() {
   MonotonicTime now = time_source_.monotonicTime();
 
-  for (auto host : host_monitors_) {
+  for (const auto& host : host_monitors_) {
     checkHostForUneject(host.first, host.second, now);
 
     // Need to update the writer bucket to keep the data valid.
@@ -97,12 +97,25 @@ void ThreadAwareLoadBalancerBase::initialize() {
   // complicated initialization as the load balancer would need its own initialized callback. I
   // think the synchronous/asynchronous split is probably the best option.
   priority_update_cb_ = priority_set_.addPriorityUpdateCb(
-      [this](uint32_t, const HostVector&, const HostVector&) -> void { refresh(); });
+      [this](uint32_t priority, const HostVector&, const HostVector&) -> void {
+        refresh(priority);
+      });
 
   refresh();
 }
 
-void ThreadAwareLoadBalancerBase::refresh() {
+void ThreadAwareLoadBalancerBase::refresh(absl::optional<uint32_t> changed_priority) {
+  // Building a ring or Maglev table is by far the most expensive part of a refresh, and the table
+  // inputs of a priority only change via updates delivered for that priority. When the triggering
+  // update is scoped to a single priority, grab the previously published state so the tables of
+  // the other priorities can be reused. Panic flags and per-priority loads are cheap and are
+  // always recomputed.
+  std::shared_ptr<std::vector<PerPriorityStatePtr>> previous_state;
+  if (changed_priority.has_value()) {
+    absl::ReaderMutexLock lock(&factory_->mutex_);
+    previous_state = factory_->per_priority_state_;
+  }
+
   auto per_priority_state_vector = std::make_shared<std::vector<PerPriorityStatePtr>>(
       priority_set_.hostSetsPerPriority().size());
   auto healthy_per_priority_load =
@@ -118,6 +131,17 @@ void ThreadAwareLoadBalancerBase::refresh() {
     // in hosts set or hosts' health.
     per_priority_state->global_panic_ = per_priority_panic_[priority];
 
+    // Reuse the previous hashing load balancer for priorities the triggering update did not touch.
+    // The panic flag is compared defensively: it feeds into weight normalization, so a priority
+    // whose panic state flipped must be rebuilt even if its membership did not change.
+    if (changed_priority.has_value() && priority != *changed_priority &&
+        previous_state != nullptr && priority < previous_state->size() &&
+        (*previous_state)[priority] != nullptr &&
+        (*previous_state)[priority]->global_panic_ == per_priority_state->global_panic_) {
+      per_priority_state->current_lb_ = (*previous_state)[priority]->current_lb_;
+      continue;
+    }
+
     // Normalize host and locality weights such that the sum of all normalized weights is 1.
     NormalizedHostWeightVector normalized_host_weights;
     double min_normalized_weight = 1.0;
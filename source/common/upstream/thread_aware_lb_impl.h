@@ -165,7 +165,10 @@ private:
   virtual HashingLoadBalancerSharedPtr
   createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
                      double min_normalized_weight, double max_normalized_weight) PURE;
-  void refresh();
+  // Rebuilds the per priority state published to workers. When the update that triggered the
+  // rebuild is scoped to a single priority, the hashing load balancers (ring/Maglev tables) of
+  // the other priorities are reused from the previous state instead of being rebuilt.
+  void refresh(absl::optional<uint32_t> changed_priority = absl::nullopt);
 
   std::shared_ptr<LoadBalancerFactoryImpl> factory_;
   const bool locality_weighted_balancing_{};
@@ -70,6 +70,16 @@ std::string addressToString(Network::Address::InstanceConstSharedPtr address) {
   return address->asString();
 }
 
+// Same as addressToString(), but returns a view of the address's cached string representation.
+// Used on the EDS update path where a copy per host per update adds up; absl hash containers with
+// std::string keys support heterogeneous string_view lookup.
+absl::string_view addressToStringView(const Network::Address::InstanceConstSharedPtr& address) {
+  if (!address) {
+    return "";
+  }
+  return address->asString();
+}
+
 Network::TcpKeepaliveConfig
 parseTcpKeepaliveConfig(const envoy::config::cluster::v3::Cluster& config) {
   const envoy::config::core::v3::TcpKeepalive& options =
@@ -1330,8 +1340,7 @@ ClusterImplBase::ClusterImplBase(const envoy::config::cluster::v3::Cluster& clus
       local_cluster_(cluster_context.clusterManager().localClusterName().value_or("") ==
                      cluster.name()),
       const_metadata_shared_pool_(Config::Metadata::getConstMetadataSharedPool(
-          cluster_context.serverFactoryContext().singletonManager(),
-          cluster_context.serverFactoryContext().mainThreadDispatcher())) {
+          cluster_context.serverFactoryContext().singletonManager())) {
 
   auto& server_context = cluster_context.serverFactoryContext();
 
@@ -1977,7 +1986,7 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
   HostVector final_hosts;
   for (const HostSharedPtr& host : new_hosts) {
     // To match a new host with an existing host means comparing their addresses.
-    auto existing_host = all_hosts.find(addressToString(host->address()));
+    auto existing_host = all_hosts.find(addressToStringView(host->address()));
     const bool existing_host_found = existing_host != all_hosts.end();
 
     // Clear any pending deletion flag on an existing host in case it came back while it was
@@ -2061,7 +2070,7 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
 
       final_hosts.push_back(existing_host->second);
     } else {
-      new_hosts_for_current_priority.emplace(addressToString(host->address()));
+      new_hosts_for_current_priority.emplace(addressToStringView(host->address()));
       if (host->weight() > max_host_weight) {
         max_host_weight = host->weight();
       }
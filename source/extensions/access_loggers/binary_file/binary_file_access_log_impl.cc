@@ -0,0 +1,142 @@
+#include "source/extensions/access_loggers/binary_file/binary_file_access_log_impl.h"
+
+#include "envoy/config/core/v3/base.pb.h"
+#include "envoy/data/accesslog/v3/accesslog.pb.h"
+
+#include "source/common/grpc/common.h"
+#include "source/common/http/header_utility.h"
+#include "source/common/http/headers.h"
+#include "source/extensions/access_loggers/grpc/grpc_access_log_utils.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace AccessLoggers {
+namespace BinaryFile {
+
+BinaryFileAccessLog::BinaryFileAccessLog(const Filesystem::FilePathAndType& access_log_file_info,
+                                         AccessLog::FilterPtr&& filter,
+                                         AccessLog::AccessLogManager& log_manager)
+    : ImplBase(std::move(filter)) {
+  log_file_ = log_manager.createAccessLog(access_log_file_info);
+}
+
+void BinaryFileAccessLog::emitLog(const Http::RequestHeaderMap& request_headers,
+                                  const Http::ResponseHeaderMap& response_headers,
+                                  const Http::ResponseTrailerMap& response_trailers,
+                                  const StreamInfo::StreamInfo& stream_info,
+                                  AccessLog::AccessLogType access_log_type) {
+  // Trailers are only serialized by loggers with a configurable trailers-to-log list.
+  UNREFERENCED_PARAMETER(response_trailers);
+
+  ProtobufWkt::Any record;
+
+  switch (access_log_type) {
+  case AccessLog::AccessLogType::TcpUpstreamConnected:
+  case AccessLog::AccessLogType::TcpPeriodic:
+  case AccessLog::AccessLogType::TcpConnectionEnd: {
+    envoy::data::accesslog::v3::TCPAccessLogEntry log_entry;
+    GrpcCommon::Utility::extractCommonAccessLogProperties(*log_entry.mutable_common_properties(),
+                                                          request_headers, stream_info,
+                                                          empty_common_config_, access_log_type);
+    log_entry.mutable_connection_properties()->set_received_bytes(stream_info.bytesReceived());
+    log_entry.mutable_connection_properties()->set_sent_bytes(stream_info.bytesSent());
+    record.PackFrom(log_entry);
+    break;
+  }
+  default: {
+    envoy::data::accesslog::v3::HTTPAccessLogEntry log_entry;
+    GrpcCommon::Utility::extractCommonAccessLogProperties(*log_entry.mutable_common_properties(),
+                                                          request_headers, stream_info,
+                                                          empty_common_config_, access_log_type);
+
+    if (stream_info.protocol()) {
+      switch (stream_info.protocol().value()) {
+      case Http::Protocol::Http10:
+        log_entry.set_protocol_version(envoy::data::accesslog::v3::HTTPAccessLogEntry::HTTP10);
+        break;
+      case Http::Protocol::Http11:
+        log_entry.set_protocol_version(envoy::data::accesslog::v3::HTTPAccessLogEntry::HTTP11);
+        break;
+      case Http::Protocol::Http2:
+        log_entry.set_protocol_version(envoy::data::accesslog::v3::HTTPAccessLogEntry::HTTP2);
+        break;
+      case Http::Protocol::Http3:
+        log_entry.set_protocol_version(envoy::data::accesslog::v3::HTTPAccessLogEntry::HTTP3);
+        break;
+      }
+    }
+
+    auto* request_properties = log_entry.mutable_request();
+    if (request_headers.Scheme() != nullptr) {
+      request_properties->set_scheme(
+          MessageUtil::sanitizeUtf8String(request_headers.getSchemeValue()));
+    }
+    if (request_headers.Host() != nullptr) {
+      request_properties->set_authority(
+          MessageUtil::sanitizeUtf8String(request_headers.getHostValue()));
+    }
+    if (request_headers.Path() != nullptr) {
+      request_properties->set_path(MessageUtil::sanitizeUtf8String(request_headers.getPathValue()));
+    }
+    if (request_headers.UserAgent() != nullptr) {
+      request_properties->set_user_agent(
+          MessageUtil::sanitizeUtf8String(request_headers.getUserAgentValue()));
+    }
+    const auto referer = Http::HeaderUtility::getAllOfHeaderAsString(
+        request_headers, Http::CustomHeaders::get().Referer);
+    if (referer.result().has_value()) {
+      request_properties->set_referer(MessageUtil::sanitizeUtf8String(referer.result().value()));
+    }
+    if (request_headers.ForwardedFor() != nullptr) {
+      request_properties->set_forwarded_for(
+          MessageUtil::sanitizeUtf8String(request_headers.getForwardedForValue()));
+    }
+    if (request_headers.RequestId() != nullptr) {
+      request_properties->set_request_id(
+          MessageUtil::sanitizeUtf8String(request_headers.getRequestIdValue()));
+    }
+    if (request_headers.EnvoyOriginalPath() != nullptr) {
+      request_properties->set_original_path(
+          MessageUtil::sanitizeUtf8String(request_headers.getEnvoyOriginalPathValue()));
+    }
+    request_properties->set_request_headers_bytes(request_headers.byteSize());
+    request_properties->set_request_body_bytes(stream_info.bytesReceived());
+    if (request_headers.Method() != nullptr) {
+      envoy::config::core::v3::RequestMethod method = envoy::config::core::v3::METHOD_UNSPECIFIED;
+      envoy::config::core::v3::RequestMethod_Parse(
+          MessageUtil::sanitizeUtf8String(request_headers.getMethodValue()), &method);
+      request_properties->set_request_method(method);
+    }
+
+    auto* response_properties = log_entry.mutable_response();
+    if (stream_info.responseCode()) {
+      response_properties->mutable_response_code()->set_value(stream_info.responseCode().value());
+    }
+    if (stream_info.responseCodeDetails()) {
+      response_properties->set_response_code_details(stream_info.responseCodeDetails().value());
+    }
+    response_properties->set_response_headers_bytes(response_headers.byteSize());
+    response_properties->set_response_body_bytes(stream_info.bytesSent());
+
+    if (const auto& bytes_meter = stream_info.getDownstreamBytesMeter(); bytes_meter != nullptr) {
+      request_properties->set_downstream_header_bytes_received(bytes_meter->headerBytesReceived());
+      response_properties->set_downstream_header_bytes_sent(bytes_meter->headerBytesSent());
+    }
+    if (const auto& bytes_meter = stream_info.getUpstreamBytesMeter(); bytes_meter != nullptr) {
+      request_properties->set_upstream_header_bytes_sent(bytes_meter->headerBytesSent());
+      response_properties->set_upstream_header_bytes_received(bytes_meter->headerBytesReceived());
+    }
+    record.PackFrom(log_entry);
+    break;
+  }
+  }
+
+  // The gRPC message framing gives collectors a standard, self-delimiting record format without
+  // inventing a new one: a zero flag byte followed by the 32-bit big-endian payload length.
+  log_file_->write(Grpc::Common::serializeToGrpcFrame(record)->toString());
+}
+
+} // namespace BinaryFile
+} // namespace AccessLoggers
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "envoy/data/accesslog/v3/accesslog.pb.h"
+#include "envoy/extensions/access_loggers/grpc/v3/als.pb.h"
+
+#include "source/extensions/access_loggers/common/access_log_base.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace AccessLoggers {
+namespace BinaryFile {
+
+/**
+ * Access log Instance that writes length-prefixed binary protobuf entries to a file, skipping
+ * substitution formatting entirely. Each record is a gRPC-style frame (zero flag byte plus
+ * 32-bit big-endian length) containing a serialized google.protobuf.Any wrapping an
+ * HTTPAccessLogEntry or TCPAccessLogEntry.
+ */
+class BinaryFileAccessLog : public Common::ImplBase {
+public:
+  BinaryFileAccessLog(const Filesystem::FilePathAndType& access_log_file_info,
+                      AccessLog::FilterPtr&& filter, AccessLog::AccessLogManager& log_manager);
+
+private:
+  // Common::ImplBase
+  void emitLog(const Http::RequestHeaderMap& request_headers,
+               const Http::ResponseHeaderMap& response_headers,
+               const Http::ResponseTrailerMap& response_trailers,
+               const StreamInfo::StreamInfo& stream_info,
+               AccessLog::AccessLogType access_log_type) override;
+
+  AccessLog::AccessLogFileSharedPtr log_file_;
+  // Passed to the shared extraction helper; this logger has none of the gRPC logger's knobs.
+  const envoy::extensions::access_loggers::grpc::v3::CommonGrpcAccessLogConfig
+      empty_common_config_;
+};
+
+} // namespace BinaryFile
+} // namespace AccessLoggers
+} // namespace Extensions
+} // namespace Envoy
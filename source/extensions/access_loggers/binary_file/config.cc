@@ -0,0 +1,55 @@
+#include "source/extensions/access_loggers/binary_file/config.h"
+
+#include <memory>
+
+#include "envoy/extensions/access_loggers/binary_file/v3/binary_file.pb.h"
+#include "envoy/extensions/access_loggers/binary_file/v3/binary_file.pb.validate.h"
+#include "envoy/registry/registry.h"
+#include "envoy/server/filter_config.h"
+
+#include "source/common/protobuf/protobuf.h"
+#include "source/extensions/access_loggers/binary_file/binary_file_access_log_impl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace AccessLoggers {
+namespace BinaryFile {
+
+AccessLog::InstanceSharedPtr BinaryFileAccessLogFactory::createAccessLogInstance(
+    const Protobuf::Message& config, AccessLog::FilterPtr&& filter,
+    Server::Configuration::ListenerAccessLogFactoryContext& context) {
+  return createAccessLogInstance(
+      config, std::move(filter),
+      static_cast<Server::Configuration::CommonFactoryContext&>(context));
+}
+
+AccessLog::InstanceSharedPtr BinaryFileAccessLogFactory::createAccessLogInstance(
+    const Protobuf::Message& config, AccessLog::FilterPtr&& filter,
+    Server::Configuration::CommonFactoryContext& context) {
+  const auto& fal_config = MessageUtil::downcastAndValidate<
+      const envoy::extensions::access_loggers::binary_file::v3::BinaryFileAccessLog&>(
+      config, context.messageValidationVisitor());
+
+  Filesystem::FilePathAndType file_info{Filesystem::DestinationType::File, fal_config.path()};
+  return std::make_shared<BinaryFileAccessLog>(file_info, std::move(filter),
+                                               context.accessLogManager());
+}
+
+ProtobufTypes::MessagePtr BinaryFileAccessLogFactory::createEmptyConfigProto() {
+  return ProtobufTypes::MessagePtr{
+      new envoy::extensions::access_loggers::binary_file::v3::BinaryFileAccessLog()};
+}
+
+std::string BinaryFileAccessLogFactory::name() const {
+  return "envoy.access_loggers.binary_file";
+}
+
+/**
+ * Static registration for the binary file access log. @see RegisterFactory.
+ */
+REGISTER_FACTORY(BinaryFileAccessLogFactory, Server::Configuration::AccessLogInstanceFactory);
+
+} // namespace BinaryFile
+} // namespace AccessLoggers
+} // namespace Extensions
+} // namespace Envoy
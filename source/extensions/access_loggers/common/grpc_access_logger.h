@@ -228,10 +228,7 @@ public:
       const Protobuf::MethodDescriptor& service_method, bool stream = true)
       : buffer_flush_interval_msec_(
             PROTOBUF_GET_MS_OR_DEFAULT(config, buffer_flush_interval, 1000)),
-        flush_timer_(dispatcher.createTimer([this]() {
-          flush();
-          flush_timer_->enableTimer(buffer_flush_interval_msec_);
-        })),
+        flush_timer_(dispatcher.createTimer([this]() { flush(); })),
         max_buffer_size_bytes_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, buffer_size_bytes, 16384)),
         stats_({ALL_GRPC_ACCESS_LOGGER_STATS(POOL_COUNTER_PREFIX(scope, access_log_prefix))}) {
     if (stream) {
@@ -275,6 +272,12 @@ private:
   virtual void clearMessage() { message_.Clear(); }
 
   void flush() {
+    // Restart the deadline on every flush, not just timer-driven ones, so that the interval
+    // bounds the age of the oldest buffered entry. Without this, a size-triggered flush could be
+    // followed almost immediately by a timer flush carrying one or two entries, producing tiny
+    // messages on the stream right after a full batch.
+    flush_timer_->enableTimer(buffer_flush_interval_msec_);
+
     if (isEmpty()) {
       // Nothing to flush.
       return;
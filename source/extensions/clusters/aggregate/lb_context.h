@@ -16,12 +16,10 @@ public:
                                Upstream::LoadBalancerBase::HostAvailability host_availability,
                                uint32_t host_priority)
       : host_availability_(host_availability), host_priority_(host_priority) {
-    if (context == nullptr) {
-      owned_context_ = std::make_unique<Upstream::LoadBalancerContextBase>();
-      context_ = owned_context_.get();
-    } else {
-      context_ = context;
-    }
+    // When no downstream context is provided, delegate to an inline default context instead of
+    // heap-allocating one. This wrapper is constructed on the stack for every host pick, so it
+    // must not allocate.
+    context_ = context != nullptr ? context : &default_context_;
   }
 
   // Upstream::LoadBalancerContext
@@ -68,7 +66,8 @@ public:
 
 private:
   Upstream::HealthyAndDegradedLoad priority_load_;
-  std::unique_ptr<Upstream::LoadBalancerContext> owned_context_;
+  // Stateless fallback used when the caller passes no context.
+  Upstream::LoadBalancerContextBase default_context_;
   Upstream::LoadBalancerContext* context_{nullptr};
   const Upstream::LoadBalancerBase::HostAvailability host_availability_;
   const uint32_t host_priority_;
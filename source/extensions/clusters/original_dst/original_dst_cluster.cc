@@ -241,70 +241,114 @@ void OriginalDstCluster::addHost(HostSharedPtr& host) {
                             {}, {std::move(host)}, {}, absl::nullopt, absl::nullopt);
 }
 
+// Returns true if the address should be kept: either a host has been recently
+// selected for it, or (with the idle timeout feature) one of its hosts is
+// still held by a connection pool. The set of hosts for a single address are
+// treated as a unit.
+static bool shouldKeepAddress(HostsForAddress& hosts) {
+  // Using the used_ bit is preserved for backwards compatibility and to
+  // add a delay between load balancers choosing a host and grabbing a
+  // handle on the host. This prevents the following interleaving:
+  //
+  // 1) worker 1: pools release host h
+  // 2) worker 1: auto h = lb.chooseHost(&ctx);
+  // 3) main: cleanup() // deletes h because h is not used by the pools
+  // 4) worker 1: auto handle = h.acquireHandle();
+  //
+  // Because the duration between steps 2) and 4) is O(instructions), step
+  // 3) will not delete h since it takes at least one cleanup_interval for
+  // the host to set used_ bit for h to false.
+  if (hosts.used_) {
+    hosts.used_ = false; // Mark to be removed during the next round.
+    return true;
+  }
+  if (Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.original_dst_rely_on_idle_timeout")) {
+    // Check that all hosts (first, as well as others that may have been added concurrently)
+    // are not in use by any connection pool.
+    if (hosts.host_->used()) {
+      return true;
+    }
+    for (const auto& host : hosts.hosts_) {
+      if (host->used()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 void OriginalDstCluster::cleanup() {
+  if (cleanup_snapshot_ == nullptr) {
+    // Start a new cleanup cycle against an immutable snapshot of the current
+    // host map. Entries added after the snapshot is taken are picked up by the
+    // next cycle.
+    ENVOY_LOG(trace, "Cleaning up stale original dst hosts.");
+    cleanup_snapshot_ = getCurrentHostMap();
+    cleanup_cursor_ = cleanup_snapshot_->begin();
+    stale_addresses_.clear();
+  }
+
+  // Scan at most the per-tick budget of entries, then yield to the event loop
+  // so a very large host map cannot stall the main thread in one callback.
+  size_t scanned = 0;
+  for (; cleanup_cursor_ != cleanup_snapshot_->end() &&
+         scanned < max_hosts_scanned_per_cleanup_tick_;
+       ++cleanup_cursor_, ++scanned) {
+    const auto& [addr, hosts] = *cleanup_cursor_;
+    if (!shouldKeepAddress(*hosts)) {
+      stale_addresses_.push_back(addr);
+    }
+  }
+
+  if (cleanup_cursor_ != cleanup_snapshot_->end()) {
+    // Budget exhausted; resume from the cursor on the next event loop
+    // iteration rather than waiting for a full cleanup interval.
+    cleanup_timer_->enableTimer(std::chrono::milliseconds(0));
+    return;
+  }
+
+  finishCleanup();
+  cleanup_timer_->enableTimer(cleanup_interval_ms_);
+}
+
+void OriginalDstCluster::finishCleanup() {
   HostVectorSharedPtr keeping_hosts(new HostVector);
   HostVector to_be_removed;
   absl::flat_hash_set<absl::string_view> removed_addresses;
   auto host_map = getCurrentHostMap();
-  if (!host_map->empty()) {
-    ENVOY_LOG(trace, "Cleaning up stale original dst hosts.");
-    for (const auto& [addr, hosts] : *host_map) {
-      // Address is kept in the cluster if either of the two things happen:
-      // 1) a host has been recently selected for the address; 2) none of the
-      // hosts are currently in any of the connection pools.
-      // The set of hosts for a single address are treated as a unit.
-      //
-      // Using the used_ bit is preserved for backwards compatibility and to
-      // add a delay between load balancers choosing a host and grabbing a
-      // handle on the host. This prevents the following interleaving:
-      //
-      // 1) worker 1: pools release host h
-      // 2) worker 1: auto h = lb.chooseHost(&ctx);
-      // 3) main: cleanup() // deletes h because h is not used by the pools
-      // 4) worker 1: auto handle = h.acquireHandle();
-      //
-      // Because the duration between steps 2) and 4) is O(instructions), step
-      // 3) will not delete h since it takes at least one cleanup_interval for
-      // the host to set used_ bit for h to false.
-      bool keep = false;
-      if (hosts->used_) {
-        keep = true;
-        hosts->used_ = false; // Mark to be removed during the next round.
-      } else if (Runtime::runtimeFeatureEnabled(
-                     "envoy.reloadable_features.original_dst_rely_on_idle_timeout")) {
-        // Check that all hosts (first, as well as others that may have been added concurrently)
-        // are not in use by any connection pool.
-        if (hosts->host_->used()) {
-          keep = true;
-        } else {
-          for (const auto& host : hosts->hosts_) {
-            if (host->used()) {
-              keep = true;
-              break;
-            }
-          }
-        }
-      }
-      if (keep) {
-        ENVOY_LOG(trace, "Keeping active address {}.", addr);
-        keeping_hosts->emplace_back(hosts->host_);
-        if (!hosts->hosts_.empty()) {
-          keeping_hosts->insert(keeping_hosts->end(), hosts->hosts_.begin(), hosts->hosts_.end());
-        }
-      } else {
-        ENVOY_LOG(trace, "Removing stale address {}.", addr);
-        removed_addresses.insert(addr);
-        to_be_removed.emplace_back(hosts->host_);
-        if (!hosts->hosts_.empty()) {
-          to_be_removed.insert(to_be_removed.end(), hosts->hosts_.begin(), hosts->hosts_.end());
-        }
-      }
+  for (const std::string& addr : stale_addresses_) {
+    auto it = host_map->find(addr);
+    if (it == host_map->end()) {
+      continue;
+    }
+    // Re-check staleness: the address may have been selected again between the
+    // scan tick that found it stale and now.
+    if (shouldKeepAddress(*it->second)) {
+      continue;
+    }
+    ENVOY_LOG(trace, "Removing stale address {}.", addr);
+    removed_addresses.insert(it->first);
+    to_be_removed.emplace_back(it->second->host_);
+    if (!it->second->hosts_.empty()) {
+      to_be_removed.insert(to_be_removed.end(), it->second->hosts_.begin(),
+                           it->second->hosts_.end());
     }
   }
+
   if (!to_be_removed.empty()) {
-    HostMultiMapSharedPtr new_host_map = std::make_shared<HostMultiMap>(*host_map);
-    for (const auto& addr : removed_addresses) {
-      new_host_map->erase(addr);
+    HostMultiMapSharedPtr new_host_map = std::make_shared<HostMultiMap>();
+    new_host_map->reserve(host_map->size() - removed_addresses.size());
+    for (const auto& [addr, hosts] : *host_map) {
+      if (removed_addresses.contains(addr)) {
+        continue;
+      }
+      ENVOY_LOG(trace, "Keeping active address {}.", addr);
+      keeping_hosts->emplace_back(hosts->host_);
+      if (!hosts->hosts_.empty()) {
+        keeping_hosts->insert(keeping_hosts->end(), hosts->hosts_.begin(), hosts->hosts_.end());
+      }
+      new_host_map->emplace(addr, hosts);
     }
     setHostMap(new_host_map);
     priority_set_.updateHosts(
@@ -312,7 +356,8 @@ void OriginalDstCluster::cleanup() {
         to_be_removed, false, absl::nullopt);
   }
 
-  cleanup_timer_->enableTimer(cleanup_interval_ms_);
+  cleanup_snapshot_ = nullptr;
+  stale_addresses_.clear();
 }
 
 absl::StatusOr<std::pair<ClusterImplBaseSharedPtr, ThreadAwareLoadBalancerPtr>>
@@ -169,6 +169,13 @@ private:
   void addHost(HostSharedPtr&);
   void cleanup();
 
+  /**
+   * Applies the removal decisions accumulated over a finished cleanup scan:
+   * stale addresses that have not been re-selected since they were scanned are
+   * removed from the host map and the priority set in one batch.
+   */
+  void finishCleanup();
+
   // ClusterImplBase
   void startPreInit() override { onPreInitComplete(); }
 
@@ -176,6 +183,22 @@ private:
   const std::chrono::milliseconds cleanup_interval_ms_;
   Event::TimerPtr cleanup_timer_;
 
+  // Default number of host map entries examined per cleanup timer tick. When a
+  // scan hits the budget, the pass yields back to the event loop and resumes
+  // from its cursor on the next tick, bounding main-thread stalls when the
+  // host map is very large.
+  static constexpr size_t DefaultMaxHostsScannedPerCleanupTick = 10000;
+
+  // Scan budget per tick; only adjusted in tests.
+  size_t max_hosts_scanned_per_cleanup_tick_{DefaultMaxHostsScannedPerCleanupTick};
+  // Snapshot of the host map being scanned by the in-progress cleanup cycle,
+  // or nullptr when no cycle is in progress. The cursor points into the
+  // snapshot, which is immutable, so it stays valid across ticks.
+  HostMultiMapConstSharedPtr cleanup_snapshot_;
+  HostMultiMap::const_iterator cleanup_cursor_;
+  // Addresses found stale by the in-progress cleanup cycle.
+  std::vector<std::string> stale_addresses_;
+
   absl::Mutex host_map_lock_;
   HostMultiMapConstSharedPtr host_map_ ABSL_GUARDED_BY(host_map_lock_);
   absl::optional<Http::LowerCaseString> http_header_name_;
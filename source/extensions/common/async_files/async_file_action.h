@@ -1,12 +1,18 @@
 #pragma once
 
+#include <sys/types.h>
+
 #include <atomic>
 #include <functional>
 
+#include "envoy/buffer/buffer.h"
 #include "envoy/common/pure.h"
 
 #include "source/common/common/assert.h"
 
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace Common {
@@ -63,13 +69,29 @@ public:
       : on_complete_(on_complete) {}
 
   void execute() final {
+    if (!claimForExecution()) {
+      return;
+    }
+    completeWith(executeImpl());
+  }
+
+protected:
+  // Moves the action from Queued to Executing. Returns false if the action was
+  // cancelled while it was still queued, in which case it must not be performed.
+  bool claimForExecution() {
     State expected = State::Queued;
     if (!state_.compare_exchange_strong(expected, State::Executing)) {
       ASSERT(expected == State::Cancelled);
-      return;
+      return false;
     }
-    expected = State::Executing;
-    T result = executeImpl();
+    return true;
+  }
+
+  // Runs the completion half of the action - the callback, or the cancellation
+  // cleanup if the action was cancelled while executing. Called by execute(), or
+  // directly by managers that perform the action's system call themselves.
+  void completeWith(T result) {
+    State expected = State::Executing;
     if (!state_.compare_exchange_strong(expected, State::InCallback)) {
       ASSERT(expected == State::Cancelled);
       onCancelledBeforeCallback(std::move(result));
@@ -79,7 +101,6 @@ public:
     state_.store(State::Done);
   }
 
-protected:
   // Performs any action to undo side-effects of the execution if the callback
   // has not yet been called (e.g. closing a file that was just opened).
   // Not necessary for things that don't make persistent resources,
@@ -93,6 +114,37 @@ private:
   std::function<void(T)> on_complete_;
 };
 
+// Description of a single file system call that an io_uring-based manager can
+// submit on behalf of an action. The slices are only used by Readv and Writev,
+// and must remain valid until the operation completes.
+struct FileRingOp {
+  enum class Operation { Readv, Writev, Close };
+  Operation operation_;
+  int file_descriptor_;
+  off_t offset_{0};
+  absl::Span<Buffer::RawSlice> slices_{};
+};
+
+// Additional interface for actions whose system call can be performed through an
+// io_uring rather than on the thread executing the action. Managers that don't
+// use a ring simply call execute() and this interface goes unused.
+class IoUringCompatibleAction {
+public:
+  virtual ~IoUringCompatibleAction() = default;
+
+  // Claims the action for execution and describes the system call the manager
+  // should submit. Returns nullopt if there is nothing to submit, either because
+  // the action was cancelled while queued or because it completed without
+  // needing a system call (e.g. a zero-length write).
+  virtual absl::optional<FileRingOp> prepareRingOp() PURE;
+
+  // Called with the result of the submitted system call (a negative errno on
+  // failure, as reported by the ring). Runs the action's callback, or, if a
+  // short write left data outstanding, returns a follow-up operation to submit
+  // for this same action instead.
+  virtual absl::optional<FileRingOp> completeRingOp(int32_t syscall_result) PURE;
+};
+
 } // namespace AsyncFiles
 } // namespace Common
 } // namespace Extensions
@@ -80,7 +80,8 @@ private:
   const std::string filename_;
 };
 
-class ActionCloseFile : public AsyncFileActionThreadPool<absl::Status> {
+class ActionCloseFile : public AsyncFileActionThreadPool<absl::Status>,
+                        public IoUringCompatibleAction {
 public:
   // Here we take a copy of the AsyncFileContext's file descriptor, because the close function
   // sets the AsyncFileContext's file descriptor to -1. This way there will be no race of trying
@@ -97,11 +98,28 @@ public:
     return absl::OkStatus();
   }
 
+  absl::optional<FileRingOp> prepareRingOp() override {
+    if (!claimForExecution()) {
+      return absl::nullopt;
+    }
+    return FileRingOp{FileRingOp::Operation::Close, file_descriptor_};
+  }
+
+  absl::optional<FileRingOp> completeRingOp(int32_t syscall_result) override {
+    if (syscall_result < 0) {
+      completeWith(statusAfterFileError(-syscall_result));
+    } else {
+      completeWith(absl::OkStatus());
+    }
+    return absl::nullopt;
+  }
+
 private:
   const int file_descriptor_;
 };
 
-class ActionReadFile : public AsyncFileActionThreadPool<absl::StatusOr<Buffer::InstancePtr>> {
+class ActionReadFile : public AsyncFileActionThreadPool<absl::StatusOr<Buffer::InstancePtr>>,
+                       public IoUringCompatibleAction {
 public:
   ActionReadFile(AsyncFileHandle handle, off_t offset, size_t length,
                  std::function<void(absl::StatusOr<Buffer::InstancePtr>)> on_complete)
@@ -125,12 +143,51 @@ public:
     return result;
   }
 
+  absl::optional<FileRingOp> prepareRingOp() override {
+    if (!claimForExecution()) {
+      return absl::nullopt;
+    }
+    ASSERT(fileDescriptor() != -1);
+    buffer_ = std::make_unique<Buffer::OwnedImpl>();
+    reservation_.emplace(buffer_->reserveSingleSlice(length_));
+    slice_ = {reservation_->slice().mem_, length_};
+    return FileRingOp{FileRingOp::Operation::Readv, fileDescriptor(), offset_,
+                      absl::MakeSpan(&slice_, 1)};
+  }
+
+  absl::optional<FileRingOp> completeRingOp(int32_t syscall_result) override {
+    if (syscall_result < 0) {
+      reservation_.reset();
+      buffer_.reset();
+      completeWith(statusAfterFileError(-syscall_result));
+      return absl::nullopt;
+    }
+    Buffer::InstancePtr result;
+    if (static_cast<size_t>(syscall_result) != length_) {
+      result = std::make_unique<Buffer::OwnedImpl>(reservation_->slice().mem_, syscall_result);
+      reservation_.reset();
+      buffer_.reset();
+    } else {
+      reservation_->commit(syscall_result);
+      reservation_.reset();
+      result = std::move(buffer_);
+    }
+    completeWith(std::move(result));
+    return absl::nullopt;
+  }
+
 private:
   const off_t offset_;
   const size_t length_;
+  // State for the ring-submitted form of the read; the reservation must stay
+  // alive while the kernel is filling it.
+  Buffer::InstancePtr buffer_;
+  absl::optional<Buffer::ReservationSingleSlice> reservation_;
+  Buffer::RawSlice slice_;
 };
 
-class ActionWriteFile : public AsyncFileActionThreadPool<absl::StatusOr<size_t>> {
+class ActionWriteFile : public AsyncFileActionThreadPool<absl::StatusOr<size_t>>,
+                        public IoUringCompatibleAction {
 public:
   ActionWriteFile(AsyncFileHandle handle, Buffer::Instance& contents, off_t offset,
                   std::function<void(absl::StatusOr<size_t>)> on_complete)
@@ -158,9 +215,53 @@ public:
     return total_bytes_written;
   }
 
+  absl::optional<FileRingOp> prepareRingOp() override {
+    if (!claimForExecution()) {
+      return absl::nullopt;
+    }
+    ASSERT(fileDescriptor() != -1);
+    slices_ = contents_.getRawSlices();
+    if (slices_.empty()) {
+      completeWith(0);
+      return absl::nullopt;
+    }
+    return makeWriteOp();
+  }
+
+  absl::optional<FileRingOp> completeRingOp(int32_t syscall_result) override {
+    if (syscall_result < 0) {
+      completeWith(statusAfterFileError(-syscall_result));
+      return absl::nullopt;
+    }
+    total_bytes_written_ += syscall_result;
+    // Drop fully written slices, and trim a partially written one, so that a
+    // short write can be resumed where it left off.
+    size_t remaining = syscall_result;
+    while (!slices_.empty() && remaining >= slices_.front().len_) {
+      remaining -= slices_.front().len_;
+      slices_.erase(slices_.begin());
+    }
+    if (slices_.empty()) {
+      completeWith(total_bytes_written_);
+      return absl::nullopt;
+    }
+    slices_.front().mem_ = static_cast<char*>(slices_.front().mem_) + remaining;
+    slices_.front().len_ -= remaining;
+    return makeWriteOp();
+  }
+
 private:
+  FileRingOp makeWriteOp() {
+    return FileRingOp{FileRingOp::Operation::Writev, fileDescriptor(),
+                      offset_ + static_cast<off_t>(total_bytes_written_), absl::MakeSpan(slices_)};
+  }
+
   Buffer::OwnedImpl contents_;
   const off_t offset_;
+  // State for the ring-submitted form of the write; the slices point into
+  // contents_ and must stay valid while the kernel is reading them.
+  Buffer::RawSliceVector slices_;
+  size_t total_bytes_written_{0};
 };
 
 class ActionDuplicateFile : public AsyncFileActionThreadPool<absl::StatusOr<AsyncFileHandle>> {
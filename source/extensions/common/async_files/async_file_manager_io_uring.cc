@@ -0,0 +1,215 @@
+#include "source/extensions/common/async_files/async_file_manager_io_uring.h"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <memory>
+#include <queue>
+#include <utility>
+
+#include "envoy/common/exception.h"
+
+#include "source/common/common/utility.h"
+#include "source/common/io/io_uring_impl.h"
+#include "source/extensions/common/async_files/async_file_action.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace Common {
+namespace AsyncFiles {
+
+namespace {
+constexpr uint32_t DefaultIoUringSize = 128;
+
+// FileRingOp describes scatter-gather buffers as Buffer::RawSlice so that
+// async_file_action.h stays platform-neutral; the kernel consumes them as iovec.
+static_assert(sizeof(Buffer::RawSlice) == sizeof(struct iovec) &&
+                  offsetof(Buffer::RawSlice, mem_) == offsetof(struct iovec, iov_base) &&
+                  offsetof(Buffer::RawSlice, len_) == offsetof(struct iovec, iov_len),
+              "RawSlice must match iovec layout");
+} // namespace
+
+AsyncFileManagerIoUring::AsyncFileManagerIoUring(
+    const envoy::extensions::common::async_files::v3::AsyncFileManagerConfig& config,
+    Api::OsSysCalls& posix)
+    : AsyncFileManagerThreadPool(posix),
+      io_uring_size_(config.io_uring().io_uring_size() == 0 ? DefaultIoUringSize
+                                                            : config.io_uring().io_uring_size()) {
+  if (!Io::isIoUringSupported()) {
+    throw EnvoyException("AsyncFileManagerIoUring is not supported on this kernel");
+  }
+  int result = io_uring_queue_init(io_uring_size_, &ring_, 0);
+  if (result != 0) {
+    throw EnvoyException(fmt::format("AsyncFileManagerIoUring failed to initialize a ring: {}",
+                                     errorDetails(-result)));
+  }
+  wakeup_fd_ = eventfd(0, 0);
+  RELEASE_ASSERT(wakeup_fd_ != -1, "unable to create an eventfd");
+  wakeup_iov_ = {&wakeup_buf_, sizeof(wakeup_buf_)};
+  ENVOY_LOG(info, fmt::format("AsyncFileManagerIoUring created with id '{}', ring size {}",
+                              config.id(), io_uring_size_));
+  thread_pool_.emplace_back([this]() { driver(); });
+}
+
+AsyncFileManagerIoUring::~AsyncFileManagerIoUring() {
+  {
+    absl::MutexLock lock(&queue_mutex_);
+    terminate_ = true;
+  }
+  wakeDriver();
+  while (!thread_pool_.empty()) {
+    thread_pool_.back().join();
+    thread_pool_.pop_back();
+  }
+  io_uring_queue_exit(&ring_);
+  ::close(wakeup_fd_);
+}
+
+std::string AsyncFileManagerIoUring::describe() const {
+  return absl::StrCat("io_uring_size = ", io_uring_size_, ", in_flight = ", in_flight_.load());
+}
+
+CancelFunction AsyncFileManagerIoUring::enqueue(std::shared_ptr<AsyncFileAction> action) {
+  // If the enqueue is chained from a callback it goes into thread_next_action_
+  // and the driver picks it up without a wakeup; only cross-thread enqueues need
+  // to interrupt the driver's wait.
+  const bool needs_wakeup = !thread_is_worker_;
+  CancelFunction cancel_func = AsyncFileManagerThreadPool::enqueue(std::move(action));
+  if (needs_wakeup) {
+    wakeDriver();
+  }
+  return cancel_func;
+}
+
+void AsyncFileManagerIoUring::driver() {
+  thread_is_worker_ = true;
+  armWakeup();
+  bool terminating = false;
+  while (true) {
+    // Submits any prepared entries and blocks until at least one completion,
+    // which may be a file operation or the wakeup eventfd read.
+    io_uring_submit_and_wait(&ring_, 1);
+    struct io_uring_cqe* cqe = nullptr;
+    while (io_uring_peek_cqe(&ring_, &cqe) == 0) {
+      void* user_data = io_uring_cqe_get_data(cqe);
+      const int32_t result = cqe->res;
+      io_uring_cqe_seen(&ring_, cqe);
+      if (user_data == &wakeup_buf_) {
+        wakeup_armed_ = false;
+        continue;
+      }
+      onRingCompletion(static_cast<InFlightOp*>(user_data), result);
+    }
+    if (!terminating) {
+      absl::MutexLock lock(&queue_mutex_);
+      while (!queue_.empty()) {
+        pending_.push(std::move(queue_.front()));
+        queue_.pop();
+      }
+      terminating = terminate_;
+    }
+    while (!pending_.empty() && in_flight_.load() < io_uring_size_) {
+      std::shared_ptr<AsyncFileAction> action = std::move(pending_.front());
+      pending_.pop();
+      startAction(std::move(action));
+      drainChainedActions();
+    }
+    if (terminating && in_flight_.load() == 0) {
+      // Like the thread pool's workers, exit without performing actions that are
+      // still queued, but only once every in-flight kernel operation - whose
+      // buffers the actions own - has completed.
+      return;
+    }
+    if (!terminating && !wakeup_armed_) {
+      armWakeup();
+    }
+  }
+}
+
+void AsyncFileManagerIoUring::startAction(std::shared_ptr<AsyncFileAction> action) {
+  auto* ring_action = dynamic_cast<IoUringCompatibleAction*>(action.get());
+  if (ring_action == nullptr) {
+    action->execute();
+    return;
+  }
+  absl::optional<FileRingOp> op = ring_action->prepareRingOp();
+  if (!op.has_value()) {
+    // Cancelled while queued, or completed without needing a system call.
+    return;
+  }
+  auto* in_flight_op = new InFlightOp{std::move(action), ring_action};
+  in_flight_++;
+  submitRingOp(*op, in_flight_op);
+}
+
+void AsyncFileManagerIoUring::onRingCompletion(InFlightOp* op, int32_t result) {
+  absl::optional<FileRingOp> follow_up = op->ring_action_->completeRingOp(result);
+  if (follow_up.has_value()) {
+    // A short write - resubmit the remainder under the same in-flight op.
+    submitRingOp(*follow_up, op);
+    return;
+  }
+  delete op;
+  in_flight_--;
+  drainChainedActions();
+}
+
+void AsyncFileManagerIoUring::submitRingOp(const FileRingOp& op, InFlightOp* in_flight_op) {
+  struct io_uring_sqe* sqe = getSqe();
+  switch (op.operation_) {
+  case FileRingOp::Operation::Readv:
+    io_uring_prep_readv(sqe, op.file_descriptor_,
+                        reinterpret_cast<const struct iovec*>(op.slices_.data()),
+                        op.slices_.size(), op.offset_);
+    break;
+  case FileRingOp::Operation::Writev:
+    io_uring_prep_writev(sqe, op.file_descriptor_,
+                         reinterpret_cast<const struct iovec*>(op.slices_.data()),
+                         op.slices_.size(), op.offset_);
+    break;
+  case FileRingOp::Operation::Close:
+    io_uring_prep_close(sqe, op.file_descriptor_);
+    break;
+  }
+  io_uring_sqe_set_data(sqe, in_flight_op);
+}
+
+void AsyncFileManagerIoUring::drainChainedActions() {
+  // Callbacks chain their follow-up action through thread_next_action_, exactly
+  // as with the thread pool; chained ring-capable actions go back onto the ring.
+  while (thread_next_action_ != nullptr) {
+    std::shared_ptr<AsyncFileAction> action = std::move(thread_next_action_);
+    startAction(std::move(action));
+  }
+}
+
+void AsyncFileManagerIoUring::armWakeup() {
+  struct io_uring_sqe* sqe = getSqe();
+  io_uring_prep_readv(sqe, wakeup_fd_, &wakeup_iov_, 1, 0);
+  io_uring_sqe_set_data(sqe, &wakeup_buf_);
+  wakeup_armed_ = true;
+}
+
+void AsyncFileManagerIoUring::wakeDriver() {
+  // An eventfd write never blocks here, and accumulates if the driver is busy,
+  // so wakeups cannot be lost.
+  const int result = eventfd_write(wakeup_fd_, 1);
+  RELEASE_ASSERT(result == 0, "unable to write to the wakeup eventfd");
+}
+
+struct io_uring_sqe* AsyncFileManagerIoUring::getSqe() {
+  struct io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+  if (sqe == nullptr) {
+    // The submission queue is full of unsubmitted entries; flush them to make room.
+    io_uring_submit(&ring_);
+    sqe = io_uring_get_sqe(&ring_);
+    RELEASE_ASSERT(sqe != nullptr, "io_uring submission queue full after submit");
+  }
+  return sqe;
+}
+
+} // namespace AsyncFiles
+} // namespace Common
+} // namespace Extensions
+} // namespace Envoy
@@ -15,24 +15,19 @@ namespace Extensions {
 namespace Common {
 namespace AsyncFiles {
 
-namespace {
-// ThreadNextAction is per worker thread; if enqueue is called from a callback
-// the action goes directly into ThreadNextAction, otherwise it goes into the
-// queue and is eventually pulled out into ThreadNextAction by a worker thread.
-thread_local std::shared_ptr<AsyncFileAction> ThreadNextAction;
-
-// ThreadIsWorker is set to true for worker threads, and will be false
-// for all other threads.
-thread_local bool ThreadIsWorker = false;
-} // namespace
+thread_local std::shared_ptr<AsyncFileAction> AsyncFileManagerThreadPool::thread_next_action_;
+thread_local bool AsyncFileManagerThreadPool::thread_is_worker_ = false;
 
-AsyncFileManagerThreadPool::AsyncFileManagerThreadPool(
-    const envoy::extensions::common::async_files::v3::AsyncFileManagerConfig& config,
-    Api::OsSysCalls& posix)
-    : posix_(posix) {
+AsyncFileManagerThreadPool::AsyncFileManagerThreadPool(Api::OsSysCalls& posix) : posix_(posix) {
   if (!posix.supportsAllPosixFileOperations()) {
     throw EnvoyException("AsyncFileManagerThreadPool not supported");
   }
+}
+
+AsyncFileManagerThreadPool::AsyncFileManagerThreadPool(
+    const envoy::extensions::common::async_files::v3::AsyncFileManagerConfig& config,
+    Api::OsSysCalls& posix)
+    : AsyncFileManagerThreadPool(posix) {
   unsigned int thread_pool_size = config.thread_pool().thread_count();
   if (thread_pool_size == 0) {
     thread_pool_size = std::thread::hardware_concurrency();
@@ -65,9 +60,9 @@ std::function<void()> AsyncFileManagerThreadPool::enqueue(std::shared_ptr<AsyncF
   // If an action is being enqueued from within a callback, we don't have to actually queue it,
   // we can just set it as the thread's next action - this acts to chain the actions without
   // yielding to another file.
-  if (ThreadIsWorker) {
-    ASSERT(!ThreadNextAction); // only do one file action per callback.
-    ThreadNextAction = std::move(action);
+  if (thread_is_worker_) {
+    ASSERT(!thread_next_action_); // only do one file action per callback.
+    thread_next_action_ = std::move(action);
     return cancel_func;
   }
   absl::MutexLock lock(&queue_mutex_);
@@ -76,7 +71,7 @@ std::function<void()> AsyncFileManagerThreadPool::enqueue(std::shared_ptr<AsyncF
 }
 
 void AsyncFileManagerThreadPool::worker() {
-  ThreadIsWorker = true;
+  thread_is_worker_ = true;
   while (true) {
     const auto condition = [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(queue_mutex_) {
       return !queue_.empty() || terminate_;
@@ -87,7 +82,7 @@ void AsyncFileManagerThreadPool::worker() {
       if (terminate_) {
         return;
       }
-      ThreadNextAction = std::move(queue_.front());
+      thread_next_action_ = std::move(queue_.front());
       queue_.pop();
     }
     resolveActions();
@@ -95,10 +90,10 @@ void AsyncFileManagerThreadPool::worker() {
 }
 
 void AsyncFileManagerThreadPool::resolveActions() {
-  while (ThreadNextAction) {
-    // Move the action out of ThreadNextAction so that its callback can enqueue
-    // a different ThreadNextAction without self-destructing.
-    std::shared_ptr<AsyncFileAction> action = std::move(ThreadNextAction);
+  while (thread_next_action_) {
+    // Move the action out of thread_next_action_ so that its callback can enqueue
+    // a different thread_next_action_ without self-destructing.
+    std::shared_ptr<AsyncFileAction> action = std::move(thread_next_action_);
     action->execute();
   }
 }
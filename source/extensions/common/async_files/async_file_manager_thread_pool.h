@@ -23,6 +23,10 @@ namespace AsyncFiles {
 // received, except when operations are chained, in which case the thread that
 // performed the previous action in the chain immediately performs the newly chained
 // action.
+//
+// Also serves as the base for AsyncFileManagerIoUring, which shares the queue and
+// the actions but drives the system calls through a ring instead of a pool of
+// blocking threads.
 class AsyncFileManagerThreadPool : public AsyncFileManager,
                                    protected Logger::Loggable<Logger::Id::main> {
 public:
@@ -55,17 +59,33 @@ public:
   bool supports_o_tmpfile_;
 #endif // O_TMPFILE
 
-private:
+protected:
+  // Constructor for subclasses which provide their own threads - performs the
+  // platform support check but does not start any workers.
+  explicit AsyncFileManagerThreadPool(Api::OsSysCalls& posix);
+
   std::function<void()> enqueue(std::shared_ptr<AsyncFileAction> action)
       ABSL_LOCKS_EXCLUDED(queue_mutex_) override;
-  void worker() ABSL_LOCKS_EXCLUDED(queue_mutex_);
   void resolveActions();
 
+  // thread_next_action_ is per worker thread; if enqueue is called from a callback
+  // the action goes directly into thread_next_action_, otherwise it goes into the
+  // queue and is eventually pulled out into thread_next_action_ by a worker thread.
+  static thread_local std::shared_ptr<AsyncFileAction> thread_next_action_;
+
+  // thread_is_worker_ is set to true for worker threads, and will be false
+  // for all other threads.
+  static thread_local bool thread_is_worker_;
+
   absl::Mutex queue_mutex_;
   std::queue<std::shared_ptr<AsyncFileAction>> queue_ ABSL_GUARDED_BY(queue_mutex_);
   bool terminate_ ABSL_GUARDED_BY(queue_mutex_) = false;
 
   std::vector<std::thread> thread_pool_;
+
+private:
+  void worker() ABSL_LOCKS_EXCLUDED(queue_mutex_);
+
   Api::OsSysCalls& posix_;
 };
 
@@ -98,6 +98,18 @@ DnsCacheImpl::loadDnsCacheEntry(absl::string_view raw_host, uint16_t default_por
             is_proxy_lookup ? "proxy mode " : "");
   ThreadLocalHostInfo& tls_host_info = *tls_slot_;
 
+  // Fast path: this worker's view of the resolved hosts, maintained by posted updates from the
+  // main thread. Hosts are only published there after their first resolution completes, so an
+  // entry can be returned without consulting (and contending on) the primary map lock. A host
+  // that was added or removed on the main thread but whose update has not yet reached this
+  // worker falls through to the locked lookup, exactly as a lookup racing the update did before.
+  auto tls_it = tls_host_info.host_map_.find(host);
+  if (tls_it != tls_host_info.host_map_.end()) {
+    ENVOY_LOG(debug, "thread local cache hit for host '{}'", host);
+    return {LoadDnsCacheEntryStatus::InCache, nullptr,
+            absl::optional<DnsHostInfoSharedPtr>(tls_it->second)};
+  }
+
   auto [is_overflow, host_info] = [&]() {
     absl::ReaderMutexLock read_lock{&primary_hosts_lock_};
     auto tls_host = primary_hosts_.find(host);
@@ -267,7 +279,7 @@ void DnsCacheImpl::onReResolve(const std::string& host) {
       host_to_erase = std::move(host_it->second);
       primary_hosts_.erase(host_it);
     }
-    notifyThreads(host, primary_host.host_info_);
+    notifyThreads(host, primary_host.host_info_, true /*removed*/);
   } else {
     startResolve(host, primary_host);
   }
@@ -451,8 +463,8 @@ void DnsCacheImpl::runRemoveCallbacks(const std::string& host) {
 }
 
 void DnsCacheImpl::notifyThreads(const std::string& host,
-                                 const DnsHostInfoImplSharedPtr& resolved_info) {
-  auto shared_info = std::make_shared<HostMapUpdateInfo>(host, resolved_info);
+                                 const DnsHostInfoImplSharedPtr& resolved_info, bool removed) {
+  auto shared_info = std::make_shared<HostMapUpdateInfo>(host, resolved_info, removed);
   tls_slot_.runOnAllThreads([shared_info](OptRef<ThreadLocalHostInfo> local_host_info) {
     local_host_info->onHostMapUpdate(shared_info);
   });
@@ -469,6 +481,11 @@ DnsCacheImpl::ThreadLocalHostInfo::~ThreadLocalHostInfo() {
 
 void DnsCacheImpl::ThreadLocalHostInfo::onHostMapUpdate(
     const HostMapUpdateInfoSharedPtr& resolved_host) {
+  if (resolved_host->removed_) {
+    host_map_.erase(resolved_host->host_);
+  } else {
+    host_map_.insert_or_assign(resolved_host->host_, resolved_host->info_);
+  }
   auto host_it = pending_resolutions_.find(resolved_host->host_);
   if (host_it != pending_resolutions_.end()) {
     for (auto* resolution : host_it->second) {
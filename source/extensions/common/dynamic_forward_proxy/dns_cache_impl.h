@@ -87,10 +87,12 @@ private:
   using DnsHostInfoImplSharedPtr = std::shared_ptr<DnsHostInfoImpl>;
 
   struct HostMapUpdateInfo {
-    HostMapUpdateInfo(const std::string& host, DnsHostInfoImplSharedPtr info)
-        : host_(host), info_(std::move(info)) {}
+    HostMapUpdateInfo(const std::string& host, DnsHostInfoImplSharedPtr info, bool removed)
+        : host_(host), info_(std::move(info)), removed_(removed) {}
     std::string host_;
     DnsHostInfoImplSharedPtr info_;
+    // Whether this update removes the host from the cache rather than adding/updating it.
+    bool removed_;
   };
   using HostMapUpdateInfoSharedPtr = std::shared_ptr<HostMapUpdateInfo>;
 
@@ -100,6 +102,10 @@ private:
     ~ThreadLocalHostInfo() override;
     void onHostMapUpdate(const HostMapUpdateInfoSharedPtr& resolved_info);
     absl::flat_hash_map<std::string, std::list<LoadDnsCacheEntryHandleImpl*>> pending_resolutions_;
+    // This worker's view of the resolved hosts, maintained via posted updates from the main
+    // thread. Reads take no lock; the authoritative map under primary_hosts_lock_ is only
+    // consulted on a miss here.
+    absl::flat_hash_map<std::string, DnsHostInfoImplSharedPtr> host_map_;
     DnsCacheImpl& parent_;
   };
 
@@ -214,7 +220,8 @@ private:
                                       const DnsHostInfoSharedPtr& host_info,
                                       Network::DnsResolver::ResolutionStatus status);
   void runRemoveCallbacks(const std::string& host);
-  void notifyThreads(const std::string& host, const DnsHostInfoImplSharedPtr& resolved_info);
+  void notifyThreads(const std::string& host, const DnsHostInfoImplSharedPtr& resolved_info,
+                     bool removed = false);
   void onReResolve(const std::string& host);
   void onResolveTimeout(const std::string& host);
   PrimaryHostInfo& getPrimaryHost(const std::string& host);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include "envoy/server/lifecycle_notifier.h"
@@ -31,12 +32,13 @@ struct CreateWasmStats {
   CREATE_WASM_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT)
 };
 
-#define LIFECYCLE_STATS(COUNTER, GAUGE)                                                            \
+#define LIFECYCLE_STATS(COUNTER, GAUGE, HISTOGRAM)                                                 \
   COUNTER(created)                                                                                 \
-  GAUGE(active, NeverImport)
+  GAUGE(active, NeverImport)                                                                       \
+  HISTOGRAM(create_time_ms, Milliseconds)
 
 struct LifecycleStats {
-  LIFECYCLE_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT)
+  LIFECYCLE_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT, GENERATE_HISTOGRAM_STRUCT)
 };
 
 using ScopeWeakPtr = std::weak_ptr<Stats::Scope>;
@@ -92,10 +94,18 @@ public:
   LifecycleStatsHandler(const Stats::ScopeSharedPtr& scope, std::string runtime)
       : lifecycle_stats_(LifecycleStats{
             LIFECYCLE_STATS(POOL_COUNTER_PREFIX(*scope, absl::StrCat("wasm.", runtime, ".")),
-                            POOL_GAUGE_PREFIX(*scope, absl::StrCat("wasm.", runtime, ".")))}){};
+                            POOL_GAUGE_PREFIX(*scope, absl::StrCat("wasm.", runtime, ".")),
+                            POOL_HISTOGRAM_PREFIX(*scope, absl::StrCat("wasm.", runtime, ".")))}){};
   ~LifecycleStatsHandler() = default;
 
   void onEvent(WasmEvent event);
+
+  // Records the wall time spent creating a VM: compiling/JITing the module for a base VM, or
+  // cloning the compiled module for a per-worker VM.
+  void onVmCreateTime(std::chrono::milliseconds create_time) {
+    lifecycle_stats_.create_time_ms_.recordValue(create_time.count());
+  }
+
   static int64_t getActiveVmCount();
 
 protected:
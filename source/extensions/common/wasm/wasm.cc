@@ -272,7 +272,13 @@ getWasmHandleCloneFactory(Event::Dispatcher& dispatcher,
                           CreateContextFn create_root_context_for_testing) {
   return [&dispatcher, create_root_context_for_testing](
              WasmHandleBaseSharedPtr base_wasm) -> std::shared_ptr<WasmHandleBase> {
+    // Constructing the thread-local Wasm clones the base VM, which for engines that support
+    // compiled-module sharing reuses the base VM's executable code rather than re-JITing.
+    const MonotonicTime clone_start = dispatcher.timeSource().monotonicTime();
     auto wasm = std::make_shared<Wasm>(std::static_pointer_cast<WasmHandle>(base_wasm), dispatcher);
+    wasm->lifecycleStatsHandler().onVmCreateTime(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            dispatcher.timeSource().monotonicTime() - clone_start));
     wasm->setCreateContextForTesting(nullptr, create_root_context_for_testing);
     return std::static_pointer_cast<WasmHandleBase>(std::make_shared<WasmHandle>(std::move(wasm)));
   };
@@ -393,6 +399,7 @@ bool createWasm(const PluginSharedPtr& plugin, const Stats::ScopeSharedPtr& scop
     }
 
     auto config = plugin->wasmConfig();
+    const MonotonicTime create_start = dispatcher.timeSource().monotonicTime();
     auto wasm = proxy_wasm::createWasm(
         vm_key, code, plugin,
         getWasmHandleFactory(config, scope, api, cluster_manager, dispatcher, lifecycle_notifier),
@@ -406,6 +413,13 @@ bool createWasm(const PluginSharedPtr& plugin, const Stats::ScopeSharedPtr& scop
       cb(nullptr);
       return false;
     }
+    // This covers compiling and starting the base VM. If the vm_key matched an existing base VM
+    // the recorded time is just the lookup, which keeps the histogram honest about what this
+    // particular configuration load cost.
+    static_cast<Wasm*>(wasm->wasm().get())
+        ->lifecycleStatsHandler()
+        .onVmCreateTime(std::chrono::duration_cast<std::chrono::milliseconds>(
+            dispatcher.timeSource().monotonicTime() - create_start));
     cb(std::static_pointer_cast<WasmHandle>(wasm));
     return true;
   };
@@ -55,6 +55,7 @@ public:
   virtual void tickHandler(uint32_t root_context_id);
   std::shared_ptr<Wasm> sharedThis() { return std::static_pointer_cast<Wasm>(shared_from_this()); }
   Network::DnsResolverSharedPtr& dnsResolver() { return dns_resolver_; }
+  LifecycleStatsHandler& lifecycleStatsHandler() { return lifecycle_stats_handler_; }
 
   // WasmBase
   void error(std::string_view message) override;
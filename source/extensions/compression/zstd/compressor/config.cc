@@ -8,11 +8,13 @@ namespace Compressor {
 
 ZstdCompressorFactory::ZstdCompressorFactory(
     const envoy::extensions::compression::zstd::compressor::v3::Zstd& zstd,
-    Event::Dispatcher& dispatcher, Api::Api& api, ThreadLocal::SlotAllocator& tls)
+    Event::Dispatcher& dispatcher, Api::Api& api, ThreadLocal::SlotAllocator& tls,
+    Server::OverloadManager& overload_manager)
     : compression_level_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(zstd, compression_level, ZSTD_CLEVEL_DEFAULT)),
       enable_checksum_(zstd.enable_checksum()), strategy_(zstd.strategy()),
-      chunk_size_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(zstd, chunk_size, ZSTD_CStreamOutSize())) {
+      chunk_size_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(zstd, chunk_size, ZSTD_CStreamOutSize())),
+      overload_manager_(overload_manager) {
   if (zstd.has_dictionary()) {
     Protobuf::RepeatedPtrField<envoy::config::core::v3::DataSource> dictionaries;
     dictionaries.Add()->CopyFrom(zstd.dictionary());
@@ -24,9 +26,23 @@ ZstdCompressorFactory::ZstdCompressorFactory(
   }
 }
 
+uint32_t ZstdCompressorFactory::effectiveCompressionLevel() const {
+  const auto& action_state = overload_manager_.getThreadLocalOverloadState().getState(
+      Server::OverloadActionNames::get().ReduceCompressionLevel);
+  const float pressure = action_state.value().value();
+  if (pressure == 0.0f) {
+    return compression_level_;
+  }
+  // Interpolate between the configured level and the fastest level (1) as pressure rises, so a
+  // fully saturated action compresses at level 1.
+  return std::max<uint32_t>(
+      1, compression_level_ -
+             static_cast<uint32_t>(pressure * static_cast<float>(compression_level_ - 1)));
+}
+
 Envoy::Compression::Compressor::CompressorPtr ZstdCompressorFactory::createCompressor() {
-  return std::make_unique<ZstdCompressorImpl>(compression_level_, enable_checksum_, strategy_,
-                                              cdict_manager_, chunk_size_);
+  return std::make_unique<ZstdCompressorImpl>(effectiveCompressionLevel(), enable_checksum_,
+                                              strategy_, cdict_manager_, chunk_size_);
 }
 
 Envoy::Compression::Compressor::CompressorFactoryPtr
@@ -34,7 +50,8 @@ ZstdCompressorLibraryFactory::createCompressorFactoryFromProtoTyped(
     const envoy::extensions::compression::zstd::compressor::v3::Zstd& proto_config,
     Server::Configuration::FactoryContext& context) {
   return std::make_unique<ZstdCompressorFactory>(proto_config, context.mainThreadDispatcher(),
-                                                 context.api(), context.threadLocal());
+                                                 context.api(), context.threadLocal(),
+                                                 context.overloadManager());
 }
 
 /**
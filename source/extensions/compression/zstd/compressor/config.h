@@ -3,6 +3,7 @@
 #include "envoy/compression/compressor/factory.h"
 #include "envoy/extensions/compression/zstd/compressor/v3/zstd.pb.h"
 #include "envoy/extensions/compression/zstd/compressor/v3/zstd.pb.validate.h"
+#include "envoy/server/overload/overload_manager.h"
 
 #include "source/common/http/headers.h"
 #include "source/extensions/compression/common/compressor/factory_base.h"
@@ -27,7 +28,8 @@ class ZstdCompressorFactory : public Envoy::Compression::Compressor::CompressorF
 public:
   ZstdCompressorFactory(const envoy::extensions::compression::zstd::compressor::v3::Zstd& zstd,
                         Event::Dispatcher& dispatcher, Api::Api& api,
-                        ThreadLocal::SlotAllocator& tls);
+                        ThreadLocal::SlotAllocator& tls,
+                        Server::OverloadManager& overload_manager);
 
   // Envoy::Compression::Compressor::CompressorFactory
   Envoy::Compression::Compressor::CompressorPtr createCompressor() override;
@@ -37,11 +39,16 @@ public:
   }
 
 private:
+  // The compression level used for new compressors, scaled down towards the fastest level by the
+  // reduce_compression_level overload action state on the calling worker.
+  uint32_t effectiveCompressionLevel() const;
+
   const uint32_t compression_level_;
   const bool enable_checksum_;
   const uint32_t strategy_;
   const uint32_t chunk_size_;
   ZstdCDictManagerPtr cdict_manager_{nullptr};
+  Server::OverloadManager& overload_manager_;
 };
 
 class ZstdCompressorLibraryFactory
@@ -111,6 +111,16 @@ void DeltaSubscriptionState::updateSubscriptionInterest(
 
 // Not having sent any requests yet counts as an "update pending" since you're supposed to resend
 // the entirety of your interest at the start of a stream, even if nothing has changed.
+absl::flat_hash_set<std::string> DeltaSubscriptionState::requestedResourceNames() const {
+  absl::flat_hash_set<std::string> names;
+  names.reserve(requested_resource_state_.size());
+  for (const auto& [name, resource_state] : requested_resource_state_) {
+    UNREFERENCED_PARAMETER(resource_state);
+    names.insert(name);
+  }
+  return names;
+}
+
 bool DeltaSubscriptionState::subscriptionUpdatePending() const {
   if (!names_added_.empty() || !names_removed_.empty()) {
     return true;
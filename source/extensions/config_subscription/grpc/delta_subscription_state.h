@@ -91,6 +91,12 @@ public:
 
   void markStreamFresh() { any_request_sent_yet_in_current_stream_ = false; }
 
+  // The names of the resources we are explicitly interested in, for use when loading locally
+  // persisted resources. For wildcard subscriptions this is either empty (a legacy wildcard
+  // subscription that has not sent a request yet) or contains the wildcard entry; both match the
+  // wildcard convention of XdsResourcesDelegate::getResources().
+  absl::flat_hash_set<std::string> requestedResourceNames() const;
+
   UpdateAck handleResponse(const envoy::service::discovery::v3::DeltaDiscoveryResponse& message);
 
   void handleEstablishmentFailure();
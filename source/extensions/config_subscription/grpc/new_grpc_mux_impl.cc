@@ -12,6 +12,7 @@
 #include "source/common/protobuf/protobuf.h"
 #include "source/common/protobuf/utility.h"
 #include "source/extensions/config_subscription/grpc/eds_resources_cache_impl.h"
+#include "source/extensions/config_subscription/grpc/xds_source_id.h"
 
 namespace Envoy {
 namespace Config {
@@ -49,6 +50,8 @@ NewGrpcMuxImpl::NewGrpcMuxImpl(GrpcMuxContext& grpc_mux_context)
               })),
       dispatcher_(grpc_mux_context.dispatcher_),
       xds_config_tracker_(grpc_mux_context.xds_config_tracker_),
+      xds_resources_delegate_(grpc_mux_context.xds_resources_delegate_),
+      target_xds_authority_(grpc_mux_context.target_xds_authority_),
       eds_resources_cache_(std::move(grpc_mux_context.eds_resources_cache_)) {
   AllMuxes::get().insert(this);
 }
@@ -110,13 +113,43 @@ void NewGrpcMuxImpl::onDiscoveryResponse(
     }
   }
 
-  auto ack = sub->second->sub_state_.handleResponse(*message);
+  // Hold a reference rather than the iterator: processing the response can add new subscriptions
+  // (e.g. a CDS update starting EDS subscriptions), which invalidates iterators into
+  // subscriptions_. The SubscriptionStuff itself is never erased, so the reference stays valid.
+  SubscriptionStuff& subscription = *sub->second;
+
+  auto ack = subscription.sub_state_.handleResponse(*message);
 
   // Processing point to record error if there is any failure after the response is processed.
   if (xds_config_tracker_.has_value() &&
       ack.error_detail_.code() != Grpc::Status::WellKnownGrpcStatus::Ok) {
     xds_config_tracker_->onConfigRejected(*message, ack.error_detail_.message());
   }
+  if (ack.error_detail_.code() == Grpc::Status::WellKnownGrpcStatus::Ok) {
+    subscription.previously_fetched_data_ = true;
+    if (xds_resources_delegate_.has_value()) {
+      // The update was applied, so hand the resources to the xDS resources delegate for local
+      // persistence before the ACK goes out.
+      std::vector<envoy::service::discovery::v3::Resource> added_resources;
+      added_resources.reserve(message->resources().size());
+      for (const auto& resource : message->resources()) {
+        // Only entries carrying a resource payload can be persisted; this skips heartbeats and
+        // alias-only entries.
+        if (resource.has_resource()) {
+          added_resources.push_back(resource);
+        }
+      }
+      const XdsConfigSourceId source_id{target_xds_authority_, message->type_url()};
+      TRY_ASSERT_MAIN_THREAD {
+        xds_resources_delegate_->onConfigUpdated(source_id, added_resources,
+                                                 message->removed_resources());
+      }
+      END_TRY
+      catch (const EnvoyException& e) {
+        ENVOY_LOG(warn, "Failed to persist config update for {}: {}", source_id.toKey(), e.what());
+      }
+    }
+  }
   kickOffAck(ack);
   Memory::Utils::tryShrinkHeap();
 }
@@ -148,6 +181,54 @@ void NewGrpcMuxImpl::onEstablishmentFailure() {
       }
     }
   } while (all_subscribed.size() != subscriptions_.size());
+
+  if (!xds_resources_delegate_.has_value()) {
+    return;
+  }
+  // On the initialization of the mux, if connection to the xDS server fails, load locally
+  // persisted config, if available. It will be used until connectivity is established with the
+  // xDS server. Delivering loaded config can add new subscriptions (e.g. loaded clusters start
+  // EDS subscriptions), so iterate over a snapshot of the type_urls; subscriptions added along
+  // the way get their turn on the next establishment failure.
+  std::vector<std::string> subscribed_type_urls;
+  subscribed_type_urls.reserve(subscriptions_.size());
+  for (const auto& [type_url, subscription] : subscriptions_) {
+    UNREFERENCED_PARAMETER(subscription);
+    subscribed_type_urls.push_back(type_url);
+  }
+  for (const std::string& type_url : subscribed_type_urls) {
+    auto sub = subscriptions_.find(type_url);
+    if (sub != subscriptions_.end() && !sub->second->previously_fetched_data_) {
+      loadConfigFromDelegate(type_url, *sub->second);
+      sub->second->previously_fetched_data_ = true;
+    }
+  }
+}
+
+void NewGrpcMuxImpl::loadConfigFromDelegate(const std::string& type_url,
+                                            SubscriptionStuff& subscription) {
+  const XdsConfigSourceId source_id{target_xds_authority_, type_url};
+  TRY_ASSERT_MAIN_THREAD {
+    const std::vector<envoy::service::discovery::v3::Resource> resources =
+        xds_resources_delegate_->getResources(source_id,
+                                              subscription.sub_state_.requestedResourceNames());
+    if (resources.empty()) {
+      // There are no persisted resources, so nothing to process.
+      return;
+    }
+    Protobuf::RepeatedPtrField<envoy::service::discovery::v3::Resource> added_resources;
+    added_resources.Reserve(resources.size());
+    for (const auto& resource : resources) {
+      added_resources.Add()->CopyFrom(resource);
+    }
+    const Protobuf::RepeatedPtrField<std::string> removed_resources;
+    subscription.watch_map_.onConfigUpdate(added_resources, removed_resources, "");
+  }
+  END_TRY
+  catch (const EnvoyException& e) {
+    // TODO(abeyad): do something else here?
+    ENVOY_LOG(warn, "Failed to load config from delegate for {}: {}", source_id.toKey(), e.what());
+  }
 }
 
 void NewGrpcMuxImpl::onWriteable() { trySendDiscoveryRequests(); }
@@ -347,7 +428,8 @@ public:
          const envoy::config::core::v3::ApiConfigSource& ads_config,
          const LocalInfo::LocalInfo& local_info, CustomConfigValidatorsPtr&& config_validators,
          BackOffStrategyPtr&& backoff_strategy, XdsConfigTrackerOptRef xds_config_tracker,
-         OptRef<XdsResourcesDelegate>, bool use_eds_resources_cache) override {
+         OptRef<XdsResourcesDelegate> xds_resources_delegate,
+         bool use_eds_resources_cache) override {
     GrpcMuxContext grpc_mux_context{
         /*async_client_=*/std::move(async_client),
         /*dispatcher_=*/dispatcher,
@@ -358,10 +440,10 @@ public:
         /*rate_limit_settings_=*/Utility::parseRateLimitSettings(ads_config),
         /*scope_=*/scope,
         /*config_validators_=*/std::move(config_validators),
-        /*xds_resources_delegate_=*/absl::nullopt,
+        /*xds_resources_delegate_=*/xds_resources_delegate,
         /*xds_config_tracker_=*/xds_config_tracker,
         /*backoff_strategy_=*/std::move(backoff_strategy),
-        /*target_xds_authority_=*/"",
+        /*target_xds_authority_=*/Config::Utility::getGrpcControlPlane(ads_config).value_or(""),
         /*eds_resources_cache_=*/
         (use_eds_resources_cache &&
          Runtime::runtimeFeatureEnabled("envoy.restart_features.use_eds_cache_for_ads"))
@@ -8,6 +8,7 @@
 #include "envoy/config/grpc_mux.h"
 #include "envoy/config/subscription.h"
 #include "envoy/config/xds_config_tracker.h"
+#include "envoy/config/xds_resources_delegate.h"
 #include "envoy/service/discovery/v3/discovery.pb.h"
 
 #include "source/common/common/logger.h"
@@ -101,6 +102,9 @@ public:
     WatchMap watch_map_;
     DeltaSubscriptionState sub_state_;
     std::string control_plane_identifier_{};
+    // True iff an update for this subscription was successfully processed, or locally persisted
+    // config was already loaded from the xDS resources delegate.
+    bool previously_fetched_data_{false};
 
     SubscriptionStuff(const SubscriptionStuff&) = delete;
     SubscriptionStuff& operator=(const SubscriptionStuff&) = delete;
@@ -169,6 +173,12 @@ private:
   // Invoked when dynamic context parameters change for a resource type.
   void onDynamicContextUpdate(absl::string_view resource_type_url);
 
+  // Loads the locally persisted resources for the subscription from the xDS resources delegate,
+  // if one is configured, and delivers them to the subscription's watchers. Used to warm-start
+  // from a snapshot when the xDS server can't be reached on startup; the loaded config is used
+  // until connectivity is established.
+  void loadConfigFromDelegate(const std::string& type_url, SubscriptionStuff& subscription);
+
   // Resource (N)ACKs we're waiting to send, stored in the order that they should be sent in. All
   // of our different resource types' ACKs are mixed together in this queue. See class for
   // description of how it interacts with pause() and resume().
@@ -190,6 +200,8 @@ private:
   Common::CallbackHandlePtr dynamic_update_callback_handle_;
   Event::Dispatcher& dispatcher_;
   XdsConfigTrackerOptRef xds_config_tracker_;
+  XdsResourcesDelegateOptRef xds_resources_delegate_;
+  const std::string target_xds_authority_;
   EdsResourcesCachePtr eds_resources_cache_;
 
   // True iff Envoy is shutting down; no messages should be sent on the `grpc_stream_` when this is
@@ -1,5 +1,6 @@
 #include "source/extensions/filters/common/local_ratelimit/local_ratelimit_impl.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include "envoy/runtime/runtime.h"
@@ -7,6 +8,8 @@
 #include "source/common/protobuf/utility.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/inlined_vector.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace Filters {
@@ -82,6 +85,14 @@ LocalRateLimiterImpl::LocalRateLimiterImpl(
                 const int b_token_fill_per_second = tokensFillPerSecond(b);
                 return a_token_fill_per_second < b_token_fill_per_second;
               });
+    // Record the consumption order on each descriptor and rebuild the hash set with it so that
+    // requestAllowed() can hash-match the request descriptors and still consume tokens in sorted
+    // order. The token states are shared pointers, so the rebuilt copies charge the same buckets.
+    descriptors_.clear();
+    for (uint64_t i = 0; i < sorted_descriptors_.size(); ++i) {
+      sorted_descriptors_[i].consume_order_ = i;
+      descriptors_.insert(sorted_descriptors_[i]);
+    }
   }
 }
 
@@ -179,16 +190,26 @@ bool LocalRateLimiterImpl::requestAllowed(
   // their tokens.
   bool matched_descriptor = false;
   if (!descriptors_.empty() && !request_descriptors.empty()) {
-    for (const auto& descriptor : sorted_descriptors_) {
-      for (const auto& request_descriptor : request_descriptors) {
-        if (descriptor == request_descriptor) {
-          matched_descriptor = true;
-          // Descriptor token is not enough.
-          if (!requestAllowedHelper(*descriptor.token_state_)) {
-            return false;
-          }
-          break;
-        }
+    // Hash-match each request descriptor against the configured set instead of scanning the
+    // configured list, then charge the matches from strictest to loosest per the order computed
+    // at construction. Duplicate request descriptors charge their bucket only once.
+    absl::InlinedVector<const LocalDescriptorImpl*, 8> matched;
+    for (const auto& request_descriptor : request_descriptors) {
+      auto it = descriptors_.find(request_descriptor);
+      if (it != descriptors_.end() &&
+          std::find(matched.begin(), matched.end(), &*it) == matched.end()) {
+        matched.push_back(&*it);
+      }
+    }
+    std::sort(matched.begin(), matched.end(),
+              [](const LocalDescriptorImpl* a, const LocalDescriptorImpl* b) {
+                return a->consume_order_ < b->consume_order_;
+              });
+    for (const LocalDescriptorImpl* descriptor : matched) {
+      matched_descriptor = true;
+      // Descriptor token is not enough.
+      if (!requestAllowedHelper(*descriptor->token_state_)) {
+        return false;
       }
     }
   }
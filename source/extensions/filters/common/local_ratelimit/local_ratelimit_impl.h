@@ -47,6 +47,9 @@ private:
     // refill interval is 50ms, the value is 3. Every 3rd invocation of
     // the global timer, the descriptor is refilled.
     uint64_t multiplier_;
+    // Position in the tokens-per-second order computed at construction. Lower values are consumed
+    // first so that the strictest matched descriptor is charged before looser ones.
+    uint64_t consume_order_{0};
     std::string toString() const {
       std::vector<std::string> entries;
       entries.reserve(entries_.size());
@@ -51,20 +51,49 @@ void Coroutine::resume(int num_args, const std::function<void()>& yield_callback
   }
 }
 
+bool Coroutine::reset() {
+  if (state_ != State::Finished || lua_status(coroutine_state_.get()) != 0) {
+    return false;
+  }
+
+  // A coroutine that ran to completion without error can run a new function: clear any return
+  // values left on the thread's stack and the next start() call will push the function to run.
+  lua_settop(coroutine_state_.get(), 0);
+  state_ = State::NotStarted;
+  return true;
+}
+
 ThreadLocalState::ThreadLocalState(const std::string& code, ThreadLocal::SlotAllocator& tls)
     : tls_slot_(ThreadLocal::TypedSlot<LuaThreadLocal>::makeUnique(tls)) {
 
-  // First verify that the supplied code can be parsed.
+  // Compile the supplied code once here, both to verify that it can be parsed and so that each
+  // worker loads the precompiled bytecode instead of re-parsing the source.
   CSmartPtr<lua_State, lua_close> state(luaL_newstate());
   RELEASE_ASSERT(state.get() != nullptr, "unable to create new Lua state object");
   luaL_openlibs(state.get());
 
-  if (0 != luaL_dostring(state.get(), code.c_str())) {
+  if (0 != luaL_loadstring(state.get(), code.c_str())) {
+    throw LuaException(fmt::format("script load error: {}", lua_tostring(state.get(), -1)));
+  }
+
+  std::string bytecode;
+  const int dump_rc = lua_dump(
+      state.get(),
+      [](lua_State*, const void* data, size_t size, void* user_data) -> int {
+        static_cast<std::string*>(user_data)->append(static_cast<const char*>(data), size);
+        return 0;
+      },
+      &bytecode);
+  RELEASE_ASSERT(dump_rc == 0, "unable to dump Lua bytecode");
+
+  // Also run the chunk so that runtime errors during load surface here and not on the workers.
+  if (0 != lua_pcall(state.get(), 0, 0, 0)) {
     throw LuaException(fmt::format("script load error: {}", lua_tostring(state.get(), -1)));
   }
 
   // Now initialize on all threads.
-  tls_slot_->set([code](Event::Dispatcher&) { return std::make_shared<LuaThreadLocal>(code); });
+  tls_slot_->set(
+      [bytecode](Event::Dispatcher&) { return std::make_shared<LuaThreadLocal>(bytecode); });
 }
 
 int ThreadLocalState::getGlobalRef(uint64_t slot) {
@@ -93,16 +122,32 @@ uint64_t ThreadLocalState::registerGlobal(const std::string& global,
 }
 
 CoroutinePtr ThreadLocalState::createCoroutine() {
-  lua_State* state = tlsState().get();
+  LuaThreadLocal& tls = **tls_slot_;
+  if (!tls.coroutine_pool_.empty()) {
+    CoroutinePtr coroutine = std::move(tls.coroutine_pool_.back());
+    tls.coroutine_pool_.pop_back();
+    return coroutine;
+  }
+
+  lua_State* state = tls.state_.get();
   return std::make_unique<Coroutine>(std::make_pair(lua_newthread(state), state));
 }
 
-ThreadLocalState::LuaThreadLocal::LuaThreadLocal(const std::string& code)
+void ThreadLocalState::recycleCoroutine(CoroutinePtr&& coroutine) {
+  LuaThreadLocal& tls = **tls_slot_;
+  if (tls.coroutine_pool_.size() < MaxCoroutinePoolSize && coroutine->reset()) {
+    tls.coroutine_pool_.push_back(std::move(coroutine));
+  }
+}
+
+ThreadLocalState::LuaThreadLocal::LuaThreadLocal(const std::string& bytecode)
     : state_(luaL_newstate()) {
 
   RELEASE_ASSERT(state_.get() != nullptr, "unable to create new Lua state object");
   luaL_openlibs(state_.get());
-  int rc = luaL_dostring(state_.get(), code.c_str());
+  int rc = luaL_loadbuffer(state_.get(), bytecode.data(), bytecode.size(), "<precompiled>");
+  ASSERT(rc == 0);
+  rc = lua_pcall(state_.get(), 0, 0, 0);
   ASSERT(rc == 0);
 }
 
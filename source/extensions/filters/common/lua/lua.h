@@ -373,6 +373,13 @@ public:
    */
   void resume(int num_args, const std::function<void()>& yield_callback);
 
+  /**
+   * Return the coroutine to its pristine state so that start() can be called again with a new
+   * function. This is only possible for a coroutine that ran to completion without error.
+   * @return whether the coroutine was reset and can be reused.
+   */
+  bool reset();
+
 private:
   LuaRef<lua_State> coroutine_state_;
   State state_{State::NotStarted};
@@ -392,10 +399,19 @@ public:
   ThreadLocalState(const std::string& code, ThreadLocal::SlotAllocator& tls);
 
   /**
-   * @return CoroutinePtr a new coroutine.
+   * @return CoroutinePtr a coroutine, either recycled from the pool of previously finished
+   *         coroutines on this worker or newly created.
    */
   CoroutinePtr createCoroutine();
 
+  /**
+   * Hand a coroutine back for reuse by a later createCoroutine() call on the same worker.
+   * Coroutines that did not run to completion (e.g., yielded when the stream was reset, or
+   * errored) cannot be restarted and are destroyed instead of pooled.
+   * @param coroutine supplies the coroutine to recycle.
+   */
+  void recycleCoroutine(CoroutinePtr&& coroutine);
+
   /**
    * @return a global reference previously registered via registerGlobal(). This may return
    *         LUA_REFNIL if there was no such global.
@@ -436,12 +452,17 @@ public:
 
 private:
   struct LuaThreadLocal : public ThreadLocal::ThreadLocalObject {
-    LuaThreadLocal(const std::string& code);
+    LuaThreadLocal(const std::string& bytecode);
 
     CSmartPtr<lua_State, lua_close> state_;
     std::vector<int> global_slots_;
+    std::vector<CoroutinePtr> coroutine_pool_;
   };
 
+  // Cap on the number of finished coroutines kept for reuse on each worker. Beyond this the
+  // recycled coroutine is destroyed and its thread left to the GC.
+  static constexpr size_t MaxCoroutinePoolSize = 16;
+
   CSmartPtr<lua_State, lua_close>& tlsState() { return (*tls_slot_)->state_; }
 
   ThreadLocal::TypedSlotPtr<LuaThreadLocal> tls_slot_;
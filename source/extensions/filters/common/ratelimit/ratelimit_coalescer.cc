@@ -0,0 +1,215 @@
+#include "source/extensions/filters/common/ratelimit/ratelimit_coalescer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "source/common/common/assert.h"
+#include "source/common/http/header_map_impl.h"
+#include "source/common/http/headers.h"
+#include "source/extensions/filters/common/ratelimit/ratelimit_impl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace Filters {
+namespace Common {
+namespace RateLimit {
+namespace {
+
+// Delivers one waiter's verdict. complete() takes ownership of its arguments, so each waiter gets
+// fresh copies built from the shared response.
+void completeWaiter(RequestCallbacks& callbacks, LimitStatus status,
+                    const envoy::service::ratelimit::v3::RateLimitResponse* response) {
+  if (response == nullptr) {
+    callbacks.complete(LimitStatus::Error, nullptr, nullptr, nullptr, EMPTY_STRING, nullptr);
+    return;
+  }
+
+  Http::ResponseHeaderMapPtr response_headers_to_add;
+  Http::RequestHeaderMapPtr request_headers_to_add;
+  if (!response->response_headers_to_add().empty()) {
+    response_headers_to_add = Http::ResponseHeaderMapImpl::create();
+    for (const auto& h : response->response_headers_to_add()) {
+      response_headers_to_add->addCopy(Http::LowerCaseString(h.key()), h.value());
+    }
+  }
+
+  if (!response->request_headers_to_add().empty()) {
+    request_headers_to_add = Http::RequestHeaderMapImpl::create();
+    for (const auto& h : response->request_headers_to_add()) {
+      request_headers_to_add->addCopy(Http::LowerCaseString(h.key()), h.value());
+    }
+  }
+
+  DescriptorStatusListPtr descriptor_statuses = std::make_unique<DescriptorStatusList>(
+      response->statuses().begin(), response->statuses().end());
+  DynamicMetadataPtr dynamic_metadata =
+      response->has_dynamic_metadata()
+          ? std::make_unique<ProtobufWkt::Struct>(response->dynamic_metadata())
+          : nullptr;
+  callbacks.complete(status, std::move(descriptor_statuses), std::move(response_headers_to_add),
+                     std::move(request_headers_to_add), response->raw_body(),
+                     std::move(dynamic_metadata));
+}
+
+} // namespace
+
+void Coalescer::Batch::onSuccess(
+    std::unique_ptr<envoy::service::ratelimit::v3::RateLimitResponse>&& response,
+    Tracing::Span& span) {
+  parent_.onRpcComplete(*this, std::move(response), span);
+}
+
+void Coalescer::Batch::onFailure(Grpc::Status::GrpcStatus status, const std::string& msg,
+                                 Tracing::Span& span) {
+  ASSERT(status != Grpc::Status::WellKnownGrpcStatus::Ok);
+  ENVOY_LOG_TO_LOGGER(Logger::Registry::getLog(Logger::Id::filter), debug,
+                      "rate limit fail, status={} msg={}", status, msg);
+  parent_.onRpcComplete(*this, nullptr, span);
+}
+
+Coalescer::Coalescer(const absl::optional<std::chrono::milliseconds>& timeout)
+    : timeout_(timeout),
+      service_method_(*Protobuf::DescriptorPool::generated_pool()->FindMethodByName(
+          "envoy.service.ratelimit.v3.RateLimitService.ShouldRateLimit")) {}
+
+void Coalescer::limit(CoalescingClientImpl& handle, RequestCallbacks& callbacks,
+                      const std::string& domain,
+                      const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+                      Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+                      uint32_t hits_addend) {
+  envoy::service::ratelimit::v3::RateLimitRequest request;
+  GrpcClientImpl::createRequest(request, domain, descriptors, hits_addend);
+
+  // Key on everything but the hits so queued hits can be folded into one hits_addend.
+  envoy::service::ratelimit::v3::RateLimitRequest key_request = request;
+  key_request.set_hits_addend(0);
+  std::string key = key_request.SerializeAsString();
+
+  auto waiter = std::make_unique<Waiter>(
+      Waiter{&handle, &callbacks, &parent_span, &stream_info, effectiveHits(hits_addend)});
+  handle.waiter_ = waiter.get();
+  handle.key_ = key;
+
+  Flight& flight = flights_[key];
+  if (flight.current_ == nullptr) {
+    ASSERT(flight.queued_.empty());
+    auto batch = std::make_unique<Batch>(*this, key, handle.async_client_);
+    batch->waiters_.push_back(std::move(waiter));
+    sendBatch(key, std::move(batch), request, parent_span);
+    return;
+  }
+  if (flight.queued_.empty()) {
+    flight.queued_request_ = std::move(request);
+  }
+  flight.queued_.push_back(std::move(waiter));
+}
+
+void Coalescer::cancel(CoalescingClientImpl& handle) {
+  ASSERT(handle.waiter_ != nullptr);
+  auto it = flights_.find(handle.key_);
+  ASSERT(it != flights_.end());
+  Flight& flight = it->second;
+
+  auto remove = [&handle](std::vector<WaiterPtr>& waiters) {
+    for (auto waiter = waiters.begin(); waiter != waiters.end(); ++waiter) {
+      if ((*waiter)->handle_ == &handle) {
+        waiters.erase(waiter);
+        return true;
+      }
+    }
+    return false;
+  };
+  if (flight.current_ == nullptr || !remove(flight.current_->waiters_)) {
+    const bool removed = remove(flight.queued_);
+    ASSERT(removed);
+  }
+  handle.waiter_ = nullptr;
+  // The in-flight RPC, if any, is left to complete; see the interface comment.
+  if (flight.current_ == nullptr && flight.queued_.empty()) {
+    flights_.erase(it);
+  }
+}
+
+void Coalescer::sendBatch(const std::string& key, BatchPtr batch,
+                          const envoy::service::ratelimit::v3::RateLimitRequest& request,
+                          Tracing::Span& parent_span) {
+  Batch& active = *batch;
+  const StreamInfo::StreamInfo& stream_info = *active.waiters_.front()->stream_info_;
+  flights_[key].current_ = std::move(batch);
+  // NOTE: the send may complete inline on immediate failure, in which case onRpcComplete() has
+  // already destroyed the batch by the time send() returns; nothing may touch it afterwards.
+  active.client_.send(service_method_, request, active, parent_span,
+                      Http::AsyncClient::RequestOptions().setTimeout(timeout_).setParentContext(
+                          Http::AsyncClient::ParentContext{&stream_info}));
+}
+
+void Coalescer::onRpcComplete(
+    Batch& batch, std::unique_ptr<envoy::service::ratelimit::v3::RateLimitResponse>&& response,
+    Tracing::Span& span) {
+  auto it = flights_.find(batch.key_);
+  ASSERT(it != flights_.end() && it->second.current_.get() == &batch);
+  Flight& flight = it->second;
+  BatchPtr completed = std::move(flight.current_);
+
+  LimitStatus status = LimitStatus::Error;
+  if (response != nullptr) {
+    ASSERT(response->overall_code() != envoy::service::ratelimit::v3::RateLimitResponse::UNKNOWN);
+    if (response->overall_code() == envoy::service::ratelimit::v3::RateLimitResponse::OVER_LIMIT) {
+      status = LimitStatus::OverLimit;
+      span.setTag(Constants::get().TraceStatus, Constants::get().TraceOverLimit);
+    } else {
+      status = LimitStatus::OK;
+      span.setTag(Constants::get().TraceStatus, Constants::get().TraceOk);
+    }
+  }
+
+  // Launch the follow-up RPC for queued arrivals before fanning the verdict out, so re-entrant
+  // limit() calls made from complete() observe the flight and queue behind it rather than racing
+  // ahead of it. The follow-up carries the sum of the queued hits in hits_addend.
+  std::vector<WaiterPtr> queued = std::move(flight.queued_);
+  flight.queued_.clear();
+  if (queued.empty()) {
+    flights_.erase(it);
+  } else {
+    envoy::service::ratelimit::v3::RateLimitRequest next_request =
+        std::move(flight.queued_request_);
+    uint64_t hits = 0;
+    for (const WaiterPtr& waiter : queued) {
+      hits += waiter->hits_;
+    }
+    next_request.set_hits_addend(std::min<uint64_t>(hits, std::numeric_limits<uint32_t>::max()));
+    auto next = std::make_unique<Batch>(*this, batch.key_, completed->raw_client_);
+    next->waiters_ = std::move(queued);
+    Tracing::Span& next_span = *next->waiters_.front()->span_;
+    ENVOY_LOG(trace, "rate limit coalescer: folding {} waiters into one RPC, hits_addend={}",
+              next->waiters_.size(), hits);
+    sendBatch(completed->key_, std::move(next), next_request, next_span);
+  }
+
+  for (const WaiterPtr& waiter : completed->waiters_) {
+    waiter->handle_->waiter_ = nullptr;
+    completeWaiter(*waiter->callbacks_, status, response.get());
+  }
+}
+
+CoalescingClientImpl::~CoalescingClientImpl() { ASSERT(waiter_ == nullptr); }
+
+void CoalescingClientImpl::cancel() { coalescer_->cancel(*this); }
+
+void CoalescingClientImpl::limit(RequestCallbacks& callbacks, const std::string& domain,
+                                 const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+                                 Tracing::Span& parent_span,
+                                 const StreamInfo::StreamInfo& stream_info, uint32_t hits_addend) {
+  ASSERT(waiter_ == nullptr);
+  coalescer_->limit(*this, callbacks, domain, descriptors, parent_span, stream_info, hits_addend);
+}
+
+} // namespace RateLimit
+} // namespace Common
+} // namespace Filters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "envoy/grpc/async_client.h"
+#include "envoy/service/ratelimit/v3/rls.pb.h"
+#include "envoy/thread_local/thread_local_object.h"
+#include "envoy/tracing/tracer.h"
+
+#include "source/common/common/logger.h"
+#include "source/common/grpc/typed_async_client.h"
+#include "source/extensions/filters/common/ratelimit/ratelimit.h"
+
+#include "absl/container/flat_hash_map.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace Filters {
+namespace Common {
+namespace RateLimit {
+
+class CoalescingClientImpl;
+
+/**
+ * Coalesces ShouldRateLimit calls issued from a single worker thread. A call whose (domain,
+ * descriptors) tuple has no equivalent RPC in flight is sent immediately, so coalescing adds no
+ * latency while the rate limit service keeps up. Calls that arrive while an identical RPC is
+ * outstanding queue behind it; when the in-flight RPC completes its verdict is fanned out to the
+ * streams that rode on it, and a single follow-up RPC is sent for the whole queue with
+ * ``hits_addend`` equal to the sum of the queued hits, preserving exact accounting. Under load the
+ * rate limit service therefore sees at most one RPC per distinct descriptor tuple per round trip,
+ * instead of one per proxied request.
+ *
+ * The coalescer is per worker and not thread safe; one is installed in a thread local slot and
+ * shared by the CoalescingClientImpl handles created for each filter instance on that worker.
+ */
+class Coalescer : public ThreadLocal::ThreadLocalObject,
+                  public Logger::Loggable<Logger::Id::filter> {
+public:
+  explicit Coalescer(const absl::optional<std::chrono::milliseconds>& timeout);
+
+  /**
+   * Issues or queues a ShouldRateLimit call on behalf of a handle. At most one call per handle may
+   * be outstanding; the handle is detached again when the verdict is delivered or on cancel().
+   */
+  void limit(CoalescingClientImpl& handle, RequestCallbacks& callbacks, const std::string& domain,
+             const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+             Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+             uint32_t hits_addend);
+
+  /**
+   * Abandons the handle's outstanding call. The underlying RPC, if any, is left to complete: its
+   * hits are already being counted by the rate limit service and other streams may be riding on
+   * it; only this handle's callbacks are detached.
+   */
+  void cancel(CoalescingClientImpl& handle);
+
+private:
+  // One stream waiting for a verdict.
+  struct Waiter {
+    CoalescingClientImpl* handle_;
+    RequestCallbacks* callbacks_;
+    Tracing::Span* span_;
+    const StreamInfo::StreamInfo* stream_info_;
+    uint32_t hits_;
+  };
+  using WaiterPtr = std::unique_ptr<Waiter>;
+
+  // One outstanding RPC; receives the gRPC completion callbacks and carries the waiters whose
+  // verdict it resolves.
+  struct Batch
+      : public Grpc::AsyncRequestCallbacks<envoy::service::ratelimit::v3::RateLimitResponse> {
+    Batch(Coalescer& parent, std::string key, Grpc::RawAsyncClientSharedPtr raw_client)
+        : parent_(parent), key_(std::move(key)), raw_client_(raw_client), client_(raw_client) {}
+
+    // Grpc::AsyncRequestCallbacks
+    void onCreateInitialMetadata(Http::RequestHeaderMap&) override {}
+    void onSuccess(std::unique_ptr<envoy::service::ratelimit::v3::RateLimitResponse>&& response,
+                   Tracing::Span& span) override;
+    void onFailure(Grpc::Status::GrpcStatus status, const std::string& message,
+                   Tracing::Span& span) override;
+
+    Coalescer& parent_;
+    const std::string key_;
+    const Grpc::RawAsyncClientSharedPtr raw_client_;
+    Grpc::AsyncClient<envoy::service::ratelimit::v3::RateLimitRequest,
+                      envoy::service::ratelimit::v3::RateLimitResponse>
+        client_;
+    std::vector<WaiterPtr> waiters_;
+  };
+  using BatchPtr = std::unique_ptr<Batch>;
+
+  // Per descriptor tuple state: the in-flight RPC, if any, and the arrivals queued behind it that
+  // will be folded into one follow-up RPC.
+  struct Flight {
+    BatchPtr current_;
+    std::vector<WaiterPtr> queued_;
+    envoy::service::ratelimit::v3::RateLimitRequest queued_request_;
+  };
+
+  // The rate limit service treats an unset hits_addend as a single hit.
+  static uint32_t effectiveHits(uint32_t hits_addend) { return hits_addend == 0 ? 1 : hits_addend; }
+
+  void sendBatch(const std::string& key, BatchPtr batch,
+                 const envoy::service::ratelimit::v3::RateLimitRequest& request,
+                 Tracing::Span& parent_span);
+  void onRpcComplete(Batch& batch,
+                     std::unique_ptr<envoy::service::ratelimit::v3::RateLimitResponse>&& response,
+                     Tracing::Span& span);
+
+  const absl::optional<std::chrono::milliseconds> timeout_;
+  const Protobuf::MethodDescriptor& service_method_;
+  absl::flat_hash_map<std::string, Flight> flights_;
+
+  friend class CoalescingClientImpl;
+};
+
+using CoalescerSharedPtr = std::shared_ptr<Coalescer>;
+
+/**
+ * Per filter instance rate limit client handle that defers to the worker's shared Coalescer.
+ * Mirrors GrpcClientImpl's contract: one outstanding request, cancel() before destruction.
+ */
+class CoalescingClientImpl : public Client {
+public:
+  CoalescingClientImpl(CoalescerSharedPtr coalescer, Grpc::RawAsyncClientSharedPtr async_client)
+      : coalescer_(std::move(coalescer)), async_client_(std::move(async_client)) {}
+  ~CoalescingClientImpl() override;
+
+  // Filters::Common::RateLimit::Client
+  void cancel() override;
+  void limit(RequestCallbacks& callbacks, const std::string& domain,
+             const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+             Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+             uint32_t hits_addend = 0) override;
+
+private:
+  const CoalescerSharedPtr coalescer_;
+  const Grpc::RawAsyncClientSharedPtr async_client_;
+  // Set while a call is outstanding; owned by the coalescer, cleared by it on delivery or cancel.
+  Coalescer::Waiter* waiter_{};
+  std::string key_;
+
+  friend class Coalescer;
+};
+
+} // namespace RateLimit
+} // namespace Common
+} // namespace Filters
+} // namespace Extensions
+} // namespace Envoy
@@ -11,6 +11,60 @@ namespace Filters {
 namespace Common {
 namespace RBAC {
 
+namespace {
+
+// Attempts to prove that the given principal can only match when the downstream direct remote
+// address falls within a specific set of CIDR ranges, appending those ranges on success. This
+// holds for a plain direct_remote_ip principal, for an and_ids set containing such a principal
+// (the other conjuncts can only narrow the match), and for an or_ids set where every alternative
+// is itself provable.
+bool extractDirectRemoteIpRanges(const envoy::config::rbac::v3::Principal& principal,
+                                 std::vector<Network::Address::CidrRange>& ranges) {
+  switch (principal.identifier_case()) {
+  case envoy::config::rbac::v3::Principal::IdentifierCase::kDirectRemoteIp: {
+    auto range = Network::Address::CidrRange::create(principal.direct_remote_ip());
+    if (!range.isValid()) {
+      return false;
+    }
+    ranges.emplace_back(std::move(range));
+    return true;
+  }
+  case envoy::config::rbac::v3::Principal::IdentifierCase::kAndIds:
+    for (const auto& id : principal.and_ids().ids()) {
+      std::vector<Network::Address::CidrRange> conjunct_ranges;
+      if (extractDirectRemoteIpRanges(id, conjunct_ranges)) {
+        ranges.insert(ranges.end(), conjunct_ranges.begin(), conjunct_ranges.end());
+        return true;
+      }
+    }
+    return false;
+  case envoy::config::rbac::v3::Principal::IdentifierCase::kOrIds:
+    for (const auto& id : principal.or_ids().ids()) {
+      if (!extractDirectRemoteIpRanges(id, ranges)) {
+        return false;
+      }
+    }
+    return !principal.or_ids().ids().empty();
+  default:
+    return false;
+  }
+}
+
+// The policy's principal list has OR semantics, so the policy is only indexable if every
+// principal is provable.
+bool extractDirectRemoteIpRanges(
+    const Protobuf::RepeatedPtrField<envoy::config::rbac::v3::Principal>& principals,
+    std::vector<Network::Address::CidrRange>& ranges) {
+  for (const auto& principal : principals) {
+    if (!extractDirectRemoteIpRanges(principal, ranges)) {
+      return false;
+    }
+  }
+  return !principals.empty();
+}
+
+} // namespace
+
 Envoy::Matcher::ActionFactoryCb
 ActionFactory::createActionFactoryCb(const Protobuf::Message& config, ActionContext& context,
                                      ProtobufMessage::ValidationVisitor& validation_visitor) {
@@ -56,6 +110,20 @@ RoleBasedAccessControlEngineImpl::RoleBasedAccessControlEngineImpl(
     policies_.emplace(policy.first, std::make_unique<PolicyMatcher>(policy.second, builder_.get(),
                                                                     validation_visitor));
   }
+
+  // Compile the IP prefilter index over the policies whose principals are provably constrained to
+  // direct remote address ranges. See the comments on the members for how this is used.
+  std::vector<std::pair<std::string, std::vector<Network::Address::CidrRange>>> index_data;
+  for (const auto& policy : rules.policies()) {
+    std::vector<Network::Address::CidrRange> ranges;
+    if (extractDirectRemoteIpRanges(policy.second.principals(), ranges)) {
+      index_data.emplace_back(policy.first, std::move(ranges));
+      ip_indexed_policies_.insert(policy.first);
+    }
+  }
+  if (!index_data.empty()) {
+    policy_ip_index_ = std::make_unique<Network::LcTrie::LcTrie<std::string>>(index_data);
+  }
 }
 
 bool RoleBasedAccessControlEngineImpl::handleAction(const Network::Connection& connection,
@@ -91,7 +159,26 @@ bool RoleBasedAccessControlEngineImpl::checkPolicyMatch(
     const Envoy::Http::RequestHeaderMap& headers, std::string* effective_policy_id) const {
   bool matched = false;
 
+  // When the downstream direct remote address is a plain IP, the index tells us exactly which of
+  // the indexed policies can possibly match; the rest of the indexed policies are skipped. Unix
+  // domain sockets and internal addresses fall back to evaluating everything.
+  absl::flat_hash_set<std::string> candidates;
+  bool use_ip_index = false;
+  if (policy_ip_index_ != nullptr) {
+    const auto& address = info.downstreamAddressProvider().directRemoteAddress();
+    if (address != nullptr && address->ip() != nullptr) {
+      use_ip_index = true;
+      for (auto& name : policy_ip_index_->getData(address)) {
+        candidates.insert(std::move(name));
+      }
+    }
+  }
+
   for (const auto& policy : policies_) {
+    if (use_ip_index && ip_indexed_policies_.contains(policy.first) &&
+        !candidates.contains(policy.first)) {
+      continue;
+    }
     if (policy.second->matches(connection, headers, info)) {
       matched = true;
       if (effective_policy_id != nullptr) {
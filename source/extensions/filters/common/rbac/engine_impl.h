@@ -4,9 +4,12 @@
 
 #include "source/common/http/matching/data_impl.h"
 #include "source/common/matcher/matcher.h"
+#include "source/common/network/lc_trie.h"
 #include "source/extensions/filters/common/rbac/engine.h"
 #include "source/extensions/filters/common/rbac/matchers.h"
 
+#include "absl/container/flat_hash_set.h"
+
 #include "xds/type/matcher/v3/matcher.pb.h"
 
 namespace Envoy {
@@ -85,6 +88,14 @@ private:
 
   std::map<std::string, std::unique_ptr<PolicyMatcher>> policies_;
 
+  // Policies whose principals provably require the downstream direct remote address to fall
+  // within a specific set of CIDR ranges are additionally indexed by those ranges so that a
+  // request only evaluates the policies whose ranges contain its address. Policies with any
+  // other principal shape (headers, metadata, CEL conditions, ...) are not indexed and are
+  // always evaluated. Evaluation order (and thus the reported effective policy ID) is unchanged.
+  absl::flat_hash_set<std::string> ip_indexed_policies_;
+  std::unique_ptr<Network::LcTrie::LcTrie<std::string>> policy_ip_index_;
+
   Protobuf::Arena constant_arena_;
   Expr::BuilderPtr builder_;
 };
@@ -42,7 +42,9 @@ GradientControllerConfig::GradientControllerConfig(
       min_concurrency_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(proto_config.min_rtt_calc_params(), min_concurrency, 3)),
       min_rtt_buffer_pct_(
-          PROTOBUF_PERCENT_TO_DOUBLE_OR_DEFAULT(proto_config.min_rtt_calc_params(), buffer, 25)) {}
+          PROTOBUF_PERCENT_TO_DOUBLE_OR_DEFAULT(proto_config.min_rtt_calc_params(), buffer, 25)),
+      latency_sample_rate_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(proto_config.concurrency_limit_params(),
+                                                           latency_sample_rate, 1)) {}
 GradientController::GradientController(GradientControllerConfig config,
                                        Event::Dispatcher& dispatcher, Runtime::Loader&,
                                        const std::string& stats_prefix, Stats::Scope& scope,
@@ -206,6 +208,15 @@ void GradientController::recordLatencySample(MonotonicTime rq_send_time) {
     return;
   }
 
+  // Optionally thin out the samples feeding the concurrency limit calculation. A uniformly sampled
+  // subset leaves the quantile estimate largely unaffected while touching the histogram (and its
+  // lock) far less often. Every sample is recorded while measuring the minRTT so the measurement
+  // completes promptly and is not biased by subsampling.
+  const uint32_t sample_rate = config_.latencySampleRate();
+  if (sample_rate > 1 && !inMinRTTSamplingWindow() && random_.random() % sample_rate != 0) {
+    return;
+  }
+
   const std::chrono::microseconds rq_latency =
       std::chrono::duration_cast<std::chrono::microseconds>(time_source_.monotonicTime() -
                                                             rq_send_time);
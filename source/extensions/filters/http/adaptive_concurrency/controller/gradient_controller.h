@@ -72,6 +72,13 @@ public:
                                           min_rtt_aggregate_request_count_);
   }
 
+  // The rate is clamped to a minimum of 1 (record every request).
+  uint32_t latencySampleRate() const {
+    const uint64_t val = runtime_.snapshot().getInteger(RuntimeKeys::get().LatencySampleRateKey,
+                                                        latency_sample_rate_);
+    return std::max<uint32_t>(1, val);
+  }
+
   // The percentage is normalized to the range [0.0, 1.0].
   double sampleAggregatePercentile() const {
     const double val = runtime_.snapshot().getDouble(
@@ -115,6 +122,8 @@ private:
         "adaptive_concurrency.gradient_controller.min_concurrency";
     const std::string MinRTTBufferPercentKey =
         "adaptive_concurrency.gradient_controller.min_rtt_buffer";
+    const std::string LatencySampleRateKey =
+        "adaptive_concurrency.gradient_controller.latency_sample_rate";
   };
 
   using RuntimeKeys = ConstSingleton<RuntimeKeyValues>;
@@ -144,6 +153,9 @@ private:
 
   // The amount added to the measured minRTT as a hedge against natural variability in latency.
   const double min_rtt_buffer_pct_;
+
+  // Record roughly 1 out of every N latency samples outside of minRTT recalculation windows.
+  const uint32_t latency_sample_rate_;
 };
 using GradientControllerConfigSharedPtr = std::shared_ptr<GradientControllerConfig>;
 
@@ -1,6 +1,7 @@
 #include "source/extensions/filters/http/admission_control/admission_control.h"
 
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -86,6 +87,7 @@ Http::FilterHeadersStatus AdmissionControlFilter::decodeHeaders(Http::RequestHea
 
   if (config_->getController().averageRps() < config_->rpsThreshold()) {
     ENVOY_LOG(debug, "Current rps: {} is below rps_threshold: {}, continue");
+    stats_.rq_rejection_probability_.set(0);
     return Http::FilterHeadersStatus::Continue;
   }
 
@@ -170,11 +172,16 @@ bool AdmissionControlFilter::shouldRejectRequest() const {
     probability = std::pow(probability, 1.0 / aggression);
   }
   probability = std::min<double>(probability, config_->maxRejectionProbability());
+  probability = std::max(probability, 0.0);
+
+  // Expose the probability we are acting on as a percentage so external consumers (e.g.
+  // autoscalers) can observe how close the filter is to throttling.
+  stats_.rq_rejection_probability_.set(std::lround(100 * probability));
 
   // Choosing an accuracy of 4 significant figures for the probability.
   static constexpr uint64_t accuracy = 1e4;
   auto r = config_->random().random();
-  return (accuracy * std::max(probability, 0.0)) > (r % accuracy);
+  return (accuracy * probability) > (r % accuracy);
 }
 
 } // namespace AdmissionControl
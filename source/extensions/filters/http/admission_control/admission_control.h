@@ -32,16 +32,17 @@ namespace AdmissionControl {
 /**
  * All stats for the admission control filter.
  */
-#define ALL_ADMISSION_CONTROL_STATS(COUNTER)                                                       \
+#define ALL_ADMISSION_CONTROL_STATS(COUNTER, GAUGE)                                                \
   COUNTER(rq_rejected)                                                                             \
   COUNTER(rq_success)                                                                              \
-  COUNTER(rq_failure)
+  COUNTER(rq_failure)                                                                              \
+  GAUGE(rq_rejection_probability, NeverImport)
 
 /**
  * Wrapper struct for admission control filter stats. @see stats_macros.h
  */
 struct AdmissionControlStats {
-  ALL_ADMISSION_CONTROL_STATS(GENERATE_COUNTER_STRUCT)
+  ALL_ADMISSION_CONTROL_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT)
 };
 
 using AdmissionControlProto =
@@ -102,7 +103,8 @@ public:
 
 private:
   static AdmissionControlStats generateStats(Stats::Scope& scope, const std::string& prefix) {
-    return {ALL_ADMISSION_CONTROL_STATS(POOL_COUNTER_PREFIX(scope, prefix))};
+    return {ALL_ADMISSION_CONTROL_STATS(POOL_COUNTER_PREFIX(scope, prefix),
+                                        POOL_GAUGE_PREFIX(scope, prefix))};
   }
 
   bool shouldRejectRequest() const;
@@ -1,5 +1,6 @@
 #include "source/extensions/filters/http/admission_control/thread_local_controller.h"
 
+#include <algorithm>
 #include <cstdint>
 
 #include "envoy/common/pure.h"
@@ -11,44 +12,53 @@ namespace Extensions {
 namespace HttpFilters {
 namespace AdmissionControl {
 
-static constexpr std::chrono::seconds defaultHistoryGranularity{1};
-
 ThreadLocalControllerImpl::ThreadLocalControllerImpl(TimeSource& time_source,
                                                      std::chrono::seconds sampling_window)
-    : time_source_(time_source), sampling_window_(sampling_window) {}
+    : time_source_(time_source), buckets_(std::max<int64_t>(1, sampling_window.count())) {}
 
-uint32_t ThreadLocalControllerImpl::averageRps() const {
-  if (historical_data_.empty() || global_data_.requests == 0) {
-    return 0;
+ThreadLocalControllerImpl::RequestData ThreadLocalControllerImpl::requestCounts() {
+  const uint64_t now_sec = nowSeconds();
+  RequestData counts;
+  for (const Bucket& bucket : buckets_) {
+    if (bucket.second != Bucket::Unused && now_sec - bucket.second < buckets_.size()) {
+      counts.requests += bucket.data.requests;
+      counts.successes += bucket.data.successes;
+    }
   }
-  using std::chrono::seconds;
-  seconds secs = std::max(seconds(1), std::chrono::duration_cast<seconds>(ageOfOldestSample()));
-  return global_data_.requests / secs.count();
+  return counts;
 }
 
-void ThreadLocalControllerImpl::maybeUpdateHistoricalData() {
-  // Purge stale samples.
-  while (!historical_data_.empty() && ageOfOldestSample() >= sampling_window_) {
-    removeOldestSample();
+uint32_t ThreadLocalControllerImpl::averageRps() const {
+  // Mirroring the historical behavior of this function, samples are aggregated over the age of the
+  // oldest bucket that has not yet been recycled, even if it has aged out of the sampling window.
+  uint64_t oldest_sec = Bucket::Unused;
+  uint64_t requests = 0;
+  for (const Bucket& bucket : buckets_) {
+    if (bucket.second != Bucket::Unused) {
+      oldest_sec = std::min(oldest_sec, bucket.second);
+      requests += bucket.data.requests;
+    }
   }
-
-  // It's possible we purged stale samples from the history and are left with nothing, so it's
-  // necessary to add an empty entry. We will also need to roll over into a new entry in the
-  // historical data if we've exceeded the time specified by the granularity.
-  if (historical_data_.empty() || ageOfNewestSample() >= defaultHistoryGranularity) {
-    historical_data_.emplace_back(time_source_.monotonicTime(), RequestData());
+  if (requests == 0) {
+    return 0;
   }
+  const uint64_t age_sec = std::max<uint64_t>(1, nowSeconds() - oldest_sec);
+  return requests / age_sec;
 }
 
 void ThreadLocalControllerImpl::recordRequest(bool success) {
-  maybeUpdateHistoricalData();
+  const uint64_t now_sec = nowSeconds();
+  Bucket& bucket = buckets_[now_sec % buckets_.size()];
+
+  // Recycle the bucket if it last covered a previous trip around the ring.
+  if (bucket.second != now_sec) {
+    bucket.second = now_sec;
+    bucket.data = RequestData();
+  }
 
-  // The back of the deque will be the most recent samples.
-  ++historical_data_.back().second.requests;
-  ++global_data_.requests;
+  ++bucket.data.requests;
   if (success) {
-    ++historical_data_.back().second.successes;
-    ++global_data_.successes;
+    ++bucket.data.successes;
   }
 }
 
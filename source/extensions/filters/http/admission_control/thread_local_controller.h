@@ -1,5 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include "envoy/common/pure.h"
 #include "envoy/common/time.h"
 #include "envoy/http/codes.h"
@@ -44,8 +49,9 @@ public:
 
 /**
  * Thread-local object to track request counts and successes over a rolling time window. Request
- * data for the time window is kept recent via a circular buffer that phases out old request/success
- * counts when recording new samples.
+ * data is kept in a fixed ring of one bucket per second of the window. Buckets are recycled in
+ * place as time advances, so recording a sample never allocates and reading the window is a
+ * straight sum over the ring.
  *
  * This controller is thread-local so that we do not need to take any locks on the sample histories
  * to update them, at the cost of decreasing the number of samples.
@@ -61,55 +67,36 @@ public:
   void recordSuccess() override { recordRequest(true); }
   void recordFailure() override { recordRequest(false); }
 
-  RequestData requestCounts() override {
-    maybeUpdateHistoricalData();
-    return global_data_;
-  }
+  RequestData requestCounts() override;
 
   uint32_t averageRps() const override;
 
 private:
-  void recordRequest(bool success);
-
-  // Potentially remove any stale samples and record sample aggregates to the historical data.
-  void maybeUpdateHistoricalData();
-
-  // Returns the age of the oldest sample in the historical data.
-  std::chrono::microseconds ageOfOldestSample() const {
-    ASSERT(!historical_data_.empty());
-    using namespace std::chrono;
-    return duration_cast<microseconds>(time_source_.monotonicTime() -
-                                       historical_data_.front().first);
-  }
+  // A one-second bucket of request samples. The second it covers identifies whether it is still
+  // within the sampling window or is awaiting reuse.
+  struct Bucket {
+    // Sentinel second for a bucket that has never held samples.
+    static constexpr uint64_t Unused = std::numeric_limits<uint64_t>::max();
+
+    uint64_t second{Unused};
+    RequestData data;
+  };
 
-  // Returns the age of the newest sample in the historical data.
-  std::chrono::microseconds ageOfNewestSample() const {
-    ASSERT(!historical_data_.empty());
-    using namespace std::chrono;
-    return duration_cast<microseconds>(time_source_.monotonicTime() -
-                                       historical_data_.back().first);
-  }
+  void recordRequest(bool success);
 
-  // Removes the oldest sample in the historical data and reconciles the global data.
-  void removeOldestSample() {
-    ASSERT(!historical_data_.empty());
-    global_data_.successes -= historical_data_.front().second.successes;
-    global_data_.requests -= historical_data_.front().second.requests;
-    historical_data_.pop_front();
+  // Seconds since the monotonic clock epoch, used to assign samples to ring buckets.
+  uint64_t nowSeconds() const {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+               time_source_.monotonicTime().time_since_epoch())
+        .count();
   }
 
   TimeSource& time_source_;
 
-  // Stores samples from oldest (front) to newest (back). Since there is no need to read/modify
-  // entries that are not the oldest or newest (front/back), we can get away with using a deque
-  // which allocates memory in chunks and keeps most elements contiguous and cache-friendly.
-  std::deque<std::pair<MonotonicTime, RequestData>> historical_data_;
-
-  // Request data aggregated for the whole look-back window.
-  RequestData global_data_;
-
-  // The rolling time window size.
-  const std::chrono::seconds sampling_window_;
+  // Fixed ring of one bucket per second of the sampling window, indexed by the bucket's second
+  // modulo the ring size. Stale buckets are skipped on read and recycled on write, so there is no
+  // per-sample bookkeeping or purging.
+  std::vector<Bucket> buckets_;
 };
 
 } // namespace AdmissionControl
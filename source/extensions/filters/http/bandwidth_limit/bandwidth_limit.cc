@@ -6,6 +6,7 @@
 #include "envoy/http/codes.h"
 
 #include "source/common/http/utility.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/stats/timespan_impl.h"
 
 using envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit;
@@ -28,7 +29,8 @@ const Http::LowerCaseString DefaultResponseFilterDelayTrailer =
 } // namespace
 
 FilterConfig::FilterConfig(const BandwidthLimit& config, Stats::Scope& scope,
-                           Runtime::Loader& runtime, TimeSource& time_source, bool per_route)
+                           Runtime::Loader& runtime, TimeSource& time_source, bool per_route,
+                           ThreadLocal::SlotAllocator* tls)
     : runtime_(runtime), time_source_(time_source), enable_mode_(config.enable_mode()),
       limit_kbps_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, limit_kbps, 0)),
       fill_interval_(std::chrono::milliseconds(PROTOBUF_GET_MS_OR_DEFAULT(
@@ -66,6 +68,15 @@ FilterConfig::FilterConfig(const BandwidthLimit& config, Stats::Scope& scope,
   token_bucket_ = std::make_shared<SharedTokenBucketImpl>(
       StreamRateLimiter::kiloBytesToBytes(limit_kbps_), time_source,
       StreamRateLimiter::kiloBytesToBytes(limit_kbps_));
+
+  if (tls != nullptr && Runtime::runtimeFeatureEnabled(
+                            "envoy.reloadable_features.bandwidth_limit_shared_fill_timer")) {
+    fill_scheduler_tls_ = ThreadLocal::TypedSlot<Common::TokenFillScheduler>::makeUnique(*tls);
+    const std::chrono::milliseconds fill_interval = fill_interval_;
+    fill_scheduler_tls_->set([fill_interval](Event::Dispatcher& dispatcher) {
+      return std::make_shared<Common::TokenFillScheduler>(dispatcher, fill_interval);
+    });
+  }
 }
 
 BandwidthLimitStats FilterConfig::generateStats(const std::string& prefix, Stats::Scope& scope) {
@@ -105,7 +116,8 @@ Http::FilterHeadersStatus BandwidthLimiter::decodeHeaders(Http::RequestHeaderMap
           }
         },
         const_cast<FilterConfig*>(&config)->timeSource(), decoder_callbacks_->dispatcher(),
-        decoder_callbacks_->scope(), config.tokenBucket(), config.fillInterval());
+        decoder_callbacks_->scope(), config.tokenBucket(), config.fillInterval(),
+        config.fillScheduler());
   }
 
   return Http::FilterHeadersStatus::Continue;
@@ -172,7 +184,8 @@ Http::FilterHeadersStatus BandwidthLimiter::encodeHeaders(Http::ResponseHeaderMa
           }
         },
         const_cast<FilterConfig*>(&config)->timeSource(), encoder_callbacks_->dispatcher(),
-        encoder_callbacks_->scope(), config.tokenBucket(), config.fillInterval());
+        encoder_callbacks_->scope(), config.tokenBucket(), config.fillInterval(),
+        config.fillScheduler());
   }
 
   return Http::FilterHeadersStatus::Continue;
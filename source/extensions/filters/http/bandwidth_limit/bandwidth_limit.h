@@ -11,6 +11,7 @@
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats_macros.h"
 #include "envoy/stats/timespan.h"
+#include "envoy/thread_local/thread_local.h"
 
 #include "source/common/common/assert.h"
 #include "source/common/common/shared_token_bucket_impl.h"
@@ -65,7 +66,7 @@ public:
 
   FilterConfig(const envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit& config,
                Stats::Scope& scope, Runtime::Loader& runtime, TimeSource& time_source,
-               bool per_route = false);
+               bool per_route = false, ThreadLocal::SlotAllocator* tls = nullptr);
   ~FilterConfig() override = default;
   Runtime::Loader& runtime() { return runtime_; }
   BandwidthLimitStats& stats() const { return stats_; }
@@ -86,6 +87,12 @@ public:
   }
   bool enableResponseTrailers() const { return enable_response_trailers_; }
 
+  // Returns this worker's shared fill scheduler, or nullptr if each stream arms its own fill
+  // timer.
+  Common::TokenFillScheduler* fillScheduler() const {
+    return fill_scheduler_tls_ != nullptr ? &**fill_scheduler_tls_ : nullptr;
+  }
+
 private:
   friend class FilterTest;
 
@@ -105,6 +112,9 @@ private:
   const Http::LowerCaseString request_filter_delay_trailer_;
   const Http::LowerCaseString response_filter_delay_trailer_;
   const bool enable_response_trailers_;
+  // Per-worker shared fill scheduler. Only allocated when the shared fill timer runtime feature is
+  // enabled and a thread local allocator was provided.
+  ThreadLocal::TypedSlotPtr<Common::TokenFillScheduler> fill_scheduler_tls_;
 };
 
 using FilterConfigSharedPtr = std::shared_ptr<FilterConfig>;
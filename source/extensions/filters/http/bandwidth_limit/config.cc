@@ -15,8 +15,9 @@ namespace BandwidthLimitFilter {
 Http::FilterFactoryCb BandwidthLimitFilterConfig::createFilterFactoryFromProtoTyped(
     const envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit& proto_config,
     const std::string&, Server::Configuration::FactoryContext& context) {
-  FilterConfigSharedPtr filter_config = std::make_shared<FilterConfig>(
-      proto_config, context.scope(), context.runtime(), context.timeSource());
+  FilterConfigSharedPtr filter_config =
+      std::make_shared<FilterConfig>(proto_config, context.scope(), context.runtime(),
+                                     context.timeSource(), false, &context.threadLocal());
   return [filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(std::make_shared<BandwidthLimiter>(filter_config));
   };
@@ -27,7 +28,8 @@ BandwidthLimitFilterConfig::createRouteSpecificFilterConfigTyped(
     const envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit& proto_config,
     Server::Configuration::ServerFactoryContext& context, ProtobufMessage::ValidationVisitor&) {
   return std::make_shared<const FilterConfig>(proto_config, context.scope(), context.runtime(),
-                                              context.timeSource(), true);
+                                              context.timeSource(), true,
+                                              &context.threadLocal());
 }
 
 /**
@@ -0,0 +1,43 @@
+#include "source/extensions/filters/http/cache/cache_fill_coalescer.h"
+
+#include <utility>
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+
+bool CacheFillCoalescer::joinIfInFlight(size_t key_hash, Event::Dispatcher& dispatcher,
+                                        std::function<void()> done_cb) {
+  absl::MutexLock lock(&mutex_);
+  auto it = in_flight_.find(key_hash);
+  if (it == in_flight_.end()) {
+    in_flight_.emplace(key_hash, std::vector<Waiter>{});
+    return false;
+  }
+  it->second.push_back(Waiter{&dispatcher, std::move(done_cb)});
+  return true;
+}
+
+void CacheFillCoalescer::onFillComplete(size_t key_hash) {
+  std::vector<Waiter> waiters;
+  {
+    absl::MutexLock lock(&mutex_);
+    auto it = in_flight_.find(key_hash);
+    if (it == in_flight_.end()) {
+      return;
+    }
+    waiters = std::move(it->second);
+    in_flight_.erase(it);
+  }
+  // Post outside the lock; a waiter's callback may re-enter the coalescer, e.g. if its
+  // retried lookup also misses and that request becomes the next leader.
+  for (Waiter& waiter : waiters) {
+    waiter.dispatcher_->post(std::move(waiter.done_cb_));
+  }
+}
+
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "envoy/event/dispatcher.h"
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace Cache {
+
+// Coordinates concurrent cache misses for the same key so that only one request (the
+// "leader") goes upstream to fill the cache at a time. Later requests for the same key
+// ("followers") wait until the leader's stream finishes and then retry the cache lookup,
+// instead of all going upstream at once.
+//
+// One instance is shared by all filters created from the same filter config, across all
+// worker threads; all methods are thread-safe.
+class CacheFillCoalescer {
+public:
+  // If an upstream fill for key_hash is already in flight, registers done_cb to be posted
+  // on dispatcher when the leader finishes and returns true. Otherwise records the caller
+  // as the leader for key_hash and returns false; the caller must then call onFillComplete
+  // exactly once when its stream finishes.
+  bool joinIfInFlight(size_t key_hash, Event::Dispatcher& dispatcher,
+                      std::function<void()> done_cb);
+
+  // Called by the leader when its stream finishes, whether or not a cache entry was
+  // actually inserted. Posts all callbacks waiting on key_hash to their respective
+  // dispatchers.
+  void onFillComplete(size_t key_hash);
+
+private:
+  struct Waiter {
+    Event::Dispatcher* dispatcher_;
+    std::function<void()> done_cb_;
+  };
+
+  absl::Mutex mutex_;
+  // Keys with an in-flight upstream fill, mapped to the requests waiting on it.
+  absl::flat_hash_map<size_t, std::vector<Waiter>> in_flight_ ABSL_GUARDED_BY(mutex_);
+};
+
+using CacheFillCoalescerSharedPtr = std::shared_ptr<CacheFillCoalescer>;
+
+} // namespace Cache
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
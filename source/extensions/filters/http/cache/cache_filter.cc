@@ -33,12 +33,19 @@ using CacheResponseCodeDetails = ConstSingleton<CacheResponseCodeDetailValues>;
 
 CacheFilter::CacheFilter(const envoy::extensions::filters::http::cache::v3::CacheConfig& config,
                          const std::string&, Stats::Scope&, TimeSource& time_source,
-                         std::shared_ptr<HttpCache> http_cache)
+                         std::shared_ptr<HttpCache> http_cache,
+                         CacheFillCoalescerSharedPtr coalescer)
     : time_source_(time_source), cache_(http_cache),
-      vary_allow_list_(config.allowed_vary_headers()) {}
+      vary_allow_list_(config.allowed_vary_headers()), coalescer_(coalescer) {}
 
 void CacheFilter::onDestroy() {
   filter_state_ = FilterState::Destroyed;
+  if (is_coalescing_leader_) {
+    // Wake up any requests waiting on this upstream fetch, whether or not it resulted in a
+    // cache insert; their retried lookups will find whatever was (or wasn't) inserted.
+    coalescer_->onFillComplete(key_hash_);
+    is_coalescing_leader_ = false;
+  }
   if (lookup_ != nullptr) {
     lookup_->onDestroy();
   }
@@ -91,6 +98,9 @@ Http::FilterHeadersStatus CacheFilter::decodeHeaders(Http::RequestHeaderMap& hea
   LookupRequest lookup_request(headers, time_source_.systemTime(), vary_allow_list_);
   request_allows_inserts_ = !lookup_request.requestCacheControl().no_store_;
   is_head_request_ = headers.getMethodValue() == Http::Headers::get().MethodValues.Head;
+  if (coalescer_ != nullptr) {
+    key_hash_ = stableHashKey(lookup_request.key());
+  }
   lookup_ = cache_->makeLookupContext(std::move(lookup_request), *decoder_callbacks_);
 
   ASSERT(lookup_);
@@ -385,6 +395,11 @@ void CacheFilter::onHeaders(LookupResult&& result, Http::RequestHeaderMap& reque
     // request and let it pass through as if no cache entry was found. If the
     // cache entry was valid, the response status should be 304 (unmodified)
     // and the cache entry will be injected in the response body.
+    if (coalesceUpstreamFetch(request_headers)) {
+      // Another request is already validating this entry; wait for it instead of sending
+      // a duplicate conditional request.
+      return;
+    }
     handleCacheHitWithValidation(request_headers);
     return;
   case CacheEntryStatus::Ok:
@@ -395,6 +410,11 @@ void CacheFilter::onHeaders(LookupResult&& result, Http::RequestHeaderMap& reque
     handleCacheHit();
     return;
   case CacheEntryStatus::Unusable:
+    if (coalesceUpstreamFetch(request_headers)) {
+      // Another request is already fetching this key from upstream; wait for its insert
+      // instead of stampeding the origin.
+      return;
+    }
     decoder_callbacks_->continueDecoding();
     return;
   case CacheEntryStatus::LookupError:
@@ -409,6 +429,47 @@ void CacheFilter::onHeaders(LookupResult&& result, Http::RequestHeaderMap& reque
   decoder_callbacks_->continueDecoding();
 }
 
+bool CacheFilter::coalesceUpstreamFetch(Http::RequestHeaderMap& request_headers) {
+  if (coalescer_ == nullptr || coalescing_waited_) {
+    return false;
+  }
+  // The leader may finish on another worker thread, so the same thread-safety
+  // considerations as in getHeaders apply: the callback is posted through this filter's
+  // dispatcher and guarded by a weak_ptr to the filter.
+  CacheFilterWeakPtr self = weak_from_this();
+  const bool joined = coalescer_->joinIfInFlight(
+      key_hash_, decoder_callbacks_->dispatcher(), [self, &request_headers]() {
+        if (CacheFilterSharedPtr cache_filter = self.lock()) {
+          cache_filter->onCoalescedFillComplete(request_headers);
+        }
+      });
+  if (!joined) {
+    is_coalescing_leader_ = true;
+    return false;
+  }
+  coalescing_waited_ = true;
+  ENVOY_STREAM_LOG(debug,
+                   "CacheFilter::onHeaders: an upstream fetch for this key is already in flight; "
+                   "waiting for it to finish",
+                   *decoder_callbacks_);
+  return true;
+}
+
+void CacheFilter::onCoalescedFillComplete(Http::RequestHeaderMap& request_headers) {
+  if (filter_state_ == FilterState::Destroyed ||
+      filter_state_ == FilterState::NotServingFromCache) {
+    // The filter is being destroyed, or a response was injected into the filter chain
+    // while waiting (e.g. the request stream timed out).
+    return;
+  }
+  ENVOY_STREAM_LOG(debug, "CacheFilter::onCoalescedFillComplete: retrying cache lookup",
+                   *decoder_callbacks_);
+  lookup_->onDestroy();
+  LookupRequest lookup_request(request_headers, time_source_.systemTime(), vary_allow_list_);
+  lookup_ = cache_->makeLookupContext(std::move(lookup_request), *decoder_callbacks_);
+  getHeaders(request_headers);
+}
+
 // TODO(toddmgreer): Handle downstream backpressure.
 void CacheFilter::onBody(Buffer::InstancePtr&& body) {
   // Can be called during decoding if a valid cache hit is found,
@@ -8,6 +8,7 @@
 #include "envoy/extensions/filters/http/cache/v3/cache.pb.h"
 
 #include "source/common/common/logger.h"
+#include "source/extensions/filters/http/cache/cache_fill_coalescer.h"
 #include "source/extensions/filters/http/cache/cache_filter_logging_info.h"
 #include "source/extensions/filters/http/cache/cache_headers_utils.h"
 #include "source/extensions/filters/http/cache/cache_insert_queue.h"
@@ -55,7 +56,8 @@ class CacheFilter : public Http::PassThroughFilter,
 public:
   CacheFilter(const envoy::extensions::filters::http::cache::v3::CacheConfig& config,
               const std::string& stats_prefix, Stats::Scope& scope, TimeSource& time_source,
-              std::shared_ptr<HttpCache> http_cache);
+              std::shared_ptr<HttpCache> http_cache,
+              CacheFillCoalescerSharedPtr coalescer = nullptr);
   // Http::StreamFilterBase
   void onDestroy() override;
   void onStreamComplete() override;
@@ -82,6 +84,16 @@ private:
   void onBody(Buffer::InstancePtr&& body);
   void onTrailers(Http::ResponseTrailerMapPtr&& trailers);
 
+  // If an upstream fetch for the same cache key is already in flight, waits for it to
+  // finish instead of going upstream too; the cache lookup is retried when the leader
+  // finishes. Returns true if this request is now waiting. Returns false if this request
+  // became the leader for its key, already waited once, or coalescing is disabled.
+  bool coalesceUpstreamFetch(Http::RequestHeaderMap& request_headers);
+
+  // Called (through this filter's dispatcher) when the coalesced leader's stream has
+  // finished; retries the cache lookup against whatever the leader left in the cache.
+  void onCoalescedFillComplete(Http::RequestHeaderMap& request_headers);
+
   // Set required state in the CacheFilter for handling a cache hit.
   void handleCacheHit();
 
@@ -155,6 +167,21 @@ private:
   // https://httpwg.org/specs/rfc7234.html#response.cacheability
   bool request_allows_inserts_ = false;
 
+  // Coordinates upstream fetches for concurrent misses on the same key. May be null, in
+  // which case every miss goes upstream independently.
+  CacheFillCoalescerSharedPtr coalescer_;
+
+  // Hash of this request's cache key; only meaningful if lookup_ was created.
+  size_t key_hash_ = 0;
+
+  // True if this request went upstream as the coalesced leader for its key; the key must
+  // be released when the stream finishes.
+  bool is_coalescing_leader_ = false;
+
+  // True if this request already waited for an in-flight upstream fetch once; it will not
+  // wait again, to rule out unbounded waiting when the leader's response isn't cacheable.
+  bool coalescing_waited_ = false;
+
   FilterState filter_state_ = FilterState::Initial;
 
   bool is_head_request_ = false;
@@ -11,6 +11,7 @@ Http::FilterFactoryCb CacheFilterFactory::createFilterFactoryFromProtoTyped(
     const envoy::extensions::filters::http::cache::v3::CacheConfig& config,
     const std::string& stats_prefix, Server::Configuration::FactoryContext& context) {
   std::shared_ptr<HttpCache> cache;
+  CacheFillCoalescerSharedPtr coalescer;
   if (!config.disabled().value()) {
     if (!config.has_typed_config()) {
       throw EnvoyException("at least one of typed_config or disabled must be set");
@@ -24,12 +25,15 @@ Http::FilterFactoryCb CacheFilterFactory::createFilterFactoryFromProtoTyped(
     }
 
     cache = http_cache_factory->getCache(config, context);
+    // The coalescer is shared by all filters created from this config so that concurrent
+    // misses for the same key, on any worker, result in a single upstream fetch.
+    coalescer = std::make_shared<CacheFillCoalescer>();
   }
 
-  return [config, stats_prefix, &context,
-          cache](Http::FilterChainFactoryCallbacks& callbacks) -> void {
-    callbacks.addStreamFilter(std::make_shared<CacheFilter>(config, stats_prefix, context.scope(),
-                                                            context.timeSource(), cache));
+  return [config, stats_prefix, &context, cache,
+          coalescer](Http::FilterChainFactoryCallbacks& callbacks) -> void {
+    callbacks.addStreamFilter(std::make_shared<CacheFilter>(
+        config, stats_prefix, context.scope(), context.timeSource(), cache, coalescer));
   };
 }
 
@@ -13,17 +13,63 @@ namespace Extensions {
 namespace HttpFilters {
 namespace Common {
 
+TokenFillScheduler::TokenFillScheduler(Event::Dispatcher& dispatcher,
+                                       std::chrono::milliseconds fill_interval)
+    : fill_interval_(fill_interval), timer_(dispatcher.createTimer([this] { onTick(); })) {
+  ASSERT(fill_interval_.count() > 0);
+}
+
+void TokenFillScheduler::park(StreamRateLimiter& limiter) {
+  if (limiter.parked_entry_.has_value()) {
+    return;
+  }
+  limiter.parked_entry_ = parked_limiters_.insert(parked_limiters_.end(), &limiter);
+  if (!timer_->enabled()) {
+    timer_->enableTimer(fill_interval_);
+  }
+}
+
+void TokenFillScheduler::cancel(StreamRateLimiter& limiter) {
+  if (!limiter.parked_entry_.has_value()) {
+    return;
+  }
+  parked_limiters_.erase(*limiter.parked_entry_);
+  limiter.parked_entry_.reset();
+  // The timer is deliberately left running if this was the last parked limiter; it will find an
+  // empty list on the next tick and go quiet.
+}
+
+void TokenFillScheduler::onTick() {
+  // A marker separates the limiters due this tick from those that re-park because they are still
+  // out of tokens; the latter are serviced on the next tick. Limiters destroyed by another
+  // limiter's write callbacks remove themselves from the list via cancel(), which is safe during
+  // this iteration because the entry being serviced has already been popped.
+  parked_limiters_.push_back(nullptr);
+  while (parked_limiters_.front() != nullptr) {
+    StreamRateLimiter& limiter = *parked_limiters_.front();
+    parked_limiters_.pop_front();
+    limiter.parked_entry_.reset();
+    limiter.onTokenTimer();
+  }
+  parked_limiters_.pop_front();
+  if (!parked_limiters_.empty() && !timer_->enabled()) {
+    timer_->enableTimer(fill_interval_);
+  }
+}
+
 StreamRateLimiter::StreamRateLimiter(
     uint64_t max_kbps, uint64_t max_buffered_data, std::function<void()> pause_data_cb,
     std::function<void()> resume_data_cb,
     std::function<void(Buffer::Instance&, bool)> write_data_cb, std::function<void()> continue_cb,
     std::function<void(uint64_t, bool, std::chrono::milliseconds)> write_stats_cb,
     TimeSource& time_source, Event::Dispatcher& dispatcher, const ScopeTrackedObject& scope,
-    std::shared_ptr<TokenBucket> token_bucket, std::chrono::milliseconds fill_interval)
+    std::shared_ptr<TokenBucket> token_bucket, std::chrono::milliseconds fill_interval,
+    TokenFillScheduler* fill_scheduler)
     : fill_interval_(std::move(fill_interval)), write_data_cb_(write_data_cb),
       continue_cb_(continue_cb), write_stats_cb_(std::move(write_stats_cb)), scope_(scope),
       token_bucket_(std::move(token_bucket)),
       token_timer_(dispatcher.createTimer([this] { onTokenTimer(); })),
+      fill_scheduler_(fill_scheduler),
       buffer_(resume_data_cb, pause_data_cb,
               []() -> void { /* TODO(adisuissa): Handle overflow watermark */ }) {
   ASSERT(max_buffered_data > 0);
@@ -74,7 +120,11 @@ void StreamRateLimiter::onTokenTimer() {
               "StreamRateLimiter <onTokenTimer>: scheduling wakeup for {}ms, "
               "buffered={}",
               fill_interval_.count(), buffer_.length());
-    token_timer_->enableTimer(fill_interval_, &scope_);
+    if (fill_scheduler_ != nullptr) {
+      fill_scheduler_->park(*this);
+    } else {
+      token_timer_->enableTimer(fill_interval_, &scope_);
+    }
   }
 
   // Write the data out, indicating end stream if we saw end stream, there is no further data to
@@ -100,11 +150,12 @@ void StreamRateLimiter::writeData(Buffer::Instance& incoming_buffer, bool end_st
     saw_trailers_ = true;
   }
 
+  const bool wakeup_scheduled = token_timer_->enabled() || parked_entry_.has_value();
   ENVOY_LOG(debug,
             "StreamRateLimiter <writeData>: got new {} bytes of data. token "
             "timer {} scheduled.",
-            len, !token_timer_->enabled() ? "now" : "already");
-  if (!token_timer_->enabled()) {
+            len, !wakeup_scheduled ? "now" : "already");
+  if (!wakeup_scheduled) {
     // TODO(mattklein123): In an optimal world we would be able to continue iteration with the data
     // we want in the buffer, but have a way to clear end_stream in case we can't send it all.
     // The filter API does not currently support that and it will not be a trivial change to add.
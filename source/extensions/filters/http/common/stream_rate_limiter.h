@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -7,9 +8,12 @@
 #include "envoy/common/token_bucket.h"
 #include "envoy/event/timer.h"
 #include "envoy/runtime/runtime.h"
+#include "envoy/thread_local/thread_local_object.h"
 
 #include "source/common/buffer/watermark_buffer.h"
 
+#include "absl/types/optional.h"
+
 namespace Envoy {
 
 class ScopeTrackedObject;
@@ -22,6 +26,35 @@ namespace Extensions {
 namespace HttpFilters {
 namespace Common {
 
+class StreamRateLimiter;
+
+/**
+ * Shares a single fill timer among all rate-limited streams on a worker thread. Limiters that run
+ * out of tokens park themselves here instead of arming their own timer, and one timer tick
+ * distributes tokens to every parked limiter in a single pass. This bounds the number of timer
+ * events per worker to one per fill interval regardless of how many streams are being limited.
+ */
+class TokenFillScheduler : public ThreadLocal::ThreadLocalObject {
+public:
+  TokenFillScheduler(Event::Dispatcher& dispatcher, std::chrono::milliseconds fill_interval);
+
+  // Parks a limiter until the next tick. No-op if the limiter is already parked.
+  void park(StreamRateLimiter& limiter);
+
+  // Removes a limiter from the tick list, e.g. on stream destruction. No-op if not parked.
+  void cancel(StreamRateLimiter& limiter);
+
+private:
+  void onTick();
+
+  const std::chrono::milliseconds fill_interval_;
+  Event::TimerPtr timer_;
+
+  // Limiters waiting for the next tick, in parking order. Each parked limiter holds an iterator to
+  // its entry so cancellation is O(1).
+  std::list<StreamRateLimiter*> parked_limiters_;
+};
+
 /**
  * A generic HTTP stream rate limiter. It limits the rate of transfer for a stream to the specified
  * max rate. It calls appropriate callbacks when the buffered data crosses certain high and low
@@ -45,6 +78,11 @@ public:
    * @param time_source the time source to run the token bucket with.
    * @param dispatcher the stream's dispatcher to use for creating timers.
    * @param scope the stream's scope
+   * @param token_bucket the token bucket to use, a private one is created if not provided.
+   * @param fill_interval the timer interval at which buffered data is re-attempted.
+   * @param fill_scheduler optional per-worker scheduler that coalesces the fill timers of all
+   *                       limited streams into a single timer. If not provided, each limiter arms
+   *                       its own timer.
    */
   StreamRateLimiter(uint64_t max_kbps, uint64_t max_buffered_data,
                     std::function<void()> pause_data_cb, std::function<void()> resume_data_cb,
@@ -54,7 +92,8 @@ public:
                     TimeSource& time_source, Event::Dispatcher& dispatcher,
                     const ScopeTrackedObject& scope,
                     std::shared_ptr<TokenBucket> token_bucket = nullptr,
-                    std::chrono::milliseconds fill_interval = DefaultFillInterval);
+                    std::chrono::milliseconds fill_interval = DefaultFillInterval,
+                    TokenFillScheduler* fill_scheduler = nullptr);
 
   /**
    * Called by the stream to write data. All data writes happen asynchronously, the stream should
@@ -72,11 +111,17 @@ public:
    * Like the owning filter, we must handle inline destruction, so we have a destroy() method which
    * kills any callbacks.
    */
-  void destroy() { token_timer_.reset(); }
+  void destroy() {
+    if (fill_scheduler_ != nullptr) {
+      fill_scheduler_->cancel(*this);
+    }
+    token_timer_.reset();
+  }
   bool destroyed() { return token_timer_ == nullptr; }
 
 private:
   friend class StreamRateLimiterTest;
+  friend class TokenFillScheduler;
   using TimerPtr = std::unique_ptr<Event::Timer>;
 
   void onTokenTimer();
@@ -88,6 +133,14 @@ private:
   const ScopeTrackedObject& scope_;
   std::shared_ptr<TokenBucket> token_bucket_;
   Event::TimerPtr token_timer_;
+
+  // When non-null, periodic refills are driven by the shared per-worker scheduler instead of
+  // token_timer_, which is then only used for the immediate post-write kick.
+  TokenFillScheduler* const fill_scheduler_;
+
+  // Set while this limiter is parked in the fill scheduler's tick list.
+  absl::optional<std::list<StreamRateLimiter*>::iterator> parked_entry_;
+
   bool saw_end_stream_{};
   bool saw_trailers_{};
   Buffer::WatermarkBuffer buffer_;
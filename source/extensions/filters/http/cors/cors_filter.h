@@ -90,7 +90,6 @@ public:
 private:
   friend class CorsFilterTest;
 
-  const std::vector<Matchers::StringMatcherPtr>* allowOrigins();
   const std::string& allowMethods();
   const std::string& allowHeaders();
   const std::string& exposeHeaders();
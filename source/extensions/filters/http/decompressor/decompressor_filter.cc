@@ -8,6 +8,14 @@ namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
 namespace Decompressor {
+namespace {
+
+// When decompression is budgeted, input is fed to the decompressor in slices of at most this
+// size (or the budget, whichever is smaller) so that a highly compressed stream can only
+// overshoot the output budget by the expansion of a single slice.
+constexpr uint64_t InflateInputSliceBytes = 4096;
+
+} // namespace
 
 Http::RegisterCustomInlineHeader<Http::CustomInlineHeaderRegistry::Type::RequestHeaders>
     accept_encoding_handle(Http::CustomHeaders::get().AcceptEncoding);
@@ -43,7 +51,9 @@ DecompressorFilterConfig::DirectionConfig::DirectionConfig(
     const std::string& stats_prefix, Stats::Scope& scope, Runtime::Loader& runtime)
     : stats_(generateStats(stats_prefix, scope)),
       decompression_enabled_(proto_config.enabled(), runtime),
-      ignore_no_transform_header_(proto_config.ignore_no_transform_header()) {}
+      ignore_no_transform_header_(proto_config.ignore_no_transform_header()),
+      max_inflate_bytes_per_iteration_(
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(proto_config, max_inflate_bytes_per_iteration, 0)) {}
 
 DecompressorFilterConfig::RequestDirectionConfig::RequestDirectionConfig(
     const envoy::extensions::filters::http::decompressor::v3::Decompressor::RequestDirectionConfig&
@@ -65,6 +75,16 @@ DecompressorFilter::DecompressorFilter(DecompressorFilterConfigSharedPtr config)
       response_byte_tracker_(config_->trailersCompressedBytesString(),
                              config_->trailersUncompressedBytesString()) {}
 
+void DecompressorFilter::onDestroy() { *is_destroyed_ = true; }
+
+void DecompressorFilter::setDecoderFilterCallbacks(Http::StreamDecoderFilterCallbacks& callbacks) {
+  Http::PassThroughDecoderFilter::setDecoderFilterCallbacks(callbacks);
+  // Budgeted response decompression pauses while downstream is above the high watermark.
+  if (config_->responseDirectionConfig().maxInflateBytesPerIteration() > 0) {
+    callbacks.addDownstreamWatermarkCallbacks(*this);
+  }
+}
+
 Http::FilterHeadersStatus DecompressorFilter::decodeHeaders(Http::RequestHeaderMap& headers,
                                                             bool end_stream) {
   // Two responsibilities on the request side:
@@ -94,6 +114,9 @@ Http::FilterHeadersStatus DecompressorFilter::decodeHeaders(Http::RequestHeaderM
 
 Http::FilterDataStatus DecompressorFilter::decodeData(Buffer::Instance& data, bool end_stream) {
   if (request_decompressor_) {
+    if (config_->requestDirectionConfig().maxInflateBytesPerIteration() > 0) {
+      return decompressBudgeted(/*is_request=*/true, data, end_stream);
+    }
     HeaderMapOptRef trailers;
     if (end_stream) {
       trailers = HeaderMapOptRef(std::ref(decoder_callbacks_->addDecodedTrailers()));
@@ -107,6 +130,9 @@ Http::FilterDataStatus DecompressorFilter::decodeData(Buffer::Instance& data, bo
 Http::FilterTrailersStatus DecompressorFilter::decodeTrailers(Http::RequestTrailerMap& trailers) {
   // Only report if the filter has actually decompressed.
   if (request_decompressor_) {
+    if (request_budgeted_.injecting_) {
+      return trailersWhileBudgeted(/*is_request=*/true, trailers);
+    }
     request_byte_tracker_.reportTotalBytes(trailers);
   }
   return Http::FilterTrailersStatus::Continue;
@@ -126,6 +152,9 @@ Http::FilterHeadersStatus DecompressorFilter::encodeHeaders(Http::ResponseHeader
 
 Http::FilterDataStatus DecompressorFilter::encodeData(Buffer::Instance& data, bool end_stream) {
   if (response_decompressor_) {
+    if (config_->responseDirectionConfig().maxInflateBytesPerIteration() > 0) {
+      return decompressBudgeted(/*is_request=*/false, data, end_stream);
+    }
     HeaderMapOptRef trailers;
     if (end_stream) {
       trailers = HeaderMapOptRef(std::ref(encoder_callbacks_->addEncodedTrailers()));
@@ -139,11 +168,151 @@ Http::FilterDataStatus DecompressorFilter::encodeData(Buffer::Instance& data, bo
 Http::FilterTrailersStatus DecompressorFilter::encodeTrailers(Http::ResponseTrailerMap& trailers) {
   // Only report if the filter has actually decompressed.
   if (response_decompressor_) {
+    if (response_budgeted_.injecting_) {
+      return trailersWhileBudgeted(/*is_request=*/false, trailers);
+    }
     response_byte_tracker_.reportTotalBytes(trailers);
   }
   return Http::FilterTrailersStatus::Continue;
 }
 
+void DecompressorFilter::onAboveWriteBufferHighWatermark() { ++downstream_watermarks_; }
+
+void DecompressorFilter::onBelowWriteBufferLowWatermark() {
+  ASSERT(downstream_watermarks_ > 0);
+  --downstream_watermarks_;
+  if (downstream_watermarks_ == 0 && response_budgeted_.paused_) {
+    scheduleResume(/*is_request=*/false);
+  }
+}
+
+Http::FilterDataStatus DecompressorFilter::decompressBudgeted(bool is_request,
+                                                              Buffer::Instance& data,
+                                                              bool end_stream) {
+  BudgetedStream& stream = is_request ? request_budgeted_ : response_budgeted_;
+  stream.pending_input_.move(data);
+  if (end_stream) {
+    stream.end_stream_seen_ = true;
+    // Trailers may only be added during the data callback that ends the stream, so create them
+    // now even though the byte totals are reported only once draining completes.
+    stream.trailers_ = is_request ? static_cast<Http::HeaderMap*>(
+                                        &decoder_callbacks_->addDecodedTrailers())
+                                  : static_cast<Http::HeaderMap*>(
+                                        &encoder_callbacks_->addEncodedTrailers());
+  }
+  if (!stream.injecting_) {
+    inflateUpToBudget(is_request);
+    if (stream.pending_input_.length() == 0) {
+      // The whole chunk fit within the budget; deliver it in place as usual.
+      data.move(stream.pending_output_);
+      if (stream.trailers_ != nullptr) {
+        (is_request ? request_byte_tracker_ : response_byte_tracker_)
+            .reportTotalBytes(*stream.trailers_);
+      }
+      return Http::FilterDataStatus::Continue;
+    }
+    // This chunk inflates past the budget. Switch to draining it across event-loop iterations,
+    // injecting each budget's worth of output as it is produced.
+    stream.injecting_ = true;
+  }
+  if (!stream.draining_) {
+    scheduleResume(is_request);
+  }
+  return Http::FilterDataStatus::StopIterationNoBuffer;
+}
+
+Http::FilterTrailersStatus DecompressorFilter::trailersWhileBudgeted(bool is_request,
+                                                                     Http::HeaderMap& trailers) {
+  // The byte totals are not final until the queued input has drained, so hold the trailers;
+  // resumeDecompress reports into them and resumes the stream once decompression finishes.
+  BudgetedStream& stream = is_request ? request_budgeted_ : response_budgeted_;
+  stream.end_stream_seen_ = true;
+  stream.trailers_ = &trailers;
+  if (!stream.draining_) {
+    scheduleResume(is_request);
+  }
+  return Http::FilterTrailersStatus::StopIteration;
+}
+
+void DecompressorFilter::inflateUpToBudget(bool is_request) {
+  BudgetedStream& stream = is_request ? request_budgeted_ : response_budgeted_;
+  const DecompressorFilterConfig::DirectionConfig& direction_config =
+      is_request ? static_cast<const DecompressorFilterConfig::DirectionConfig&>(
+                       config_->requestDirectionConfig())
+                 : config_->responseDirectionConfig();
+  const Compression::Decompressor::DecompressorPtr& decompressor =
+      is_request ? request_decompressor_ : response_decompressor_;
+  ASSERT(decompressor);
+  Http::StreamFilterCallbacks& callbacks =
+      is_request ? static_cast<Http::StreamFilterCallbacks&>(*decoder_callbacks_)
+                 : static_cast<Http::StreamFilterCallbacks&>(*encoder_callbacks_);
+  const uint64_t budget = direction_config.maxInflateBytesPerIteration();
+  const uint64_t slice_size = std::min(InflateInputSliceBytes, budget);
+  const uint64_t output_start = stream.pending_output_.length();
+  uint64_t consumed = 0;
+  while (stream.pending_input_.length() > 0 &&
+         stream.pending_output_.length() - output_start < budget) {
+    Buffer::OwnedImpl slice;
+    const uint64_t take = std::min<uint64_t>(stream.pending_input_.length(), slice_size);
+    slice.move(stream.pending_input_, take);
+    decompressor->decompress(slice, stream.pending_output_);
+    consumed += take;
+  }
+  const uint64_t produced = stream.pending_output_.length() - output_start;
+  (is_request ? request_byte_tracker_ : response_byte_tracker_).chargeBytes(consumed, produced);
+  direction_config.stats().total_compressed_bytes_.add(consumed);
+  direction_config.stats().total_uncompressed_bytes_.add(produced);
+  ENVOY_STREAM_LOG(debug, "{} data decompressed from {} bytes to {} bytes", callbacks,
+                   direction_config.logString(), consumed, produced);
+}
+
+void DecompressorFilter::scheduleResume(bool is_request) {
+  BudgetedStream& stream = is_request ? request_budgeted_ : response_budgeted_;
+  stream.draining_ = true;
+  decoder_callbacks_->dispatcher().post([this, is_destroyed = is_destroyed_, is_request]() {
+    if (!*is_destroyed) {
+      resumeDecompress(is_request);
+    }
+  });
+}
+
+void DecompressorFilter::resumeDecompress(bool is_request) {
+  BudgetedStream& stream = is_request ? request_budgeted_ : response_budgeted_;
+  if (!is_request && downstream_watermarks_ > 0) {
+    // Downstream cannot consume more output; onBelowWriteBufferLowWatermark reschedules.
+    stream.paused_ = true;
+    return;
+  }
+  stream.paused_ = false;
+  inflateUpToBudget(is_request);
+  Buffer::OwnedImpl output;
+  output.move(stream.pending_output_);
+  if (output.length() > 0) {
+    if (is_request) {
+      decoder_callbacks_->injectDecodedDataToFilterChain(output, false);
+    } else {
+      encoder_callbacks_->injectEncodedDataToFilterChain(output, false);
+    }
+  }
+  if (stream.pending_input_.length() > 0) {
+    scheduleResume(is_request);
+    return;
+  }
+  stream.draining_ = false;
+  if (stream.end_stream_seen_) {
+    if (stream.trailers_ != nullptr) {
+      (is_request ? request_byte_tracker_ : response_byte_tracker_)
+          .reportTotalBytes(*stream.trailers_);
+      stream.trailers_ = nullptr;
+    }
+    if (is_request) {
+      decoder_callbacks_->continueDecoding();
+    } else {
+      encoder_callbacks_->continueEncoding();
+    }
+  }
+}
+
 void DecompressorFilter::decompress(
     const DecompressorFilterConfig::DirectionConfig& direction_config,
     const Compression::Decompressor::DecompressorPtr& decompressor,
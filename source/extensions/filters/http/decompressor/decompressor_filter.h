@@ -5,6 +5,7 @@
 #include "envoy/extensions/filters/http/decompressor/v3/decompressor.pb.h"
 #include "envoy/http/filter.h"
 
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/common/macros.h"
 #include "source/common/http/header_utility.h"
 #include "source/common/http/headers.h"
@@ -49,6 +50,8 @@ public:
     const DecompressorStats& stats() const { return stats_; }
     bool decompressionEnabled() const { return decompression_enabled_.enabled(); }
     bool ignoreNoTransformHeader() const { return ignore_no_transform_header_; }
+    // 0 means no budget: each data chunk is fully decompressed as it arrives.
+    uint64_t maxInflateBytesPerIteration() const { return max_inflate_bytes_per_iteration_; }
 
   private:
     static DecompressorStats generateStats(const std::string& prefix, Stats::Scope& scope) {
@@ -58,6 +61,7 @@ public:
     const DecompressorStats stats_;
     const Runtime::FeatureFlag decompression_enabled_;
     const bool ignore_no_transform_header_;
+    const uint64_t max_inflate_bytes_per_iteration_;
   };
 
   class RequestDirectionConfig : public DirectionConfig {
@@ -126,11 +130,16 @@ using DecompressorFilterConfigSharedPtr = std::shared_ptr<DecompressorFilterConf
  * A filter that decompresses data bidirectionally.
  */
 class DecompressorFilter : public Http::PassThroughFilter,
+                           public Http::DownstreamWatermarkCallbacks,
                            public Logger::Loggable<Logger::Id::filter> {
 public:
   DecompressorFilter(DecompressorFilterConfigSharedPtr config);
 
+  // Http::StreamFilterBase
+  void onDestroy() override;
+
   // Http::StreamDecoderFilter
+  void setDecoderFilterCallbacks(Http::StreamDecoderFilterCallbacks& callbacks) override;
   Http::FilterHeadersStatus decodeHeaders(Http::RequestHeaderMap&, bool) override;
   Http::FilterDataStatus decodeData(Buffer::Instance&, bool) override;
   Http::FilterTrailersStatus decodeTrailers(Http::RequestTrailerMap&) override;
@@ -140,6 +149,10 @@ public:
   Http::FilterDataStatus encodeData(Buffer::Instance&, bool) override;
   Http::FilterTrailersStatus encodeTrailers(Http::ResponseTrailerMap&) override;
 
+  // Http::DownstreamWatermarkCallbacks
+  void onAboveWriteBufferHighWatermark() override;
+  void onBelowWriteBufferLowWatermark() override;
+
 private:
   struct ByteTracker {
     ByteTracker(const Http::LowerCaseString& compressed_bytes_trailer,
@@ -191,6 +204,36 @@ private:
     return Http::FilterHeadersStatus::Continue;
   }
 
+  // State for one direction when decompression is limited by maxInflateBytesPerIteration.
+  // Once a data chunk would inflate past the budget the direction switches permanently to
+  // "injecting" mode: compressed input is queued here and inflated from scheduled callbacks,
+  // one budget's worth per event-loop iteration, with the output injected into the filter
+  // chain (see resumeDecompress).
+  struct BudgetedStream {
+    Buffer::OwnedImpl pending_input_;
+    Buffer::OwnedImpl pending_output_;
+    // True once output is delivered by injection rather than in place; never reset.
+    bool injecting_{false};
+    // True while a resume callback is scheduled or resumption is paused by a watermark.
+    bool draining_{false};
+    // True while resumption is held because downstream is above the high watermark.
+    bool paused_{false};
+    bool end_stream_seen_{false};
+    // Receives the byte totals once the queued input has fully drained.
+    Http::HeaderMap* trailers_{nullptr};
+  };
+
+  Http::FilterDataStatus decompressBudgeted(bool is_request, Buffer::Instance& data,
+                                            bool end_stream);
+  Http::FilterTrailersStatus trailersWhileBudgeted(bool is_request, Http::HeaderMap& trailers);
+  // Decompresses queued input until the output budget for this iteration is spent, charging
+  // stats as it goes.
+  void inflateUpToBudget(bool is_request);
+  // Queues resumeDecompress on the dispatcher; a no-op callback if the filter is destroyed
+  // before it runs.
+  void scheduleResume(bool is_request);
+  void resumeDecompress(bool is_request);
+
   using HeaderMapOptRef = absl::optional<std::reference_wrapper<Http::HeaderMap>>;
   void decompress(const DecompressorFilterConfig::DirectionConfig& direction_config,
                   const Compression::Decompressor::DecompressorPtr& decompressor,
@@ -242,6 +285,13 @@ private:
   Compression::Decompressor::DecompressorPtr response_decompressor_{};
   ByteTracker request_byte_tracker_;
   ByteTracker response_byte_tracker_;
+  BudgetedStream request_budgeted_;
+  BudgetedStream response_budgeted_;
+  // Number of unanswered downstream high watermark events; while non-zero, budgeted response
+  // decompression produces no further output.
+  uint32_t downstream_watermarks_{0};
+  // Set in onDestroy so that resume callbacks already queued on the dispatcher become no-ops.
+  std::shared_ptr<bool> is_destroyed_ = std::make_shared<bool>(false);
 };
 
 } // namespace Decompressor
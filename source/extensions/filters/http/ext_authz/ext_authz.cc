@@ -133,6 +133,13 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
     return Http::FilterHeadersStatus::StopIteration;
   }
 
+  // Serve the decision from the per-worker cache if possible. Buffered-body checks bypass the
+  // cache since the decision may depend on the body, which is not part of the cache key.
+  if (config_->decisionCacheEnabled() && lookupCachedDecision(headers)) {
+    return filter_return_ == FilterReturn::StopDecoding ? Http::FilterHeadersStatus::StopIteration
+                                                        : Http::FilterHeadersStatus::Continue;
+  }
+
   // Initiate a call to the authorization server since we are not disabled.
   initiateCall(headers);
   return filter_return_ == FilterReturn::StopDecoding
@@ -231,11 +238,82 @@ void Filter::onDestroy() {
   }
 }
 
+std::string Filter::decisionCacheKey(const Http::RequestHeaderMap& headers) const {
+  // The (method, route, principal) tuple the decision is assumed to be deterministic for. '\n'
+  // cannot appear in a header value, so it is a safe separator.
+  std::string key =
+      absl::StrCat(headers.getMethodValue(), "\n", decoder_callbacks_->route()->routeName(), "\n",
+                   headers.getHostValue());
+  for (const auto& header : config_->decisionCacheKeyHeaders()) {
+    const auto value = headers.get(header);
+    absl::StrAppend(&key, "\n",
+                    value.empty() ? absl::string_view() : value[0]->value().getStringView());
+  }
+  return key;
+}
+
+bool Filter::lookupCachedDecision(const Http::RequestHeaderMap& headers) {
+  decision_cache_key_ = decisionCacheKey(headers);
+  auto& entries = config_->decisionCache().entries_;
+  const auto entry = entries.find(decision_cache_key_);
+  if (entry == entries.end()) {
+    stats_.cache_miss_.inc();
+    return false;
+  }
+  if (decoder_callbacks_->dispatcher().timeSource().monotonicTime() >= entry->second.expires_at_) {
+    entries.erase(entry);
+    stats_.cache_miss_.inc();
+    return false;
+  }
+
+  ENVOY_STREAM_LOG(trace, "ext_authz filter replaying cached authorization decision",
+                   *decoder_callbacks_);
+  stats_.cache_hit_.inc();
+  cluster_ = decoder_callbacks_->clusterInfo();
+  auto response = std::make_unique<Filters::Common::ExtAuthz::Response>(entry->second.response_);
+  // Replay the cached response as if the authorization service had answered synchronously. Clear
+  // the key first so that onComplete() does not re-store the decision. An OK decision resets
+  // filter_return_ via continueDecoding(); a denied decision leaves it at StopDecoding after
+  // sending the local reply.
+  decision_cache_key_.clear();
+  filter_return_ = FilterReturn::StopDecoding;
+  initiating_call_ = true;
+  onComplete(std::move(response));
+  initiating_call_ = false;
+  return true;
+}
+
+void Filter::storeCachedDecision(const Filters::Common::ExtAuthz::Response& response) {
+  auto& entries = config_->decisionCache().entries_;
+  const MonotonicTime now = decoder_callbacks_->dispatcher().timeSource().monotonicTime();
+  if (entries.size() >= config_->decisionCacheMaxEntries()) {
+    // Evict expired decisions first; if everything is still live drop an arbitrary entry rather
+    // than growing without bound.
+    absl::erase_if(entries, [now](const auto& entry) { return now >= entry.second.expires_at_; });
+    if (entries.size() >= config_->decisionCacheMaxEntries()) {
+      entries.erase(entries.begin());
+    }
+  }
+
+  CachedDecision cached{now + config_->decisionCacheTtl(), response};
+  // Dynamic metadata is request specific (e.g. it carries the measured check duration), so it is
+  // not replayed onto requests served from the cache.
+  cached.response_.dynamic_metadata.Clear();
+  entries.insert_or_assign(std::move(decision_cache_key_), std::move(cached));
+}
+
 void Filter::onComplete(Filters::Common::ExtAuthz::ResponsePtr&& response) {
   state_ = State::Complete;
   using Filters::Common::ExtAuthz::CheckStatus;
   Stats::StatName empty_stat_name;
 
+  // Cache definitive decisions before the mutations below are moved out of the response. Errors
+  // are transient and never cached.
+  if (!decision_cache_key_.empty() && response->status != CheckStatus::Error) {
+    storeCachedDecision(*response);
+    decision_cache_key_.clear();
+  }
+
   if (!response->dynamic_metadata.fields().empty()) {
     // Add duration of call to dynamic metadata if applicable
     if (start_time_.has_value() && response->status == CheckStatus::OK) {
@@ -5,12 +5,14 @@
 #include <string>
 #include <vector>
 
+#include "envoy/common/time.h"
 #include "envoy/extensions/filters/http/ext_authz/v3/ext_authz.pb.h"
 #include "envoy/http/filter.h"
 #include "envoy/runtime/runtime.h"
 #include "envoy/service/auth/v3/external_auth.pb.h"
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats_macros.h"
+#include "envoy/thread_local/thread_local.h"
 #include "envoy/upstream/cluster_manager.h"
 
 #include "source/common/common/assert.h"
@@ -19,12 +21,15 @@
 #include "source/common/common/utility.h"
 #include "source/common/http/codes.h"
 #include "source/common/http/header_map_impl.h"
+#include "source/common/protobuf/utility.h"
 #include "source/common/runtime/runtime_protos.h"
 #include "source/extensions/filters/common/ext_authz/check_request_utils.h"
 #include "source/extensions/filters/common/ext_authz/ext_authz.h"
 #include "source/extensions/filters/common/ext_authz/ext_authz_grpc_impl.h"
 #include "source/extensions/filters/common/ext_authz/ext_authz_http_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -39,7 +44,9 @@ namespace ExtAuthz {
   COUNTER(denied)                                                                                  \
   COUNTER(error)                                                                                   \
   COUNTER(disabled)                                                                                \
-  COUNTER(failure_mode_allowed)
+  COUNTER(failure_mode_allowed)                                                                    \
+  COUNTER(cache_hit)                                                                               \
+  COUNTER(cache_miss)
 
 /**
  * Wrapper struct for ext_authz filter stats. @see stats_macros.h
@@ -48,6 +55,24 @@ struct ExtAuthzFilterStats {
   ALL_EXT_AUTHZ_FILTER_STATS(GENERATE_COUNTER_STRUCT)
 };
 
+/**
+ * A single cached authorization decision: the full authorization response (including header and
+ * query parameter mutations) plus when it stops being valid.
+ */
+struct CachedDecision {
+  MonotonicTime expires_at_;
+  Filters::Common::ExtAuthz::Response response_;
+};
+
+/**
+ * Per worker thread storage for cached authorization decisions. The cache is only ever touched
+ * from its worker's dispatcher thread so no locking is needed.
+ */
+class ThreadLocalDecisionCache : public ThreadLocal::ThreadLocalObject {
+public:
+  absl::flat_hash_map<std::string, CachedDecision> entries_;
+};
+
 /**
  * Configuration for the External Authorization (ext_authz) filter.
  */
@@ -57,7 +82,8 @@ class FilterConfig {
 public:
   FilterConfig(const envoy::extensions::filters::http::ext_authz::v3::ExtAuthz& config,
                Stats::Scope& scope, Runtime::Loader& runtime, Http::Context& http_context,
-               const std::string& stats_prefix, envoy::config::bootstrap::v3::Bootstrap& bootstrap)
+               const std::string& stats_prefix, envoy::config::bootstrap::v3::Bootstrap& bootstrap,
+               ThreadLocal::SlotAllocator& tls)
       : allow_partial_message_(config.with_request_body().allow_partial_message()),
         failure_mode_allow_(config.failure_mode_allow()),
         clear_route_cache_(config.clear_route_cache()),
@@ -125,6 +151,21 @@ public:
             config.allowed_headers(), true);
       }
     }
+
+    if (config.has_decision_cache()) {
+      decision_cache_ttl_ = std::chrono::milliseconds(
+          DurationUtil::durationToMilliseconds(config.decision_cache().ttl()));
+      decision_cache_max_entries_ =
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(config.decision_cache(), max_entries, 1024);
+      for (const auto& header : config.decision_cache().cache_key_headers()) {
+        decision_cache_key_headers_.emplace_back(header);
+      }
+      // A new filter config gets a fresh slot (and thus an empty cache), so pushing a config
+      // update invalidates all cached decisions.
+      decision_cache_ = ThreadLocal::TypedSlot<ThreadLocalDecisionCache>::makeUnique(tls);
+      decision_cache_->set(
+          [](Event::Dispatcher&) { return std::make_shared<ThreadLocalDecisionCache>(); });
+    }
   }
 
   bool allowPartialMessage() const { return allow_partial_message_; }
@@ -178,6 +219,14 @@ public:
     return request_header_matchers_;
   }
 
+  bool decisionCacheEnabled() const { return decision_cache_ != nullptr; }
+  ThreadLocalDecisionCache& decisionCache() { return **decision_cache_; }
+  std::chrono::milliseconds decisionCacheTtl() const { return decision_cache_ttl_; }
+  uint32_t decisionCacheMaxEntries() const { return decision_cache_max_entries_; }
+  const std::vector<Http::LowerCaseString>& decisionCacheKeyHeaders() const {
+    return decision_cache_key_headers_;
+  }
+
 private:
   static Http::Code toErrorCode(uint64_t status) {
     const auto code = static_cast<Http::Code>(status);
@@ -232,6 +281,12 @@ private:
 
   Filters::Common::ExtAuthz::MatcherSharedPtr request_header_matchers_;
 
+  // Decision cache state; decision_cache_ stays unset when caching is not configured.
+  std::chrono::milliseconds decision_cache_ttl_{};
+  uint32_t decision_cache_max_entries_{};
+  std::vector<Http::LowerCaseString> decision_cache_key_headers_;
+  ThreadLocal::TypedSlotPtr<ThreadLocalDecisionCache> decision_cache_;
+
 public:
   // TODO(nezdolik): deprecate cluster scope stats counters in favor of filter scope stats
   // (ExtAuthzFilterStats stats_).
@@ -320,6 +375,9 @@ private:
   void initiateCall(const Http::RequestHeaderMap& headers);
   void continueDecoding();
   bool isBufferFull(uint64_t num_bytes_processing) const;
+  std::string decisionCacheKey(const Http::RequestHeaderMap& headers) const;
+  bool lookupCachedDecision(const Http::RequestHeaderMap& headers);
+  void storeCachedDecision(const Filters::Common::ExtAuthz::Response& response);
 
   // This holds a set of flags defined in per-route configuration.
   struct PerRouteFlags {
@@ -356,6 +414,9 @@ private:
   bool initiating_call_{};
   bool buffer_data_{};
   bool skip_check_{false};
+  // The decision cache key for this request. Non-empty only when the cache is enabled and the
+  // check for this request missed; onComplete() stores the decision under this key.
+  std::string decision_cache_key_;
   envoy::service::auth::v3::CheckRequest check_request_{};
 };
 
@@ -318,6 +318,22 @@ FilterDataStatus Filter::onData(ProcessorState& state, Buffer::Instance& data, b
     // the ability to modify each chunk, in order. Doing this any other way would have required
     // substantial changes to the filter manager. See
     // https://github.com/envoyproxy/envoy/issues/16760 for a discussion.
+    //
+    // When max_outstanding_body_messages is configured, chunks that arrive while that many
+    // messages are unanswered are coalesced into a single pending chunk instead of producing
+    // more messages; the pending chunk is sent as soon as the processor answers an outstanding
+    // message. This bounds the message backlog on a slow processor and batches small data
+    // callbacks into fewer round trips.
+    if (state.shouldCoalesceStreamedChunk()) {
+      state.stagePendingBodyChunk(data, end_stream);
+      if (end_stream) {
+        state.setPaused(true);
+        result = FilterDataStatus::StopIterationNoBuffer;
+      } else {
+        result = FilterDataStatus::Continue;
+      }
+      break;
+    }
     switch (openStream()) {
     case StreamOpenState::Error:
       return FilterDataStatus::StopIterationNoBuffer;
@@ -135,6 +135,7 @@ public:
         filter_metadata_(config.filter_metadata()),
         allow_mode_override_(config.allow_mode_override()),
         disable_immediate_response_(config.disable_immediate_response()),
+        max_outstanding_body_messages_(config.max_outstanding_body_messages()),
         allowed_headers_(initHeaderMatchers(config.forward_rules().allowed_headers())),
         disallowed_headers_(initHeaderMatchers(config.forward_rules().disallowed_headers())) {}
 
@@ -152,6 +153,7 @@ public:
 
   bool allowModeOverride() const { return allow_mode_override_; }
   bool disableImmediateResponse() const { return disable_immediate_response_; }
+  uint32_t maxOutstandingBodyMessages() const { return max_outstanding_body_messages_; }
 
   const Filters::Common::MutationRules::Checker& mutationChecker() const {
     return mutation_checker_;
@@ -197,6 +199,9 @@ private:
   // If set to true, disable the immediate response from the ext_proc server, which means
   // closing the stream to the ext_proc server, and no more external processing.
   const bool disable_immediate_response_;
+  // Send window for STREAMED body mode; 0 means one message per data callback with no limit on
+  // the number of outstanding messages.
+  const uint32_t max_outstanding_body_messages_;
   // Empty allowed_header_ means allow all.
   const std::vector<Matchers::StringMatcherPtr> allowed_headers_;
   // Empty disallowed_header_ means disallow nothing, i.e, allow all.
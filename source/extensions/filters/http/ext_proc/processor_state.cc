@@ -268,11 +268,14 @@ absl::Status ProcessorState::handleBodyResponse(const BodyResponse& response) {
       if (queueBelowLowLimit()) {
         clearWatermark();
       }
-      if (chunk_queue_.empty()) {
+      if (chunk_queue_.empty() && !pending_body_available_) {
         onFinishProcessorCall(Grpc::Status::Ok);
       } else {
         onFinishProcessorCall(Grpc::Status::Ok, callback_state_);
       }
+      // Now that this message has been answered the send window has room again, so send any
+      // data that was coalesced while it was full.
+      flushPendingBodyChunk();
     } else if (callback_state_ == CallbackState::BufferedPartialBodyCallback) {
       // Apply changes to the buffer that we sent to the server
       Buffer::OwnedImpl chunk_data;
@@ -366,6 +369,38 @@ void ProcessorState::enqueueStreamingChunk(Buffer::Instance& data, bool end_stre
   }
 }
 
+bool ProcessorState::shouldCoalesceStreamedChunk() const {
+  const uint32_t window = filter_.config().maxOutstandingBodyMessages();
+  // Every chunk on the queue in streamed mode corresponds to exactly one unanswered message, so
+  // the queue size is the number of messages in flight. Also coalesce whenever pending data
+  // already exists so that chunks are never sent out of order.
+  return window != 0 && (pending_body_available_ || chunk_queue_.size() >= window);
+}
+
+void ProcessorState::stagePendingBodyChunk(Buffer::Instance& data, bool end_stream) {
+  ENVOY_LOG(trace, "Coalescing {} bytes while the send window is full", data.length());
+  filter_.stats().body_chunks_coalesced_.inc();
+  pending_body_chunk_.move(data);
+  pending_body_end_stream_ = pending_body_end_stream_ || end_stream;
+  pending_body_available_ = true;
+  if (queueOverHighLimit()) {
+    requestWatermark();
+  }
+}
+
+void ProcessorState::flushPendingBodyChunk() {
+  if (!pending_body_available_) {
+    return;
+  }
+  ENVOY_LOG(debug, "Sending coalesced body chunk of {} bytes, end_stream {}",
+            pending_body_chunk_.length(), pending_body_end_stream_);
+  pending_body_available_ = false;
+  auto req = filter_.setupBodyChunk(*this, pending_body_chunk_, pending_body_end_stream_);
+  enqueueStreamingChunk(pending_body_chunk_, pending_body_end_stream_);
+  pending_body_end_stream_ = false;
+  filter_.sendBodyChunk(*this, CallbackState::StreamedBodyCallback, req);
+}
+
 void ProcessorState::clearAsyncState() {
   onFinishProcessorCall(Grpc::Status::Aborted);
   if (chunkQueue().receivedData().length() > 0) {
@@ -373,6 +408,12 @@ void ProcessorState::clearAsyncState() {
     ENVOY_LOG(trace, "Injecting leftover buffer of {} bytes", chunkQueue().receivedData().length());
     injectDataToFilterChain(chunkQueue().receivedData(), all_data.end_stream);
   }
+  if (pending_body_available_ &&
+      (pending_body_chunk_.length() > 0 || pending_body_end_stream_)) {
+    ENVOY_LOG(trace, "Injecting {} bytes of coalesced pending data", pending_body_chunk_.length());
+    pending_body_available_ = false;
+    injectDataToFilterChain(pending_body_chunk_, pending_body_end_stream_);
+  }
   clearWatermark();
   continueIfNecessary();
 }
@@ -38,6 +38,7 @@ public:
   ChunkQueue& operator=(const ChunkQueue&) = delete;
   uint32_t bytesEnqueued() const { return bytes_enqueued_; }
   bool empty() const { return queue_.empty(); }
+  size_t size() const { return queue_.size(); }
   void push(Buffer::Instance& data, bool end_stream);
   QueuedChunkPtr pop(Buffer::OwnedImpl& out_data);
   const QueuedChunk& consolidate();
@@ -141,8 +142,20 @@ public:
   }
   // Consolidate all the chunks on the queue into a single one and return a reference.
   const QueuedChunk& consolidateStreamedChunks() { return chunk_queue_.consolidate(); }
-  bool queueOverHighLimit() const { return chunk_queue_.bytesEnqueued() > bufferLimit(); }
-  bool queueBelowLowLimit() const { return chunk_queue_.bytesEnqueued() < bufferLimit() / 2; }
+  bool queueOverHighLimit() const {
+    return chunk_queue_.bytesEnqueued() + pending_body_chunk_.length() > bufferLimit();
+  }
+  bool queueBelowLowLimit() const {
+    return chunk_queue_.bytesEnqueued() + pending_body_chunk_.length() < bufferLimit() / 2;
+  }
+
+  // Streamed-mode send window support. When the filter is configured with a window, chunks that
+  // arrive while chunk_queue_.size() messages are outstanding are coalesced into a single
+  // pending chunk which is sent once the processor answers an outstanding message.
+  bool shouldCoalesceStreamedChunk() const;
+  bool hasPendingBodyChunk() const { return pending_body_available_; }
+  void stagePendingBodyChunk(Buffer::Instance& data, bool end_stream);
+  void flushPendingBodyChunk();
 
   virtual Http::HeaderMap* addTrailers() PURE;
 
@@ -198,6 +211,10 @@ protected:
   // Envoy should receive at most one such message in one particular state.
   bool new_timeout_received_{false};
   ChunkQueue chunk_queue_;
+  // Data coalesced while the streamed-mode send window was full, not yet sent or enqueued.
+  Buffer::OwnedImpl pending_body_chunk_;
+  bool pending_body_end_stream_{false};
+  bool pending_body_available_{false};
   absl::optional<MonotonicTime> call_start_time_ = absl::nullopt;
   const envoy::config::core::v3::TrafficDirection traffic_direction_;
 
@@ -1,10 +1,23 @@
 #include "source/extensions/filters/http/file_system_buffer/filter.h"
 
+#include "source/common/buffer/buffer_impl.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
 namespace FileSystemBuffer {
 
+namespace {
+// One spill write is sized to take roughly this long at the write bandwidth observed so far,
+// so fast disks get large writes that amortize per-operation costs while slow disks get
+// writes small enough to keep the filter responsive.
+constexpr std::chrono::milliseconds SpillWriteTargetDuration{2};
+// Bounds for the adaptive spill write size, so one pathological measurement can't make
+// writes degenerate to single pages or to the whole memory buffer on a slow disk.
+constexpr size_t MinSpillWriteBytes = 16 * 1024;
+constexpr size_t DefaultSpillWriteBytes = 1024 * 1024;
+} // namespace
+
 FileSystemBufferFilter::FileSystemBufferFilter(
     std::shared_ptr<FileSystemBufferFilterConfig> base_config)
     : base_config_(std::move(base_config)) {}
@@ -299,6 +312,22 @@ void BufferedStreamState::close() {
 void BufferedStreamState::setConfig(
     const FileSystemBufferFilterMergedConfig::StreamConfig& config) {
   config_ = &config;
+  spill_chunk_target_ = std::min(DefaultSpillWriteBytes, config.memoryBufferBytesLimit());
+}
+
+void BufferedStreamState::recordSpillWrite(size_t bytes, MonotonicTime::duration duration) {
+  const size_t limit = config_->memoryBufferBytesLimit();
+  if (duration <= MonotonicTime::duration::zero()) {
+    // The write completed faster than the clock can measure; use the largest writes we can.
+    spill_chunk_target_ = limit;
+    return;
+  }
+  const double ideal = static_cast<double>(bytes) / std::chrono::duration<double>(duration).count() *
+                       std::chrono::duration<double>(SpillWriteTargetDuration).count();
+  // Average with the previous target so a single outlier write doesn't swing the size.
+  const double blended = (static_cast<double>(spill_chunk_target_) + ideal) / 2.0;
+  spill_chunk_target_ =
+      std::min(limit, std::max(MinSpillWriteBytes, static_cast<size_t>(blended)));
 }
 
 // If there's more in memory than there should be, and we can do anything about it, we should ask
@@ -426,14 +455,45 @@ bool FileSystemBufferFilter::maybeStorage(BufferedStreamState& state,
     }
     auto latest_memory_fragment = std::find_if(state.buffer_.rbegin(), state.buffer_.rend(),
                                                [](auto& p) { return p->isMemory(); });
-    Fragment* fragment = latest_memory_fragment->get();
-    auto size = fragment->size();
+    // Merge the run of adjacent memory fragments ending at the latest one into a single
+    // fragment, up to the adaptive spill write size, so that a body received in many small
+    // data callbacks is spilled in a few large writes instead of one write per callback.
+    auto last = std::prev(latest_memory_fragment.base());
+    auto first = last;
+    size_t size = (*last)->size();
+    while (first != state.buffer_.begin()) {
+      auto prev = std::prev(first);
+      if (!(*prev)->isMemory() || size + (*prev)->size() > state.spill_chunk_target_) {
+        break;
+      }
+      size += (*prev)->size();
+      first = prev;
+    }
+    if (first != last) {
+      Buffer::OwnedImpl merged;
+      for (auto it = first; it != std::next(last); ++it) {
+        auto piece = (*it)->extract();
+        merged.move(*piece);
+      }
+      auto pos = state.buffer_.erase(first, std::next(last));
+      last = state.buffer_.insert(pos, std::make_unique<Fragment>(merged));
+    }
+    Fragment* fragment = last->get();
     state.storage_used_ += size;
     state.storage_consumed_ += size;
     state.memory_used_ -= size;
     ENVOY_STREAM_LOG(debug, "sending buffer fragment (size={}) to storage", callbacks, size);
-    auto to_storage = fragment->toStorage(state.async_file_handle_, state.storage_offset_,
-                                          getSafeDispatch(), getOnFileActionCompleted());
+    const MonotonicTime write_start = request_callbacks_->dispatcher().timeSource().monotonicTime();
+    auto to_storage = fragment->toStorage(
+        state.async_file_handle_, state.storage_offset_, getSafeDispatch(),
+        [this, &state, size, write_start,
+         on_done = getOnFileActionCompleted()](absl::Status status) {
+          if (status.ok()) {
+            state.recordSpillWrite(size, request_callbacks_->dispatcher().timeSource().monotonicTime() -
+                                             write_start);
+          }
+          on_done(status);
+        });
     ASSERT(to_storage.ok());
     cancel_in_flight_async_action_ = to_storage.value();
     state.storage_offset_ += size;
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "envoy/common/time.h"
+
 #include "source/extensions/filters/http/file_system_buffer/filter_config.h"
 #include "source/extensions/filters/http/file_system_buffer/fragment.h"
 
@@ -33,11 +35,19 @@ struct BufferedStreamState {
   // freed storage, the storage limit can be reached even if the buffer was drained.
   size_t storage_consumed_ = 0;
   AsyncFileHandle async_file_handle_;
+  // Target size for one spill write. Adjacent memory fragments are merged up to this size
+  // before being written, so that large bodies are spilled in a few big writes rather than
+  // one write per data callback. Adapted from the bandwidth observed on completed writes
+  // (see recordSpillWrite); never exceeds the memory buffer limit.
+  size_t spill_chunk_target_ = 0;
 
   size_t bufferSize() const { return memory_used_ + storage_offset_; }
   bool shouldSendHighWatermark() const;
   bool shouldSendLowWatermark() const;
   void setConfig(const FileSystemBufferFilterMergedConfig::StreamConfig& config);
+  // Updates spill_chunk_target_ so that one write takes roughly SpillWriteTargetDuration at
+  // the observed bandwidth.
+  void recordSpillWrite(size_t bytes, MonotonicTime::duration duration);
   void close();
 };
 
@@ -1,5 +1,7 @@
 #include "source/extensions/filters/http/grpc_json_transcoder/json_transcoder_filter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <unordered_set>
 
@@ -846,6 +848,34 @@ bool JsonTranscoderFilter::checkAndRejectIfResponseTranscoderFailed() {
 
 bool JsonTranscoderFilter::readToBuffer(Protobuf::io::ZeroCopyInputStream& stream,
                                         Buffer::Instance& data) {
+  // The translator streams created by this filter all implement TranscoderInputStream, which
+  // reports how many transcoded bytes are ready to read. Copy those into a single reserved slice
+  // up front so a long stream of small messages pays one reservation instead of buffer append
+  // bookkeeping per chunk.
+  auto* transcoder_stream = dynamic_cast<TranscoderInputStream*>(&stream);
+  if (transcoder_stream != nullptr) {
+    const int64_t available = transcoder_stream->BytesAvailable();
+    if (available > 0) {
+      auto reservation = data.reserveSingleSlice(available);
+      char* dest = static_cast<char*>(reservation.slice().mem_);
+      int64_t copied = 0;
+      const void* out;
+      int size;
+      while (copied < available && stream.Next(&out, &size) && size > 0) {
+        const int64_t len = std::min<int64_t>(size, available - copied);
+        memcpy(dest + copied, out, len); // NOLINT(safe-memcpy)
+        copied += len;
+        if (len < size) {
+          // The stream produced more than the size snapshot; return the excess to the stream so
+          // the per-chunk loop below picks it up.
+          stream.BackUp(size - len);
+        }
+      }
+      reservation.commit(copied);
+    }
+  }
+
+  // Drain any chunks produced past the size snapshot and detect the end of the stream.
   const void* out;
   int size;
   while (stream.Next(&out, &size)) {
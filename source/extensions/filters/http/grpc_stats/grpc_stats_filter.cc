@@ -14,6 +14,9 @@
 #include "source/extensions/filters/http/common/pass_through_filter.h"
 #include "source/extensions/filters/http/grpc_stats/response_frame_counter.h"
 
+#include "absl/strings/str_replace.h"
+#include "absl/synchronization/mutex.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -21,6 +24,34 @@ namespace GrpcStats {
 
 namespace {
 
+using OwningKey = std::tuple<std::string, std::string>;
+using ViewKey = Grpc::Common::RequestNames;
+
+class MapHash {
+private:
+  // Use the same type for hashing all variations to ensure the same hash value from all source
+  // types.
+  using ViewTuple = std::tuple<absl::string_view, absl::string_view>;
+  static uint64_t hash(const ViewTuple& key) { return absl::Hash<ViewTuple>()(key); }
+
+public:
+  using is_transparent = void; // NOLINT(readability-identifier-naming)
+
+  uint64_t operator()(const OwningKey& key) const { return hash(key); }
+  uint64_t operator()(const ViewKey& key) const {
+    return hash(ViewTuple(key.service_, key.method_));
+  }
+};
+
+struct MapEq {
+  using is_transparent = void; // NOLINT(readability-identifier-naming)
+  bool operator()(const OwningKey& left, const OwningKey& right) const { return left == right; }
+  bool operator()(const OwningKey& left, const ViewKey& right) const {
+    return left == std::make_tuple(right.service_, right.method_);
+  }
+};
+using MapType = absl::flat_hash_map<OwningKey, Grpc::Context::RequestStatNames, MapHash, MapEq>;
+
 // A map from gRPC service/method name to symbolized stat names for the service/method.
 //
 // The expected usage pattern is that the map is populated once, and can then be queried lock-free
@@ -43,34 +74,6 @@ public:
   }
 
 private:
-  using OwningKey = std::tuple<std::string, std::string>;
-  using ViewKey = Grpc::Common::RequestNames;
-
-  class MapHash {
-  private:
-    // Use the same type for hashing all variations to ensure the same hash value from all source
-    // types.
-    using ViewTuple = std::tuple<absl::string_view, absl::string_view>;
-    static uint64_t hash(const ViewTuple& key) { return absl::Hash<ViewTuple>()(key); }
-
-  public:
-    using is_transparent = void; // NOLINT(readability-identifier-naming)
-
-    uint64_t operator()(const OwningKey& key) const { return hash(key); }
-    uint64_t operator()(const ViewKey& key) const {
-      return hash(ViewTuple(key.service_, key.method_));
-    }
-  };
-
-  struct MapEq {
-    using is_transparent = void; // NOLINT(readability-identifier-naming)
-    bool operator()(const OwningKey& left, const OwningKey& right) const { return left == right; }
-    bool operator()(const OwningKey& left, const ViewKey& right) const {
-      return left == std::make_tuple(right.service_, right.method_);
-    }
-  };
-  using MapType = absl::flat_hash_map<OwningKey, Grpc::Context::RequestStatNames, MapHash, MapEq>;
-
   // Helper for generating a populated MapType so that `map_` can be const.
   MapType populate(const envoy::config::core::v3::GrpcMethodList& method_list) {
     MapType map;
@@ -90,6 +93,47 @@ private:
   const MapType map_;
 };
 
+// A bounded cache of symbolized stat names for methods seen in stats_for_all_methods mode.
+//
+// Without it every request carries dynamically-saved stat name copies and each charge pays the
+// dynamic encoding path; with it the first request for a method symbolizes the names once and
+// subsequent requests hit one hash lookup under a briefly-held mutex. The cache is capped because
+// pooled symbols cannot be released individually, so unbounded method cardinality (e.g. an abusive
+// client) must not grow the symbol table without limit; past the cap, requests fall back to the
+// dynamic per-request names.
+class DynamicServiceMethodCache {
+public:
+  static constexpr size_t MaxCachedMethods = 1024;
+
+  DynamicServiceMethodCache(Stats::SymbolTable& symbol_table, bool replace_dots)
+      : stat_name_pool_(symbol_table), replace_dots_(replace_dots) {}
+
+  absl::optional<Grpc::Context::RequestStatNames>
+  lookup(const Grpc::Common::RequestNames& request_names) const {
+    absl::MutexLock lock(&mutex_);
+    auto it = map_.find(request_names);
+    if (it != map_.end()) {
+      return it->second;
+    }
+    if (map_.size() >= MaxCachedMethods) {
+      return {};
+    }
+    const std::string service =
+        replace_dots_ ? absl::StrReplaceAll(request_names.service_, {{".", "_"}})
+                      : std::string(request_names.service_);
+    const Grpc::Context::RequestStatNames stat_names{stat_name_pool_.add(service),
+                                                     stat_name_pool_.add(request_names.method_)};
+    map_[OwningKey(request_names.service_, request_names.method_)] = stat_names;
+    return stat_names;
+  }
+
+private:
+  mutable absl::Mutex mutex_;
+  mutable Stats::StatNamePool stat_name_pool_ ABSL_GUARDED_BY(mutex_);
+  mutable MapType map_ ABSL_GUARDED_BY(mutex_);
+  const bool replace_dots_;
+};
+
 struct Config {
   Config(const envoy::extensions::filters::http::grpc_stats::v3::FilterConfig& proto_config,
          Server::Configuration::FactoryContext& context)
@@ -105,6 +149,11 @@ struct Config {
       allowlist_.emplace(context.scope().symbolTable(),
                          proto_config.individual_method_stats_allowlist());
     }
+
+    if (stats_for_all_methods_) {
+      dynamic_stat_names_.emplace(context.scope().symbolTable(),
+                                  replace_dots_in_grpc_service_name_);
+    }
   }
   Grpc::Context& context_;
   const bool emit_filter_state_;
@@ -112,6 +161,7 @@ struct Config {
   const bool replace_dots_in_grpc_service_name_;
   const bool stats_for_all_methods_;
   absl::optional<GrpcServiceMethodToRequestNamesMap> allowlist_;
+  absl::optional<DynamicServiceMethodCache> dynamic_stat_names_;
 };
 using ConfigConstSharedPtr = std::shared_ptr<const Config>;
 
@@ -127,12 +177,20 @@ public:
       cluster_ = decoder_callbacks_->clusterInfo();
       if (cluster_) {
         if (config_->stats_for_all_methods_) {
-          // Get dynamically-allocated Context::RequestStatNames from the context.
-          if (config_->replace_dots_in_grpc_service_name_) {
-            request_names_ =
-                config_->context_.resolveDynamicServiceAndMethodWithDotReplaced(headers.Path());
-          } else {
-            request_names_ = config_->context_.resolveDynamicServiceAndMethod(headers.Path());
+          // Use symbolized stat names from the bounded method cache if possible; once the cache is
+          // full, fall back to dynamically-allocated Context::RequestStatNames from the context.
+          absl::optional<Grpc::Common::RequestNames> request_names =
+              Grpc::Common::resolveServiceAndMethod(headers.Path());
+          if (request_names) {
+            request_names_ = config_->dynamic_stat_names_->lookup(*request_names);
+            if (!request_names_.has_value()) {
+              if (config_->replace_dots_in_grpc_service_name_) {
+                request_names_ = config_->context_.resolveDynamicServiceAndMethodWithDotReplaced(
+                    headers.Path());
+              } else {
+                request_names_ = config_->context_.resolveDynamicServiceAndMethod(headers.Path());
+              }
+            }
           }
           do_stat_tracking_ = request_names_.has_value();
         } else {
@@ -45,11 +45,18 @@ Http::FilterFactoryCb HealthCheckFilterConfig::createFilterFactoryFromProtoTyped
     cluster_min_healthy_percentages = std::move(cluster_to_percentage);
   }
 
+  ClusterStatusCacheSharedPtr cluster_status_cache;
+  if (cluster_min_healthy_percentages != nullptr) {
+    cluster_status_cache = std::make_shared<ClusterStatusCache>(
+        cluster_min_healthy_percentages, context.clusterManager(), context.threadLocal());
+  }
+
   return [&context, pass_through_mode, cache_manager, header_match_data,
-          cluster_min_healthy_percentages](Http::FilterChainFactoryCallbacks& callbacks) -> void {
-    callbacks.addStreamFilter(std::make_shared<HealthCheckFilter>(context, pass_through_mode,
-                                                                  cache_manager, header_match_data,
-                                                                  cluster_min_healthy_percentages));
+          cluster_min_healthy_percentages,
+          cluster_status_cache](Http::FilterChainFactoryCallbacks& callbacks) -> void {
+    callbacks.addStreamFilter(std::make_shared<HealthCheckFilter>(
+        context, pass_through_mode, cache_manager, header_match_data,
+        cluster_min_healthy_percentages, cluster_status_cache));
   };
 }
 
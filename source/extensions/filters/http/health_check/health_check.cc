@@ -50,6 +50,100 @@ void HealthCheckCacheManager::onTimer() {
   clear_cache_timer_->enableTimer(timeout_);
 }
 
+ClusterStatusCache::ClusterStatusCache(
+    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages,
+    Upstream::ClusterManager& cluster_manager, ThreadLocal::SlotAllocator& tls)
+    : tls_(ThreadLocal::TypedSlot<ThreadLocalCache>::makeUnique(tls)) {
+  tls_->set([cluster_min_healthy_percentages, &cluster_manager](Event::Dispatcher&) {
+    return std::make_shared<ThreadLocalCache>(cluster_min_healthy_percentages, cluster_manager);
+  });
+}
+
+ClusterStatusCache::Status
+ClusterStatusCache::evaluate(Upstream::ClusterManager& cluster_manager,
+                             const ClusterMinHealthyPercentages& cluster_min_healthy_percentages,
+                             const std::function<void(Upstream::ThreadLocalCluster&)>& on_cluster) {
+  Status status;
+  status.details = &RcDetails::get().HealthCheckOk;
+  // Check the status of the specified upstream cluster(s) to determine the right response.
+  for (const auto& item : cluster_min_healthy_percentages) {
+    status.details = &RcDetails::get().HealthCheckClusterHealthy;
+    const std::string& cluster_name = item.first;
+    const uint64_t min_healthy_percentage = static_cast<uint64_t>(item.second);
+    auto* cluster = cluster_manager.getThreadLocalCluster(cluster_name);
+    if (cluster == nullptr) {
+      // If the cluster does not exist at all, consider the service unhealthy.
+      status.code = Http::Code::ServiceUnavailable;
+      status.details = &RcDetails::get().HealthCheckNoCluster;
+      break;
+    }
+    if (on_cluster != nullptr) {
+      on_cluster(*cluster);
+    }
+    const auto& endpoint_stats = cluster->info()->endpointStats();
+    const uint64_t membership_total = endpoint_stats.membership_total_.value();
+    if (membership_total == 0) {
+      // If the cluster exists but is empty, consider the service unhealthy unless
+      // the specified minimum percent healthy for the cluster happens to be zero.
+      if (min_healthy_percentage == 0UL) {
+        continue;
+      } else {
+        status.code = Http::Code::ServiceUnavailable;
+        status.details = &RcDetails::get().HealthCheckClusterEmpty;
+        break;
+      }
+    }
+    // In the general case, consider the service unhealthy if fewer than the
+    // specified percentage of the servers in the cluster are available (healthy + degraded).
+    if ((100UL * (endpoint_stats.membership_healthy_.value() +
+                  endpoint_stats.membership_degraded_.value())) <
+        membership_total * min_healthy_percentage) {
+      status.code = Http::Code::ServiceUnavailable;
+      status.details = &RcDetails::get().HealthCheckClusterUnhealthy;
+      break;
+    }
+  }
+  return status;
+}
+
+ClusterStatusCache::ThreadLocalCache::ThreadLocalCache(
+    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages,
+    Upstream::ClusterManager& cluster_manager)
+    : cluster_min_healthy_percentages_(std::move(cluster_min_healthy_percentages)),
+      cluster_manager_(cluster_manager),
+      cluster_update_handle_(cluster_manager.addThreadLocalClusterUpdateCallbacks(*this)) {}
+
+ClusterStatusCache::Status ClusterStatusCache::ThreadLocalCache::status() {
+  if (stale_) {
+    // Resubscribe to member updates while recomputing: the evaluation stops at the first cluster
+    // that makes the service unhealthy, and clusters past that one cannot change the answer until
+    // one of the examined clusters changes (which marks the cache stale again).
+    member_update_handles_.clear();
+    status_ = evaluate(cluster_manager_, *cluster_min_healthy_percentages_,
+                       [this](Upstream::ThreadLocalCluster& cluster) {
+                         member_update_handles_.emplace_back(
+                             cluster.prioritySet().addMemberUpdateCb(
+                                 [this](const Upstream::HostVector&,
+                                        const Upstream::HostVector&) { stale_ = true; }));
+                       });
+    stale_ = false;
+  }
+  return status_;
+}
+
+void ClusterStatusCache::ThreadLocalCache::onClusterAddOrUpdate(
+    absl::string_view cluster_name, Upstream::ThreadLocalClusterCommand&) {
+  if (cluster_min_healthy_percentages_->count(std::string(cluster_name)) != 0) {
+    stale_ = true;
+  }
+}
+
+void ClusterStatusCache::ThreadLocalCache::onClusterRemoval(const std::string& cluster_name) {
+  if (cluster_min_healthy_percentages_->count(cluster_name) != 0) {
+    stale_ = true;
+  }
+}
+
 Http::FilterHeadersStatus HealthCheckFilter::decodeHeaders(Http::RequestHeaderMap& headers,
                                                            bool end_stream) {
   if (Http::HeaderUtility::matchHeaders(headers, *header_match_data_)) {
@@ -132,42 +226,15 @@ void HealthCheckFilter::onComplete() {
     } else if (cluster_min_healthy_percentages_ != nullptr &&
                !cluster_min_healthy_percentages_->empty()) {
       // Check the status of the specified upstream cluster(s) to determine the right response.
-      auto& clusterManager = context_.clusterManager();
-      for (const auto& item : *cluster_min_healthy_percentages_) {
-        details = &RcDetails::get().HealthCheckClusterHealthy;
-        const std::string& cluster_name = item.first;
-        const uint64_t min_healthy_percentage = static_cast<uint64_t>(item.second);
-        auto* cluster = clusterManager.getThreadLocalCluster(cluster_name);
-        if (cluster == nullptr) {
-          // If the cluster does not exist at all, consider the service unhealthy.
-          final_status = Http::Code::ServiceUnavailable;
-          details = &RcDetails::get().HealthCheckNoCluster;
-
-          break;
-        }
-        const auto& endpoint_stats = cluster->info()->endpointStats();
-        const uint64_t membership_total = endpoint_stats.membership_total_.value();
-        if (membership_total == 0) {
-          // If the cluster exists but is empty, consider the service unhealthy unless
-          // the specified minimum percent healthy for the cluster happens to be zero.
-          if (min_healthy_percentage == 0UL) {
-            continue;
-          } else {
-            final_status = Http::Code::ServiceUnavailable;
-            details = &RcDetails::get().HealthCheckClusterEmpty;
-            break;
-          }
-        }
-        // In the general case, consider the service unhealthy if fewer than the
-        // specified percentage of the servers in the cluster are available (healthy + degraded).
-        if ((100UL * (endpoint_stats.membership_healthy_.value() +
-                      endpoint_stats.membership_degraded_.value())) <
-            membership_total * min_healthy_percentage) {
-          final_status = Http::Code::ServiceUnavailable;
-          details = &RcDetails::get().HealthCheckClusterUnhealthy;
-          break;
-        }
-      }
+      // Filters created with a cluster status cache only pay for the evaluation when the health
+      // state of a checked cluster has changed since the last probe.
+      const ClusterStatusCache::Status cluster_status =
+          cluster_status_cache_ != nullptr
+              ? cluster_status_cache_->status()
+              : ClusterStatusCache::evaluate(context_.clusterManager(),
+                                             *cluster_min_healthy_percentages_);
+      final_status = cluster_status.code;
+      details = cluster_status.details;
     }
 
     if (!Http::CodeUtility::is2xx(enumToInt(final_status))) {
@@ -5,9 +5,12 @@
 #include <memory>
 #include <string>
 
+#include "envoy/common/callback.h"
 #include "envoy/http/codes.h"
 #include "envoy/http/filter.h"
 #include "envoy/server/filter_config.h"
+#include "envoy/thread_local/thread_local.h"
+#include "envoy/upstream/cluster_manager.h"
 
 #include "source/common/http/header_utility.h"
 
@@ -55,6 +58,66 @@ using ClusterMinHealthyPercentagesConstSharedPtr =
 
 using HeaderDataVectorSharedPtr = std::shared_ptr<std::vector<Http::HeaderUtility::HeaderDataPtr>>;
 
+/**
+ * Per-worker cache of the response computed from cluster_min_healthy_percentages. Instead of
+ * walking the checked clusters' membership stats on every probe, each worker caches the last
+ * computed status and recomputes it only after one of the checked clusters has been added,
+ * updated or removed, or after membership or host health changed in one of them. Each worker
+ * owns its own cached status since thread local clusters are per-worker.
+ */
+class ClusterStatusCache {
+public:
+  struct Status {
+    Http::Code code{Http::Code::OK};
+    // Points at one of the response code details entries owned by RcDetails.
+    const std::string* details{nullptr};
+  };
+
+  ClusterStatusCache(ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages,
+                     Upstream::ClusterManager& cluster_manager, ThreadLocal::SlotAllocator& tls);
+
+  /**
+   * Computes the status directly, without caching. on_cluster, if set, is invoked for every
+   * checked cluster that currently exists in the cluster manager.
+   */
+  static Status
+  evaluate(Upstream::ClusterManager& cluster_manager,
+           const ClusterMinHealthyPercentages& cluster_min_healthy_percentages,
+           const std::function<void(Upstream::ThreadLocalCluster&)>& on_cluster = nullptr);
+
+  /**
+   * @return the cached status for the calling worker, recomputing it first if it is stale.
+   */
+  Status status() { return (**tls_).status(); }
+
+private:
+  struct ThreadLocalCache : public ThreadLocal::ThreadLocalObject,
+                            public Upstream::ClusterUpdateCallbacks {
+    ThreadLocalCache(ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages,
+                     Upstream::ClusterManager& cluster_manager);
+
+    Status status();
+
+    // Upstream::ClusterUpdateCallbacks
+    void onClusterAddOrUpdate(absl::string_view cluster_name,
+                              Upstream::ThreadLocalClusterCommand&) override;
+    void onClusterRemoval(const std::string& cluster_name) override;
+
+    const ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages_;
+    Upstream::ClusterManager& cluster_manager_;
+    const Upstream::ClusterUpdateCallbacksHandlePtr cluster_update_handle_;
+    // Keeps the member update subscriptions on the checked clusters alive. Rebuilt on every
+    // recomputation since cluster updates replace the thread local cluster and its priority set.
+    std::vector<Common::CallbackHandlePtr> member_update_handles_;
+    Status status_;
+    bool stale_{true};
+  };
+
+  const ThreadLocal::TypedSlotPtr<ThreadLocalCache> tls_;
+};
+
+using ClusterStatusCacheSharedPtr = std::shared_ptr<ClusterStatusCache>;
+
 /**
  * Health check responder filter.
  */
@@ -63,10 +126,12 @@ public:
   HealthCheckFilter(Server::Configuration::FactoryContext& context, bool pass_through_mode,
                     HealthCheckCacheManagerSharedPtr cache_manager,
                     HeaderDataVectorSharedPtr header_match_data,
-                    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages)
+                    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages,
+                    ClusterStatusCacheSharedPtr cluster_status_cache = nullptr)
       : context_(context), pass_through_mode_(pass_through_mode), cache_manager_(cache_manager),
         header_match_data_(std::move(header_match_data)),
-        cluster_min_healthy_percentages_(cluster_min_healthy_percentages) {}
+        cluster_min_healthy_percentages_(cluster_min_healthy_percentages),
+        cluster_status_cache_(std::move(cluster_status_cache)) {}
 
   // Http::StreamFilterBase
   void onDestroy() override {}
@@ -108,6 +173,7 @@ private:
   HealthCheckCacheManagerSharedPtr cache_manager_;
   const HeaderDataVectorSharedPtr header_match_data_;
   ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages_;
+  ClusterStatusCacheSharedPtr cluster_status_cache_;
 };
 
 } // namespace HealthCheck
@@ -3,15 +3,38 @@
 #include "envoy/config/core/v3/address.pb.h"
 #include "envoy/extensions/filters/http/ip_tagging/v3/ip_tagging.pb.h"
 
+#include "source/common/common/hash.h"
 #include "source/common/http/header_map_impl.h"
 #include "source/common/http/headers.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/str_join.h"
+#include "absl/synchronization/mutex.h"
 
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
 namespace IpTagging {
+namespace {
+
+// Filter configs built from byte-for-byte identical ip_tags share one immutable trie: large tag
+// feeds are expensive to build and nothing about the trie depends on the rest of the filter
+// config, so listeners (and successive config updates) with the same tag data reuse the existing
+// snapshot instead of rebuilding it. Entries are weak, so a trie lives exactly as long as some
+// config references it; expired entries are pruned on the next insertion.
+struct TrieCacheEntry {
+  std::string ip_tags_bytes;
+  std::weak_ptr<const Network::LcTrie::LcTrie<std::string>> trie;
+};
+
+absl::Mutex trie_cache_mutex;
+absl::flat_hash_map<uint64_t, TrieCacheEntry>&
+trieCache() ABSL_EXCLUSIVE_LOCKS_REQUIRED(trie_cache_mutex) {
+  static auto* cache = new absl::flat_hash_map<uint64_t, TrieCacheEntry>();
+  return *cache;
+}
+
+} // namespace
 
 IpTaggingFilterConfig::IpTaggingFilterConfig(
     const envoy::extensions::filters::http::ip_tagging::v3::IPTagging& config,
@@ -31,6 +54,27 @@ IpTaggingFilterConfig::IpTaggingFilterConfig(
     throw EnvoyException("HTTP IP Tagging Filter requires ip_tags to be specified.");
   }
 
+  // Key the shared trie cache by the serialized tag data, length-prefixed per tag so that
+  // concatenation is unambiguous. IPTag has no map fields, so serialization is deterministic for
+  // equal messages. A cache hit implies an identical config that already passed CIDR validation.
+  std::string ip_tags_bytes;
+  for (const auto& ip_tag : config.ip_tags()) {
+    stat_name_set_->rememberBuiltin(absl::StrCat(ip_tag.ip_tag_name(), ".hit"));
+    const std::string tag_bytes = ip_tag.SerializeAsString();
+    absl::StrAppend(&ip_tags_bytes, tag_bytes.size(), ":", tag_bytes);
+  }
+  const uint64_t ip_tags_hash = HashUtil::xxHash64(ip_tags_bytes);
+  {
+    absl::MutexLock lock(&trie_cache_mutex);
+    auto it = trieCache().find(ip_tags_hash);
+    if (it != trieCache().end() && it->second.ip_tags_bytes == ip_tags_bytes) {
+      trie_ = it->second.trie.lock();
+    }
+  }
+  if (trie_ != nullptr) {
+    return;
+  }
+
   std::vector<std::pair<std::string, std::vector<Network::Address::CidrRange>>> tag_data;
   tag_data.reserve(config.ip_tags().size());
   for (const auto& ip_tag : config.ip_tags()) {
@@ -50,9 +94,22 @@ IpTaggingFilterConfig::IpTaggingFilterConfig(
     }
 
     tag_data.emplace_back(ip_tag.ip_tag_name(), cidr_set);
-    stat_name_set_->rememberBuiltin(absl::StrCat(ip_tag.ip_tag_name(), ".hit"));
   }
-  trie_ = std::make_unique<Network::LcTrie::LcTrie<std::string>>(tag_data);
+
+  // The build deliberately happens outside the cache lock; two concurrent builds of the same data
+  // simply race to publish and both results are valid.
+  trie_ = std::make_shared<const Network::LcTrie::LcTrie<std::string>>(tag_data);
+
+  absl::MutexLock lock(&trie_cache_mutex);
+  auto& cache = trieCache();
+  for (auto it = cache.begin(); it != cache.end();) {
+    if (it->second.trie.expired()) {
+      cache.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  cache[ip_tags_hash] = TrieCacheEntry{std::move(ip_tags_bytes), trie_};
 }
 
 void IpTaggingFilterConfig::incCounter(Stats::StatName name) {
@@ -70,7 +70,8 @@ private:
   const Stats::StatName no_hit_;
   const Stats::StatName total_;
   const Stats::StatName unknown_tag_;
-  std::unique_ptr<Network::LcTrie::LcTrie<std::string>> trie_;
+  // Immutable and potentially shared with other filter configs built from identical ip_tags.
+  std::shared_ptr<const Network::LcTrie::LcTrie<std::string>> trie_;
 };
 
 using IpTaggingFilterConfigSharedPtr = std::shared_ptr<IpTaggingFilterConfig>;
@@ -846,6 +846,15 @@ void Filter::onDestroy() {
   if (response_stream_wrapper_.get()) {
     response_stream_wrapper_.get()->onReset();
   }
+
+  // Hand coroutines back to the setups that created them. Only coroutines that ran to completion
+  // are actually pooled; yielded or errored ones are destroyed during recycling.
+  if (request_coroutine_ != nullptr) {
+    request_setup_->recycleCoroutine(std::move(request_coroutine_));
+  }
+  if (response_coroutine_ != nullptr) {
+    response_setup_->recycleCoroutine(std::move(response_coroutine_));
+  }
 }
 
 Http::FilterHeadersStatus
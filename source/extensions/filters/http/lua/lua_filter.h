@@ -36,6 +36,10 @@ public:
     return lua_state_.createCoroutine();
   }
 
+  void recycleCoroutine(Extensions::Filters::Common::Lua::CoroutinePtr&& coroutine) {
+    lua_state_.recycleCoroutine(std::move(coroutine));
+  }
+
   int requestFunctionRef() { return lua_state_.getGlobalRef(request_function_slot_); }
   int responseFunctionRef() { return lua_state_.getGlobalRef(response_function_slot_); }
 
@@ -499,6 +503,7 @@ public:
   Http::FilterHeadersStatus decodeHeaders(Http::RequestHeaderMap& headers,
                                           bool end_stream) override {
     PerLuaCodeSetup* setup = getPerLuaCodeSetup(config_.get(), decoder_callbacks_.callbacks_);
+    request_setup_ = setup;
     const int function_ref = setup ? setup->requestFunctionRef() : LUA_REFNIL;
     return doHeaders(request_stream_wrapper_, request_coroutine_, decoder_callbacks_, function_ref,
                      setup, headers, end_stream);
@@ -520,6 +525,7 @@ public:
   Http::FilterHeadersStatus encodeHeaders(Http::ResponseHeaderMap& headers,
                                           bool end_stream) override {
     PerLuaCodeSetup* setup = getPerLuaCodeSetup(config_.get(), decoder_callbacks_.callbacks_);
+    response_setup_ = setup;
     const int function_ref = setup ? setup->responseFunctionRef() : LUA_REFNIL;
     return doHeaders(response_stream_wrapper_, response_coroutine_, encoder_callbacks_,
                      function_ref, setup, headers, end_stream);
@@ -619,6 +625,12 @@ private:
   // seems like a safer fix for now.
   Filters::Common::Lua::CoroutinePtr request_coroutine_;
   Filters::Common::Lua::CoroutinePtr response_coroutine_;
+
+  // The setups that created the coroutines above, so that finished coroutines can be handed back
+  // for reuse when the filter is destroyed. The stream holds its route for its lifetime, so a
+  // per route setup is guaranteed to outlive the filter.
+  PerLuaCodeSetup* request_setup_{};
+  PerLuaCodeSetup* response_setup_{};
 };
 
 } // namespace Lua
@@ -1,5 +1,7 @@
 #include "source/extensions/filters/http/rate_limit_quota/client_impl.h"
 
+#include <tuple>
+
 #include "source/common/tracing/http_tracer_impl.h"
 
 namespace Envoy {
@@ -11,10 +13,23 @@ RateLimitQuotaUsageReports RateLimitClientImpl::buildReport(absl::optional<size_
   RateLimitQuotaUsageReports report;
   // Build the report from quota bucket cache.
   for (const auto& [id, bucket] : quota_buckets_) {
+    uint64_t num_requests_allowed = bucket->quota_usage.num_requests_allowed;
+    uint64_t num_requests_denied = bucket->quota_usage.num_requests_denied;
+    if (global_usage_ != nullptr) {
+      // Drain the usage merged across all workers; each request is thereby reported exactly once
+      // process-wide, by whichever worker reports first. Buckets whose merged usage was already
+      // drained by another worker are omitted, except for a newly created bucket which must be
+      // announced to the RLQS server regardless.
+      std::tie(num_requests_allowed, num_requests_denied) = global_usage_->drainUsage(id);
+      if (num_requests_allowed == 0 && num_requests_denied == 0 &&
+          !(bucket_id.has_value() && bucket_id.value() == id)) {
+        continue;
+      }
+    }
     auto* usage = report.add_bucket_quota_usages();
     *usage->mutable_bucket_id() = bucket->bucket_id;
-    usage->set_num_requests_allowed(bucket->quota_usage.num_requests_allowed);
-    usage->set_num_requests_denied(bucket->quota_usage.num_requests_denied);
+    usage->set_num_requests_allowed(num_requests_allowed);
+    usage->set_num_requests_denied(num_requests_denied);
     // For the newly created bucket (i.e., `bucket_id` input is not null), its time
     // elapsed since last report is 0.
     // This case happens when we send the report to RLQS server immediately.
@@ -37,9 +52,16 @@ RateLimitQuotaUsageReports RateLimitClientImpl::buildReport(absl::optional<size_
 // bucked id in periodical report case is empty.
 void RateLimitClientImpl::sendUsageReport(absl::optional<size_t> bucket_id) {
   ASSERT(stream_ != nullptr);
-  // Build the report and then send the report to RLQS server.
+  RateLimitQuotaUsageReports report = buildReport(bucket_id);
+  // With process-level aggregation, a periodic report whose merged usage was entirely drained by
+  // another worker carries no information; skip it to avoid redundant stream traffic.
+  if (global_usage_ != nullptr && !bucket_id.has_value() && report.bucket_quota_usages().empty()) {
+    ENVOY_LOG(trace, "Periodical usage report skipped; usage already reported by another worker");
+    return;
+  }
+  // Send the report to RLQS server.
   // TODO(tyxia) Revisit end_stream, means send and close.
-  stream_->sendMessage(buildReport(bucket_id), /*end_stream=*/false);
+  stream_->sendMessage(report, /*end_stream=*/false);
 }
 
 void RateLimitClientImpl::onReceiveMessage(RateLimitQuotaResponsePtr&& response) {
@@ -61,23 +83,14 @@ void RateLimitClientImpl::onReceiveMessage(RateLimitQuotaResponsePtr&& response)
     } else {
       quota_buckets_[bucket_id]->bucket_action = action;
       // TODO(tyxia) Handle expired assignment via `assignment_time_to_live`.
-      if (quota_buckets_[bucket_id]->bucket_action.has_quota_assignment_action()) {
-        auto rate_limit_strategy = quota_buckets_[bucket_id]
-                                       ->bucket_action.quota_assignment_action()
-                                       .rate_limit_strategy();
-
-        if (rate_limit_strategy.has_token_bucket()) {
-          const auto& interval_proto = rate_limit_strategy.token_bucket().fill_interval();
-          // Convert absl::duration to int64_t seconds
-          int64_t fill_interval_sec = absl::ToInt64Seconds(
-              absl::Seconds(interval_proto.seconds()) + absl::Nanoseconds(interval_proto.nanos()));
-          double fill_rate_per_sec =
-              static_cast<double>(rate_limit_strategy.token_bucket().tokens_per_fill().value()) /
-              fill_interval_sec;
-
-          quota_buckets_[bucket_id]->token_bucket_limiter = std::make_unique<TokenBucketImpl>(
-              rate_limit_strategy.token_bucket().max_tokens(), time_source_, fill_rate_per_sec);
-        }
+      TokenBucketPtr limiter = makeTokenBucketLimiter(action, time_source_);
+      if (limiter != nullptr) {
+        quota_buckets_[bucket_id]->token_bucket_limiter = std::move(limiter);
+      }
+      // Publish the assignment so the other workers can seed their buckets without waiting for
+      // their own round trip.
+      if (global_usage_ != nullptr) {
+        global_usage_->publishAction(bucket_id, action);
       }
     }
   }
@@ -34,12 +34,13 @@ class RateLimitClientImpl : public RateLimitClient,
 public:
   RateLimitClientImpl(const Grpc::GrpcServiceConfigWithHashKey& config_with_hash_key,
                       Server::Configuration::FactoryContext& context, absl::string_view domain_name,
-                      RateLimitQuotaCallbacks* callbacks, BucketsCache& quota_buckets)
+                      RateLimitQuotaCallbacks* callbacks, BucketsCache& quota_buckets,
+                      GlobalUsageCache* global_usage = nullptr)
       : domain_name_(domain_name),
         aync_client_(
             context.clusterManager().grpcAsyncClientManager().getOrCreateRawAsyncClientWithHashKey(
                 config_with_hash_key, context.scope(), true)),
-        rlqs_callback_(callbacks), quota_buckets_(quota_buckets),
+        rlqs_callback_(callbacks), quota_buckets_(quota_buckets), global_usage_(global_usage),
         time_source_(context.mainThreadDispatcher().timeSource()) {}
 
   void onReceiveMessage(RateLimitQuotaResponsePtr&& response) override;
@@ -75,6 +76,9 @@ private:
   RateLimitQuotaCallbacks* rlqs_callback_ = nullptr;
   // Reference to quota bucket cache that is stored in TLS cache. It outlives the filter.
   BucketsCache& quota_buckets_;
+  // Process-level aggregation shared with the other workers, or nullptr when aggregation is not
+  // wired up (e.g. in tests constructing the client directly).
+  GlobalUsageCache* global_usage_;
   TimeSource& time_source_;
 };
 
@@ -86,9 +90,10 @@ inline RateLimitClientPtr
 createRateLimitClient(Server::Configuration::FactoryContext& context,
                       RateLimitQuotaCallbacks* callbacks, BucketsCache& quota_buckets,
                       absl::string_view domain_name,
-                      Grpc::GrpcServiceConfigWithHashKey& config_with_hash_key) {
+                      Grpc::GrpcServiceConfigWithHashKey& config_with_hash_key,
+                      GlobalUsageCache* global_usage = nullptr) {
   return std::make_unique<RateLimitClientImpl>(config_with_hash_key, context, domain_name,
-                                               callbacks, quota_buckets);
+                                               callbacks, quota_buckets, global_usage);
 }
 
 } // namespace RateLimitQuota
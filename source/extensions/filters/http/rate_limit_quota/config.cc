@@ -30,7 +30,8 @@ Http::FilterFactoryCb RateLimitQuotaFilterFactory::createFilterFactoryFromProtoT
           config_with_hash_key](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(std::make_shared<RateLimitQuotaFilter>(
         config, context, bucket_cache->tls.get()->quotaBuckets(),
-        bucket_cache->tls.get()->rateLimitClient(), config_with_hash_key));
+        bucket_cache->tls.get()->rateLimitClient(), config_with_hash_key,
+        bucket_cache->global_usage.get()));
   };
 }
 
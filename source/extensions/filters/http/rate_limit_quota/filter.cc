@@ -40,9 +40,11 @@ Http::FilterHeadersStatus RateLimitQuotaFilter::decodeHeaders(Http::RequestHeade
   const size_t bucket_id = MessageUtil::hash(bucket_id_proto);
   if (quota_buckets_.find(bucket_id) == quota_buckets_.end()) {
     // For first matched request, create a new bucket in the cache and sent the report to RLQS
-    // server immediately.
-    createNewBucket(bucket_id_proto, bucket_id);
-    return sendImmediateReport(bucket_id, match_action);
+    // server immediately. If another worker already received an assignment for this bucket, the
+    // new bucket is seeded from the process-wide snapshot and enforcement starts right away
+    // instead of pausing the filter chain for this worker's own round trip.
+    const bool seeded = createNewBucket(bucket_id_proto, bucket_id);
+    return sendImmediateReport(bucket_id, match_action, /*await_response=*/!seeded);
   } else {
     // Found the cached bucket entry.
     return processCachedBucket(bucket_id);
@@ -106,13 +108,13 @@ void RateLimitQuotaFilter::onDestroy() {
   // TODO(tyxia) TLS resource are not cleaned here.
 }
 
-void RateLimitQuotaFilter::createNewBucket(const BucketId& bucket_id, size_t id) {
+bool RateLimitQuotaFilter::createNewBucket(const BucketId& bucket_id, size_t id) {
   // The first matched request doesn't have quota assignment from the RLQS server yet, so the
   // action is performed based on pre-configured strategy from no assignment behavior config.
   // TODO(tyxia) Check no assignment logic for new bucket (i.e., first matched request). It
   // should not wait for RLQS server response.
   QuotaUsage quota_usage;
-  quota_usage.num_requests_allowed = 1;
+  quota_usage.num_requests_allowed = 0;
   quota_usage.num_requests_denied = 0;
   quota_usage.last_report = std::chrono::duration_cast<std::chrono::nanoseconds>(
       time_source_.monotonicTime().time_since_epoch());
@@ -121,18 +123,50 @@ void RateLimitQuotaFilter::createNewBucket(const BucketId& bucket_id, size_t id)
   std::unique_ptr<Bucket> new_bucket = std::make_unique<Bucket>();
   new_bucket->bucket_id = bucket_id;
   new_bucket->quota_usage = quota_usage;
+
+  // Seed the bucket from the process-wide assignment snapshot if another worker already received
+  // an assignment for it. When seeded, this request is counted by processCachedBucket() under the
+  // assignment rather than pre-counted as allowed here.
+  bool seeded = false;
+  if (global_usage_ != nullptr) {
+    if (auto action = global_usage_->getAction(id); action != nullptr) {
+      new_bucket->bucket_action = *action;
+      new_bucket->token_bucket_limiter = makeTokenBucketLimiter(*action, time_source_);
+      seeded = true;
+    }
+  }
+  if (!seeded) {
+    recordUsage(*new_bucket, id, /*allowed=*/true);
+  }
   quota_buckets_[id] = std::move(new_bucket);
+  return seeded;
+}
+
+void RateLimitQuotaFilter::recordUsage(Bucket& bucket, size_t id, bool allowed) {
+  // With process-level aggregation the merged counters are the source of truth for reports; the
+  // worker-local counters are only used when aggregation is not wired up.
+  if (global_usage_ != nullptr) {
+    global_usage_->recordUsage(id, allowed);
+    return;
+  }
+  if (allowed) {
+    bucket.quota_usage.num_requests_allowed += 1;
+  } else {
+    bucket.quota_usage.num_requests_denied += 1;
+  }
 }
 
 Http::FilterHeadersStatus
 RateLimitQuotaFilter::sendImmediateReport(const size_t bucket_id,
-                                          const RateLimitOnMatchAction& match_action) {
+                                          const RateLimitOnMatchAction& match_action,
+                                          bool await_response) {
   const auto& bucket_settings = match_action.bucketSettings();
 
   // Create the gRPC client if it has not been created.
   if (client_.rate_limit_client == nullptr) {
-    client_.rate_limit_client = createRateLimitClient(factory_context_, this, quota_buckets_,
-                                                      config_->domain(), config_with_hash_key_);
+    client_.rate_limit_client =
+        createRateLimitClient(factory_context_, this, quota_buckets_, config_->domain(),
+                              config_with_hash_key_, global_usage_);
   } else {
     // Callback has been reset to nullptr when filter was destroyed last time.
     // Reset it here when new filter has been created.
@@ -162,6 +196,12 @@ RateLimitQuotaFilter::sendImmediateReport(const size_t bucket_id,
   client_.send_reports_timer->enableTimer(std::chrono::milliseconds(reporting_interval));
 
   initiating_call_ = false;
+
+  // When the bucket was seeded with an assignment published by another worker there is nothing to
+  // wait for; enforce against the cached bucket right away.
+  if (!await_response) {
+    return processCachedBucket(bucket_id);
+  }
   // TODO(tyxia) Revisit later.
   // Stop the iteration for headers as well as data and trailers for the current filter and the
   // filters following.
@@ -178,17 +218,17 @@ Http::FilterHeadersStatus RateLimitQuotaFilter::processCachedBucket(size_t bucke
     // Change to switch case when more strategies are implemented.
     if (rate_limit_strategy.has_blanket_rule() &&
         rate_limit_strategy.blanket_rule() == envoy::type::v3::RateLimitStrategy::ALLOW_ALL) {
-      quota_buckets_[bucket_id]->quota_usage.num_requests_allowed += 1;
+      recordUsage(*quota_buckets_[bucket_id], bucket_id, /*allowed=*/true);
     } else if (rate_limit_strategy.has_token_bucket()) {
       ASSERT(quota_buckets_[bucket_id]->token_bucket_limiter != nullptr);
       TokenBucket* limiter = quota_buckets_[bucket_id]->token_bucket_limiter.get();
       // Try to consume 1 token from the bucket.
       if (limiter->consume(1, /*allow_partial=*/false)) {
         // Request is allowed.
-        quota_buckets_[bucket_id]->quota_usage.num_requests_allowed += 1;
+        recordUsage(*quota_buckets_[bucket_id], bucket_id, /*allowed=*/true);
       } else {
         // Request is throttled.
-        quota_buckets_[bucket_id]->quota_usage.num_requests_denied += 1;
+        recordUsage(*quota_buckets_[bucket_id], bucket_id, /*allowed=*/false);
         // TODO(tyxia) Build the customized response based on `DenyResponseSettings` if it is
         // configured.
         callbacks_->sendLocalReply(Envoy::Http::Code::TooManyRequests, "", nullptr, absl::nullopt,
@@ -50,9 +50,11 @@ public:
   RateLimitQuotaFilter(FilterConfigConstSharedPtr config,
                        Server::Configuration::FactoryContext& factory_context,
                        BucketsCache& quota_buckets, ThreadLocalClient& client,
-                       Grpc::GrpcServiceConfigWithHashKey config_with_hash_key)
+                       Grpc::GrpcServiceConfigWithHashKey config_with_hash_key,
+                       GlobalUsageCache* global_usage = nullptr)
       : config_(std::move(config)), config_with_hash_key_(config_with_hash_key),
         factory_context_(factory_context), quota_buckets_(quota_buckets), client_(client),
+        global_usage_(global_usage),
         time_source_(factory_context.mainThreadDispatcher().timeSource()) {
     createMatcher();
   }
@@ -86,13 +88,20 @@ public:
 private:
   // Create the matcher factory and matcher.
   void createMatcher();
-  // Create a new bucket and add it to the quota bucket cache.
-  void createNewBucket(const BucketId& bucket_id, size_t id);
-  // Send the report to RLQS server immediately.
+  // Create a new bucket and add it to the quota bucket cache. Returns true if the bucket was
+  // seeded with an assignment already published by another worker, in which case enforcement can
+  // start immediately instead of waiting for this worker's RLQS round trip.
+  bool createNewBucket(const BucketId& bucket_id, size_t id);
+  // Send the report to RLQS server immediately. When `await_response` is false the filter chain
+  // is not paused and the request is processed against the (seeded) cached bucket.
   Http::FilterHeadersStatus sendImmediateReport(const size_t bucket_id,
-                                                const RateLimitOnMatchAction& match_action);
+                                                const RateLimitOnMatchAction& match_action,
+                                                bool await_response = true);
 
   Http::FilterHeadersStatus processCachedBucket(size_t bucket_id);
+  // Record one allowed or denied request, into the process-wide aggregation layer when wired up
+  // and into the worker-local bucket counters otherwise.
+  void recordUsage(Bucket& bucket, size_t id, bool allowed);
   FilterConfigConstSharedPtr config_;
   Grpc::GrpcServiceConfigWithHashKey config_with_hash_key_;
   Server::Configuration::FactoryContext& factory_context_;
@@ -104,6 +113,8 @@ private:
   // Reference to the objects that are stored in TLS.
   BucketsCache& quota_buckets_;
   ThreadLocalClient& client_;
+  // Process-level aggregation shared with the other workers, or nullptr when not wired up.
+  GlobalUsageCache* global_usage_;
   TimeSource& time_source_;
 
   bool initiating_call_{};
@@ -0,0 +1,59 @@
+#include "source/extensions/filters/http/rate_limit_quota/global_usage_cache.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace RateLimitQuota {
+
+size_t GlobalUsageCache::stripeIndex() {
+  static std::atomic<size_t> next_stripe{0};
+  static thread_local size_t stripe = next_stripe++ % NumStripes;
+  return stripe;
+}
+
+GlobalUsageCache::StripedUsage& GlobalUsageCache::usageEntry(size_t bucket_hash) {
+  {
+    absl::ReaderMutexLock lock(&mutex_);
+    auto it = usage_.find(bucket_hash);
+    if (it != usage_.end()) {
+      return *it->second;
+    }
+  }
+  absl::WriterMutexLock lock(&mutex_);
+  return *usage_.try_emplace(bucket_hash, std::make_unique<StripedUsage>()).first->second;
+}
+
+void GlobalUsageCache::recordUsage(size_t bucket_hash, bool allowed) {
+  StripedUsage& usage = usageEntry(bucket_hash);
+  auto& counter = allowed ? usage.allowed_[stripeIndex()] : usage.denied_[stripeIndex()];
+  counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::pair<uint64_t, uint64_t> GlobalUsageCache::drainUsage(size_t bucket_hash) {
+  StripedUsage& usage = usageEntry(bucket_hash);
+  uint64_t allowed = 0;
+  uint64_t denied = 0;
+  for (size_t i = 0; i < NumStripes; ++i) {
+    allowed += usage.allowed_[i].exchange(0, std::memory_order_relaxed);
+    denied += usage.denied_[i].exchange(0, std::memory_order_relaxed);
+  }
+  return {allowed, denied};
+}
+
+void GlobalUsageCache::publishAction(size_t bucket_hash, const BucketAction& action) {
+  auto snapshot = std::make_shared<const BucketAction>(action);
+  absl::WriterMutexLock lock(&mutex_);
+  actions_[bucket_hash] = std::move(snapshot);
+}
+
+GlobalUsageCache::BucketActionConstSharedPtr
+GlobalUsageCache::getAction(size_t bucket_hash) const {
+  absl::ReaderMutexLock lock(&mutex_);
+  auto it = actions_.find(bucket_hash);
+  return it != actions_.end() ? it->second : nullptr;
+}
+
+} // namespace RateLimitQuota
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "envoy/service/rate_limit_quota/v3/rlqs.pb.h"
+
+#include "source/common/common/logger.h"
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace RateLimitQuota {
+
+/**
+ * Process-level aggregation layer shared by all worker threads for one filter config. Buckets are
+ * tracked per worker, so without aggregation every worker maintains and reports overlapping
+ * buckets over its own RLQS stream.
+ *
+ * Usage is recorded into striped atomic counters to avoid cache-line contention between workers.
+ * A reporting worker drains (reads and zeroes) the merged counters, so each allowed or denied
+ * request is reported to the RLQS server exactly once process-wide; the other workers' periodic
+ * reports then find nothing to send and are skipped. Quota assignments received on any worker's
+ * stream are published here so that the other workers can seed their buckets without waiting for
+ * their own round trip.
+ */
+class GlobalUsageCache : public Logger::Loggable<Logger::Id::rate_limit_quota> {
+public:
+  using BucketAction = ::envoy::service::rate_limit_quota::v3::RateLimitQuotaResponse::BucketAction;
+  using BucketActionConstSharedPtr = std::shared_ptr<const BucketAction>;
+
+  // Records one allowed or denied request against the bucket, creating its counters on first use.
+  void recordUsage(size_t bucket_hash, bool allowed);
+
+  // Atomically drains the merged usage recorded for the bucket since the last drain, by any
+  // worker. @return the pair (requests allowed, requests denied).
+  std::pair<uint64_t, uint64_t> drainUsage(size_t bucket_hash);
+
+  // Publishes the latest assignment received from the RLQS server for the bucket.
+  void publishAction(size_t bucket_hash, const BucketAction& action);
+
+  // @return the published assignment for the bucket, or nullptr if none has been received yet.
+  BucketActionConstSharedPtr getAction(size_t bucket_hash) const;
+
+private:
+  // Counter stripes; each worker sticks to one stripe so concurrent increments from different
+  // workers mostly touch different cache lines.
+  static constexpr size_t NumStripes = 8;
+
+  struct StripedUsage {
+    std::array<std::atomic<uint64_t>, NumStripes> allowed_{};
+    std::array<std::atomic<uint64_t>, NumStripes> denied_{};
+  };
+
+  // Stripe assigned to the calling thread.
+  static size_t stripeIndex();
+
+  // Looks up the bucket's counters, creating them if absent. Entries are never erased and are
+  // held by pointer, so the returned reference stays valid outside the lock.
+  StripedUsage& usageEntry(size_t bucket_hash);
+
+  // The mutex only guards the shape of the maps; counter updates are lock-free atomics and
+  // published actions are immutable snapshots swapped under the lock.
+  mutable absl::Mutex mutex_;
+  absl::flat_hash_map<size_t, std::unique_ptr<StripedUsage>> usage_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<size_t, BucketActionConstSharedPtr> actions_ ABSL_GUARDED_BY(mutex_);
+};
+
+using GlobalUsageCacheSharedPtr = std::shared_ptr<GlobalUsageCache>;
+
+} // namespace RateLimitQuota
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -11,6 +11,7 @@
 #include "source/common/protobuf/utility.h"
 #include "source/extensions/filters/http/common/factory_base.h"
 #include "source/extensions/filters/http/rate_limit_quota/client.h"
+#include "source/extensions/filters/http/rate_limit_quota/global_usage_cache.h"
 
 #include "absl/time/time.h"
 
@@ -50,6 +51,29 @@ struct Bucket {
 
 using BucketsCache = absl::flat_hash_map<size_t, std::unique_ptr<Bucket>>;
 
+// Builds the token bucket limiter for `action` if it carries a token bucket strategy, nullptr
+// otherwise. Shared by the client (on response) and the filter (when seeding a new bucket from
+// the process-wide assignment snapshot).
+inline TokenBucketPtr
+makeTokenBucketLimiter(const BucketAction& bucket_action, TimeSource& time_source) {
+  if (!bucket_action.has_quota_assignment_action()) {
+    return nullptr;
+  }
+  const auto& rate_limit_strategy = bucket_action.quota_assignment_action().rate_limit_strategy();
+  if (!rate_limit_strategy.has_token_bucket()) {
+    return nullptr;
+  }
+  const auto& interval_proto = rate_limit_strategy.token_bucket().fill_interval();
+  // Convert absl::duration to int64_t seconds
+  int64_t fill_interval_sec = absl::ToInt64Seconds(absl::Seconds(interval_proto.seconds()) +
+                                                   absl::Nanoseconds(interval_proto.nanos()));
+  double fill_rate_per_sec =
+      static_cast<double>(rate_limit_strategy.token_bucket().tokens_per_fill().value()) /
+      fill_interval_sec;
+  return std::make_unique<TokenBucketImpl>(rate_limit_strategy.token_bucket().max_tokens(),
+                                           time_source, fill_rate_per_sec);
+}
+
 struct ThreadLocalClient : public Logger::Loggable<Logger::Id::rate_limit_quota> {
   ThreadLocalClient(Envoy::Event::Dispatcher& dispatcher) {
     // Create the quota usage report method that sends the reports the RLS server periodically.
@@ -105,6 +129,8 @@ struct QuotaBucket {
     });
   }
   Envoy::ThreadLocal::TypedSlot<ThreadLocalBucket> tls;
+  // Process-level usage and assignment aggregation shared by all workers; see GlobalUsageCache.
+  GlobalUsageCacheSharedPtr global_usage{std::make_shared<GlobalUsageCache>()};
 };
 
 } // namespace RateLimitQuota
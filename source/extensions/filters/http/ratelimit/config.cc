@@ -6,9 +6,11 @@
 #include "envoy/extensions/filters/http/ratelimit/v3/rate_limit.pb.h"
 #include "envoy/extensions/filters/http/ratelimit/v3/rate_limit.pb.validate.h"
 #include "envoy/registry/registry.h"
+#include "envoy/thread_local/thread_local.h"
 
 #include "source/common/config/utility.h"
 #include "source/common/protobuf/utility.h"
+#include "source/extensions/filters/common/ratelimit/ratelimit_coalescer.h"
 #include "source/extensions/filters/common/ratelimit/ratelimit_impl.h"
 #include "source/extensions/filters/http/ratelimit/ratelimit.h"
 
@@ -30,6 +32,29 @@ Http::FilterFactoryCb RateLimitFilterConfig::createFilterFactoryFromProtoTyped(
   THROW_IF_NOT_OK(Config::Utility::checkTransportVersion(proto_config.rate_limit_service()));
   Grpc::GrpcServiceConfigWithHashKey config_with_hash_key =
       Grpc::GrpcServiceConfigWithHashKey(proto_config.rate_limit_service().grpc_service());
+
+  if (proto_config.coalesce_in_flight_requests()) {
+    // The coalescer is per worker and shared by every filter instance created from this config;
+    // the raw async client is already cached per worker, so each handle hands the coalescer the
+    // worker's client.
+    std::shared_ptr<ThreadLocal::Slot> coalescer_slot(context.threadLocal().allocateSlot());
+    coalescer_slot->set([timeout](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr {
+      return std::make_shared<Filters::Common::RateLimit::Coalescer>(timeout);
+    });
+    return [config_with_hash_key, &context, filter_config,
+            coalescer_slot](Http::FilterChainFactoryCallbacks& callbacks) -> void {
+      callbacks.addStreamFilter(std::make_shared<Filter>(
+          filter_config,
+          std::make_unique<Filters::Common::RateLimit::CoalescingClientImpl>(
+              std::static_pointer_cast<Filters::Common::RateLimit::Coalescer>(
+                  coalescer_slot->get()),
+              context.clusterManager()
+                  .grpcAsyncClientManager()
+                  .getOrCreateRawAsyncClientWithHashKey(config_with_hash_key, context.scope(),
+                                                        true))));
+    };
+  }
+
   return [config_with_hash_key, &context, timeout,
           filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(std::make_shared<Filter>(
@@ -217,11 +217,15 @@ void HttpPerRequestTapperImpl::onBody(
     const Buffer::Instance& data, Extensions::Common::Tap::TraceWrapperPtr& buffered_streamed_body,
     uint32_t max_buffered_bytes, MutableBodyChunk mutable_body_chunk,
     MutableMessage mutable_message, bool request) {
-  // Invoke body matcher.
-  request ? config_->rootMatcher().onRequestBody(data, statuses_)
-          : config_->rootMatcher().onResponseBody(data, statuses_);
+  // Invoke the body matcher, but only if the match status is not already final. Body matchers can
+  // be called once per body chunk, so skipping the match tree walk once the status can no longer
+  // change matters for large bodies.
+  const auto& match_status = config_->rootMatcher().matchStatus(statuses_);
+  if (match_status.might_change_status_) {
+    request ? config_->rootMatcher().onRequestBody(data, statuses_)
+            : config_->rootMatcher().onResponseBody(data, statuses_);
+  }
   if (config_->streaming()) {
-    const auto& match_status = config_->rootMatcher().matchStatus(statuses_);
     // Without body matching, we must have already started tracing or have not yet matched.
     ASSERT(started_streaming_trace_ || !match_status.matches_);
 
@@ -244,6 +248,13 @@ void HttpPerRequestTapperImpl::onBody(
                                                 data, 0, data.length());
     }
   } else {
+    // A buffered trace is only submitted in onDestroyLog() if the matcher ends up matching. If the
+    // match status is final and negative, the trace will never be submitted, so don't waste cycles
+    // copying body data that is guaranteed to be thrown away.
+    if (!match_status.might_change_status_ && !match_status.matches_) {
+      return;
+    }
+
     // If we are not streaming, buffer the body up to our limit.
     makeBufferedFullTraceIfNeeded();
     auto& body =
@@ -26,6 +26,8 @@
 #include "source/common/network/utility.h"
 #include "source/extensions/common/proxy_protocol/proxy_protocol_header.h"
 
+#include "absl/strings/numbers.h"
+
 using envoy::config::core::v3::ProxyProtocolPassThroughTLVs;
 using Envoy::Extensions::Common::ProxyProtocol::PROXY_PROTO_V1_SIGNATURE;
 using Envoy::Extensions::Common::ProxyProtocol::PROXY_PROTO_V1_SIGNATURE_LEN;
@@ -160,7 +162,7 @@ ReadOrParseState Filter::parseBuffer(Network::ListenerFilterBuffer& buffer) {
         Network::ProxyProtocolFilterState::key(),
         std::make_unique<Network::ProxyProtocolFilterState>(Network::ProxyProtocolData{
             proxy_protocol_header_.value().remote_address_,
-            proxy_protocol_header_.value().local_address_, parsed_tlvs_}),
+            proxy_protocol_header_.value().local_address_, std::move(parsed_tlvs_)}),
         StreamInfo::FilterState::StateType::Mutable, StreamInfo::FilterState::LifeSpan::Connection);
   }
 
@@ -303,9 +305,7 @@ bool Filter::parseV2Header(const char* buf) {
 }
 
 bool Filter::parseV1Header(const char* buf, size_t len) {
-  std::string proxy_line;
-  proxy_line.assign(buf, len);
-  const auto trimmed_proxy_line = StringUtil::rtrim(proxy_line);
+  const absl::string_view trimmed_proxy_line = StringUtil::rtrim(absl::string_view(buf, len));
 
   // Parse proxy protocol line with format: PROXY TCP4/TCP6/UNKNOWN SOURCE_ADDRESS
   // DESTINATION_ADDRESS SOURCE_PORT DESTINATION_PORT.
@@ -325,35 +325,32 @@ bool Filter::parseV1Header(const char* buf, size_t len) {
       return false;
     }
 
-    // TODO(gsagula): parseInternetAddressAndPortNoThrow() could be modified to take two string_view
-    // arguments, so we can eliminate allocation here.
-    if (line_parts[1] == "TCP4") {
-      const Network::Address::InstanceConstSharedPtr remote_address =
-          Network::Utility::parseInternetAddressAndPortNoThrow(std::string{line_parts[2]} + ":" +
-                                                               std::string{line_parts[4]});
-      const Network::Address::InstanceConstSharedPtr local_address =
-          Network::Utility::parseInternetAddressAndPortNoThrow(std::string{line_parts[3]} + ":" +
-                                                               std::string{line_parts[5]});
-
-      if (remote_address == nullptr || local_address == nullptr) {
+    if (line_parts[1] == "TCP4" || line_parts[1] == "TCP6") {
+      uint64_t remote_port;
+      uint64_t local_port;
+      if (line_parts[4].empty() || !absl::SimpleAtoi(line_parts[4], &remote_port) ||
+          remote_port > 65535 || line_parts[5].empty() ||
+          !absl::SimpleAtoi(line_parts[5], &local_port) || local_port > 65535) {
+        ENVOY_LOG(debug, "failed to read proxy protocol");
         return false;
       }
-      proxy_protocol_header_.emplace(
-          WireHeader{len, 0, 0, 0, Network::Address::IpVersion::v4, remote_address, local_address});
-      return true;
-    } else if (line_parts[1] == "TCP6") {
+
+      // The address parser needs a NUL-terminated string; textual addresses are short enough
+      // that these copies stay within the small string buffer. A mismatch between the announced
+      // protocol and the parsed address family is caught by the version check in parseBuffer().
       const Network::Address::InstanceConstSharedPtr remote_address =
-          Network::Utility::parseInternetAddressAndPortNoThrow("[" + std::string{line_parts[2]} +
-                                                               "]:" + std::string{line_parts[4]});
+          Network::Utility::parseInternetAddressNoThrow(std::string{line_parts[2]}, remote_port);
       const Network::Address::InstanceConstSharedPtr local_address =
-          Network::Utility::parseInternetAddressAndPortNoThrow("[" + std::string{line_parts[3]} +
-                                                               "]:" + std::string{line_parts[5]});
+          Network::Utility::parseInternetAddressNoThrow(std::string{line_parts[3]}, local_port);
 
       if (remote_address == nullptr || local_address == nullptr) {
         return false;
       }
-      proxy_protocol_header_.emplace(
-          WireHeader{len, 0, 0, 0, Network::Address::IpVersion::v6, remote_address, local_address});
+      proxy_protocol_header_.emplace(WireHeader{len, 0, 0, 0,
+                                                line_parts[1] == "TCP4"
+                                                    ? Network::Address::IpVersion::v4
+                                                    : Network::Address::IpVersion::v6,
+                                                remote_address, local_address});
       return true;
     } else {
       ENVOY_LOG(debug, "failed to read proxy protocol");
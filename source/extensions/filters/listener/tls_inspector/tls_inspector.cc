@@ -96,11 +96,7 @@ Config::Config(
 bssl::UniquePtr<SSL> Config::newSsl() { return bssl::UniquePtr<SSL>{SSL_new(ssl_ctx_.get())}; }
 
 Filter::Filter(const ConfigSharedPtr& config)
-    : config_(config), ssl_(config_->newSsl()),
-      requested_read_bytes_(config->initialReadBufferSize()) {
-  SSL_set_app_data(ssl_.get(), this);
-  SSL_set_accept_state(ssl_.get());
-}
+    : config_(config), requested_read_bytes_(config->initialReadBufferSize()) {}
 
 Network::FilterStatus Filter::onAccept(Network::ListenerFilterCallbacks& cb) {
   ENVOY_LOG(trace, "tls inspector: new connection accepted");
@@ -171,6 +167,28 @@ Network::FilterStatus Filter::onData(Network::ListenerFilterBuffer& buffer) {
 
 ParseState Filter::parseClientHello(const void* data, size_t len,
                                     uint64_t bytes_already_processed) {
+  // Cheap pre-check before standing up any SSL machinery: a ClientHello can only start with a
+  // TLS handshake record (content type 0x16) or, for the V2-format hellos the TLS library still
+  // sniffs for, a byte with the high bit set. Anything else is plaintext, so bail out without
+  // allocating an SSL object or copying the data into a BIO. The recorded size matches the
+  // library path, which fails after consuming the record header for non-TLS data.
+  if (bytes_already_processed == 0 && len >= SSL3_RT_HEADER_LENGTH) {
+    const uint8_t first_byte = *static_cast<const uint8_t*>(data);
+    if (first_byte != SSL3_RT_HANDSHAKE && (first_byte & 0x80) == 0) {
+      config_->stats().tls_not_found_.inc();
+      config_->stats().bytes_processed_.recordValue(SSL3_RT_HEADER_LENGTH);
+      return ParseState::Done;
+    }
+  }
+
+  if (ssl_ == nullptr) {
+    // Deferred from the constructor so that connections rejected by the pre-check above never
+    // pay for the SSL allocation.
+    ssl_ = config_->newSsl();
+    SSL_set_app_data(ssl_.get(), this);
+    SSL_set_accept_state(ssl_.get());
+  }
+
   // Ownership remains here though we pass a reference to it in `SSL_set0_rbio()`.
   bssl::UniquePtr<BIO> bio(BIO_new_mem_buf(data, len));
 
@@ -97,6 +97,8 @@ private:
   ConfigSharedPtr config_;
   Network::ListenerFilterCallbacks* cb_{};
 
+  // Created lazily on the first parse that passes the non-TLS pre-check, so plaintext
+  // connections never allocate an SSL object.
   bssl::UniquePtr<SSL> ssl_;
   uint64_t read_{0};
   bool alpn_found_{false};
@@ -6,6 +6,7 @@
 #include "envoy/common/pure.h"
 #include "envoy/type/v3/percent.pb.h"
 
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 namespace Envoy {
@@ -40,7 +41,7 @@ public:
    * Get fault type and delay given a Redis command.
    * @param command supplies the Redis command string.
    */
-  virtual const Fault* getFaultForCommand(const std::string& command) const PURE;
+  virtual const Fault* getFaultForCommand(absl::string_view command) const PURE;
 };
 
 using FaultManagerPtr = std::unique_ptr<FaultManager>;
@@ -107,7 +107,7 @@ uint64_t FaultManagerImpl::getIntegerNumeratorOfFractionalPercent(
 // 2. For each fault, calculate the amortized fault injection percentage.
 //
 // Note that we do not check to make sure the probabilities of faults are <= 100%!
-const Fault* FaultManagerImpl::getFaultForCommandInternal(const std::string& command) const {
+const Fault* FaultManagerImpl::getFaultForCommandInternal(absl::string_view command) const {
   FaultMap::const_iterator it_outer = fault_map_.find(command);
   if (it_outer != fault_map_.end()) {
     auto random_number = random_.random() % 100;
@@ -127,7 +127,7 @@ const Fault* FaultManagerImpl::getFaultForCommandInternal(const std::string& com
   return nullptr;
 }
 
-const Fault* FaultManagerImpl::getFaultForCommand(const std::string& command) const {
+const Fault* FaultManagerImpl::getFaultForCommand(absl::string_view command) const {
   if (!fault_map_.empty()) {
     if (fault_map_.count(command) > 0) {
       return getFaultForCommandInternal(command);
@@ -41,7 +41,7 @@ public:
           ::envoy::extensions::filters::network::redis_proxy::v3::RedisProxy_RedisFault>
           base_faults);
 
-  const Fault* getFaultForCommand(const std::string& command) const override;
+  const Fault* getFaultForCommand(absl::string_view command) const override;
 
   static FaultSharedPtr makeFaultForTest(Common::Redis::FaultType fault_type,
                                          std::chrono::milliseconds delay_ms) {
@@ -92,7 +92,7 @@ private:
 
   uint64_t getIntegerNumeratorOfFractionalPercent(
       absl::string_view key, const envoy::type::v3::FractionalPercent& default_value) const;
-  const Fault* getFaultForCommandInternal(const std::string& command) const;
+  const Fault* getFaultForCommandInternal(absl::string_view command) const;
   const FaultMap fault_map_;
 
 protected:
@@ -152,6 +152,11 @@ public:
   virtual void numberReturned(int32_t number_returned) PURE;
   virtual const std::list<Bson::DocumentSharedPtr>& documents() const PURE;
   virtual std::list<Bson::DocumentSharedPtr>& documents() PURE;
+
+  // Count and total byte size of the documents. Unlike documents(), these do not force a full
+  // parse of the document contents.
+  virtual uint64_t documentsCount() const PURE;
+  virtual uint64_t documentsByteSize() const PURE;
 };
 
 using ReplyMessagePtr = std::unique_ptr<ReplyMessage>;
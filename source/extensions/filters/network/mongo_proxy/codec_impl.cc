@@ -18,6 +18,47 @@ namespace Extensions {
 namespace NetworkFilters {
 namespace MongoProxy {
 
+void MessageImpl::LazyDocumentList::fromBuffer(uint64_t documents_length, Buffer::Instance& data) {
+  if (documents_length > data.length()) {
+    throw EnvoyException("invalid document list length");
+  }
+
+  // Walk the document length prefixes to validate framing and count the documents, but defer the
+  // field-level parse until something asks for the documents.
+  documents_.clear();
+  count_ = 0;
+  uint64_t offset = 0;
+  while (offset < documents_length) {
+    if (documents_length - offset < sizeof(int32_t)) {
+      throw EnvoyException("invalid document size");
+    }
+
+    const uint32_t document_size = data.peekLEInt<uint32_t>(offset);
+    if (document_size < sizeof(int32_t) || document_size > documents_length - offset) {
+      throw EnvoyException("invalid document size");
+    }
+
+    offset += document_size;
+    count_++;
+  }
+
+  raw_.move(data, documents_length);
+}
+
+void MessageImpl::LazyDocumentList::decodeAll() const {
+  while (raw_.length() > 0) {
+    documents_.emplace_back(Bson::DocumentImpl::create(raw_));
+  }
+}
+
+uint64_t MessageImpl::LazyDocumentList::byteSize() const {
+  uint64_t total = raw_.length();
+  for (const Bson::DocumentSharedPtr& document : documents_) {
+    total += document->byteSize();
+  }
+  return total;
+}
+
 std::string
 MessageImpl::documentListToString(const std::list<Bson::DocumentSharedPtr>& documents) const {
   std::stringstream out;
@@ -66,9 +107,7 @@ void InsertMessageImpl::fromBuffer(uint32_t message_length, Buffer::Instance& da
 
   flags_ = Bson::BufferHelper::removeInt32(data);
   full_collection_name_ = Bson::BufferHelper::removeCString(data);
-  while (data.length() - (original_buffer_length - message_length) > 0) {
-    documents_.emplace_back(Bson::DocumentImpl::create(data));
-  }
+  documents_.fromBuffer(message_length - (original_buffer_length - data.length()), data);
 
   ENVOY_LOG(trace, "{}", toString(true));
 }
@@ -95,7 +134,7 @@ std::string InsertMessageImpl::toString(bool full) const {
       R"EOF({{"opcode": "OP_INSERT", "id": {}, "response_to": {}, "flags": "{:#x}", "collection": "{}", )EOF"
       R"EOF("documents": {}}})EOF",
       request_id_, response_to_, flags_, full_collection_name_,
-      full ? documentListToString(documents_) : std::to_string(documents_.size()));
+      full ? documentListToString(documents_.get()) : std::to_string(documents_.count()));
 }
 
 void KillCursorsMessageImpl::fromBuffer(uint32_t, Buffer::Instance& data) {
@@ -182,15 +221,16 @@ std::string QueryMessageImpl::toString(bool full) const {
       return_fields_selector_ ? return_fields_selector_->toString() : "{}");
 }
 
-void ReplyMessageImpl::fromBuffer(uint32_t, Buffer::Instance& data) {
+void ReplyMessageImpl::fromBuffer(uint32_t message_length, Buffer::Instance& data) {
   ENVOY_LOG(trace, "decoding reply message");
+  const uint64_t original_buffer_length = data.length();
+  ASSERT(message_length <= original_buffer_length);
+
   flags_ = Bson::BufferHelper::removeInt32(data);
   cursor_id_ = Bson::BufferHelper::removeInt64(data);
   starting_from_ = Bson::BufferHelper::removeInt32(data);
   number_returned_ = Bson::BufferHelper::removeInt32(data);
-  for (int32_t i = 0; i < number_returned_; i++) {
-    documents_.emplace_back(Bson::DocumentImpl::create(data));
-  }
+  documents_.fromBuffer(message_length - (original_buffer_length - data.length()), data);
 
   ENVOY_LOG(trace, "{}", toString(true));
 }
@@ -218,7 +258,7 @@ std::string ReplyMessageImpl::toString(bool full) const {
       R"EOF({{"opcode": "OP_REPLY", "id": {}, "response_to": {}, "flags": "{:#x}", "cursor": "{}", )EOF"
       R"EOF("from": {}, "returned": {}, "documents": {}}})EOF",
       request_id_, response_to_, flags_, cursor_id_, starting_from_, number_returned_,
-      full ? documentListToString(documents_) : std::to_string(documents_.size()));
+      full ? documentListToString(documents_.get()) : std::to_string(documents_.count()));
 }
 
 /*
@@ -237,9 +277,7 @@ void CommandMessageImpl::fromBuffer(uint32_t message_length, Buffer::Instance& d
   // There may be additional docs.
   // message_length is mongo message length. original_data_length contains
   // mongo message and possibly first few bytes of next message.
-  while (data.length() - (original_data_length - message_length) > 0) {
-    input_docs_.emplace_back(Bson::DocumentImpl::create(data));
-  }
+  input_docs_.fromBuffer(message_length - (original_data_length - data.length()), data);
 
   ENVOY_LOG(trace, "{}", toString(true));
 }
@@ -251,7 +289,7 @@ std::string CommandMessageImpl::toString(bool full) const {
       R"EOF("commandArgs": {}, "inputDocs": {}}})EOF",
       request_id_, response_to_, database_.c_str(), command_name_.c_str(), metadata_->toString(),
       command_args_->toString(),
-      full ? documentListToString(input_docs_) : std::to_string(input_docs_.size()));
+      full ? documentListToString(input_docs_.get()) : std::to_string(input_docs_.count()));
 }
 
 bool CommandMessageImpl::operator==(const CommandMessage& rhs) const {
@@ -297,9 +335,7 @@ void CommandReplyMessageImpl::fromBuffer(uint32_t message_length, Buffer::Instan
   // There may be additional docs.
   // message_length is mongo message length. original_data_length contains
   // mongo message and possibly first few bytes of next message.
-  while (data.length() - (original_data_length - message_length) > 0) {
-    output_docs_.emplace_back(Bson::DocumentImpl::create(data));
-  }
+  output_docs_.fromBuffer(message_length - (original_data_length - data.length()), data);
 
   ENVOY_LOG(trace, "{}", toString(true));
 }
@@ -308,8 +344,8 @@ std::string CommandReplyMessageImpl::toString(bool full) const {
   return fmt::format(R"EOF({{"opcode": "OP_COMMANDREPLY", "id": {}, "response_to": {}, )EOF"
                      R"EOF("metadata": {}, "commandReply": {}, "outputDocs":{}}} )EOF",
                      request_id_, response_to_, metadata_->toString(), command_reply_->toString(),
-                     full ? documentListToString(output_docs_)
-                          : std::to_string(output_docs_.size()));
+                     full ? documentListToString(output_docs_.get())
+                          : std::to_string(output_docs_.count()));
 }
 
 bool CommandReplyMessageImpl::operator==(const CommandReplyMessage& rhs) const {
@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/common/logger.h"
 #include "source/extensions/filters/network/mongo_proxy/codec.h"
 
@@ -25,6 +26,33 @@ public:
   int32_t responseTo() const override { return response_to_; }
 
 protected:
+  // A list of BSON documents that is parsed lazily. fromBuffer() takes ownership of the raw
+  // document bytes and only walks their length prefixes to validate framing and count them; the
+  // field-level parse happens on first access to the documents themselves. This lets stats be
+  // generated for large messages (e.g. bulk inserts) without paying for a parse nothing reads.
+  class LazyDocumentList {
+  public:
+    void fromBuffer(uint64_t documents_length, Buffer::Instance& data);
+
+    const std::list<Bson::DocumentSharedPtr>& get() const {
+      decodeAll();
+      return documents_;
+    }
+    std::list<Bson::DocumentSharedPtr>& get() {
+      decodeAll();
+      return documents_;
+    }
+    uint64_t count() const { return raw_.length() > 0 ? count_ : documents_.size(); }
+    uint64_t byteSize() const;
+
+  private:
+    void decodeAll() const;
+
+    mutable Buffer::OwnedImpl raw_;
+    mutable std::list<Bson::DocumentSharedPtr> documents_;
+    uint64_t count_{};
+  };
+
   std::string documentListToString(const std::list<Bson::DocumentSharedPtr>& documents) const;
 
   const int32_t request_id_;
@@ -82,13 +110,13 @@ public:
   void flags(int32_t flags) override { flags_ = flags; }
   const std::string& fullCollectionName() const override { return full_collection_name_; }
   void fullCollectionName(const std::string& name) override { full_collection_name_ = name; }
-  const std::list<Bson::DocumentSharedPtr>& documents() const override { return documents_; }
-  std::list<Bson::DocumentSharedPtr>& documents() override { return documents_; }
+  const std::list<Bson::DocumentSharedPtr>& documents() const override { return documents_.get(); }
+  std::list<Bson::DocumentSharedPtr>& documents() override { return documents_.get(); }
 
 private:
   int32_t flags_{};
   std::string full_collection_name_;
-  std::list<Bson::DocumentSharedPtr> documents_;
+  LazyDocumentList documents_;
 };
 
 class KillCursorsMessageImpl : public MessageImpl,
@@ -190,15 +218,17 @@ public:
   void startingFrom(int32_t starting_from) override { starting_from_ = starting_from; }
   int32_t numberReturned() const override { return number_returned_; }
   void numberReturned(int32_t number_returned) override { number_returned_ = number_returned; }
-  const std::list<Bson::DocumentSharedPtr>& documents() const override { return documents_; }
-  std::list<Bson::DocumentSharedPtr>& documents() override { return documents_; }
+  const std::list<Bson::DocumentSharedPtr>& documents() const override { return documents_.get(); }
+  std::list<Bson::DocumentSharedPtr>& documents() override { return documents_.get(); }
+  uint64_t documentsCount() const override { return documents_.count(); }
+  uint64_t documentsByteSize() const override { return documents_.byteSize(); }
 
 private:
   int32_t flags_{};
   int64_t cursor_id_{};
   int32_t starting_from_{};
   int32_t number_returned_{};
-  std::list<Bson::DocumentSharedPtr> documents_;
+  LazyDocumentList documents_;
 };
 
 // OP_COMMAND message.
@@ -227,15 +257,15 @@ public:
   void commandArgs(Bson::DocumentSharedPtr&& command_args) override {
     command_args_ = std::move(command_args);
   }
-  const std::list<Bson::DocumentSharedPtr>& inputDocs() const override { return input_docs_; }
-  std::list<Bson::DocumentSharedPtr>& inputDocs() override { return input_docs_; }
+  const std::list<Bson::DocumentSharedPtr>& inputDocs() const override { return input_docs_.get(); }
+  std::list<Bson::DocumentSharedPtr>& inputDocs() override { return input_docs_.get(); }
 
 private:
   std::string database_;
   std::string command_name_;
   Bson::DocumentSharedPtr metadata_;
   Bson::DocumentSharedPtr command_args_;
-  std::list<Bson::DocumentSharedPtr> input_docs_;
+  LazyDocumentList input_docs_;
 };
 
 // OP_COMMANDREPLY message.
@@ -260,13 +290,13 @@ public:
   void commandReply(Bson::DocumentSharedPtr&& command_reply) override {
     command_reply_ = std::move(command_reply);
   }
-  const std::list<Bson::DocumentSharedPtr>& outputDocs() const override { return output_docs_; }
-  std::list<Bson::DocumentSharedPtr>& outputDocs() override { return output_docs_; }
+  const std::list<Bson::DocumentSharedPtr>& outputDocs() const override { return output_docs_.get(); }
+  std::list<Bson::DocumentSharedPtr>& outputDocs() override { return output_docs_.get(); }
 
 private:
   Bson::DocumentSharedPtr metadata_;
   Bson::DocumentSharedPtr command_reply_;
-  std::list<Bson::DocumentSharedPtr> output_docs_;
+  LazyDocumentList output_docs_;
 };
 
 class DecoderImpl : public Decoder, Logger::Loggable<Logger::Id::mongo> {
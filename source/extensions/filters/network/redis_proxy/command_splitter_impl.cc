@@ -3,6 +3,9 @@
 #include "source/common/common/logger.h"
 #include "source/extensions/filters/network/common/redis/supported_commands.h"
 
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/ascii.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace NetworkFilters {
@@ -14,6 +17,18 @@ namespace {
 // "asking".
 ConnPool::DoNothingPoolCallbacks null_pool_callbacks;
 
+// Inline buffer for lower-casing command names; redis command names fit without a heap
+// allocation, which matters at per-command frequency.
+using LowerCaseCommandBuffer = absl::InlinedVector<char, 32>;
+
+absl::string_view toLowerCaseCommand(const std::string& command, LowerCaseCommandBuffer& buffer) {
+  buffer.assign(command.begin(), command.end());
+  for (char& c : buffer) {
+    c = absl::ascii_tolower(c);
+  }
+  return {buffer.data(), buffer.size()};
+}
+
 /**
  * Make request and maybe mirror the request based on the mirror policies of the route.
  * @param route supplies the route matched with the request.
@@ -461,7 +476,9 @@ SplitRequestPtr TransactionRequest::create(Router& router,
                                            TimeSource& time_source, bool delay_command_latency,
                                            const StreamInfo::StreamInfo& stream_info) {
   Common::Redis::Client::Transaction& transaction = callbacks.transaction();
-  std::string command_name = absl::AsciiStrToLower(incoming_request->asArray()[0].asString());
+  LowerCaseCommandBuffer command_buffer;
+  const absl::string_view command_name =
+      toLowerCaseCommand(incoming_request->asArray()[0].asString(), command_buffer);
 
   // Within transactions we only support simple commands.
   // So if this is not a transaction command or a simple command, it is an error.
@@ -582,6 +599,10 @@ InstanceImpl::InstanceImpl(RouterPtr&& router, Stats::Scope& scope, const std::s
   for (const std::string& command : Common::Redis::SupportedCommands::transactionCommands()) {
     addHandler(scope, stat_prefix, command, latency_in_micros, transaction_handler_);
   }
+
+  // Cache the transaction handler so requests within a transaction don't re-walk the lookup
+  // table for "multi".
+  multi_handler_data_ = handler_lookup_table_.find("multi");
 }
 
 SplitRequestPtr InstanceImpl::makeRequest(Common::Redis::RespValuePtr&& request,
@@ -599,7 +620,9 @@ SplitRequestPtr InstanceImpl::makeRequest(Common::Redis::RespValuePtr&& request,
     }
   }
 
-  std::string command_name = absl::AsciiStrToLower(request->asArray()[0].asString());
+  LowerCaseCommandBuffer command_buffer;
+  const absl::string_view command_name =
+      toLowerCaseCommand(request->asArray()[0].asString(), command_buffer);
 
   if (command_name == Common::Redis::SupportedCommands::auth()) {
     if (request->asArray().size() < 2) {
@@ -667,7 +690,7 @@ SplitRequestPtr InstanceImpl::makeRequest(Common::Redis::RespValuePtr&& request,
   }
 
   // Get the handler for the downstream request
-  auto handler = handler_lookup_table_.find(command_name.c_str());
+  auto handler = handler_lookup_table_.find(command_name);
   if (handler == nullptr) {
     stats_.unsupported_command_.inc();
     callbacks.onResponse(Common::Redis::Utility::makeError(
@@ -678,7 +701,7 @@ SplitRequestPtr InstanceImpl::makeRequest(Common::Redis::RespValuePtr&& request,
   // If we are within a transaction, forward all requests to the transaction handler (i.e. handler
   // of "multi" command).
   if (callbacks.transaction().active_) {
-    handler = handler_lookup_table_.find("multi");
+    handler = multi_handler_data_;
   }
 
   // Fault Injection Check
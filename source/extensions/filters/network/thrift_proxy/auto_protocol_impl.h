@@ -87,11 +87,11 @@ public:
     protocol_->writeMessageBegin(buffer, metadata);
   }
   void writeMessageEnd(Buffer::Instance& buffer) override { protocol_->writeMessageEnd(buffer); }
-  void writeStructBegin(Buffer::Instance& buffer, const std::string& name) override {
+  void writeStructBegin(Buffer::Instance& buffer, absl::string_view name) override {
     protocol_->writeStructBegin(buffer, name);
   }
   void writeStructEnd(Buffer::Instance& buffer) override { protocol_->writeStructEnd(buffer); }
-  void writeFieldBegin(Buffer::Instance& buffer, const std::string& name, FieldType field_type,
+  void writeFieldBegin(Buffer::Instance& buffer, absl::string_view name, FieldType field_type,
                        int16_t field_id) override {
     protocol_->writeFieldBegin(buffer, name, field_type, field_id);
   }
@@ -127,10 +127,10 @@ public:
   void writeDouble(Buffer::Instance& buffer, double value) override {
     protocol_->writeDouble(buffer, value);
   }
-  void writeString(Buffer::Instance& buffer, const std::string& value) override {
+  void writeString(Buffer::Instance& buffer, absl::string_view value) override {
     protocol_->writeString(buffer, value);
   }
-  void writeBinary(Buffer::Instance& buffer, const std::string& value) override {
+  void writeBinary(Buffer::Instance& buffer, absl::string_view value) override {
     protocol_->writeBinary(buffer, value);
   }
   bool supportsUpgrade() override { return protocol_->supportsUpgrade(); }
@@ -302,7 +302,7 @@ void BinaryProtocolImpl::writeMessageEnd(Buffer::Instance& buffer) {
   UNREFERENCED_PARAMETER(buffer);
 }
 
-void BinaryProtocolImpl::writeStructBegin(Buffer::Instance& buffer, const std::string& name) {
+void BinaryProtocolImpl::writeStructBegin(Buffer::Instance& buffer, absl::string_view name) {
   UNREFERENCED_PARAMETER(buffer);
   UNREFERENCED_PARAMETER(name);
 }
@@ -311,7 +311,7 @@ void BinaryProtocolImpl::writeStructEnd(Buffer::Instance& buffer) {
   UNREFERENCED_PARAMETER(buffer);
 }
 
-void BinaryProtocolImpl::writeFieldBegin(Buffer::Instance& buffer, const std::string& name,
+void BinaryProtocolImpl::writeFieldBegin(Buffer::Instance& buffer, absl::string_view name,
                                          FieldType field_type, int16_t field_id) {
   UNREFERENCED_PARAMETER(name);
 
@@ -381,12 +381,12 @@ void BinaryProtocolImpl::writeDouble(Buffer::Instance& buffer, double value) {
   BufferHelper::writeBEDouble(buffer, value);
 }
 
-void BinaryProtocolImpl::writeString(Buffer::Instance& buffer, const std::string& value) {
+void BinaryProtocolImpl::writeString(Buffer::Instance& buffer, absl::string_view value) {
   buffer.writeBEInt<uint32_t>(value.length());
   buffer.add(value);
 }
 
-void BinaryProtocolImpl::writeBinary(Buffer::Instance& buffer, const std::string& value) {
+void BinaryProtocolImpl::writeBinary(Buffer::Instance& buffer, absl::string_view value) {
   writeString(buffer, value);
 }
 
@@ -447,7 +447,7 @@ void CompactProtocolImpl::writeMessageEnd(Buffer::Instance& buffer) {
   UNREFERENCED_PARAMETER(buffer);
 }
 
-void CompactProtocolImpl::writeStructBegin(Buffer::Instance& buffer, const std::string& name) {
+void CompactProtocolImpl::writeStructBegin(Buffer::Instance& buffer, absl::string_view name) {
   UNREFERENCED_PARAMETER(buffer);
   UNREFERENCED_PARAMETER(name);
 
@@ -468,7 +468,7 @@ void CompactProtocolImpl::writeStructEnd(Buffer::Instance& buffer) {
   last_field_id_stack_.pop();
 }
 
-void CompactProtocolImpl::writeFieldBegin(Buffer::Instance& buffer, const std::string& name,
+void CompactProtocolImpl::writeFieldBegin(Buffer::Instance& buffer, absl::string_view name,
                                           FieldType field_type, int16_t field_id) {
   UNREFERENCED_PARAMETER(name);
 
@@ -593,12 +593,12 @@ void CompactProtocolImpl::writeDouble(Buffer::Instance& buffer, double value) {
   BufferHelper::writeBEDouble(buffer, value);
 }
 
-void CompactProtocolImpl::writeString(Buffer::Instance& buffer, const std::string& value) {
+void CompactProtocolImpl::writeString(Buffer::Instance& buffer, absl::string_view value) {
   BufferHelper::writeVarIntI32(buffer, value.length());
   buffer.add(value);
 }
 
-void CompactProtocolImpl::writeBinary(Buffer::Instance& buffer, const std::string& value) {
+void CompactProtocolImpl::writeBinary(Buffer::Instance& buffer, absl::string_view value) {
   writeString(buffer, value);
 }
 
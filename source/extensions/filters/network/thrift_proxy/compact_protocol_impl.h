@@ -52,9 +52,9 @@ public:
   bool readBinary(Buffer::Instance& buffer, std::string& value) override;
   void writeMessageBegin(Buffer::Instance& buffer, const MessageMetadata& metadata) override;
   void writeMessageEnd(Buffer::Instance& buffer) override;
-  void writeStructBegin(Buffer::Instance& buffer, const std::string& name) override;
+  void writeStructBegin(Buffer::Instance& buffer, absl::string_view name) override;
   void writeStructEnd(Buffer::Instance& buffer) override;
-  void writeFieldBegin(Buffer::Instance& buffer, const std::string& name, FieldType field_type,
+  void writeFieldBegin(Buffer::Instance& buffer, absl::string_view name, FieldType field_type,
                        int16_t field_id) override;
   void writeFieldEnd(Buffer::Instance& buffer) override;
   void writeMapBegin(Buffer::Instance& buffer, FieldType key_type, FieldType value_type,
@@ -70,8 +70,8 @@ public:
   void writeInt32(Buffer::Instance& buffer, int32_t value) override;
   void writeInt64(Buffer::Instance& buffer, int64_t value) override;
   void writeDouble(Buffer::Instance& buffer, double value) override;
-  void writeString(Buffer::Instance& buffer, const std::string& value) override;
-  void writeBinary(Buffer::Instance& buffer, const std::string& value) override;
+  void writeString(Buffer::Instance& buffer, absl::string_view value) override;
+  void writeBinary(Buffer::Instance& buffer, absl::string_view value) override;
 
   static bool isMagic(uint16_t word) { return (word & MagicMask) == Magic; }
 
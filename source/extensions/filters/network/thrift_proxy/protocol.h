@@ -288,7 +288,7 @@ public:
    * @param buffer Buffer::Instance to modify
    * @param name the struct name, if known
    */
-  virtual void writeStructBegin(Buffer::Instance& buffer, const std::string& name) PURE;
+  virtual void writeStructBegin(Buffer::Instance& buffer, absl::string_view name) PURE;
 
   /**
    * Writes the end of a Thrift struct to the buffer.
@@ -303,7 +303,7 @@ public:
    * @param field_type the field's FieldType
    * @param field_id the field ID
    */
-  virtual void writeFieldBegin(Buffer::Instance& buffer, const std::string& name,
+  virtual void writeFieldBegin(Buffer::Instance& buffer, absl::string_view name,
                                FieldType field_type, int16_t field_id) PURE;
 
   /**
@@ -403,14 +403,14 @@ public:
    * @param buffer Buffer::Instance to modify
    * @param value std::string to write
    */
-  virtual void writeString(Buffer::Instance& buffer, const std::string& value) PURE;
+  virtual void writeString(Buffer::Instance& buffer, absl::string_view value) PURE;
 
   /**
    * Writes a binary value to the buffer.
    * @param buffer Buffer::Instance to modify
    * @param value std::string to write
    */
-  virtual void writeBinary(Buffer::Instance& buffer, const std::string& value) PURE;
+  virtual void writeBinary(Buffer::Instance& buffer, absl::string_view value) PURE;
 
   /**
    * Indicates whether a protocol uses start-of-connection messages to negotiate protocol options.
@@ -45,7 +45,7 @@ public:
   }
 
   FilterStatus structBegin(absl::string_view name) override {
-    proto_->writeStructBegin(*buffer_, std::string(name));
+    proto_->writeStructBegin(*buffer_, name);
     return FilterStatus::Continue;
   }
 
@@ -57,7 +57,7 @@ public:
 
   FilterStatus fieldBegin(absl::string_view name, FieldType& field_type,
                           int16_t& field_id) override {
-    proto_->writeFieldBegin(*buffer_, std::string(name), field_type, field_id);
+    proto_->writeFieldBegin(*buffer_, name, field_type, field_id);
     return FilterStatus::Continue;
   }
 
@@ -97,7 +97,7 @@ public:
   }
 
   FilterStatus stringValue(absl::string_view value) override {
-    proto_->writeString(*buffer_, std::string(value));
+    proto_->writeString(*buffer_, value);
     return FilterStatus::Continue;
   }
 
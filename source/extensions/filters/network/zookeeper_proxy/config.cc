@@ -50,7 +50,8 @@ Network::FilterFactoryCb ZooKeeperConfigFactory::createFilterFactoryFromProtoTyp
   ZooKeeperFilterConfigSharedPtr filter_config(std::make_shared<ZooKeeperFilterConfig>(
       stat_prefix, max_packet_bytes, enable_per_opcode_request_bytes_metrics,
       enable_per_opcode_response_bytes_metrics, enable_latency_threshold_metrics,
-      default_latency_threshold, latency_threshold_overrides, context.scope()));
+      default_latency_threshold, latency_threshold_overrides,
+      proto_config.header_only_decode_opcodes(), context.scope()));
   auto& time_source = context.mainThreadDispatcher().timeSource();
 
   return [filter_config, &time_source](Network::FilterManager& filter_manager) -> void {
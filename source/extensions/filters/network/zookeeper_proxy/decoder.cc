@@ -100,6 +100,16 @@ absl::optional<OpCodes> DecoderImpl::decodeOnData(Buffer::Instance& data, uint64
   const int32_t oc = helper_.peekInt32(data, offset);
   ENVOY_LOG(trace, "zookeeper_proxy: decoding request with opcode {} at offset {}", oc, offset);
   const auto opcode = static_cast<OpCodes>(oc);
+
+  // For opcodes configured for header-only decode, skip the body parse entirely. The request is
+  // still tracked by xid, so response, latency and byte metrics are unaffected; only the
+  // per-request callbacks (and the dynamic metadata they emit) are skipped.
+  if (header_only_decode_opcodes_.contains(opcode)) {
+    offset += len - XID_LENGTH - OPCODE_LENGTH;
+    requests_by_xid_[xid] = {opcode, std::move(start_time)};
+    return opcode;
+  }
+
   switch (opcode) {
   case OpCodes::GetData:
     parseGetDataRequest(data, offset, len);
@@ -11,6 +11,7 @@
 #include "source/common/common/logger.h"
 #include "source/extensions/filters/network/zookeeper_proxy/utils.h"
 
+#include "absl/container/flat_hash_set.h"
 #include "absl/container/node_hash_map.h"
 
 namespace Envoy {
@@ -129,9 +130,11 @@ using DecoderPtr = std::unique_ptr<Decoder>;
 class DecoderImpl : public Decoder, Logger::Loggable<Logger::Id::filter> {
 public:
   explicit DecoderImpl(DecoderCallbacks& callbacks, uint32_t max_packet_bytes,
-                       TimeSource& time_source)
+                       TimeSource& time_source,
+                       absl::flat_hash_set<OpCodes> header_only_decode_opcodes = {})
       : callbacks_(callbacks), max_packet_bytes_(max_packet_bytes), helper_(max_packet_bytes),
-        time_source_(time_source) {}
+        time_source_(time_source),
+        header_only_decode_opcodes_(std::move(header_only_decode_opcodes)) {}
 
   // ZooKeeperProxy::Decoder
   Network::FilterStatus onData(Buffer::Instance& data) override;
@@ -194,6 +197,8 @@ private:
   const uint32_t max_packet_bytes_;
   BufferHelper helper_;
   TimeSource& time_source_;
+  // Data request opcodes for which only the header is decoded; the body parse is skipped.
+  const absl::flat_hash_set<OpCodes> header_only_decode_opcodes_;
   absl::flat_hash_map<int32_t, RequestBegin> requests_by_xid_;
   // Different from transaction ids of data requests, the transaction ids (XidCodes) of same kind of
   // control requests are always the same. Therefore, we use a queue for each kind of control
@@ -26,7 +26,8 @@ ZooKeeperFilterConfig::ZooKeeperFilterConfig(
     const bool enable_per_opcode_response_bytes_metrics,
     const bool enable_latency_threshold_metrics,
     const std::chrono::milliseconds default_latency_threshold,
-    const LatencyThresholdOverrideList& latency_threshold_overrides, Stats::Scope& scope)
+    const LatencyThresholdOverrideList& latency_threshold_overrides,
+    const HeaderOnlyDecodeOpcodeList& header_only_decode_opcodes, Stats::Scope& scope)
     : scope_(scope), max_packet_bytes_(max_packet_bytes), stats_(generateStats(stat_prefix, scope)),
       stat_name_set_(scope.symbolTable().makeSet("Zookeeper")),
       stat_prefix_(stat_name_set_->add(stat_prefix)), auth_(stat_name_set_->add("auth")),
@@ -35,6 +36,7 @@ ZooKeeperFilterConfig::ZooKeeperFilterConfig(
       unknown_opcode_latency_(stat_name_set_->add("unknown_opcode_latency")),
       enable_per_opcode_request_bytes_metrics_(enable_per_opcode_request_bytes_metrics),
       enable_per_opcode_response_bytes_metrics_(enable_per_opcode_response_bytes_metrics),
+      header_only_decode_opcodes_(parseHeaderOnlyDecodeOpcodes(header_only_decode_opcodes)),
       enable_latency_threshold_metrics_(enable_latency_threshold_metrics),
       default_latency_threshold_(default_latency_threshold),
       latency_threshold_override_map_(parseLatencyThresholdOverrides(latency_threshold_overrides)) {
@@ -176,6 +178,16 @@ LatencyThresholdOverrideMap ZooKeeperFilterConfig::parseLatencyThresholdOverride
   return latency_threshold_override_map;
 }
 
+absl::flat_hash_set<OpCodes> ZooKeeperFilterConfig::parseHeaderOnlyDecodeOpcodes(
+    const HeaderOnlyDecodeOpcodeList& header_only_decode_opcodes) {
+  absl::flat_hash_set<OpCodes> opcodes;
+  for (const int opcode : header_only_decode_opcodes) {
+    opcodes.insert(static_cast<OpCodes>(
+        getOpCodeIndex(static_cast<LatencyThresholdOverride_Opcode>(opcode))));
+  }
+  return opcodes;
+}
+
 ZooKeeperFilter::ZooKeeperFilter(ZooKeeperFilterConfigSharedPtr config, TimeSource& time_source)
     : config_(std::move(config)), decoder_(createDecoder(*this, time_source)) {}
 
@@ -196,7 +208,8 @@ Network::FilterStatus ZooKeeperFilter::onWrite(Buffer::Instance& data, bool) {
 Network::FilterStatus ZooKeeperFilter::onNewConnection() { return Network::FilterStatus::Continue; }
 
 DecoderPtr ZooKeeperFilter::createDecoder(DecoderCallbacks& callbacks, TimeSource& time_source) {
-  return std::make_unique<DecoderImpl>(callbacks, config_->maxPacketBytes(), time_source);
+  return std::make_unique<DecoderImpl>(callbacks, config_->maxPacketBytes(), time_source,
+                                       config_->header_only_decode_opcodes_);
 }
 
 void ZooKeeperFilter::setDynamicMetadata(const std::string& key, const std::string& value) {
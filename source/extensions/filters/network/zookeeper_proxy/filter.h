@@ -214,6 +214,8 @@ using envoy::extensions::filters::network::zookeeper_proxy::v3::LatencyThreshold
 using LatencyThresholdOverrideList = Protobuf::RepeatedPtrField<LatencyThresholdOverride>;
 using LatencyThresholdOverrideMap = absl::flat_hash_map<int32_t, std::chrono::milliseconds>;
 using OpcodeMap = absl::flat_hash_map<LatencyThresholdOverride_Opcode, int32_t>;
+// Repeated proto enums are represented as repeated int fields.
+using HeaderOnlyDecodeOpcodeList = Protobuf::RepeatedField<int>;
 
 /**
  * Configuration for the ZooKeeper proxy filter.
@@ -226,6 +228,7 @@ public:
                         const bool enable_latency_threshold_metrics,
                         const std::chrono::milliseconds default_latency_threshold,
                         const LatencyThresholdOverrideList& latency_threshold_overrides,
+                        const HeaderOnlyDecodeOpcodeList& header_only_decode_opcodes,
                         Stats::Scope& scope);
 
   const ZooKeeperProxyStats& stats() { return stats_; }
@@ -261,6 +264,8 @@ public:
   const Stats::StatName unknown_opcode_latency_;
   const bool enable_per_opcode_request_bytes_metrics_;
   const bool enable_per_opcode_response_bytes_metrics_;
+  // Opcodes for which the decoder only parses the request header and skips the body.
+  const absl::flat_hash_set<OpCodes> header_only_decode_opcodes_;
 
   ErrorBudgetResponseType errorBudgetDecision(const OpCodes opcode,
                                               const std::chrono::milliseconds latency) const;
@@ -307,6 +312,8 @@ private:
   int32_t getOpCodeIndex(LatencyThresholdOverride_Opcode opcode);
   LatencyThresholdOverrideMap
   parseLatencyThresholdOverrides(const LatencyThresholdOverrideList& latency_threshold_overrides);
+  absl::flat_hash_set<OpCodes>
+  parseHeaderOnlyDecodeOpcodes(const HeaderOnlyDecodeOpcodeList& header_only_decode_opcodes);
 
   const bool enable_latency_threshold_metrics_;
   const std::chrono::milliseconds default_latency_threshold_;
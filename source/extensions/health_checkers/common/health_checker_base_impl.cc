@@ -1,5 +1,8 @@
 #include "source/extensions/health_checkers/common/health_checker_base_impl.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "envoy/config/core/v3/address.pb.h"
 #include "envoy/config/core/v3/health_check.pb.h"
 #include "envoy/data/core/v3/health_check_event.pb.h"
@@ -7,6 +10,7 @@
 
 #include "source/common/network/utility.h"
 #include "source/common/router/router.h"
+#include "source/common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Upstream {
@@ -37,7 +41,9 @@ HealthCheckerImplBase::HealthCheckerImplBase(const Cluster& cluster,
           PROTOBUF_GET_MS_OR_DEFAULT(config, unhealthy_edge_interval, unhealthy_interval_.count())),
       healthy_edge_interval_(
           PROTOBUF_GET_MS_OR_DEFAULT(config, healthy_edge_interval, interval_.count())),
-      transport_socket_options_(initTransportSocketOptions(config)),
+      shared_interval_timer_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.health_check_shared_interval_timer")),
+      probe_scheduler_(dispatcher), transport_socket_options_(initTransportSocketOptions(config)),
       transport_socket_match_metadata_(initTransportSocketMatchMetadata(config)),
       member_update_cb_{cluster_.prioritySet().addMemberUpdateCb(
           [this](const HostVector& hosts_added, const HostVector& hosts_removed) -> void {
@@ -235,10 +241,59 @@ void HealthCheckerImplBase::start() {
   }
 }
 
+void HealthCheckerImplBase::ProbeScheduler::schedule(ActiveHealthCheckSession& session,
+                                                     std::chrono::milliseconds delay) {
+  cancel(session);
+  if (timer_ == nullptr) {
+    timer_ = dispatcher_.createTimer([this]() -> void { onTick(); });
+  }
+  session.pending_probe_ =
+      pending_probes_.emplace(dispatcher_.timeSource().monotonicTime() + delay, &session);
+  armTimer();
+}
+
+void HealthCheckerImplBase::ProbeScheduler::cancel(ActiveHealthCheckSession& session) {
+  if (!session.pending_probe_.has_value()) {
+    return;
+  }
+  pending_probes_.erase(*session.pending_probe_);
+  session.pending_probe_.reset();
+  // The timer is deliberately not re-armed here: if the erased entry held the earliest deadline
+  // the timer simply fires early, finds nothing due and re-arms itself in onTick().
+}
+
+void HealthCheckerImplBase::ProbeScheduler::onTick() {
+  // Run every session that is due in this tick. Probing a session can re-enter schedule() or
+  // cancel() (an inline response reschedules the session, and a member update can remove another
+  // one), so sessions are popped one at a time rather than collected up front.
+  const MonotonicTime now = dispatcher_.timeSource().monotonicTime();
+  while (!pending_probes_.empty() && pending_probes_.begin()->first <= now) {
+    ActiveHealthCheckSession* session = pending_probes_.begin()->second;
+    pending_probes_.erase(pending_probes_.begin());
+    session->pending_probe_.reset();
+    session->onIntervalBase();
+  }
+  armTimer();
+}
+
+void HealthCheckerImplBase::ProbeScheduler::armTimer() {
+  if (pending_probes_.empty()) {
+    timer_->disableTimer();
+    return;
+  }
+  // Rounding up avoids firing just before the earliest deadline and re-arming with a zero delay.
+  timer_->enableTimer(std::max(std::chrono::ceil<std::chrono::milliseconds>(
+                                   pending_probes_.begin()->first -
+                                   dispatcher_.timeSource().monotonicTime()),
+                               std::chrono::milliseconds::zero()));
+}
+
 HealthCheckerImplBase::ActiveHealthCheckSession::ActiveHealthCheckSession(
     HealthCheckerImplBase& parent, HostSharedPtr host)
     : host_(host), parent_(parent),
-      interval_timer_(parent.dispatcher_.createTimer([this]() -> void { onIntervalBase(); })),
+      interval_timer_(parent.shared_interval_timer_ ? nullptr
+                                                    : parent.dispatcher_.createTimer(
+                                                          [this]() -> void { onIntervalBase(); })),
       timeout_timer_(parent.dispatcher_.createTimer([this]() -> void { onTimeoutBase(); })),
       time_source_(parent.dispatcher_.timeSource()) {
 
@@ -254,12 +309,13 @@ HealthCheckerImplBase::ActiveHealthCheckSession::ActiveHealthCheckSession(
 HealthCheckerImplBase::ActiveHealthCheckSession::~ActiveHealthCheckSession() {
   // Make sure onDeferredDeleteBase() has been called. We should not reference our parent at this
   // point since we may have been deferred deleted.
-  ASSERT(interval_timer_ == nullptr && timeout_timer_ == nullptr);
+  ASSERT(interval_timer_ == nullptr && timeout_timer_ == nullptr && !pending_probe_.has_value());
 }
 
 void HealthCheckerImplBase::ActiveHealthCheckSession::onDeferredDeleteBase() {
-  // The session is about to be deferred deleted. Make sure all timers are gone and any
-  // implementation specific state is destroyed.
+  // The session is about to be deferred deleted. Make sure all timers and any pending shared
+  // scheduler probe are gone and any implementation specific state is destroyed.
+  parent_.probe_scheduler_.cancel(*this);
   interval_timer_.reset();
   timeout_timer_.reset();
   if (!host_->healthFlagGet(Host::HealthFlag::FAILED_ACTIVE_HC)) {
@@ -334,7 +390,7 @@ void HealthCheckerImplBase::ActiveHealthCheckSession::handleSuccess(bool degrade
   parent_.runCallbacks(host_, changed_state);
 
   timeout_timer_->disableTimer();
-  interval_timer_->enableTimer(parent_.interval(HealthState::Healthy, changed_state));
+  scheduleNextProbe(parent_.interval(HealthState::Healthy, changed_state));
 }
 
 namespace {
@@ -399,10 +455,16 @@ void HealthCheckerImplBase::ActiveHealthCheckSession::handleFailure(
   // It's possible that the previous call caused this session to be deferred deleted.
   if (timeout_timer_ != nullptr) {
     timeout_timer_->disableTimer();
+    scheduleNextProbe(parent_.interval(HealthState::Unhealthy, changed_state));
   }
+}
 
+void HealthCheckerImplBase::ActiveHealthCheckSession::scheduleNextProbe(
+    std::chrono::milliseconds interval) {
   if (interval_timer_ != nullptr) {
-    interval_timer_->enableTimer(parent_.interval(HealthState::Unhealthy, changed_state));
+    interval_timer_->enableTimer(interval);
+  } else {
+    parent_.probe_scheduler_.schedule(*this, interval);
   }
 }
 
@@ -433,8 +495,7 @@ void HealthCheckerImplBase::ActiveHealthCheckSession::onInitialInterval() {
   if (parent_.initial_jitter_.count() == 0) {
     onIntervalBase();
   } else {
-    interval_timer_->enableTimer(
-        std::chrono::milliseconds(parent_.intervalWithJitter(0, parent_.initial_jitter_)));
+    scheduleNextProbe(parent_.intervalWithJitter(0, parent_.initial_jitter_));
   }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+
 #include "envoy/access_log/access_log.h"
 #include "envoy/common/callback.h"
 #include "envoy/common/random_generator.h"
@@ -15,6 +17,8 @@
 #include "source/common/common/matchers.h"
 #include "source/common/network/transport_socket_options_impl.h"
 
+#include "absl/types/optional.h"
+
 namespace Envoy {
 namespace Upstream {
 
@@ -56,6 +60,38 @@ public:
   }
 
 protected:
+  class ActiveHealthCheckSession;
+
+  /**
+   * Schedules the interval probes of every session of a health checker behind a single dispatcher
+   * timer instead of one Event::Timer per host. The timer is armed for the earliest pending
+   * deadline and every session that is due when it fires is probed in the same tick. Only used
+   * when the health_check_shared_interval_timer runtime feature is enabled.
+   */
+  class ProbeScheduler {
+  public:
+    using PendingProbes = std::multimap<MonotonicTime, ActiveHealthCheckSession*>;
+
+    explicit ProbeScheduler(Event::Dispatcher& dispatcher) : dispatcher_(dispatcher) {}
+
+    // Schedules (or reschedules) the session's next probe after the given delay.
+    void schedule(ActiveHealthCheckSession& session, std::chrono::milliseconds delay);
+    // Removes the session's pending probe, if there is one.
+    void cancel(ActiveHealthCheckSession& session);
+
+  private:
+    void onTick();
+    void armTimer();
+
+    Event::Dispatcher& dispatcher_;
+    // Created lazily on the first schedule() so that health checkers running with per-host
+    // interval timers never allocate it.
+    Event::TimerPtr timer_;
+    // Pending probes ordered by deadline. Iterators into a std::multimap stay valid across
+    // insertion and erasure of other entries, so each session holds one to its own entry.
+    PendingProbes pending_probes_;
+  };
+
   class ActiveHealthCheckSession : public Event::DeferredDeletable {
   public:
     ~ActiveHealthCheckSession() override;
@@ -83,10 +119,16 @@ protected:
     void onTimeoutBase();
     virtual void onDeferredDelete() PURE;
     void onInitialInterval();
+    void scheduleNextProbe(std::chrono::milliseconds interval);
+
+    friend class ProbeScheduler;
 
     HealthCheckerImplBase& parent_;
+    // Null when the shared interval timer runtime feature is enabled; interval probes then go
+    // through the parent's ProbeScheduler instead.
     Event::TimerPtr interval_timer_;
     Event::TimerPtr timeout_timer_;
+    absl::optional<ProbeScheduler::PendingProbes::iterator> pending_probe_;
     uint32_t num_unhealthy_{};
     uint32_t num_healthy_{};
     bool first_check_{true};
@@ -156,6 +198,8 @@ private:
   const std::chrono::milliseconds unhealthy_interval_;
   const std::chrono::milliseconds unhealthy_edge_interval_;
   const std::chrono::milliseconds healthy_edge_interval_;
+  const bool shared_interval_timer_;
+  ProbeScheduler probe_scheduler_;
   absl::node_hash_map<HostSharedPtr, ActiveHealthCheckSessionPtr> active_sessions_;
   const std::shared_ptr<const Network::TransportSocketOptionsImpl> transport_socket_options_;
   const MetadataConstSharedPtr transport_socket_match_metadata_;
@@ -40,15 +40,25 @@ public:
     auto entry = cache_.lookup(request_);
     body_ = std::move(entry.body_);
     trailers_ = std::move(entry.trailers_);
+    const uint64_t body_size = body_ ? body_->size() : 0;
     cb(entry.response_headers_ ? request_.makeLookupResult(std::move(entry.response_headers_),
-                                                           std::move(entry.metadata_), body_.size(),
+                                                           std::move(entry.metadata_), body_size,
                                                            trailers_ != nullptr)
                                : LookupResult{});
   }
 
   void getBody(const AdjustedByteRange& range, LookupBodyCallback&& cb) override {
-    ASSERT(range.end() <= body_.length(), "Attempt to read past end of body.");
-    cb(std::make_unique<Buffer::OwnedImpl>(&body_[range.begin()], range.length()));
+    ASSERT(body_ != nullptr && range.end() <= body_->length(), "Attempt to read past end of body.");
+    // Serve the range zero-copy: the fragment references the shared cached body directly and the
+    // releasor holds a reference to it, so the data stays valid until the buffer is drained even
+    // if the cache entry is replaced in the meantime.
+    auto buffer = std::make_unique<Buffer::OwnedImpl>();
+    buffer->addBufferFragment(*new Buffer::BufferFragmentImpl(
+        body_->data() + range.begin(), range.length(),
+        [body = body_](const void*, size_t, const Buffer::BufferFragmentImpl* this_fragment) {
+          delete this_fragment;
+        }));
+    cb(std::move(buffer));
   }
 
   // The cache must call cb with the cached trailers.
@@ -63,7 +73,7 @@ public:
 private:
   SimpleHttpCache& cache_;
   const LookupRequest request_;
-  std::string body_;
+  std::shared_ptr<const std::string> body_;
   Http::ResponseTrailerMapPtr trailers_;
 };
 
@@ -199,8 +209,10 @@ bool SimpleHttpCache::insert(const Key& key, Http::ResponseHeaderMapPtr&& respon
                              ResponseMetadata&& metadata, std::string&& body,
                              Http::ResponseTrailerMapPtr&& trailers) {
   absl::WriterMutexLock lock(&mutex_);
-  map_[key] = SimpleHttpCache::Entry{std::move(response_headers), std::move(metadata),
-                                     std::move(body), std::move(trailers)};
+  map_[key] =
+      SimpleHttpCache::Entry{std::move(response_headers), std::move(metadata),
+                             std::make_shared<const std::string>(std::move(body)),
+                             std::move(trailers)};
   return true;
 }
 
@@ -253,8 +265,10 @@ bool SimpleHttpCache::varyInsert(const Key& request_key,
   }
 
   varied_request_key.add_custom_fields(vary_identifier.value());
-  map_[varied_request_key] = SimpleHttpCache::Entry{
-      std::move(response_headers), std::move(metadata), std::move(body), std::move(trailers)};
+  map_[varied_request_key] =
+      SimpleHttpCache::Entry{std::move(response_headers), std::move(metadata),
+                             std::make_shared<const std::string>(std::move(body)),
+                             std::move(trailers)};
 
   // Add a special entry to flag that this request generates varied responses.
   auto iter = map_.find(request_key);
@@ -268,8 +282,9 @@ bool SimpleHttpCache::varyInsert(const Key& request_key,
     // have inserted for that resource. For the first entry simply use vary_identifier as the
     // entry_list; for future entries append vary_identifier to existing list.
     std::string entry_list;
-    map_[request_key] =
-        SimpleHttpCache::Entry{std::move(vary_only_map), {}, std::move(entry_list), {}};
+    map_[request_key] = SimpleHttpCache::Entry{
+        std::move(vary_only_map), {}, std::make_shared<const std::string>(std::move(entry_list)),
+        {}};
   }
   return true;
 }
@@ -18,7 +18,9 @@ private:
   struct Entry {
     Http::ResponseHeaderMapPtr response_headers_;
     ResponseMetadata metadata_;
-    std::string body_;
+    // Shared with lookup contexts so that bodies are served zero-copy; replacing the entry does
+    // not invalidate bodies still being streamed to clients.
+    std::shared_ptr<const std::string> body_;
     Http::ResponseTrailerMapPtr trailers_;
   };
 
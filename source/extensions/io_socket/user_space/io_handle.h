@@ -18,10 +18,12 @@ public:
 
   /**
    * Initialize the passthrough state from the downstream. This should be
-   * called at most once before `mergeInto`.
+   * called at most once before `mergeInto`. The filter state objects are
+   * taken by value so the caller can move its vector in; the objects
+   * themselves are shared by pointer, never deep-copied.
    */
   virtual void initialize(std::unique_ptr<envoy::config::core::v3::Metadata> metadata,
-                          const StreamInfo::FilterState::Objects& filter_state_objects) PURE;
+                          StreamInfo::FilterState::Objects filter_state_objects) PURE;
 
   /**
    * Merge the passthrough state into a recipient stream metadata and its
@@ -170,6 +170,8 @@ Api::IoCallUint64Result IoHandleImpl::writev(const Buffer::RawSlice* slices, uin
   }
 
   auto* const dest_buffer = peer_handle_->getWriteBuffer();
+  // This raw-slice variant has to copy because the caller retains ownership of the memory;
+  // callers that can hand slices over use write(Buffer&), which moves them to the peer.
   // Write along with iteration. Buffer guarantee the fragment is always append-able.
   uint64_t bytes_written = 0;
   for (uint64_t i = 0; i < num_slice && !dest_buffer->highWatermarkTriggered(); i++) {
@@ -251,6 +253,13 @@ Api::IoCallUint64Result IoHandleImpl::recv(void* buffer, size_t length, int flag
   return {max_bytes_to_read, Api::IoError::none()};
 }
 
+Api::IoCallUint64Result IoHandleImpl::sendFile(os_fd_t, off_t&, uint64_t) {
+  // User space handles have no kernel socket to hand the file descriptor to.
+  return {0, Network::IoSocketError::create(SOCKET_ERROR_NOT_SUP)};
+}
+
+bool IoHandleImpl::supportsSendfile() const { return false; }
+
 bool IoHandleImpl::supportsMmsg() const { return false; }
 
 bool IoHandleImpl::supportsUdpGro() const { return false; }
@@ -364,12 +373,11 @@ Api::SysCallIntResult IoHandleImpl::shutdown(int how) {
   return {0, 0};
 }
 
-void PassthroughStateImpl::initialize(
-    std::unique_ptr<envoy::config::core::v3::Metadata> metadata,
-    const StreamInfo::FilterState::Objects& filter_state_objects) {
+void PassthroughStateImpl::initialize(std::unique_ptr<envoy::config::core::v3::Metadata> metadata,
+                                      StreamInfo::FilterState::Objects filter_state_objects) {
   ASSERT(state_ == State::Created);
   metadata_ = std::move(metadata);
-  filter_state_objects_ = filter_state_objects;
+  filter_state_objects_ = std::move(filter_state_objects);
   state_ = State::Initialized;
 }
 void PassthroughStateImpl::mergeInto(envoy::config::core::v3::Metadata& metadata,
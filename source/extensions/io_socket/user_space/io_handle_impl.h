@@ -63,6 +63,8 @@ public:
   Api::IoCallUint64Result recvmmsg(RawSliceArrays& slices, uint32_t self_port,
                                    RecvMsgOutput& output) override;
   Api::IoCallUint64Result recv(void* buffer, size_t length, int flags) override;
+  Api::IoCallUint64Result sendFile(os_fd_t in_fd, off_t& offset, uint64_t length) override;
+  bool supportsSendfile() const override;
   bool supportsMmsg() const override;
   bool supportsUdpGro() const override;
   Api::SysCallIntResult bind(Network::Address::InstanceConstSharedPtr address) override;
@@ -185,7 +187,7 @@ private:
 class PassthroughStateImpl : public PassthroughState, public Logger::Loggable<Logger::Id::io> {
 public:
   void initialize(std::unique_ptr<envoy::config::core::v3::Metadata> metadata,
-                  const StreamInfo::FilterState::Objects& filter_state_objects) override;
+                  StreamInfo::FilterState::Objects filter_state_objects) override;
   void mergeInto(envoy::config::core::v3::Metadata& metadata,
                  StreamInfo::FilterState& filter_state) override;
 
@@ -216,6 +216,7 @@ void FilterChainManagerImpl::addFilterChains(
       filter_chains;
   uint32_t new_filter_chain_size = 0;
   FilterChainsByName filter_chains_by_name;
+  fc_contexts_.reserve(filter_chain_span.size());
 
   for (const auto& filter_chain : filter_chain_span) {
     const auto& filter_chain_match = filter_chain->filter_chain_match();
@@ -226,15 +227,16 @@ void FilterChainManagerImpl::addFilterChains(
           absl::StrJoin(addresses_, ",", Network::AddressStrFormatter()), filter_chain->name()));
     }
     if (!filter_chain_matcher) {
-      const auto& matching_iter = filter_chains.find(filter_chain_match);
-      if (matching_iter != filter_chains.end()) {
+      // A single try_emplace avoids hashing the match message twice on the common (unique) path.
+      const auto [matching_iter, inserted] =
+          filter_chains.try_emplace(filter_chain_match, filter_chain->name());
+      if (!inserted) {
         throw EnvoyException(
             fmt::format("error adding listener '{}': filter chain '{}' has "
                         "the same matching rules defined as '{}'",
                         absl::StrJoin(addresses_, ",", Network::AddressStrFormatter()),
                         filter_chain->name(), matching_iter->second));
       }
-      filter_chains.insert({filter_chain_match, filter_chain->name()});
     }
 
     // Reuse created filter chain if possible.
@@ -617,7 +619,10 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForDestinatio
 const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName(
     const ServerNamesMap& server_names_map, const Network::ConnectionSocket& socket) const {
   ASSERT(absl::AsciiStrToLower(socket.requestedServerName()) == socket.requestedServerName());
-  const std::string server_name(socket.requestedServerName());
+  // The map supports heterogeneous lookup, so the server name and the wildcard suffixes probed
+  // below can stay string views; with large SNI fan-outs this match runs for every connection and
+  // should not allocate.
+  const absl::string_view server_name = socket.requestedServerName();
 
   // Match on exact server name, i.e. "www.example.com" for "www.example.com".
   const auto server_name_exact_match = server_names_map.find(server_name);
@@ -627,8 +632,8 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName
 
   // Match on all wildcard domains, i.e. ".example.com" and ".com" for "www.example.com".
   size_t pos = server_name.find('.', 1);
-  while (pos < server_name.size() - 1 && pos != std::string::npos) {
-    const std::string wildcard = server_name.substr(pos);
+  while (pos < server_name.size() - 1 && pos != absl::string_view::npos) {
+    const absl::string_view wildcard = server_name.substr(pos);
     const auto server_name_wildcard_match = server_names_map.find(wildcard);
     if (server_name_wildcard_match != server_names_map.end()) {
       return findFilterChainForTransportProtocol(server_name_wildcard_match->second, socket);
@@ -648,7 +653,7 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName
 const Network::FilterChain* FilterChainManagerImpl::findFilterChainForTransportProtocol(
     const TransportProtocolsMap& transport_protocols_map,
     const Network::ConnectionSocket& socket) const {
-  const std::string transport_protocol(socket.detectedTransportProtocol());
+  const absl::string_view transport_protocol = socket.detectedTransportProtocol();
 
   // Match on exact transport protocol, e.g. "tls".
   const auto transport_protocol_match = transport_protocols_map.find(transport_protocol);
@@ -835,8 +840,8 @@ Network::DrainableFilterChainSharedPtr FilterChainManagerImpl::findExistingFilte
   }
   auto iter = origin->fc_contexts_.find(filter_chain_message);
   if (iter != origin->fc_contexts_.end()) {
-    // copy the context to this filter chain manager.
-    fc_contexts_.emplace(filter_chain_message, iter->second);
+    // The caller inserts the context into this filter chain manager's fc_contexts_; doing it here
+    // as well would hash and copy the (potentially very large) filter chain message a second time.
     return iter->second;
   }
   return nullptr;
@@ -37,6 +37,7 @@
 #ifdef ENVOY_ENABLE_QUIC
 #include "source/common/quic/active_quic_listener.h"
 #include "source/common/quic/udp_gso_batch_writer.h"
+#include "source/common/quic/udp_sendmmsg_batch_writer.h"
 #endif
 
 namespace Envoy {
@@ -622,7 +623,8 @@ void ListenerImpl::buildUdpListenerFactory(uint32_t concurrency) {
     }
     udp_listener_config_->listener_factory_ = std::make_unique<Quic::ActiveQuicListenerFactory>(
         config_.udp_listener_config().quic_options(), concurrency, quic_stat_names_,
-        validation_visitor_, listener_factory_context_->processContext());
+        validation_visitor_, listener_factory_context_->processContext(),
+        makeOptRef(listener_factory_context_->api().threadFactory()));
 #if UDP_GSO_BATCH_WRITER_COMPILETIME_SUPPORT
     // TODO(mattklein123): We should be able to use GSO without QUICHE/QUIC. Right now this causes
     // non-QUIC integration tests to fail, which I haven't investigated yet. Additionally, from
@@ -634,6 +636,16 @@ void ListenerImpl::buildUdpListenerFactory(uint32_t concurrency) {
       udp_listener_config_->writer_factory_ = std::make_unique<Quic::UdpGsoBatchWriterFactory>();
     }
 #endif
+#if UDP_SENDMMSG_BATCH_WRITER_COMPILETIME_SUPPORT
+    // When GSO is unavailable fall back to sendmmsg batching so that packet bursts are still
+    // flushed with a single syscall instead of one sendmsg per packet.
+    if (udp_listener_config_->writer_factory_ == nullptr &&
+        Runtime::runtimeFeatureEnabled("envoy.reloadable_features.quic_sendmmsg_batch_writer") &&
+        Api::OsSysCallsSingleton::get().supportsMmsg()) {
+      udp_listener_config_->writer_factory_ =
+          std::make_unique<Quic::UdpSendmmsgBatchWriterFactory>();
+    }
+#endif
 #else
     throw EnvoyException("QUIC is configured but not enabled in the build.");
 #endif
@@ -673,6 +685,22 @@ void ListenerImpl::buildListenSocketOptions(
     if (reuse_port_) {
       addListenSocketOptions(listen_socket_options_list_[i],
                              Network::SocketOptionFactory::buildReusePortOptions());
+      // With pinned worker threads, steer each incoming connection to the socket of the worker
+      // pinned to the CPU the connection's network processing runs on, so that interrupt
+      // handling, kernel socket work and the worker share a CPU. The QUIC listener attaches its
+      // own connection-id based program, so this only applies to TCP.
+      if (socket_type_ == Network::Socket::Type::Stream &&
+          parent_.server_.bootstrap().pin_worker_threads()) {
+        addListenSocketOptions(listen_socket_options_list_[i],
+                               Network::SocketOptionFactory::buildCpuPinnedReusePortOptions(
+                                   parent_.server_.options().concurrency()));
+      }
+    }
+    if (config_.has_busy_poll_duration()) {
+      addListenSocketOptions(
+          listen_socket_options_list_[i],
+          Network::SocketOptionFactory::buildBusyPollOptions(std::chrono::microseconds(
+              DurationUtil::durationToMicroseconds(config_.busy_poll_duration()))));
     }
     if (!config_.socket_options().empty()) {
       addListenSocketOptions(
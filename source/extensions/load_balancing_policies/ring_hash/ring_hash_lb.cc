@@ -2,12 +2,15 @@
 
 #include <cstdint>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "envoy/config/cluster/v3/cluster.pb.h"
 
 #include "source/common/common/assert.h"
+#include "source/common/common/fmt.h"
+#include "source/common/common/hash.h"
 #include "source/common/upstream/load_balancer_impl.h"
 
 #include "absl/container/inlined_vector.h"
@@ -174,6 +177,20 @@ RingHashLoadBalancer::Ring::Ring(const NormalizedHostWeightVector& normalized_ho
   // Users should hopefully pay attention to these numbers and alert if min_hashes_per_host is too
   // low, since that implies an inaccurate request distribution.
 
+  const bool use_murmur =
+      hash_function == HashFunction::Cluster_RingHashLbConfig_HashFunction_MURMUR_HASH_2;
+
+  // Streaming xxHash states, allocated once per ring build (the state type is opaque and must be
+  // heap allocated). base_state_ is seeded with the constant "<key>_" prefix of each host so that
+  // every ring entry only has to mix in the digits of its index; this produces hashes identical
+  // to hashing the whole composed key while avoiding rehashing the (potentially long) host key
+  // scale-times over. MurmurHash2 is not incremental, so it keeps hashing the composed key.
+  const auto state_deleter = [](XXH64_state_t* state) { XXH64_freeState(state); };
+  std::unique_ptr<XXH64_state_t, decltype(state_deleter)> base_state(XXH64_createState(),
+                                                                     state_deleter);
+  std::unique_ptr<XXH64_state_t, decltype(state_deleter)> entry_state(XXH64_createState(),
+                                                                      state_deleter);
+
   absl::InlinedVector<char, 196> hash_key_buffer;
   double current_hashes = 0.0;
   double target_hashes = 0.0;
@@ -186,29 +203,37 @@ RingHashLoadBalancer::Ring::Ring(const NormalizedHostWeightVector& normalized_ho
 
     hash_key_buffer.assign(key_to_hash.begin(), key_to_hash.end());
     hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
+    const size_t offset = hash_key_buffer.size();
+
+    if (!use_murmur) {
+      XXH64_reset(base_state.get(), 0);
+      XXH64_update(base_state.get(), hash_key_buffer.data(), hash_key_buffer.size());
+    }
 
     // As noted above: maintain current_hashes and target_hashes as running sums across the entire
     // host set. `i` is needed only to construct the hash key, and tally min/max hashes per host.
     target_hashes += scale * entry.second;
     uint64_t i = 0;
     while (current_hashes < target_hashes) {
-      const std::string i_str = absl::StrCat("", i);
-      hash_key_buffer.insert(offset_start, i_str.begin(), i_str.end());
-
-      absl::string_view hash_key(static_cast<char*>(hash_key_buffer.data()),
-                                 hash_key_buffer.size());
+      const fmt::format_int i_str(i);
 
-      const uint64_t hash =
-          (hash_function == HashFunction::Cluster_RingHashLbConfig_HashFunction_MURMUR_HASH_2)
-              ? MurmurHash::murmurHash2(hash_key, MurmurHash::STD_HASH_SEED)
-              : HashUtil::xxHash64(hash_key);
+      uint64_t hash;
+      if (use_murmur) {
+        hash_key_buffer.resize(offset);
+        hash_key_buffer.insert(hash_key_buffer.end(), i_str.data(), i_str.data() + i_str.size());
+        const absl::string_view hash_key(hash_key_buffer.data(), hash_key_buffer.size());
+        hash = MurmurHash::murmurHash2(hash_key, MurmurHash::STD_HASH_SEED);
+      } else {
+        XXH64_copyState(entry_state.get(), base_state.get());
+        XXH64_update(entry_state.get(), i_str.data(), i_str.size());
+        hash = XXH64_digest(entry_state.get());
+      }
 
-      ENVOY_LOG(trace, "ring hash: hash_key={} hash={}", hash_key, hash);
+      ENVOY_LOG(trace, "ring hash: hash_key={}{} hash={}",
+                absl::string_view(hash_key_buffer.data(), offset), i, hash);
       ring_.push_back({hash, host});
       ++i;
       ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
     }
     min_hashes_per_host = std::min(i, min_hashes_per_host);
     max_hashes_per_host = std::max(i, max_hashes_per_host);
@@ -554,12 +554,16 @@ void SubsetLoadBalancer::processSubsets(uint32_t priority, const HostVector& all
   uint64_t collision_count_of_single_host_entries{};
 
   for (const auto& host : all_hosts) {
-    for (const auto& subset_selector : subset_selectors_) {
-      const auto& keys = subset_selector->selectorKeys();
-      // For each host, for each subset key, attempt to extract the metadata corresponding to the
-      // key from the host.
-      std::vector<SubsetMetadata> all_kvs = extractSubsetMetadata(keys, *host);
-      for (const auto& kvs : all_kvs) {
+    // Metadata extraction copies a proto value per host per selector key and is the expensive
+    // part of a rebuild; most hosts keep their metadata between updates, so results are cached
+    // by metadata identity.
+    const ExtractedSubsetMetadata* extracted = extractSubsetMetadataCached(*host);
+    if (extracted == nullptr) {
+      continue;
+    }
+    for (size_t selector_index = 0; selector_index < subset_selectors_.size(); ++selector_index) {
+      const auto& subset_selector = subset_selectors_[selector_index];
+      for (const auto& kvs : extracted->per_selector_kvs[selector_index]) {
         // The host has metadata for each key, find or create its subset.
         auto entry = findOrCreateLbSubsetEntry(subsets_, kvs, 0);
         initLbSubsetEntryOnce(entry, subset_selector->singleHostPerSubset());
@@ -602,6 +606,42 @@ void SubsetLoadBalancer::processSubsets(uint32_t priority, const HostVector& all
 void SubsetLoadBalancer::update(uint32_t priority, const HostVector& all_hosts) {
   updateFallbackSubset(priority, all_hosts);
   processSubsets(priority, all_hosts);
+  maybeTrimMetadataCache();
+}
+
+const SubsetLoadBalancer::ExtractedSubsetMetadata*
+SubsetLoadBalancer::extractSubsetMetadataCached(const Host& host) {
+  MetadataConstSharedPtr metadata = host.metadata();
+  if (metadata == nullptr) {
+    return nullptr;
+  }
+
+  auto it = extraction_cache_.find(metadata.get());
+  if (it == extraction_cache_.end()) {
+    ExtractedSubsetMetadata extracted;
+    extracted.per_selector_kvs.reserve(subset_selectors_.size());
+    for (const auto& subset_selector : subset_selectors_) {
+      extracted.per_selector_kvs.emplace_back(
+          extractSubsetMetadata(subset_selector->selectorKeys(), *metadata));
+    }
+    extracted.metadata = std::move(metadata);
+    it = extraction_cache_.emplace(extracted.metadata.get(), std::move(extracted)).first;
+  }
+  return &it->second;
+}
+
+void SubsetLoadBalancer::maybeTrimMetadataCache() {
+  // As hosts churn or change metadata, entries for metadata no longer referenced by any host
+  // accumulate. Once the cache clearly exceeds the live host count, drop it entirely and let it
+  // repopulate lazily on the next update; tracking per-entry liveness is not worth the
+  // bookkeeping given how cheap a cold rebuild of the cache is.
+  size_t total_hosts = 0;
+  for (const auto& host_set : original_priority_set_.hostSetsPerPriority()) {
+    total_hosts += host_set->hosts().size();
+  }
+  if (extraction_cache_.size() > 2 * total_hosts + 16) {
+    extraction_cache_.clear();
+  }
 }
 
 bool SubsetLoadBalancer::hostMatches(const SubsetMetadata& kvs, const Host& host) {
@@ -609,16 +649,12 @@ bool SubsetLoadBalancer::hostMatches(const SubsetMetadata& kvs, const Host& host
       kvs, host.metadata().get(), Config::MetadataFilters::get().ENVOY_LB, list_as_any_);
 }
 
-// Iterates over subset_keys looking up values from the given host's metadata. Each key-value pair
+// Iterates over subset_keys looking up values from the given host metadata. Each key-value pair
 // is appended to kvs. Returns a non-empty value if the host has a value for each key.
 std::vector<SubsetLoadBalancer::SubsetMetadata>
 SubsetLoadBalancer::extractSubsetMetadata(const std::set<std::string>& subset_keys,
-                                          const Host& host) {
+                                          const envoy::config::core::v3::Metadata& metadata) {
   std::vector<SubsetMetadata> all_kvs;
-  if (!host.metadata()) {
-    return all_kvs;
-  }
-  const envoy::config::core::v3::Metadata& metadata = *host.metadata();
   const auto& filter_it = metadata.filter_metadata().find(Config::MetadataFilters::get().ENVOY_LB);
   if (filter_it == metadata.filter_metadata().end()) {
     return all_kvs;
@@ -23,6 +23,7 @@
 #include "source/common/upstream/load_balancer_impl.h"
 #include "source/common/upstream/upstream_impl.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -496,8 +497,22 @@ private:
   void forEachSubset(LbSubsetMap& subsets, std::function<void(LbSubsetEntryPtr&)> cb);
   void purgeEmptySubsets(LbSubsetMap& subsets);
 
-  std::vector<SubsetMetadata> extractSubsetMetadata(const std::set<std::string>& subset_keys,
-                                                    const Host& host);
+  std::vector<SubsetMetadata>
+  extractSubsetMetadata(const std::set<std::string>& subset_keys,
+                        const envoy::config::core::v3::Metadata& metadata);
+
+  struct ExtractedSubsetMetadata {
+    // Keeps the metadata alive so the cache key (its address) cannot be recycled while cached.
+    MetadataConstSharedPtr metadata;
+    // Result of extractSubsetMetadata() for each subset selector, in selector order.
+    std::vector<std::vector<SubsetMetadata>> per_selector_kvs;
+  };
+
+  // Returns the (possibly cached) extracted subset metadata for the given host, or nullptr if the
+  // host has no metadata. Host metadata is immutable once published and updated by swapping the
+  // shared pointer, so the metadata address identifies its content.
+  const ExtractedSubsetMetadata* extractSubsetMetadataCached(const Host& host);
+  void maybeTrimMetadataCache();
   std::string describeMetadata(const SubsetMetadata& kvs);
   HostConstSharedPtr chooseHostWithMetadataFallbacks(LoadBalancerContext* context,
                                                      const MetadataFallbacks& metadata_fallbacks);
@@ -538,6 +553,12 @@ private:
 
   Stats::Gauge* single_duplicate_stat_{};
 
+  // Caches per-host metadata extraction across updates: every update has to re-evaluate every
+  // host, but most hosts keep their metadata between updates. Trimmed when stale entries
+  // accumulate, see maybeTrimMetadataCache().
+  absl::flat_hash_map<const envoy::config::core::v3::Metadata*, ExtractedSubsetMetadata>
+      extraction_cache_;
+
   // Keep small members (bools and enums) at the end of class, to reduce alignment overhead.
   const bool locality_weight_aware_ : 1;
   const bool scale_locality_weight_ : 1;
@@ -18,6 +18,7 @@
 #include "source/common/network/utility.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "ares.h"
 
@@ -279,34 +280,50 @@ void DnsResolverImpl::AddrInfoPendingResolution::onAresGetAddrInfoCallback(
   }
 }
 
+void DnsResolverImpl::PendingResolution::invokeCallback(const ResolveCb& callback,
+                                                        std::list<DnsResponse>&& response) {
+  // Use a raw try here because it is used in both main thread and filter.
+  // Can not convert to use status code as there may be unexpected exceptions in server fuzz
+  // tests, which must be handled. Potential exception may come from getAddressWithPort() or
+  // portFromTcpUrl().
+  // TODO(chaoqin-li1123): remove try catch pattern here once we figure how to handle unexpected
+  // exception in fuzz tests.
+  TRY_NEEDS_AUDIT { callback(pending_response_.status_, std::move(response)); }
+  END_TRY
+  catch (const EnvoyException& e) {
+    ENVOY_LOG(critical, "EnvoyException in c-ares callback: {}", e.what());
+    dispatcher_.post([s = std::string(e.what())] { throw EnvoyException(s); });
+  }
+  catch (const std::exception& e) {
+    ENVOY_LOG(critical, "std::exception in c-ares callback: {}", e.what());
+    dispatcher_.post([s = std::string(e.what())] { throw EnvoyException(s); });
+  }
+  catch (...) {
+    ENVOY_LOG(critical, "Unknown exception in c-ares callback");
+    dispatcher_.post([] { throw EnvoyException("unknown"); });
+  }
+}
+
 void DnsResolverImpl::PendingResolution::finishResolve() {
   ENVOY_LOG_EVENT(debug, "cares_dns_resolution_complete",
                   "dns resolution for {} completed with status {}", dns_name_,
                   static_cast<int>(pending_response_.status_));
 
-  if (!cancelled_) {
-    // Use a raw try here because it is used in both main thread and filter.
-    // Can not convert to use status code as there may be unexpected exceptions in server fuzz
-    // tests, which must be handled. Potential exception may come from getAddressWithPort() or
-    // portFromTcpUrl().
-    // TODO(chaoqin-li1123): remove try catch pattern here once we figure how to handle unexpected
-    // exception in fuzz tests.
-    TRY_NEEDS_AUDIT {
-      callback_(pending_response_.status_, std::move(pending_response_.address_list_));
-    }
-    END_TRY
-    catch (const EnvoyException& e) {
-      ENVOY_LOG(critical, "EnvoyException in c-ares callback: {}", e.what());
-      dispatcher_.post([s = std::string(e.what())] { throw EnvoyException(s); });
-    }
-    catch (const std::exception& e) {
-      ENVOY_LOG(critical, "std::exception in c-ares callback: {}", e.what());
-      dispatcher_.post([s = std::string(e.what())] { throw EnvoyException(s); });
-    }
-    catch (...) {
-      ENVOY_LOG(critical, "Unknown exception in c-ares callback");
-      dispatcher_.post([] { throw EnvoyException("unknown"); });
+  if (!inflight_key_.empty()) {
+    parent_.inflight_resolutions_.erase(inflight_key_);
+    inflight_key_.clear();
+  }
+
+  // Joined callers get a copy of the response regardless of whether the primary caller
+  // cancelled; each joiner honors only its own cancellation.
+  for (const auto& joiner : joiners_) {
+    if (!joiner->cancelled_) {
+      invokeCallback(joiner->callback_, std::list<DnsResponse>(pending_response_.address_list_));
     }
+  }
+
+  if (!cancelled_) {
+    invokeCallback(callback_, std::move(pending_response_.address_list_));
   } else {
     ENVOY_LOG_EVENT(debug, "cares_dns_callback_cancelled",
                     "dns resolution callback for {} not issued. Cancelled with reason={}",
@@ -375,6 +392,20 @@ ActiveDnsQuery* DnsResolverImpl::resolve(const std::string& dns_name,
     initializeChannel(&options.options_, options.optmask_);
   }
 
+  // Single-flight: if an identical query is already in flight (common when many DNS clusters
+  // track overlapping names), attach to it instead of issuing a duplicate query. This is checked
+  // after the dirty-channel handling above so a joiner never attaches to a query on a channel
+  // that is about to be destroyed.
+  const std::string inflight_key =
+      absl::StrCat(dns_name, "|", static_cast<int>(dns_lookup_family));
+  auto inflight_it = inflight_resolutions_.find(inflight_key);
+  if (inflight_it != inflight_resolutions_.end()) {
+    ENVOY_LOG_EVENT(debug, "cares_dns_resolution_joined",
+                    "dns resolution for {} joined an identical in-flight query", dns_name);
+    stats_.deduplicated_resolutions_.inc();
+    return inflight_it->second->addJoiner(callback);
+  }
+
   auto pending_resolution = std::make_unique<AddrInfoPendingResolution>(
       *this, callback, dispatcher_, channel_, dns_name, dns_lookup_family);
   pending_resolution->startResolution();
@@ -390,6 +421,8 @@ ActiveDnsQuery* DnsResolverImpl::resolve(const std::string& dns_name,
     // if ~DnsResolverImpl() happens via ares_destroy() and subsequent handling of ARES_EDESTRUCTION
     // in DnsResolverImpl::PendingResolution::onAresGetAddrInfoCallback()).
     pending_resolution->owned_ = true;
+    pending_resolution->inflight_key_ = inflight_key;
+    inflight_resolutions_[inflight_key] = pending_resolution.get();
     return pending_resolution.release();
   }
 }
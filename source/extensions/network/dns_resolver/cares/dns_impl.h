@@ -14,6 +14,7 @@
 #include "source/common/common/utility.h"
 #include "source/common/network/dns_resolver/dns_factory_util.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "ares.h"
 
@@ -28,7 +29,8 @@ namespace Network {
   GAUGE(pending_resolutions, NeverImport)                                                          \
   COUNTER(not_found)                                                                               \
   COUNTER(get_addr_failure)                                                                        \
-  COUNTER(timeouts)
+  COUNTER(timeouts)                                                                                \
+  COUNTER(deduplicated_resolutions)
 
 /**
  * Struct definition for all DNS stats. @see stats_macros.h
@@ -64,6 +66,19 @@ public:
 
 private:
   friend class DnsResolverImplPeer;
+
+  // A caller that attached to an identical in-flight query instead of issuing its own. The
+  // joined query is owned by the primary PendingResolution and is invoked (unless individually
+  // cancelled) with a copy of the primary's response when the primary completes.
+  class JoinedResolution : public ActiveDnsQuery {
+  public:
+    explicit JoinedResolution(ResolveCb callback) : callback_(std::move(callback)) {}
+    void cancel(CancelReason) override { cancelled_ = true; }
+
+    const ResolveCb callback_;
+    bool cancelled_{false};
+  };
+
   class PendingResolution : public ActiveDnsQuery {
   public:
     void cancel(CancelReason reason) override {
@@ -78,6 +93,18 @@ private:
     bool owned_ = false;
     // Has the query completed? Only meaningful if !owned_;
     bool completed_ = false;
+    // Key under which this resolution is registered in the parent's in-flight map, or empty if
+    // it is not registered (e.g. it completed synchronously).
+    std::string inflight_key_;
+
+    /**
+     * Attach another caller with an identical query to this in-flight resolution.
+     * @return the joined query handle, owned by this resolution.
+     */
+    ActiveDnsQuery* addJoiner(ResolveCb callback) {
+      joiners_.push_back(std::make_unique<JoinedResolution>(std::move(callback)));
+      return joiners_.back().get();
+    }
 
   protected:
     // Network::ActiveDnsQuery
@@ -87,6 +114,8 @@ private:
           dns_name_(dns_name) {}
 
     void finishResolve();
+    // Invoke a caller callback with the usual exception containment.
+    void invokeCallback(const ResolveCb& callback, std::list<DnsResponse>&& response);
 
     DnsResolverImpl& parent_;
     // Caller supplied callback to invoke on query completion or error.
@@ -112,6 +141,8 @@ private:
     // In the dual_resolution case __any__ ARES_SUCCESS reply will result in a
     // ResolutionStatus::Success callback.
     PendingResponse pending_response_{ResolutionStatus::Failure, {}};
+    // Callers that joined this in-flight resolution instead of issuing duplicate queries.
+    std::vector<std::unique_ptr<JoinedResolution>> joiners_;
   };
 
   class AddrInfoPendingResolution final : public PendingResolution {
@@ -194,6 +225,9 @@ private:
   envoy::config::core::v3::DnsResolverOptions dns_resolver_options_;
 
   absl::node_hash_map<int, Event::FileEventPtr> events_;
+  // In-flight asynchronous resolutions keyed by name and lookup family. resolve() calls for a
+  // key that is already in flight join the existing query instead of issuing a duplicate one.
+  absl::flat_hash_map<std::string, PendingResolution*> inflight_resolutions_;
   const bool use_resolvers_as_fallback_;
   const absl::optional<std::string> resolvers_csv_;
   const bool filter_unroutable_families_;
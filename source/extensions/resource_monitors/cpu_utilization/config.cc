@@ -0,0 +1,29 @@
+#include "source/extensions/resource_monitors/cpu_utilization/config.h"
+
+#include "envoy/extensions/resource_monitors/cpu_utilization/v3/cpu_utilization.pb.h"
+#include "envoy/extensions/resource_monitors/cpu_utilization/v3/cpu_utilization.pb.validate.h"
+#include "envoy/registry/registry.h"
+
+#include "source/common/protobuf/utility.h"
+#include "source/extensions/resource_monitors/cpu_utilization/cpu_utilization_monitor.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace CpuUtilizationMonitor {
+
+Server::ResourceMonitorPtr CpuUtilizationMonitorFactory::createResourceMonitorFromProtoTyped(
+    const envoy::extensions::resource_monitors::cpu_utilization::v3::CpuUtilizationConfig& config,
+    Server::Configuration::ResourceMonitorFactoryContext& /*unused_context*/) {
+  return std::make_unique<CpuUtilizationMonitor>(config);
+}
+
+/**
+ * Static registration for the CPU utilization resource monitor factory. @see RegistryFactory.
+ */
+REGISTER_FACTORY(CpuUtilizationMonitorFactory, Server::Configuration::ResourceMonitorFactory);
+
+} // namespace CpuUtilizationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,53 @@
+#include "source/extensions/resource_monitors/cpu_utilization/cpu_stats_reader.h"
+
+#include <array>
+#include <fstream>
+
+#include "source/common/common/logger.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace CpuUtilizationMonitor {
+
+LinuxCpuStatsReader::LinuxCpuStatsReader(const std::string& cpu_stats_filename)
+    : cpu_stats_filename_(cpu_stats_filename) {}
+
+CpuTimes LinuxCpuStatsReader::getCpuTimes() {
+  std::ifstream cpu_stats_file;
+  cpu_stats_file.open(cpu_stats_filename_);
+  if (!cpu_stats_file.is_open()) {
+    ENVOY_LOG_MISC(error, "Can't open linux cpu stats file {}", cpu_stats_filename_);
+    return {false, 0, 0};
+  }
+
+  // The first line of /proc/stat is the aggregate 'cpu' line: the identifier followed by at
+  // least 7 jiffies counters (user, nice, system, idle, iowait, irq, softirq).
+  std::string cpu_identifier;
+  cpu_stats_file >> cpu_identifier;
+  if (cpu_identifier != "cpu") {
+    ENVOY_LOG_MISC(error, "Unexpected format in linux cpu stats file {}", cpu_stats_filename_);
+    return {false, 0, 0};
+  }
+
+  std::array<uint64_t, 7> times;
+  for (uint64_t& time : times) {
+    cpu_stats_file >> time;
+    if (!cpu_stats_file.good()) {
+      ENVOY_LOG_MISC(error, "Unexpected format in linux cpu stats file {}", cpu_stats_filename_);
+      return {false, 0, 0};
+    }
+  }
+
+  const uint64_t work_time = times[0] + times[1] + times[2]; // user + nice + system
+  uint64_t total_time = 0;
+  for (const uint64_t time : times) {
+    total_time += time;
+  }
+  return {true, work_time, total_time};
+}
+
+} // namespace CpuUtilizationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
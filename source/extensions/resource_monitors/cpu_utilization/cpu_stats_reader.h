@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "envoy/common/pure.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace CpuUtilizationMonitor {
+
+// A snapshot of the CPU time counters: the time spent doing work and the total elapsed CPU time
+// (including idle), in units of the underlying OS counters (jiffies on Linux). Utilization over
+// an interval is the ratio of the deltas of the two values between consecutive snapshots.
+struct CpuTimes {
+  bool is_valid;
+  uint64_t work_time;
+  uint64_t total_time;
+};
+
+/**
+ * Helper class for reading CPU time counters from the OS.
+ */
+class CpuStatsReader {
+public:
+  CpuStatsReader() = default;
+  virtual ~CpuStatsReader() = default;
+
+  virtual CpuTimes getCpuTimes() PURE;
+};
+
+/**
+ * CPU stats reader that parses the aggregate "cpu" line of the Linux /proc/stat file.
+ */
+class LinuxCpuStatsReader : public CpuStatsReader {
+public:
+  LinuxCpuStatsReader(const std::string& cpu_stats_filename = "/proc/stat");
+
+  CpuTimes getCpuTimes() override;
+
+private:
+  const std::string cpu_stats_filename_;
+};
+
+} // namespace CpuUtilizationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,62 @@
+#include "source/extensions/resource_monitors/cpu_utilization/cpu_utilization_monitor.h"
+
+#include "envoy/extensions/resource_monitors/cpu_utilization/v3/cpu_utilization.pb.h"
+
+#include "source/common/common/fmt.h"
+#include "source/common/common/logger.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace CpuUtilizationMonitor {
+
+// The dampening alpha value used to smooth the utilization across refresh intervals with an
+// exponential moving average. Chosen so that a sustained change in utilization dominates the
+// reported pressure after a few dozen refresh intervals while a single noisy sample moves it
+// only slightly, preventing overload actions from flapping on short spikes.
+constexpr double DAMPENING_ALPHA = 0.05;
+
+CpuUtilizationMonitor::CpuUtilizationMonitor(
+    const envoy::extensions::resource_monitors::cpu_utilization::v3::CpuUtilizationConfig&,
+    std::unique_ptr<CpuStatsReader> cpu_stats_reader)
+    : cpu_stats_reader_(std::move(cpu_stats_reader)) {
+  previous_cpu_times_ = cpu_stats_reader_->getCpuTimes();
+}
+
+void CpuUtilizationMonitor::updateResourceUsage(Server::ResourceUpdateCallbacks& callbacks) {
+  const CpuTimes cpu_times = cpu_stats_reader_->getCpuTimes();
+  if (!cpu_times.is_valid) {
+    const EnvoyException error("Can't open or parse CPU stats");
+    callbacks.onFailure(error);
+    return;
+  }
+
+  const int64_t work_over_period = static_cast<int64_t>(cpu_times.work_time) -
+                                   static_cast<int64_t>(previous_cpu_times_.work_time);
+  const int64_t total_over_period = static_cast<int64_t>(cpu_times.total_time) -
+                                    static_cast<int64_t>(previous_cpu_times_.total_time);
+  previous_cpu_times_ = cpu_times;
+  if (work_over_period < 0 || total_over_period <= 0 || work_over_period > total_over_period) {
+    const EnvoyException error(
+        fmt::format("Erroneous CPU stats calculation. work_over_period={}, total_over_period={}",
+                    work_over_period, total_over_period));
+    callbacks.onFailure(error);
+    return;
+  }
+
+  const double current_utilization =
+      static_cast<double>(work_over_period) / total_over_period;
+  utilization_ = current_utilization * DAMPENING_ALPHA + (1 - DAMPENING_ALPHA) * utilization_;
+
+  ENVOY_LOG_MISC(trace, "CpuUtilizationMonitor: work={}, total={}, utilization={}",
+                 work_over_period, total_over_period, utilization_);
+
+  Server::ResourceUsage usage;
+  usage.resource_pressure_ = utilization_;
+  callbacks.onSuccess(usage);
+}
+
+} // namespace CpuUtilizationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "envoy/extensions/resource_monitors/cpu_utilization/v3/cpu_utilization.pb.h"
+#include "envoy/server/resource_monitor.h"
+
+#include "source/extensions/resource_monitors/cpu_utilization/cpu_stats_reader.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace CpuUtilizationMonitor {
+
+/**
+ * CPU utilization monitor that reports the smoothed busy fraction of the CPUs available to the
+ * process, computed from CPU time counter deltas between refresh intervals.
+ */
+class CpuUtilizationMonitor : public Server::ResourceMonitor {
+public:
+  CpuUtilizationMonitor(
+      const envoy::extensions::resource_monitors::cpu_utilization::v3::CpuUtilizationConfig&
+          config,
+      std::unique_ptr<CpuStatsReader> cpu_stats_reader = std::make_unique<LinuxCpuStatsReader>());
+
+  void updateResourceUsage(Server::ResourceUpdateCallbacks& callbacks) override;
+
+private:
+  double utilization_{0};
+  CpuTimes previous_cpu_times_;
+  std::unique_ptr<CpuStatsReader> cpu_stats_reader_;
+};
+
+} // namespace CpuUtilizationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
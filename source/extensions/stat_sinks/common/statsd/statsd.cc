@@ -19,8 +19,10 @@
 #include "source/common/config/utility.h"
 #include "source/common/network/socket_interface.h"
 #include "source/common/network/utility.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/stats/symbol_table.h"
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 
 namespace Envoy {
@@ -47,27 +49,31 @@ void UdpStatsdSink::WriterImpl::writeBuffer(Buffer::Instance& data) {
 UdpStatsdSink::UdpStatsdSink(ThreadLocal::SlotAllocator& tls,
                              Network::Address::InstanceConstSharedPtr address, const bool use_tag,
                              const std::string& prefix, absl::optional<uint64_t> buffer_size,
-                             const Statsd::TagFormat& tag_format)
+                             const Statsd::TagFormat& tag_format,
+                             const bool aggregate_histograms)
     : tls_(tls.allocateSlot()), server_address_(std::move(address)), use_tag_(use_tag),
       prefix_(prefix.empty() ? Statsd::getDefaultPrefix() : prefix),
-      buffer_size_(buffer_size.value_or(0)), tag_format_(tag_format) {
+      buffer_size_(buffer_size.value_or(0)), tag_format_(tag_format),
+      aggregate_histograms_(aggregate_histograms) {
   tls_->set([this](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr {
-    return std::make_shared<WriterImpl>(*this);
+    return std::make_shared<TlsSink>(std::make_shared<WriterImpl>(*this));
   });
 }
 
 void UdpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
-  Writer& writer = tls_->getTyped<Writer>();
+  Writer& writer = *tls_->getTyped<TlsSink>().writer_;
   Buffer::OwnedImpl buffer;
+  const bool changed_only = Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.statsd_flush_only_changed_metrics");
 
-  for (const auto& counter : snapshot.counters()) {
+  for (const auto& counter : changed_only ? snapshot.changedCounters() : snapshot.counters()) {
     if (counter.counter_.get().used()) {
       const std::string counter_str = buildMessage(counter.counter_.get(), counter.delta_, "|c");
       writeBuffer(buffer, writer, counter_str);
     }
   }
 
-  for (const auto& gauge : snapshot.gauges()) {
+  for (const auto& gauge : changed_only ? snapshot.changedGauges() : snapshot.gauges()) {
     if (gauge.get().used()) {
       const std::string gauge_str = buildMessage(gauge.get(), gauge.get().value(), "|g");
       writeBuffer(buffer, writer, gauge_str);
@@ -76,6 +82,13 @@ void UdpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
 
   flushBuffer(buffer, writer);
   // TODO(efimki): Add support of text readouts stats.
+
+  if (aggregate_histograms_) {
+    // Each worker empties its own histogram sample buffer on its own thread.
+    tls_->runOnAllThreads([this](ThreadLocal::ThreadLocalObjectSharedPtr object) {
+      flushHistograms(object->asType<TlsSink>());
+    });
+  }
 }
 
 void UdpStatsdSink::writeBuffer(Buffer::OwnedImpl& buffer, Writer& writer,
@@ -106,6 +119,22 @@ void UdpStatsdSink::flushBuffer(Buffer::OwnedImpl& buffer, Writer& writer) const
 }
 
 void UdpStatsdSink::onHistogramComplete(const Stats::Histogram& histogram, uint64_t value) {
+  TlsSink& tls_sink = tls_->getTyped<TlsSink>();
+  if (aggregate_histograms_ &&
+      Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.dog_statsd_aggregate_histograms")) {
+    // Buffer the sample; flushHistograms() emits multi-value packets at the stats flush
+    // interval instead of a datagram per sample.
+    auto& histogram_buffer =
+        tls_sink.histogram_buffers_[absl::StrCat(prefix_, ".", getName(histogram))];
+    if (histogram_buffer.values_.empty()) {
+      histogram_buffer.tag_str_ = buildTagStr(histogram.tags());
+      histogram_buffer.percent_ = histogram.unit() == Stats::Histogram::Unit::Percent;
+    }
+    histogram_buffer.values_.push_back(value);
+    return;
+  }
+
   // For statsd histograms are all timers in milliseconds, Envoy histograms are however
   // not necessarily timers in milliseconds, for Envoy histograms suffixed with their corresponding
   // SI unit symbol this is acceptable, but for histograms without a suffix, especially those which
@@ -123,7 +152,55 @@ void UdpStatsdSink::onHistogramComplete(const Stats::Histogram& histogram, uint6
   } else {
     message = buildMessage(histogram, std::chrono::milliseconds(value).count(), "|ms");
   }
-  tls_->getTyped<Writer>().write(message);
+  tls_sink.writer_->write(message);
+}
+
+void UdpStatsdSink::flushHistograms(TlsSink& tls_sink) const {
+  if (tls_sink.histogram_buffers_.empty()) {
+    return;
+  }
+
+  const uint64_t max_message_size = buffer_size_ > 0 ? buffer_size_ : DefaultMaxBytesPerDatagram;
+  Buffer::OwnedImpl buffer;
+  for (const auto& [name, histogram_buffer] : tls_sink.histogram_buffers_) {
+    const absl::string_view type = histogram_buffer.percent_ ? "|h" : "|ms";
+    const uint64_t base_size = name.size() + type.size() + histogram_buffer.tag_str_.size();
+    const auto emit = [&](const std::string& values) {
+      switch (tag_format_.tag_position) {
+      case Statsd::TagPosition::TagAfterValue:
+        writeBuffer(buffer, *tls_sink.writer_,
+                    absl::StrCat(name, values, type, histogram_buffer.tag_str_));
+        break;
+      case Statsd::TagPosition::TagAfterName:
+        writeBuffer(buffer, *tls_sink.writer_,
+                    absl::StrCat(name, histogram_buffer.tag_str_, values, type));
+        break;
+      }
+    };
+
+    std::string values;
+    for (const uint64_t value : histogram_buffer.values_) {
+      std::string rendered;
+      if (histogram_buffer.percent_) {
+        // 32-bit floating point values should have plenty of range for these values, and are
+        // faster to operate on than 64-bit doubles.
+        constexpr float divisor = Stats::Histogram::PercentScale;
+        rendered = absl::StrCat(":", static_cast<float>(value) / divisor);
+      } else {
+        rendered = absl::StrCat(":", value);
+      }
+      if (!values.empty() && base_size + values.size() + rendered.size() > max_message_size) {
+        // Adding this sample would overflow the datagram budget; emit what is buffered so far
+        // and start a new message for the same histogram.
+        emit(values);
+        values.clear();
+      }
+      absl::StrAppend(&values, rendered);
+    }
+    emit(values);
+  }
+  tls_sink.histogram_buffers_.clear();
+  flushBuffer(buffer, *tls_sink.writer_);
 }
 
 template <typename ValueType>
@@ -195,13 +272,15 @@ TcpStatsdSink::TcpStatsdSink(const LocalInfo::LocalInfo& local_info,
 void TcpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
   TlsSink& tls_sink = tls_->getTyped<TlsSink>();
   tls_sink.beginFlush(true);
-  for (const auto& counter : snapshot.counters()) {
+  const bool changed_only = Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.statsd_flush_only_changed_metrics");
+  for (const auto& counter : changed_only ? snapshot.changedCounters() : snapshot.counters()) {
     if (counter.counter_.get().used()) {
       tls_sink.flushCounter(counter.counter_.get().name(), counter.delta_);
     }
   }
 
-  for (const auto& gauge : snapshot.gauges()) {
+  for (const auto& gauge : changed_only ? snapshot.changedGauges() : snapshot.gauges()) {
     if (gauge.get().used()) {
       tls_sink.flushGauge(gauge.get().name(), gauge.get().value());
     }
@@ -17,6 +17,7 @@
 #include "source/common/network/io_socket_handle_impl.h"
 #include "source/extensions/stat_sinks/common/statsd/tag_formats.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/types/optional.h"
 
 namespace Envoy {
@@ -44,17 +45,21 @@ public:
   UdpStatsdSink(ThreadLocal::SlotAllocator& tls, Network::Address::InstanceConstSharedPtr address,
                 const bool use_tag, const std::string& prefix = getDefaultPrefix(),
                 absl::optional<uint64_t> buffer_size = absl::nullopt,
-                const Statsd::TagFormat& tag_format = Statsd::getDefaultTagFormat());
+                const Statsd::TagFormat& tag_format = Statsd::getDefaultTagFormat(),
+                const bool aggregate_histograms = false);
   // For testing.
   UdpStatsdSink(ThreadLocal::SlotAllocator& tls, const std::shared_ptr<Writer>& writer,
                 const bool use_tag, const std::string& prefix = getDefaultPrefix(),
                 absl::optional<uint64_t> buffer_size = absl::nullopt,
-                const Statsd::TagFormat& tag_format = Statsd::getDefaultTagFormat())
+                const Statsd::TagFormat& tag_format = Statsd::getDefaultTagFormat(),
+                const bool aggregate_histograms = false)
       : tls_(tls.allocateSlot()), use_tag_(use_tag),
         prefix_(prefix.empty() ? getDefaultPrefix() : prefix),
-        buffer_size_(buffer_size.value_or(0)), tag_format_(tag_format) {
-    tls_->set(
-        [writer](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr { return writer; });
+        buffer_size_(buffer_size.value_or(0)), tag_format_(tag_format),
+        aggregate_histograms_(aggregate_histograms) {
+    tls_->set([writer](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr {
+      return std::make_shared<TlsSink>(writer);
+    });
   }
 
   // Stats::Sink
@@ -82,8 +87,28 @@ private:
     const Network::IoHandlePtr io_handle_;
   };
 
+  /**
+   * Per-worker thread local state: the datagram writer plus any histogram samples buffered
+   * between stat flushes when histogram aggregation is enabled.
+   */
+  struct TlsSink : public ThreadLocal::ThreadLocalObject {
+    explicit TlsSink(std::shared_ptr<Writer> writer) : writer_(std::move(writer)) {}
+
+    // Samples accumulated for a single histogram between stat flushes.
+    struct HistogramBuffer {
+      std::string tag_str_;
+      bool percent_{false};
+      std::vector<uint64_t> values_;
+    };
+
+    const std::shared_ptr<Writer> writer_;
+    // Keyed on the prefixed metric name. Only populated when histogram aggregation is enabled.
+    absl::flat_hash_map<std::string, HistogramBuffer> histogram_buffers_;
+  };
+
   void flushBuffer(Buffer::OwnedImpl& buffer, Writer& writer) const;
   void writeBuffer(Buffer::OwnedImpl& buffer, Writer& writer, const std::string& data) const;
+  void flushHistograms(TlsSink& tls_sink) const;
 
   template <typename ValueType>
   const std::string buildMessage(const Stats::Metric& metric, ValueType value,
@@ -98,6 +123,14 @@ private:
   const std::string prefix_;
   const uint64_t buffer_size_;
   const Statsd::TagFormat tag_format_;
+  // When true (the DogStatsD sink), histogram samples are buffered per worker and emitted as
+  // multi-value packets at the stats flush interval instead of a datagram per sample.
+  const bool aggregate_histograms_;
+
+  // Budget for a rendered multi-value histogram message when max_bytes_per_datagram is not
+  // configured; matches the datagram size commonly recommended for DogStatsD over non-jumbo
+  // ethernet.
+  static constexpr uint64_t DefaultMaxBytesPerDatagram = 1432;
 };
 
 /**
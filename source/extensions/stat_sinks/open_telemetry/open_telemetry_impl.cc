@@ -14,6 +14,8 @@ OtlpOptions::OtlpOptions(const SinkConfig& sink_config)
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(sink_config, emit_tags_as_attributes, true)),
       use_tag_extracted_name_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(sink_config, use_tag_extracted_name, true)),
+      report_changed_metrics_only_(sink_config.report_changed_metrics_only()),
+      max_metrics_per_export_request_(sink_config.max_metrics_per_export_request()),
       stat_prefix_(!sink_config.prefix().empty() ? sink_config.prefix() + "." : "") {}
 
 OpenTelemetryGrpcMetricsExporterImpl::OpenTelemetryGrpcMetricsExporterImpl(
@@ -42,10 +44,24 @@ void OpenTelemetryGrpcMetricsExporterImpl::onFailure(Grpc::Status::GrpcStatus re
   ENVOY_LOG(debug, "export failure; status: {}, message: {}", response_status, response_message);
 }
 
-MetricsExportRequestPtr OtlpMetricsFlusherImpl::flush(Stats::MetricSnapshot& snapshot) const {
-  auto request = std::make_unique<MetricsExportRequest>();
-  auto* resource_metrics = request->add_resource_metrics();
-  auto* scope_metrics = resource_metrics->add_scope_metrics();
+MetricsExportRequestList OtlpMetricsFlusherImpl::flush(Stats::MetricSnapshot& snapshot) const {
+  MetricsExportRequestList requests;
+  opentelemetry::proto::metrics::v1::ScopeMetrics* scope_metrics = nullptr;
+  const uint32_t max_metrics_per_request = config_->maxMetricsPerExportRequest();
+  uint32_t metrics_in_request = 0;
+
+  // Returns the slot for the next metric, starting a new export request whenever the
+  // configured per-request batch size has been reached.
+  auto next_metric = [&]() -> opentelemetry::proto::metrics::v1::Metric* {
+    if (scope_metrics == nullptr ||
+        (max_metrics_per_request != 0 && metrics_in_request >= max_metrics_per_request)) {
+      requests.push_back(std::make_unique<MetricsExportRequest>());
+      scope_metrics = requests.back()->add_resource_metrics()->add_scope_metrics();
+      metrics_in_request = 0;
+    }
+    metrics_in_request++;
+    return scope_metrics->add_metrics();
+  };
 
   int64_t snapshot_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
                                  snapshot.snapshotTime().time_since_epoch())
@@ -53,23 +69,30 @@ MetricsExportRequestPtr OtlpMetricsFlusherImpl::flush(Stats::MetricSnapshot& sna
 
   for (const auto& gauge : snapshot.gauges()) {
     if (predicate_(gauge)) {
-      flushGauge(*scope_metrics->add_metrics(), gauge, snapshot_time_ns);
+      flushGauge(*next_metric(), gauge, snapshot_time_ns);
     }
   }
 
   for (const auto& counter : snapshot.counters()) {
     if (predicate_(counter.counter_)) {
-      flushCounter(*scope_metrics->add_metrics(), counter, snapshot_time_ns);
+      if (config_->reportChangedMetricsOnly() && counter.delta_ == 0) {
+        continue;
+      }
+      flushCounter(*next_metric(), counter, snapshot_time_ns);
     }
   }
 
   for (const auto& histogram : snapshot.histograms()) {
     if (predicate_(histogram)) {
-      flushHistogram(*scope_metrics->add_metrics(), histogram, snapshot_time_ns);
+      if (config_->reportChangedMetricsOnly() &&
+          histogram.get().intervalStatistics().sampleCount() == 0) {
+        continue;
+      }
+      flushHistogram(*next_metric(), histogram, snapshot_time_ns);
     }
   }
 
-  return request;
+  return requests;
 }
 
 void OtlpMetricsFlusherImpl::flushGauge(opentelemetry::proto::metrics::v1::Metric& metric,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "envoy/extensions/stat_sinks/open_telemetry/v3/open_telemetry.pb.h"
 #include "envoy/extensions/stat_sinks/open_telemetry/v3/open_telemetry.pb.validate.h"
@@ -31,6 +32,7 @@ using MetricsExportResponse =
 using KeyValue = opentelemetry::proto::common::v1::KeyValue;
 using MetricsExportRequestPtr = std::unique_ptr<MetricsExportRequest>;
 using MetricsExportRequestSharedPtr = std::shared_ptr<MetricsExportRequest>;
+using MetricsExportRequestList = std::vector<MetricsExportRequestPtr>;
 using SinkConfig = envoy::extensions::stat_sinks::open_telemetry::v3::SinkConfig;
 
 class OtlpOptions {
@@ -41,6 +43,8 @@ public:
   bool reportHistogramsAsDeltas() { return report_histograms_as_deltas_; }
   bool emitTagsAsAttributes() { return emit_tags_as_attributes_; }
   bool useTagExtractedName() { return use_tag_extracted_name_; }
+  bool reportChangedMetricsOnly() { return report_changed_metrics_only_; }
+  uint32_t maxMetricsPerExportRequest() { return max_metrics_per_export_request_; }
   const std::string& statPrefix() { return stat_prefix_; }
 
 private:
@@ -48,6 +52,8 @@ private:
   const bool report_histograms_as_deltas_;
   const bool emit_tags_as_attributes_;
   const bool use_tag_extracted_name_;
+  const bool report_changed_metrics_only_;
+  const uint32_t max_metrics_per_export_request_;
   const std::string stat_prefix_;
 };
 
@@ -58,10 +64,12 @@ public:
   virtual ~OtlpMetricsFlusher() = default;
 
   /**
-   * Creates an OTLP export request from metric snapshot.
+   * Creates OTLP export requests from a metric snapshot. Produces more than one request only
+   * when the configured per-request metric limit splits the flush into batches; produces no
+   * requests when nothing is to be exported.
    * @param snapshot supplies the metrics snapshot to send.
    */
-  virtual MetricsExportRequestPtr flush(Stats::MetricSnapshot& snapshot) const PURE;
+  virtual MetricsExportRequestList flush(Stats::MetricSnapshot& snapshot) const PURE;
 };
 
 using OtlpMetricsFlusherSharedPtr = std::shared_ptr<OtlpMetricsFlusher>;
@@ -76,7 +84,7 @@ public:
                                              [](const auto& metric) { return metric.used(); })
       : config_(config), predicate_(predicate) {}
 
-  MetricsExportRequestPtr flush(Stats::MetricSnapshot& snapshot) const override;
+  MetricsExportRequestList flush(Stats::MetricSnapshot& snapshot) const override;
 
 private:
   void flushGauge(opentelemetry::proto::metrics::v1::Metric& metric, const Stats::Gauge& gauge,
@@ -152,7 +160,9 @@ public:
 
   // Stats::Sink
   void flush(Stats::MetricSnapshot& snapshot) override {
-    metrics_exporter_->send(metrics_flusher_->flush(snapshot));
+    for (MetricsExportRequestPtr& request : metrics_flusher_->flush(snapshot)) {
+      metrics_exporter_->send(std::move(request));
+    }
   }
 
   void onHistogramComplete(const Stats::Histogram&, uint64_t) override {}
@@ -116,6 +116,18 @@ Tracer::Tracer(OpenTelemetryGrpcTraceExporterPtr exporter, Envoy::TimeSource& ti
   if (service_name.empty()) {
     service_name_ = std::string{kDefaultServiceName};
   }
+  // Build the request skeleton once; flushes only append spans to it.
+  ::opentelemetry::proto::trace::v1::ResourceSpans* resource_span =
+      export_request_.add_resource_spans();
+  opentelemetry::proto::common::v1::KeyValue key_value =
+      opentelemetry::proto::common::v1::KeyValue();
+  opentelemetry::proto::common::v1::AnyValue value_proto =
+      opentelemetry::proto::common::v1::AnyValue();
+  value_proto.set_string_value(std::string{service_name_});
+  key_value.set_key(std::string{kServiceNameKey});
+  *key_value.mutable_value() = value_proto;
+  (*resource_span->mutable_resource()->add_attributes()) = key_value;
+  export_scope_spans_ = resource_span->add_scope_spans();
   flush_timer_ = dispatcher.createTimer([this]() -> void {
     tracing_stats_.timer_flushed_.inc();
     flushSpans();
@@ -131,38 +143,29 @@ void Tracer::enableTimer() {
 }
 
 void Tracer::flushSpans() {
-  ExportTraceServiceRequest request;
-  // A request consists of ResourceSpans.
-  ::opentelemetry::proto::trace::v1::ResourceSpans* resource_span = request.add_resource_spans();
-  opentelemetry::proto::common::v1::KeyValue key_value =
-      opentelemetry::proto::common::v1::KeyValue();
-  opentelemetry::proto::common::v1::AnyValue value_proto =
-      opentelemetry::proto::common::v1::AnyValue();
-  value_proto.set_string_value(std::string{service_name_});
-  key_value.set_key(std::string{kServiceNameKey});
-  *key_value.mutable_value() = value_proto;
-  (*resource_span->mutable_resource()->add_attributes()) = key_value;
-  ::opentelemetry::proto::trace::v1::ScopeSpans* scope_span = resource_span->add_scope_spans();
-  for (const auto& pending_span : span_buffer_) {
-    (*scope_span->add_spans()) = pending_span;
+  if (export_scope_spans_->spans_size() == 0) {
+    // Nothing buffered; don't send empty requests to the collector.
+    return;
   }
   if (exporter_) {
-    tracing_stats_.spans_sent_.add(span_buffer_.size());
-    if (!exporter_->log(request)) {
+    tracing_stats_.spans_sent_.add(export_scope_spans_->spans_size());
+    if (!exporter_->log(export_request_)) {
       // TODO: should there be any sort of retry or reporting here?
       ENVOY_LOG(trace, "Unsuccessful log request to OpenTelemetry trace collector.");
     }
   } else {
     ENVOY_LOG(info, "Skipping log request to OpenTelemetry: no exporter configured");
   }
-  span_buffer_.clear();
+  // Drop the spans but keep the pre-built resource description and the repeated field's
+  // allocated capacity for the next batch.
+  export_scope_spans_->clear_spans();
 }
 
 void Tracer::sendSpan(::opentelemetry::proto::trace::v1::Span& span) {
-  span_buffer_.push_back(span);
+  (*export_scope_spans_->add_spans()) = span;
   const uint64_t min_flush_spans =
       runtime_.snapshot().getInteger("tracing.opentelemetry.min_flush_spans", 5U);
-  if (span_buffer_.size() >= min_flush_spans) {
+  if (static_cast<uint64_t>(export_scope_spans_->spans_size()) >= min_flush_spans) {
     flushSpans();
   }
 }
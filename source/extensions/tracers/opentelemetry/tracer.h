@@ -60,11 +60,16 @@ private:
   OpenTelemetryGrpcTraceExporterPtr exporter_;
   Envoy::TimeSource& time_source_;
   Random::RandomGenerator& random_;
-  std::vector<::opentelemetry::proto::trace::v1::Span> span_buffer_;
   Runtime::Loader& runtime_;
   Event::TimerPtr flush_timer_;
   OpenTelemetryTracerStats tracing_stats_;
   std::string service_name_;
+  // The export request doubles as the span buffer: the resource description is built once at
+  // construction and finished spans are appended directly to it, so a flush only serializes the
+  // message. Clearing just the spans after a flush keeps the allocations of the repeated field
+  // around for the next batch.
+  ExportTraceServiceRequest export_request_;
+  ::opentelemetry::proto::trace::v1::ScopeSpans* export_scope_spans_;
 };
 
 /**
@@ -14,7 +14,7 @@ class InternalSocket : public TransportSockets::PassthroughSocket {
 public:
   InternalSocket(Network::TransportSocketPtr inner_socket,
                  std::unique_ptr<envoy::config::core::v3::Metadata> metadata,
-                 const StreamInfo::FilterState::Objects& filter_state_objects);
+                 StreamInfo::FilterState::Objects filter_state_objects);
 
   // Network::TransportSocket
   void setTransportSocketCallbacks(Network::TransportSocketCallbacks& callbacks) override;
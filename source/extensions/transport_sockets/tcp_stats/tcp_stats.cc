@@ -11,6 +11,8 @@
 
 #include <linux/tcp.h>
 
+#include <algorithm>
+
 #include "envoy/buffer/buffer.h"
 #include "envoy/network/connection.h"
 
@@ -46,8 +48,20 @@ void TcpStatsSocket::setTransportSocketCallbacks(Network::TransportSocketCallbac
 void TcpStatsSocket::onConnected() {
   if (config_->update_period_.has_value()) {
     timer_ = callbacks_->connection().dispatcher().createTimer([this]() {
+      const uint64_t previous_segments = static_cast<uint64_t>(last_cx_tx_segments_) +
+                                         static_cast<uint64_t>(last_cx_rx_segments_);
       recordStats();
-      timer_->enableTimer(config_->update_period_.value());
+      // Back off collection for idle connections and tighten it again when traffic resumes.
+      // Counters are recorded as deltas, so nothing is lost by sampling an idle connection
+      // less often.
+      if (static_cast<uint64_t>(last_cx_tx_segments_) +
+              static_cast<uint64_t>(last_cx_rx_segments_) ==
+          previous_segments) {
+        idle_backoff_factor_ = std::min(idle_backoff_factor_ * 2, MaxIdleBackoffFactor);
+      } else {
+        idle_backoff_factor_ = 1;
+      }
+      timer_->enableTimer(config_->update_period_.value() * idle_backoff_factor_);
     });
     timer_->enableTimer(config_->update_period_.value());
   }
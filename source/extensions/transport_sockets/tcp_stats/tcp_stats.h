@@ -66,9 +66,19 @@ private:
   absl::optional<struct tcp_info> querySocketInfo();
   void recordStats();
 
+  // Maximum multiple of the configured update period that collection may back off to for an
+  // idle connection. A getsockopt(TCP_INFO) plus timer wakeup per connection per period is
+  // significant at high connection counts, and connections that moved no segments since the
+  // last collection produce no new counter deltas, so they are polled progressively less often
+  // until traffic resumes.
+  static constexpr uint32_t MaxIdleBackoffFactor = 8;
+
   const ConfigConstSharedPtr config_;
   Network::TransportSocketCallbacks* callbacks_{};
   Event::TimerPtr timer_;
+  // Current multiple of the configured update period; doubles (up to MaxIdleBackoffFactor) each
+  // time a collection observes no segment movement, and resets to 1 when traffic resumes.
+  uint32_t idle_backoff_factor_{1};
 
   uint32_t last_cx_tx_segments_{};
   uint32_t last_cx_rx_segments_{};
@@ -269,6 +269,7 @@ ContextImpl::ContextImpl(Stats::Scope& scope, const Envoy::Ssl::ContextConfig& c
       // We either have a private key or a BoringSSL private key method provider.
       if (private_key_method_provider) {
         ctx.private_key_method_provider_ = private_key_method_provider;
+        private_key_method_providers_.push_back(private_key_method_provider);
         // The provider has a reference to the private key method for the context lifetime.
         Ssl::BoringSslPrivateKeyMethodSharedPtr private_key_method =
             private_key_method_provider->getBoringSslPrivateKeyMethod();
@@ -579,19 +580,6 @@ void ContextImpl::logHandshake(SSL* ssl) const {
 #endif // BORINGSSL_API_VERSION
 }
 
-std::vector<Ssl::PrivateKeyMethodProviderSharedPtr> ContextImpl::getPrivateKeyMethodProviders() {
-  std::vector<Envoy::Ssl::PrivateKeyMethodProviderSharedPtr> providers;
-
-  for (auto& tls_context : tls_contexts_) {
-    Envoy::Ssl::PrivateKeyMethodProviderSharedPtr provider =
-        tls_context.getPrivateKeyMethodProvider();
-    if (provider) {
-      providers.push_back(provider);
-    }
-  }
-  return providers;
-}
-
 absl::optional<uint32_t> ContextImpl::daysUntilFirstCertExpires() const {
   absl::optional<uint32_t> daysUntilExpiration = cert_validator_->daysUntilFirstCertExpires();
   if (!daysUntilExpiration.has_value()) {
@@ -788,6 +776,9 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
   }
 
   for (auto& ctx : tls_contexts_) {
+    // is_ecdsa_ also covers EC keys provided through private key methods, which may not have a
+    // certificate chain loaded here.
+    has_ecdsa_ |= ctx.is_ecdsa_;
     if (ctx.cert_chain_ == nullptr) {
       continue;
     }
@@ -847,8 +838,10 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
              int encrypt) -> int {
             ContextImpl* context_impl =
                 static_cast<ContextImpl*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
-            ServerContextImpl* server_context_impl = dynamic_cast<ServerContextImpl*>(context_impl);
-            RELEASE_ASSERT(server_context_impl != nullptr, ""); // for Coverity
+            // Only ServerContextImpl installs this callback, so the app data is always a server
+            // context; this avoids a dynamic_cast on every ticket encrypt/decrypt.
+            ASSERT(dynamic_cast<ServerContextImpl*>(context_impl) != nullptr);
+            auto* server_context_impl = static_cast<ServerContextImpl*>(context_impl);
             return server_context_impl->sessionTicketProcess(ssl, key_name, iv, ctx, hmac_ctx,
                                                              encrypt);
           });
@@ -1231,7 +1224,10 @@ OcspStapleAction ServerContextImpl::ocspStapleAction(const TlsContext& ctx,
 
 enum ssl_select_cert_result_t
 ServerContextImpl::selectTlsContext(const SSL_CLIENT_HELLO* ssl_client_hello) {
-  const bool client_ecdsa_capable = isClientEcdsaCapable(ssl_client_hello);
+  // Don't bother parsing the hello for ECDSA capability when there is no ECDSA certificate to
+  // select; treating the client as RSA-only picks the same certificate without the scan for a
+  // preferred ECDSA match.
+  const bool client_ecdsa_capable = has_ecdsa_ && isClientEcdsaCapable(ssl_client_hello);
   const bool client_ocsp_capable = isClientOcspCapable(ssl_client_hello);
   absl::string_view sni = absl::NullSafeStringView(
       SSL_get_servername(ssl_client_hello->ssl, TLSEXT_NAMETYPE_host_name));
@@ -89,7 +89,9 @@ public:
   std::vector<Envoy::Ssl::CertificateDetailsPtr> getCertChainInformation() const override;
   absl::optional<uint64_t> secondsUntilFirstOcspResponseExpires() const override;
 
-  std::vector<Ssl::PrivateKeyMethodProviderSharedPtr> getPrivateKeyMethodProviders();
+  const std::vector<Ssl::PrivateKeyMethodProviderSharedPtr>& getPrivateKeyMethodProviders() const {
+    return private_key_method_providers_;
+  }
 
   // Validate cert asynchronously for a QUIC connection.
   ValidationResults customVerifyCertChainForQuic(
@@ -133,6 +135,10 @@ protected:
   // potentially switch to a different CertificateContext based on certificate
   // selection.
   std::vector<TlsContext> tls_contexts_;
+  // The private key method providers across all certificates, collected once at construction so
+  // that per-connection registration does not rebuild the list. Providers are fixed for the
+  // lifetime of the context; secret updates swap in a whole new context.
+  std::vector<Ssl::PrivateKeyMethodProviderSharedPtr> private_key_method_providers_;
   CertValidatorPtr cert_validator_;
   Stats::Scope& scope_;
   SslStats stats_;
@@ -217,6 +223,7 @@ private:
   const Ssl::ServerContextConfig::OcspStaplePolicy ocsp_staple_policy_;
   ServerNamesMap server_names_map_;
   bool has_rsa_{false};
+  bool has_ecdsa_{false};
   bool full_scan_certs_on_sni_mismatch_;
 };
 
@@ -52,6 +52,8 @@ SslSocket::SslSocket(Envoy::Ssl::ContextSharedPtr ctx, InitialState state,
                      Ssl::HandshakerFactoryCb handshaker_factory_cb)
     : transport_socket_options_(transport_socket_options),
       ctx_(std::dynamic_pointer_cast<ContextImpl>(ctx)),
+      dynamic_record_sizing_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.tls_dynamic_record_sizing")),
       info_(std::dynamic_pointer_cast<SslHandshakerImpl>(handshaker_factory_cb(
           ctx_->newSsl(transport_socket_options_), ctx_->sslExtendedSocketInfoIndex(), this))) {
   if (state == InitialState::Client) {
@@ -255,7 +257,7 @@ Network::IoResult SslSocket::doWrite(Buffer::Instance& write_buffer, bool end_st
     bytes_to_write = bytes_to_retry_;
     bytes_to_retry_ = 0;
   } else {
-    bytes_to_write = std::min(write_buffer.length(), static_cast<uint64_t>(16384));
+    bytes_to_write = std::min(write_buffer.length(), maxRecordSizeForWrite());
   }
 
   uint64_t total_bytes_written = 0;
@@ -272,8 +274,9 @@ Network::IoResult SslSocket::doWrite(Buffer::Instance& write_buffer, bool end_st
     if (rc > 0) {
       ASSERT(rc == static_cast<int>(bytes_to_write));
       total_bytes_written += rc;
+      total_bytes_written_ += rc;
       write_buffer.drain(rc);
-      bytes_to_write = std::min(write_buffer.length(), static_cast<uint64_t>(16384));
+      bytes_to_write = std::min(write_buffer.length(), maxRecordSizeForWrite());
     } else {
       int err = SSL_get_error(rawSsl(), rc);
       ENVOY_CONN_LOG(trace, "ssl error occurred while write: {}", callbacks_->connection(),
@@ -300,6 +303,16 @@ Network::IoResult SslSocket::doWrite(Buffer::Instance& write_buffer, bool end_st
   return {PostIoAction::KeepOpen, total_bytes_written, false};
 }
 
+uint64_t SslSocket::maxRecordSizeForWrite() const {
+  // Mirror the ramp-up other TLS stacks use: small records until the connection has pushed enough
+  // data that it is clearly in bulk transfer, full records afterwards to amortize per-record
+  // framing, MAC, and SSL_write() call overhead.
+  if (dynamic_record_sizing_ && total_bytes_written_ < DynamicRecordRampBytes) {
+    return SmallRecordSize;
+  }
+  return MaxRecordSize;
+}
+
 void SslSocket::onConnected() { ASSERT(info_->state() == Ssl::SocketState::PreHandshake); }
 
 Ssl::ConnectionInfoConstSharedPtr SslSocket::ssl() const { return info_; }
@@ -457,6 +470,11 @@ bool ServerSslSocketFactory::implementsSecureTransport() const { return true; }
 
 void ServerSslSocketFactory::onAddOrUpdateSecret() {
   ENVOY_LOG(debug, "Secret is updated.");
+  // Contexts are deliberately immutable once built: rotation constructs the replacement off the
+  // hot path and publishes it with a pointer swap, rather than mutating certificate material
+  // inside the live SSL_CTX, so sockets created concurrently always observe a fully consistent
+  // context. The factory itself is never rebuilt, and session ticket keys supplied via config
+  // (static or SDS) are carried into the replacement context.
   auto ctx = manager_.createSslServerContext(stats_scope_, *config_, server_names_);
   {
     absl::WriterMutexLock l(&ssl_ctx_mu_);
@@ -90,11 +90,22 @@ private:
   void shutdownSsl();
   void shutdownBasic();
   void resumeHandshake();
+  uint64_t maxRecordSizeForWrite() const;
+
+  // The largest plaintext record SSL_write() is handed at once.
+  static constexpr uint64_t MaxRecordSize = 16384;
+  // With dynamic record sizing, records are capped at this size until the connection has written
+  // DynamicRecordRampBytes, so that early latency-sensitive bytes fit in a single packet and a
+  // lost segment does not stall decryption of a full 16KB record.
+  static constexpr uint64_t SmallRecordSize = 1400;
+  static constexpr uint64_t DynamicRecordRampBytes = 64 * 1024;
 
   const Network::TransportSocketOptionsConstSharedPtr transport_socket_options_;
   Network::TransportSocketCallbacks* callbacks_{};
   ContextImplSharedPtr ctx_;
   uint64_t bytes_to_retry_{};
+  const bool dynamic_record_sizing_;
+  uint64_t total_bytes_written_{};
   std::string failure_reason_;
 
   SslHandshakerImplSharedPtr info_;
@@ -56,6 +56,10 @@ void ActiveUdpListenerBase::onData(Network::UdpRecvData&& data) {
   if (dest == worker_index_) {
     onDataWorker(std::move(data));
   } else {
+    // The kernel steered this datagram to the wrong worker, so it pays a cross-thread hop.
+    // A persistently high rate relative to received datagrams indicates that kernel packet
+    // steering (e.g. the QUIC connection id BPF program) is not in effect.
+    udp_stats_.downstream_rx_datagram_redirected_.inc();
     udp_listener_worker_router_.deliver(dest, std::move(data));
   }
 }
@@ -120,7 +120,7 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
       route_config_provider_(server.timeSource()),
       scoped_route_config_provider_(server.timeSource()), clusters_handler_(server),
       config_dump_handler_(config_tracker_, server), init_dump_handler_(server),
-      stats_handler_(server), logs_handler_(server), profiling_handler_(profile_path),
+      stats_handler_(server), logs_handler_(server), profiling_handler_(profile_path, server),
       runtime_handler_(server), listeners_handler_(server), server_cmd_handler_(server),
       server_info_handler_(server),
       // TODO(jsedgwick) add /runtime_reset endpoint that removes all admin-set values
@@ -130,9 +130,9 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
                       MAKE_ADMIN_HANDLER(server_info_handler_.handlerCerts), false, false),
           makeHandler("/clusters", "upstream cluster status",
                       MAKE_ADMIN_HANDLER(clusters_handler_.handlerClusters), false, false),
-          makeHandler(
-              "/config_dump", "dump current Envoy configs (experimental)",
-              MAKE_ADMIN_HANDLER(config_dump_handler_.handlerConfigDump), false, false,
+          makeStreamingHandler(
+              "/config_dump", "dump current Envoy configs (experimental)", config_dump_handler_,
+              false, false,
               {{Admin::ParamDescriptor::Type::String, "resource", "The resource to dump"},
                {Admin::ParamDescriptor::Type::String, "mask",
                 "The mask to apply. When both resource and mask are specified, "
@@ -157,7 +157,11 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
                       {{Admin::ParamDescriptor::Type::Enum,
                         "enable",
                         "enables the CPU profiler",
-                        {"y", "n"}}}),
+                        {"y", "n"}},
+                       {Admin::ParamDescriptor::Type::String, "seconds",
+                        "stops the profiler automatically after this many seconds"}}),
+          makeHandler("/cpu_profile_dump", "dump the most recently collected CPU profile (if any)",
+                      MAKE_ADMIN_HANDLER(profiling_handler_.handlerCpuProfileDump), false, false),
           makeHandler("/heapprofiler", "enable/disable the heap profiler",
                       MAKE_ADMIN_HANDLER(profiling_handler_.handlerHeapProfiler), false, true,
                       {{Admin::ParamDescriptor::Type::Enum,
@@ -190,6 +194,9 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
                         prepend("", LogsHandler::levelStrings())}}),
           makeHandler("/memory", "print current allocation/heap usage",
                       MAKE_ADMIN_HANDLER(server_info_handler_.handlerMemory), false, false),
+          makeHandler("/memory_detail",
+                      "print detailed allocator statistics including per-size-class usage",
+                      MAKE_ADMIN_HANDLER(server_info_handler_.handlerMemoryDetail), false, false),
           makeHandler("/quitquitquit", "exit the server",
                       MAKE_ADMIN_HANDLER(server_cmd_handler_.handlerQuitQuitQuit), false, true),
           makeHandler("/reset_counters", "reset all counters to zero",
@@ -210,15 +217,7 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
           makeHandler("/ready", "print server state, return 200 if LIVE, otherwise return 503",
                       MAKE_ADMIN_HANDLER(server_info_handler_.handlerReady), false, false),
           stats_handler_.statsHandler(false /* not active mode */),
-          makeHandler("/stats/prometheus", "print server stats in prometheus format",
-                      MAKE_ADMIN_HANDLER(stats_handler_.handlerPrometheusStats), false, false,
-                      {{ParamDescriptor::Type::Boolean, "usedonly",
-                        "Only include stats that have been written by system since restart"},
-                       {ParamDescriptor::Type::Boolean, "text_readouts",
-                        "Render text_readouts as new gaugues with value 0 (increases Prometheus "
-                        "data size)"},
-                       {ParamDescriptor::Type::String, "filter",
-                        "Regular expression (Google re2) for filtering stats"}}),
+          stats_handler_.prometheusStatsHandler(),
           makeHandler("/stats/recentlookups", "Show recent stat-name lookups",
                       MAKE_ADMIN_HANDLER(stats_handler_.handlerStatsRecentLookups), false, false),
           makeHandler("/stats/recentlookups/clear", "clear list of stat-name lookups and counter",
@@ -3,6 +3,7 @@
 #include "envoy/config/core/v3/health_check.pb.h"
 #include "envoy/config/endpoint/v3/endpoint.pb.h"
 
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/common/matchers.h"
 #include "source/common/common/regex.h"
 #include "source/common/common/statusor.h"
@@ -11,6 +12,8 @@
 #include "source/common/network/utility.h"
 #include "source/server/admin/utils.h"
 
+#include "absl/strings/strip.h"
+
 namespace Envoy {
 namespace Server {
 
@@ -152,45 +155,146 @@ buildNameMatcher(const Http::Utility::QueryParams& params) {
   }
 }
 
+// The envelope a pretty-printed ConfigDump message serializes to. Streaming chunks splice
+// per-provider array elements between the prefix and suffix so that the concatenated chunks are
+// byte-identical to serializing the whole dump at once.
+constexpr absl::string_view ConfigsArrayPrefix = "{\n \"configs\": [\n";
+constexpr absl::string_view ConfigsElementSeparator = ",\n";
+constexpr absl::string_view ConfigsArraySuffix = "\n ]\n}\n";
+
 } // namespace
 
-ConfigDumpHandler::ConfigDumpHandler(ConfigTracker& config_tracker, Server::Instance& server)
-    : HandlerContextBase(server), config_tracker_(config_tracker) {}
+// Streams a config dump out one config provider at a time: each provider's config is packed,
+// redacted, and serialized as its own chunk, so the largest buffered unit is a single provider's
+// dump rather than the whole response, and flow-control watermarks can take effect between
+// providers. The ?resource= and ?mask= variants keep the single-buffer implementation: their
+// outputs are small by construction and their error responses need the status code decided
+// before any of the body is written.
+class ConfigDumpRequest : public Admin::Request {
+public:
+  ConfigDumpRequest(const ConfigDumpHandler& handler, AdminStream& admin_stream)
+      : handler_(handler) {
+    Http::Utility::QueryParams query_params = admin_stream.queryParams();
+    resource_ = resourceParam(query_params);
+    mask_ = maskParam(query_params);
+    include_eds_ = shouldIncludeEdsInDump(query_params);
+    absl::StatusOr<Matchers::StringMatcherPtr> name_matcher = buildNameMatcher(query_params);
+    if (name_matcher.ok()) {
+      name_matcher_ = std::move(*name_matcher);
+    } else {
+      name_matcher_error_ = name_matcher.status();
+    }
+  }
 
-Http::Code ConfigDumpHandler::handlerConfigDump(Http::ResponseHeaderMap& response_headers,
-                                                Buffer::Instance& response,
-                                                AdminStream& admin_stream) const {
-  Http::Utility::QueryParams query_params = admin_stream.queryParams();
-  const auto resource = resourceParam(query_params);
-  const auto mask = maskParam(query_params);
-  const bool include_eds = shouldIncludeEdsInDump(query_params);
-  const absl::StatusOr<Matchers::StringMatcherPtr> name_matcher = buildNameMatcher(query_params);
-  if (!name_matcher.ok()) {
-    response.add(name_matcher.status().ToString());
-    response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Text);
-    return Http::Code::BadRequest;
+  Http::Code start(Http::ResponseHeaderMap& response_headers) override {
+    if (name_matcher_ == nullptr) {
+      response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Text);
+      buffered_.add(name_matcher_error_.ToString());
+      return Http::Code::BadRequest;
+    }
+    if (resource_.has_value() || mask_.has_value()) {
+      return startBuffered(response_headers);
+    }
+
+    callbacks_map_ = handler_.config_tracker_.getCallbacksMap();
+    if (include_eds_) {
+      // TODO(mattklein123): Add ability to see warming clusters in admin output.
+      auto all_clusters = handler_.server_.clusterManager().clusters();
+      if (!all_clusters.active_clusters_.empty()) {
+        callbacks_map_.emplace("endpoint", [this](const Matchers::StringMatcher& name_matcher) {
+          return handler_.dumpEndpointConfigs(name_matcher);
+        });
+      }
+    }
+    response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Json);
+    if (callbacks_map_.empty()) {
+      // An empty dump serializes to "{}" rather than an empty "configs" array, so it cannot be
+      // assembled from per-provider pieces.
+      buffered_.add(
+          MessageUtil::getJsonStringFromMessageOrError(envoy::admin::v3::ConfigDump(), true));
+      return Http::Code::OK;
+    }
+    streaming_ = true;
+    next_provider_ = callbacks_map_.begin();
+    return Http::Code::OK;
   }
 
-  envoy::admin::v3::ConfigDump dump;
+  bool nextChunk(Buffer::Instance& response) override {
+    if (!streaming_) {
+      response.move(buffered_);
+      return false;
+    }
+    if (next_provider_ == callbacks_map_.end()) {
+      response.add(ConfigsArraySuffix);
+      return false;
+    }
+    response.add(next_provider_ == callbacks_map_.begin() ? ConfigsArrayPrefix
+                                                          : ConfigsElementSeparator);
+    addProviderDump(response, next_provider_->second);
+    ++next_provider_;
+    return true;
+  }
 
-  absl::optional<std::pair<Http::Code, std::string>> err;
-  if (resource.has_value()) {
-    err = addResourceToDump(dump, mask, resource.value(), **name_matcher, include_eds);
-  } else {
-    err = addAllConfigToDump(dump, mask, **name_matcher, include_eds);
+private:
+  // Runs the ?resource= / ?mask= flavors of the dump into buffered_ so that errors discovered
+  // while building it can still change the response code.
+  Http::Code startBuffered(Http::ResponseHeaderMap& response_headers) {
+    envoy::admin::v3::ConfigDump dump;
+    absl::optional<std::pair<Http::Code, std::string>> err;
+    if (resource_.has_value()) {
+      err = handler_.addResourceToDump(dump, mask_, resource_.value(), *name_matcher_,
+                                       include_eds_);
+    } else {
+      err = handler_.addAllConfigToDump(dump, mask_, *name_matcher_, include_eds_);
+    }
+    if (err.has_value()) {
+      response_headers.addReference(Http::Headers::get().XContentTypeOptions,
+                                    Http::Headers::get().XContentTypeOptionValues.Nosniff);
+      response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Text);
+      buffered_.add(err.value().second);
+      return err.value().first;
+    }
+    MessageUtil::redact(dump);
+    response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Json);
+    buffered_.add(MessageUtil::getJsonStringFromMessageOrError(dump, true)); // pretty-print
+    return Http::Code::OK;
   }
-  if (err.has_value()) {
-    response_headers.addReference(Http::Headers::get().XContentTypeOptions,
-                                  Http::Headers::get().XContentTypeOptionValues.Nosniff);
-    response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Text);
-    response.add(err.value().second);
-    return err.value().first;
+
+  void addProviderDump(Buffer::Instance& response, const ConfigTracker::Cb& callback) const {
+    ProtobufTypes::MessagePtr message = callback(*name_matcher_);
+    ASSERT(message);
+    envoy::admin::v3::ConfigDump dump;
+    dump.add_configs()->PackFrom(*message);
+    MessageUtil::redact(dump);
+    const std::string json = MessageUtil::getJsonStringFromMessageOrError(dump, true);
+    absl::string_view element = json;
+    // A single-config dump serializes to the envelope wrapped around exactly one array element;
+    // strip the envelope so the element can be spliced into the array being built up across
+    // chunks. If serialization failed, the error string passes through unmodified, as it did
+    // when the whole dump was serialized at once.
+    if (absl::ConsumePrefix(&element, ConfigsArrayPrefix)) {
+      absl::ConsumeSuffix(&element, ConfigsArraySuffix);
+    }
+    response.add(element);
   }
-  MessageUtil::redact(dump);
 
-  response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Json);
-  response.add(MessageUtil::getJsonStringFromMessageOrError(dump, true)); // pretty-print
-  return Http::Code::OK;
+  const ConfigDumpHandler& handler_;
+  absl::optional<std::string> resource_;
+  absl::optional<std::string> mask_;
+  bool include_eds_{false};
+  Matchers::StringMatcherPtr name_matcher_;
+  absl::Status name_matcher_error_;
+  bool streaming_{false};
+  Buffer::OwnedImpl buffered_;
+  ConfigTracker::CbsMap callbacks_map_;
+  ConfigTracker::CbsMap::const_iterator next_provider_;
+};
+
+ConfigDumpHandler::ConfigDumpHandler(ConfigTracker& config_tracker, Server::Instance& server)
+    : HandlerContextBase(server), config_tracker_(config_tracker) {}
+
+Admin::RequestPtr ConfigDumpHandler::makeRequest(AdminStream& admin_stream) const {
+  return std::make_unique<ConfigDumpRequest>(*this, admin_stream);
 }
 
 absl::optional<std::pair<Http::Code, std::string>> ConfigDumpHandler::addResourceToDump(
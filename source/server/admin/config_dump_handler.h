@@ -21,10 +21,15 @@ class ConfigDumpHandler : public HandlerContextBase {
 public:
   ConfigDumpHandler(ConfigTracker& config_tracker, Server::Instance& server);
 
-  Http::Code handlerConfigDump(Http::ResponseHeaderMap& response_headers,
-                               Buffer::Instance& response, AdminStream&) const;
+  /**
+   * Creates a streaming request for a config dump; the response is emitted one
+   * config provider at a time rather than being buffered in full.
+   */
+  Admin::RequestPtr makeRequest(AdminStream& admin_stream) const;
 
 private:
+  friend class ConfigDumpRequest;
+
   absl::optional<std::pair<Http::Code, std::string>>
   addAllConfigToDump(envoy::admin::v3::ConfigDump& dump, const absl::optional<std::string>& mask,
                      const Matchers::StringMatcher& name_matcher, bool include_eds) const;
@@ -3,29 +3,57 @@
 #include "source/common/profiler/profiler.h"
 #include "source/server/admin/utils.h"
 
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+
 namespace Envoy {
 namespace Server {
 
-ProfilingHandler::ProfilingHandler(const std::string& profile_path) : profile_path_(profile_path) {}
+ProfilingHandler::ProfilingHandler(const std::string& profile_path, Server::Instance& server)
+    : HandlerContextBase(server), profile_path_(profile_path) {}
 
 Http::Code ProfilingHandler::handlerCpuProfiler(Http::ResponseHeaderMap&,
                                                 Buffer::Instance& response,
                                                 AdminStream& admin_stream) {
   Http::Utility::QueryParams query_params = admin_stream.queryParams();
-  if (query_params.size() != 1 || query_params.begin()->first != "enable" ||
-      (query_params.begin()->second != "y" && query_params.begin()->second != "n")) {
-    response.add("?enable=<y|n>\n");
+  const auto enable_param = query_params.find("enable");
+  const auto seconds_param = query_params.find("seconds");
+  uint64_t seconds = 0;
+  bool valid = enable_param != query_params.end() &&
+               (enable_param->second == "y" || enable_param->second == "n");
+  if (valid && seconds_param != query_params.end()) {
+    // A timed run only makes sense when starting the profiler.
+    valid = query_params.size() == 2 && enable_param->second == "y" &&
+            absl::SimpleAtoi(seconds_param->second, &seconds) && seconds > 0;
+  } else if (valid) {
+    valid = query_params.size() == 1;
+  }
+  if (!valid) {
+    response.add("?enable=<y|n>[&seconds=<duration>]\n");
     return Http::Code::BadRequest;
   }
 
-  bool enable = query_params.begin()->second == "y";
+  bool enable = enable_param->second == "y";
   if (enable && !Profiler::Cpu::profilerEnabled()) {
     if (!Profiler::Cpu::startProfiler(profile_path_)) {
       response.add("failure to start the profiler");
       return Http::Code::InternalServerError;
     }
-
+    if (seconds > 0) {
+      if (stop_profiler_timer_ == nullptr) {
+        stop_profiler_timer_ = server_.dispatcher().createTimer([]() {
+          if (Profiler::Cpu::profilerEnabled()) {
+            Profiler::Cpu::stopProfiler();
+          }
+        });
+      }
+      stop_profiler_timer_->enableTimer(
+          std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::seconds(seconds)));
+    }
   } else if (!enable && Profiler::Cpu::profilerEnabled()) {
+    if (stop_profiler_timer_ != nullptr) {
+      stop_profiler_timer_->disableTimer();
+    }
     Profiler::Cpu::stopProfiler();
   }
 
@@ -33,6 +61,30 @@ Http::Code ProfilingHandler::handlerCpuProfiler(Http::ResponseHeaderMap&,
   return Http::Code::OK;
 }
 
+Http::Code ProfilingHandler::handlerCpuProfileDump(Http::ResponseHeaderMap&,
+                                                   Buffer::Instance& response, AdminStream&) {
+  if (Profiler::Cpu::profilerEnabled()) {
+    response.add("the CPU profiler is running; disable it before dumping the profile\n");
+    return Http::Code::BadRequest;
+  }
+
+  if (!server_.api().fileSystem().fileExists(profile_path_)) {
+    response.add("no CPU profile has been collected\n");
+    return Http::Code::NotFound;
+  }
+
+  const absl::StatusOr<std::string> profile =
+      server_.api().fileSystem().fileReadToEnd(profile_path_);
+  if (!profile.ok()) {
+    response.add(
+        absl::StrCat("failed to read the CPU profile: ", profile.status().message(), "\n"));
+    return Http::Code::InternalServerError;
+  }
+
+  response.add(profile.value());
+  return Http::Code::OK;
+}
+
 Http::Code ProfilingHandler::handlerHeapProfiler(Http::ResponseHeaderMap&,
                                                  Buffer::Instance& response,
                                                  AdminStream& admin_stream) {
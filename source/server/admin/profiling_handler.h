@@ -1,28 +1,36 @@
 #pragma once
 
 #include "envoy/buffer/buffer.h"
+#include "envoy/event/timer.h"
 #include "envoy/http/codes.h"
 #include "envoy/http/header_map.h"
 #include "envoy/server/admin.h"
 
+#include "source/server/admin/handler_ctx.h"
+
 #include "absl/strings/string_view.h"
 
 namespace Envoy {
 namespace Server {
 
-class ProfilingHandler {
+class ProfilingHandler : public HandlerContextBase {
 
 public:
-  ProfilingHandler(const std::string& profile_path);
+  ProfilingHandler(const std::string& profile_path, Server::Instance& server);
 
   Http::Code handlerCpuProfiler(Http::ResponseHeaderMap& response_headers,
                                 Buffer::Instance& response, AdminStream&);
 
+  Http::Code handlerCpuProfileDump(Http::ResponseHeaderMap& response_headers,
+                                   Buffer::Instance& response, AdminStream&);
+
   Http::Code handlerHeapProfiler(Http::ResponseHeaderMap& response_headers,
                                  Buffer::Instance& response, AdminStream&);
 
 private:
   const std::string profile_path_;
+  // Stops a timed profiling run started with the `seconds` query parameter.
+  Event::TimerPtr stop_profiler_timer_;
 };
 
 class TcmallocProfilingHandler {
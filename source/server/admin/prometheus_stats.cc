@@ -43,34 +43,6 @@ std::string sanitizeValue(const absl::string_view value) {
                                     });
 }
 
-/**
- * Determines whether a metric should be shown based on the specified query-parameters. This covers:
- * ``usedonly``, hidden, and filter.
- *
- * @param metric the metric to test
- * @param params captures query parameters indicating which metrics should be included.
- */
-template <class StatType>
-static bool shouldShowMetric(const StatType& metric, const StatsParams& params) {
-  // This duplicates logic in StatsRequest::populateStatsFromScopes, but differs
-  // in one subtle way: in Prometheus we only use metric.name() for filtering,
-  // not rendering, so we only construct the name if there's a filter.
-  if (params.used_only_ && !metric.used()) {
-    return false;
-  }
-  if (params.hidden_ == HiddenFlag::ShowOnly && !metric.hidden()) {
-    return false;
-  }
-  if (params.hidden_ == HiddenFlag::Exclude && metric.hidden()) {
-    return false;
-  }
-  if (params.re2_filter_ != nullptr &&
-      !re2::RE2::PartialMatch(metric.name(), *params.re2_filter_)) {
-    return false;
-  }
-  return true;
-}
-
 /*
  * Comparator for Stats::Metric that does not require a string representation
  * to make the comparison, for memory efficiency.
@@ -138,7 +110,7 @@ uint64_t outputStatType(
 
   for (const auto& metric : metrics) {
     ASSERT(&global_symbol_table == &metric->constSymbolTable());
-    if (!shouldShowMetric(*metric, params)) {
+    if (!PrometheusStatsFormatter::shouldShowMetric(*metric, params)) {
       continue;
     }
     groups[metric->tagExtractedStatName()].push_back(metric.get());
@@ -177,6 +149,8 @@ std::string generateNumericOutput(const StatType& metric,
   return fmt::format("{0}{{{1}}} {2}\n", prefixed_tag_extracted_name, tags, metric.value());
 }
 
+} // namespace
+
 /*
  * Returns the prometheus output for a TextReadout in gauge format.
  * It is a workaround of a limitation of prometheus which stores only numeric metrics.
@@ -184,21 +158,33 @@ std::string generateNumericOutput(const StatType& metric,
  * always equal to 0. Returned gauge contains all tags of a given text-readout and one additional
  * tag {"text_value":"textReadout.value"}.
  */
-std::string generateTextReadoutOutput(const Stats::TextReadout& text_readout,
-                                      const std::string& prefixed_tag_extracted_name) {
+std::string PrometheusStatsFormatter::generateTextReadoutOutput(
+    const Stats::TextReadout& text_readout, const std::string& prefixed_tag_extracted_name) {
   auto tags = text_readout.tags();
   tags.push_back(Stats::Tag{"text_value", text_readout.value()});
   const std::string formattedTags = PrometheusStatsFormatter::formattedTags(tags);
   return fmt::format("{0}{{{1}}} 0\n", prefixed_tag_extracted_name, formattedTags);
 }
 
+std::string
+PrometheusStatsFormatter::generateCounterOutput(const Stats::Counter& counter,
+                                                const std::string& prefixed_tag_extracted_name) {
+  return generateNumericOutput(counter, prefixed_tag_extracted_name);
+}
+
+std::string
+PrometheusStatsFormatter::generateGaugeOutput(const Stats::Gauge& gauge,
+                                              const std::string& prefixed_tag_extracted_name) {
+  return generateNumericOutput(gauge, prefixed_tag_extracted_name);
+}
+
 /*
  * Returns the prometheus output for a histogram. The output is a multi-line string (with embedded
  * newlines) that contains all the individual bucket counts and sum/count for a single histogram
  * (metric_name plus all tags).
  */
-std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
-                                    const std::string& prefixed_tag_extracted_name) {
+std::string PrometheusStatsFormatter::generateHistogramOutput(
+    const Stats::ParentHistogram& histogram, const std::string& prefixed_tag_extracted_name) {
   const std::string tags = PrometheusStatsFormatter::formattedTags(histogram.tags());
   const std::string hist_tags = histogram.tags().empty() ? EMPTY_STRING : (tags + ",");
 
@@ -226,9 +212,7 @@ std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
                             stats.sampleCount()));
 
   return output;
-};
-
-} // namespace
+}
 
 std::string PrometheusStatsFormatter::formattedTags(const std::vector<Stats::Tag>& tags) {
   std::vector<std::string> buf;
@@ -273,12 +257,11 @@ uint64_t PrometheusStatsFormatter::statsAsPrometheus(
     const StatsParams& params, const Stats::CustomStatNamespaces& custom_namespaces) {
 
   uint64_t metric_name_count = 0;
-  metric_name_count += outputStatType<Stats::Counter>(response, params, counters,
-                                                      generateNumericOutput<Stats::Counter>,
-                                                      "counter", custom_namespaces);
+  metric_name_count += outputStatType<Stats::Counter>(
+      response, params, counters, generateCounterOutput, "counter", custom_namespaces);
 
-  metric_name_count += outputStatType<Stats::Gauge>(
-      response, params, gauges, generateNumericOutput<Stats::Gauge>, "gauge", custom_namespaces);
+  metric_name_count += outputStatType<Stats::Gauge>(response, params, gauges, generateGaugeOutput,
+                                                    "gauge", custom_namespaces);
 
   // TextReadout stats are returned in gauge format, so "gauge" type is set intentionally.
   metric_name_count += outputStatType<Stats::TextReadout>(
@@ -45,6 +45,47 @@ public:
   static absl::optional<std::string>
   metricName(const std::string& extracted_name,
              const Stats::CustomStatNamespaces& custom_namespace_factory);
+
+  /**
+   * Determines whether a metric should be shown based on the specified query-parameters. This
+   * covers: ``usedonly``, hidden, and filter.
+   *
+   * @param metric the metric to test
+   * @param params captures query parameters indicating which metrics should be included.
+   */
+  template <class StatType>
+  static bool shouldShowMetric(const StatType& metric, const StatsParams& params) {
+    // This duplicates logic in StatsRequest::populateStatsFromScopes, but differs
+    // in one subtle way: in Prometheus we only use metric.name() for filtering,
+    // not rendering, so we only construct the name if there's a filter.
+    if (params.used_only_ && !metric.used()) {
+      return false;
+    }
+    if (params.hidden_ == HiddenFlag::ShowOnly && !metric.hidden()) {
+      return false;
+    }
+    if (params.hidden_ == HiddenFlag::Exclude && metric.hidden()) {
+      return false;
+    }
+    if (params.re2_filter_ != nullptr &&
+        !re2::RE2::PartialMatch(metric.name(), *params.re2_filter_)) {
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * The per-metric output lines for each supported metric type, shared between
+   * the buffered statsAsPrometheus path and the streaming PrometheusStatsRequest.
+   */
+  static std::string generateCounterOutput(const Stats::Counter& counter,
+                                           const std::string& prefixed_tag_extracted_name);
+  static std::string generateGaugeOutput(const Stats::Gauge& gauge,
+                                         const std::string& prefixed_tag_extracted_name);
+  static std::string generateTextReadoutOutput(const Stats::TextReadout& text_readout,
+                                               const std::string& prefixed_tag_extracted_name);
+  static std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
+                                             const std::string& prefixed_tag_extracted_name);
 };
 
 } // namespace Server
@@ -0,0 +1,158 @@
+#include "source/server/admin/prometheus_stats_request.h"
+
+#include <string>
+
+#include "source/common/common/assert.h"
+#include "source/common/common/fmt.h"
+#include "source/server/admin/prometheus_stats.h"
+
+namespace Envoy {
+namespace Server {
+
+// Declared ahead of startPhase() so the specialization below is used for
+// histograms rather than the primary template.
+template <> void PrometheusStatsRequest::populateGroupsFromStore<Stats::Histogram>();
+
+PrometheusStatsRequest::PrometheusStatsRequest(
+    Stats::Store& stats, const StatsParams& params,
+    const Stats::CustomStatNamespaces& custom_namespaces)
+    : params_(params), stats_(stats), custom_namespaces_(custom_namespaces),
+      groups_(Stats::StatNameLessThan(stats.constSymbolTable())) {}
+
+Http::Code PrometheusStatsRequest::start(Http::ResponseHeaderMap&) {
+  startPhase();
+  return Http::Code::OK;
+}
+
+bool PrometheusStatsRequest::nextChunk(Buffer::Instance& response) {
+  // nextChunk's contract is to add up to chunk_size_ additional bytes. The
+  // caller is not required to drain the bytes after each call to nextChunk.
+  const uint64_t starting_response_length = response.length();
+  while (response.length() - starting_response_length < chunk_size_) {
+    while (groups_.empty()) {
+      if (!advancePhase()) {
+        return false;
+      }
+    }
+
+    // Emit one whole metric family, so that the TYPE line and all the
+    // family's series stay in a single group as the exposition format
+    // requires.
+    auto iter = groups_.begin();
+    const absl::optional<std::string> prefixed_tag_extracted_name =
+        PrometheusStatsFormatter::metricName(stats_.constSymbolTable().toString(iter->first),
+                                             custom_namespaces_);
+    if (prefixed_tag_extracted_name.has_value()) {
+      switch (phase_) {
+      case Phase::Counters:
+        renderGroup<Stats::Counter>(response, iter->second, *prefixed_tag_extracted_name,
+                                    "counter", PrometheusStatsFormatter::generateCounterOutput);
+        break;
+      case Phase::Gauges:
+        renderGroup<Stats::Gauge>(response, iter->second, *prefixed_tag_extracted_name, "gauge",
+                                  PrometheusStatsFormatter::generateGaugeOutput);
+        break;
+      case Phase::TextReadouts:
+        // TextReadout stats are returned in gauge format, so "gauge" type is
+        // set intentionally.
+        renderGroup<Stats::TextReadout>(response, iter->second, *prefixed_tag_extracted_name,
+                                        "gauge",
+                                        PrometheusStatsFormatter::generateTextReadoutOutput);
+        break;
+      case Phase::Histograms:
+        renderGroup<Stats::ParentHistogram>(response, iter->second, *prefixed_tag_extracted_name,
+                                            "histogram",
+                                            PrometheusStatsFormatter::generateHistogramOutput);
+        break;
+      }
+    }
+    groups_.erase(iter);
+  }
+  return true;
+}
+
+void PrometheusStatsRequest::startPhase() {
+  ASSERT(groups_.empty());
+  switch (phase_) {
+  case Phase::Counters:
+    populateGroupsFromStore<Stats::Counter>();
+    break;
+  case Phase::Gauges:
+    populateGroupsFromStore<Stats::Gauge>();
+    break;
+  case Phase::TextReadouts:
+    populateGroupsFromStore<Stats::TextReadout>();
+    break;
+  case Phase::Histograms:
+    populateGroupsFromStore<Stats::Histogram>();
+    break;
+  }
+}
+
+bool PrometheusStatsRequest::advancePhase() {
+  switch (phase_) {
+  case Phase::Counters:
+    phase_ = Phase::Gauges;
+    break;
+  case Phase::Gauges:
+    phase_ = params_.prometheus_text_readouts_ ? Phase::TextReadouts : Phase::Histograms;
+    break;
+  case Phase::TextReadouts:
+    phase_ = Phase::Histograms;
+    break;
+  case Phase::Histograms:
+    return false;
+  }
+  startPhase();
+  return true;
+}
+
+template <class StatType> void PrometheusStatsRequest::populateGroupsFromStore() {
+  Stats::IterateFn<StatType> add_stat =
+      [this](const Stats::RefcountPtr<StatType>& stat) -> bool {
+    if (PrometheusStatsFormatter::shouldShowMetric(*stat, params_)) {
+      groups_[stat->tagExtractedStatName()].push_back(stat);
+    }
+    return true;
+  };
+  stats_.iterate(add_stat);
+}
+
+// The store iterates histograms as Stats::Histogram, but only parent
+// histograms, which carry the cumulative data, are renderable.
+template <> void PrometheusStatsRequest::populateGroupsFromStore<Stats::Histogram>() {
+  Stats::IterateFn<Stats::Histogram> add_stat =
+      [this](const Stats::RefcountPtr<Stats::Histogram>& stat) -> bool {
+    if (dynamic_cast<Stats::ParentHistogram*>(stat.get()) != nullptr &&
+        PrometheusStatsFormatter::shouldShowMetric(*stat, params_)) {
+      groups_[stat->tagExtractedStatName()].push_back(stat);
+    }
+    return true;
+  };
+  stats_.iterate(add_stat);
+}
+
+template <class StatType>
+void PrometheusStatsRequest::renderGroup(
+    Buffer::Instance& response, Group& group, const std::string& prefixed_tag_extracted_name,
+    absl::string_view type,
+    const std::function<std::string(const StatType&, const std::string&)>& generate_output) const {
+  response.add(fmt::format("# TYPE {0} {1}\n", prefixed_tag_extracted_name, type));
+
+  // Sort before producing the final output to satisfy the "preferred" ordering
+  // from the prometheus spec: metrics will be sorted by their tags' textual
+  // representation, which will be consistent across calls.
+  stats_.constSymbolTable().sortByStatNames<Stats::RefcountPtr<Stats::Metric>>(
+      group.begin(), group.end(),
+      [](const Stats::RefcountPtr<Stats::Metric>& metric) -> Stats::StatName {
+        return metric->statName();
+      });
+
+  for (const Stats::RefcountPtr<Stats::Metric>& metric : group) {
+    response.add(generate_output(dynamic_cast<const StatType&>(*metric),
+                                 prefixed_tag_extracted_name));
+  }
+}
+
+} // namespace Server
+} // namespace Envoy
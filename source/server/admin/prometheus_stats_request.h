@@ -0,0 +1,87 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "envoy/server/admin.h"
+#include "envoy/stats/custom_stat_namespaces.h"
+#include "envoy/stats/store.h"
+
+#include "source/common/stats/symbol_table.h"
+#include "source/server/admin/stats_params.h"
+
+namespace Envoy {
+namespace Server {
+
+// Streaming implementation of the Prometheus exposition format, implementing
+// the chunked Admin::Request interface like StatsRequest does for the text and
+// JSON formats, so that a scrape of a very large stat universe does not
+// materialize the entire response in memory.
+class PrometheusStatsRequest : public Admin::Request {
+  // All lines for a metric family must be emitted as a single group, with the
+  // TYPE line first, so we stream one family at a time rather than one metric
+  // at a time. We iterate over the four metric types in the same order as the
+  // fully-buffered implementation so the output is unchanged.
+  enum class Phase {
+    Counters,
+    Gauges,
+    TextReadouts,
+    Histograms,
+  };
+
+public:
+  static constexpr uint64_t DefaultChunkSize = 2 * 1000 * 1000;
+
+  PrometheusStatsRequest(Stats::Store& stats, const StatsParams& params,
+                         const Stats::CustomStatNamespaces& custom_namespaces);
+
+  // Admin::Request
+  Http::Code start(Http::ResponseHeaderMap& response_headers) override;
+
+  // Streams up to chunk_size_ bytes of additional output into response,
+  // emitting whole metric families. Between chunks we retain only the group
+  // index: refcounted metric pointers bucketed by tag-extracted StatName, in
+  // stable symbol-table order. The rendered text for a family is produced
+  // just-in-time, so memory stays proportional to the number of metric
+  // families rather than the serialized response size, and the admin
+  // framework's flow control paces the chunks out to slow scrapers.
+  bool nextChunk(Buffer::Instance& response) override;
+
+  // Sets the chunk size.
+  void setChunkSize(uint64_t chunk_size) { chunk_size_ = chunk_size; }
+
+private:
+  // Metrics of the current phase's type grouped by their tag-extracted name.
+  // The StatName keys are backed by the metrics held in the group vectors, so
+  // groups must be kept alive until they are rendered and erased.
+  using Group = std::vector<Stats::RefcountPtr<Stats::Metric>>;
+  using GroupMap = std::map<Stats::StatName, Group, Stats::StatNameLessThan>;
+
+  // Populates groups_ with the metrics for the current phase.
+  void startPhase();
+
+  // Advances to the next phase and populates its groups. @return false when
+  // all phases have completed.
+  bool advancePhase();
+
+  // Populates all metrics of the templatized type into groups_.
+  template <class StatType> void populateGroupsFromStore();
+
+  // Renders one whole metric family: a TYPE line followed by each metric,
+  // sorted by full stat name for stable output across scrapes.
+  template <class StatType>
+  void renderGroup(Buffer::Instance& response, Group& group,
+                   const std::string& prefixed_tag_extracted_name, absl::string_view type,
+                   const std::function<std::string(const StatType&, const std::string&)>&
+                       generate_output) const;
+
+  StatsParams params_;
+  Stats::Store& stats_;
+  const Stats::CustomStatNamespaces& custom_namespaces_;
+  Phase phase_{Phase::Counters};
+  GroupMap groups_;
+  uint64_t chunk_size_{DefaultChunkSize};
+};
+
+} // namespace Server
+} // namespace Envoy
@@ -54,6 +54,29 @@ Http::Code ServerInfoHandler::handlerMemory(Http::ResponseHeaderMap& response_he
   return Http::Code::OK;
 }
 
+Http::Code ServerInfoHandler::handlerMemoryDetail(Http::ResponseHeaderMap&,
+                                                  Buffer::Instance& response, AdminStream&) {
+  const std::string detail = Memory::Stats::detailedStats();
+  if (detail.empty()) {
+    response.add("detailed memory stats are only available when Envoy is built with tcmalloc\n");
+    return Http::Code::NotImplemented;
+  }
+
+  // Summarize fragmentation up front: bytes backed by physical memory that hold no live
+  // allocations (page heap free spans, caches, metadata and per-size-class slack). A ratio
+  // that grows while /memory's "allocated" stays flat points at fragmentation rather than a
+  // leak. The per-size-class and page heap breakdown below attributes the slack.
+  const uint64_t allocated = Memory::Stats::totalCurrentlyAllocated();
+  const uint64_t physical = Memory::Stats::totalPhysicalBytes();
+  if (physical > allocated && physical > 0) {
+    response.add(fmt::format("fragmentation_ratio: {:.4f} (unused bytes: {})\n\n",
+                             static_cast<double>(physical - allocated) / physical,
+                             physical - allocated));
+  }
+  response.add(detail);
+  return Http::Code::OK;
+}
+
 Http::Code ServerInfoHandler::handlerReady(Http::ResponseHeaderMap&, Buffer::Instance& response,
                                            AdminStream&) {
   const envoy::admin::v3::ServerInfo::State state =
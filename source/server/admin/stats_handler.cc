@@ -11,6 +11,7 @@
 #include "source/common/http/headers.h"
 #include "source/common/http/utility.h"
 #include "source/server/admin/prometheus_stats.h"
+#include "source/server/admin/prometheus_stats_request.h"
 #include "source/server/admin/stats_request.h"
 
 #include "absl/strings/numbers.h"
@@ -80,16 +81,11 @@ Admin::RequestPtr StatsHandler::makeRequest(AdminStream& admin_stream) {
   }
 
   if (params.format_ == StatsFormat::Prometheus) {
-    // TODO(#16139): modify streaming algorithm to cover Prometheus.
-    //
-    // This may be easiest to accomplish by populating the set
-    // with tagExtractedName(), and allowing for vectors of
-    // stats as multiples will have the same tag-extracted names.
-    // Ideally we'd find a way to do this without slowing down
-    // the non-Prometheus implementations.
-    Buffer::OwnedImpl response;
-    prometheusFlushAndRender(params, response);
-    return Admin::makeStaticTextRequest(response, code);
+    if (server_.statsConfig().flushOnAdmin()) {
+      server_.flushStats();
+    }
+    return std::make_unique<PrometheusStatsRequest>(server_.stats(), params,
+                                                    server_.api().customStatNamespaces());
   }
 
   if (server_.statsConfig().flushOnAdmin()) {
@@ -118,6 +114,37 @@ Http::Code StatsHandler::handlerPrometheusStats(Http::ResponseHeaderMap&,
   return prometheusStats(admin_stream.getRequestHeaders().getPathValue(), response);
 }
 
+Admin::RequestPtr StatsHandler::makePrometheusRequest(AdminStream& admin_stream) {
+  StatsParams params;
+  Buffer::OwnedImpl response;
+  Http::Code code = params.parse(admin_stream.getRequestHeaders().getPathValue(), response);
+  if (code != Http::Code::OK) {
+    return Admin::makeStaticTextRequest(response, code);
+  }
+  if (server_.statsConfig().flushOnAdmin()) {
+    server_.flushStats();
+  }
+  return std::make_unique<PrometheusStatsRequest>(server_.stats(), params,
+                                                  server_.api().customStatNamespaces());
+}
+
+Admin::UrlHandler StatsHandler::prometheusStatsHandler() {
+  return {"/stats/prometheus",
+          "print server stats in prometheus format",
+          [this](AdminStream& admin_stream) -> Admin::RequestPtr {
+            return makePrometheusRequest(admin_stream);
+          },
+          false,
+          false,
+          {{Admin::ParamDescriptor::Type::Boolean, "usedonly",
+            "Only include stats that have been written by system since restart"},
+           {Admin::ParamDescriptor::Type::Boolean, "text_readouts",
+            "Render text_readouts as new gaugues with value 0 (increases Prometheus "
+            "data size)"},
+           {Admin::ParamDescriptor::Type::String, "filter",
+            "Regular expression (Google re2) for filtering stats"}}};
+}
+
 Http::Code StatsHandler::prometheusStats(absl::string_view path_and_query,
                                          Buffer::Instance& response) {
   StatsParams params;
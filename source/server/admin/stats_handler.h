@@ -86,6 +86,14 @@ public:
    */
   Admin::UrlHandler statsHandler(bool active_mode);
 
+  /**
+   * URL handler for /stats/prometheus, which streams the scrape out in chunks
+   * via PrometheusStatsRequest rather than buffering the whole response.
+   */
+  Admin::UrlHandler prometheusStatsHandler();
+
+  Admin::RequestPtr makePrometheusRequest(AdminStream& admin_stream);
+
   static Admin::RequestPtr makeRequest(Stats::Store& stats, const StatsParams& params,
                                        StatsRequest::UrlHandlerFn url_handler_fn = nullptr);
   Admin::RequestPtr makeRequest(AdminStream&);
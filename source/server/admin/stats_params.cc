@@ -1,8 +1,44 @@
 #include "source/server/admin/stats_params.h"
 
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+
 namespace Envoy {
 namespace Server {
 
+namespace {
+
+// Extracts from a filter regex the literal prefix that any matching stat name
+// must start with, returning the empty string if the regex does not constrain
+// the start of the name. The scan is conservative: it requires a "^" anchor,
+// gives up entirely if the regex contains an alternation (in "^foo|bar" the
+// anchored prefix is not required for a match), and stops at the first
+// non-literal character, discarding the preceding character if it is subject
+// to a quantifier that can make it optional.
+std::string extractFilterPrefix(absl::string_view regex) {
+  if (!absl::StartsWith(regex, "^") || regex.find('|') != absl::string_view::npos) {
+    return "";
+  }
+  std::string prefix;
+  for (size_t i = 1; i < regex.size(); ++i) {
+    const char c = regex[i];
+    if (absl::ascii_isalnum(c) || c == '_' || c == '-') {
+      prefix.push_back(c);
+    } else if (c == '\\' && i + 1 < regex.size() && regex[i + 1] == '.') {
+      prefix.push_back('.');
+      ++i;
+    } else {
+      if ((c == '?' || c == '*' || c == '{') && !prefix.empty()) {
+        prefix.pop_back();
+      }
+      break;
+    }
+  }
+  return prefix;
+}
+
+} // namespace
+
 Http::Code StatsParams::parse(absl::string_view url, Buffer::Instance& response) {
   query_ = Http::Utility::parseAndDecodeQueryString(url);
   used_only_ = query_.find("usedonly") != query_.end();
@@ -19,6 +55,7 @@ Http::Code StatsParams::parse(absl::string_view url, Buffer::Instance& response)
       response.add("Invalid re2 regex");
       return Http::Code::BadRequest;
     }
+    filter_prefix_ = extractFilterPrefix(filter_string_);
   }
 
   absl::Status status = Utility::histogramBucketsParam(query_, histogram_buckets_mode_);
@@ -68,6 +68,13 @@ struct StatsParams {
   HiddenFlag hidden_{HiddenFlag::Exclude};
   std::string filter_string_;
   std::shared_ptr<re2::RE2> re2_filter_;
+
+  // A literal prefix derived from a "^"-anchored filter regex, or empty if
+  // the filter does not constrain the start of the stat name. Stat names in a
+  // scope all share the scope's name as a prefix, so this lets the stats
+  // endpoints skip entire scopes that cannot contain a match rather than
+  // running the regex over every stat in the store.
+  std::string filter_prefix_;
   Utility::HistogramBucketsMode histogram_buckets_mode_{Utility::HistogramBucketsMode::NoBuckets};
   Http::Utility::QueryParams query_;
 };
@@ -4,9 +4,29 @@
 #include "source/server/admin/stats_html_render.h"
 #endif
 
+#include "absl/strings/match.h"
+
 namespace Envoy {
 namespace Server {
 
+namespace {
+
+// Stat names in a named scope all begin with the scope's name followed by a
+// dot, so when the filter has a literal prefix the scope can only contribute
+// matches if that prefix and the scope name agree over their common length.
+bool scopeCanMatchPrefix(absl::string_view scope_name, absl::string_view filter_prefix) {
+  if (scope_name.empty()) {
+    // The default scope can hold stats with arbitrary names.
+    return true;
+  }
+  if (scope_name.size() >= filter_prefix.size()) {
+    return absl::StartsWith(scope_name, filter_prefix);
+  }
+  return absl::StartsWith(filter_prefix, scope_name) && filter_prefix[scope_name.size()] == '.';
+}
+
+} // namespace
+
 StatsRequest::StatsRequest(Stats::Store& stats, const StatsParams& params,
                            UrlHandlerFn url_handler_fn)
     : params_(params), stats_(stats), url_handler_fn_(url_handler_fn) {
@@ -150,7 +170,16 @@ void StatsRequest::startPhase() {
   // through the map we'll erase the scopes and replace them with the stats held
   // in the scopes.
   for (const Stats::ConstScopeSharedPtr& scope : scopes_) {
-    StatOrScopes& variant = stat_map_[stats_.symbolTable().toString(scope->prefix())];
+    std::string prefix_str = stats_.symbolTable().toString(scope->prefix());
+
+    // When the filter pins down a literal prefix, scopes that cannot contain
+    // a matching stat are skipped entirely, so prefix-style filters do not
+    // have to scan the whole store.
+    if (!params_.filter_prefix_.empty() &&
+        !scopeCanMatchPrefix(prefix_str, params_.filter_prefix_)) {
+      continue;
+    }
+    StatOrScopes& variant = stat_map_[std::move(prefix_str)];
     if (variant.index() == absl::variant_npos) {
       variant = ScopeVec();
     }
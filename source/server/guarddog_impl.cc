@@ -194,7 +194,13 @@ WatchDogSharedPtr GuardDogImpl::createWatchDog(Thread::ThreadId thread_id,
   // accessed out of the locked section below is const (time_source_ has no
   // state).
   const auto wd_interval = loop_interval_ / 2;
-  auto new_watchdog = std::make_shared<WatchDogImpl>(std::move(thread_id));
+  Stats::Histogram& loop_latency_histogram = stats_scope_.histogramFromStatName(
+      Stats::StatNameManagedStorage(fmt::format("server.{}.loop_latency_us", thread_name),
+                                    stats_scope_.symbolTable())
+          .statName(),
+      Stats::Histogram::Unit::Microseconds);
+  auto new_watchdog =
+      std::make_shared<WatchDogImpl>(std::move(thread_id), time_source_, loop_latency_histogram);
   WatchedDogPtr watched_dog = std::make_unique<WatchedDog>(stats_scope_, thread_name, new_watchdog);
   new_watchdog->touch();
   {
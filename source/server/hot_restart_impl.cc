@@ -137,13 +137,19 @@ void HotRestartImpl::sendParentTerminateRequest() { as_child_.sendParentTerminat
 
 HotRestart::ServerStatsFromParent
 HotRestartImpl::mergeParentStatsIfAny(Stats::StoreRoot& stats_store) {
-  std::unique_ptr<envoy::HotRestartMessage> wrapper_msg = as_child_.getParentStats();
   ServerStatsFromParent response;
-  // getParentStats() will happily and cleanly return nullptr if we have no parent.
-  if (wrapper_msg) {
+  // getParentStats() will happily and cleanly return nullptr if we have no parent. The parent may
+  // split one export cycle over several replies; each stat is in exactly one of them, and the
+  // reply without more_chunks_remain is the last (a pre-chunking parent sends exactly one such
+  // reply).
+  std::unique_ptr<envoy::HotRestartMessage> wrapper_msg;
+  while ((wrapper_msg = as_child_.getParentStats()) != nullptr) {
     as_child_.mergeParentStats(stats_store, wrapper_msg->reply().stats());
     response.parent_memory_allocated_ = wrapper_msg->reply().stats().memory_allocated();
     response.parent_connections_ = wrapper_msg->reply().stats().num_connections();
+    if (!wrapper_msg->reply().stats().more_chunks_remain()) {
+      break;
+    }
   }
   return response;
 }
@@ -126,7 +126,9 @@ std::unique_ptr<HotRestartMessage> HotRestartingChild::getParentStats() {
   }
 
   HotRestartMessage wrapped_request;
-  wrapped_request.mutable_request()->mutable_stats();
+  // Tell the parent it may split its export over several replies; a parent that predates
+  // chunking ignores this and sends one complete reply, which looks like a one-chunk export.
+  wrapped_request.mutable_request()->mutable_stats()->set_allow_chunking(true);
   main_rpc_stream_.sendHotRestartMessage(parent_address_, wrapped_request);
 
   std::unique_ptr<HotRestartMessage> wrapped_reply =
@@ -13,6 +13,13 @@ namespace Server {
 
 using HotRestartMessage = envoy::HotRestartMessage;
 
+namespace {
+// Target upper bound on the serialized size of one chunk of a chunked stat export. Keeping each
+// reply small bounds how long a single blocking send to the child can stall the parent's event
+// loop, so that forwarded QUIC packets and drain progress can interleave with the stat transfer.
+constexpr uint64_t MaxStatsChunkSize = 100 * 1024;
+} // namespace
+
 HotRestartingParent::HotRestartingParent(int base_id, int restart_epoch,
                                          const std::string& socket_path, mode_t socket_mode)
     : HotRestartingBase(base_id), restart_epoch_(restart_epoch) {
@@ -84,7 +91,8 @@ void HotRestartingParent::onSocketEvent() {
 
     case HotRestartMessage::Request::kStats: {
       HotRestartMessage wrapped_reply;
-      internal_->exportStatsToChild(wrapped_reply.mutable_reply()->mutable_stats());
+      internal_->exportStatsToChild(wrapped_request->request().stats(),
+                                    wrapped_reply.mutable_reply()->mutable_stats());
       main_rpc_stream_.sendHotRestartMessage(child_address_, wrapped_reply);
       break;
     }
@@ -162,10 +170,78 @@ HotRestartingParent::Internal::getListenSocketsForChild(const HotRestartMessage:
   return wrapped_reply;
 }
 
+void HotRestartingParent::Internal::exportStatsToChild(
+    const HotRestartMessage::Request::Stats& request, HotRestartMessage::Reply::Stats* stats) {
+  if (!request.allow_chunking()) {
+    // The child predates chunked stat export (or declined it); send the whole store at once.
+    exportStatsToChild(stats);
+    return;
+  }
+  if (pending_stats_chunks_.empty()) {
+    buildStatsChunks();
+  }
+  *stats = std::move(pending_stats_chunks_.front());
+  pending_stats_chunks_.pop_front();
+  stats->set_more_chunks_remain(!pending_stats_chunks_.empty());
+}
+
+// All chunks of an export cycle are built eagerly, so that counters are latched exactly once per
+// cycle and the gauge values form a single point-in-time snapshot; only the transfer to the child
+// is spread over multiple request/reply exchanges.
+void HotRestartingParent::Internal::buildStatsChunks() {
+  pending_stats_chunks_.emplace_back();
+  uint64_t chunk_size = 0;
+  // The size estimate only needs to be good enough to keep chunks near the target size: each map
+  // entry costs roughly its key, a varint value, and a few bytes of framing; dynamics entries
+  // (when present) repeat the key with a small span payload.
+  auto chunk_for = [this, &chunk_size](const std::string& name) {
+    const uint64_t entry_size = name.size() + 16;
+    chunk_size += entry_size;
+    if (chunk_size > MaxStatsChunkSize) {
+      pending_stats_chunks_.emplace_back();
+      chunk_size = entry_size;
+    }
+    return &pending_stats_chunks_.back();
+  };
+
+  server_->stats().forEachSinkedGauge(nullptr, [this, &chunk_for](Stats::Gauge& gauge) {
+    if (gauge.used()) {
+      const std::string name = gauge.name();
+      HotRestartMessage::Reply::Stats* chunk = chunk_for(name);
+      (*chunk->mutable_gauges())[name] = gauge.value();
+      recordDynamics(chunk, name, gauge.statName());
+    }
+  });
+
+  server_->stats().forEachSinkedCounter(nullptr, [this, &chunk_for](Stats::Counter& counter) {
+    if (counter.used()) {
+      // The hot restart parent is expected to have stopped its normal stat exporting (and so
+      // latching) by the time it begins exporting to the hot restart child.
+      uint64_t latched_value = counter.latch();
+      if (latched_value > 0) {
+        const std::string name = counter.name();
+        HotRestartMessage::Reply::Stats* chunk = chunk_for(name);
+        (*chunk->mutable_counter_deltas())[name] = latched_value;
+        recordDynamics(chunk, name, counter.statName());
+      }
+    }
+  });
+
+  // These snapshot values are repeated on every chunk so the child can take them from whichever
+  // reply it processed last.
+  const uint64_t memory_allocated = Memory::Stats::totalCurrentlyAllocated();
+  const uint64_t num_connections = server_->listenerManager().numConnections();
+  for (HotRestartMessage::Reply::Stats& chunk : pending_stats_chunks_) {
+    chunk.set_memory_allocated(memory_allocated);
+    chunk.set_num_connections(num_connections);
+  }
+}
+
 // TODO(fredlas) if there are enough stats for stat name length to become an issue, this current
 // implementation can negate the benefit of symbolized stat names by periodically reaching the
 // magnitude of memory usage that they are meant to avoid, since this map holds full-string
-// names. The problem can be solved by splitting the export up over many chunks.
+// names. The chunked export above bounds the message sizes, but the chunks are built eagerly, so
+// the parent still briefly holds all of the full-string names at once.
 void HotRestartingParent::Internal::exportStatsToChild(HotRestartMessage::Reply::Stats* stats) {
   server_->stats().forEachSinkedGauge(nullptr, [this, stats](Stats::Gauge& gauge) mutable {
     if (gauge.used()) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+
 #include "source/common/common/hash.h"
 #include "source/server/hot_restarting_base.h"
 
@@ -35,6 +37,10 @@ public:
     // Return value is the response to return to the child.
     envoy::HotRestartMessage
     getListenSocketsForChild(const envoy::HotRestartMessage::Request& request);
+    // Entry point for a stats request from the child. Serves the next chunk of a chunked export
+    // when the child allows chunking, and otherwise delegates to the single-message export below.
+    void exportStatsToChild(const envoy::HotRestartMessage::Request::Stats& request,
+                            envoy::HotRestartMessage::Reply::Stats* stats);
     // 'stats' is a field in the reply protobuf to be sent to the child, which we should populate.
     void exportStatsToChild(envoy::HotRestartMessage::Reply::Stats* stats);
     void recordDynamics(envoy::HotRestartMessage::Reply::Stats* stats, const std::string& name,
@@ -45,8 +51,13 @@ public:
     void handle(uint32_t worker_index, const Network::UdpRecvData& packet) override;
 
   private:
+    void buildStatsChunks();
+
     Server::Instance* const server_{};
     HotRestartMessageSender& udp_sender_;
+    // Chunks of one export cycle, built when a chunking-aware child sends a stats request and no
+    // chunks are pending, then served in order, one per stats request.
+    std::deque<envoy::HotRestartMessage::Reply::Stats> pending_stats_chunks_;
   };
 
 private:
@@ -97,7 +97,8 @@ InstanceImpl::InstanceImpl(
       access_log_manager_(options.fileFlushIntervalMsec(), *api_, *dispatcher_, access_log_lock,
                           store),
       singleton_manager_(new Singleton::ManagerImpl(api_->threadFactory())),
-      handler_(getHandler(*dispatcher_)), worker_factory_(thread_local_, *api_, hooks),
+      handler_(getHandler(*dispatcher_)),
+      worker_factory_(thread_local_, *api_, hooks, bootstrap_),
       mutex_tracer_(options.mutexTracingEnabled() ? &Envoy::MutexTracerImpl::getOrCreateTracer()
                                                   : nullptr),
       grpc_context_(store.symbolTable()), http_context_(store.symbolTable()),
@@ -205,6 +206,9 @@ MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_sou
       [this](Stats::Counter& counter) {
         snapped_counters_.push_back(Stats::CounterSharedPtr(&counter));
         counters_.push_back({counter.latch(), counter});
+        if (counters_.back().delta_ != 0) {
+          changed_counters_.push_back(counters_.back());
+        }
       });
 
   store.forEachSinkedGauge(
@@ -215,6 +219,9 @@ MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_sou
       [this](Stats::Gauge& gauge) {
         snapped_gauges_.push_back(Stats::GaugeSharedPtr(&gauge));
         gauges_.push_back(gauge);
+        if (gauge.latchChanged()) {
+          changed_gauges_.push_back(gauge);
+        }
       });
 
   store.forEachSinkedHistogram(
@@ -418,9 +425,11 @@ void InstanceImpl::initialize(Network::Address::InstanceConstSharedPtr local_add
   }
 
   // Handle configuration that needs to take place prior to the main configuration load.
+  const MonotonicTime bootstrap_load_start_time = time_source_.monotonicTime();
   InstanceUtil::loadBootstrapConfig(bootstrap_, options_,
                                     messageValidationContext().staticValidationVisitor(), *api_);
   bootstrap_config_update_time_ = time_source_.systemTime();
+  const MonotonicTime bootstrap_load_end_time = time_source_.monotonicTime();
 
   if (bootstrap_.has_application_log_config()) {
     THROW_IF_NOT_OK(
@@ -505,6 +514,10 @@ void InstanceImpl::initialize(Network::Address::InstanceConstSharedPtr local_add
 
   initialization_timer_ = std::make_unique<Stats::HistogramCompletableTimespanImpl>(
       server_stats_->initialization_time_ms_, timeSource());
+  // The bootstrap load happened before the stats store was configured, so its phase is recorded
+  // retroactively now that the gauge exists.
+  recordStartupPhase(server_stats_->startup_bootstrap_load_time_ms_, "bootstrap config load",
+                     bootstrap_load_start_time, bootstrap_load_end_time);
   server_stats_->concurrency_.set(options_.concurrency());
   server_stats_->hot_restart_epoch_.set(options_.restartEpoch());
   InstanceImpl::failHealthcheck(false);
@@ -720,6 +733,11 @@ void InstanceImpl::initialize(Network::Address::InstanceConstSharedPtr local_add
   // thread local data per above. See MainImpl::initialize() for why ConfigImpl
   // is constructed as part of the InstanceImpl and then populated once
   // cluster_manager_factory_ is available.
+  // Primary cluster initialization begins inside config_.initialize() and may complete
+  // synchronously (all-static configurations), so the phase boundary is recorded before the call.
+  startup_phase_start_time_ = time_source_.monotonicTime();
+  recordStartupPhase(server_stats_->startup_server_init_time_ms_, "main thread initialization",
+                     bootstrap_load_end_time, startup_phase_start_time_);
   config_.initialize(bootstrap_, *this, *cluster_manager_factory_);
 
   // Instruct the listener manager to create the LDS provider if needed. This must be done later
@@ -768,11 +786,19 @@ void InstanceImpl::initialize(Network::Address::InstanceConstSharedPtr local_add
 }
 
 void InstanceImpl::onClusterManagerPrimaryInitializationComplete() {
+  const MonotonicTime now = time_source_.monotonicTime();
+  recordStartupPhase(server_stats_->startup_primary_clusters_init_time_ms_,
+                     "primary cluster initialization", startup_phase_start_time_, now);
+  startup_phase_start_time_ = now;
   // If RTDS was not configured the `onRuntimeReady` callback is immediately invoked.
   runtime().startRtdsSubscriptions([this]() { onRuntimeReady(); });
 }
 
 void InstanceImpl::onRuntimeReady() {
+  const MonotonicTime runtime_ready_time = time_source_.monotonicTime();
+  recordStartupPhase(server_stats_->startup_rtds_init_time_ms_, "RTDS initialization",
+                     startup_phase_start_time_, runtime_ready_time);
+
   // Begin initializing secondary clusters after RTDS configuration has been applied.
   // Initializing can throw exceptions, so catch these.
   TRY_ASSERT_MAIN_THREAD { clusterManager().initializeSecondaryClusters(bootstrap_); }
@@ -781,11 +807,16 @@ void InstanceImpl::onRuntimeReady() {
     ENVOY_LOG(warn, "Skipping initialization of secondary cluster: {}", e.what());
     shutdown();
   });
+  startup_phase_start_time_ = time_source_.monotonicTime();
+  recordStartupPhase(server_stats_->startup_secondary_clusters_init_time_ms_,
+                     "secondary cluster initialization", runtime_ready_time,
+                     startup_phase_start_time_);
 
   if (bootstrap_.has_hds_config()) {
     const auto& hds_config = bootstrap_.hds_config();
     async_client_manager_ = std::make_unique<Grpc::AsyncClientManagerImpl>(
-        *config_.clusterManager(), thread_local_, time_source_, *api_, grpc_context_.statNames());
+        *config_.clusterManager(), thread_local_, time_source_, *api_, grpc_context_.statNames(),
+        PROTOBUF_GET_WRAPPED_OR_DEFAULT(bootstrap_, google_grpc_completion_queue_count, 1));
     TRY_ASSERT_MAIN_THREAD {
       THROW_IF_NOT_OK(Config::Utility::checkTransportVersion(hds_config));
       hds_delegate_ = std::make_unique<Upstream::HdsDelegate>(
@@ -812,13 +843,29 @@ void InstanceImpl::onRuntimeReady() {
   }
 }
 
+void InstanceImpl::recordStartupPhase(Stats::Gauge& gauge, absl::string_view phase,
+                                      MonotonicTime start, MonotonicTime end) {
+  const uint64_t duration_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+  gauge.set(duration_ms);
+  ENVOY_LOG(info, "startup phase '{}' took {}ms", phase, duration_ms);
+}
+
 void InstanceImpl::startWorkers() {
+  const MonotonicTime now = time_source_.monotonicTime();
+  // This phase covers everything between secondary cluster initialization kicking off and all
+  // dynamic configuration (EDS, LDS/RDS, SDS, listener warming) becoming ready.
+  recordStartupPhase(server_stats_->startup_dynamic_config_init_time_ms_,
+                     "dynamic configuration initialization", startup_phase_start_time_, now);
+  startup_phase_start_time_ = now;
   // The callback will be called after workers are started.
   listener_manager_->startWorkers(*worker_guard_dog_, [this]() {
     if (isShutdown()) {
       return;
     }
 
+    recordStartupPhase(server_stats_->startup_workers_start_time_ms_, "worker startup",
+                       startup_phase_start_time_, time_source_.monotonicTime());
     initialization_timer_->complete();
     // Update server stats as soon as initialization is done.
     updateServerStats();
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 
+#include "envoy/common/time.h"
 #include "envoy/server/watchdog.h"
+#include "envoy/stats/histogram.h"
 
 namespace Envoy {
 namespace Server {
@@ -15,8 +18,15 @@ class WatchDogImpl : public WatchDog {
 public:
   /**
    * @param thread_id ThreadId of the monitored thread
+   * @param time_source time source used to time the interval between touches.
+   * @param loop_latency_histogram histogram that the time between successive touches (an
+   *        approximation of the monitored thread's event loop latency) is recorded into, in
+   *        microseconds.
    */
-  WatchDogImpl(Thread::ThreadId thread_id) : thread_id_(thread_id) {}
+  WatchDogImpl(Thread::ThreadId thread_id, TimeSource& time_source,
+               Stats::Histogram& loop_latency_histogram)
+      : thread_id_(thread_id), time_source_(time_source),
+        loop_latency_histogram_(loop_latency_histogram) {}
 
   Thread::ThreadId threadId() const override { return thread_id_; }
   // Used by GuardDogImpl determine if the watchdog was touched recently and reset the touch status.
@@ -24,6 +34,17 @@ public:
 
   // Server::WatchDog
   void touch() override {
+    // Record the time since the previous touch as a continuous loop latency signal, in addition to
+    // the boolean miss detection below. Histograms record into thread-local storage and the last
+    // touch time is a relaxed atomic, so this is cheap enough for the touch fast path.
+    const int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                               time_source_.monotonicTime().time_since_epoch())
+                               .count();
+    const int64_t last_touch_us = last_touch_time_us_.exchange(now_us, std::memory_order_relaxed);
+    if (last_touch_us != 0) {
+      loop_latency_histogram_.recordValue(now_us - last_touch_us);
+    }
+
     // Set touched_ if not already set.
     bool expected = false;
     touched_.compare_exchange_strong(expected, true, std::memory_order_relaxed);
@@ -31,6 +52,9 @@ public:
 
 private:
   const Thread::ThreadId thread_id_;
+  TimeSource& time_source_;
+  Stats::Histogram& loop_latency_histogram_;
+  std::atomic<int64_t> last_touch_time_us_{0};
   std::atomic<bool> touched_{false};
 };
 
@@ -1,7 +1,9 @@
 #include "source/server/worker_impl.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <thread>
 
 #include "envoy/event/dispatcher.h"
 #include "envoy/event/timer.h"
@@ -9,7 +11,9 @@
 #include "envoy/server/configuration.h"
 #include "envoy/thread_local/thread_local.h"
 
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/config/utility.h"
+#include "source/common/protobuf/utility.h"
 #include "source/server/listener_manager_factory.h"
 
 namespace Envoy {
@@ -34,18 +38,28 @@ WorkerPtr ProdWorkerFactory::createWorker(uint32_t index, OverloadManager& overl
                                           const std::string& worker_name) {
   Event::DispatcherPtr dispatcher(
       api_.allocateDispatcher(worker_name, overload_manager.scaledTimerFactory()));
+  if (bootstrap_.has_worker_busy_poll_duration()) {
+    dispatcher->enableBusyPolling(std::chrono::microseconds(
+        DurationUtil::durationToMicroseconds(bootstrap_.worker_busy_poll_duration())));
+  }
   auto conn_handler = getHandler(*dispatcher, index, overload_manager);
+  absl::optional<uint32_t> cpu_affinity;
+  if (bootstrap_.pin_worker_threads()) {
+    cpu_affinity = index % std::max(1u, std::thread::hardware_concurrency());
+  }
   return std::make_unique<WorkerImpl>(tls_, hooks_, std::move(dispatcher), std::move(conn_handler),
-                                      overload_manager, api_, stat_names_);
+                                      overload_manager, api_, stat_names_, cpu_affinity);
 }
 
 WorkerImpl::WorkerImpl(ThreadLocal::Instance& tls, ListenerHooks& hooks,
                        Event::DispatcherPtr&& dispatcher, Network::ConnectionHandlerPtr handler,
                        OverloadManager& overload_manager, Api::Api& api,
-                       WorkerStatNames& stat_names)
+                       WorkerStatNames& stat_names, absl::optional<uint32_t> cpu_affinity)
     : tls_(tls), hooks_(hooks), dispatcher_(std::move(dispatcher)), handler_(std::move(handler)),
-      api_(api), reset_streams_counter_(
-                     api_.rootScope().counterFromStatName(stat_names.reset_high_memory_stream_)) {
+      api_(api),
+      reset_streams_counter_(
+          api_.rootScope().counterFromStatName(stat_names.reset_high_memory_stream_)),
+      cpu_affinity_(cpu_affinity) {
   tls_.registerThread(*dispatcher_, false);
   overload_manager.registerForAction(
       OverloadActionNames::get().StopAcceptingConnections, *dispatcher_,
@@ -56,6 +70,9 @@ WorkerImpl::WorkerImpl(ThreadLocal::Instance& tls, ListenerHooks& hooks,
   overload_manager.registerForAction(
       OverloadActionNames::get().ResetStreams, *dispatcher_,
       [this](OverloadActionState state) { resetStreamsUsingExcessiveMemory(state); });
+  overload_manager.registerForAction(
+      OverloadActionNames::get().ShrinkConnectionBuffers, *dispatcher_,
+      [this](OverloadActionState state) { shrinkConnectionBuffersCb(state); });
 }
 
 void WorkerImpl::addListener(absl::optional<uint64_t> overridden_listener,
@@ -111,6 +128,7 @@ void WorkerImpl::start(GuardDog& guard_dog, const std::function<void()>& cb) {
   // TODO(jmarantz): consider refactoring how this naming works so this naming
   // architecture is centralized, resulting in clearer names.
   Thread::Options options{absl::StrCat("wrk:", dispatcher_->name())};
+  options.cpu_affinity_ = cpu_affinity_;
   thread_ = api_.threadFactory().createThread(
       [this, &guard_dog, cb]() -> void { threadRoutine(guard_dog, cb); }, options);
 }
@@ -178,5 +196,14 @@ void WorkerImpl::resetStreamsUsingExcessiveMemory(OverloadActionState state) {
   reset_streams_counter_.add(streams_reset_count);
 }
 
+void WorkerImpl::shrinkConnectionBuffersCb(OverloadActionState state) {
+  // The callback runs on this worker's dispatcher thread, so this is the worker's own cache.
+  // Scale the cache cap down with pressure; at saturation the cache is fully drained and every
+  // slice released by an idle connection goes straight back to the allocator.
+  const float available = 1.0f - state.value().value();
+  Buffer::ThreadLocalSliceCache::instance().setMaxBytes(
+      static_cast<uint64_t>(Buffer::ThreadLocalSliceCache::DefaultMaxBytes * available));
+}
+
 } // namespace Server
 } // namespace Envoy
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "envoy/api/api.h"
+#include "envoy/config/bootstrap/v3/bootstrap.pb.h"
 #include "envoy/network/connection_handler.h"
 #include "envoy/server/guarddog.h"
 #include "envoy/server/listener_manager.h"
@@ -28,8 +29,10 @@ struct WorkerStatNames {
 
 class ProdWorkerFactory : public WorkerFactory, Logger::Loggable<Logger::Id::main> {
 public:
-  ProdWorkerFactory(ThreadLocal::Instance& tls, Api::Api& api, ListenerHooks& hooks)
-      : tls_(tls), api_(api), stat_names_(api.rootScope().symbolTable()), hooks_(hooks) {}
+  ProdWorkerFactory(ThreadLocal::Instance& tls, Api::Api& api, ListenerHooks& hooks,
+                    const envoy::config::bootstrap::v3::Bootstrap& bootstrap)
+      : tls_(tls), api_(api), stat_names_(api.rootScope().symbolTable()), hooks_(hooks),
+        bootstrap_(bootstrap) {}
 
   // Server::WorkerFactory
   WorkerPtr createWorker(uint32_t index, OverloadManager& overload_manager,
@@ -40,6 +43,9 @@ private:
   Api::Api& api_;
   WorkerStatNames stat_names_;
   ListenerHooks& hooks_;
+  // The server's bootstrap config. Held by reference because the factory is constructed before
+  // the config is loaded; only read during createWorker(), which runs after.
+  const envoy::config::bootstrap::v3::Bootstrap& bootstrap_;
 };
 
 /**
@@ -49,7 +55,8 @@ class WorkerImpl : public Worker, Logger::Loggable<Logger::Id::main> {
 public:
   WorkerImpl(ThreadLocal::Instance& tls, ListenerHooks& hooks, Event::DispatcherPtr&& dispatcher,
              Network::ConnectionHandlerPtr handler, OverloadManager& overload_manager,
-             Api::Api& api, WorkerStatNames& stat_names);
+             Api::Api& api, WorkerStatNames& stat_names,
+             absl::optional<uint32_t> cpu_affinity = absl::nullopt);
 
   // Server::Worker
   void addListener(absl::optional<uint64_t> overridden_listener, Network::ListenerConfig& listener,
@@ -72,6 +79,7 @@ private:
   void stopAcceptingConnectionsCb(OverloadActionState state);
   void rejectIncomingConnectionsCb(OverloadActionState state);
   void resetStreamsUsingExcessiveMemory(OverloadActionState state);
+  void shrinkConnectionBuffersCb(OverloadActionState state);
 
   ThreadLocal::Instance& tls_;
   ListenerHooks& hooks_;
@@ -79,6 +87,8 @@ private:
   Network::ConnectionHandlerPtr handler_;
   Api::Api& api_;
   Stats::Counter& reset_streams_counter_;
+  // The CPU to pin the worker thread to, if worker pinning is enabled.
+  const absl::optional<uint32_t> cpu_affinity_;
   Thread::ThreadPtr thread_;
   WatchDogSharedPtr watch_dog_;
 };
@@ -826,6 +826,61 @@ TEST_F(OwnedImplTest, ReserveCommitReuse) {
   expectSlices({{8001, 4287, 12288}}, buffer);
 }
 
+// reserveForRead() adapts the size of subsequent reservations to the amount the caller actually
+// commits: mostly-unused reservations shrink the next one and fully-used reservations grow it
+// back, bounded by one default-size slice and the default reservation size.
+TEST_F(OwnedImplTest, ReserveForReadAdaptsToCommittedSize) {
+  constexpr uint64_t default_reservation_size = 8 * 16384;
+  Buffer::OwnedImpl buffer;
+
+  // The first reservation has the full default size.
+  {
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(default_reservation_size, reservation.length());
+    reservation.commit(10);
+  }
+  buffer.drain(buffer.length());
+
+  // Repeated small commits shrink the reservation down to a single slice, but no further.
+  for (int i = 0; i < 10; i++) {
+    auto reservation = buffer.reserveForRead();
+    reservation.commit(10);
+    buffer.drain(buffer.length());
+  }
+  {
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(16384, reservation.length());
+    // A reservation that is discarded without a commit does not change the size.
+  }
+
+  // Single slice reservations do not participate in the adaptation.
+  {
+    auto reservation = buffer.reserveSingleSlice(1000);
+    reservation.commit(1000);
+  }
+  buffer.drain(buffer.length());
+  {
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(16384, reservation.length());
+    // Commits of more than a quarter of the reservation leave the size unchanged.
+    reservation.commit(8192);
+  }
+  buffer.drain(buffer.length());
+
+  // Fully-used reservations double the size of the next one, up to the default size.
+  for (uint64_t expected_size = 16384; expected_size <= default_reservation_size;
+       expected_size *= 2) {
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(expected_size, reservation.length());
+    reservation.commit(reservation.length());
+    buffer.drain(buffer.length());
+  }
+  {
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(default_reservation_size, reservation.length());
+  }
+}
+
 // Test behavior when the size to commit() is larger than the reservation.
 TEST_F(OwnedImplTest, ReserveOverCommit) {
   Buffer::OwnedImpl buffer;
@@ -878,12 +933,14 @@ TEST_F(OwnedImplTest, SliceFreeList) {
   EXPECT_EQ(0, b1.getRawSlices().size());
   {
     auto r = b2.reserveForRead();
-    // slices()[0] is the partially used slice that is already part of this buffer.
-    EXPECT_EQ(slices[2], r.slices()[1].mem_);
+    // slices()[0] is the partially used slice that is already part of this buffer. The next
+    // slice comes from the thread local cache, which most recently received the storage of the
+    // slice that was just drained from b1.
+    EXPECT_EQ(slices[0], r.slices()[1].mem_);
   }
   {
     auto r = b1.reserveForRead();
-    EXPECT_EQ(slices[2], r.slices()[0].mem_);
+    EXPECT_EQ(slices[0], r.slices()[0].mem_);
   }
   {
     // This causes an underflow in the `freelist` on creation, and overflows it on deletion.
@@ -900,6 +957,41 @@ TEST_F(OwnedImplTest, SliceFreeList) {
   }
 }
 
+// Test that draining a default-size slice returns its storage to the thread local slice
+// cache, and that subsequent slice allocations on the same thread reuse that storage.
+TEST_F(OwnedImplTest, ThreadLocalSliceCacheRecycling) {
+  auto& cache = ThreadLocalSliceCache::instance();
+  cache.clearForTest();
+
+  const std::string data(Slice::default_slice_size_, 'x');
+  const void* original_storage;
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.add(data);
+    original_storage = buffer.frontSlice().mem_;
+    buffer.drain(data.size());
+    // The drained slice's storage is now held by the cache.
+    EXPECT_EQ(Slice::default_slice_size_, cache.bytesHeldForTest());
+  }
+
+  Buffer::OwnedImpl buffer;
+  buffer.add(data);
+  EXPECT_EQ(original_storage, buffer.frontSlice().mem_);
+  EXPECT_EQ(0, cache.bytesHeldForTest());
+
+  // Shrinking the cap trims held storage; storage released over the cap is freed rather than
+  // cached.
+  buffer.drain(data.size());
+  EXPECT_EQ(Slice::default_slice_size_, cache.bytesHeldForTest());
+  cache.setMaxBytes(0);
+  EXPECT_EQ(0, cache.bytesHeldForTest());
+  Buffer::OwnedImpl uncached;
+  uncached.add(data);
+  uncached.drain(data.size());
+  EXPECT_EQ(0, cache.bytesHeldForTest());
+  cache.setMaxBytes(64 * Slice::default_slice_size_);
+}
+
 TEST_F(OwnedImplTest, Search) {
   // Populate a buffer with a string split across many small slices, to
   // exercise edge cases in the search implementation.
@@ -6,6 +6,7 @@
 #include "source/common/network/io_socket_handle_impl.h"
 
 #include "test/common/buffer/utility.h"
+#include "test/test_common/simulated_time_system.h"
 
 #include "gtest/gtest.h"
 
@@ -565,6 +566,36 @@ TEST_F(WatermarkBufferTest, AddFragments) {
   EXPECT_EQ(high_watermark_buffer, 1);
 }
 
+TEST_F(WatermarkBufferTest, AdaptiveWatermarks) {
+  Event::SimulatedTimeSystem time_system;
+  buffer_.enableAdaptiveWatermarks(time_system, 10, 1000);
+  EXPECT_EQ(1000, buffer_.highWatermark());
+
+  // A slow consumer draining a trickle of bytes per sample window shrinks the high watermark.
+  for (int i = 0; i < 25; i++) {
+    buffer_.add(TEN_BYTES, 10);
+    buffer_.drain(10);
+    time_system.advanceTimeWait(std::chrono::milliseconds(110));
+  }
+  EXPECT_LT(buffer_.highWatermark(), 1000);
+  EXPECT_GE(buffer_.highWatermark(), 10);
+  const uint32_t slow_watermark = buffer_.highWatermark();
+
+  // A fast consumer grows the high watermark back toward the cap.
+  const std::string big(10000, 'a');
+  for (int i = 0; i < 25; i++) {
+    buffer_.add(big);
+    buffer_.drain(big.size());
+    time_system.advanceTimeWait(std::chrono::milliseconds(110));
+  }
+  EXPECT_GT(buffer_.highWatermark(), slow_watermark);
+  EXPECT_LE(buffer_.highWatermark(), 1000);
+
+  // Tightening the allowed range (as an overload action would) re-clamps immediately.
+  buffer_.setAdaptiveWatermarkRange(10, 50);
+  EXPECT_LE(buffer_.highWatermark(), 50);
+}
+
 } // namespace
 } // namespace Buffer
 } // namespace Envoy
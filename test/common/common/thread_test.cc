@@ -1,3 +1,7 @@
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include <functional>
 
 #include "source/common/common/thread.h"
@@ -246,6 +250,27 @@ TEST_F(ThreadAsyncPtrTest, NameNotSpecifiedWait) {
   thread->join();
 }
 
+#ifdef __linux__
+TEST_F(ThreadAsyncPtrTest, CpuAffinityApplied) {
+  // The affinity is applied by the creating thread after the new thread starts, so the thread
+  // must wait for createThread() to return before reading its own affinity mask.
+  absl::Notification affinity_set;
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  auto thread = thread_factory_.createThread(
+      [&affinity_set, &cpuset]() {
+        affinity_set.WaitForNotification();
+        EXPECT_EQ(0, sched_getaffinity(0, sizeof(cpuset), &cpuset));
+      },
+      Options{"pinned", /*cpu_affinity_=*/0});
+  affinity_set.Notify();
+  thread->join();
+
+  EXPECT_EQ(1, CPU_COUNT(&cpuset));
+  EXPECT_TRUE(CPU_ISSET(0, &cpuset));
+}
+#endif
+
 } // namespace
 } // namespace Thread
 } // namespace Envoy
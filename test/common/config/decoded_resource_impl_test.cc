@@ -150,6 +150,37 @@ TEST(DecodedResourceImplTest, All) {
   }
 }
 
+// Content hash is derived from the wire bytes: stable for identical bytes, different for
+// different bytes, and unset for resources constructed from an already decoded message.
+TEST(DecodedResourceImplTest, ContentHash) {
+  testing::NiceMock<MockOpaqueResourceDecoder> resource_decoder;
+  ON_CALL(resource_decoder, decodeResource(_))
+      .WillByDefault(InvokeWithoutArgs(
+          []() -> ProtobufTypes::MessagePtr { return std::make_unique<ProtobufWkt::Empty>(); }));
+  ON_CALL(resource_decoder, resourceName(_)).WillByDefault(Return("some_name"));
+
+  ProtobufWkt::Any some_opaque_resource;
+  some_opaque_resource.set_type_url("some_type_url");
+  some_opaque_resource.set_value("some_value");
+  const auto decoded_resource =
+      DecodedResourceImpl::fromResource(resource_decoder, some_opaque_resource, "1");
+  ASSERT_TRUE(decoded_resource->contentHash().has_value());
+
+  // The same bytes at a different version hash identically.
+  const auto same_bytes =
+      DecodedResourceImpl::fromResource(resource_decoder, some_opaque_resource, "2");
+  EXPECT_EQ(decoded_resource->contentHash(), same_bytes->contentHash());
+
+  some_opaque_resource.set_value("some_other_value");
+  const auto other_bytes =
+      DecodedResourceImpl::fromResource(resource_decoder, some_opaque_resource, "3");
+  EXPECT_NE(decoded_resource->contentHash(), other_bytes->contentHash());
+
+  DecodedResourceImpl direct_resource(std::make_unique<ProtobufWkt::Empty>(), "real_name", {},
+                                      "1");
+  EXPECT_FALSE(direct_resource.contentHash().has_value());
+}
+
 } // namespace
 } // namespace Config
 } // namespace Envoy
@@ -4,6 +4,7 @@
 #include "source/common/config/opaque_resource_decoder_impl.h"
 #include "source/common/protobuf/message_validator_impl.h"
 
+#include "test/mocks/protobuf/mocks.h"
 #include "test/test_common/utility.h"
 
 #include "gtest/gtest.h"
@@ -68,6 +69,23 @@ TEST_F(OpaqueResourceDecoderImplTest, ValidateIgnored) {
   EXPECT_EQ("fare", resource_decoder_.resourceName(*decoded_resource));
 }
 
+// A resource with identical serialized bytes is only validated on the first decode.
+TEST_F(OpaqueResourceDecoderImplTest, UnchangedResourceSkipsRevalidation) {
+  testing::NiceMock<ProtobufMessage::MockValidationVisitor> validation_visitor;
+  OpaqueResourceDecoderImpl<envoy::config::endpoint::v3::ClusterLoadAssignment> resource_decoder{
+      validation_visitor, "cluster_name"};
+  envoy::config::endpoint::v3::ClusterLoadAssignment strange_resource;
+  strange_resource.set_cluster_name("fare");
+  // Add a field that doesn't exist in the proto definition so that validation is observable.
+  strange_resource.GetReflection()->MutableUnknownFields(&strange_resource)->AddFixed32(1000, 1);
+  ProtobufWkt::Any opaque_resource;
+  opaque_resource.PackFrom(strange_resource);
+  EXPECT_CALL(validation_visitor, onUnknownField(testing::_));
+  EXPECT_THAT(*resource_decoder.decodeResource(opaque_resource), ProtoEq(strange_resource));
+  // The second decode of the same bytes must not trigger validation again.
+  EXPECT_THAT(*resource_decoder.decodeResource(opaque_resource), ProtoEq(strange_resource));
+}
+
 // Happy path.
 TEST_F(OpaqueResourceDecoderImplTest, Success) {
   envoy::config::endpoint::v3::ClusterLoadAssignment cluster_resource;
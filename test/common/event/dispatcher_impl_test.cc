@@ -11,6 +11,7 @@
 #include "source/common/event/deferred_task.h"
 #include "source/common/event/dispatcher_impl.h"
 #include "source/common/event/timer_impl.h"
+#include "source/common/memory/arena.h"
 #include "source/common/network/address_impl.h"
 #include "source/common/stats/isolated_store_impl.h"
 
@@ -283,6 +284,25 @@ TEST(DeferredDeleteTest, DeferredDelete) {
   dispatcher->clearDeferredDeleteList();
 }
 
+TEST(DeferredDeleteTest, DeferredArenaDropsAllObjectsInOneEntry) {
+  InSequence s;
+  Api::ApiPtr api = Api::createApiForTest();
+  DispatcherPtr dispatcher(api->allocateDispatcher("test_thread"));
+
+  // Objects carved from a DeferredArena are reclaimed by a single deletion list entry; the
+  // arena runs their destructors in reverse order of allocation.
+  ReadyWatcher watcher1;
+  ReadyWatcher watcher2;
+  auto arena = std::make_unique<Memory::DeferredArena>();
+  arena->make<TestDeferredDeletable>([&]() -> void { watcher1.ready(); });
+  arena->make<TestDeferredDeletable>([&]() -> void { watcher2.ready(); });
+  dispatcher->deferredDelete(std::move(arena));
+
+  EXPECT_CALL(watcher2, ready());
+  EXPECT_CALL(watcher1, ready());
+  dispatcher->clearDeferredDeleteList();
+}
+
 TEST(DeferredTaskTest, DeferredTask) {
   InSequence s;
   Api::ApiPtr api = Api::createApiForTest();
@@ -390,6 +410,14 @@ TEST_F(DispatcherImplTest, InitializeStats) {
               histogram("test.dispatcher.loop_duration_us", Stats::Histogram::Unit::Microseconds));
   EXPECT_CALL(store_,
               histogram("test.dispatcher.poll_delay_us", Stats::Histogram::Unit::Microseconds));
+  EXPECT_CALL(store_, histogram("test.dispatcher.file_event_duration_us",
+                                Stats::Histogram::Unit::Microseconds));
+  EXPECT_CALL(store_,
+              histogram("test.dispatcher.timer_duration_us", Stats::Histogram::Unit::Microseconds));
+  EXPECT_CALL(store_, histogram("test.dispatcher.post_callbacks_duration_us",
+                                Stats::Histogram::Unit::Microseconds));
+  EXPECT_CALL(store_, histogram("test.dispatcher.deferred_delete_duration_us",
+                                Stats::Histogram::Unit::Microseconds));
   dispatcher_->initializeStats(scope_, "test.");
 }
 
@@ -409,6 +437,60 @@ TEST_F(DispatcherImplTest, Post) {
   }
 }
 
+TEST_F(DispatcherImplTest, PostBatch) {
+  ReadyWatcher watcher1;
+  ReadyWatcher watcher2;
+  {
+    InSequence s;
+    EXPECT_CALL(watcher1, ready());
+    EXPECT_CALL(watcher2, ready());
+  }
+
+  // A batch is linked into the post queue with a single wakeup and runs in order.
+  std::vector<PostCb> batch;
+  batch.push_back([&watcher1]() -> void { watcher1.ready(); });
+  batch.push_back([&watcher2]() -> void { watcher2.ready(); });
+  batch.push_back([this]() -> void {
+    Thread::LockGuard lock(mu_);
+    work_finished_ = true;
+    cv_.notifyOne();
+  });
+  dispatcher_->post(absl::MakeSpan(batch));
+
+  Thread::LockGuard lock(mu_);
+  while (!work_finished_) {
+    cv_.wait(mu_);
+  }
+}
+
+TEST(MpscPostTest, CrossThreadPostStress) {
+  Api::ApiPtr api = Api::createApiForTest();
+  DispatcherPtr dispatcher(api->allocateDispatcher("test_thread"));
+
+  constexpr uint32_t NumProducers = 4;
+  constexpr uint32_t PostsPerProducer = 1000;
+  uint64_t executed = 0; // Only touched on the dispatcher thread.
+  Thread::ThreadPtr dispatcher_thread = api->threadFactory().createThread(
+      [&dispatcher]() { dispatcher->run(Dispatcher::RunType::RunUntilExit); });
+
+  std::vector<Thread::ThreadPtr> producers;
+  for (uint32_t i = 0; i < NumProducers; i++) {
+    producers.push_back(api->threadFactory().createThread([&dispatcher, &executed]() {
+      for (uint32_t j = 0; j < PostsPerProducer; j++) {
+        dispatcher->post([&executed]() { executed++; });
+      }
+    }));
+  }
+  for (Thread::ThreadPtr& producer : producers) {
+    producer->join();
+  }
+
+  // Posts run in FIFO order and every producer has finished, so the exit callback runs last.
+  dispatcher->post([&dispatcher]() { dispatcher->exit(); });
+  dispatcher_thread->join();
+  EXPECT_EQ(NumProducers * PostsPerProducer, executed);
+}
+
 TEST_F(DispatcherImplTest, PostExecuteAndDestructOrder) {
   ReadyWatcher parent_watcher;
   ReadyWatcher deferred_delete_watcher;
@@ -534,6 +616,40 @@ TEST(DispatcherThreadDeletedImplTest, DispatcherThreadDeletedAtNextCycle) {
   dispatcher->run(Event::Dispatcher::RunType::NonBlock);
 }
 
+TEST(DispatcherBusyPollTest, BusyPollLoopRunsEventsAndExits) {
+  Api::ApiPtr api = Api::createApiForTest();
+  DispatcherPtr dispatcher(api->allocateDispatcher("test_thread"));
+  dispatcher->enableBusyPolling(std::chrono::microseconds(50));
+
+  // The timer deadline is longer than the busy poll budget, so the loop spins through the budget
+  // and then blocks in the kernel poller until the timer fires.
+  ReadyWatcher post_watcher;
+  ReadyWatcher timer_watcher;
+  TimerPtr timer = dispatcher->createTimer([&]() {
+    timer_watcher.ready();
+    dispatcher->exit();
+  });
+  dispatcher->post([&]() {
+    post_watcher.ready();
+    timer->enableTimer(std::chrono::milliseconds(1));
+  });
+
+  EXPECT_CALL(post_watcher, ready());
+  EXPECT_CALL(timer_watcher, ready());
+  dispatcher->run(Event::Dispatcher::RunType::RunUntilExit);
+}
+
+TEST(DispatcherBusyPollTest, CrossThreadPostWakesBusyPollLoop) {
+  Api::ApiPtr api = Api::createApiForTest();
+  DispatcherPtr dispatcher(api->allocateDispatcher("test_thread"));
+  dispatcher->enableBusyPolling(std::chrono::microseconds(50));
+
+  Thread::ThreadPtr dispatcher_thread = api->threadFactory().createThread(
+      [&dispatcher]() { dispatcher->run(Event::Dispatcher::RunType::RunUntilExit); });
+  dispatcher->post([&dispatcher]() { dispatcher->exit(); });
+  dispatcher_thread->join();
+}
+
 class DispatcherShutdownTest : public testing::Test {
 protected:
   DispatcherShutdownTest()
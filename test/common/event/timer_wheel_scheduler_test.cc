@@ -0,0 +1,169 @@
+#include <chrono>
+
+#include "envoy/event/timer.h"
+
+#include "source/common/event/timer_wheel_scheduler.h"
+
+#include "test/test_common/simulated_time_system.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Event {
+namespace {
+
+using testing::MockFunction;
+
+class TimerWheelSchedulerTest : public testing::Test, public TestUsingSimulatedTime {
+public:
+  TimerWheelSchedulerTest()
+      : api_(Api::createApiForTest()), dispatcher_(api_->allocateDispatcher("test_thread")) {}
+
+  void advanceTimeAndRun(std::chrono::milliseconds duration) {
+    simTime().advanceTimeAndRun(duration, *dispatcher_, Dispatcher::RunType::Block);
+  }
+
+  Api::ApiPtr api_;
+  DispatcherPtr dispatcher_;
+};
+
+TEST_F(TimerWheelSchedulerTest, CreateAndDestroy) { TimerWheelScheduler scheduler(*dispatcher_); }
+
+TEST_F(TimerWheelSchedulerTest, CreateAndDestroyTimer) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  {
+    MockFunction<TimerCb> callback;
+    auto timer = scheduler.createTimer(callback.AsStdFunction(), *dispatcher_);
+  }
+}
+
+TEST_F(TimerWheelSchedulerTest, FiresAtTheNextTickBoundary) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  MockFunction<TimerCb> callback;
+  auto timer = scheduler.createTimer(callback.AsStdFunction(), *dispatcher_);
+
+  // 250ms rounds up to 3 ticks of the default 100ms interval.
+  timer->enableTimer(std::chrono::milliseconds(250));
+  EXPECT_TRUE(timer->enabled());
+
+  advanceTimeAndRun(std::chrono::milliseconds(200));
+  EXPECT_TRUE(timer->enabled());
+
+  EXPECT_CALL(callback, Call());
+  advanceTimeAndRun(std::chrono::milliseconds(100));
+  EXPECT_FALSE(timer->enabled());
+}
+
+TEST_F(TimerWheelSchedulerTest, ZeroDurationFiresOnTheNextTick) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  MockFunction<TimerCb> callback;
+  auto timer = scheduler.createTimer(callback.AsStdFunction(), *dispatcher_);
+
+  timer->enableTimer(std::chrono::milliseconds::zero());
+  EXPECT_TRUE(timer->enabled());
+
+  EXPECT_CALL(callback, Call());
+  advanceTimeAndRun(std::chrono::milliseconds(100));
+  EXPECT_FALSE(timer->enabled());
+}
+
+TEST_F(TimerWheelSchedulerTest, EnableAndDisableTimer) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  MockFunction<TimerCb> callback;
+  auto timer = scheduler.createTimer(callback.AsStdFunction(), *dispatcher_);
+
+  timer->enableTimer(std::chrono::seconds(1));
+  EXPECT_TRUE(timer->enabled());
+
+  timer->disableTimer();
+  EXPECT_FALSE(timer->enabled());
+
+  // This should be a no-op; a fire would be caught by the strict mock callback.
+  advanceTimeAndRun(std::chrono::seconds(2));
+}
+
+TEST_F(TimerWheelSchedulerTest, ReEnableMovesTheDeadline) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  MockFunction<TimerCb> callback;
+  auto timer = scheduler.createTimer(callback.AsStdFunction(), *dispatcher_);
+
+  timer->enableTimer(std::chrono::milliseconds(500));
+  timer->enableTimer(std::chrono::seconds(1));
+
+  advanceTimeAndRun(std::chrono::milliseconds(500));
+  EXPECT_TRUE(timer->enabled());
+
+  EXPECT_CALL(callback, Call());
+  advanceTimeAndRun(std::chrono::milliseconds(500));
+  EXPECT_FALSE(timer->enabled());
+}
+
+TEST_F(TimerWheelSchedulerTest, LongDeadlineCascadesThroughTheLevels) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  MockFunction<TimerCb> callback;
+  auto timer = scheduler.createTimer(callback.AsStdFunction(), *dispatcher_);
+
+  // 10s is 100 ticks, which lands beyond the first wheel level and has to cascade down before
+  // it can fire.
+  timer->enableTimer(std::chrono::seconds(10));
+
+  advanceTimeAndRun(std::chrono::milliseconds(9900));
+  EXPECT_TRUE(timer->enabled());
+
+  EXPECT_CALL(callback, Call());
+  advanceTimeAndRun(std::chrono::milliseconds(200));
+  EXPECT_FALSE(timer->enabled());
+}
+
+TEST_F(TimerWheelSchedulerTest, TimersOnTheSameTickAllFire) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  MockFunction<TimerCb> callback1;
+  MockFunction<TimerCb> callback2;
+  auto timer1 = scheduler.createTimer(callback1.AsStdFunction(), *dispatcher_);
+  auto timer2 = scheduler.createTimer(callback2.AsStdFunction(), *dispatcher_);
+
+  timer1->enableTimer(std::chrono::milliseconds(100));
+  timer2->enableTimer(std::chrono::milliseconds(100));
+
+  EXPECT_CALL(callback1, Call());
+  EXPECT_CALL(callback2, Call());
+  advanceTimeAndRun(std::chrono::milliseconds(100));
+  EXPECT_FALSE(timer1->enabled());
+  EXPECT_FALSE(timer2->enabled());
+}
+
+TEST_F(TimerWheelSchedulerTest, ReEnableFromWithinTheCallback) {
+  TimerWheelScheduler scheduler(*dispatcher_);
+
+  TimerPtr timer;
+  int fire_count = 0;
+  timer = scheduler.createTimer(
+      [&] {
+        if (++fire_count == 1) {
+          timer->enableTimer(std::chrono::milliseconds(100));
+        }
+      },
+      *dispatcher_);
+
+  timer->enableTimer(std::chrono::milliseconds(100));
+
+  advanceTimeAndRun(std::chrono::milliseconds(100));
+  EXPECT_EQ(fire_count, 1);
+  EXPECT_TRUE(timer->enabled());
+
+  advanceTimeAndRun(std::chrono::milliseconds(100));
+  EXPECT_EQ(fire_count, 2);
+  EXPECT_FALSE(timer->enabled());
+}
+
+} // namespace
+} // namespace Event
+} // namespace Envoy
@@ -367,6 +367,22 @@ TEST(SubstitutionFormatterTest, streamInfoFormatter) {
                 ProtoEq(ValueUtil::numberValue(25.0)));
   }
 
+  {
+    StreamInfoFormatter custom_timing_format("CUSTOM_TIMING_DURATION", "custom.checkpoint");
+    EXPECT_EQ(absl::nullopt, custom_timing_format.formatWithContext({}, stream_info));
+    EXPECT_THAT(custom_timing_format.formatValueWithContext({}, stream_info),
+                ProtoEq(ValueUtil::nullValue()));
+  }
+
+  {
+    StreamInfoFormatter custom_timing_format("CUSTOM_TIMING_DURATION", "custom.checkpoint");
+    stream_info.downstream_timing_.setValue("custom.checkpoint",
+                                            MonotonicTime(std::chrono::nanoseconds(30000000)));
+    EXPECT_EQ("30", custom_timing_format.formatWithContext({}, stream_info));
+    EXPECT_THAT(custom_timing_format.formatValueWithContext({}, stream_info),
+                ProtoEq(ValueUtil::numberValue(30.0)));
+  }
+
   {
     StreamInfoFormatter bytes_retransmitted_format("BYTES_RETRANSMITTED");
     EXPECT_CALL(stream_info, bytesRetransmitted()).WillRepeatedly(Return(1));
@@ -3809,6 +3825,40 @@ TEST(SubstitutionFormatterTest, JsonFormatterWithOrderedPropertiesTest) {
   EXPECT_EQ(out_json, expected);
 }
 
+TEST(SubstitutionFormatterTest, JsonFormatterDirectSerializationTest) {
+  NiceMock<StreamInfo::MockStreamInfo> stream_info;
+  Http::TestRequestHeaderMapImpl request_header{{"x-quoted", "a\"b"}};
+  Http::TestResponseHeaderMapImpl response_header;
+  Http::TestResponseTrailerMapImpl response_trailer;
+  std::string body;
+
+  HttpFormatterContext formatter_context(&request_header, &response_header, &response_trailer,
+                                         body);
+
+  absl::optional<Http::Protocol> protocol = Http::Protocol::Http11;
+  EXPECT_CALL(stream_info, protocol()).WillRepeatedly(Return(protocol));
+
+  ProtobufWkt::Struct key_mapping;
+  TestUtility::loadFromYaml(R"EOF(
+    combo: '%PROTOCOL%-suffix'
+    listed:
+      - plain
+      - '%PROTOCOL%'
+    missing: '%REQ(does-not-exist)%'
+    num: 42
+    quoted: '%REQ(x-quoted)%'
+  )EOF",
+                            key_mapping);
+  JsonFormatterImpl formatter(key_mapping, false, false, false);
+
+  // String-only formats are serialized directly without the intermediate Struct; verify the
+  // escaping and the exact layout of the emitted line.
+  const std::string expected = "{\"combo\":\"HTTP/1.1-suffix\",\"listed\":[\"plain\",\"HTTP/1.1\"],"
+                               "\"missing\":\"-\",\"num\":\"42\",\"quoted\":\"a\\\"b\"}\n";
+
+  EXPECT_EQ(expected, formatter.formatWithContext(formatter_context, stream_info));
+}
+
 TEST(SubstitutionFormatterTest, CompositeFormatterSuccess) {
   Http::TestRequestHeaderMapImpl request_header{{"first", "GET"}, {":path", "/"}};
   Http::TestResponseHeaderMapImpl response_header{{"second", "PUT"}, {"test", "test"}};
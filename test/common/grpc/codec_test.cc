@@ -193,6 +193,38 @@ TEST(GrpcCodecTest, decodeSingleFrame) {
   EXPECT_EQ("hello", result.name());
 }
 
+// Large payload slices are transferred from the input buffer into the decoded
+// frame without copying the bytes.
+TEST(GrpcCodecTest, decodeSingleFrameWithoutCopy) {
+  const std::string payload(8192, 'a');
+  Buffer::BufferFragmentImpl fragment(payload.data(), payload.size(), nullptr);
+
+  Buffer::OwnedImpl buffer;
+  std::array<uint8_t, 5> header;
+  Encoder encoder;
+  encoder.newFrame(GRPC_FH_DEFAULT, payload.size(), header);
+  buffer.add(header.data(), 5);
+  buffer.addBufferFragment(fragment);
+
+  std::vector<Frame> frames;
+  Decoder decoder;
+  EXPECT_TRUE(decoder.decode(buffer, frames));
+  EXPECT_EQ(static_cast<size_t>(0), buffer.length());
+  ASSERT_EQ(static_cast<size_t>(1), frames.size());
+  EXPECT_EQ(payload.size(), frames[0].length_);
+  EXPECT_EQ(payload, frames[0].data_->toString());
+
+  // The frame must reference the original payload memory rather than a copy.
+  bool found_payload_slice = false;
+  for (const Buffer::RawSlice& slice : frames[0].data_->getRawSlices()) {
+    if (slice.mem_ == payload.data()) {
+      found_payload_slice = true;
+    }
+  }
+  EXPECT_TRUE(found_payload_slice);
+  frames.clear();
+}
+
 TEST(GrpcCodecTest, decodeMultipleFrame) {
   helloworld::HelloRequest request;
   request.set_name("hello");
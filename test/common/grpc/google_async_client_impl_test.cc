@@ -86,6 +86,20 @@ public:
   AsyncClient<helloworld::HelloRequest, helloworld::HelloReply> grpc_client_;
 };
 
+// Verify that with multiple completion queues configured, new streams are assigned to queues
+// round-robin.
+TEST_F(EnvoyGoogleAsyncClientImplTest, MultipleCompletionQueuesRoundRobin) {
+  GoogleAsyncClientThreadLocal sharded_tls(*api_, 3);
+  grpc::CompletionQueue* first = &sharded_tls.nextCompletionQueue();
+  grpc::CompletionQueue* second = &sharded_tls.nextCompletionQueue();
+  grpc::CompletionQueue* third = &sharded_tls.nextCompletionQueue();
+  EXPECT_NE(first, second);
+  EXPECT_NE(second, third);
+  EXPECT_NE(first, third);
+  // The fourth assignment wraps around to the first queue.
+  EXPECT_EQ(first, &sharded_tls.nextCompletionQueue());
+}
+
 // Verify that grpc client check for thread consistency.
 TEST_F(EnvoyGoogleAsyncClientImplTest, ThreadSafe) {
   initialize();
@@ -33,5 +33,26 @@ TEST(CharacterSetValidationTest, Test) {
   }
 }
 
+TEST(CharacterSetValidationTest, TestString) {
+  // Strings longer than one eight-byte block, shorter than a block, and exactly a block,
+  // with invalid bytes at every position of the block and the tail.
+  EXPECT_TRUE(testStringInTable(kGenericHeaderNameCharTable, ""));
+  EXPECT_TRUE(testStringInTable(kGenericHeaderNameCharTable, "foo"));
+  EXPECT_TRUE(testStringInTable(kGenericHeaderNameCharTable, "exactly8"));
+  EXPECT_TRUE(testStringInTable(kGenericHeaderNameCharTable, "x-envoy-retry-grpc-on"));
+
+  for (size_t length = 1; length <= 24; ++length) {
+    for (size_t bad_index = 0; bad_index < length; ++bad_index) {
+      std::string str(length, 'a');
+      str[bad_index] = ' ';
+      EXPECT_FALSE(testStringInTable(kGenericHeaderNameCharTable, str))
+          << "length " << length << " bad index " << bad_index;
+    }
+  }
+
+  // Extended ascii must not be accepted either.
+  EXPECT_FALSE(testStringInTable(kGenericHeaderNameCharTable, "foo\x80of-a-header-name"));
+}
+
 } // namespace Http
 } // namespace Envoy
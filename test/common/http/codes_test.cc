@@ -99,6 +99,35 @@ TEST_F(CodeUtilityTest, NoCanary) {
   EXPECT_EQ(19U, cluster_store_.counters().size());
 }
 
+TEST_F(CodeUtilityTest, EmptyPrefix) {
+  // With an empty prefix (as used for cluster traffic stats), the pre-joined names are charged
+  // directly without a symbol join.
+  Stats::StatName empty_stat_name;
+  Http::CodeStats::ResponseStatInfo info{*global_store_.rootScope(),
+                                         *cluster_store_.rootScope(),
+                                         empty_stat_name,
+                                         204,
+                                         false,
+                                         empty_stat_name,
+                                         empty_stat_name,
+                                         empty_stat_name,
+                                         empty_stat_name,
+                                         empty_stat_name,
+                                         true};
+  code_stats_.chargeResponseStat(info, false);
+
+  EXPECT_EQ(1U, cluster_store_.counter("upstream_rq_completed").value());
+  EXPECT_EQ(1U, cluster_store_.counter("upstream_rq_2xx").value());
+  EXPECT_EQ(1U, cluster_store_.counter("upstream_rq_204").value());
+  EXPECT_EQ(1U, cluster_store_.counter("canary.upstream_rq_completed").value());
+  EXPECT_EQ(1U, cluster_store_.counter("canary.upstream_rq_2xx").value());
+  EXPECT_EQ(1U, cluster_store_.counter("canary.upstream_rq_204").value());
+  EXPECT_EQ(1U, cluster_store_.counter("external.upstream_rq_completed").value());
+  EXPECT_EQ(1U, cluster_store_.counter("external.upstream_rq_2xx").value());
+  EXPECT_EQ(1U, cluster_store_.counter("external.upstream_rq_204").value());
+  EXPECT_EQ(9U, cluster_store_.counters().size());
+}
+
 TEST_F(CodeUtilityTest, Canary) {
   addResponse(100, true, true);
   addResponse(200, true, true);
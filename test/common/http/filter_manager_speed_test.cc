@@ -0,0 +1,77 @@
+#include <memory>
+
+#include "envoy/http/filter.h"
+
+#include "source/common/http/filter_manager.h"
+#include "source/common/stream_info/filter_state_impl.h"
+#include "source/extensions/filters/http/common/pass_through_filter.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/http/mocks.h"
+#include "test/mocks/local_reply/mocks.h"
+#include "test/mocks/network/mocks.h"
+
+#include "benchmark/benchmark.h"
+#include "gmock/gmock.h"
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+namespace Envoy {
+namespace Http {
+namespace {
+
+/**
+ * Measure the fixed per-stream overhead of filter chain iteration as a function of chain
+ * depth. Each iteration runs the full per-stream lifecycle — chain creation, decoding a
+ * header-only request through N pass-through filters, and filter destruction — which is
+ * the cost every request pays before any filter does real work. This keeps per-filter
+ * dispatch cost visible so decisions about filter chain length can be data-driven.
+ */
+static void bmFilterChainDepth(benchmark::State& state) {
+  const int num_filters = state.range(0);
+
+  NiceMock<MockFilterManagerCallbacks> filter_manager_callbacks;
+  NiceMock<Event::MockDispatcher> dispatcher;
+  NiceMock<Network::MockConnection> connection;
+  MockFilterChainFactory filter_factory;
+  NiceMock<LocalReply::MockLocalReply> local_reply;
+  NiceMock<MockTimeSystem> time_source;
+  StreamInfo::FilterStateSharedPtr filter_state =
+      std::make_shared<StreamInfo::FilterStateImpl>(StreamInfo::FilterState::LifeSpan::Connection);
+
+  ON_CALL(filter_factory, createFilterChain(_))
+      .WillByDefault(Invoke([&](FilterChainManager& manager) -> bool {
+        FilterFactoryCb factory = [](FilterChainFactoryCallbacks& callbacks) {
+          callbacks.addStreamFilter(std::make_shared<PassThroughFilter>());
+        };
+        for (int i = 0; i < num_filters; ++i) {
+          manager.applyFilterFactoryCb({"passthrough-filter", "envoy.filters.http.passthrough"},
+                                       factory);
+        }
+        return true;
+      }));
+
+  RequestHeaderMapPtr headers{
+      new TestRequestHeaderMapImpl{{":authority", "host"}, {":path", "/"}, {":method", "GET"}}};
+  ON_CALL(filter_manager_callbacks, requestHeaders()).WillByDefault(Return(makeOptRef(*headers)));
+
+  for (auto _ : state) { // NOLINT
+    DownstreamFilterManager filter_manager(
+        filter_manager_callbacks, dispatcher, connection, 0, nullptr, true, 10000, filter_factory,
+        local_reply, Protocol::Http2, time_source, filter_state,
+        StreamInfo::FilterState::LifeSpan::Connection);
+    filter_manager.createFilterChain();
+    filter_manager.requestHeadersInitialized();
+    filter_manager.decodeHeaders(*headers, true);
+    filter_manager.destroyFilters();
+  }
+}
+
+BENCHMARK(bmFilterChainDepth)->RangeMultiplier(2)->Range(1, 64);
+
+} // namespace
+} // namespace Http
+} // namespace Envoy
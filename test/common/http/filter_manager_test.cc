@@ -13,6 +13,7 @@
 #include "source/common/stream_info/filter_state_impl.h"
 #include "source/common/stream_info/stream_info_impl.h"
 
+#include "test/common/stats/stat_test_utility.h"
 #include "test/mocks/event/mocks.h"
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/local_reply/mocks.h"
@@ -69,6 +70,38 @@ public:
       std::make_shared<StreamInfo::FilterStateImpl>(StreamInfo::FilterState::LifeSpan::Connection);
 };
 
+// Verifies that per-filter timing histograms are recorded when filter timing is enabled for the
+// stream.
+TEST_F(FilterManagerTest, FilterTimingHistograms) {
+  initialize();
+
+  Stats::TestUtil::TestStore store;
+  Stats::StatNameManagedStorage prefix("http.test", store.symbolTable());
+  filter_manager_->enableFilterTiming(*store.rootScope(), prefix.statName());
+
+  std::shared_ptr<MockStreamDecoderFilter> filter(new NiceMock<MockStreamDecoderFilter>());
+  EXPECT_CALL(*filter, decodeHeaders(_, true)).WillOnce(Return(FilterHeadersStatus::Continue));
+
+  EXPECT_CALL(filter_factory_, createFilterChain(_))
+      .WillRepeatedly(Invoke([&](FilterChainManager& manager) -> bool {
+        auto factory = createDecoderFilterFactoryCb(filter);
+        manager.applyFilterFactoryCb({"test-filter", "envoy.filters.http.mock"}, factory);
+        return true;
+      }));
+  filter_manager_->createFilterChain();
+
+  RequestHeaderMapPtr headers{
+      new TestRequestHeaderMapImpl{{":authority", "host"}, {":path", "/"}, {":method", "GET"}}};
+  ON_CALL(filter_manager_callbacks_, requestHeaders()).WillByDefault(Return(makeOptRef(*headers)));
+  filter_manager_->requestHeadersInitialized();
+  filter_manager_->decodeHeaders(*headers, true);
+
+  EXPECT_EQ(1,
+            store.histogramValues("http.test.filter_timing.test-filter.decode_headers", false)
+                .size());
+  filter_manager_->destroyFilters();
+}
+
 // Verifies that the local reply persists the gRPC classification even if the request headers are
 // modified.
 TEST_F(FilterManagerTest, SendLocalReplyDuringDecodingGrpcClassiciation) {
@@ -699,6 +732,225 @@ TEST_F(FilterManagerTest, IdleTimerResets) {
   filter_1->decoder_callbacks_->encodeTrailers(std::move(basic_resp_trailers));
   filter_manager_->destroyFilters();
 }
+
+// When every encoder filter declares body pass-through, intermediate response data frames
+// bypass filter iteration entirely; the end-of-stream frame still iterates the chain.
+TEST_F(FilterManagerTest, EncoderBodyPassThroughSkipsFilterIteration) {
+  initialize();
+
+  std::shared_ptr<MockStreamFilter> filter_1(new NiceMock<MockStreamFilter>());
+  ON_CALL(*filter_1, isBodyPassThrough()).WillByDefault(Return(true));
+  EXPECT_CALL(filter_factory_, createFilterChain(_))
+      .WillRepeatedly(Invoke([&](FilterChainManager& manager) -> bool {
+        auto factory = createStreamFilterFactoryCb(filter_1);
+        manager.applyFilterFactoryCb({"filter1", "filter1"}, factory);
+        return true;
+      }));
+  filter_manager_->createFilterChain();
+
+  RequestHeaderMapPtr basic_headers{
+      new TestRequestHeaderMapImpl{{":authority", "host"}, {":path", "/"}, {":method", "GET"}}};
+  ON_CALL(filter_manager_callbacks_, requestHeaders())
+      .WillByDefault(Return(makeOptRef(*basic_headers)));
+  filter_manager_->requestHeadersInitialized();
+  filter_manager_->decodeHeaders(*basic_headers, true);
+
+  ResponseHeaderMapPtr response_headers{new TestResponseHeaderMapImpl{{":status", "200"}}};
+  ON_CALL(filter_manager_callbacks_, responseHeaders())
+      .WillByDefault(Return(makeOptRef(*response_headers)));
+  EXPECT_CALL(*filter_1, encodeHeaders(_, false));
+  EXPECT_CALL(filter_manager_callbacks_, encodeHeaders(_, false));
+  filter_1->decoder_callbacks_->encodeHeaders(
+      std::make_unique<TestResponseHeaderMapImpl>(*response_headers), false, "");
+
+  // Intermediate frame: delivered straight to the codec, filter not consulted.
+  Buffer::OwnedImpl data("hello");
+  EXPECT_CALL(*filter_1, encodeData(_, _)).Times(0);
+  EXPECT_CALL(filter_manager_callbacks_, encodeData(_, false));
+  filter_1->decoder_callbacks_->encodeData(data, false);
+
+  // End-of-stream frame: takes the normal iteration path.
+  Buffer::OwnedImpl last_data("world");
+  EXPECT_CALL(*filter_1, encodeData(_, true)).WillOnce(Return(FilterDataStatus::Continue));
+  EXPECT_CALL(*filter_1, encodeComplete());
+  EXPECT_CALL(filter_manager_callbacks_, encodeData(_, true));
+  filter_1->decoder_callbacks_->encodeData(last_data, true);
+
+  filter_manager_->destroyFilters();
+}
+
+// A single filter that does not declare pass-through keeps per-filter iteration for all frames.
+TEST_F(FilterManagerTest, EncoderBodyPassThroughDisabledByOneFilter) {
+  initialize();
+
+  std::shared_ptr<MockStreamFilter> filter_1(new NiceMock<MockStreamFilter>());
+  ON_CALL(*filter_1, isBodyPassThrough()).WillByDefault(Return(true));
+  std::shared_ptr<MockStreamEncoderFilter> filter_2(new NiceMock<MockStreamEncoderFilter>());
+  EXPECT_CALL(filter_factory_, createFilterChain(_))
+      .WillRepeatedly(Invoke([&](FilterChainManager& manager) -> bool {
+        auto factory_1 = createStreamFilterFactoryCb(filter_1);
+        manager.applyFilterFactoryCb({"filter1", "filter1"}, factory_1);
+        auto factory_2 = createEncoderFilterFactoryCb(filter_2);
+        manager.applyFilterFactoryCb({"filter2", "filter2"}, factory_2);
+        return true;
+      }));
+  filter_manager_->createFilterChain();
+
+  RequestHeaderMapPtr basic_headers{
+      new TestRequestHeaderMapImpl{{":authority", "host"}, {":path", "/"}, {":method", "GET"}}};
+  ON_CALL(filter_manager_callbacks_, requestHeaders())
+      .WillByDefault(Return(makeOptRef(*basic_headers)));
+  filter_manager_->requestHeadersInitialized();
+  filter_manager_->decodeHeaders(*basic_headers, true);
+
+  ResponseHeaderMapPtr response_headers{new TestResponseHeaderMapImpl{{":status", "200"}}};
+  ON_CALL(filter_manager_callbacks_, responseHeaders())
+      .WillByDefault(Return(makeOptRef(*response_headers)));
+  filter_1->decoder_callbacks_->encodeHeaders(
+      std::make_unique<TestResponseHeaderMapImpl>(*response_headers), false, "");
+
+  Buffer::OwnedImpl data("hello");
+  EXPECT_CALL(*filter_2, encodeData(_, false)).WillOnce(Return(FilterDataStatus::Continue));
+  EXPECT_CALL(*filter_1, encodeData(_, false)).WillOnce(Return(FilterDataStatus::Continue));
+  EXPECT_CALL(filter_manager_callbacks_, encodeData(_, false));
+  filter_1->decoder_callbacks_->encodeData(data, false);
+
+  filter_manager_->destroyFilters();
+}
+
+// Once an upgrade is established and all non-terminal decoder filters declare body
+// pass-through, tunneled request payload is handed straight to the terminal filter; the
+// end-of-stream frame still iterates the full chain.
+TEST_F(FilterManagerTest, DecoderUpgradePassThroughSkipsNonTerminalFilters) {
+  initialize();
+
+  std::shared_ptr<MockStreamFilter> filter_1(new NiceMock<MockStreamFilter>());
+  ON_CALL(*filter_1, isBodyPassThrough()).WillByDefault(Return(true));
+  std::shared_ptr<MockStreamDecoderFilter> terminal_filter(
+      new NiceMock<MockStreamDecoderFilter>());
+  EXPECT_CALL(filter_factory_, createUpgradeFilterChain(_, _, _))
+      .WillRepeatedly(Invoke([&](absl::string_view, const FilterChainFactory::UpgradeMap*,
+                                 FilterChainManager& manager) -> bool {
+        auto factory_1 = createStreamFilterFactoryCb(filter_1);
+        manager.applyFilterFactoryCb({"filter1", "filter1"}, factory_1);
+        auto terminal_factory = createDecoderFilterFactoryCb(terminal_filter);
+        manager.applyFilterFactoryCb({"terminal", "terminal"}, terminal_factory);
+        return true;
+      }));
+
+  RequestHeaderMapPtr basic_headers{new TestRequestHeaderMapImpl{{":authority", "host"},
+                                                                 {":path", "/"},
+                                                                 {":method", "GET"},
+                                                                 {"connection", "upgrade"},
+                                                                 {"upgrade", "websocket"}}};
+  ON_CALL(filter_manager_callbacks_, requestHeaders())
+      .WillByDefault(Return(makeOptRef(*basic_headers)));
+  filter_manager_->createFilterChain();
+  filter_manager_->requestHeadersInitialized();
+  filter_manager_->decodeHeaders(*basic_headers, false);
+
+  // Establish the tunnel with a successful upgrade response.
+  ResponseHeaderMapPtr response_headers{new TestResponseHeaderMapImpl{
+      {":status", "101"}, {"connection", "upgrade"}, {"upgrade", "websocket"}}};
+  ON_CALL(filter_manager_callbacks_, responseHeaders())
+      .WillByDefault(Return(makeOptRef(*response_headers)));
+  EXPECT_CALL(filter_manager_callbacks_, encodeHeaders(_, false));
+  terminal_filter->callbacks_->encodeHeaders(
+      std::make_unique<TestResponseHeaderMapImpl>(*response_headers), false, "");
+
+  // Intermediate tunneled frame: only the terminal filter is consulted.
+  Buffer::OwnedImpl data("hello");
+  EXPECT_CALL(*filter_1, decodeData(_, _)).Times(0);
+  EXPECT_CALL(*terminal_filter, decodeData(_, false)).WillOnce(Return(FilterDataStatus::Continue));
+  filter_manager_->decodeData(data, false);
+
+  // End-of-stream frame: takes the normal iteration path through every filter.
+  Buffer::OwnedImpl last_data("world");
+  EXPECT_CALL(*filter_1, decodeData(_, true)).WillOnce(Return(FilterDataStatus::Continue));
+  EXPECT_CALL(*filter_1, decodeComplete());
+  EXPECT_CALL(*terminal_filter, decodeData(_, true)).WillOnce(Return(FilterDataStatus::Continue));
+  EXPECT_CALL(*terminal_filter, decodeComplete());
+  filter_manager_->decodeData(last_data, true);
+
+  filter_manager_->destroyFilters();
+}
+
+// A filter that declares trailer pass-through is skipped when iterating trailer frames, but
+// still observes end of stream via decodeComplete()/encodeComplete().
+TEST_F(FilterManagerTest, TrailerPassThroughSkipsFilterIteration) {
+  initialize();
+
+  std::shared_ptr<MockStreamFilter> filter_1(new NiceMock<MockStreamFilter>());
+  ON_CALL(*filter_1, isTrailerPassThrough()).WillByDefault(Return(true));
+  EXPECT_CALL(filter_factory_, createFilterChain(_))
+      .WillRepeatedly(Invoke([&](FilterChainManager& manager) -> bool {
+        auto factory = createStreamFilterFactoryCb(filter_1);
+        manager.applyFilterFactoryCb({"filter1", "filter1"}, factory);
+        return true;
+      }));
+  filter_manager_->createFilterChain();
+
+  RequestHeaderMapPtr basic_headers{
+      new TestRequestHeaderMapImpl{{":authority", "host"}, {":path", "/"}, {":method", "GET"}}};
+  ON_CALL(filter_manager_callbacks_, requestHeaders())
+      .WillByDefault(Return(makeOptRef(*basic_headers)));
+  filter_manager_->requestHeadersInitialized();
+  filter_manager_->decodeHeaders(*basic_headers, false);
+
+  RequestTrailerMapPtr basic_trailers{new TestRequestTrailerMapImpl{{"x", "y"}}};
+  EXPECT_CALL(*filter_1, decodeTrailers(_)).Times(0);
+  EXPECT_CALL(*filter_1, decodeComplete());
+  filter_manager_->decodeTrailers(*basic_trailers);
+
+  ResponseHeaderMapPtr response_headers{new TestResponseHeaderMapImpl{{":status", "200"}}};
+  ON_CALL(filter_manager_callbacks_, responseHeaders())
+      .WillByDefault(Return(makeOptRef(*response_headers)));
+  filter_1->decoder_callbacks_->encodeHeaders(
+      std::make_unique<TestResponseHeaderMapImpl>(*response_headers), false, "");
+
+  ResponseTrailerMapPtr basic_resp_trailers{new TestResponseTrailerMapImpl{{"x", "y"}}};
+  EXPECT_CALL(*filter_1, encodeTrailers(_)).Times(0);
+  EXPECT_CALL(*filter_1, encodeComplete());
+  EXPECT_CALL(filter_manager_callbacks_, encodeTrailers(_));
+  filter_1->decoder_callbacks_->encodeTrailers(std::move(basic_resp_trailers));
+
+  filter_manager_->destroyFilters();
+}
+
+// Only the filters that declare trailer pass-through are skipped; other filters in the chain
+// still receive trailer callbacks.
+TEST_F(FilterManagerTest, TrailerPassThroughOnlySkipsDeclaringFilter) {
+  initialize();
+
+  std::shared_ptr<MockStreamDecoderFilter> filter_1(new NiceMock<MockStreamDecoderFilter>());
+  ON_CALL(*filter_1, isTrailerPassThrough()).WillByDefault(Return(true));
+  std::shared_ptr<MockStreamDecoderFilter> filter_2(new NiceMock<MockStreamDecoderFilter>());
+  EXPECT_CALL(filter_factory_, createFilterChain(_))
+      .WillRepeatedly(Invoke([&](FilterChainManager& manager) -> bool {
+        auto factory_1 = createDecoderFilterFactoryCb(filter_1);
+        manager.applyFilterFactoryCb({"filter1", "filter1"}, factory_1);
+        auto factory_2 = createDecoderFilterFactoryCb(filter_2);
+        manager.applyFilterFactoryCb({"filter2", "filter2"}, factory_2);
+        return true;
+      }));
+  filter_manager_->createFilterChain();
+
+  RequestHeaderMapPtr basic_headers{
+      new TestRequestHeaderMapImpl{{":authority", "host"}, {":path", "/"}, {":method", "GET"}}};
+  ON_CALL(filter_manager_callbacks_, requestHeaders())
+      .WillByDefault(Return(makeOptRef(*basic_headers)));
+  filter_manager_->requestHeadersInitialized();
+  filter_manager_->decodeHeaders(*basic_headers, false);
+
+  RequestTrailerMapPtr basic_trailers{new TestRequestTrailerMapImpl{{"x", "y"}}};
+  EXPECT_CALL(*filter_1, decodeTrailers(_)).Times(0);
+  EXPECT_CALL(*filter_1, decodeComplete());
+  EXPECT_CALL(*filter_2, decodeTrailers(_)).WillOnce(Return(FilterTrailersStatus::Continue));
+  EXPECT_CALL(*filter_2, decodeComplete());
+  filter_manager_->decodeTrailers(*basic_trailers);
+
+  filter_manager_->destroyFilters();
+}
 } // namespace
 } // namespace Http
 } // namespace Envoy
@@ -590,6 +590,34 @@ TEST(HeaderMapImplTest, AddCopy) {
             headers.get(envoy_retry_on)[0]->value().getStringView());
 }
 
+TEST(HeaderMapImplTest, AddCopyBulk) {
+  TestRequestHeaderMapImpl headers;
+
+  // A mix of inline headers (including a duplicate that coalesces) and custom headers
+  // (including a duplicate that produces multiple entries), added in one batch.
+  const std::vector<std::pair<absl::string_view, absl::string_view>> batch = {
+      {":path", "/"},
+      {"x-envoy-retry-on", "5xx"},
+      {"hello", "world"},
+      {"x-envoy-retry-on", "gateway-error"},
+      {"hello", "there"}};
+  headers.addCopyBulk(batch);
+
+  EXPECT_EQ("/", headers.getPathValue());
+  // Inline duplicates comma concatenate.
+  EXPECT_EQ("5xx,gateway-error", headers.getEnvoyRetryOnValue());
+  // Custom header duplicates produce discrete entries.
+  const auto values = headers.get(LowerCaseString("hello"));
+  ASSERT_EQ(2UL, values.size());
+  EXPECT_EQ("world", values[0]->value().getStringView());
+  EXPECT_EQ("there", values[1]->value().getStringView());
+  EXPECT_EQ(4UL, headers.size());
+
+  // An empty batch is a no-op.
+  headers.addCopyBulk({});
+  EXPECT_EQ(4UL, headers.size());
+}
+
 TEST(HeaderMapImplTest, Equality) {
   TestRequestHeaderMapImpl headers1;
   TestRequestHeaderMapImpl headers2;
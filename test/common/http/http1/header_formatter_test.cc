@@ -20,6 +20,19 @@ TEST(ProperCaseHeaderKeyFormatterTest, Formatting) {
   const std::string single_character = "a";
   EXPECT_EQ(formatter.format(single_character), "A");
 }
+
+TEST(ProperCaseHeaderKeyFormatterTest, RepeatedFormattingIsStable) {
+  ProperCaseHeaderKeyFormatter formatter;
+
+  // Repeated keys are served from the per-worker interning cache; the result must be identical
+  // on every call, including across formatter instances.
+  EXPECT_EQ(formatter.format("x-envoy-expected-rq-timeout-ms"), "X-Envoy-Expected-Rq-Timeout-Ms");
+  EXPECT_EQ(formatter.format("x-envoy-expected-rq-timeout-ms"), "X-Envoy-Expected-Rq-Timeout-Ms");
+
+  ProperCaseHeaderKeyFormatter other_formatter;
+  EXPECT_EQ(other_formatter.format("x-envoy-expected-rq-timeout-ms"),
+            "X-Envoy-Expected-Rq-Timeout-Ms");
+}
 } // namespace Http1
 } // namespace Http
 } // namespace Envoy
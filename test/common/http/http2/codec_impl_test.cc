@@ -3112,6 +3112,30 @@ TEST_P(Http2CodecImplTest, PingFloodMitigationDisabled) {
   EXPECT_NO_THROW(driveToCompletion());
 }
 
+// Verify that with batched frame writes all frames serialized by one send pass reach the
+// connection as a single write.
+TEST_P(Http2CodecImplTest, BatchedFrameWritesCoalescePingAcks) {
+  scoped_runtime_.mergeValues({{"envoy.reloadable_features.http2_batch_frame_writes", "true"}});
+  initialize();
+
+  TestRequestHeaderMapImpl request_headers;
+  HttpTestUtility::addDefaultHeaders(request_headers);
+  EXPECT_CALL(request_decoder_, decodeHeaders_(_, false));
+  EXPECT_TRUE(request_encoder_->encodeHeaders(request_headers, false).ok());
+  driveToCompletion();
+
+  constexpr uint32_t kNumPings = 5;
+  for (uint32_t i = 0; i < kNumPings; ++i) {
+    submitPing(client_, i);
+  }
+
+  // All PING ACKs are serialized by a single send pass on the server and must be coalesced into
+  // one connection write.
+  EXPECT_CALL(server_connection_, write(_, _)).Times(1);
+  driveToCompletion();
+  EXPECT_EQ(0, server_stats_store_.counter("http2.outbound_control_flood").value());
+}
+
 // Verify that outbound control frame counter decreases when send buffer is drained
 TEST_P(Http2CodecImplTest, PingFloodCounterReset) {
   // Ping frames are 17 bytes each so 240 full frames and a partial frame fit in the current min
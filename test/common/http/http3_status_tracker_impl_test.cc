@@ -3,11 +3,13 @@
 #include "test/common/http/common.h"
 #include "test/mocks/common.h"
 #include "test/mocks/event/mocks.h"
+#include "test/test_common/simulated_time_system.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 using Envoy::Event::MockTimer;
+using testing::_;
 using testing::NiceMock;
 using testing::Return;
 
@@ -21,6 +23,7 @@ public:
   Http3StatusTrackerImplTest() : timer_(new MockTimer(&dispatcher_)), tracker_(dispatcher_) {}
 
   HttpServerPropertiesCache::Origin origin_{"https", "hostname", 1};
+  Event::SimulatedTimeSystem simulated_time_;
   NiceMock<Event::MockDispatcher> dispatcher_;
   MockTimer* timer_; // Owned by tracker_;
   Http3StatusTrackerImpl tracker_;
@@ -193,6 +196,61 @@ TEST_F(Http3StatusTrackerImplTest, MarkFailedRecentlyAndThenBroken) {
   EXPECT_FALSE(tracker_.hasHttp3FailedRecently());
 }
 
+TEST_F(Http3StatusTrackerImplTest, RestoreBrokenStateStillBroken) {
+  const MonotonicTime broken_until =
+      dispatcher_.timeSource().monotonicTime() + std::chrono::minutes(3);
+  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(3 * 60 * 1000), nullptr));
+  tracker_.restoreBrokenState(broken_until, 2);
+  EXPECT_TRUE(tracker_.isHttp3Broken());
+  EXPECT_EQ(broken_until, tracker_.brokenUntil());
+  EXPECT_EQ(2, tracker_.consecutiveBrokenCount());
+
+  timer_->invokeCallback();
+  EXPECT_FALSE(tracker_.isHttp3Broken());
+  EXPECT_TRUE(tracker_.hasHttp3FailedRecently());
+
+  // The restored backoff history applies to the next broken period.
+  EXPECT_CALL(*timer_, enabled()).WillOnce(Return(false));
+  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(20 * 60 * 1000), nullptr));
+  tracker_.markHttp3Broken();
+}
+
+TEST_F(Http3StatusTrackerImplTest, RestoreBrokenStateExpired) {
+  const MonotonicTime broken_until =
+      dispatcher_.timeSource().monotonicTime() - std::chrono::minutes(1);
+  tracker_.restoreBrokenState(broken_until, 3);
+  EXPECT_FALSE(tracker_.isHttp3Broken());
+  EXPECT_FALSE(tracker_.hasHttp3FailedRecently());
+  EXPECT_EQ(3, tracker_.consecutiveBrokenCount());
+
+  // Only the backoff history is kept.
+  EXPECT_CALL(*timer_, enabled()).WillOnce(Return(false));
+  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(40 * 60 * 1000), nullptr));
+  tracker_.markHttp3Broken();
+}
+
+TEST_F(Http3StatusTrackerImplTest, StateChangedCallback) {
+  uint32_t changes = 0;
+  MockTimer* timer = new MockTimer(&dispatcher_);
+  Http3StatusTrackerImpl tracker(dispatcher_, [&changes]() { ++changes; });
+
+  EXPECT_CALL(*timer, enabled()).WillOnce(Return(false));
+  EXPECT_CALL(*timer, enableTimer(_, nullptr));
+  tracker.markHttp3Broken();
+  EXPECT_EQ(1, changes);
+
+  // Broken expiring to failed recently also notifies.
+  timer->invokeCallback();
+  EXPECT_EQ(2, changes);
+
+  EXPECT_CALL(*timer, enabled()).WillOnce(Return(false));
+  tracker.markHttp3Confirmed();
+  EXPECT_EQ(3, changes);
+
+  tracker.markHttp3FailedRecently();
+  EXPECT_EQ(4, changes);
+}
+
 } // namespace
 } // namespace Http
 } // namespace Envoy
@@ -373,6 +373,65 @@ TEST_F(HttpServerPropertiesCacheImplTest, GetOrCreateHttp3StatusTracker) {
   EXPECT_FALSE(protocols_->getOrCreateHttp3StatusTracker(origin1_).isHttp3Broken());
 }
 
+TEST_F(HttpServerPropertiesCacheImplTest, Http3StatusChangesFlushToStore) {
+  initialize();
+
+  // Marking broken persists the expiry (5 minutes from now) and backoff count.
+  EXPECT_CALL(*store_, addOrUpdate("https://hostname1:1", "clear|0|0|broken;300;1", kNoTtl));
+  protocols_->getOrCreateHttp3StatusTracker(origin1_).markHttp3Broken();
+
+  EXPECT_CALL(*store_, addOrUpdate("https://hostname1:1", "clear|0|0|confirmed", kNoTtl));
+  protocols_->getOrCreateHttp3StatusTracker(origin1_).markHttp3Confirmed();
+
+  // Failed recently is transient and serializes without an HTTP/3 status.
+  EXPECT_CALL(*store_, addOrUpdate("https://hostname1:1", "clear|0|0", kNoTtl));
+  protocols_->getOrCreateHttp3StatusTracker(origin1_).markHttp3FailedRecently();
+}
+
+TEST_F(HttpServerPropertiesCacheImplTest, CacheLoadHttp3StatusConfirmed) {
+  EXPECT_CALL(*store_, addOrUpdate(_, _, _)).Times(0);
+  EXPECT_CALL(*store_, iterate(_)).WillOnce(Invoke([&](KeyValueStore::ConstIterateCb fn) {
+    fn("https://hostname1:1", "alpn1=\"hostname1:1\"; ma=5|2|3|confirmed");
+  }));
+  initialize();
+
+  EXPECT_EQ(1, protocols_->size());
+  EXPECT_TRUE(protocols_->getOrCreateHttp3StatusTracker(origin1_).isHttp3Confirmed());
+}
+
+TEST_F(HttpServerPropertiesCacheImplTest, CacheLoadHttp3StatusBroken) {
+  EXPECT_CALL(*store_, addOrUpdate(_, _, _)).Times(0);
+  EXPECT_CALL(*store_, iterate(_)).WillOnce(Invoke([&](KeyValueStore::ConstIterateCb fn) {
+    // Broken for another 60 seconds, after one prior broken period.
+    fn("https://hostname1:1", "clear|0|0|broken;60;1");
+  }));
+  initialize();
+
+  EXPECT_TRUE(protocols_->getOrCreateHttp3StatusTracker(origin1_).isHttp3Broken());
+}
+
+TEST_F(HttpServerPropertiesCacheImplTest, CacheLoadHttp3StatusBrokenExpired) {
+  EXPECT_CALL(*store_, addOrUpdate(_, _, _)).Times(0);
+  EXPECT_CALL(*store_, iterate(_)).WillOnce(Invoke([&](KeyValueStore::ConstIterateCb fn) {
+    // The broken period has already elapsed; only the backoff history is kept.
+    fn("https://hostname1:1", "clear|0|0|broken;0;3");
+  }));
+  initialize();
+
+  EXPECT_FALSE(protocols_->getOrCreateHttp3StatusTracker(origin1_).isHttp3Broken());
+  EXPECT_FALSE(protocols_->getOrCreateHttp3StatusTracker(origin1_).hasHttp3FailedRecently());
+}
+
+TEST_F(HttpServerPropertiesCacheImplTest, CacheLoadInvalidHttp3Status) {
+  EXPECT_CALL(*store_, iterate(_)).WillOnce(Invoke([&](KeyValueStore::ConstIterateCb fn) {
+    fn("https://hostname1:1", "clear|0|0|bogus");
+  }));
+
+  EXPECT_LOG_CONTAINS("warn", "Unable to parse cache entry with key: https://hostname1:1",
+                      { initialize(); });
+  EXPECT_EQ(0, protocols_->size());
+}
+
 TEST_F(HttpServerPropertiesCacheImplTest, CanonicalSuffix) {
   std::string suffix = ".example.com";
   std::string host1 = "first.example.com";
@@ -0,0 +1,106 @@
+#include "source/common/http/route_memoization_cache.h"
+
+#include "test/mocks/router/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Http {
+namespace {
+
+Router::ConfigConstSharedPtr makeConfig() {
+  return std::make_shared<testing::NiceMock<Router::MockConfig>>();
+}
+
+Router::RouteConstSharedPtr makeRoute() {
+  return std::make_shared<testing::NiceMock<Router::MockRoute>>();
+}
+
+TestRequestHeaderMapImpl makeHeaders(const std::string& method, const std::string& authority,
+                                     const std::string& path) {
+  return TestRequestHeaderMapImpl{{":method", method}, {":authority", authority}, {":path", path}};
+}
+
+TEST(RouteMemoizationCacheTest, MissThenHit) {
+  RouteMemoizationCache cache(4);
+  const Router::ConfigConstSharedPtr config = makeConfig();
+  const Router::RouteConstSharedPtr route = makeRoute();
+  const auto headers = makeHeaders("GET", "host.com", "/foo");
+
+  EXPECT_EQ(nullptr, cache.lookup(config, headers));
+  cache.insert(config, headers, route);
+  EXPECT_EQ(route, cache.lookup(config, headers));
+}
+
+TEST(RouteMemoizationCacheTest, KeyIncludesMethodAuthorityAndPath) {
+  RouteMemoizationCache cache(4);
+  const Router::ConfigConstSharedPtr config = makeConfig();
+  const Router::RouteConstSharedPtr route = makeRoute();
+  cache.insert(config, makeHeaders("GET", "host.com", "/foo"), route);
+
+  EXPECT_EQ(route, cache.lookup(config, makeHeaders("GET", "host.com", "/foo")));
+  EXPECT_EQ(nullptr, cache.lookup(config, makeHeaders("POST", "host.com", "/foo")));
+  EXPECT_EQ(nullptr, cache.lookup(config, makeHeaders("GET", "other.com", "/foo")));
+  EXPECT_EQ(nullptr, cache.lookup(config, makeHeaders("GET", "host.com", "/bar")));
+}
+
+TEST(RouteMemoizationCacheTest, ReplacedConfigInvalidatesEntry) {
+  RouteMemoizationCache cache(4);
+  const Router::ConfigConstSharedPtr old_config = makeConfig();
+  const Router::ConfigConstSharedPtr new_config = makeConfig();
+  const Router::RouteConstSharedPtr route = makeRoute();
+  const auto headers = makeHeaders("GET", "host.com", "/foo");
+
+  cache.insert(old_config, headers, route);
+  // A lookup under the new configuration misses and drops the stale entry, so
+  // even the old configuration no longer hits.
+  EXPECT_EQ(nullptr, cache.lookup(new_config, headers));
+  EXPECT_EQ(nullptr, cache.lookup(old_config, headers));
+}
+
+TEST(RouteMemoizationCacheTest, DestroyedConfigInvalidatesEntry) {
+  RouteMemoizationCache cache(4);
+  Router::ConfigConstSharedPtr config = makeConfig();
+  const Router::ConfigConstSharedPtr other_config = makeConfig();
+  const Router::RouteConstSharedPtr route = makeRoute();
+  const auto headers = makeHeaders("GET", "host.com", "/foo");
+
+  cache.insert(config, headers, route);
+  config.reset();
+  EXPECT_EQ(nullptr, cache.lookup(other_config, headers));
+}
+
+TEST(RouteMemoizationCacheTest, EvictsLeastRecentlyUsed) {
+  RouteMemoizationCache cache(2);
+  const Router::ConfigConstSharedPtr config = makeConfig();
+  const Router::RouteConstSharedPtr route_a = makeRoute();
+  const Router::RouteConstSharedPtr route_b = makeRoute();
+  const Router::RouteConstSharedPtr route_c = makeRoute();
+
+  cache.insert(config, makeHeaders("GET", "host.com", "/a"), route_a);
+  cache.insert(config, makeHeaders("GET", "host.com", "/b"), route_b);
+  // Touch /a so that /b becomes the least recently used entry.
+  EXPECT_EQ(route_a, cache.lookup(config, makeHeaders("GET", "host.com", "/a")));
+  cache.insert(config, makeHeaders("GET", "host.com", "/c"), route_c);
+
+  EXPECT_EQ(route_a, cache.lookup(config, makeHeaders("GET", "host.com", "/a")));
+  EXPECT_EQ(nullptr, cache.lookup(config, makeHeaders("GET", "host.com", "/b")));
+  EXPECT_EQ(route_c, cache.lookup(config, makeHeaders("GET", "host.com", "/c")));
+}
+
+TEST(RouteMemoizationCacheTest, ReinsertReplacesExistingEntry) {
+  RouteMemoizationCache cache(4);
+  const Router::ConfigConstSharedPtr config = makeConfig();
+  const Router::RouteConstSharedPtr old_route = makeRoute();
+  const Router::RouteConstSharedPtr new_route = makeRoute();
+  const auto headers = makeHeaders("GET", "host.com", "/foo");
+
+  cache.insert(config, headers, old_route);
+  cache.insert(config, headers, new_route);
+  EXPECT_EQ(new_route, cache.lookup(config, headers));
+}
+
+} // namespace
+} // namespace Http
+} // namespace Envoy
@@ -10,6 +10,7 @@
 using testing::DoAll;
 using testing::Invoke;
 using testing::NiceMock;
+using testing::Return;
 using testing::ReturnNew;
 using testing::SaveArg;
 
@@ -93,6 +94,155 @@ TEST(IoUringWorkerImplTest, DelaySubmit) {
   EXPECT_CALL(dispatcher, clearDeferredDeleteList());
 }
 
+TEST(IoUringWorkerImplTest, AcceptSocketAcceptsAndRearms) {
+  Event::MockDispatcher dispatcher;
+  IoUringPtr io_uring_instance = std::make_unique<NiceMock<MockIoUring>>();
+  MockIoUring& mock_io_uring = *dynamic_cast<MockIoUring*>(io_uring_instance.get());
+  Event::FileReadyCb file_event_callback;
+
+  EXPECT_CALL(mock_io_uring, registerEventfd());
+  EXPECT_CALL(dispatcher,
+              createFileEvent_(_, _, Event::PlatformDefaultTriggerType, Event::FileReadyType::Read))
+      .WillOnce(
+          DoAll(SaveArg<1>(&file_event_callback), ReturnNew<NiceMock<Event::MockFileEvent>>()));
+  IoUringWorkerTestImpl worker(std::move(io_uring_instance), dispatcher);
+
+  // Adding the socket puts the configured number of accept requests on the ring.
+  os_fd_t fd = 11;
+  NiceMock<MockIoUringHandler> handler;
+  std::vector<Request*> accept_reqs;
+  EXPECT_CALL(mock_io_uring, prepareAccept(fd, _, _, _))
+      .WillRepeatedly(Invoke([&](os_fd_t, struct sockaddr*, socklen_t*, Request* req) {
+        accept_reqs.push_back(req);
+        return IoUringResult::Ok;
+      }));
+  auto& socket = worker.addAcceptSocket(fd, handler);
+  EXPECT_EQ(5, accept_reqs.size());
+
+  // A completed accept hands the connection to the handler and a replacement request
+  // is put on the ring.
+  const os_fd_t connection_fd = 22;
+  EXPECT_CALL(handler, onAcceptSocket(_)).WillOnce(Invoke([&](AcceptedSocketParam& param) {
+    EXPECT_EQ(connection_fd, param.fd_);
+  }));
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_)).WillOnce(Invoke([&](CompletionCb cb) {
+    cb(accept_reqs[0], connection_fd, false);
+  }));
+  file_event_callback(Event::FileReadyType::Read);
+  EXPECT_EQ(6, accept_reqs.size());
+
+  // close() cancels the outstanding accepts and, once they have all completed, closes
+  // the fd through the ring.
+  std::vector<Request*> cancel_reqs;
+  EXPECT_CALL(mock_io_uring, prepareCancel(_, _)).Times(5).WillRepeatedly(Invoke([&](Request*,
+                                                                                     Request* req) {
+    cancel_reqs.push_back(req);
+    return IoUringResult::Ok;
+  }));
+  socket.close();
+
+  Request* close_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareClose(fd, _))
+      .WillOnce(DoAll(SaveArg<1>(&close_req), Return(IoUringResult::Ok)));
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_)).WillOnce(Invoke([&](CompletionCb cb) {
+    for (Request* req : cancel_reqs) {
+      cb(req, 0, false);
+    }
+    for (size_t i = 1; i < accept_reqs.size(); i++) {
+      cb(accept_reqs[i], -ECANCELED, false);
+    }
+  }));
+  file_event_callback(Event::FileReadyType::Read);
+
+  EXPECT_CALL(mock_io_uring, removeInjectedCompletion(fd));
+  EXPECT_CALL(dispatcher, deferredDelete_);
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_)).WillOnce(Invoke([&](CompletionCb cb) {
+    cb(close_req, 0, false);
+  }));
+  file_event_callback(Event::FileReadyType::Read);
+  EXPECT_EQ(0, worker.getNumOfSockets());
+  EXPECT_CALL(dispatcher, clearDeferredDeleteList());
+}
+
+TEST(IoUringWorkerImplTest, ServerSocketReadsAndWrites) {
+  Event::MockDispatcher dispatcher;
+  IoUringPtr io_uring_instance = std::make_unique<NiceMock<MockIoUring>>();
+  MockIoUring& mock_io_uring = *dynamic_cast<MockIoUring*>(io_uring_instance.get());
+  Event::FileReadyCb file_event_callback;
+
+  EXPECT_CALL(mock_io_uring, registerEventfd());
+  EXPECT_CALL(dispatcher,
+              createFileEvent_(_, _, Event::PlatformDefaultTriggerType, Event::FileReadyType::Read))
+      .WillOnce(
+          DoAll(SaveArg<1>(&file_event_callback), ReturnNew<NiceMock<Event::MockFileEvent>>()));
+  IoUringWorkerTestImpl worker(std::move(io_uring_instance), dispatcher);
+
+  // Adding the socket puts a read request on the ring.
+  os_fd_t fd = 11;
+  NiceMock<MockIoUringHandler> handler;
+  Request* read_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareReadv(fd, _, 1, 0, _))
+      .WillOnce(DoAll(SaveArg<4>(&read_req), Return(IoUringResult::Ok)));
+  auto& socket = worker.addServerSocket(fd, handler, 8192);
+
+  // A completed read delivers the gathered data to the handler and re-arms the read.
+  const std::string data = "hello";
+  memcpy(static_cast<ReadRequest*>(read_req)->buf_.get(), data.data(), data.size());
+  Request* rearmed_read_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareReadv(fd, _, 1, 0, _))
+      .WillOnce(DoAll(SaveArg<4>(&rearmed_read_req), Return(IoUringResult::Ok)));
+  EXPECT_CALL(handler, onRead(_)).WillOnce(Invoke([&](ReadParam& param) {
+    EXPECT_EQ(data, param.buf_.toString());
+    EXPECT_EQ(5, param.result_);
+    param.buf_.drain(param.buf_.length());
+  }));
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_)).WillOnce(Invoke([&](CompletionCb cb) {
+    cb(read_req, data.size(), false);
+  }));
+  file_event_callback(Event::FileReadyType::Read);
+
+  // write() buffers the data in the socket and puts a writev request on the ring.
+  Buffer::OwnedImpl out("world");
+  Request* write_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareWritev(fd, _, 1, 0, _))
+      .WillOnce(DoAll(SaveArg<4>(&write_req), Return(IoUringResult::Ok)));
+  socket.write(out);
+  EXPECT_EQ(0, out.length());
+
+  EXPECT_CALL(handler, onWrite(_)).WillOnce(Invoke([](WriteParam& param) {
+    EXPECT_EQ(5, param.result_);
+  }));
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_)).WillOnce(Invoke([&](CompletionCb cb) {
+    cb(write_req, 5, false);
+  }));
+  file_event_callback(Event::FileReadyType::Read);
+
+  // close() cancels the outstanding read and closes the fd through the ring once it has
+  // completed.
+  Request* cancel_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareCancel(rearmed_read_req, _))
+      .WillOnce(DoAll(SaveArg<1>(&cancel_req), Return(IoUringResult::Ok)));
+  socket.close();
+
+  Request* close_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareClose(fd, _))
+      .WillOnce(DoAll(SaveArg<1>(&close_req), Return(IoUringResult::Ok)));
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_)).WillOnce(Invoke([&](CompletionCb cb) {
+    cb(cancel_req, 0, false);
+    cb(rearmed_read_req, -ECANCELED, false);
+  }));
+  file_event_callback(Event::FileReadyType::Read);
+
+  EXPECT_CALL(mock_io_uring, removeInjectedCompletion(fd));
+  EXPECT_CALL(dispatcher, deferredDelete_);
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_)).WillOnce(Invoke([&](CompletionCb cb) {
+    cb(close_req, 0, false);
+  }));
+  file_event_callback(Event::FileReadyType::Read);
+  EXPECT_EQ(0, worker.getNumOfSockets());
+  EXPECT_CALL(dispatcher, clearDeferredDeleteList());
+}
+
 } // namespace
 } // namespace Io
 } // namespace Envoy
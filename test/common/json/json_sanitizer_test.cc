@@ -133,6 +133,21 @@ TEST_F(JsonSanitizerTest, Interspersed) {
   EXPECT_EQ("\\ra\\f", sanitizeAndCheckAgainstProtobufJson("\ra\f"));
 }
 
+TEST_F(JsonSanitizerTest, WordBoundaries) {
+  // The scan that decides whether any escaping is needed classifies 8 bytes
+  // per operation, so cover strings longer than a word with the character
+  // requiring an escape placed at every offset, including the sub-word tail.
+  const std::string clean(20, 'a');
+  expectUnchanged(clean);
+  for (size_t i = 0; i < clean.size(); ++i) {
+    for (char c : {'"', '\\', '\b', '\x1f'}) {
+      std::string str = clean;
+      str[i] = c;
+      sanitizeAndCheckAgainstProtobufJson(str);
+    }
+  }
+}
+
 TEST_F(JsonSanitizerTest, AllTwoByteUtf8) {
   char buf[2];
   absl::string_view utf8(buf, 2);
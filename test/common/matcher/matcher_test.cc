@@ -308,6 +308,90 @@ TEST_F(MatcherTest, InvalidDataInputInAndMatcher) {
   EXPECT_THROW_WITH_MESSAGE(factory_.create(matcher)(), EnvoyException, error_message);
 }
 
+// A "string" DataInput factory that counts config translations and input instantiations, used
+// to verify that identical input configs are deduplicated during tree construction.
+class CountingDataInputStringFactory : public DataInputFactory<TestData> {
+public:
+  explicit CountingDataInputStringFactory(absl::string_view data)
+      : data_(std::string(data)), injection_(*this) {}
+  DataInputFactoryCb<TestData>
+  createDataInputFactoryCb(const Protobuf::Message&, ProtobufMessage::ValidationVisitor&) override {
+    ++config_count_;
+    return [this]() {
+      ++input_count_;
+      return std::make_unique<TestInput>(
+          DataInputGetResult{DataInputGetResult::DataAvailability::AllDataAvailable, data_});
+    };
+  }
+
+  ProtobufTypes::MessagePtr createEmptyConfigProto() override {
+    return std::make_unique<ProtobufWkt::StringValue>();
+  }
+  std::string name() const override { return "string"; }
+
+  const std::string data_;
+  uint32_t config_count_{0};
+  uint32_t input_count_{0};
+  Registry::InjectFactory<DataInputFactory<TestData>> injection_;
+};
+
+TEST_F(MatcherTest, DeduplicatesIdenticalDataInputs) {
+  const std::string yaml = R"EOF(
+matcher_list:
+  matchers:
+  - on_match:
+      action:
+        name: test_action
+        typed_config:
+          "@type": type.googleapis.com/google.protobuf.StringValue
+          value: bar matched
+    predicate:
+      single_predicate:
+        input:
+          name: inner_input
+          typed_config:
+            "@type": type.googleapis.com/google.protobuf.StringValue
+        value_match:
+          exact: bar
+  - on_match:
+      action:
+        name: test_action
+        typed_config:
+          "@type": type.googleapis.com/google.protobuf.StringValue
+          value: foo matched
+    predicate:
+      single_predicate:
+        input:
+          name: inner_input
+          typed_config:
+            "@type": type.googleapis.com/google.protobuf.StringValue
+        value_match:
+          exact: foo
+  )EOF";
+
+  envoy::config::common::matcher::v3::Matcher matcher;
+  MessageUtil::loadFromYaml(yaml, matcher, ProtobufMessage::getStrictValidationVisitor());
+
+  TestUtility::validate(matcher);
+
+  CountingDataInputStringFactory input_factory("foo");
+
+  // Validation still runs once per occurrence even though the input config is only unpacked once.
+  EXPECT_CALL(validation_visitor_,
+              performDataInputValidation(_, "type.googleapis.com/google.protobuf.StringValue"))
+      .Times(2);
+  auto match_tree = factory_.create(matcher);
+
+  const auto result = match_tree()->match(TestData());
+  EXPECT_EQ(result.match_state_, MatchState::MatchComplete);
+  EXPECT_TRUE(result.on_match_.has_value());
+  EXPECT_NE(result.on_match_->action_cb_, nullptr);
+
+  // Both predicates are backed by a single shared input instance.
+  EXPECT_EQ(1, input_factory.config_count_);
+  EXPECT_EQ(1, input_factory.input_count_);
+}
+
 TEST_F(MatcherTest, TestAnyMatcher) {
   const std::string yaml = R"EOF(
 on_no_match:
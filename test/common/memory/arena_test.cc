@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "source/common/memory/arena.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Memory {
+namespace {
+
+struct DestructionRecorder {
+  explicit DestructionRecorder(std::vector<int>& order, int id) : order_(order), id_(id) {}
+  ~DestructionRecorder() { order_.push_back(id_); }
+
+  std::vector<int>& order_;
+  const int id_;
+};
+
+TEST(ArenaTest, AllocateAligned) {
+  Arena arena;
+  void* a = arena.allocate(1, 1);
+  void* b = arena.allocate(8, 8);
+  void* c = arena.allocate(16, 16);
+  EXPECT_NE(a, nullptr);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(b) % 8);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(c) % 16);
+}
+
+TEST(ArenaTest, DestructorsRunInReverseOrder) {
+  std::vector<int> order;
+  {
+    Arena arena;
+    arena.make<DestructionRecorder>(order, 1);
+    arena.make<DestructionRecorder>(order, 2);
+    arena.make<DestructionRecorder>(order, 3);
+    EXPECT_TRUE(order.empty());
+  }
+  EXPECT_EQ((std::vector<int>{3, 2, 1}), order);
+}
+
+TEST(ArenaTest, MakeUniqueRunsDestructorOnReset) {
+  std::vector<int> order;
+  Arena arena;
+  {
+    ArenaPtr<DestructionRecorder> ptr = arena.makeUnique<DestructionRecorder>(order, 1);
+    EXPECT_TRUE(order.empty());
+  }
+  EXPECT_EQ((std::vector<int>{1}), order);
+}
+
+TEST(ArenaTest, GrowsBeyondOneChunk) {
+  Arena arena(64);
+  for (int i = 0; i < 100; i++) {
+    void* p = arena.allocate(32);
+    ASSERT_NE(p, nullptr);
+    // Scribble over the allocation to make sure the storage is usable.
+    memset(p, 0xab, 32);
+  }
+  EXPECT_GE(arena.bytesAllocatedForTest(), 100 * 32);
+}
+
+TEST(ArenaTest, LargeAllocationGetsDedicatedChunk) {
+  Arena arena(64);
+  void* p = arena.allocate(4096);
+  ASSERT_NE(p, nullptr);
+  memset(p, 0xcd, 4096);
+  EXPECT_GE(arena.bytesAllocatedForTest(), 4096);
+}
+
+} // namespace
+} // namespace Memory
+} // namespace Envoy
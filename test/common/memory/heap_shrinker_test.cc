@@ -83,6 +83,28 @@ TEST_F(HeapShrinkerTest, ShrinkWhenTriggered) {
   EXPECT_EQ(2, shrink_count.value());
 }
 
+TEST_F(HeapShrinkerTest, ShrinkGraduallyWhenScaling) {
+  Server::OverloadActionCb action_cb;
+  EXPECT_CALL(overload_manager_, registerForAction(_, _, _))
+      .WillOnce(Invoke([&](const std::string&, Event::Dispatcher&, Server::OverloadActionCb cb) {
+        action_cb = cb;
+        return true;
+      }));
+
+  HeapShrinker h(dispatcher_, overload_manager_, *stats_.rootScope());
+
+  Envoy::Stats::Counter& shrink_count =
+      stats_.counter("overload.envoy.overload_actions.shrink_heap.shrink_count");
+  action_cb(Server::OverloadActionState(UnitFloat(0.5f)));
+  step();
+  step();
+  EXPECT_EQ(2, shrink_count.value());
+
+  action_cb(Server::OverloadActionState::inactive());
+  step();
+  EXPECT_EQ(2, shrink_count.value());
+}
+
 } // namespace
 } // namespace Memory
 } // namespace Envoy
@@ -1,3 +1,5 @@
+#include <fcntl.h>
+
 #include "source/common/common/utility.h"
 #include "source/common/network/address_impl.h"
 #include "source/common/network/io_socket_error_impl.h"
@@ -154,6 +156,42 @@ TEST(IoSocketHandleImpl, NullptrIfaddrs) {
   EXPECT_FALSE(maybe_interface_name.has_value());
 }
 
+// Test that sendFile() hands a file range to the kernel and the bytes arrive on the peer
+// socket, without the data ever being staged in a userspace buffer.
+TEST(IoSocketHandleImpl, SendFileTransfersFileContents) {
+  auto& os_sys_calls = Api::OsSysCallsSingleton::get();
+  if (!os_sys_calls.supportsSendfile()) {
+    GTEST_SKIP() << "sendfile not supported on this platform";
+  }
+
+  const std::string contents = "hello sendfile world";
+  const std::string path =
+      TestEnvironment::writeStringToFileForTest("sendfile_payload", contents, true);
+  const int file_fd = ::open(path.c_str(), O_RDONLY); // NOLINT(android-cloexec-open)
+  ASSERT_GE(file_fd, 0);
+
+  os_fd_t fds[2] = {0, 0};
+  ASSERT_EQ(os_sys_calls.socketpair(AF_UNIX, SOCK_STREAM, 0, fds).return_value_, 0);
+  IoSocketHandleImpl io_handle(fds[0]);
+  EXPECT_TRUE(io_handle.supportsSendfile());
+
+  // Skip the first byte of the file and verify that the offset is advanced on success.
+  off_t offset = 1;
+  const Api::IoCallUint64Result result =
+      io_handle.sendFile(file_fd, offset, contents.size() - 1);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(contents.size() - 1, result.return_value_);
+  EXPECT_EQ(static_cast<off_t>(contents.size()), offset);
+
+  std::string received(contents.size() - 1, '\0');
+  const ssize_t rc = os_sys_calls.recv(fds[1], received.data(), received.size(), 0).return_value_;
+  ASSERT_EQ(static_cast<ssize_t>(received.size()), rc);
+  EXPECT_EQ(contents.substr(1), received);
+
+  ::close(file_fd);
+  os_sys_calls.close(fds[1]);
+}
+
 class IoSocketHandleImplTest : public testing::TestWithParam<Network::Address::IpVersion> {};
 INSTANTIATE_TEST_SUITE_P(IpVersions, IoSocketHandleImplTest,
                          testing::ValuesIn(TestEnvironment::getIpVersionsForTest()),
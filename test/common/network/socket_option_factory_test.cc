@@ -1,3 +1,7 @@
+#if defined(__linux__)
+#include <linux/filter.h>
+#endif
+
 #include "envoy/config/core/v3/base.pb.h"
 
 #include "source/common/network/address_impl.h"
@@ -193,6 +197,51 @@ TEST_F(SocketOptionFactoryTest, TestBuildZeroSoLingerOptions) {
   EXPECT_EQ(linger_bstr, option_details->value_);
 }
 
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(__linux__)
+TEST_F(SocketOptionFactoryTest, TestBuildCpuPinnedReusePortOptions) {
+  // use a shared_ptr due to applyOptions requiring one
+  std::shared_ptr<Socket::Options> options =
+      SocketOptionFactory::buildCpuPinnedReusePortOptions(4);
+  ASSERT_EQ(1, options->size());
+
+  EXPECT_CALL(socket_mock_, setSocketOption(_, _, _, sizeof(sock_fprog)))
+      .WillOnce(Invoke([](int input_type, int input_option, const void* optval,
+                          socklen_t) -> Api::SysCallIntResult {
+        EXPECT_EQ(SOL_SOCKET, input_type);
+        EXPECT_EQ(SO_ATTACH_REUSEPORT_CBPF, input_option);
+        const auto* prog = static_cast<const sock_fprog*>(optval);
+        EXPECT_EQ(3, prog->len);
+        // ld cpu; mod #concurrency; ret a.
+        EXPECT_EQ(BPF_LD | BPF_W | BPF_ABS, prog->filter[0].code);
+        EXPECT_EQ(static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU), prog->filter[0].k);
+        EXPECT_EQ(BPF_ALU | BPF_MOD | BPF_K, prog->filter[1].code);
+        EXPECT_EQ(4, prog->filter[1].k);
+        EXPECT_EQ(BPF_RET | BPF_A, prog->filter[2].code);
+        return {0, 0};
+      }));
+  EXPECT_TRUE(Network::Socket::applyOptions(options, socket_mock_,
+                                            envoy::config::core::v3::SocketOption::STATE_BOUND));
+}
+
+TEST_F(SocketOptionFactoryTest, TestBuildCpuPinnedReusePortOptionsZeroConcurrency) {
+  // A zero concurrency is clamped to a group size of 1 rather than emitting a division by zero
+  // into the filter.
+  std::shared_ptr<Socket::Options> options =
+      SocketOptionFactory::buildCpuPinnedReusePortOptions(0);
+  ASSERT_EQ(1, options->size());
+
+  EXPECT_CALL(socket_mock_, setSocketOption(_, _, _, sizeof(sock_fprog)))
+      .WillOnce(Invoke([](int, int, const void* optval, socklen_t) -> Api::SysCallIntResult {
+        const auto* prog = static_cast<const sock_fprog*>(optval);
+        EXPECT_EQ(3, prog->len);
+        EXPECT_EQ(1, prog->filter[1].k);
+        return {0, 0};
+      }));
+  EXPECT_TRUE(Network::Socket::applyOptions(options, socket_mock_,
+                                            envoy::config::core::v3::SocketOption::STATE_BOUND));
+}
+#endif
+
 } // namespace
 } // namespace Network
 } // namespace Envoy
@@ -0,0 +1,238 @@
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+// QUICHE allows unused parameters.
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+// QUICHE uses offsetof().
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#pragma GCC diagnostic ignored "-Wtype-limits"
+
+#include "quiche/quic/test_tools/quic_mock_syscall_wrapper.h"
+
+#pragma GCC diagnostic pop
+#else
+#include "quiche/quic/test_tools/quic_mock_syscall_wrapper.h"
+#endif
+
+#include "envoy/config/core/v3/base.pb.h"
+
+#include "source/common/network/address_impl.h"
+#include "source/common/network/socket_option_factory.h"
+#include "source/common/network/socket_option_impl.h"
+#include "source/common/network/udp_listener_impl.h"
+#include "source/common/network/utility.h"
+
+#include "source/common/quic/udp_sendmmsg_batch_writer.h"
+
+#include "test/common/network/udp_listener_impl_test_base.h"
+#include "test/mocks/api/mocks.h"
+#include "test/mocks/network/mocks.h"
+#include "test/mocks/server/mocks.h"
+#include "test/test_common/environment.h"
+#include "test/test_common/network_utility.h"
+#include "test/test_common/threadsafe_singleton_injector.h"
+#include "test/test_common/utility.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::Invoke;
+using testing::ReturnRef;
+
+namespace Envoy {
+namespace Network {
+namespace {
+
+class UdpListenerImplSendmmsgWriterTest : public UdpListenerImplTestBase {
+public:
+  void SetUp() override {
+    // Set listening socket options and set UdpSendmmsgBatchWriter
+    server_socket_->addOptions(SocketOptionFactory::buildIpPacketInfoOptions());
+    server_socket_->addOptions(SocketOptionFactory::buildRxQueueOverFlowOptions());
+    listener_ = std::make_unique<UdpListenerImpl>(
+        dispatcherImpl(), server_socket_, listener_callbacks_, dispatcherImpl().timeSource(),
+        envoy::config::core::v3::UdpSocketConfig());
+    udp_packet_writer_ = std::make_unique<Quic::UdpSendmmsgBatchWriter>(
+        server_socket_->ioHandle(), listener_config_.listenerScope());
+    ON_CALL(listener_callbacks_, udpPacketWriter()).WillByDefault(ReturnRef(*udp_packet_writer_));
+  }
+
+  uint64_t internalBufferSize() {
+    return listener_config_.listenerScope()
+        .gaugeFromString("internal_buffer_size", Stats::Gauge::ImportMode::NeverImport)
+        .value();
+  }
+
+  uint64_t totalBytesSent() {
+    return listener_config_.listenerScope().counterFromString("total_bytes_sent").value();
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(IpVersions, UdpListenerImplSendmmsgWriterTest,
+                         testing::ValuesIn(TestEnvironment::getIpVersionsForTest()),
+                         TestUtility::ipTestParamsToString);
+
+/**
+ * Tests that packets written through the sendmmsg batch writer are buffered
+ * rather than sent immediately:
+ *  1. Send several payloads to a client.
+ *     - Verify each send reports the full payload length but only grows the
+ *       internal_buffer_size gauge; total_bytes_sent stays unchanged.
+ *  2. Call the writer's external flush().
+ *     - Verify the internal buffer is emptied and total_bytes_sent accounts
+ *       for all buffered payloads.
+ */
+TEST_P(UdpListenerImplSendmmsgWriterTest, SendData) {
+  EXPECT_TRUE(udp_packet_writer_->isBatchMode());
+  Address::InstanceConstSharedPtr send_from_addr = getNonDefaultSourceAddress();
+
+  absl::FixedArray<std::string> payloads{"length7", "length<7", "len<7"};
+  const uint64_t initial_bytes_sent = totalBytesSent();
+  uint64_t buffered_bytes = 0;
+
+  for (const auto& payload : payloads) {
+    Buffer::InstancePtr buffer(new Buffer::OwnedImpl());
+    buffer->add(payload);
+    UdpSendData send_data{send_from_addr->ip(), *client_.localAddress(), *buffer};
+
+    auto send_result = listener_->send(send_data);
+    EXPECT_TRUE(send_result.ok()) << "send() failed : " << send_result.err_->getErrorDetails();
+    EXPECT_EQ(send_result.return_value_, payload.length());
+
+    // Unlike the GSO writer there is no segment size constraint: every packet
+    // is buffered until the batch is flushed.
+    buffered_bytes += payload.length();
+    EXPECT_EQ(internalBufferSize(), buffered_bytes);
+    EXPECT_EQ(totalBytesSent(), initial_bytes_sent);
+  }
+
+  // Test External Flush
+  auto flush_result = udp_packet_writer_->flush();
+  EXPECT_TRUE(flush_result.ok());
+  EXPECT_EQ(internalBufferSize(), 0);
+  EXPECT_EQ(totalBytesSent(), initial_bytes_sent + buffered_bytes);
+}
+
+/**
+ * Tests the buffered packet accounting in writePacket() when the internal
+ * batch buffer fills up and WritePacket() flushes on its own: at every step
+ * the bytes buffered plus the bytes sent must equal the bytes written, and
+ * writing well past the batch buffer capacity must have produced at least one
+ * internal flush.
+ */
+TEST_P(UdpListenerImplSendmmsgWriterTest, InternalFlushOnFullBuffer) {
+  Address::InstanceConstSharedPtr send_from_addr = getNonDefaultSourceAddress();
+
+  // The QuicBatchWriterBuffer holds 64KB, so writing 70KB must force at least
+  // one flush from within writePacket().
+  const std::string payload(1000, 'a');
+  const uint64_t initial_bytes_sent = totalBytesSent();
+  uint64_t total_bytes_written = 0;
+
+  for (int i = 0; i < 70; ++i) {
+    Buffer::InstancePtr buffer(new Buffer::OwnedImpl());
+    buffer->add(payload);
+    UdpSendData send_data{send_from_addr->ip(), *client_.localAddress(), *buffer};
+
+    auto send_result = listener_->send(send_data);
+    EXPECT_TRUE(send_result.ok()) << "send() failed : " << send_result.err_->getErrorDetails();
+    EXPECT_EQ(send_result.return_value_, payload.length());
+
+    total_bytes_written += payload.length();
+    EXPECT_EQ(internalBufferSize() + (totalBytesSent() - initial_bytes_sent),
+              total_bytes_written);
+  }
+  EXPECT_GT(totalBytesSent(), initial_bytes_sent);
+
+  auto flush_result = udp_packet_writer_->flush();
+  EXPECT_TRUE(flush_result.ok());
+  EXPECT_EQ(internalBufferSize(), 0);
+  EXPECT_EQ(totalBytesSent(), initial_bytes_sent + total_bytes_written);
+}
+
+/**
+ * Tests error handling on flush:
+ * 1. Buffer a payload, then have sendmmsg return EWOULDBLOCK.
+ *    - flush() must surface EAGAIN, mark the writer blocked and keep the
+ *      payload buffered.
+ * 2. Have sendmmsg fail with ECONNRESET.
+ *    - flush() must surface the error code and keep the payload buffered.
+ * 3. Let sendmmsg succeed.
+ *    - flush() drains the batch, clears the blocked state and updates
+ *      total_bytes_sent.
+ */
+TEST_P(UdpListenerImplSendmmsgWriterTest, FlushBlockedAndErrorCodes) {
+  // Quic Mock Objects
+  quic::test::MockQuicSyscallWrapper os_sys_calls;
+  quic::ScopedGlobalSyscallWrapperOverride os_calls(&os_sys_calls);
+
+  const std::string payload("length7");
+  const uint64_t initial_bytes_sent = totalBytesSent();
+
+  // Buffering does not hit the socket, so no syscall expectation is needed.
+  Buffer::InstancePtr buffer(new Buffer::OwnedImpl());
+  buffer->add(payload);
+  UdpSendData send_data{send_to_addr_->ip(),
+                        *server_socket_->connectionInfoProvider().localAddress(), *buffer};
+  auto send_result = listener_->send(send_data);
+  EXPECT_TRUE(send_result.ok());
+  EXPECT_EQ(send_result.return_value_, payload.length());
+  EXPECT_EQ(internalBufferSize(), payload.length());
+
+  // Mock the socket to be write blocked on the sendmmsg syscall.
+  EXPECT_CALL(os_sys_calls, Sendmmsg(_, _, _, _))
+      .WillOnce(Invoke([](int /*sockfd*/, mmsghdr* /*msgvec*/, unsigned int /*vlen*/,
+                          int /*flags*/) {
+        errno = EWOULDBLOCK;
+        return -1;
+      }));
+  auto flush_result = udp_packet_writer_->flush();
+  EXPECT_FALSE(flush_result.ok());
+  EXPECT_EQ(flush_result.err_->getErrorCode(), Api::IoError::IoErrorCode::Again);
+  EXPECT_TRUE(udp_packet_writer_->isWriteBlocked());
+  EXPECT_EQ(internalBufferSize(), payload.length());
+  EXPECT_EQ(totalBytesSent(), initial_bytes_sent);
+
+  // A hard socket error must be converted to the matching IoError.
+  udp_packet_writer_->setWritable();
+  EXPECT_CALL(os_sys_calls, Sendmmsg(_, _, _, _))
+      .WillOnce(Invoke([](int /*sockfd*/, mmsghdr* /*msgvec*/, unsigned int /*vlen*/,
+                          int /*flags*/) {
+        errno = ECONNRESET;
+        return -1;
+      }));
+  flush_result = udp_packet_writer_->flush();
+  EXPECT_FALSE(flush_result.ok());
+  EXPECT_EQ(flush_result.err_->getErrorCode(), Api::IoError::IoErrorCode::ConnectionReset);
+  EXPECT_EQ(internalBufferSize(), payload.length());
+  EXPECT_EQ(totalBytesSent(), initial_bytes_sent);
+
+  // Once writable, flush() drains the buffered batch in one sendmmsg call.
+  udp_packet_writer_->setWritable();
+  EXPECT_CALL(os_sys_calls, Sendmmsg(_, _, _, _))
+      .WillOnce(Invoke(
+          [&](int /*sockfd*/, mmsghdr* msgvec, unsigned int vlen, int /*flags*/) {
+            EXPECT_EQ(vlen, 1);
+            for (unsigned int i = 0; i < vlen; ++i) {
+              size_t packet_length = 0;
+              for (size_t j = 0; j < msgvec[i].msg_hdr.msg_iovlen; ++j) {
+                packet_length += msgvec[i].msg_hdr.msg_iov[j].iov_len;
+              }
+              msgvec[i].msg_len = packet_length;
+            }
+            return static_cast<int>(vlen);
+          }));
+  flush_result = udp_packet_writer_->flush();
+  EXPECT_TRUE(flush_result.ok());
+  EXPECT_FALSE(udp_packet_writer_->isWriteBlocked());
+  EXPECT_EQ(internalBufferSize(), 0);
+  EXPECT_EQ(totalBytesSent(), initial_bytes_sent + payload.length());
+}
+
+} // namespace
+} // namespace Network
+} // namespace Envoy
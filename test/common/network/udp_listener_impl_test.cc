@@ -51,7 +51,7 @@ public:
 
 class UdpListenerImplTest : public UdpListenerImplTestBase {
 public:
-  void setup(bool prefer_gro = false) {
+  void setup(bool prefer_gro = false, bool prefer_gro_default = false) {
     ON_CALL(override_syscall_, supportsUdpGro()).WillByDefault(Return(false));
     // Return the real version by default.
     ON_CALL(override_syscall_, supportsMmsg())
@@ -77,9 +77,9 @@ public:
     if (prefer_gro) {
       config.mutable_prefer_gro()->set_value(prefer_gro);
     }
-    listener_ =
-        std::make_unique<UdpListenerImpl>(dispatcherImpl(), server_socket_, listener_callbacks_,
-                                          dispatcherImpl().timeSource(), config);
+    listener_ = std::make_unique<UdpListenerImpl>(dispatcherImpl(), server_socket_,
+                                                  listener_callbacks_, dispatcherImpl().timeSource(),
+                                                  config, prefer_gro_default);
     udp_packet_writer_ = std::make_unique<Network::UdpDefaultWriter>(server_socket_->ioHandle());
     int get_recvbuf_size = 0;
     socklen_t int_size = static_cast<socklen_t>(sizeof(get_recvbuf_size));
@@ -254,6 +254,29 @@ TEST_P(UdpListenerImplTest, GroLargeDatagramRecvmsg) {
   dispatcher_->run(Event::Dispatcher::RunType::Block);
   EXPECT_EQ(1, listener_->packetsDropped());
 }
+
+// Verify that a constructor-supplied GRO default applies when the socket config leaves
+// prefer_gro unset, as QUIC listeners do.
+TEST_P(UdpListenerImplTest, GroDefaultFromConstructor) {
+  setup(/*prefer_gro=*/false, /*prefer_gro_default=*/true);
+
+  ON_CALL(override_syscall_, supportsUdpGro()).WillByDefault(Return(true));
+  client_.write(std::string(32768, 'a'), *send_to_addr_);
+  const std::string second("second");
+  client_.write(second, *send_to_addr_);
+
+  EXPECT_CALL(listener_callbacks_, onReadReady());
+  EXPECT_CALL(listener_callbacks_, onDatagramsDropped(_)).Times(AtLeast(1));
+  EXPECT_CALL(listener_callbacks_, onData(_)).WillOnce(Invoke([&](const UdpRecvData& data) -> void {
+    validateRecvCallbackParams(data, 1);
+    EXPECT_EQ(data.buffer_->toString(), second);
+
+    dispatcher_->exit();
+  }));
+
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  EXPECT_EQ(1, listener_->packetsDropped());
+}
 #endif
 
 /**
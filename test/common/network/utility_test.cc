@@ -783,6 +783,31 @@ TEST(AbslUint128, TestByteOrder) {
   }
 }
 
+TEST(UdpRecvBufferPool, ReplenishOnlyReplacesConsumedSlots) {
+  UdpRecvBufferPool pool;
+  pool.replenish(DEFAULT_UDP_MAX_DATAGRAM_SIZE);
+  EXPECT_GE(pool.slice(0).len_, DEFAULT_UDP_MAX_DATAGRAM_SIZE);
+  void* first_slot_base = pool.slice(0).mem_;
+  void* second_slot_base = pool.slice(1).mem_;
+
+  Buffer::InstancePtr buffer = pool.commitAndTakeBuffer(0, 100);
+  EXPECT_EQ(100, buffer->length());
+
+  pool.replenish(DEFAULT_UDP_MAX_DATAGRAM_SIZE);
+  // Slot 0 handed its buffer off and got a fresh one; slot 1 kept its reservation.
+  EXPECT_NE(first_slot_base, pool.slice(0).mem_);
+  EXPECT_EQ(second_slot_base, pool.slice(1).mem_);
+}
+
+TEST(UdpRecvBufferPool, ReplenishRebuildsOnDatagramSizeChange) {
+  UdpRecvBufferPool pool;
+  pool.replenish(DEFAULT_UDP_MAX_DATAGRAM_SIZE);
+  EXPECT_GE(pool.slice(0).len_, DEFAULT_UDP_MAX_DATAGRAM_SIZE);
+
+  pool.replenish(9000);
+  EXPECT_GE(pool.slice(0).len_, 9000);
+}
+
 TEST(ResolvedUdpSocketConfig, Warning) {
   Api::MockOsSysCalls os_sys_calls;
   TestThreadsafeSingletonInjector<Api::OsSysCallsImpl> os_calls(&os_sys_calls);
@@ -10,6 +10,7 @@
 #include "test/common/quic/test_utils.h"
 #include "test/mocks/network/mocks.h"
 #include "test/mocks/ssl/mocks.h"
+#include "test/test_common/utility.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -138,6 +139,26 @@ private:
   Network::FilterChain& expected_filter_chain_;
 };
 
+// Wraps another signature callback and exits the dispatcher once it has run, so that tests can
+// block until a signature computed off the test thread has been delivered.
+class ExitingSignatureCallback : public quic::ProofSource::SignatureCallback {
+public:
+  ExitingSignatureCallback(Event::Dispatcher& dispatcher,
+                           std::unique_ptr<quic::ProofSource::SignatureCallback> delegate)
+      : dispatcher_(dispatcher), delegate_(std::move(delegate)) {}
+
+  // quic::ProofSource::SignatureCallback
+  void Run(bool ok, std::string signature,
+           std::unique_ptr<quic::ProofSource::Details> details) override {
+    delegate_->Run(ok, std::move(signature), std::move(details));
+    dispatcher_.exit();
+  }
+
+private:
+  Event::Dispatcher& dispatcher_;
+  std::unique_ptr<quic::ProofSource::SignatureCallback> delegate_;
+};
+
 class EnvoyQuicProofSourceTest : public ::testing::Test {
 public:
   EnvoyQuicProofSourceTest()
@@ -224,6 +245,51 @@ TEST_F(EnvoyQuicProofSourceTest, TestGetCerChainAndSignatureAndVerify) {
   verifier.verifyCertsAndSignature(chain, "payload", signature);
 }
 
+TEST_F(EnvoyQuicProofSourceTest, ComputeSignatureOffThread) {
+  Api::ApiPtr api = Api::createApiForTest();
+  Event::DispatcherPtr dispatcher = api->allocateDispatcher("test_thread");
+  proof_source_.enableOffThreadSigning(*dispatcher, api->threadFactory());
+
+  expectCertChainAndPrivateKey(expected_certs_, true);
+  bool cert_matched_sni;
+  quiche::QuicheReferenceCountedPointer<quic::ProofSource::Chain> chain =
+      proof_source_.GetCertChain(server_address_, client_address_, hostname_, &cert_matched_sni);
+  std::string signature;
+  proof_source_.ComputeTlsSignature(
+      server_address_, client_address_, hostname_, SSL_SIGN_RSA_PSS_RSAE_SHA256, "payload",
+      std::make_unique<ExitingSignatureCallback>(
+          *dispatcher, std::make_unique<TestSignatureCallback>(true, filter_chain_, signature)));
+  // The signature is computed on the signing thread and delivered via the dispatcher.
+  EXPECT_TRUE(signature.empty());
+  dispatcher->run(Event::Dispatcher::RunType::RunUntilExit);
+  SignatureVerifier verifier;
+  verifier.verifyCertsAndSignature(chain, "payload", signature);
+}
+
+// A second handshake with the same configured chain should get the cached parsed chain rather
+// than re-parsing the PEM.
+TEST_F(EnvoyQuicProofSourceTest, GetCertChainReusesParsedChain) {
+  EXPECT_CALL(listen_socket_, ioHandle()).Times(2);
+  EXPECT_CALL(filter_chain_manager_, findFilterChain(_, _)).WillRepeatedly(Return(&filter_chain_));
+  EXPECT_CALL(filter_chain_, transportSocketFactory())
+      .WillRepeatedly(ReturnRef(*transport_socket_factory_));
+  EXPECT_CALL(*mock_context_config_, isReady()).WillRepeatedly(Return(true));
+  std::vector<std::reference_wrapper<const Envoy::Ssl::TlsCertificateConfig>> tls_cert_configs{
+      std::reference_wrapper<const Envoy::Ssl::TlsCertificateConfig>(tls_cert_config_)};
+  EXPECT_CALL(*mock_context_config_, tlsCertificates()).WillRepeatedly(Return(tls_cert_configs));
+  EXPECT_CALL(tls_cert_config_, certificateChain())
+      .Times(2)
+      .WillRepeatedly(ReturnRef(expected_certs_));
+
+  bool cert_matched_sni;
+  quiche::QuicheReferenceCountedPointer<quic::ProofSource::Chain> chain1 =
+      proof_source_.GetCertChain(server_address_, client_address_, hostname_, &cert_matched_sni);
+  quiche::QuicheReferenceCountedPointer<quic::ProofSource::Chain> chain2 =
+      proof_source_.GetCertChain(server_address_, client_address_, hostname_, &cert_matched_sni);
+  ASSERT_NE(nullptr, chain1);
+  EXPECT_EQ(chain1.get(), chain2.get());
+}
+
 TEST_F(EnvoyQuicProofSourceTest, GetCertChainFailBadConfig) {
   // No filter chain.
   EXPECT_CALL(listen_socket_, ioHandle()).Times(3);
@@ -254,6 +254,28 @@ dynamic_route_configs:
   EXPECT_EQ(0, dump4.static_route_configs().size());
 }
 
+TEST_F(RdsConfigProviderManagerTest, IdenticalStaticConfigsShared) {
+  RouteConfigProviderSharedPtr provider1 = createStatic();
+  RouteConfigProviderSharedPtr provider2 = createStatic();
+  // Identical static route configurations compile to a single shared config.
+  EXPECT_EQ(provider1->config(), provider2->config());
+
+  // A different route configuration gets its own compiled config.
+  envoy::config::route::v3::RouteConfiguration other_route_config;
+  TestUtility::loadFromYaml("name: bar", other_route_config);
+  RouteConfigProviderSharedPtr provider3 =
+      manager_.createStaticRouteConfigProvider(other_route_config, server_factory_context_);
+  EXPECT_NE(provider1->config(), provider3->config());
+
+  // The cache holds only weak references, so creation still works after all providers sharing a
+  // given content have been destroyed.
+  provider1.reset();
+  provider2.reset();
+  RouteConfigProviderSharedPtr provider4 = createStatic();
+  EXPECT_NE(nullptr, provider4->config());
+  EXPECT_NE(provider3->config(), provider4->config());
+}
+
 TEST_F(RdsConfigProviderManagerTest, FailureInvalidResourceType) {
   RouteConfigProviderSharedPtr dynamic_provider = createDynamic();
 
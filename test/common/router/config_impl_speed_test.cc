@@ -140,6 +140,71 @@ BENCHMARK(bmRouteTableSizeWithPathPrefixMatch)->RangeMultiplier(2)->Ranges({{1,
 BENCHMARK(bmRouteTableSizeWithExactPathMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
 BENCHMARK(bmRouteTableSizeWithRegexMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
 
+/**
+ * Generates a route config with `num_vhosts` virtual hosts of `routes_per_vhost` prefix
+ * routes each. Every virtual host gets a single exact domain, vhost_<n>.example.com.
+ */
+static RouteConfiguration genMultiVhostRouteConfig(int num_vhosts, int routes_per_vhost) {
+  RouteConfiguration route_config;
+  for (int v = 0; v < num_vhosts; ++v) {
+    VirtualHost* v_host = route_config.add_virtual_hosts();
+    v_host->set_name(absl::StrCat("vhost_", v));
+    v_host->add_domains(absl::StrCat("vhost_", v, ".example.com"));
+    for (int i = 0; i < routes_per_vhost; ++i) {
+      Route* route = v_host->add_routes();
+      route->mutable_direct_response()->set_status(200);
+      route->mutable_match()->set_prefix(absl::StrCat("/shelves/shelf_", i, "/"));
+    }
+  }
+  return route_config;
+}
+
+/**
+ * Measure route matching across a config with many virtual hosts.
+ * Why? Large multi-tenant configs fan out by domain first; this isolates the cost of the
+ * exact-domain virtual host lookup relative to the linear route scan within the matched
+ * virtual host, so config-shape decisions (few big vhosts vs many small ones) can be
+ * data-driven.
+ *
+ * The request targets the last route of the last virtual host, the worst case for the
+ * route scan.
+ */
+static void bmRouteTableVirtualHostCount(benchmark::State& state) {
+  const int num_vhosts = state.range(0);
+  const int routes_per_vhost = state.range(1);
+
+  // Setup router for benchmarking.
+  Api::ApiPtr api = Api::createApiForTest();
+  NiceMock<Server::Configuration::MockServerFactoryContext> factory_context;
+  NiceMock<Envoy::StreamInfo::MockStreamInfo> stream_info;
+  ON_CALL(factory_context, api()).WillByDefault(ReturnRef(*api));
+
+  // Create router config.
+  ConfigImpl config(genMultiVhostRouteConfig(num_vhosts, routes_per_vhost),
+                    OptionalHttpFilters(), factory_context,
+                    ProtobufMessage::getNullValidationVisitor(), true);
+
+  const Http::TestRequestHeaderMapImpl headers{
+      {":authority", absl::StrCat("vhost_", num_vhosts - 1, ".example.com")},
+      {":method", "GET"},
+      {":path", absl::StrCat("/shelves/shelf_", routes_per_vhost - 1, "/route")},
+      {"x-forwarded-proto", "http"}};
+
+  for (auto _ : state) { // NOLINT
+    // Do the actual timing here.
+    config.route(headers, stream_info, 0);
+  }
+}
+
+BENCHMARK(bmRouteTableVirtualHostCount)
+    ->ArgNames({"vhosts", "routes"})
+    ->Args({1, 1000})
+    ->Args({10, 100})
+    ->Args({100, 10})
+    ->Args({1000, 1})
+    ->Args({1000, 100})
+    ->Args({10000, 10});
+
 } // namespace
 } // namespace Router
 } // namespace Envoy
@@ -1232,6 +1232,39 @@ virtual_hosts:
       "virtual clusters must define 'headers'");
 }
 
+// With deferred stat creation enabled, a virtual cluster's stats should not be
+// instantiated until the first time they are touched.
+TEST_F(RouteMatcherTest, VirtualClusterStatsDeferredCreation) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: www2
+    domains: ["*"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: "www2" }
+    virtual_clusters:
+      - name: ride_request
+        headers:
+          - name: ":path"
+            string_match:
+              exact: "/rides"
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"www2"}, {});
+  ON_CALL(factory_context_.stats_config_, enableDeferredCreationStats())
+      .WillByDefault(Return(true));
+  TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, true);
+
+  const std::string counter_name = "vhost.www2.vcluster.ride_request.upstream_rq_total";
+  EXPECT_EQ(nullptr, TestUtility::findCounter(factory_context_.store_, counter_name));
+
+  Http::TestRequestHeaderMapImpl headers = genHeaders("www.lyft.com", "/rides", "GET");
+  config.route(headers, 0)->routeEntry()->virtualCluster(headers)->stats().upstream_rq_total_.inc();
+  Stats::CounterSharedPtr counter = TestUtility::findCounter(factory_context_.store_, counter_name);
+  ASSERT_NE(nullptr, counter);
+  EXPECT_EQ(1, counter->value());
+}
+
 // Validates basic usage of the match tree to resolve route actions.
 TEST_F(RouteMatcherTest, TestMatchTree) {
   const std::string yaml = R"EOF(
@@ -7071,6 +7104,37 @@ virtual_hosts:
   EXPECT_EQ(cors_policy->allowPrivateNetworkAccess(), absl::nullopt);
 }
 
+// Verifies that originAllowed() answers from the representation compiled at construction time
+// with the same semantics as evaluating the allow_origin_string_match entries one by one.
+TEST(CorsPolicyImplTest, OriginAllowed) {
+  NiceMock<Runtime::MockLoader> runtime;
+
+  envoy::config::route::v3::CorsPolicy proto_config;
+  proto_config.add_allow_origin_string_match()->set_exact("http://foo.example");
+  proto_config.add_allow_origin_string_match()->set_suffix(".allowed.example");
+  auto* ignore_case_match = proto_config.add_allow_origin_string_match();
+  ignore_case_match->set_exact("http://MiXeD.example");
+  ignore_case_match->set_ignore_case(true);
+  const CorsPolicyImpl policy(proto_config, runtime);
+
+  // Exact matches are answered by the hash probe.
+  EXPECT_TRUE(policy.originAllowed("http://foo.example"));
+  EXPECT_FALSE(policy.originAllowed("http://bar.example"));
+  EXPECT_FALSE(policy.originAllowed("http://foo.example.evil"));
+  // Suffix matches.
+  EXPECT_TRUE(policy.originAllowed("http://sub.allowed.example"));
+  EXPECT_FALSE(policy.originAllowed("http://sub.allowed.example.evil"));
+  // Case-insensitive matchers fall back to one-by-one evaluation.
+  EXPECT_TRUE(policy.originAllowed("http://mixed.EXAMPLE"));
+  EXPECT_FALSE(policy.originAllowed(""));
+
+  // A matcher that matches the literal "*" allows any origin.
+  envoy::config::route::v3::CorsPolicy any_proto_config;
+  any_proto_config.add_allow_origin_string_match()->set_exact("*");
+  const CorsPolicyImpl any_policy(any_proto_config, runtime);
+  EXPECT_TRUE(any_policy.originAllowed("http://anything.example"));
+}
+
 TEST_F(RouteMatcherTest, Decorator) {
   const std::string yaml = R"EOF(
 virtual_hosts:
@@ -8707,6 +8771,190 @@ virtual_hosts:
                 ->clusterName());
 }
 
+TEST_F(RouteMatcherTest, LargeRouteTableUsesMatchIndex) {
+  // Build a table large enough to cross the compiled-index threshold, with a
+  // mix of indexable and unindexable rules. Matching must be identical to a
+  // linear scan, which the parity runtime check enforces on every lookup.
+  mergeValues({{"envoy.reloadable_features.check_route_match_index_parity", "true"}});
+
+  std::string yaml = R"EOF(
+virtual_hosts:
+  - name: indexed
+    domains: ["*"]
+    routes:
+)EOF";
+  for (int i = 0; i < 30; ++i) {
+    absl::StrAppend(&yaml, "      - match: { path: \"/filler/", i, "\" }\n",
+                    "        route: { cluster: filler }\n");
+  }
+  absl::StrAppend(&yaml, R"EOF(      - match:
+          prefix: "/api/v1/"
+          headers:
+            - name: x-debug
+              present_match: true
+        route: { cluster: debug }
+      - match: { path: "/api/v1/users" }
+        route: { cluster: users-exact }
+      - match: { prefix: "/api/v1/" }
+        route: { cluster: api-v1 }
+      - match: { path_separated_prefix: "/api/v2" }
+        route: { cluster: api-v2 }
+      - match:
+          path: "/MiXeD/CaSe"
+          case_sensitive: false
+        route: { cluster: mixed-case }
+      - match:
+          safe_regex:
+            regex: "^/regex/[0-9]+$"
+        route: { cluster: regex }
+      - match: { prefix: "/" }
+        route: { cluster: default }
+)EOF");
+
+  factory_context_.cluster_manager_.initializeClusters(
+      {"filler", "debug", "users-exact", "api-v1", "api-v2", "mixed-case", "regex", "default"}, {});
+  TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, true);
+
+  auto cluster = [&](const std::string& path) -> std::string {
+    return config.route(genHeaders("indexed.com", path, "GET"), 0)->routeEntry()->clusterName();
+  };
+
+  EXPECT_EQ("filler", cluster("/filler/7"));
+  EXPECT_EQ("users-exact", cluster("/api/v1/users"));
+  EXPECT_EQ("users-exact", cluster("/api/v1/users?page=2"));
+  EXPECT_EQ("api-v1", cluster("/api/v1/users/42"));
+  EXPECT_EQ("api-v2", cluster("/api/v2"));
+  EXPECT_EQ("api-v2", cluster("/api/v2/things"));
+  EXPECT_EQ("default", cluster("/api/v2x"));
+  EXPECT_EQ("mixed-case", cluster("/mixed/case"));
+  EXPECT_EQ("regex", cluster("/regex/123"));
+  EXPECT_EQ("default", cluster("/regex/abc"));
+  EXPECT_EQ("default", cluster("/filler/99"));
+
+  // A header predicate on an indexable prefix rule keeps first-match-wins
+  // semantics: with the header present, the earlier rule wins over the later
+  // exact-path rule.
+  Http::TestRequestHeaderMapImpl headers = genHeaders("indexed.com", "/api/v1/users", "GET");
+  headers.addCopy("x-debug", "1");
+  EXPECT_EQ("debug", config.route(headers, 0)->routeEntry()->clusterName());
+}
+
+TEST_F(RouteMatcherTest, SupportsRouteMemoization) {
+  factory_context_.cluster_manager_.initializeClusters({"www"}, {});
+
+  // Pure host/path routing is memoizable.
+  const std::string memoizable_yaml = R"EOF(
+virtual_hosts:
+  - name: local
+    domains: ["*"]
+    routes:
+      - match: { path: "/exact" }
+        route: { cluster: www }
+      - match: { prefix: "/" }
+        route: { cluster: www }
+)EOF";
+  EXPECT_TRUE(TestConfigImpl(parseRouteConfigurationFromYaml(memoizable_yaml), factory_context_,
+                             true)
+                  .supportsRouteMemoization());
+
+  // A header predicate makes route selection depend on more than the path.
+  const std::string header_predicate_yaml = R"EOF(
+virtual_hosts:
+  - name: local
+    domains: ["*"]
+    routes:
+      - match:
+          prefix: "/"
+          headers:
+            - name: x-debug
+              present_match: true
+        route: { cluster: www }
+)EOF";
+  EXPECT_FALSE(TestConfigImpl(parseRouteConfigurationFromYaml(header_predicate_yaml),
+                              factory_context_, true)
+                   .supportsRouteMemoization());
+
+  // Weighted clusters consume the per-request random value.
+  const std::string weighted_yaml = R"EOF(
+virtual_hosts:
+  - name: local
+    domains: ["*"]
+    routes:
+      - match: { prefix: "/" }
+        route:
+          weighted_clusters:
+            clusters:
+              - name: www
+                weight: 100
+)EOF";
+  EXPECT_FALSE(TestConfigImpl(parseRouteConfigurationFromYaml(weighted_yaml), factory_context_,
+                              true)
+                   .supportsRouteMemoization());
+
+  // An SSL requirement makes the redirect decision depend on x-forwarded-proto.
+  const std::string require_tls_yaml = R"EOF(
+virtual_hosts:
+  - name: local
+    domains: ["*"]
+    require_tls: ALL
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: www }
+)EOF";
+  EXPECT_FALSE(TestConfigImpl(parseRouteConfigurationFromYaml(require_tls_yaml), factory_context_,
+                              true)
+                   .supportsRouteMemoization());
+}
+
+TEST_F(RouteMatcherTest, UnchangedVirtualHostsSharedAcrossGenerations) {
+  factory_context_.cluster_manager_.initializeClusters({"www", "api", "api2"}, {});
+
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: www
+    domains: ["www.lyft.com"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: www }
+  - name: api
+    domains: ["api.lyft.com"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: api }
+)EOF";
+
+  const ConfigImpl config(parseRouteConfigurationFromYaml(yaml), OptionalHttpFilters(),
+                          factory_context_, ProtobufMessage::getNullValidationVisitor(), false);
+
+  // Change one virtual host; the other one must be shared with the previous generation, which is
+  // observable through route entry identity.
+  envoy::config::route::v3::RouteConfiguration changed_vhost =
+      parseRouteConfigurationFromYaml(yaml);
+  changed_vhost.mutable_virtual_hosts(1)->mutable_routes(0)->mutable_route()->set_cluster("api2");
+  const ConfigImpl config2(changed_vhost, OptionalHttpFilters(), factory_context_,
+                           ProtobufMessage::getNullValidationVisitor(), false, &config);
+
+  NiceMock<Envoy::StreamInfo::MockStreamInfo> stream_info;
+  const auto www_headers = genHeaders("www.lyft.com", "/foo", "GET");
+  const auto api_headers = genHeaders("api.lyft.com", "/foo", "GET");
+  EXPECT_EQ(config.route(www_headers, stream_info, 0)->routeEntry(),
+            config2.route(www_headers, stream_info, 0)->routeEntry());
+  EXPECT_NE(config.route(api_headers, stream_info, 0)->routeEntry(),
+            config2.route(api_headers, stream_info, 0)->routeEntry());
+  EXPECT_EQ("api2", config2.route(api_headers, stream_info, 0)->routeEntry()->clusterName());
+
+  // A change outside the virtual hosts disables sharing entirely: the shared virtual host would
+  // keep pointing at the previous generation's global config.
+  envoy::config::route::v3::RouteConfiguration changed_global =
+      parseRouteConfigurationFromYaml(yaml);
+  changed_global.mutable_response_headers_to_add()->Add()->mutable_header()->set_key("x-global");
+  changed_global.mutable_response_headers_to_add(0)->mutable_header()->set_value("1");
+  const ConfigImpl config3(changed_global, OptionalHttpFilters(), factory_context_,
+                           ProtobufMessage::getNullValidationVisitor(), false, &config);
+  EXPECT_NE(config.route(www_headers, stream_info, 0)->routeEntry(),
+            config3.route(www_headers, stream_info, 0)->routeEntry());
+}
+
 TEST_F(RouteMatcherTest, PathSeparatedPrefixMatchRewrite) {
 
   const std::string yaml = R"EOF(
@@ -1,3 +1,4 @@
+#include <array>
 #include <string>
 
 #include "envoy/config/core/v3/base.pb.h"
@@ -772,6 +773,70 @@ request_headers_to_remove: ["x-foo-header"]
   EXPECT_EQ("bar", header_map.get_("x-foo-header"));
 }
 
+TEST(HeaderParserTest, MergedParsersPreserveLevelOrdering) {
+  const std::string level_one_yaml = R"EOF(
+match: { prefix: "/" }
+route:
+  cluster: www2
+request_headers_to_add:
+  - header:
+      key: "x-level-one"
+      value: "one"
+request_headers_to_remove: ["x-cleanup"]
+)EOF";
+  const std::string level_two_yaml = R"EOF(
+match: { prefix: "/" }
+route:
+  cluster: www2
+request_headers_to_add:
+  - header:
+      key: "x-level-two"
+      value: "two"
+request_headers_to_remove: ["x-level-one", "x-cleanup"]
+)EOF";
+
+  const auto level_one = parseRouteFromV3Yaml(level_one_yaml);
+  const auto level_two = parseRouteFromV3Yaml(level_two_yaml);
+  HeaderParserPtr level_one_parser = HeaderParser::configure(
+      level_one.request_headers_to_add(), level_one.request_headers_to_remove());
+  HeaderParserPtr level_two_parser = HeaderParser::configure(
+      level_two.request_headers_to_add(), level_two.request_headers_to_remove());
+  const std::array<const HeaderParser*, 2> parsers{level_one_parser.get(),
+                                                   level_two_parser.get()};
+  HeaderParserPtr merged_parser = HeaderParser::merge(parsers);
+  NiceMock<Envoy::StreamInfo::MockStreamInfo> stream_info;
+
+  // The merged program must behave exactly like evaluating the parsers in sequence: the second
+  // level's removal runs after the first level's addition, and the duplicate "x-cleanup" removal
+  // is deduplicated without changing the outcome.
+  Http::TestRequestHeaderMapImpl merged_map{{"x-cleanup", "stale"}};
+  merged_parser->evaluateHeaders(merged_map, stream_info);
+  Http::TestRequestHeaderMapImpl sequential_map{{"x-cleanup", "stale"}};
+  level_one_parser->evaluateHeaders(sequential_map, stream_info);
+  level_two_parser->evaluateHeaders(sequential_map, stream_info);
+  EXPECT_EQ(sequential_map, merged_map);
+  EXPECT_TRUE(merged_map.get(Http::LowerCaseString("x-level-one")).empty());
+  EXPECT_EQ("two", merged_map.get_("x-level-two"));
+  EXPECT_TRUE(merged_map.get(Http::LowerCaseString("x-cleanup")).empty());
+
+  // A removal after an intermediate level added the header back must be kept.
+  const std::string level_three_yaml = R"EOF(
+match: { prefix: "/" }
+route:
+  cluster: www2
+request_headers_to_remove: ["x-level-two"]
+)EOF";
+  const auto level_three = parseRouteFromV3Yaml(level_three_yaml);
+  HeaderParserPtr level_three_parser = HeaderParser::configure(
+      level_three.request_headers_to_add(), level_three.request_headers_to_remove());
+  const std::array<const HeaderParser*, 3> three_parsers{
+      level_three_parser.get(), level_two_parser.get(), level_three_parser.get()};
+  HeaderParserPtr readd_merged_parser = HeaderParser::merge(three_parsers);
+  Http::TestRequestHeaderMapImpl readd_map{{"x-level-two", "stale"}};
+  readd_merged_parser->evaluateHeaders(readd_map, stream_info);
+  EXPECT_TRUE(readd_map.get(Http::LowerCaseString("x-level-two")).empty());
+}
+
 TEST(HeaderParserTest, EvaluateRequestHeadersAddIfAbsent) {
   const std::string yaml = R"EOF(
 match: { prefix: "/new_endpoint" }
@@ -489,6 +489,33 @@ TEST_F(DiskLoaderImplTest, LayersOverride) {
   EXPECT_EQ("Happy cake", loader_->snapshot().get("file15").value().get());
 }
 
+// Validate that layers whose contents did not change are shared across snapshots.
+TEST_F(DiskLoaderImplTest, UnchangedLayersSharedAcrossSnapshots) {
+  setup();
+  run("test/common/runtime/test_data/current", "envoy_override");
+  // Hold the old snapshot so its layer pointers stay valid for comparison.
+  const auto old_snapshot = loader_->threadsafeSnapshot();
+  const auto& layers = old_snapshot->getLayers();
+  ASSERT_EQ(4, layers.size());
+
+  loader_->mergeValues({{"foo", "bar"}});
+  const auto& admin_updated_layers = loader_->snapshot().getLayers();
+  // The static and disk layers were not touched by the admin update and are shared.
+  EXPECT_EQ(layers[0].get(), admin_updated_layers[0].get());
+  EXPECT_EQ(layers[1].get(), admin_updated_layers[1].get());
+  EXPECT_EQ(layers[2].get(), admin_updated_layers[2].get());
+  // The admin layer changed and was re-copied.
+  EXPECT_NE(layers[3].get(), admin_updated_layers[3].get());
+
+  // A symlink swap rebuilds the disk layers but keeps sharing the static layer.
+  write("test/common/runtime/test_data/current/envoy/file2", "new world");
+  updateDiskLayer(0);
+  const auto& disk_updated_layers = loader_->snapshot().getLayers();
+  EXPECT_EQ(layers[0].get(), disk_updated_layers[0].get());
+  EXPECT_NE(layers[1].get(), disk_updated_layers[1].get());
+  EXPECT_EQ("new world", loader_->snapshot().get("file2").value().get());
+}
+
 // Validate that multiple admin layers leads to a configuration load failure.
 TEST_F(DiskLoaderImplTest, MultipleAdminLayersFail) {
   setup();
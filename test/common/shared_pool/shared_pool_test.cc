@@ -222,5 +222,60 @@ TEST_F(SharedPoolTest, HashCollision) {
   EXPECT_EQ(0, pool->poolSize());
 }
 
+TEST(ShardedSharedPoolTest, Basic) {
+  auto pool = std::make_shared<ShardedObjectSharedPool<int>>();
+  {
+    auto o = pool->getObject(4);
+    auto o1 = pool->getObject(4);
+    ASSERT_EQ(1, pool->poolSize());
+
+    auto o2 = pool->getObject(5);
+    ASSERT_EQ(o.get(), o1.get());
+    ASSERT_EQ(2, pool->poolSize());
+    ASSERT_TRUE(o.get() != o2.get());
+  }
+
+  ASSERT_EQ(0, pool->poolSize());
+}
+
+TEST(ShardedSharedPoolTest, ShardCountRoundsUpToPowerOfTwo) {
+  // A non power of two shard count must still map every hash to a valid shard.
+  auto pool = std::make_shared<ShardedObjectSharedPool<int>>(3);
+  std::vector<std::shared_ptr<int>> objects;
+  for (int i = 0; i < 100; i++) {
+    objects.push_back(pool->getObject(i));
+  }
+  EXPECT_EQ(100, pool->poolSize());
+  objects.clear();
+  EXPECT_EQ(0, pool->poolSize());
+}
+
+TEST(ShardedSharedPoolTest, ConcurrentGetAndRelease) {
+  // Deduplication and release from many threads at once: no dispatcher involved, entries are
+  // erased directly on the destroying thread.
+  auto pool = std::make_shared<ShardedObjectSharedPool<int>>();
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+  constexpr int NumThreads = 8;
+  constexpr int ObjectsPerThread = 200;
+
+  absl::Notification go;
+  std::vector<Thread::ThreadPtr> threads;
+  threads.reserve(NumThreads);
+  for (int t = 0; t < NumThreads; t++) {
+    threads.push_back(thread_factory.createThread([&pool, &go]() {
+      go.WaitForNotification();
+      for (int i = 0; i < ObjectsPerThread; i++) {
+        auto o = pool->getObject(i);
+        EXPECT_EQ(i, *o);
+      }
+    }));
+  }
+  go.Notify();
+  for (auto& thread : threads) {
+    thread->join();
+  }
+  EXPECT_EQ(0, pool->poolSize());
+}
+
 } // namespace SharedPool
 } // namespace Envoy
@@ -84,6 +84,22 @@ TEST_F(AllocatorImplTest, GaugesWithSameName) {
   EXPECT_EQ(0, g2->value());
 }
 
+TEST_F(AllocatorImplTest, GaugeLatchChanged) {
+  GaugeSharedPtr gauge =
+      alloc_.makeGauge(makeStat("gauge.name"), StatName(), {}, Gauge::ImportMode::Accumulate);
+  // A gauge that has never left its initial value of 0 reports unchanged.
+  EXPECT_FALSE(gauge->latchChanged());
+  gauge->set(5);
+  EXPECT_TRUE(gauge->latchChanged());
+  EXPECT_FALSE(gauge->latchChanged());
+  gauge->add(2);
+  gauge->sub(2);
+  // Returning to the latched value within one interval reports unchanged.
+  EXPECT_FALSE(gauge->latchChanged());
+  gauge->inc();
+  EXPECT_TRUE(gauge->latchChanged());
+}
+
 // Test for a race-condition where we may decrement the ref-count of a stat to
 // zero at the same time as we are allocating another instance of that
 // stat. This test reproduces that race organically by having a 12 threads each
@@ -0,0 +1,118 @@
+#include <vector>
+
+#include "source/common/stats/ddsketch.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Stats {
+namespace {
+
+TEST(DDSketchTest, Empty) {
+  DDSketch sketch;
+  EXPECT_EQ(sketch.count(), 0);
+  EXPECT_EQ(sketch.sum(), 0);
+  EXPECT_EQ(sketch.quantile(0.5), 0);
+  EXPECT_EQ(sketch.countBelow(100), 0);
+  EXPECT_TRUE(sketch.bins().empty());
+}
+
+TEST(DDSketchTest, SingleValue) {
+  DDSketch sketch(0.01);
+  sketch.insert(100);
+  EXPECT_EQ(sketch.count(), 1);
+  EXPECT_EQ(sketch.sum(), 100);
+  EXPECT_NEAR(sketch.quantile(0.5), 100, 100 * 0.01);
+  EXPECT_NEAR(sketch.quantile(1.0), 100, 100 * 0.01);
+}
+
+// Every quantile estimate must be within the configured relative accuracy of
+// the true value, across several orders of magnitude.
+TEST(DDSketchTest, RelativeAccuracyBound) {
+  const double accuracy = 0.01;
+  DDSketch sketch(accuracy);
+  std::vector<double> values;
+  for (uint64_t v = 1; v <= 100000; v = v * 3 / 2 + 1) {
+    sketch.insert(v);
+    values.push_back(v);
+  }
+
+  for (double q : {0.0, 0.25, 0.5, 0.9, 0.99, 1.0}) {
+    const double exact = values[static_cast<size_t>(q * (values.size() - 1))];
+    EXPECT_NEAR(sketch.quantile(q), exact, exact * accuracy) << "q=" << q;
+  }
+}
+
+TEST(DDSketchTest, ZeroValues) {
+  DDSketch sketch(0.01);
+  sketch.insert(0, 3);
+  sketch.insert(10);
+  EXPECT_EQ(sketch.count(), 4);
+  EXPECT_EQ(sketch.quantile(0.5), 0);
+  EXPECT_NEAR(sketch.quantile(1.0), 10, 10 * 0.01);
+  EXPECT_EQ(sketch.countBelow(1), 3);
+}
+
+TEST(DDSketchTest, CountBelow) {
+  DDSketch sketch(0.01);
+  sketch.insert(5, 10);
+  sketch.insert(500, 20);
+  EXPECT_EQ(sketch.countBelow(1), 0);
+  EXPECT_EQ(sketch.countBelow(50), 10);
+  EXPECT_EQ(sketch.countBelow(5000), 30);
+}
+
+// Accumulating two sketches is equivalent to recording all values into one.
+TEST(DDSketchTest, AccumulateEquivalence) {
+  DDSketch combined(0.01);
+  DDSketch a(0.01);
+  DDSketch b(0.01);
+  for (uint64_t v = 1; v <= 1000; v += 7) {
+    combined.insert(v);
+    ((v % 2 == 0) ? a : b).insert(v);
+  }
+  a.accumulate(b);
+  EXPECT_EQ(a.count(), combined.count());
+  EXPECT_EQ(a.sum(), combined.sum());
+  for (double q : {0.1, 0.5, 0.9, 0.99}) {
+    EXPECT_EQ(a.quantile(q), combined.quantile(q)) << "q=" << q;
+  }
+}
+
+TEST(DDSketchTest, Clear) {
+  DDSketch sketch(0.01);
+  sketch.insert(42, 5);
+  sketch.clear();
+  EXPECT_EQ(sketch.count(), 0);
+  EXPECT_EQ(sketch.sum(), 0);
+  EXPECT_TRUE(sketch.bins().empty());
+  EXPECT_EQ(sketch.relativeAccuracy(), 0.01);
+}
+
+// Bins are returned in increasing order, cover their values, and sum to the
+// recorded count.
+TEST(DDSketchTest, Bins) {
+  DDSketch sketch(0.01);
+  sketch.insert(0, 2);
+  sketch.insert(3, 4);
+  sketch.insert(1000, 6);
+
+  const std::vector<DDSketch::Bin> bins = sketch.bins();
+  ASSERT_EQ(bins.size(), 3);
+  EXPECT_EQ(bins[0].lower_bound_, 0);
+  EXPECT_EQ(bins[0].count_, 2);
+  uint64_t total = 0;
+  double previous_upper = 0;
+  for (const DDSketch::Bin& bin : bins) {
+    EXPECT_GE(bin.lower_bound_, previous_upper);
+    previous_upper = bin.lower_bound_ + bin.width_;
+    total += bin.count_;
+  }
+  EXPECT_EQ(total, 12);
+  EXPECT_LE(bins[1].lower_bound_, 3);
+  EXPECT_GE(bins[1].lower_bound_ + bins[1].width_, 3);
+}
+
+} // namespace
+} // namespace Stats
+} // namespace Envoy
@@ -17,10 +17,15 @@ public:
     for (auto& item : buckets_configs_) {
       bucket_settings.Add(std::move(item));
     }
+    auto& sketch_settings = *config.mutable_histogram_sketch_settings();
+    for (auto& item : sketch_configs_) {
+      sketch_settings.Add(std::move(item));
+    }
     settings_ = std::make_unique<HistogramSettingsImpl>(config);
   }
 
   std::vector<envoy::config::metrics::v3::HistogramBucketSettings> buckets_configs_;
+  std::vector<envoy::config::metrics::v3::HistogramSketchSettings> sketch_configs_;
   std::unique_ptr<HistogramSettingsImpl> settings_;
 };
 
@@ -107,5 +112,39 @@ TEST_F(HistogramSettingsImplTest, ScaledPercent) {
   EXPECT_EQ(settings_->buckets("abcd"), ConstSupportedBuckets({0.1, 2}));
 }
 
+// Test that matching stats get the configured sketch accuracy and non-matching
+// stats get no sketch backend.
+TEST_F(HistogramSettingsImplTest, SketchMatching) {
+  envoy::config::metrics::v3::HistogramSketchSettings setting;
+  setting.mutable_match()->set_prefix("a");
+  setting.set_relative_accuracy(0.02);
+  sketch_configs_.push_back(setting);
+
+  initialize();
+  EXPECT_EQ(settings_->sketchAccuracy("abcd"), absl::optional<double>(0.02));
+  EXPECT_EQ(settings_->sketchAccuracy("test"), absl::nullopt);
+}
+
+// Test that an unset accuracy falls back to the sketch default, and that
+// earlier sketch rules take precedence over later ones.
+TEST_F(HistogramSettingsImplTest, SketchDefaultAccuracyAndPriority) {
+  {
+    envoy::config::metrics::v3::HistogramSketchSettings setting;
+    setting.mutable_match()->set_prefix("ab");
+    sketch_configs_.push_back(setting);
+  }
+
+  {
+    envoy::config::metrics::v3::HistogramSketchSettings setting;
+    setting.mutable_match()->set_prefix("a");
+    setting.set_relative_accuracy(0.05);
+    sketch_configs_.push_back(setting);
+  }
+
+  initialize();
+  EXPECT_EQ(settings_->sketchAccuracy("abcd"), absl::optional<double>(0.01));
+  EXPECT_EQ(settings_->sketchAccuracy("acde"), absl::optional<double>(0.05));
+}
+
 } // namespace Stats
 } // namespace Envoy
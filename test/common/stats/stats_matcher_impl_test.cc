@@ -5,6 +5,7 @@
 
 #include "test/test_common/utility.h"
 
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
 
 namespace Envoy {
@@ -330,6 +331,36 @@ TEST_F(StatsMatcherTest, CheckMultipleAssortedExclusionMatchersWithPrefix) {
   EXPECT_FALSE(stats_matcher_impl_->rejectsAll());
 }
 
+// Compiled prefix/exact rules.
+//
+// "."-terminated prefixes and case-sensitive exact names are compiled into
+// StatName-based structures that evaluate in time independent of the rule
+// count; verify behavior is unchanged when hundreds of such rules are present.
+
+TEST_F(StatsMatcherTest, CheckManyCompiledExclusionRules) {
+  for (int i = 0; i < 300; ++i) {
+    exclusionList()->set_prefix(absl::StrCat("excluded_prefix_", i, "."));
+    exclusionList()->set_exact(absl::StrCat("excluded_exact_", i));
+  }
+  initMatcher();
+  expectAccepted({"foo", "excluded_prefix_7x.bar", "excluded_exact_7.x", "prefix_7.foo"});
+  expectDenied({"excluded_prefix_7", "excluded_prefix_7.foo", "excluded_prefix_299.foo.bar",
+                "excluded_exact_7", "excluded_exact_299"});
+  EXPECT_FALSE(stats_matcher_impl_->acceptsAll());
+  EXPECT_FALSE(stats_matcher_impl_->rejectsAll());
+}
+
+TEST_F(StatsMatcherTest, CheckExcludeExactIgnoreCase) {
+  // Case-insensitive exact matchers are not compiled, and continue to be
+  // evaluated against the elaborated name.
+  auto* matcher = exclusionList();
+  matcher->set_exact("AbC");
+  matcher->set_ignore_case(true);
+  initMatcher();
+  expectDenied({"AbC", "abc", "ABC"});
+  expectAccepted({"abcd", "ab"});
+}
+
 TEST_F(StatsMatcherTest, SkipSlowRejectsOnFastReject) {
   inclusionList()->set_suffix("xyz");
   initMatcher();
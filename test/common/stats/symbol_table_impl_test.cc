@@ -711,6 +711,41 @@ TEST_F(StatNameTest, StartsWith) {
   EXPECT_FALSE(dynamic_prefix.startsWith(dynamic_prefix));
 }
 
+TEST_F(StatNameTest, PrefixTrie) {
+  StatNamePrefixTrie trie;
+  EXPECT_TRUE(trie.empty());
+  EXPECT_FALSE(trie.containsPrefixOf(makeStat("prefix")));
+
+  trie.insert(makeStat("prefix"));
+  trie.insert(makeStat("other.prefix"));
+  EXPECT_FALSE(trie.empty());
+  EXPECT_TRUE(trie.containsPrefixOf(makeStat("prefix")));
+  EXPECT_TRUE(trie.containsPrefixOf(makeStat("prefix.foo")));
+  EXPECT_TRUE(trie.containsPrefixOf(makeStat("prefix.foo.bar")));
+  EXPECT_TRUE(trie.containsPrefixOf(makeStat("other.prefix.foo")));
+  EXPECT_FALSE(trie.containsPrefixOf(makeStat("")));
+  EXPECT_FALSE(trie.containsPrefixOf(makeStat("foo")));
+  EXPECT_FALSE(trie.containsPrefixOf(makeStat("other")));
+  EXPECT_FALSE(trie.containsPrefixOf(makeStat("other.foo")));
+
+  // Inserting a longer prefix covered by a shorter one, or vice versa, keeps
+  // the shorter prefix's matching behavior.
+  trie.insert(makeStat("prefix.foo"));
+  trie.insert(makeStat("a.b.c"));
+  trie.insert(makeStat("a.b"));
+  EXPECT_TRUE(trie.containsPrefixOf(makeStat("prefix.bar")));
+  EXPECT_TRUE(trie.containsPrefixOf(makeStat("a.b")));
+  EXPECT_TRUE(trie.containsPrefixOf(makeStat("a.b.x")));
+  EXPECT_FALSE(trie.containsPrefixOf(makeStat("a.x.c")));
+
+  // As with startsWith, dynamic segments never match a stored prefix, but may
+  // follow a fully-matched one.
+  StatNameDynamicPool dynamic(table_);
+  EXPECT_FALSE(trie.containsPrefixOf(dynamic.add("prefix.foo")));
+  EXPECT_TRUE(trie.containsPrefixOf(
+      StatName(table_.join({makeStat("prefix"), dynamic.add("foo")}).get())));
+}
+
 TEST_F(StatNameTest, SupportsAbslHash) {
   EXPECT_TRUE(absl::VerifyTypeImplementsAbslHashCorrectly({
       StatName(),
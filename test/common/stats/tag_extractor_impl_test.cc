@@ -60,6 +60,115 @@ TEST(TagExtractorTest, SingleSubexpression) {
   EXPECT_EQ("listner_port", tags.at(0).name_);
 }
 
+TEST(TagExtractorTest, ResponseCodeCompiled) {
+  TagExtractorResponseCodeImpl tag_extractor("response_code");
+  std::string name = "cluster.test_cluster.upstream_rq_503";
+  TagVector tags;
+  IntervalSetImpl<size_t> remove_characters;
+  TagExtractionContext tag_extraction_context(name);
+  ASSERT_TRUE(tag_extractor.extractTag(tag_extraction_context, tags, remove_characters));
+  std::string tag_extracted_name = StringUtil::removeCharacters(name, remove_characters);
+  EXPECT_EQ("cluster.test_cluster.upstream_rq", tag_extracted_name);
+  ASSERT_EQ(1, tags.size());
+  EXPECT_EQ("503", tags.at(0).value_);
+  EXPECT_EQ("response_code", tags.at(0).name_);
+
+  for (absl::string_view miss : {"upstream_rq_5xx", "upstream_rq_50", "upstream_rq_5038",
+                                 "upstream_rq_total", "upstream_cx_503", "_rq_50"}) {
+    TagVector miss_tags;
+    IntervalSetImpl<size_t> miss_remove_characters;
+    TagExtractionContext miss_context(miss);
+    EXPECT_FALSE(tag_extractor.extractTag(miss_context, miss_tags, miss_remove_characters)) << miss;
+  }
+}
+
+TEST(TagExtractorTest, ResponseCodeClassCompiled) {
+  TagExtractorResponseCodeClassImpl tag_extractor("response_code_class");
+  std::string name = "cluster.test_cluster.upstream_rq_5xx";
+  TagVector tags;
+  IntervalSetImpl<size_t> remove_characters;
+  TagExtractionContext tag_extraction_context(name);
+  ASSERT_TRUE(tag_extractor.extractTag(tag_extraction_context, tags, remove_characters));
+  std::string tag_extracted_name = StringUtil::removeCharacters(name, remove_characters);
+  EXPECT_EQ("cluster.test_cluster.upstream_rq_xx", tag_extracted_name);
+  ASSERT_EQ(1, tags.size());
+  EXPECT_EQ("5", tags.at(0).value_);
+  EXPECT_EQ("response_code_class", tags.at(0).name_);
+
+  for (absl::string_view miss :
+       {"upstream_rq_503", "upstream_rq_xx", "upstream_rq_5x", "upstream_cx_5xx", "_rq_xx"}) {
+    TagVector miss_tags;
+    IntervalSetImpl<size_t> miss_remove_characters;
+    TagExtractionContext miss_context(miss);
+    EXPECT_FALSE(tag_extractor.extractTag(miss_context, miss_tags, miss_remove_characters)) << miss;
+  }
+}
+
+TEST(TagExtractorTest, ListenerAddressCompiled) {
+  TagExtractorListenerAddressImpl tag_extractor("listener_address");
+  EXPECT_EQ("listener", tag_extractor.prefixToken());
+
+  auto extract = [&tag_extractor](absl::string_view name, TagVector& tags,
+                                  std::string& tag_extracted_name) -> bool {
+    IntervalSetImpl<size_t> remove_characters;
+    TagExtractionContext tag_extraction_context(name);
+    if (!tag_extractor.extractTag(tag_extraction_context, tags, remove_characters)) {
+      return false;
+    }
+    tag_extracted_name = StringUtil::removeCharacters(name, remove_characters);
+    return true;
+  };
+
+  // IPv4 addresses span multiple dot-separated tokens.
+  {
+    TagVector tags;
+    std::string tag_extracted_name;
+    ASSERT_TRUE(extract("listener.127.0.0.1_3012.downstream_cx_total", tags, tag_extracted_name));
+    EXPECT_EQ("listener.downstream_cx_total", tag_extracted_name);
+    ASSERT_EQ(1, tags.size());
+    EXPECT_EQ("127.0.0.1_3012", tags.at(0).value_);
+  }
+
+  // Bracketed IPv6 address.
+  {
+    TagVector tags;
+    std::string tag_extracted_name;
+    ASSERT_TRUE(extract("listener.[__1]_0.downstream_cx_total", tags, tag_extracted_name));
+    EXPECT_EQ("listener.downstream_cx_total", tag_extracted_name);
+    ASSERT_EQ(1, tags.size());
+    EXPECT_EQ("[__1]_0", tags.at(0).value_);
+  }
+
+  // Non-address stat prefixes are a single token.
+  {
+    TagVector tags;
+    std::string tag_extracted_name;
+    ASSERT_TRUE(extract("listener.my_prefix.downstream_cx_total", tags, tag_extracted_name));
+    EXPECT_EQ("listener.downstream_cx_total", tag_extracted_name);
+    ASSERT_EQ(1, tags.size());
+    EXPECT_EQ("my_prefix", tags.at(0).value_);
+  }
+
+  // An address with nothing after it falls back to the single-token form,
+  // as the regex alternation this replaces did.
+  {
+    TagVector tags;
+    std::string tag_extracted_name;
+    ASSERT_TRUE(extract("listener.127.0.0.1_3012", tags, tag_extracted_name));
+    EXPECT_EQ("listener.0.0.1_3012", tag_extracted_name);
+    ASSERT_EQ(1, tags.size());
+    EXPECT_EQ("127", tags.at(0).value_);
+  }
+
+  // The admin listener is excluded, and there must be a dot after the value.
+  for (absl::string_view miss :
+       {"listener.admin.downstream_cx_total", "listener.no_dot_suffix", "http.foo.something"}) {
+    TagVector tags;
+    std::string tag_extracted_name;
+    EXPECT_FALSE(extract(miss, tags, tag_extracted_name)) << miss;
+  }
+}
+
 TEST(TagExtractorTest, substrMismatch) {
   TagExtractorStdRegexImpl tag_extractor("listner_port", "^listener\\.(\\d+?\\.)\\.foo\\.",
                                          ".foo.");
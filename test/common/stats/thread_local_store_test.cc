@@ -1667,6 +1667,75 @@ TEST_F(HistogramTest, MultiHistogramMultipleMerges) {
   EXPECT_EQ(2, validateMerge());
 }
 
+// An idle histogram drops out of the incremental merge: once its extra drain cycle has passed it
+// reports an empty interval while its cumulative values remain, and further merge cycles leave it
+// untouched.
+TEST_F(HistogramTest, IdleHistogramSkippedAndReportsEmptyInterval) {
+  Histogram& h1 = scope_.histogramFromString("h1", Histogram::Unit::Unspecified);
+  Histogram& h2 = scope_.histogramFromString("h2", Histogram::Unit::Unspecified);
+
+  expectCallAndAccumulate(h1, 1);
+  expectCallAndAccumulate(h2, 100);
+  EXPECT_EQ(2, validateMerge());
+
+  // Keep h1 active while h2 goes idle. validateMerge() checks that h2's interval reads empty on
+  // every subsequent cycle.
+  for (int i = 0; i < 3; ++i) {
+    expectCallAndAccumulate(h1, 1);
+    EXPECT_EQ(2, validateMerge());
+  }
+
+  NameHistogramMap name_histogram_map = makeHistogramMap(store_->histograms());
+  const ParentHistogramSharedPtr& parent_h2 = name_histogram_map["h2"];
+  EXPECT_EQ(0, parent_h2->intervalStatistics().sampleCount());
+  EXPECT_EQ(1, parent_h2->cumulativeStatistics().sampleCount());
+}
+
+// A value recorded while a merge cycle is in flight lands in the write buffer that cycle does not
+// drain; the dirty flag keeps the histogram in the merge set so the following cycle flushes it.
+TEST_F(HistogramTest, ValueRecordedMidMergeFlushedByFollowingCycle) {
+  Histogram& h1 = scope_.histogramFromString("h1", Histogram::Unit::Unspecified);
+
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h1), 1));
+  h1.recordValue(1);
+
+  // The merge completion callback runs before the cycle is marked done, after the TLS buffers
+  // have swapped: the new value goes into the buffer the current cycle does not read.
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h1), 2));
+  store_->mergeHistograms([&h1]() -> void { h1.recordValue(2); });
+
+  ParentHistogramSharedPtr parent_h1 = store_->histograms()[0];
+  EXPECT_EQ(1, parent_h1->intervalStatistics().sampleCount());
+  EXPECT_EQ(1, parent_h1->cumulativeStatistics().sampleCount());
+
+  store_->mergeHistograms([]() -> void {});
+  EXPECT_EQ(1, parent_h1->intervalStatistics().sampleCount());
+  EXPECT_EQ(2, parent_h1->cumulativeStatistics().sampleCount());
+}
+
+// Tracks the merge-set bookkeeping directly: a recording makes the histogram eligible for the
+// next two cycles (the second drains the straggler buffer), after which it drops out until the
+// next recording.
+TEST_F(HistogramTest, DirtyHistogramDropsOutOfMergeSetAfterExtraCycle) {
+  Histogram& h1 = scope_.histogramFromString("h1", Histogram::Unit::Unspecified);
+
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h1), 1));
+  h1.recordValue(1);
+
+  auto* parent_h1 = dynamic_cast<ParentHistogramImpl*>(store_->histograms()[0].get());
+  ASSERT_NE(nullptr, parent_h1);
+  // Dirty from the recording, then one extra cycle for the undrained write buffer.
+  EXPECT_TRUE(parent_h1->shouldMerge());
+  EXPECT_TRUE(parent_h1->shouldMerge());
+  // Out of the merge set until the next recording.
+  EXPECT_FALSE(parent_h1->shouldMerge());
+  EXPECT_FALSE(parent_h1->shouldMerge());
+
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h1), 2));
+  h1.recordValue(2);
+  EXPECT_TRUE(parent_h1->shouldMerge());
+}
+
 TEST_F(HistogramTest, BasicScopeHistogramMerge) {
   ScopeSharedPtr scope1 = store_->createScope("scope1.");
 
@@ -1797,6 +1866,45 @@ TEST_F(HistogramTest, ParentHistogramBucketSummaryAndDetail) {
   EXPECT_THAT(parent_histogram->detailedIntervalBuckets(), UnorderedElementsAre(Bucket{10, 1, 1}));
 }
 
+TEST_F(HistogramTest, SketchBackedHistogramMerge) {
+  envoy::config::metrics::v3::StatsConfig stats_config;
+  auto& sketch_settings = *stats_config.add_histogram_sketch_settings();
+  sketch_settings.mutable_match()->set_prefix("h1");
+  sketch_settings.set_relative_accuracy(0.01);
+  store_->setHistogramSettings(std::make_unique<HistogramSettingsImpl>(stats_config));
+
+  Histogram& h1 = scope_.histogramFromString("h1", Histogram::Unit::Unspecified);
+  Histogram& h2 = scope_.histogramFromString("h2", Histogram::Unit::Unspecified);
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h1), 100));
+  h1.recordValue(100);
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h2), 100));
+  h2.recordValue(100);
+  store_->mergeHistograms([]() -> void {});
+
+  NameHistogramMap name_histogram_map = makeHistogramMap(store_->histograms());
+  const ParentHistogramSharedPtr& parent_h1 = name_histogram_map["h1"];
+  EXPECT_EQ(1, parent_h1->cumulativeStatistics().sampleCount());
+  EXPECT_EQ(100, parent_h1->cumulativeStatistics().sampleSum());
+  EXPECT_NEAR(100, parent_h1->intervalStatistics().computedQuantiles().back(), 100 * 0.01);
+  std::vector<Bucket> buckets = parent_h1->detailedTotalBuckets();
+  ASSERT_EQ(1, buckets.size());
+  EXPECT_EQ(1, buckets[0].count_);
+  EXPECT_LE(buckets[0].lower_bound_, 100);
+  EXPECT_GE(buckets[0].lower_bound_ + buckets[0].width_, 100);
+
+  // A second merge cycle accumulates into the sketch-backed cumulative view
+  // while the interval resets.
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h1), 200));
+  h1.recordValue(200);
+  store_->mergeHistograms([]() -> void {});
+  EXPECT_EQ(2, parent_h1->cumulativeStatistics().sampleCount());
+  EXPECT_EQ(1, parent_h1->intervalStatistics().sampleCount());
+
+  // h2 does not match the sketch rule and keeps the default backend.
+  const ParentHistogramSharedPtr& parent_h2 = name_histogram_map["h2"];
+  EXPECT_EQ(1, parent_h2->cumulativeStatistics().sampleCount());
+}
+
 TEST_F(HistogramTest, ForEachHistogram) {
   std::vector<std::reference_wrapper<Histogram>> histograms;
 
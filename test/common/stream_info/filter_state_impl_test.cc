@@ -55,11 +55,19 @@ public:
     filter_state_ = std::make_unique<FilterStateImpl>(FilterState::LifeSpan::FilterChain);
   }
   FilterState& filterState() { return *filter_state_; }
+  FilterStateImpl& filterStateImpl() { return *filter_state_; }
 
 private:
   std::unique_ptr<FilterStateImpl> filter_state_;
 };
 
+// Inline keys must be registered before any FilterStateImpl is created, so register them during
+// static initialization.
+const FilterStateImpl::InlineKey inline_test_key =
+    FilterStateImpl::registerInlineKey("inline_test_key");
+const FilterStateImpl::InlineKey inline_unset_key =
+    FilterStateImpl::registerInlineKey("inline_unset_key");
+
 } // namespace
 
 TEST_F(FilterStateImplTest, Simple) {
@@ -454,5 +462,37 @@ TEST_F(FilterStateImplTest, SetSameDataWithDifferentLifeSpan) {
   EXPECT_EQ(2, filterState().getDataMutable<SimpleType>("test_2")->access());
 }
 
+TEST_F(FilterStateImplTest, InlineKey) {
+  // Objects stored under a registered key are reachable both through the handle and through the
+  // regular string based interface.
+  filterState().setData("inline_test_key", std::make_unique<SimpleType>(1),
+                        FilterState::StateType::Mutable, FilterState::LifeSpan::FilterChain);
+  EXPECT_EQ(1, filterStateImpl().getDataReadOnly<SimpleType>(inline_test_key)->access());
+  EXPECT_EQ(1, filterState().getDataReadOnly<SimpleType>("inline_test_key")->access());
+
+  filterStateImpl().getDataMutable<SimpleType>(inline_test_key)->set(2);
+  EXPECT_EQ(2, filterState().getDataMutable<SimpleType>("inline_test_key")->access());
+
+  EXPECT_EQ(nullptr, filterStateImpl().getDataReadOnly<SimpleType>(inline_unset_key));
+}
+
+TEST_F(FilterStateImplTest, InlineKeyDelegatesToParent) {
+  // The object lives in an ancestor, so the handle lookup has to fall back to the string based
+  // interface for the parent chain.
+  filterState().setData("inline_test_key", std::make_unique<SimpleType>(3),
+                        FilterState::StateType::ReadOnly, FilterState::LifeSpan::Connection);
+  EXPECT_EQ(3, filterStateImpl().getDataReadOnly<SimpleType>(inline_test_key)->access());
+}
+
+TEST_F(FilterStateImplTest, InlineKeySharedWithUpstream) {
+  // Objects under registered keys are picked up by the stream sharing iteration like any other.
+  filterState().setData("inline_test_key", std::make_unique<SimpleType>(4),
+                        FilterState::StateType::ReadOnly, FilterState::LifeSpan::FilterChain,
+                        StreamSharingMayImpactPooling::SharedWithUpstreamConnection);
+  const auto objects = filterState().objectsSharedWithUpstreamConnection();
+  ASSERT_EQ(1, objects->size());
+  EXPECT_EQ("inline_test_key", (*objects)[0].name_);
+}
+
 } // namespace StreamInfo
 } // namespace Envoy
@@ -0,0 +1,198 @@
+#include "source/common/upstream/bucketed_scheduler.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Upstream {
+namespace {
+
+TEST(BucketedSchedulerTest, Empty) {
+  BucketedScheduler<uint32_t> sched;
+  EXPECT_TRUE(sched.empty());
+  EXPECT_EQ(nullptr, sched.peekAgain([](const uint32_t&) { return 1; }));
+  EXPECT_EQ(nullptr, sched.pickAndAdd([](const uint32_t&) { return 1; }));
+}
+
+// Validate we get regular RR behavior when all weights are the same.
+TEST(BucketedSchedulerTest, Unweighted) {
+  BucketedScheduler<uint32_t> sched;
+  constexpr uint32_t num_entries = 128;
+  std::shared_ptr<uint32_t> entries[num_entries];
+
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    entries[i] = std::make_shared<uint32_t>(i);
+    sched.add(1, entries[i]);
+  }
+
+  for (uint32_t rounds = 0; rounds < 128; ++rounds) {
+    for (uint32_t i = 0; i < num_entries; ++i) {
+      auto peek = sched.peekAgain([](const uint32_t&) { return 1; });
+      auto p = sched.pickAndAdd([](const uint32_t&) { return 1; });
+      EXPECT_EQ(i, *p);
+      EXPECT_EQ(*peek, *p);
+    }
+  }
+}
+
+// Validate that pick counts match the object weights over a scheduling cycle.
+TEST(BucketedSchedulerTest, WeightedDistribution) {
+  BucketedScheduler<uint32_t> sched;
+  constexpr uint32_t num_entries = 16;
+  std::shared_ptr<uint32_t> entries[num_entries];
+  uint32_t pick_count[num_entries];
+
+  uint32_t weight_sum = 0;
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    entries[i] = std::make_shared<uint32_t>(i);
+    sched.add(i + 1, entries[i]);
+    weight_sum += (i + 1);
+    pick_count[i] = 0;
+  }
+
+  // Stride scheduling is deterministic: over whole cycles each object should be picked a number
+  // of times proportional to its weight, with a bounded per-cycle rounding error.
+  constexpr uint32_t cycles = 10;
+  for (uint32_t i = 0; i < cycles * weight_sum; ++i) {
+    auto peek = sched.peekAgain({});
+    auto p = sched.pickAndAdd({});
+    EXPECT_EQ(*p, *peek);
+    ++pick_count[*p];
+  }
+
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    EXPECT_NEAR(cycles * (i + 1), pick_count[i], 2) << "entry " << i;
+  }
+}
+
+// Weights within half a quantization step of each other land in the same bucket and are treated
+// as equal, giving strict rotation.
+TEST(BucketedSchedulerTest, QuantizedWeightsShareBucket) {
+  BucketedScheduler<uint32_t> sched;
+  auto e1 = std::make_shared<uint32_t>(1);
+  auto e2 = std::make_shared<uint32_t>(2);
+  sched.add(1.0, e1);
+  sched.add(1.001, e2);
+
+  for (int i = 0; i < 10; ++i) {
+    auto p1 = sched.pickAndAdd({});
+    auto p2 = sched.pickAndAdd({});
+    EXPECT_NE(*p1, *p2);
+  }
+}
+
+// Validate that expired entries are ignored and drained buckets are dropped.
+TEST(BucketedSchedulerTest, Expired) {
+  BucketedScheduler<uint32_t> sched;
+
+  auto second_entry = std::make_shared<uint32_t>(42);
+  {
+    auto first_entry = std::make_shared<uint32_t>(37);
+    auto third_entry = std::make_shared<uint32_t>(22);
+    sched.add(1000, first_entry);
+    sched.add(1, second_entry);
+    sched.add(100, third_entry);
+  }
+
+  auto peek = sched.peekAgain({});
+  auto p1 = sched.pickAndAdd({});
+  auto p2 = sched.pickAndAdd({});
+  EXPECT_EQ(*peek, *p1);
+  EXPECT_EQ(*second_entry, *p1);
+  EXPECT_EQ(*second_entry, *p2);
+}
+
+// Validate that an entry peeked before expiry is not subsequently picked.
+TEST(BucketedSchedulerTest, ExpiredPeekedIsNotPicked) {
+  BucketedScheduler<uint32_t> sched;
+
+  {
+    auto first_entry = std::make_shared<uint32_t>(37);
+    auto second_entry = std::make_shared<uint32_t>(42);
+    sched.add(2, first_entry);
+    sched.add(1, second_entry);
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_TRUE(sched.peekAgain({}) != nullptr);
+    }
+  }
+
+  EXPECT_TRUE(sched.peekAgain({}) == nullptr);
+  EXPECT_TRUE(sched.pickAndAdd({}) == nullptr);
+}
+
+// Ensure the multiple values that are peeked are the same ones returned via calls to `pickAndAdd`.
+TEST(BucketedSchedulerTest, ManyPeekahead) {
+  BucketedScheduler<uint32_t> sched1;
+  BucketedScheduler<uint32_t> sched2;
+  constexpr uint32_t num_entries = 128;
+  std::shared_ptr<uint32_t> entries[num_entries];
+
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    entries[i] = std::make_shared<uint32_t>(i);
+    sched1.add(1, entries[i]);
+    sched2.add(1, entries[i]);
+  }
+
+  std::vector<uint32_t> picks;
+  for (uint32_t rounds = 0; rounds < 10; ++rounds) {
+    picks.push_back(*sched1.peekAgain({}));
+  }
+
+  for (uint32_t rounds = 0; rounds < 10; ++rounds) {
+    auto p1 = sched1.pickAndAdd({});
+    auto p2 = sched2.pickAndAdd({});
+    EXPECT_EQ(picks[rounds], *p1);
+    EXPECT_EQ(*p2, *p1);
+  }
+}
+
+// Validate that a weight change at pick time moves the object to its new bucket and that the new
+// weight is honored going forward.
+TEST(BucketedSchedulerTest, WeightChangeMovesBucket) {
+  BucketedScheduler<uint32_t> sched;
+  auto e1 = std::make_shared<uint32_t>(0);
+  auto e2 = std::make_shared<uint32_t>(1);
+  sched.add(1, e1);
+  sched.add(1, e2);
+
+  // Promote e1 to weight 3 the first time it is picked.
+  bool promoted = false;
+  auto calculate_weight = [&promoted](const uint32_t& obj) -> double {
+    if (obj == 0 && !promoted) {
+      promoted = true;
+      return 3;
+    }
+    return obj == 0 ? 3 : 1;
+  };
+
+  uint32_t pick_count[2] = {0, 0};
+  constexpr uint32_t picks = 400;
+  for (uint32_t i = 0; i < picks; ++i) {
+    ++pick_count[*sched.pickAndAdd(calculate_weight)];
+  }
+
+  // After the move, e1 should be picked roughly 3x as often as e2.
+  EXPECT_NEAR(3.0, static_cast<double>(pick_count[0]) / pick_count[1], 0.1);
+}
+
+// A new object added mid-stream joins at the current pass rather than monopolizing the schedule.
+TEST(BucketedSchedulerTest, LateAddDoesNotMonopolize) {
+  BucketedScheduler<uint32_t> sched;
+  auto e1 = std::make_shared<uint32_t>(0);
+  auto e2 = std::make_shared<uint32_t>(1);
+  sched.add(1, e1);
+  for (int i = 0; i < 1000; ++i) {
+    sched.pickAndAdd({});
+  }
+  sched.add(2, e2);
+
+  uint32_t pick_count[2] = {0, 0};
+  for (uint32_t i = 0; i < 300; ++i) {
+    ++pick_count[*sched.pickAndAdd({})];
+  }
+  EXPECT_NEAR(100, pick_count[0], 3);
+  EXPECT_NEAR(200, pick_count[1], 3);
+}
+
+} // namespace
+} // namespace Upstream
+} // namespace Envoy
@@ -322,6 +322,46 @@ TEST_F(ConnPoolMapImplTest, GetPoolLimitHitManyIdleOnlyOneFreed) {
   EXPECT_EQ(test_map->size(), 3);
 }
 
+// Show that when the limit is hit, the least recently used idle pool is the one evicted, not
+// an arbitrary idle pool.
+TEST_F(ConnPoolMapImplTest, GetPoolEvictsLeastRecentlyUsedIdlePool) {
+  TestMapPtr test_map = makeTestMapWithLimit(3);
+
+  test_map->getPool(1, getBasicFactory());
+  test_map->getPool(2, getBasicFactory());
+  test_map->getPool(3, getBasicFactory());
+
+  // Touch pool 1 so that pool 2 becomes the least recently used.
+  test_map->getPool(1, getNeverCalledFactory());
+
+  // This should force out pool 2.
+  auto opt_pool = test_map->getPool(4, getBasicFactory());
+  ASSERT_TRUE(opt_pool.has_value());
+  EXPECT_EQ(test_map->size(), 3);
+
+  // Pools 1 and 3 remain mapped, so getting them must not invoke the factory.
+  EXPECT_TRUE(test_map->getPool(1, getNeverCalledFactory()).has_value());
+  EXPECT_TRUE(test_map->getPool(3, getNeverCalledFactory()).has_value());
+}
+
+// Show that a busy least recently used pool is skipped in favor of the next least recently
+// used idle pool.
+TEST_F(ConnPoolMapImplTest, GetPoolEvictionSkipsBusyLeastRecentlyUsedPool) {
+  TestMapPtr test_map = makeTestMapWithLimit(3);
+
+  test_map->getPool(1, getActivePoolFactory());
+  test_map->getPool(2, getBasicFactory());
+  test_map->getPool(3, getBasicFactory());
+
+  // Pool 1 is the least recently used but has active connections, so pool 2 should be the
+  // one evicted.
+  auto opt_pool = test_map->getPool(4, getBasicFactory());
+  ASSERT_TRUE(opt_pool.has_value());
+  EXPECT_EQ(test_map->size(), 3);
+  EXPECT_TRUE(test_map->getPool(1, getNeverCalledFactory()).has_value());
+  EXPECT_TRUE(test_map->getPool(3, getNeverCalledFactory()).has_value());
+}
+
 // Show that if we hit the limit once, then again with the same keys, we don't clean out the
 // previously cleaned entries. Essentially, ensure we clean up any state related to being full.
 TEST_F(ConnPoolMapImplTest, GetPoolFailStateIsCleared) {
@@ -27,6 +27,7 @@
 #include "test/mocks/upstream/mocks.h"
 #include "test/test_common/environment.h"
 #include "test/test_common/simulated_time_system.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
 #include "absl/strings/str_format.h"
@@ -800,6 +801,46 @@ TEST_F(HdsTest, TestSameSpecifier) {
   checkHdsCounters(3, 0, 0, 2);
 }
 
+// Check that with response suppression enabled, reporting intervals whose endpoint health state
+// is unchanged do not send a response, and a full snapshot is still sent periodically for resync.
+TEST_F(HdsTest, TestUnchangedResponseSuppressed) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.hds_suppress_unchanged_responses", "true"}});
+
+  EXPECT_CALL(*async_client_, startRaw(_, _, _, _)).WillOnce(Return(&async_stream_));
+  EXPECT_CALL(async_stream_, sendMessageRaw_(_, _));
+  createHdsDelegate();
+
+  // Create Message
+  message.reset(createSimpleMessage());
+
+  // Create a new active connection on request, setting its status to connected
+  // to mock a found endpoint.
+  expectCreateClientConnection();
+
+  EXPECT_CALL(*server_response_timer_, enableTimer(_, _)).Times(AtLeast(1));
+  EXPECT_CALL(test_factory_, createClusterInfo(_)).WillRepeatedly(Return(cluster_info_));
+  EXPECT_CALL(server_context_.dispatcher_, deferredDelete_(_)).Times(AtLeast(1));
+  hds_delegate_->onReceiveMessage(std::move(message));
+
+  // The first response is a full snapshot.
+  EXPECT_CALL(async_stream_, sendMessageRaw_(_, false));
+  hds_delegate_->sendResponse();
+
+  // Nothing changed, so the following reporting intervals do not send anything.
+  hds_delegate_->sendResponse();
+  hds_delegate_->sendResponse();
+  EXPECT_EQ(2, hds_delegate_friend_.getStats(*hds_delegate_).responses_suppressed_.value());
+
+  // After enough suppressed intervals, a full snapshot is sent again for resync.
+  EXPECT_CALL(async_stream_, sendMessageRaw_(_, false));
+  for (uint32_t i = 0; i < 8; ++i) {
+    hds_delegate_->sendResponse();
+  }
+  EXPECT_EQ(9, hds_delegate_friend_.getStats(*hds_delegate_).responses_suppressed_.value());
+}
+
 // Test to see that if a cluster is added or removed, the ones that did not change are reused.
 TEST_F(HdsTest, TestClusterChange) {
   EXPECT_CALL(*async_client_, startRaw(_, _, _, _)).WillOnce(Return(&async_stream_));
@@ -872,6 +872,68 @@ TEST_F(HttpHealthCheckerImplTest, Success) {
             cluster_->prioritySet().getMockHostSet(0)->hosts_[0]->coarseHealth());
 }
 
+// With the shared interval timer feature enabled, all sessions schedule their next probe on one
+// scheduler timer instead of per-host interval timers, and every session that is due when the
+// timer fires is probed in the same tick.
+TEST_F(HttpHealthCheckerImplTest, SharedIntervalTimerBatchesDueProbes) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.health_check_shared_interval_timer", "true"}});
+  setupNoServiceValidationHC();
+  EXPECT_CALL(*this, onHostStatus(_, _)).Times(testing::AnyNumber());
+
+  cluster_->prioritySet().getMockHostSet(0)->hosts_ = {
+      makeTestHost(cluster_->info_, "tcp://127.0.0.1:80", simTime()),
+      makeTestHost(cluster_->info_, "tcp://127.0.0.1:81", simTime())};
+  cluster_->info_->trafficStats()->upstream_cx_total_.inc();
+
+  // Each session only creates its timeout timer; there are no per-host interval timers.
+  // expectSessionCreate() would queue a mock for one, so mirror just what is created here. Timer
+  // expectations are satisfied in LIFO order, so allocate in reverse session order.
+  test_sessions_.emplace_back(std::make_unique<TestSession>());
+  test_sessions_.emplace_back(std::make_unique<TestSession>());
+  test_sessions_[1]->timeout_timer_ = new Event::MockTimer(&dispatcher_);
+  test_sessions_[0]->timeout_timer_ = new Event::MockTimer(&dispatcher_);
+  expectClientCreate(0);
+  expectClientCreate(1);
+
+  expectStreamCreate(0);
+  expectStreamCreate(1);
+  EXPECT_CALL(*test_sessions_[0]->timeout_timer_, enableTimer(_, _));
+  EXPECT_CALL(*test_sessions_[1]->timeout_timer_, enableTimer(_, _));
+  health_checker_->start();
+
+  // The first completed probe lazily creates the single scheduler timer; both sessions then
+  // schedule their next probe on it for one interval out.
+  Event::MockTimer* scheduler_timer = new Event::MockTimer(&dispatcher_);
+  EXPECT_CALL(*scheduler_timer, enableTimer(std::chrono::milliseconds(1000), _)).Times(2);
+  EXPECT_CALL(*test_sessions_[0]->timeout_timer_, disableTimer());
+  EXPECT_CALL(*test_sessions_[1]->timeout_timer_, disableTimer());
+  respond(0, "200", false);
+  respond(1, "200", false);
+  EXPECT_EQ(Host::Health::Healthy,
+            cluster_->prioritySet().getMockHostSet(0)->hosts_[0]->coarseHealth());
+  EXPECT_EQ(Host::Health::Healthy,
+            cluster_->prioritySet().getMockHostSet(0)->hosts_[1]->coarseHealth());
+
+  // One tick of the shared timer probes both due sessions and, with nothing left pending, the
+  // timer is disabled until the probes complete.
+  expectStreamCreate(0);
+  expectStreamCreate(1);
+  EXPECT_CALL(*test_sessions_[0]->timeout_timer_, enableTimer(_, _));
+  EXPECT_CALL(*test_sessions_[1]->timeout_timer_, enableTimer(_, _));
+  EXPECT_CALL(*scheduler_timer, disableTimer());
+  simTime().advanceTimeWait(std::chrono::milliseconds(1000));
+  scheduler_timer->invokeCallback();
+
+  // A failed probe also reschedules through the shared timer.
+  EXPECT_CALL(*scheduler_timer, enableTimer(std::chrono::milliseconds(1000), _)).Times(2);
+  EXPECT_CALL(*test_sessions_[0]->timeout_timer_, disableTimer());
+  EXPECT_CALL(*test_sessions_[1]->timeout_timer_, disableTimer());
+  respond(0, "503", false);
+  respond(1, "200", false);
+}
+
 TEST_F(HttpHealthCheckerImplTest, Degraded) {
   setupNoServiceValidationHC();
   EXPECT_CALL(*this, onHostStatus(_, HealthTransition::Changed)).Times(2);
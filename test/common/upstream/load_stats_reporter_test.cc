@@ -12,6 +12,7 @@
 #include "test/mocks/upstream/cluster_manager.h"
 #include "test/mocks/upstream/cluster_priority_set.h"
 #include "test/test_common/simulated_time_system.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
 #include "gmock/gmock.h"
@@ -223,6 +224,69 @@ TEST_F(LoadStatsReporterTest, ExistingClusters) {
   response_timer_cb_();
 }
 
+// Validate that tracked clusters with no load since the last report are omitted from the
+// request, and that the report interval for such clusters keeps accumulating until they are
+// included again.
+TEST_F(LoadStatsReporterTest, OmitsClustersWithNoLoad) {
+  EXPECT_CALL(*async_client_, startRaw(_, _, _, _)).WillOnce(Return(&async_stream_));
+  expectSendMessage({});
+  createLoadStatsReporter();
+  time_system_.setMonotonicTime(std::chrono::microseconds(3));
+  NiceMock<MockClusterMockPrioritySet> foo_cluster;
+  NiceMock<MockClusterMockPrioritySet> bar_cluster;
+  MockClusterManager::ClusterInfoMaps cluster_info{
+      {{"foo", foo_cluster}, {"bar", bar_cluster}}, {}, {}};
+  ON_CALL(cm_, clusters()).WillByDefault(Return(cluster_info));
+  deliverLoadStatsResponse({"foo", "bar"});
+
+  // Only bar sees traffic, so only bar is reported.
+  bar_cluster.info_->load_report_stats_.upstream_rq_dropped_.add(3);
+  time_system_.setMonotonicTime(std::chrono::microseconds(4));
+  {
+    envoy::config::endpoint::v3::ClusterStats bar_cluster_stats;
+    bar_cluster_stats.set_cluster_name("bar");
+    bar_cluster_stats.set_total_dropped_requests(3);
+    bar_cluster_stats.mutable_load_report_interval()->MergeFrom(
+        Protobuf::util::TimeUtil::MicrosecondsToDuration(1));
+    expectSendMessage({bar_cluster_stats});
+  }
+  EXPECT_CALL(*response_timer_, enableTimer(std::chrono::milliseconds(42000), _));
+  response_timer_cb_();
+
+  // Traffic shifts to foo; its report interval covers the whole window since tracking started,
+  // not just the last tick, and idle bar is now the one omitted.
+  foo_cluster.info_->load_report_stats_.upstream_rq_dropped_.add(2);
+  time_system_.setMonotonicTime(std::chrono::microseconds(9));
+  {
+    envoy::config::endpoint::v3::ClusterStats foo_cluster_stats;
+    foo_cluster_stats.set_cluster_name("foo");
+    foo_cluster_stats.set_total_dropped_requests(2);
+    foo_cluster_stats.mutable_load_report_interval()->MergeFrom(
+        Protobuf::util::TimeUtil::MicrosecondsToDuration(6));
+    expectSendMessage({foo_cluster_stats});
+  }
+  EXPECT_CALL(*response_timer_, enableTimer(std::chrono::milliseconds(42000), _));
+  response_timer_cb_();
+
+  // With the runtime feature disabled, idle clusters are reported with empty deltas.
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues({{"envoy.reloadable_features.omit_empty_lrs_cluster_stats", "false"}});
+  time_system_.setMonotonicTime(std::chrono::microseconds(11));
+  {
+    envoy::config::endpoint::v3::ClusterStats foo_cluster_stats;
+    foo_cluster_stats.set_cluster_name("foo");
+    foo_cluster_stats.mutable_load_report_interval()->MergeFrom(
+        Protobuf::util::TimeUtil::MicrosecondsToDuration(2));
+    envoy::config::endpoint::v3::ClusterStats bar_cluster_stats;
+    bar_cluster_stats.set_cluster_name("bar");
+    bar_cluster_stats.mutable_load_report_interval()->MergeFrom(
+        Protobuf::util::TimeUtil::MicrosecondsToDuration(7));
+    expectSendMessage({bar_cluster_stats, foo_cluster_stats});
+  }
+  EXPECT_CALL(*response_timer_, enableTimer(std::chrono::milliseconds(42000), _));
+  response_timer_cb_();
+}
+
 HostSharedPtr makeTestHost(const std::string& hostname,
                            const ::envoy::config::core::v3::Locality& locality) {
   const auto host = std::make_shared<NiceMock<::Envoy::Upstream::MockHost>>();
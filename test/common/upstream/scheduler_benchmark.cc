@@ -4,6 +4,7 @@
 #include <random>
 
 #include "source/common/common/random_generator.h"
+#include "source/common/upstream/bucketed_scheduler.h"
 #include "source/common/upstream/edf_scheduler.h"
 #include "source/common/upstream/wrsq_scheduler.h"
 
@@ -159,6 +160,42 @@ void uniqueWeightPickWRSQ(::benchmark::State& state) {
                             });
 }
 
+void splitWeightAddBucketed(::benchmark::State& state) {
+  BucketedScheduler<SchedulerTester::ObjInfo> bucketed;
+  const size_t num_objs = state.range(0);
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    SchedulerTester::setupSplitWeights(bucketed, num_objs, state);
+  }
+}
+
+void uniqueWeightAddBucketed(::benchmark::State& state) {
+  BucketedScheduler<SchedulerTester::ObjInfo> bucketed;
+  const size_t num_objs = state.range(0);
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    SchedulerTester::setupUniqueWeights(bucketed, num_objs, state);
+  }
+}
+
+void splitWeightPickBucketed(::benchmark::State& state) {
+  BucketedScheduler<SchedulerTester::ObjInfo> bucketed;
+  const size_t num_objs = state.range(0);
+
+  SchedulerTester::pickTest(bucketed, state,
+                            [num_objs, &state](Scheduler<SchedulerTester::ObjInfo>& sched) {
+                              return SchedulerTester::setupSplitWeights(sched, num_objs, state);
+                            });
+}
+
+void uniqueWeightPickBucketed(::benchmark::State& state) {
+  BucketedScheduler<SchedulerTester::ObjInfo> bucketed;
+  const size_t num_objs = state.range(0);
+
+  SchedulerTester::pickTest(bucketed, state,
+                            [num_objs, &state](Scheduler<SchedulerTester::ObjInfo>& sched) {
+                              return SchedulerTester::setupUniqueWeights(sched, num_objs, state);
+                            });
+}
+
 BENCHMARK(splitWeightAddEdf)
     ->Unit(::benchmark::kMicrosecond)
     ->RangeMultiplier(8)
@@ -167,8 +204,13 @@ BENCHMARK(splitWeightAddWRSQ)
     ->Unit(::benchmark::kMicrosecond)
     ->RangeMultiplier(8)
     ->Range(1 << 6, 1 << 14);
+BENCHMARK(splitWeightAddBucketed)
+    ->Unit(::benchmark::kMicrosecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 14);
 BENCHMARK(splitWeightPickEdf)->RangeMultiplier(8)->Range(1 << 6, 1 << 14);
 BENCHMARK(splitWeightPickWRSQ)->RangeMultiplier(8)->Range(1 << 6, 1 << 14);
+BENCHMARK(splitWeightPickBucketed)->RangeMultiplier(8)->Range(1 << 6, 1 << 14);
 BENCHMARK(uniqueWeightAddEdf)
     ->Unit(::benchmark::kMicrosecond)
     ->RangeMultiplier(8)
@@ -177,8 +219,13 @@ BENCHMARK(uniqueWeightAddWRSQ)
     ->Unit(::benchmark::kMicrosecond)
     ->RangeMultiplier(8)
     ->Range(1 << 6, 1 << 14);
+BENCHMARK(uniqueWeightAddBucketed)
+    ->Unit(::benchmark::kMicrosecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 14);
 BENCHMARK(uniqueWeightPickEdf)->RangeMultiplier(8)->Range(1 << 6, 1 << 14);
 BENCHMARK(uniqueWeightPickWRSQ)->RangeMultiplier(8)->Range(1 << 6, 1 << 14);
+BENCHMARK(uniqueWeightPickBucketed)->RangeMultiplier(8)->Range(1 << 6, 1 << 14);
 
 } // namespace
 } // namespace Upstream
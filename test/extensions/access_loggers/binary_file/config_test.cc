@@ -0,0 +1,112 @@
+#include "envoy/config/accesslog/v3/accesslog.pb.h"
+#include "envoy/data/accesslog/v3/accesslog.pb.h"
+#include "envoy/extensions/access_loggers/binary_file/v3/binary_file.pb.h"
+#include "envoy/registry/registry.h"
+
+#include "source/common/access_log/access_log_impl.h"
+#include "source/common/protobuf/protobuf.h"
+#include "source/extensions/access_loggers/binary_file/config.h"
+
+#include "test/mocks/server/factory_context.h"
+#include "test/test_common/utility.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+namespace Envoy {
+namespace Extensions {
+namespace AccessLoggers {
+namespace BinaryFile {
+namespace {
+
+TEST(BinaryFileAccessLogNegativeTest, ValidateFail) {
+  NiceMock<Server::Configuration::MockServerFactoryContext> context;
+
+  EXPECT_THROW(
+      BinaryFileAccessLogFactory().createAccessLogInstance(
+          envoy::extensions::access_loggers::binary_file::v3::BinaryFileAccessLog(), nullptr,
+          context),
+      ProtoValidationException);
+}
+
+class BinaryFileAccessLogTest : public testing::Test {
+public:
+  ProtobufWkt::Any runTest(AccessLog::AccessLogType access_log_type) {
+    envoy::extensions::access_loggers::binary_file::v3::BinaryFileAccessLog fal_config;
+    fal_config.set_path("/foo");
+
+    envoy::config::accesslog::v3::AccessLog config;
+    config.mutable_typed_config()->PackFrom(fal_config);
+
+    auto file = std::make_shared<AccessLog::MockAccessLogFile>();
+    Filesystem::FilePathAndType file_info{Filesystem::DestinationType::File, fal_config.path()};
+    EXPECT_CALL(context_.access_log_manager_, createAccessLog(file_info)).WillOnce(Return(file));
+
+    AccessLog::InstanceSharedPtr logger = AccessLog::AccessLogFactory::fromProto(config, context_);
+
+    stream_info_.upstreamInfo()->setUpstreamHost(nullptr);
+    stream_info_.setResponseCode(200);
+
+    std::string written;
+    EXPECT_CALL(*file, write(_)).WillOnce(Invoke([&written](absl::string_view got) {
+      written = std::string(got);
+    }));
+    logger->log(&request_headers_, &response_headers_, &response_trailers_, stream_info_,
+                access_log_type);
+
+    // Each record is a gRPC-style frame: zero flag byte, 32-bit big-endian length, then a
+    // serialized Any.
+    EXPECT_GE(written.size(), 5);
+    EXPECT_EQ(0, written[0]);
+    const uint32_t length = (static_cast<uint8_t>(written[1]) << 24) |
+                            (static_cast<uint8_t>(written[2]) << 16) |
+                            (static_cast<uint8_t>(written[3]) << 8) |
+                            static_cast<uint8_t>(written[4]);
+    EXPECT_EQ(written.size() - 5, length);
+
+    ProtobufWkt::Any record;
+    EXPECT_TRUE(record.ParseFromString(written.substr(5)));
+    return record;
+  }
+
+  Http::TestRequestHeaderMapImpl request_headers_{{":method", "GET"}, {":path", "/bar/foo"}};
+  Http::TestResponseHeaderMapImpl response_headers_;
+  Http::TestResponseTrailerMapImpl response_trailers_;
+  NiceMock<StreamInfo::MockStreamInfo> stream_info_;
+
+  NiceMock<Server::Configuration::MockServerFactoryContext> context_;
+};
+
+TEST_F(BinaryFileAccessLogTest, HttpEntry) {
+  const ProtobufWkt::Any record = runTest(AccessLog::AccessLogType::DownstreamEnd);
+  ASSERT_TRUE(record.Is<envoy::data::accesslog::v3::HTTPAccessLogEntry>());
+
+  envoy::data::accesslog::v3::HTTPAccessLogEntry entry;
+  ASSERT_TRUE(record.UnpackTo(&entry));
+  EXPECT_EQ("/bar/foo", entry.request().path());
+  EXPECT_EQ(envoy::config::core::v3::GET, entry.request().request_method());
+  EXPECT_EQ(200, entry.response().response_code().value());
+  EXPECT_EQ(envoy::data::accesslog::v3::AccessLogType::DownstreamEnd,
+            entry.common_properties().access_log_type());
+}
+
+TEST_F(BinaryFileAccessLogTest, TcpEntry) {
+  const ProtobufWkt::Any record = runTest(AccessLog::AccessLogType::TcpConnectionEnd);
+  ASSERT_TRUE(record.Is<envoy::data::accesslog::v3::TCPAccessLogEntry>());
+
+  envoy::data::accesslog::v3::TCPAccessLogEntry entry;
+  ASSERT_TRUE(record.UnpackTo(&entry));
+  EXPECT_EQ(envoy::data::accesslog::v3::AccessLogType::TcpConnectionEnd,
+            entry.common_properties().access_log_type());
+}
+
+} // namespace
+} // namespace BinaryFile
+} // namespace AccessLoggers
+} // namespace Extensions
+} // namespace Envoy
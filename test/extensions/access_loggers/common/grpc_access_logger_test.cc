@@ -18,6 +18,7 @@
 #include "test/mocks/thread_local/mocks.h"
 
 using testing::_;
+using testing::AtLeast;
 using testing::InSequence;
 using testing::Invoke;
 using testing::NiceMock;
@@ -113,7 +114,9 @@ public:
 
   void initLogger(std::chrono::milliseconds buffer_flush_interval_msec, size_t buffer_size_bytes) {
     timer_ = new Event::MockTimer(&dispatcher_);
-    EXPECT_CALL(*timer_, enableTimer(buffer_flush_interval_msec, _));
+    // The timer is armed on construction and re-armed by every flush, including size-triggered
+    // ones.
+    EXPECT_CALL(*timer_, enableTimer(buffer_flush_interval_msec, _)).Times(AtLeast(1));
     config_.mutable_buffer_size_bytes()->set_value(buffer_size_bytes);
     config_.mutable_buffer_flush_interval()->set_nanos(
         std::chrono::duration_cast<std::chrono::nanoseconds>(buffer_flush_interval_msec).count());
@@ -202,9 +205,11 @@ TEST_F(StreamingGrpcAccessLogTest, WatermarksOverrun) {
   InSequence s;
   initLogger(FlushInterval, 1);
 
-  // Start a stream for the first log.
+  // Start a stream for the first log. Every flush re-arms the flush timer before attempting to
+  // write.
   MockAccessLogStream stream;
   AccessLogCallbacks* callbacks;
+  EXPECT_CALL(*timer_, enableTimer(FlushInterval, _));
   expectStreamStart(stream, &callbacks);
 
   // Fail to flush, so the log stays buffered up.
@@ -219,6 +224,7 @@ TEST_F(StreamingGrpcAccessLogTest, WatermarksOverrun) {
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
 
   // Now canLogMore will fail, and the next log will be dropped.
+  EXPECT_CALL(*timer_, enableTimer(FlushInterval, _));
   EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillOnce(Return(true));
   EXPECT_CALL(stream, sendMessageRaw_(_, _)).Times(0);
   logger_->log(mockHttpEntry());
@@ -232,8 +238,10 @@ TEST_F(StreamingGrpcAccessLogTest, WatermarksOverrun) {
 
   // Now allow the flush to happen. The stored log will get logged, and the next log will
   // succeed.
+  EXPECT_CALL(*timer_, enableTimer(FlushInterval, _));
   EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillOnce(Return(false));
   EXPECT_CALL(stream, sendMessageRaw_(_, _));
+  EXPECT_CALL(*timer_, enableTimer(FlushInterval, _));
   EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillOnce(Return(false));
   EXPECT_CALL(stream, sendMessageRaw_(_, _));
   logger_->log(mockHttpEntry());
@@ -347,7 +355,9 @@ public:
 
   void initLogger(std::chrono::milliseconds buffer_flush_interval_msec, size_t buffer_size_bytes) {
     timer_ = new Event::MockTimer(&dispatcher_);
-    EXPECT_CALL(*timer_, enableTimer(buffer_flush_interval_msec, _));
+    // The timer is armed on construction and re-armed by every flush, including size-triggered
+    // ones.
+    EXPECT_CALL(*timer_, enableTimer(buffer_flush_interval_msec, _)).Times(AtLeast(1));
     config_.mutable_buffer_size_bytes()->set_value(buffer_size_bytes);
     config_.mutable_buffer_flush_interval()->set_nanos(
         std::chrono::duration_cast<std::chrono::nanoseconds>(buffer_flush_interval_msec).count());
@@ -15,6 +15,7 @@
 #include "test/mocks/thread_local/mocks.h"
 
 using testing::_;
+using testing::AtLeast;
 using testing::Invoke;
 using testing::NiceMock;
 using testing::Return;
@@ -70,7 +71,7 @@ public:
   GrpcAccessLoggerImplTest()
       : async_client_(new Grpc::MockAsyncClient), timer_(new Event::MockTimer(&dispatcher_)),
         grpc_access_logger_impl_test_helper_(local_info_, async_client_) {
-    EXPECT_CALL(*timer_, enableTimer(_, _));
+    EXPECT_CALL(*timer_, enableTimer(_, _)).Times(AtLeast(1));
     *config_.mutable_log_name() = "test_log_name";
     config_.mutable_buffer_size_bytes()->set_value(BUFFER_SIZE_BYTES);
     config_.mutable_buffer_flush_interval()->set_nanos(
@@ -19,6 +19,7 @@
 #include "opentelemetry/proto/resource/v1/resource.pb.h"
 
 using testing::_;
+using testing::AtLeast;
 using testing::Invoke;
 using testing::NiceMock;
 using testing::ReturnRef;
@@ -73,7 +74,7 @@ public:
   GrpcAccessLoggerImplTest()
       : async_client_(new Grpc::MockAsyncClient), timer_(new Event::MockTimer(&dispatcher_)),
         grpc_access_logger_impl_test_helper_(local_info_, async_client_, true) {
-    EXPECT_CALL(*timer_, enableTimer(_, _));
+    EXPECT_CALL(*timer_, enableTimer(_, _)).Times(AtLeast(1));
     *config_.mutable_common_config()->mutable_log_name() = "test_log_name";
     config_.mutable_common_config()->mutable_buffer_size_bytes()->set_value(BUFFER_SIZE_BYTES);
     config_.mutable_common_config()->mutable_buffer_flush_interval()->set_nanos(
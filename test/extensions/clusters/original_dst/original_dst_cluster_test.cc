@@ -106,6 +106,12 @@ public:
     }
   }
 
+  // Lowers the number of host map entries the cleanup pass scans per timer
+  // tick so tests can exercise multi-tick cleanup cycles with few hosts.
+  void setCleanupScanBudget(size_t budget) {
+    cluster_->max_hosts_scanned_per_cleanup_tick_ = budget;
+  }
+
   NiceMock<Server::Configuration::MockServerFactoryContext> server_context_;
   Stats::TestUtil::TestStore& stats_store_ = server_context_.store_;
   Ssl::MockContextManager ssl_context_manager_;
@@ -309,6 +315,59 @@ TEST_F(OriginalDstClusterTest, AddressCollision) {
   EXPECT_EQ(1UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
 }
 
+// With a scan budget smaller than the host map, the cleanup pass spreads its scan over
+// multiple timer ticks (resuming from a cursor) and applies removals in one batch once the
+// full map has been scanned.
+TEST_F(OriginalDstClusterTest, CleanupScanBudget) {
+  std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 1.250s
+    type: ORIGINAL_DST
+    lb_policy: CLUSTER_PROVIDED
+  )EOF";
+
+  EXPECT_CALL(initialized_, ready());
+  setupFromYaml(yaml);
+  setCleanupScanBudget(2);
+
+  // Create three hosts for three distinct downstream destinations.
+  Event::PostCb post_cb;
+  for (const char* address : {"10.10.11.11", "10.10.11.12", "10.10.11.13"}) {
+    NiceMock<Network::MockConnection> connection;
+    TestLoadBalancerContext lb_context(&connection);
+    connection.stream_info_.downstream_connection_info_provider_->restoreLocalAddress(
+        std::make_shared<Network::Address::Ipv4Instance>(address));
+    EXPECT_CALL(server_context_.dispatcher_, post(_)).WillOnce([&post_cb](Event::PostCb cb) {
+      post_cb = std::move(cb);
+    });
+    EXPECT_CALL(membership_updated_, ready());
+    // Mock the cluster manager by recreating the load balancer each time to get a fresh host map
+    HostConstSharedPtr host = OriginalDstCluster::LoadBalancer(handle_).chooseHost(&lb_context);
+    ASSERT_NE(host, nullptr);
+    post_cb();
+  }
+  EXPECT_EQ(3UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+
+  // The first cycle only clears the used bits. With a budget of two, scanning the three
+  // entries takes two ticks; the second tick re-arms with the full cleanup interval.
+  EXPECT_CALL(*cleanup_timer_, enableTimer(std::chrono::milliseconds(0), _));
+  cleanup_timer_->invokeCallback();
+  EXPECT_EQ(3UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+  EXPECT_CALL(*cleanup_timer_, enableTimer(std::chrono::milliseconds(5000), _));
+  cleanup_timer_->invokeCallback();
+  EXPECT_EQ(3UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+
+  // The second cycle finds all three entries stale; nothing is removed until the scan
+  // completes on its second tick, at which point all hosts go away together.
+  EXPECT_CALL(*cleanup_timer_, enableTimer(std::chrono::milliseconds(0), _));
+  cleanup_timer_->invokeCallback();
+  EXPECT_EQ(3UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+  EXPECT_CALL(*cleanup_timer_, enableTimer(std::chrono::milliseconds(5000), _));
+  EXPECT_CALL(membership_updated_, ready());
+  cleanup_timer_->invokeCallback();
+  EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+}
+
 TEST_F(OriginalDstClusterTest, HostInUse) {
   std::string yaml = R"EOF(
     name: name
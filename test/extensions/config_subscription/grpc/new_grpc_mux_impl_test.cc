@@ -46,6 +46,42 @@ namespace {
 
 enum class LegacyOrUnified { Legacy, Unified };
 
+// An xDS resources delegate for testing the delta mux wiring; keeps persisted resources in an
+// in-memory map keyed by resource name.
+class TestXdsResourcesDelegate : public XdsResourcesDelegate {
+public:
+  void onConfigUpdated(const XdsSourceId&, const std::vector<DecodedResourceRef>&) override {}
+
+  void onConfigUpdated(const XdsSourceId&,
+                       const std::vector<envoy::service::discovery::v3::Resource>& added_resources,
+                       const Protobuf::RepeatedPtrField<std::string>& removed_resources) override {
+    for (const auto& resource : added_resources) {
+      resources_[resource.name()] = resource;
+    }
+    for (const std::string& resource_name : removed_resources) {
+      resources_.erase(resource_name);
+    }
+  }
+
+  std::vector<envoy::service::discovery::v3::Resource>
+  getResources(const XdsSourceId&,
+               const absl::flat_hash_set<std::string>& resource_names) const override {
+    std::vector<envoy::service::discovery::v3::Resource> resources;
+    for (const std::string& resource_name : resource_names) {
+      auto it = resources_.find(resource_name);
+      if (it != resources_.end()) {
+        resources.push_back(it->second);
+      }
+    }
+    return resources;
+  }
+
+  void onResourceLoadFailed(const XdsSourceId&, const std::string&,
+                            const absl::optional<EnvoyException>&) override {}
+
+  absl::flat_hash_map<std::string, envoy::service::discovery::v3::Resource> resources_;
+};
+
 // We test some mux specific stuff below, other unit test coverage for singleton use of
 // NewGrpcMuxImpl is provided in [grpc_]subscription_impl_test.cc.
 class NewGrpcMuxImplTestBase : public testing::TestWithParam<LegacyOrUnified> {
@@ -73,7 +109,7 @@ public:
         /*rate_limit_settings_=*/rate_limit_settings_,
         /*scope_=*/*stats_.rootScope(),
         /*config_validators_=*/std::move(config_validators_),
-        /*xds_resources_delegate_=*/XdsResourcesDelegateOptRef(),
+        /*xds_resources_delegate_=*/makeOptRefFromPtr(xds_resources_delegate_),
         /*xds_config_tracker_=*/XdsConfigTrackerOptRef(),
         /*backoff_strategy_=*/std::move(backoff_strategy),
         /*target_xds_authority_=*/"",
@@ -176,6 +212,8 @@ public:
   Stats::Gauge& control_plane_connected_state_;
   bool should_use_unified_;
   MockEdsResourcesCache* eds_resources_cache_{nullptr};
+  // Set before calling setup() to pass an xDS resources delegate to the mux.
+  XdsResourcesDelegate* xds_resources_delegate_{nullptr};
 };
 
 class NewGrpcMuxImplTest : public NewGrpcMuxImplTestBase {
@@ -763,6 +801,99 @@ TEST_P(NewGrpcMuxImplTest, AddRemoveSubscriptions) {
   }
 }
 
+// Validate that accepted delta updates are handed to the xDS resources delegate for local
+// persistence, including removals.
+TEST_P(NewGrpcMuxImplTest, XdsResourcesDelegatePersistsAcceptedResources) {
+  if (isUnifiedMuxTest()) {
+    // The unified mux does not support the xDS resources delegate for delta xDS.
+    return;
+  }
+  TestXdsResourcesDelegate delegate;
+  xds_resources_delegate_ = &delegate;
+  setup();
+  InSequence s;
+  const std::string& type_url = Config::TypeUrl::get().ClusterLoadAssignment;
+  auto watch = grpc_mux_->addWatch(type_url, {"x"}, callbacks_, resource_decoder_, {});
+
+  EXPECT_CALL(*async_client_, startRaw(_, _, _, _)).WillOnce(Return(&async_stream_));
+  expectSendMessage(type_url, {"x"}, {});
+  grpc_mux_->start();
+
+  {
+    auto response = std::make_unique<envoy::service::discovery::v3::DeltaDiscoveryResponse>();
+    response->set_type_url(type_url);
+    response->set_system_version_info("1");
+    envoy::config::endpoint::v3::ClusterLoadAssignment load_assignment;
+    load_assignment.set_cluster_name("x");
+    auto res = response->add_resources();
+    res->set_name("x");
+    res->set_version("1");
+    res->mutable_resource()->PackFrom(load_assignment);
+
+    EXPECT_CALL(callbacks_, onConfigUpdate(_, _, "1"));
+    expectSendMessage(type_url, {}, {}); // Ack.
+    onDiscoveryResponse(std::move(response));
+    EXPECT_EQ(1, delegate.resources_.size());
+    EXPECT_EQ("1", delegate.resources_["x"].version());
+  }
+
+  // A response removing the resource should erase it from the delegate as well.
+  {
+    auto response = std::make_unique<envoy::service::discovery::v3::DeltaDiscoveryResponse>();
+    response->set_type_url(type_url);
+    response->set_system_version_info("2");
+    *response->add_removed_resources() = "x";
+
+    EXPECT_CALL(callbacks_, onConfigUpdate(_, _, "2"));
+    expectSendMessage(type_url, {}, {}); // Ack.
+    onDiscoveryResponse(std::move(response));
+    EXPECT_TRUE(delegate.resources_.empty());
+  }
+
+  expectSendMessage(type_url, {}, {"x"});
+}
+
+// Validate that on connection failure the locally persisted resources are loaded from the xDS
+// resources delegate and delivered to the watchers, and that they are only loaded once.
+TEST_P(NewGrpcMuxImplTest, XdsResourcesDelegateWarmStartsOnEstablishmentFailure) {
+  if (isUnifiedMuxTest()) {
+    // The unified mux does not support the xDS resources delegate for delta xDS.
+    return;
+  }
+  TestXdsResourcesDelegate delegate;
+  {
+    envoy::config::endpoint::v3::ClusterLoadAssignment load_assignment;
+    load_assignment.set_cluster_name("x");
+    envoy::service::discovery::v3::Resource persisted;
+    persisted.set_name("x");
+    persisted.set_version("1");
+    persisted.mutable_resource()->PackFrom(load_assignment);
+    delegate.resources_["x"] = persisted;
+  }
+  xds_resources_delegate_ = &delegate;
+  setup();
+  const std::string& type_url = Config::TypeUrl::get().ClusterLoadAssignment;
+  auto watch = grpc_mux_->addWatch(type_url, {"x"}, callbacks_, resource_decoder_, {});
+
+  // On the first failure the watchers are notified, and then receive the persisted config.
+  EXPECT_CALL(callbacks_,
+              onConfigUpdateFailed(Config::ConfigUpdateFailureReason::ConnectionFailure, _));
+  EXPECT_CALL(callbacks_, onConfigUpdate(_, _, ""))
+      .WillOnce(Invoke([](const std::vector<DecodedResourceRef>& added_resources,
+                          const Protobuf::RepeatedPtrField<std::string>&, const std::string&) {
+        EXPECT_EQ(1, added_resources.size());
+        EXPECT_EQ("x", added_resources[0].get().name());
+        EXPECT_EQ("1", added_resources[0].get().version());
+        return absl::OkStatus();
+      }));
+  dynamic_cast<NewGrpcMuxImpl*>(grpc_mux_.get())->onEstablishmentFailure();
+
+  // Subsequent failures do not reload the persisted config.
+  EXPECT_CALL(callbacks_,
+              onConfigUpdateFailed(Config::ConfigUpdateFailureReason::ConnectionFailure, _));
+  dynamic_cast<NewGrpcMuxImpl*>(grpc_mux_.get())->onEstablishmentFailure();
+}
+
 } // namespace
 } // namespace Config
 } // namespace Envoy
@@ -463,6 +463,19 @@ TEST_F(LocalRateLimiterDescriptorImplTest,
   EXPECT_TRUE(rate_limiter_->requestAllowed(descriptor_));
 }
 
+// Verify that duplicate request descriptors consume a configured bucket only once.
+TEST_F(LocalRateLimiterDescriptorImplTest, DuplicateRequestDescriptor) {
+  TestUtility::loadFromYaml(fmt::format(fmt::runtime(single_descriptor_config_yaml), 2, 2, "0.1s"),
+                            *descriptors_.Add());
+  initializeWithDescriptor(std::chrono::milliseconds(50), 2, 2);
+  std::vector<RateLimit::LocalDescriptor> descriptors{{{{"foo2", "bar2"}}}, {{{"foo2", "bar2"}}}};
+
+  // 2 -> 1 -> 0 tokens; each request charges the bucket once despite the duplicate.
+  EXPECT_TRUE(rate_limiter_->requestAllowed(descriptors));
+  EXPECT_TRUE(rate_limiter_->requestAllowed(descriptors));
+  EXPECT_FALSE(rate_limiter_->requestAllowed(descriptors));
+}
+
 // Verify token bucket status of max tokens, remaining tokens and remaining fill interval.
 TEST_F(LocalRateLimiterDescriptorImplTest, TokenBucketDescriptorStatus) {
   TestUtility::loadFromYaml(fmt::format(fmt::runtime(single_descriptor_config_yaml), 2, 2, "3s"),
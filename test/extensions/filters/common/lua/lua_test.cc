@@ -133,6 +133,56 @@ TEST_F(LuaTest, YieldAndResume) {
   lua_gc(cr->luaState(), LUA_GCCOLLECT, 0);
 }
 
+// Coroutines that ran to completion are recycled and reuse the underlying thread.
+TEST_F(LuaTest, CoroutineRecycling) {
+  const std::string SCRIPT{R"EOF(
+    function callMe(object)
+    end
+  )EOF"};
+
+  setup(SCRIPT);
+  EXPECT_NE(LUA_REFNIL, state_->getGlobalRef(state_->registerGlobal("callMe", initializers_)));
+
+  CoroutinePtr cr(state_->createCoroutine());
+  lua_State* const underlying_state = cr->luaState();
+  cr->start(state_->getGlobalRef(0), 0, yield_callback_);
+  EXPECT_EQ(cr->state(), Coroutine::State::Finished);
+  state_->recycleCoroutine(std::move(cr));
+
+  // The next coroutine comes from the pool and can run the function again.
+  CoroutinePtr cr2(state_->createCoroutine());
+  EXPECT_EQ(underlying_state, cr2->luaState());
+  EXPECT_EQ(cr2->state(), Coroutine::State::NotStarted);
+  cr2->start(state_->getGlobalRef(0), 0, yield_callback_);
+  EXPECT_EQ(cr2->state(), Coroutine::State::Finished);
+}
+
+// Coroutines that did not run to completion are not recycled.
+TEST_F(LuaTest, YieldedCoroutineNotRecycled) {
+  const std::string SCRIPT{R"EOF(
+    function callMe(object)
+      coroutine.yield()
+    end
+  )EOF"};
+
+  setup(SCRIPT);
+  EXPECT_NE(LUA_REFNIL, state_->getGlobalRef(state_->registerGlobal("callMe", initializers_)));
+
+  CoroutinePtr cr(state_->createCoroutine());
+  lua_State* const underlying_state = cr->luaState();
+  EXPECT_CALL(on_yield_, ready());
+  cr->start(state_->getGlobalRef(0), 0, yield_callback_);
+  EXPECT_EQ(cr->state(), Coroutine::State::Yielded);
+
+  // Stop the GC so that the rejected thread cannot be collected and its address reused by the
+  // allocation below, which would make the inequality check flaky.
+  lua_gc(underlying_state, LUA_GCSTOP, 0);
+  state_->recycleCoroutine(std::move(cr));
+
+  CoroutinePtr cr2(state_->createCoroutine());
+  EXPECT_NE(underlying_state, cr2->luaState());
+}
+
 // Mark dead/live and ref counting across coroutines.
 TEST_F(LuaTest, MarkDead) {
   const std::string SCRIPT{R"EOF(
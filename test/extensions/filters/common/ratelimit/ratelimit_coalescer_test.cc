@@ -0,0 +1,221 @@
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "envoy/service/ratelimit/v3/rls.pb.h"
+
+#include "source/common/grpc/common.h"
+#include "source/common/tracing/http_tracer_impl.h"
+#include "source/extensions/filters/common/ratelimit/ratelimit_coalescer.h"
+#include "source/extensions/filters/common/ratelimit/ratelimit_impl.h"
+
+#include "test/mocks/grpc/mocks.h"
+#include "test/mocks/stream_info/mocks.h"
+#include "test/mocks/tracing/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+namespace Envoy {
+namespace Extensions {
+namespace Filters {
+namespace Common {
+namespace RateLimit {
+namespace {
+
+class MockRequestCallbacks : public RequestCallbacks {
+public:
+  void complete(LimitStatus status, DescriptorStatusListPtr&& descriptor_statuses,
+                Http::ResponseHeaderMapPtr&& response_headers_to_add,
+                Http::RequestHeaderMapPtr&& request_headers_to_add,
+                const std::string& response_body, DynamicMetadataPtr&& dynamic_metadata) override {
+    complete_(status, descriptor_statuses.get(), response_headers_to_add.get(),
+              request_headers_to_add.get(), response_body, dynamic_metadata.get());
+  }
+
+  MOCK_METHOD(void, complete_,
+              (LimitStatus status, const DescriptorStatusList* descriptor_statuses,
+               const Http::ResponseHeaderMap* response_headers_to_add,
+               const Http::RequestHeaderMap* request_headers_to_add,
+               const std::string& response_body, const ProtobufWkt::Struct* dynamic_metadata));
+};
+
+class RateLimitCoalescerTest : public testing::Test {
+public:
+  RateLimitCoalescerTest()
+      : async_client_(std::make_shared<Grpc::MockAsyncClient>()),
+        coalescer_(std::make_shared<Coalescer>(absl::optional<std::chrono::milliseconds>())),
+        client_a_(coalescer_, async_client_), client_b_(coalescer_, async_client_) {}
+
+  // Captures the raw callbacks of the next RPC so the test can complete it.
+  auto captureRpc(Grpc::RawAsyncRequestCallbacks** callbacks) {
+    return Invoke([this, callbacks](absl::string_view, absl::string_view, Buffer::InstancePtr&&,
+                                    Grpc::RawAsyncRequestCallbacks& rpc_callbacks, Tracing::Span&,
+                                    const Http::AsyncClient::RequestOptions&)
+                      -> Grpc::AsyncRequest* {
+      *callbacks = &rpc_callbacks;
+      return &async_request_;
+    });
+  }
+
+  void respond(Grpc::RawAsyncRequestCallbacks& callbacks,
+               envoy::service::ratelimit::v3::RateLimitResponse::Code code) {
+    envoy::service::ratelimit::v3::RateLimitResponse response;
+    response.set_overall_code(code);
+    callbacks.onSuccessRaw(Grpc::Common::serializeMessage(response), span_);
+  }
+
+  std::shared_ptr<Grpc::MockAsyncClient> async_client_;
+  Grpc::MockAsyncRequest async_request_;
+  CoalescerSharedPtr coalescer_;
+  CoalescingClientImpl client_a_;
+  CoalescingClientImpl client_b_;
+  MockRequestCallbacks request_callbacks_a_;
+  MockRequestCallbacks request_callbacks_b_;
+  NiceMock<Tracing::MockSpan> span_;
+  StreamInfo::MockStreamInfo stream_info_;
+};
+
+// An identical call made while an RPC is in flight does not produce a second RPC; the queued
+// waiter is folded into one follow-up RPC once the first verdict arrives, and each waiter gets
+// the verdict of the RPC it rode on.
+TEST_F(RateLimitCoalescerTest, CoalesceIdenticalInFlight) {
+  Grpc::RawAsyncRequestCallbacks* first_rpc{};
+  envoy::service::ratelimit::v3::RateLimitRequest first_request;
+  GrpcClientImpl::createRequest(first_request, "foo", {{{{"foo", "bar"}}}}, 0);
+  EXPECT_CALL(*async_client_, sendRaw(_, _, Grpc::ProtoBufferEq(first_request), _, _, _))
+      .WillOnce(captureRpc(&first_rpc));
+
+  client_a_.limit(request_callbacks_a_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+  // Identical tuple while in flight: no RPC is sent.
+  client_b_.limit(request_callbacks_b_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+
+  // Completing the first RPC fans its verdict out to the leader and sends one follow-up RPC for
+  // the queued waiter.
+  Grpc::RawAsyncRequestCallbacks* second_rpc{};
+  envoy::service::ratelimit::v3::RateLimitRequest second_request;
+  GrpcClientImpl::createRequest(second_request, "foo", {{{{"foo", "bar"}}}}, 1);
+  EXPECT_CALL(*async_client_, sendRaw(_, _, Grpc::ProtoBufferEq(second_request), _, _, _))
+      .WillOnce(captureRpc(&second_rpc));
+  EXPECT_CALL(request_callbacks_a_, complete_(LimitStatus::OverLimit, _, _, _, _, _));
+  respond(*first_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OVER_LIMIT);
+
+  EXPECT_CALL(request_callbacks_b_, complete_(LimitStatus::OK, _, _, _, _, _));
+  respond(*second_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OK);
+}
+
+// Queued waiters are batched into a single follow-up RPC whose hits_addend is the sum of the
+// queued hits, and its verdict is fanned out to all of them.
+TEST_F(RateLimitCoalescerTest, BatchSumsHitsAndFansOut) {
+  CoalescingClientImpl client_c(coalescer_, async_client_);
+  MockRequestCallbacks request_callbacks_c;
+
+  Grpc::RawAsyncRequestCallbacks* first_rpc{};
+  EXPECT_CALL(*async_client_, sendRaw(_, _, _, _, _, _)).WillOnce(captureRpc(&first_rpc));
+  client_a_.limit(request_callbacks_a_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+  client_b_.limit(request_callbacks_b_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_, 2);
+  client_c.limit(request_callbacks_c, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                 stream_info_, 3);
+
+  Grpc::RawAsyncRequestCallbacks* second_rpc{};
+  envoy::service::ratelimit::v3::RateLimitRequest batched_request;
+  GrpcClientImpl::createRequest(batched_request, "foo", {{{{"foo", "bar"}}}}, 5);
+  EXPECT_CALL(*async_client_, sendRaw(_, _, Grpc::ProtoBufferEq(batched_request), _, _, _))
+      .WillOnce(captureRpc(&second_rpc));
+  EXPECT_CALL(request_callbacks_a_, complete_(LimitStatus::OK, _, _, _, _, _));
+  respond(*first_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OK);
+
+  EXPECT_CALL(request_callbacks_b_, complete_(LimitStatus::OverLimit, _, _, _, _, _));
+  EXPECT_CALL(request_callbacks_c, complete_(LimitStatus::OverLimit, _, _, _, _, _));
+  respond(*second_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OVER_LIMIT);
+}
+
+// Distinct descriptor tuples are not coalesced.
+TEST_F(RateLimitCoalescerTest, DistinctTuplesSentImmediately) {
+  Grpc::RawAsyncRequestCallbacks* first_rpc{};
+  Grpc::RawAsyncRequestCallbacks* second_rpc{};
+  EXPECT_CALL(*async_client_, sendRaw(_, _, _, _, _, _))
+      .WillOnce(captureRpc(&first_rpc))
+      .WillOnce(captureRpc(&second_rpc));
+
+  client_a_.limit(request_callbacks_a_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+  client_b_.limit(request_callbacks_b_, "foo", {{{{"other", "tuple"}}}},
+                  Tracing::NullSpan::instance(), stream_info_);
+  EXPECT_NE(first_rpc, second_rpc);
+
+  EXPECT_CALL(request_callbacks_a_, complete_(LimitStatus::OK, _, _, _, _, _));
+  respond(*first_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OK);
+  EXPECT_CALL(request_callbacks_b_, complete_(LimitStatus::OK, _, _, _, _, _));
+  respond(*second_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OK);
+}
+
+// A cancelled queued waiter is dropped from the batch; if nothing remains queued, no follow-up
+// RPC is sent. The in-flight RPC itself is never cancelled.
+TEST_F(RateLimitCoalescerTest, CancelQueuedWaiter) {
+  Grpc::RawAsyncRequestCallbacks* first_rpc{};
+  EXPECT_CALL(*async_client_, sendRaw(_, _, _, _, _, _)).WillOnce(captureRpc(&first_rpc));
+  client_a_.limit(request_callbacks_a_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+  client_b_.limit(request_callbacks_b_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+
+  client_b_.cancel();
+
+  EXPECT_CALL(request_callbacks_a_, complete_(LimitStatus::OK, _, _, _, _, _));
+  respond(*first_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OK);
+}
+
+// A cancelled leader no longer gets a verdict, but the RPC is left to complete so the queued
+// waiter still rides the follow-up.
+TEST_F(RateLimitCoalescerTest, CancelLeader) {
+  Grpc::RawAsyncRequestCallbacks* first_rpc{};
+  EXPECT_CALL(*async_client_, sendRaw(_, _, _, _, _, _)).WillOnce(captureRpc(&first_rpc));
+  client_a_.limit(request_callbacks_a_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+  client_b_.limit(request_callbacks_b_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+
+  client_a_.cancel();
+
+  Grpc::RawAsyncRequestCallbacks* second_rpc{};
+  EXPECT_CALL(*async_client_, sendRaw(_, _, _, _, _, _)).WillOnce(captureRpc(&second_rpc));
+  respond(*first_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OK);
+
+  EXPECT_CALL(request_callbacks_b_, complete_(LimitStatus::OK, _, _, _, _, _));
+  respond(*second_rpc, envoy::service::ratelimit::v3::RateLimitResponse::OK);
+}
+
+// RPC failure is fanned out as an error verdict; the queued batch is still attempted.
+TEST_F(RateLimitCoalescerTest, FailureFansOut) {
+  Grpc::RawAsyncRequestCallbacks* first_rpc{};
+  EXPECT_CALL(*async_client_, sendRaw(_, _, _, _, _, _)).WillOnce(captureRpc(&first_rpc));
+  client_a_.limit(request_callbacks_a_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+  client_b_.limit(request_callbacks_b_, "foo", {{{{"foo", "bar"}}}}, Tracing::NullSpan::instance(),
+                  stream_info_);
+
+  Grpc::RawAsyncRequestCallbacks* second_rpc{};
+  EXPECT_CALL(*async_client_, sendRaw(_, _, _, _, _, _)).WillOnce(captureRpc(&second_rpc));
+  EXPECT_CALL(request_callbacks_a_, complete_(LimitStatus::Error, _, _, _, _, _));
+  first_rpc->onFailure(Grpc::Status::Unknown, "", span_);
+
+  EXPECT_CALL(request_callbacks_b_, complete_(LimitStatus::Error, _, _, _, _, _));
+  second_rpc->onFailure(Grpc::Status::Unavailable, "", span_);
+}
+
+} // namespace
+} // namespace RateLimit
+} // namespace Common
+} // namespace Filters
+} // namespace Extensions
+} // namespace Envoy
@@ -246,6 +246,65 @@ TEST(RoleBasedAccessControlEngineImpl, DeniedDenylist) {
   checkEngine(engine, true, LogResult::Undecided, info, conn, headers);
 }
 
+// Policies whose principals are all direct_remote_ip ranges go through the LC trie prefilter;
+// verify that matching, non-matching and fallback (non-indexable) policies behave as in the
+// sequential path, including the reported effective policy ID.
+TEST(RoleBasedAccessControlEngineImpl, IpIndexedPolicies) {
+  envoy::config::rbac::v3::Policy indexed_a;
+  indexed_a.add_permissions()->set_any(true);
+  auto* cidr_a = indexed_a.add_principals()->mutable_direct_remote_ip();
+  cidr_a->set_address_prefix("10.0.0.0");
+  cidr_a->mutable_prefix_len()->set_value(8);
+
+  envoy::config::rbac::v3::Policy indexed_b;
+  indexed_b.add_permissions()->set_any(true);
+  auto* cidr_b = indexed_b.add_principals()->mutable_direct_remote_ip();
+  cidr_b->set_address_prefix("192.168.1.0");
+  cidr_b->mutable_prefix_len()->set_value(24);
+
+  // Not indexable; always evaluated sequentially.
+  envoy::config::rbac::v3::Policy header_policy;
+  header_policy.add_permissions()->set_any(true);
+  auto* header = header_policy.add_principals()->mutable_header();
+  header->set_name("user");
+  header->mutable_string_match()->set_exact("admin");
+
+  envoy::config::rbac::v3::RBAC rbac;
+  rbac.set_action(envoy::config::rbac::v3::RBAC::ALLOW);
+  (*rbac.mutable_policies())["a-indexed"] = indexed_a;
+  (*rbac.mutable_policies())["b-indexed"] = indexed_b;
+  (*rbac.mutable_policies())["c-header"] = header_policy;
+  RBAC::RoleBasedAccessControlEngineImpl engine(rbac,
+                                                ProtobufMessage::getStrictValidationVisitor());
+
+  Envoy::Network::MockConnection conn;
+  Envoy::Http::TestRequestHeaderMapImpl headers;
+  NiceMock<StreamInfo::MockStreamInfo> info;
+
+  Envoy::Network::Address::InstanceConstSharedPtr addr =
+      Envoy::Network::Utility::parseInternetAddress("10.1.2.3", 123, false);
+  info.downstream_connection_info_provider_->setDirectRemoteAddressForTest(addr);
+  std::string effective_id;
+  EXPECT_TRUE(engine.handleAction(conn, headers, info, &effective_id));
+  EXPECT_EQ("a-indexed", effective_id);
+
+  addr = Envoy::Network::Utility::parseInternetAddress("192.168.1.50", 123, false);
+  info.downstream_connection_info_provider_->setDirectRemoteAddressForTest(addr);
+  effective_id.clear();
+  EXPECT_TRUE(engine.handleAction(conn, headers, info, &effective_id));
+  EXPECT_EQ("b-indexed", effective_id);
+
+  // Address outside both ranges: only the header policy can match.
+  addr = Envoy::Network::Utility::parseInternetAddress("172.16.0.1", 123, false);
+  info.downstream_connection_info_provider_->setDirectRemoteAddressForTest(addr);
+  checkEngine(engine, false, LogResult::Undecided, info, conn, headers);
+
+  Envoy::Http::TestRequestHeaderMapImpl admin_headers{{"user", "admin"}};
+  effective_id.clear();
+  EXPECT_TRUE(engine.handleAction(conn, admin_headers, info, &effective_id));
+  EXPECT_EQ("c-header", effective_id);
+}
+
 TEST(RoleBasedAccessControlEngineImpl, BasicCondition) {
   envoy::config::rbac::v3::Policy policy;
   policy.add_permissions()->set_any(true);
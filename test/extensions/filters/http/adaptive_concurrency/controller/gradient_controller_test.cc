@@ -123,6 +123,7 @@ sample_aggregate_percentile:
 concurrency_limit_params:
   max_concurrency_limit: 1337
   concurrency_update_interval: 0.123s
+  latency_sample_rate: 4
 min_rtt_calc_params:
   jitter:
     value: 13.2
@@ -140,6 +141,7 @@ min_rtt_calc_params:
   EXPECT_EQ(config.sampleAggregatePercentile(), .425);
   EXPECT_EQ(config.jitterPercent(), .132);
   EXPECT_EQ(config.minConcurrency(), 8);
+  EXPECT_EQ(config.latencySampleRate(), 4);
 }
 
 TEST_F(GradientControllerConfigTest, Clamping) {
@@ -171,6 +173,10 @@ min_rtt_calc_params:
   EXPECT_EQ(config.jitterPercent(), 1.0);
   EXPECT_CALL(runtime_.snapshot_, getDouble(_, 13.2)).WillOnce(Return(-50.5));
   EXPECT_EQ(config.jitterPercent(), 0.0);
+
+  // Should be clamped to a minimum of 1.
+  EXPECT_CALL(runtime_.snapshot_, getInteger(_, 1)).WillOnce(Return(0));
+  EXPECT_EQ(config.latencySampleRate(), 1);
 }
 
 TEST_F(GradientControllerConfigTest, BasicTestOverrides) {
@@ -181,6 +187,7 @@ concurrency_limit_params:
   max_concurrency_limit: 1337
   concurrency_update_interval:
     nanos: 123000000
+  latency_sample_rate: 4
 min_rtt_calc_params:
   buffer:
     value: 33
@@ -217,6 +224,9 @@ min_rtt_calc_params:
 
   EXPECT_CALL(runtime_.snapshot_, getDouble(_, 33.0)).WillOnce(Return(77.0));
   EXPECT_EQ(config.minRTTBufferPercent(), .77);
+
+  EXPECT_CALL(runtime_.snapshot_, getInteger(_, 4)).WillOnce(Return(16));
+  EXPECT_EQ(config.latencySampleRate(), 16);
 }
 
 TEST_F(GradientControllerConfigTest, DefaultValuesTest) {
@@ -237,6 +247,7 @@ min_rtt_calc_params:
   EXPECT_EQ(config.jitterPercent(), .15);
   EXPECT_EQ(config.minConcurrency(), 3);
   EXPECT_EQ(config.minRTTBufferPercent(), 0.25);
+  EXPECT_EQ(config.latencySampleRate(), 1);
 }
 
 // Verify that requests started in the previous minRTT window are not sampled in the next.
@@ -397,6 +408,59 @@ min_rtt_calc_params:
   tryForward(controller, false);
 }
 
+// Verify that latency samples are thinned at the configured rate outside of the minRTT
+// recalculation windows.
+TEST_F(GradientControllerTest, LatencySampleRate) {
+  const std::string yaml = R"EOF(
+sample_aggregate_percentile:
+  value: 50
+concurrency_limit_params:
+  max_concurrency_limit:
+  concurrency_update_interval: 0.1s
+  latency_sample_rate: 3
+min_rtt_calc_params:
+  jitter:
+    value: 0.0
+  interval: 30s
+  request_count: 5
+)EOF";
+
+  auto controller = makeController(yaml);
+
+  // Samples losing the 1-in-3 draw are not recorded outside of the minRTT window.
+  EXPECT_CALL(random_, random()).WillRepeatedly(Return(1));
+
+  // Every request is sampled during the minRTT measurement window regardless of the sample rate,
+  // so the measurement completes after the configured request count.
+  verifyMinRTTActive();
+  advancePastMinRTTStage(controller, yaml, std::chrono::milliseconds(5));
+  verifyMinRTTInactive();
+  verifyMinRTTValue(std::chrono::milliseconds(5));
+
+  // A sample window made up entirely of skipped samples leaves the sample RTT untouched.
+  for (int i = 0; i < 5; ++i) {
+    tryForward(controller, true);
+    sampleLatency(controller, std::chrono::milliseconds(10));
+  }
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(101), *dispatcher_,
+                                 Event::Dispatcher::RunType::Block);
+  EXPECT_EQ(
+      0,
+      stats_.gauge("test_prefix.sample_rtt_msecs", Stats::Gauge::ImportMode::NeverImport).value());
+
+  // Samples that win the draw are recorded and drive the next recalculation.
+  EXPECT_CALL(random_, random()).WillRepeatedly(Return(3));
+  for (int i = 0; i < 5; ++i) {
+    tryForward(controller, true);
+    sampleLatency(controller, std::chrono::milliseconds(10));
+  }
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(101), *dispatcher_,
+                                 Event::Dispatcher::RunType::Block);
+  EXPECT_EQ(
+      10,
+      stats_.gauge("test_prefix.sample_rtt_msecs", Stats::Gauge::ImportMode::NeverImport).value());
+}
+
 TEST_F(GradientControllerTest, MinRTTBufferTest) {
   const std::string yaml = R"EOF(
 sample_aggregate_percentile:
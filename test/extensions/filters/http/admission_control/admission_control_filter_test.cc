@@ -242,6 +242,26 @@ TEST_F(AdmissionControlTest, HttpSuccessBehavior) {
   TestUtility::waitForCounterEq(store_, "test_prefix.rq_rejected", 0, time_system_);
 }
 
+// Validate that the rejection probability gauge tracks the computed probability.
+TEST_F(AdmissionControlTest, RejectionProbabilityGauge) {
+  auto config = makeConfig(default_yaml_);
+  setupFilter(config);
+
+  EXPECT_CALL(controller_, averageRps()).WillRepeatedly(Return(99));
+
+  // A 50% success rate against the default 95% threshold yields a rejection probability of
+  // (100 - 50 / 0.95) / 101, roughly 47%.
+  EXPECT_CALL(controller_, requestCounts()).WillRepeatedly(Return(RequestData(100, 50)));
+  Http::TestRequestHeaderMapImpl request_headers;
+  filter_->decodeHeaders(request_headers, true);
+  TestUtility::waitForGaugeEq(store_, "test_prefix.rq_rejection_probability", 47, time_system_);
+
+  // A fully successful window drives the probability back to zero.
+  EXPECT_CALL(controller_, requestCounts()).WillRepeatedly(Return(RequestData(100, 100)));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers, true));
+  TestUtility::waitForGaugeEq(store_, "test_prefix.rq_rejection_probability", 0, time_system_);
+}
+
 // Validate simple gRPC failure case.
 TEST_F(AdmissionControlTest, GrpcFailureBehavior) {
   auto config = makeConfig(default_yaml_);
@@ -3,6 +3,8 @@
 #include "source/extensions/filters/http/bandwidth_limit/bandwidth_limit.h"
 
 #include "test/mocks/http/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
+#include "test/test_common/test_runtime.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -25,8 +27,8 @@ public:
   void setup(const std::string& yaml) {
     envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit config;
     TestUtility::loadFromYaml(yaml, config);
-    config_ =
-        std::make_shared<FilterConfig>(config, *stats_.rootScope(), runtime_, time_system_, true);
+    config_ = std::make_shared<FilterConfig>(config, *stats_.rootScope(), runtime_, time_system_,
+                                             true, &tls_);
     filter_ = std::make_shared<BandwidthLimiter>(config_);
     filter_->setDecoderFilterCallbacks(decoder_filter_callbacks_);
     filter_->setEncoderFilterCallbacks(encoder_filter_callbacks_);
@@ -51,6 +53,7 @@ public:
   NiceMock<Http::MockStreamDecoderFilterCallbacks> decoder_filter_callbacks_;
   NiceMock<Http::MockStreamEncoderFilterCallbacks> encoder_filter_callbacks_;
   NiceMock<Runtime::MockLoader> runtime_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
   std::shared_ptr<FilterConfig> config_;
   std::shared_ptr<BandwidthLimiter> filter_;
   Http::TestRequestHeaderMapImpl request_headers_;
@@ -214,6 +217,56 @@ TEST_F(FilterTest, LimitOnDecode) {
   filter_->onDestroy();
 }
 
+// With the shared fill timer feature enabled, periodic refills for all limited streams on a worker
+// are driven by a single scheduler timer instead of per-stream timers.
+TEST_F(FilterTest, SharedFillTimerOnDecode) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.bandwidth_limit_shared_fill_timer", "true"}});
+
+  // The scheduler timer is created on each worker when the config is instantiated.
+  Event::MockTimer* scheduler_timer = new NiceMock<Event::MockTimer>(&tls_.dispatcher_);
+
+  constexpr absl::string_view config_yaml = R"(
+  stat_prefix: test
+  runtime_enabled:
+    default_value: true
+    runtime_key: foo_key
+  enable_mode: REQUEST
+  limit_kbps: 1
+  )";
+  setup(fmt::format(config_yaml, "1"));
+
+  ON_CALL(decoder_filter_callbacks_, decoderBufferLimit()).WillByDefault(Return(1100));
+  Event::MockTimer* token_timer =
+      new NiceMock<Event::MockTimer>(&decoder_filter_callbacks_.dispatcher_);
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, true));
+
+  // Send two fill intervals worth of data. The immediate kick still uses the per-stream timer,
+  // but the refill wakeup is parked on the shared scheduler timer.
+  EXPECT_CALL(*token_timer, enableTimer(std::chrono::milliseconds(0), _));
+  Buffer::OwnedImpl data1(std::string(102, 'a'));
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->decodeData(data1, false));
+
+  EXPECT_CALL(*scheduler_timer, enableTimer(std::chrono::milliseconds(50), _));
+  EXPECT_CALL(decoder_filter_callbacks_,
+              injectDecodedDataToFilterChain(BufferStringEqual(std::string(51, 'a')), false));
+  token_timer->invokeCallback();
+  EXPECT_EQ(1, findCounter("test.http_bandwidth_limit.request_enforced"));
+  EXPECT_EQ(51, findCounter("test.http_bandwidth_limit.request_allowed_total_size"));
+
+  // The scheduler tick drains the parked stream. Nothing is re-armed since the buffer is empty
+  // afterwards.
+  time_system_.advanceTimeWait(std::chrono::milliseconds(50));
+  EXPECT_CALL(decoder_filter_callbacks_,
+              injectDecodedDataToFilterChain(BufferStringEqual(std::string(51, 'a')), false));
+  scheduler_timer->invokeCallback();
+  EXPECT_EQ(1, findCounter("test.http_bandwidth_limit.request_enforced"));
+  EXPECT_EQ(102, findCounter("test.http_bandwidth_limit.request_allowed_total_size"));
+
+  filter_->onDestroy();
+}
+
 TEST_F(FilterTest, LimitOnEncode) {
   constexpr absl::string_view config_yaml = R"(
   stat_prefix: test
@@ -33,7 +33,7 @@ protected:
   CacheFilterSharedPtr makeFilter(std::shared_ptr<HttpCache> cache, bool auto_destroy = true) {
     std::shared_ptr<CacheFilter> filter(new CacheFilter(config_, /*stats_prefix=*/"",
                                                         context_.scope(), context_.timeSource(),
-                                                        cache),
+                                                        cache, coalescer_),
                                         [auto_destroy](CacheFilter* f) {
                                           if (auto_destroy) {
                                             f->onDestroy();
@@ -163,6 +163,8 @@ protected:
   void waitBeforeSecondRequest() { time_source_.advanceTimeWait(delay_); }
 
   std::shared_ptr<SimpleHttpCache> simple_cache_ = std::make_shared<SimpleHttpCache>();
+  // Set before calling makeFilter to create filters that coalesce upstream fetches.
+  CacheFillCoalescerSharedPtr coalescer_;
   envoy::extensions::filters::http::cache::v3::CacheConfig config_;
   std::shared_ptr<StreamInfo::FilterState> filter_state_ =
       std::make_shared<StreamInfo::FilterStateImpl>(StreamInfo::FilterState::LifeSpan::FilterChain);
@@ -292,6 +294,72 @@ TEST_F(CacheFilterTest, CacheMissWithTrailers) {
   dispatcher_->run(Event::Dispatcher::RunType::Block);
 }
 
+TEST_F(CacheFilterTest, CoalescedMissWaitsForLeaderThenServesFromCache) {
+  request_headers_.setHost("CoalescedMiss");
+  coalescer_ = std::make_shared<CacheFillCoalescer>();
+
+  // The first request misses and becomes the leader for its key.
+  CacheFilterSharedPtr leader = makeFilter(simple_cache_, false);
+  testDecodeRequestMiss(leader);
+
+  // A concurrent request for the same key should wait for the leader instead of
+  // continuing decoding towards upstream.
+  CacheFilterSharedPtr follower = makeFilter(simple_cache_, false);
+  EXPECT_CALL(decoder_callbacks_, continueDecoding).Times(0);
+  EXPECT_EQ(follower->decodeHeaders(request_headers_, true),
+            Http::FilterHeadersStatus::StopAllIterationAndWatermark);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  ::testing::Mock::VerifyAndClearExpectations(&decoder_callbacks_);
+
+  // The leader's response is cached; finishing its stream releases the key and wakes up
+  // the follower, whose retried lookup hits and is served from cache.
+  EXPECT_EQ(leader->encodeHeaders(response_headers_, true), Http::FilterHeadersStatus::Continue);
+  leader->onDestroy();
+
+  EXPECT_CALL(decoder_callbacks_,
+              encodeHeaders_(IsSupersetOfHeaders(response_headers_), true));
+  EXPECT_CALL(decoder_callbacks_, continueDecoding).Times(0);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  ::testing::Mock::VerifyAndClearExpectations(&decoder_callbacks_);
+
+  follower->onStreamComplete();
+  EXPECT_THAT(lookupStatus(), IsOkAndHolds(LookupStatus::CacheHit));
+  follower->onDestroy();
+}
+
+TEST_F(CacheFilterTest, CoalescedMissGoesUpstreamIfLeaderResponseNotCached) {
+  request_headers_.setHost("CoalescedMissUncacheableResponse");
+  coalescer_ = std::make_shared<CacheFillCoalescer>();
+
+  // Responses with "Cache-Control: no-store" are uncacheable.
+  response_headers_.setReferenceKey(Http::CustomHeaders::get().CacheControl, "no-store");
+
+  CacheFilterSharedPtr leader = makeFilter(simple_cache_, false);
+  testDecodeRequestMiss(leader);
+
+  // A concurrent request for the same key waits for the leader.
+  CacheFilterSharedPtr follower = makeFilter(simple_cache_, false);
+  EXPECT_CALL(decoder_callbacks_, continueDecoding).Times(0);
+  EXPECT_EQ(follower->decodeHeaders(request_headers_, true),
+            Http::FilterHeadersStatus::StopAllIterationAndWatermark);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  ::testing::Mock::VerifyAndClearExpectations(&decoder_callbacks_);
+
+  // The leader's response is not cached, so the follower's retried lookup misses again.
+  // The follower should go upstream itself rather than wait for another fetch.
+  EXPECT_EQ(leader->encodeHeaders(response_headers_, true), Http::FilterHeadersStatus::Continue);
+  leader->onDestroy();
+
+  EXPECT_CALL(decoder_callbacks_, continueDecoding);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  ::testing::Mock::VerifyAndClearExpectations(&decoder_callbacks_);
+
+  EXPECT_EQ(follower->encodeHeaders(response_headers_, true), Http::FilterHeadersStatus::Continue);
+  follower->onStreamComplete();
+  EXPECT_THAT(lookupStatus(), IsOkAndHolds(LookupStatus::CacheMiss));
+  follower->onDestroy();
+}
+
 TEST_F(CacheFilterTest, CacheHitNoBody) {
   request_headers_.setHost("CacheHitNoBody");
 
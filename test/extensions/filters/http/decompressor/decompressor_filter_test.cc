@@ -593,6 +593,151 @@ TEST_P(DecompressorFilterTest, NoResponseDecompressionNoTransformPresentInList)
   expectNoDecompression();
 }
 
+TEST_P(DecompressorFilterTest, BudgetedDecompressionDrainsAcrossIterations) {
+  setUpFilter(R"EOF(
+decompressor_library:
+  name: testlib
+  typed_config:
+    "@type": "type.googleapis.com/envoy.extensions.compression.gzip.decompressor.v3.Gzip"
+request_direction_config:
+  common_config:
+    max_inflate_bytes_per_iteration: 16
+response_direction_config:
+  common_config:
+    max_inflate_bytes_per_iteration: 16
+)EOF");
+  auto decompressor = std::make_unique<Compression::Decompressor::MockDecompressor>();
+  auto* decompressor_ptr = decompressor.get();
+  EXPECT_CALL(*decompressor_factory_, createDecompressor(_))
+      .WillOnce(Return(ByMove(std::move(decompressor))));
+  Http::TestRequestHeaderMapImpl headers_before_filter{{"content-encoding", "mock"},
+                                                       {"content-length", "256"}};
+  doHeaders(headers_before_filter, false /* end_stream */);
+
+  // The mock decompressor doubles its input, so a 30 byte chunk inflates to 60 bytes: past the
+  // 16 byte budget after the first 16 byte input slice. The remainder must be finished on a
+  // scheduled callback that injects the output and resumes the stream.
+  EXPECT_CALL(*decompressor_ptr, decompress(_, _))
+      .Times(2)
+      .WillRepeatedly(
+          Invoke([&](const Buffer::Instance& input_buffer, Buffer::Instance& output_buffer) {
+            TestUtility::feedBufferWithRandomCharacters(output_buffer, 2 * input_buffer.length());
+          }));
+  std::vector<Event::PostCb> posted;
+  EXPECT_CALL(decoder_callbacks_.dispatcher_, post(_)).WillRepeatedly([&](Event::PostCb cb) {
+    posted.push_back(std::move(cb));
+  });
+
+  Buffer::OwnedImpl buffer;
+  TestUtility::feedBufferWithRandomCharacters(buffer, 30);
+  if (isRequestDirection()) {
+    Http::TestRequestTrailerMapImpl trailers;
+    EXPECT_CALL(decoder_callbacks_, addDecodedTrailers()).WillOnce(ReturnRef(trailers));
+    EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->decodeData(buffer, true));
+    ASSERT_EQ(1, posted.size());
+    EXPECT_CALL(decoder_callbacks_, injectDecodedDataToFilterChain(_, false))
+        .WillOnce(Invoke([](Buffer::Instance& injected, bool) { EXPECT_EQ(60, injected.length()); }));
+    EXPECT_CALL(decoder_callbacks_, continueDecoding());
+    posted[0]();
+    EXPECT_EQ("30",
+              trailers.get(Http::LowerCaseString("x-envoy-decompressor-testlib-compressed-bytes"))[0]
+                  ->value()
+                  .getStringView());
+    EXPECT_EQ("60", trailers
+                        .get(Http::LowerCaseString(
+                            "x-envoy-decompressor-testlib-uncompressed-bytes"))[0]
+                        ->value()
+                        .getStringView());
+  } else {
+    Http::TestResponseTrailerMapImpl trailers;
+    EXPECT_CALL(encoder_callbacks_, addEncodedTrailers()).WillOnce(ReturnRef(trailers));
+    EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->encodeData(buffer, true));
+    ASSERT_EQ(1, posted.size());
+    EXPECT_CALL(encoder_callbacks_, injectEncodedDataToFilterChain(_, false))
+        .WillOnce(Invoke([](Buffer::Instance& injected, bool) { EXPECT_EQ(60, injected.length()); }));
+    EXPECT_CALL(encoder_callbacks_, continueEncoding());
+    posted[0]();
+    EXPECT_EQ("30",
+              trailers.get(Http::LowerCaseString("x-envoy-decompressor-testlib-compressed-bytes"))[0]
+                  ->value()
+                  .getStringView());
+    EXPECT_EQ("60", trailers
+                        .get(Http::LowerCaseString(
+                            "x-envoy-decompressor-testlib-uncompressed-bytes"))[0]
+                        ->value()
+                        .getStringView());
+  }
+}
+
+TEST_P(DecompressorFilterTest, BudgetedDecompressionPausesOnDownstreamWatermark) {
+  if (isRequestDirection()) {
+    // Watermark pausing only applies to the response direction; there is no equivalent
+    // downstream signal for request data heading upstream.
+    return;
+  }
+  setUpFilter(R"EOF(
+decompressor_library:
+  name: testlib
+  typed_config:
+    "@type": "type.googleapis.com/envoy.extensions.compression.gzip.decompressor.v3.Gzip"
+response_direction_config:
+  common_config:
+    max_inflate_bytes_per_iteration: 16
+)EOF");
+  auto decompressor = std::make_unique<Compression::Decompressor::MockDecompressor>();
+  auto* decompressor_ptr = decompressor.get();
+  EXPECT_CALL(*decompressor_factory_, createDecompressor(_))
+      .WillOnce(Return(ByMove(std::move(decompressor))));
+  Http::TestRequestHeaderMapImpl headers_before_filter{{"content-encoding", "mock"},
+                                                       {"content-length", "256"}};
+  doHeaders(headers_before_filter, false /* end_stream */);
+
+  EXPECT_CALL(*decompressor_ptr, decompress(_, _))
+      .Times(2)
+      .WillRepeatedly(
+          Invoke([&](const Buffer::Instance& input_buffer, Buffer::Instance& output_buffer) {
+            TestUtility::feedBufferWithRandomCharacters(output_buffer, 2 * input_buffer.length());
+          }));
+  std::vector<Event::PostCb> posted;
+  EXPECT_CALL(decoder_callbacks_.dispatcher_, post(_)).WillRepeatedly([&](Event::PostCb cb) {
+    posted.push_back(std::move(cb));
+  });
+
+  Buffer::OwnedImpl buffer;
+  TestUtility::feedBufferWithRandomCharacters(buffer, 30);
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->encodeData(buffer, false));
+  ASSERT_EQ(1, posted.size());
+
+  // Above the high watermark the scheduled resume produces no output.
+  filter_->onAboveWriteBufferHighWatermark();
+  posted[0]();
+  ASSERT_EQ(1, posted.size());
+
+  // Dropping below the low watermark reschedules the drain, which injects all of the output.
+  EXPECT_CALL(encoder_callbacks_, injectEncodedDataToFilterChain(_, false))
+      .WillOnce(Invoke([](Buffer::Instance& injected, bool) { EXPECT_EQ(60, injected.length()); }));
+  filter_->onBelowWriteBufferLowWatermark();
+  ASSERT_EQ(2, posted.size());
+  posted[1]();
+
+  // Trailers arriving once the drain has finished still report the final byte totals before the
+  // stream is resumed.
+  Http::TestResponseTrailerMapImpl trailers;
+  EXPECT_EQ(Http::FilterTrailersStatus::StopIteration, filter_->encodeTrailers(trailers));
+  ASSERT_EQ(3, posted.size());
+  EXPECT_CALL(encoder_callbacks_, continueEncoding());
+  posted[2]();
+  EXPECT_EQ("30",
+            trailers.get(Http::LowerCaseString("x-envoy-decompressor-testlib-compressed-bytes"))[0]
+                ->value()
+                .getStringView());
+  EXPECT_EQ("60", trailers
+                      .get(Http::LowerCaseString(
+                          "x-envoy-decompressor-testlib-uncompressed-bytes"))[0]
+                      ->value()
+                      .getStringView());
+}
+
 TEST_P(DecompressorFilterTest, DecompressionLibraryNotRegistered) {
   EXPECT_THROW(setUpFilter(R"EOF(
 decompressor_library:
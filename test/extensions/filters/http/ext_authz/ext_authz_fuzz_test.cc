@@ -11,6 +11,7 @@
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/network/mocks.h"
 #include "test/mocks/runtime/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
 
 #include "gmock/gmock.h"
 
@@ -67,6 +68,7 @@ public:
   }
 
   NiceMock<Runtime::MockLoader> runtime_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
   NiceMock<Http::MockStreamDecoderFilterCallbacks> decoder_callbacks_;
   NiceMock<Http::MockStreamEncoderFilterCallbacks> encoder_callbacks_;
   Network::Address::InstanceConstSharedPtr addr_;
@@ -93,7 +95,8 @@ DEFINE_PROTO_FUZZER(const envoy::extensions::filters::http::ext_authz::ExtAuthzT
 
   try {
     config = std::make_shared<FilterConfig>(proto_config, *stats_store.rootScope(), mocks.runtime_,
-                                            http_context, "ext_authz_prefix", bootstrap);
+                                            http_context, "ext_authz_prefix", bootstrap,
+                                            mocks.tls_);
   } catch (const EnvoyException& e) {
     ENVOY_LOG_MISC(debug, "EnvoyException during filter config validation: {}", e.what());
     return;
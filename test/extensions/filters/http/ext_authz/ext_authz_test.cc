@@ -24,6 +24,7 @@
 #include "test/mocks/network/mocks.h"
 #include "test/mocks/router/mocks.h"
 #include "test/mocks/runtime/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
 #include "test/mocks/tracing/mocks.h"
 #include "test/mocks/upstream/cluster_manager.h"
 #include "test/proto/helloworld.pb.h"
@@ -59,7 +60,7 @@ public:
       TestUtility::loadFromYaml(yaml, proto_config);
     }
     config_ = std::make_shared<FilterConfig>(proto_config, *stats_store_.rootScope(), runtime_,
-                                             http_context_, "ext_authz_prefix", bootstrap_);
+                                             http_context_, "ext_authz_prefix", bootstrap_, tls_);
     client_ = new Filters::Common::ExtAuthz::MockClient();
     filter_ = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client_});
     filter_->setDecoderFilterCallbacks(decoder_filter_callbacks_);
@@ -131,6 +132,7 @@ public:
   Buffer::OwnedImpl data_;
   NiceMock<Runtime::MockLoader> runtime_;
   NiceMock<Upstream::MockClusterManager> cm_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
   Network::Address::InstanceConstSharedPtr addr_;
   NiceMock<Envoy::Network::MockConnection> connection_;
   Http::ContextImpl http_context_;
@@ -2807,6 +2809,118 @@ TEST_P(HttpFilterTestParam, DisableRequestBodyBufferingOnRoute) {
   EXPECT_EQ(Http::FilterDataStatus::Continue, filter_->decodeData(data_, false));
 }
 
+// Test that an OK decision (including its request header mutations) is replayed from the decision
+// cache for a subsequent request with the same cache key, without calling the authorization
+// service again.
+TEST_F(HttpFilterTest, DecisionCacheHitReplaysOkDecision) {
+  InSequence s;
+
+  initialize(R"EOF(
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    ttl: 10s
+    cache_key_headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy(Http::Headers::get().Method, "GET");
+  request_headers_.addCopy(Http::Headers::get().Host, "example.com");
+  request_headers_.addCopy(LowerCaseString("authorization"), "legit");
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::OK;
+  response.headers_to_set = Http::HeaderVector{{LowerCaseString("x-authz-user"), "alice"}};
+
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                           const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                           const StreamInfo::StreamInfo&) -> void {
+        callbacks.onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+      }));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ("alice", request_headers_.get_("x-authz-user"));
+  EXPECT_EQ(1U, config_->stats().cache_miss_.value());
+
+  // A second request with the same key is served from the cache: no check call is made and the
+  // cached header mutation is still applied.
+  auto* cached_client = new Filters::Common::ExtAuthz::MockClient();
+  filter_ = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{cached_client});
+  filter_->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  filter_->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  Http::TestRequestHeaderMapImpl second_headers{
+      {":method", "GET"}, {":authority", "example.com"}, {"authorization", "legit"}};
+  EXPECT_CALL(*cached_client, check(_, _, _, _)).Times(0);
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(second_headers, false));
+  EXPECT_EQ("alice", second_headers.get_("x-authz-user"));
+  EXPECT_EQ(1U, config_->stats().cache_hit_.value());
+  EXPECT_EQ(2U, config_->stats().ok_.value());
+}
+
+// Test that a denied decision is cached and replayed as a local reply, and that a request with a
+// different cache key does not share the cached decision.
+TEST_F(HttpFilterTest, DecisionCacheHitReplaysDeniedDecision) {
+  InSequence s;
+
+  initialize(R"EOF(
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    ttl: 10s
+    cache_key_headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy(Http::Headers::get().Method, "GET");
+  request_headers_.addCopy(Http::Headers::get().Host, "example.com");
+  request_headers_.addCopy(LowerCaseString("authorization"), "bogus");
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::Denied;
+  response.status_code = Http::Code::Forbidden;
+
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                           const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                           const StreamInfo::StreamInfo&) -> void {
+        callbacks.onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+      }));
+  EXPECT_CALL(decoder_filter_callbacks_, sendLocalReply(Http::Code::Forbidden, _, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(1U, config_->stats().denied_.value());
+
+  // The same key is denied from the cache without another check call.
+  auto* cached_client = new Filters::Common::ExtAuthz::MockClient();
+  filter_ = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{cached_client});
+  filter_->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  filter_->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  Http::TestRequestHeaderMapImpl denied_headers{
+      {":method", "GET"}, {":authority", "example.com"}, {"authorization", "bogus"}};
+  EXPECT_CALL(*cached_client, check(_, _, _, _)).Times(0);
+  EXPECT_CALL(decoder_filter_callbacks_, sendLocalReply(Http::Code::Forbidden, _, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(denied_headers, false));
+  EXPECT_EQ(1U, config_->stats().cache_hit_.value());
+  EXPECT_EQ(2U, config_->stats().denied_.value());
+
+  // A different principal misses the cache and triggers a fresh check.
+  auto* miss_client = new Filters::Common::ExtAuthz::MockClient();
+  filter_ = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{miss_client});
+  filter_->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  filter_->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  Http::TestRequestHeaderMapImpl other_headers{
+      {":method", "GET"}, {":authority", "example.com"}, {"authorization", "legit"}};
+  EXPECT_CALL(*miss_client, check(_, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter_->decodeHeaders(other_headers, false));
+  EXPECT_EQ(2U, config_->stats().cache_miss_.value());
+}
+
 } // namespace
 } // namespace ExtAuthz
 } // namespace HttpFilters
@@ -1796,6 +1796,71 @@ TEST_F(HttpFilterTest, PostStreamingBodies) {
                         false);
 }
 
+// With a streamed-mode send window configured, chunks that arrive while the window is full are
+// coalesced into a single message that is sent once the processor answers an outstanding
+// message, and all the data is still delivered downstream in order.
+TEST_F(HttpFilterTest, PostStreamingBodiesWithSendWindow) {
+  initialize(R"EOF(
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_proc_server"
+  processing_mode:
+    request_body_mode: "STREAMED"
+  max_outstanding_body_messages: 1
+  )EOF");
+
+  HttpTestUtility::addDefaultHeaders(request_headers_);
+  request_headers_.setMethod("POST");
+
+  EXPECT_CALL(decoder_callbacks_, decodingBuffer()).WillRepeatedly(Return(nullptr));
+  EXPECT_EQ(FilterHeadersStatus::StopIteration, filter_->decodeHeaders(request_headers_, false));
+  processRequestHeaders(false, absl::nullopt);
+
+  bool decoding_watermarked = false;
+  setUpDecodingWatermarking(decoding_watermarked);
+
+  Buffer::OwnedImpl want_request_body;
+  Buffer::OwnedImpl got_request_body;
+  EXPECT_CALL(decoder_callbacks_, injectDecodedDataToFilterChain(_, _))
+      .WillRepeatedly(Invoke(
+          [&got_request_body](Buffer::Instance& data, Unused) { got_request_body.move(data); }));
+
+  // The first chunk goes out as its own message. The next two arrive while that message is
+  // still unanswered, so they are coalesced instead of producing more messages.
+  Buffer::OwnedImpl chunk_1;
+  TestUtility::feedBufferWithRandomCharacters(chunk_1, 100);
+  want_request_body.add(chunk_1.toString());
+  EXPECT_EQ(FilterDataStatus::Continue, filter_->decodeData(chunk_1, false));
+  EXPECT_EQ(100, last_request_.request_body().body().size());
+
+  Buffer::OwnedImpl chunk_2;
+  TestUtility::feedBufferWithRandomCharacters(chunk_2, 100);
+  want_request_body.add(chunk_2.toString());
+  EXPECT_EQ(FilterDataStatus::Continue, filter_->decodeData(chunk_2, false));
+
+  Buffer::OwnedImpl chunk_3;
+  TestUtility::feedBufferWithRandomCharacters(chunk_3, 100);
+  want_request_body.add(chunk_3.toString());
+  EXPECT_EQ(FilterDataStatus::StopIterationNoBuffer, filter_->decodeData(chunk_3, true));
+  EXPECT_EQ(2, config_->stats().body_chunks_coalesced_.value());
+
+  // Answering the first message releases the coalesced data as a single message carrying the
+  // remaining 200 bytes and the end-of-stream flag.
+  processRequestBody(absl::nullopt, false);
+  EXPECT_EQ(200, last_request_.request_body().body().size());
+  EXPECT_TRUE(last_request_.request_body().end_of_stream());
+  processRequestBody(absl::nullopt);
+
+  EXPECT_EQ(want_request_body.toString(), got_request_body.toString());
+  EXPECT_FALSE(decoding_watermarked);
+
+  filter_->onDestroy();
+
+  // One headers message plus two body messages for three data callbacks.
+  EXPECT_EQ(3, config_->stats().stream_msgs_sent_.value());
+  EXPECT_EQ(3, config_->stats().stream_msgs_received_.value());
+}
+
 // Using a configuration with streaming set for the request and
 // response bodies, ensure that the chunks are delivered to the processor and
 // that the processor gets them correctly when some data comes in before the
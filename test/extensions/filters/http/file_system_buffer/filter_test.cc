@@ -551,6 +551,37 @@ TEST_F(FileSystemBufferFilterTest, BufferingToDiskBothWaysWorksAsExpected) {
   EXPECT_EQ("ABCDEFGHIJKLMNOPQRSTUVWXYZ1234", response_sent_on_);
 }
 
+TEST_F(FileSystemBufferFilterTest, CoalescesSmallFragmentsIntoOneSpillWrite) {
+  createFilterFromYaml(R"(
+    manager_config:
+      thread_pool:
+        thread_count: 1
+    request:
+      memory_buffer_bytes_limit: 10
+      behavior:
+        fully_buffer: {}
+  )");
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+  Buffer::OwnedImpl chunk1{"abc"};
+  Buffer::OwnedImpl chunk2{"defg"};
+  Buffer::OwnedImpl chunk3{"hijkl"};
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->decodeData(chunk1, false));
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->decodeData(chunk2, false));
+  expectAsyncFileCreated();
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->decodeData(chunk3, false));
+  // The two most recent fragments fit in one target-sized write, so they are merged and
+  // spilled together; the earliest fragment stays in memory.
+  auto handle = completeCreateFileAndExpectWrite("defghijkl");
+  completeWriteOfSize(9);
+  Buffer::OwnedImpl empty_buffer{""};
+  expectRead(handle, 0, 9);
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, filter_->decodeData(empty_buffer, true));
+  completeRead("defghijkl");
+  EXPECT_EQ("abcdefghijkl", request_sent_on_);
+  EXPECT_TRUE(continued_decoding_);
+}
+
 TEST_F(FileSystemBufferFilterTest, RequestTrailersArePostponedUntilStreamComplete) {
   createFilterFromYaml(R"(
     manager_config:
@@ -117,6 +117,28 @@ TEST_F(GrpcStatsFilterConfigTest, StatsHttp2NormalResponse) {
   EXPECT_FALSE(stream_info_.filterState()->hasDataWithName("envoy.filters.http.grpc_stats"));
 }
 
+// Verify that repeated requests for the same method, which hit the symbolized stat name cache
+// after the first request, accumulate into the same stats.
+TEST_F(GrpcStatsFilterConfigTest, StatsForAllMethodsRepeatedMethod) {
+  config_.mutable_stats_for_all_methods()->set_value(true);
+  initialize();
+  Http::TestRequestHeaderMapImpl request_headers{
+      {"content-type", "application/grpc"},
+      {":path", "/lyft.users.BadCompanions/GetBadCompanions"}};
+
+  doRequestResponse(request_headers);
+  doRequestResponse(request_headers);
+
+  EXPECT_EQ(2UL, decoder_callbacks_.clusterInfo()
+                     ->statsScope()
+                     .counterFromString("grpc.lyft.users.BadCompanions.GetBadCompanions.success")
+                     .value());
+  EXPECT_EQ(2UL, decoder_callbacks_.clusterInfo()
+                     ->statsScope()
+                     .counterFromString("grpc.lyft.users.BadCompanions.GetBadCompanions.total")
+                     .value());
+}
+
 TEST_F(GrpcStatsFilterConfigTest, StatsConnectUnaryHeaderOnly) {
   config_.mutable_stats_for_all_methods()->set_value(true);
   initialize();
@@ -9,6 +9,7 @@
 #include "source/extensions/filters/http/health_check/health_check.h"
 
 #include "test/mocks/server/factory_context.h"
+#include "test/mocks/thread_local/mocks.h"
 #include "test/mocks/upstream/cluster_info.h"
 #include "test/test_common/printers.h"
 #include "test/test_common/utility.h"
@@ -45,18 +46,26 @@ public:
 
   void prepareFilter(
       bool pass_through,
-      ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages = nullptr) {
+      ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages = nullptr,
+      bool use_cluster_status_cache = false) {
     header_data_ = std::make_shared<std::vector<Http::HeaderUtility::HeaderDataPtr>>();
     envoy::config::route::v3::HeaderMatcher matcher;
     matcher.set_name(":path");
     matcher.mutable_string_match()->set_exact("/healthcheck");
     header_data_->emplace_back(std::make_unique<Http::HeaderUtility::HeaderData>(matcher));
+    ClusterStatusCacheSharedPtr cluster_status_cache;
+    if (use_cluster_status_cache) {
+      cluster_status_cache = std::make_shared<ClusterStatusCache>(
+          cluster_min_healthy_percentages, context_.cluster_manager_, tls_);
+    }
     filter_ = std::make_unique<HealthCheckFilter>(context_, pass_through, cache_manager_,
-                                                  header_data_, cluster_min_healthy_percentages);
+                                                  header_data_, cluster_min_healthy_percentages,
+                                                  cluster_status_cache);
     filter_->setDecoderFilterCallbacks(callbacks_);
   }
 
   NiceMock<Server::Configuration::MockFactoryContext> context_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
   Event::MockTimer* cache_timer_{};
   Event::MockDispatcher dispatcher_;
   HealthCheckCacheManagerSharedPtr cache_manager_;
@@ -227,6 +236,61 @@ TEST_F(HealthCheckFilterNoPassThroughTest, ComputedHealth) {
   }
 }
 
+TEST_F(HealthCheckFilterNoPassThroughTest, ComputedHealthCached) {
+  Upstream::ClusterUpdateCallbacks* cluster_update_callbacks{};
+  EXPECT_CALL(context_.cluster_manager_, addThreadLocalClusterUpdateCallbacks_(_))
+      .WillOnce(
+          Invoke([&](Upstream::ClusterUpdateCallbacks& cb) -> Upstream::ClusterUpdateCallbacksHandle* {
+            cluster_update_callbacks = &cb;
+            return nullptr;
+          }));
+  prepareFilter(
+      false,
+      ClusterMinHealthyPercentagesConstSharedPtr(new ClusterMinHealthyPercentages{{"www1", 50.0}}),
+      true);
+  EXPECT_CALL(context_, healthCheckFailed()).Times(4).WillRepeatedly(Return(false));
+
+  // The cluster status is computed on the first probe and then served from the cache: the
+  // cluster manager is consulted only once until the checked cluster changes.
+  MockHealthCheckCluster cluster_www1(100, 50);
+  EXPECT_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www1")))
+      .WillOnce(Return(&cluster_www1));
+  for (int i = 0; i < 2; ++i) {
+    Http::TestResponseHeaderMapImpl health_check_response{{":status", "200"}};
+    EXPECT_CALL(callbacks_, encodeHeaders_(HeaderMapEqualRef(&health_check_response), true));
+    EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+              filter_->decodeHeaders(request_headers_, true));
+    EXPECT_EQ("health_check_ok_cluster_healthy", callbacks_.details());
+  }
+
+  // A member update on the checked cluster invalidates the cache and the next probe re-evaluates
+  // against the updated stats.
+  cluster_www1.info()->endpointStats().membership_healthy_.set(49);
+  cluster_www1.cluster_.priority_set_.runUpdateCallbacks(0, {}, {});
+  EXPECT_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www1")))
+      .WillOnce(Return(&cluster_www1));
+  {
+    Http::TestResponseHeaderMapImpl health_check_response{{":status", "503"}};
+    EXPECT_CALL(callbacks_, encodeHeaders_(HeaderMapEqualRef(&health_check_response), true));
+    EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+              filter_->decodeHeaders(request_headers_, true));
+    EXPECT_EQ("health_check_failed_cluster_unhealthy", callbacks_.details());
+  }
+
+  // Removal of a checked cluster also invalidates the cache.
+  ASSERT_NE(cluster_update_callbacks, nullptr);
+  cluster_update_callbacks->onClusterRemoval("www1");
+  EXPECT_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www1")))
+      .WillOnce(Return(nullptr));
+  {
+    Http::TestResponseHeaderMapImpl health_check_response{{":status", "503"}};
+    EXPECT_CALL(callbacks_, encodeHeaders_(HeaderMapEqualRef(&health_check_response), true));
+    EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+              filter_->decodeHeaders(request_headers_, true));
+    EXPECT_EQ("health_check_failed_no_cluster_found", callbacks_.details());
+  }
+}
+
 TEST_F(HealthCheckFilterNoPassThroughTest, HealthCheckFailedCallbackCalled) {
   EXPECT_CALL(context_, healthCheckFailed()).Times(2).WillRepeatedly(Return(true));
   EXPECT_CALL(callbacks_.stream_info_, healthCheck(true));
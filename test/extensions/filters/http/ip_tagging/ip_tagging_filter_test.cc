@@ -84,6 +84,36 @@ TEST_F(IpTaggingFilterTest, InternalRequest) {
   EXPECT_FALSE(request_headers.has(Http::Headers::get().EnvoyIpTags));
 }
 
+// Configs with byte-for-byte identical ip_tags share one trie snapshot; differing tag data or
+// differences limited to other fields (request_type) do not defeat or break the sharing.
+TEST_F(IpTaggingFilterTest, IdenticalTagDataSharesTrie) {
+  const std::string same_tags_different_type_yaml = R"EOF(
+request_type: external
+ip_tags:
+  - ip_tag_name: internal_request
+    ip_list:
+      - {address_prefix: 1.2.3.5, prefix_len: 32}
+
+)EOF";
+  const std::string different_tags_yaml = R"EOF(
+request_type: internal
+ip_tags:
+  - ip_tag_name: internal_request
+    ip_list:
+      - {address_prefix: 1.2.3.6, prefix_len: 32}
+
+)EOF";
+
+  initializeFilter(internal_request_yaml);
+  IpTaggingFilterConfigSharedPtr first_config = config_;
+
+  initializeFilter(same_tags_different_type_yaml);
+  EXPECT_EQ(&first_config->trie(), &config_->trie());
+
+  initializeFilter(different_tags_yaml);
+  EXPECT_NE(&first_config->trie(), &config_->trie());
+}
+
 TEST_F(IpTaggingFilterTest, ExternalRequest) {
   const std::string external_request_yaml = R"EOF(
 request_type: external
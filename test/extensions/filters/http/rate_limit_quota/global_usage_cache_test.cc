@@ -0,0 +1,106 @@
+#include <tuple>
+#include <vector>
+
+#include "source/extensions/filters/http/rate_limit_quota/global_usage_cache.h"
+
+#include "test/test_common/thread_factory_for_test.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace RateLimitQuota {
+namespace {
+
+TEST(GlobalUsageCacheTest, DrainMergesAndZeroes) {
+  GlobalUsageCache cache;
+  constexpr size_t bucket_hash = 42;
+
+  cache.recordUsage(bucket_hash, /*allowed=*/true);
+  cache.recordUsage(bucket_hash, /*allowed=*/true);
+  cache.recordUsage(bucket_hash, /*allowed=*/false);
+
+  auto [allowed, denied] = cache.drainUsage(bucket_hash);
+  EXPECT_EQ(allowed, 2);
+  EXPECT_EQ(denied, 1);
+
+  // A second drain (e.g. another worker's periodic report) finds nothing.
+  std::tie(allowed, denied) = cache.drainUsage(bucket_hash);
+  EXPECT_EQ(allowed, 0);
+  EXPECT_EQ(denied, 0);
+
+  // Buckets are tracked independently.
+  cache.recordUsage(bucket_hash + 1, /*allowed=*/false);
+  std::tie(allowed, denied) = cache.drainUsage(bucket_hash);
+  EXPECT_EQ(allowed, 0);
+  EXPECT_EQ(denied, 0);
+  std::tie(allowed, denied) = cache.drainUsage(bucket_hash + 1);
+  EXPECT_EQ(allowed, 0);
+  EXPECT_EQ(denied, 1);
+}
+
+TEST(GlobalUsageCacheTest, ConcurrentRecordsAreMerged) {
+  GlobalUsageCache cache;
+  constexpr size_t bucket_hash = 7;
+  constexpr uint64_t increments_per_thread = 1000;
+  constexpr size_t num_threads = 4;
+
+  std::vector<Thread::ThreadPtr> threads;
+  threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back(Thread::threadFactoryForTest().createThread([&cache] {
+      for (uint64_t j = 0; j < increments_per_thread; ++j) {
+        cache.recordUsage(bucket_hash, /*allowed=*/true);
+      }
+    }));
+  }
+  for (auto& thread : threads) {
+    thread->join();
+  }
+
+  auto [allowed, denied] = cache.drainUsage(bucket_hash);
+  EXPECT_EQ(allowed, num_threads * increments_per_thread);
+  EXPECT_EQ(denied, 0);
+}
+
+TEST(GlobalUsageCacheTest, PublishAndGetAction) {
+  GlobalUsageCache cache;
+  constexpr size_t bucket_hash = 42;
+
+  EXPECT_EQ(cache.getAction(bucket_hash), nullptr);
+
+  GlobalUsageCache::BucketAction action;
+  action.mutable_quota_assignment_action()
+      ->mutable_rate_limit_strategy()
+      ->mutable_token_bucket()
+      ->set_max_tokens(100);
+  cache.publishAction(bucket_hash, action);
+
+  auto published = cache.getAction(bucket_hash);
+  ASSERT_NE(published, nullptr);
+  EXPECT_EQ(
+      published->quota_assignment_action().rate_limit_strategy().token_bucket().max_tokens(), 100);
+
+  // Publishing again replaces the snapshot; earlier snapshots stay valid for their holders.
+  GlobalUsageCache::BucketAction updated = action;
+  updated.mutable_quota_assignment_action()
+      ->mutable_rate_limit_strategy()
+      ->mutable_token_bucket()
+      ->set_max_tokens(200);
+  cache.publishAction(bucket_hash, updated);
+  EXPECT_EQ(
+      published->quota_assignment_action().rate_limit_strategy().token_bucket().max_tokens(), 100);
+  EXPECT_EQ(cache.getAction(bucket_hash)
+                ->quota_assignment_action()
+                .rate_limit_strategy()
+                .token_bucket()
+                .max_tokens(),
+            200);
+}
+
+} // namespace
+} // namespace RateLimitQuota
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -374,7 +374,8 @@ TEST_P(RateLimitQuotaIntegrationTest, BasicFlowPeriodicalReport) {
   ASSERT_TRUE(rlqs_stream_->waitForGrpcMessage(*dispatcher_, reports));
   rlqs_stream_->startGrpcStream();
 
-  // Build the response.
+  // Build the response. Grant an ALLOW_ALL assignment so that subsequent requests are recorded
+  // as quota usage.
   envoy::service::rate_limit_quota::v3::RateLimitQuotaResponse rlqs_response;
   absl::flat_hash_map<std::string, std::string> custom_headers_cpy = custom_headers;
   custom_headers_cpy.insert({"name", "prod"});
@@ -382,6 +383,10 @@ TEST_P(RateLimitQuotaIntegrationTest, BasicFlowPeriodicalReport) {
 
   for (const auto& [key, value] : custom_headers_cpy) {
     (*bucket_action->mutable_bucket_id()->mutable_bucket()).insert({key, value});
+    auto* quota_assignment = bucket_action->mutable_quota_assignment_action();
+    quota_assignment->mutable_assignment_time_to_live()->set_seconds(120);
+    auto* strategy = quota_assignment->mutable_rate_limit_strategy();
+    strategy->set_blanket_rule(envoy::type::v3::RateLimitStrategy::ALLOW_ALL);
   }
   rlqs_stream_->sendGrpcMessage(rlqs_response);
 
@@ -397,6 +402,19 @@ TEST_P(RateLimitQuotaIntegrationTest, BasicFlowPeriodicalReport) {
   EXPECT_TRUE(response_->complete());
   EXPECT_EQ(response_->headers().getStatusValue(), "200");
 
+  // Send a second request so that there is quota usage to report; a periodic report whose merged
+  // usage has already been reported is skipped.
+  cleanupUpstreamAndDownstream();
+  sendClientRequest(&custom_headers);
+  ASSERT_TRUE(fake_upstreams_[0]->waitForHttpConnection(*dispatcher_, fake_upstream_connection_));
+  ASSERT_TRUE(fake_upstream_connection_->waitForNewStream(*dispatcher_, upstream_request_));
+  ASSERT_TRUE(upstream_request_->waitForEndStream(*dispatcher_));
+  upstream_request_->encodeHeaders(Http::TestResponseHeaderMapImpl{{":status", "200"}}, false);
+  upstream_request_->encodeData(100, true);
+  ASSERT_TRUE(response_->waitForEndStream());
+  EXPECT_TRUE(response_->complete());
+  EXPECT_EQ(response_->headers().getStatusValue(), "200");
+
   // Trigger the periodical report.
   // TODO(tyxia) Make interval configurable. It is 60s in ValidMatcherConfig.
   simTime().advanceTimeWait(std::chrono::milliseconds(60000));
@@ -77,6 +77,30 @@ TEST_F(HttpPerRequestTapperImplTest, BufferedFlowNoTap) {
   EXPECT_FALSE(tapper_->onDestroyLog());
 }
 
+// Buffered tap where the matcher reaches a final no-match status on request headers. The matcher
+// should not be consulted for subsequent body data and no trace should be submitted.
+TEST_F(HttpPerRequestTapperImplTest, BufferedFlowNoTapFinalMatchStatus) {
+  EXPECT_CALL(*config_, streaming()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*config_, maxBufferedRxBytes()).WillRepeatedly(Return(1024));
+  EXPECT_CALL(*config_, maxBufferedTxBytes()).WillRepeatedly(Return(1024));
+
+  InSequence s;
+  EXPECT_CALL(matcher_, onHttpRequestHeaders(_, _))
+      .WillOnce(Assign(&(*statuses_)[0].might_change_status_, false));
+  tapper_->onRequestHeaders(request_headers_);
+  EXPECT_CALL(matcher_, onRequestBody(_, _)).Times(0);
+  tapper_->onRequestBody(Buffer::OwnedImpl("hello"));
+  EXPECT_CALL(matcher_, onHttpRequestTrailers(_, _));
+  tapper_->onRequestTrailers(request_trailers_);
+  EXPECT_CALL(matcher_, onHttpResponseHeaders(_, _));
+  tapper_->onResponseHeaders(response_headers_);
+  EXPECT_CALL(matcher_, onResponseBody(_, _)).Times(0);
+  tapper_->onResponseBody(Buffer::OwnedImpl("world"));
+  EXPECT_CALL(matcher_, onHttpResponseTrailers(_, _));
+  tapper_->onResponseTrailers(response_trailers_);
+  EXPECT_FALSE(tapper_->onDestroyLog());
+}
+
 // Buffered tap with a match.
 TEST_F(HttpPerRequestTapperImplTest, BufferedFlowTap) {
   EXPECT_CALL(*config_, streaming()).WillRepeatedly(Return(false));
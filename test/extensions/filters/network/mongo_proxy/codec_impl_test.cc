@@ -11,6 +11,7 @@
 #include "gtest/gtest.h"
 
 using testing::Eq;
+using testing::Invoke;
 using testing::NiceMock;
 using testing::Pointee;
 
@@ -165,6 +166,30 @@ TEST_F(MongoCodecImplTest, Reply) {
   decoder_.onData(output_);
 }
 
+TEST_F(MongoCodecImplTest, ReplyLazyDocumentStats) {
+  ReplyMessageImpl reply(2, 2);
+  reply.flags(0);
+  reply.cursorId(1);
+  reply.startingFrom(0);
+  reply.numberReturned(2);
+  reply.documents().push_back(Bson::DocumentImpl::create()->addString("hello", "world"));
+  reply.documents().push_back(Bson::DocumentImpl::create());
+
+  encoder_.encodeReply(reply);
+  EXPECT_CALL(callbacks_, decodeReply_(testing::_))
+      .WillOnce(Invoke([](ReplyMessagePtr& message) -> void {
+        // Count and byte size are available from the document framing without a parse.
+        EXPECT_EQ(2U, message->documentsCount());
+        EXPECT_EQ(27U, message->documentsByteSize());
+
+        // Accessing the documents materializes the full parse.
+        EXPECT_EQ(2U, message->documents().size());
+        EXPECT_EQ(2U, message->documentsCount());
+        EXPECT_EQ(27U, message->documentsByteSize());
+      }));
+  decoder_.onData(output_);
+}
+
 TEST_F(MongoCodecImplTest, GetMoreEqual) {
   {
     GetMoreMessageImpl g1(0, 0);
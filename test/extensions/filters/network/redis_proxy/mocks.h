@@ -62,7 +62,7 @@ public:
   MockFaultManager(const MockFaultManager& other);
   ~MockFaultManager() override;
 
-  MOCK_METHOD(const Common::Redis::Fault*, getFaultForCommand, (const std::string&), (const));
+  MOCK_METHOD(const Common::Redis::Fault*, getFaultForCommand, (absl::string_view), (const));
 };
 
 namespace ConnPool {
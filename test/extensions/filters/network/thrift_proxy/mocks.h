@@ -95,10 +95,10 @@ public:
   MOCK_METHOD(void, writeMessageBegin,
               (Buffer::Instance & buffer, const MessageMetadata& metadata));
   MOCK_METHOD(void, writeMessageEnd, (Buffer::Instance & buffer));
-  MOCK_METHOD(void, writeStructBegin, (Buffer::Instance & buffer, const std::string& name));
+  MOCK_METHOD(void, writeStructBegin, (Buffer::Instance & buffer, absl::string_view name));
   MOCK_METHOD(void, writeStructEnd, (Buffer::Instance & buffer));
   MOCK_METHOD(void, writeFieldBegin,
-              (Buffer::Instance & buffer, const std::string& name, FieldType field_type,
+              (Buffer::Instance & buffer, absl::string_view name, FieldType field_type,
                int16_t field_id));
   MOCK_METHOD(void, writeFieldEnd, (Buffer::Instance & buffer));
   MOCK_METHOD(void, writeMapBegin,
@@ -115,8 +115,8 @@ public:
   MOCK_METHOD(void, writeInt32, (Buffer::Instance & buffer, int32_t value));
   MOCK_METHOD(void, writeInt64, (Buffer::Instance & buffer, int64_t value));
   MOCK_METHOD(void, writeDouble, (Buffer::Instance & buffer, double value));
-  MOCK_METHOD(void, writeString, (Buffer::Instance & buffer, const std::string& value));
-  MOCK_METHOD(void, writeBinary, (Buffer::Instance & buffer, const std::string& value));
+  MOCK_METHOD(void, writeString, (Buffer::Instance & buffer, absl::string_view value));
+  MOCK_METHOD(void, writeBinary, (Buffer::Instance & buffer, absl::string_view value));
   MOCK_METHOD(bool, supportsUpgrade, ());
   MOCK_METHOD(DecoderEventHandlerSharedPtr, upgradeRequestDecoder, ());
   MOCK_METHOD(DirectResponsePtr, upgradeResponse, (const DecoderEventHandler&));
@@ -34,11 +34,14 @@ public:
       const bool enable_latency_threshold_metrics = true,
       const std::chrono::milliseconds default_latency_threshold = std::chrono::milliseconds(100),
       const LatencyThresholdOverrideList& latency_threshold_overrides =
-          LatencyThresholdOverrideList()) {
+          LatencyThresholdOverrideList(),
+      const HeaderOnlyDecodeOpcodeList& header_only_decode_opcodes =
+          HeaderOnlyDecodeOpcodeList()) {
     config_ = std::make_shared<ZooKeeperFilterConfig>(
         stat_prefix_, 1048576, enable_per_opcode_request_bytes_metrics,
         enable_per_opcode_response_bytes_metrics, enable_latency_threshold_metrics,
-        default_latency_threshold, latency_threshold_overrides, scope_);
+        default_latency_threshold, latency_threshold_overrides, header_only_decode_opcodes,
+        scope_);
     filter_ = std::make_unique<ZooKeeperFilter>(config_, time_system_);
     filter_->initializeReadFilterCallbacks(filter_callbacks_);
   }
@@ -1064,6 +1067,27 @@ TEST_F(ZooKeeperFilterTest, GetDataRequestEmptyPath) {
   testResponse({{{"opname", "getdata_resp"}, {"zxid", "2000"}, {"error", "0"}}, {{"bytes", "20"}}});
 }
 
+TEST_F(ZooKeeperFilterTest, HeaderOnlyDecodeOpcodes) {
+  HeaderOnlyDecodeOpcodeList header_only_decode_opcodes;
+  header_only_decode_opcodes.Add(LatencyThresholdOverride::GetData);
+  initialize(true, true, true, std::chrono::milliseconds(100), LatencyThresholdOverrideList(),
+             header_only_decode_opcodes);
+
+  Buffer::OwnedImpl data = encodePathWatch("/foo", true);
+
+  // The body parse is skipped: no per-request counter or opname/path metadata, but aggregate and
+  // per-opcode bytes are still charged.
+  expectSetDynamicMetadata({{{"bytes", "21"}}});
+  EXPECT_EQ(Envoy::Network::FilterStatus::Continue, filter_->onData(data, false));
+  EXPECT_EQ(0UL, config_->stats().getdata_rq_.value());
+  EXPECT_EQ(21UL, config_->stats().request_bytes_.value());
+  EXPECT_EQ(21UL, store_.counter("test.zookeeper.getdata_rq_bytes").value());
+  EXPECT_EQ(0UL, config_->stats().decoder_error_.value());
+
+  // The request is still tracked by xid, so the response and latency metrics are unaffected.
+  testResponse({{{"opname", "getdata_resp"}, {"zxid", "2000"}, {"error", "0"}}, {{"bytes", "20"}}});
+}
+
 TEST_F(ZooKeeperFilterTest, CreateRequestPersistent) {
   testCreate(CreateFlags::Persistent, 0);
   testResponse({{{"opname", "create_resp"}, {"zxid", "2000"}, {"error", "0"}}, {{"bytes", "20"}}});
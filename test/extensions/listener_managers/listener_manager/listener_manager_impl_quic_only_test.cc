@@ -3,10 +3,12 @@
 
 #if defined(ENVOY_ENABLE_QUIC)
 #include "source/common/quic/quic_transport_socket_factory.h"
+#include "source/common/quic/udp_sendmmsg_batch_writer.h"
 #endif
 
 #include "test/extensions/listener_managers/listener_manager/listener_manager_impl_test.h"
 #include "test/server/utility.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/threadsafe_singleton_injector.h"
 #include "test/mocks/network/mocks.h"
 #include "test/integration/filters/test_listener_filter.h"
@@ -156,7 +158,13 @@ filter_chain_matcher:
           ->packetWriterFactory()
           .createUdpPacketWriter(listen_socket->ioHandle(),
                                  manager_->listeners()[0].get().listenerScope());
+#if UDP_SENDMMSG_BATCH_WRITER_COMPILETIME_SUPPORT
+  // The sendmmsg fallback keeps the writer in batch mode even when GSO is unsupported.
+  EXPECT_EQ(udp_packet_writer->isBatchMode(), Api::OsSysCallsSingleton::get().supportsUdpGso() ||
+                                                  Api::OsSysCallsSingleton::get().supportsMmsg());
+#else
   EXPECT_EQ(udp_packet_writer->isBatchMode(), Api::OsSysCallsSingleton::get().supportsUdpGso());
+#endif
 
   // No filter chain found with non-matching transport protocol.
   EXPECT_EQ(nullptr, findFilterChain(1234, "127.0.0.1", "", "tls", {}, "8.8.8.8", 111));
@@ -243,6 +251,171 @@ TEST_P(ListenerManagerImplQuicOnlyTest, QuicWriterFromConfig) {
   EXPECT_EQ(false, udp_packet_writer->isBatchMode());
 }
 
+#if UDP_SENDMMSG_BATCH_WRITER_COMPILETIME_SUPPORT
+TEST_P(ListenerManagerImplQuicOnlyTest, QuicSendmmsgWriterFallbackWithoutGso) {
+  std::string yaml = getBasicConfig();
+
+  envoy::config::listener::v3::Listener listener_proto = parseListenerFromV3Yaml(yaml);
+  // With no explicitly configured writer and no GSO support, the listener should
+  // fall back to the sendmmsg batch writer.
+  ON_CALL(udp_gso_syscall_, supportsUdpGso()).WillByDefault(Return(false));
+  EXPECT_CALL(server_.api_.random_, uuid());
+  expectCreateListenSocket(envoy::config::core::v3::SocketOption::STATE_PREBIND,
+#ifdef SO_RXQ_OVFL // SO_REUSEPORT is on as configured
+                           /* expected_num_options */
+                           Api::OsSysCallsSingleton::get().supportsUdpGro() ? 4 : 3,
+#else
+                           /* expected_num_options */
+                           Api::OsSysCallsSingleton::get().supportsUdpGro() ? 3 : 2,
+#endif
+                           ListenerComponentFactory::BindType::ReusePort);
+
+  expectSetsockopt(/* expected_sockopt_level */ IPPROTO_IP,
+                   /* expected_sockopt_name */ ENVOY_IP_PKTINFO,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+#ifdef SO_RXQ_OVFL
+  expectSetsockopt(/* expected_sockopt_level */ SOL_SOCKET,
+                   /* expected_sockopt_name */ SO_RXQ_OVFL,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+#endif
+  expectSetsockopt(/* expected_sockopt_level */ SOL_SOCKET,
+                   /* expected_sockopt_name */ SO_REUSEPORT,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+#ifdef UDP_GRO
+  if (Api::OsSysCallsSingleton::get().supportsUdpGro()) {
+    expectSetsockopt(/* expected_sockopt_level */ SOL_UDP,
+                     /* expected_sockopt_name */ UDP_GRO,
+                     /* expected_value */ 1,
+                     /* expected_num_calls */ 1);
+  }
+#endif
+
+  addOrUpdateListener(listener_proto);
+  EXPECT_EQ(1u, manager_->listeners().size());
+  Network::SocketSharedPtr listen_socket =
+      manager_->listeners().front().get().listenSocketFactories()[0]->getListenSocket(0);
+
+  Network::UdpPacketWriterPtr udp_packet_writer =
+      manager_->listeners()
+          .front()
+          .get()
+          .udpListenerConfig()
+          ->packetWriterFactory()
+          .createUdpPacketWriter(listen_socket->ioHandle(),
+                                 manager_->listeners()[0].get().listenerScope());
+  EXPECT_TRUE(udp_packet_writer->isBatchMode());
+  EXPECT_NE(nullptr, dynamic_cast<Quic::UdpSendmmsgBatchWriter*>(udp_packet_writer.get()));
+}
+
+TEST_P(ListenerManagerImplQuicOnlyTest, QuicSendmmsgWriterFallbackDisabledByRuntime) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues({{"envoy.reloadable_features.quic_sendmmsg_batch_writer", "false"}});
+
+  std::string yaml = getBasicConfig();
+
+  envoy::config::listener::v3::Listener listener_proto = parseListenerFromV3Yaml(yaml);
+  // With the runtime flag disabled the sendmmsg fallback must not kick in and
+  // the listener keeps the default writer.
+  ON_CALL(udp_gso_syscall_, supportsUdpGso()).WillByDefault(Return(false));
+  EXPECT_CALL(server_.api_.random_, uuid());
+  expectCreateListenSocket(envoy::config::core::v3::SocketOption::STATE_PREBIND,
+#ifdef SO_RXQ_OVFL // SO_REUSEPORT is on as configured
+                           /* expected_num_options */
+                           Api::OsSysCallsSingleton::get().supportsUdpGro() ? 4 : 3,
+#else
+                           /* expected_num_options */
+                           Api::OsSysCallsSingleton::get().supportsUdpGro() ? 3 : 2,
+#endif
+                           ListenerComponentFactory::BindType::ReusePort);
+
+  expectSetsockopt(/* expected_sockopt_level */ IPPROTO_IP,
+                   /* expected_sockopt_name */ ENVOY_IP_PKTINFO,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+#ifdef SO_RXQ_OVFL
+  expectSetsockopt(/* expected_sockopt_level */ SOL_SOCKET,
+                   /* expected_sockopt_name */ SO_RXQ_OVFL,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+#endif
+  expectSetsockopt(/* expected_sockopt_level */ SOL_SOCKET,
+                   /* expected_sockopt_name */ SO_REUSEPORT,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+#ifdef UDP_GRO
+  if (Api::OsSysCallsSingleton::get().supportsUdpGro()) {
+    expectSetsockopt(/* expected_sockopt_level */ SOL_UDP,
+                     /* expected_sockopt_name */ UDP_GRO,
+                     /* expected_value */ 1,
+                     /* expected_num_calls */ 1);
+  }
+#endif
+
+  addOrUpdateListener(listener_proto);
+  EXPECT_EQ(1u, manager_->listeners().size());
+  Network::SocketSharedPtr listen_socket =
+      manager_->listeners().front().get().listenSocketFactories()[0]->getListenSocket(0);
+
+  Network::UdpPacketWriterPtr udp_packet_writer =
+      manager_->listeners()
+          .front()
+          .get()
+          .udpListenerConfig()
+          ->packetWriterFactory()
+          .createUdpPacketWriter(listen_socket->ioHandle(),
+                                 manager_->listeners()[0].get().listenerScope());
+  EXPECT_FALSE(udp_packet_writer->isBatchMode());
+}
+#endif // UDP_SENDMMSG_BATCH_WRITER_COMPILETIME_SUPPORT
+
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(__linux__)
+TEST_P(ListenerManagerImplQuicOnlyTest, PinWorkerThreadsSkipsCpuSteeringFilter) {
+  // The QUIC listener installs its own connection-id based steering program, so with pinned
+  // worker threads the CPU steering program must not be added: the option count is the same as
+  // without the flag and no SO_ATTACH_REUSEPORT_CBPF setsockopt happens at bind time.
+  server_.bootstrap_.set_pin_worker_threads(true);
+  std::string yaml = getBasicConfig();
+
+  envoy::config::listener::v3::Listener listener_proto = parseListenerFromV3Yaml(yaml);
+  ON_CALL(udp_gso_syscall_, supportsUdpGso())
+      .WillByDefault(Return(os_sys_calls_actual_.supportsUdpGso()));
+  EXPECT_CALL(server_.api_.random_, uuid());
+  expectCreateListenSocket(envoy::config::core::v3::SocketOption::STATE_PREBIND,
+                           /* expected_num_options */
+                           Api::OsSysCallsSingleton::get().supportsUdpGro() ? 4 : 3,
+                           ListenerComponentFactory::BindType::ReusePort);
+  EXPECT_CALL(*listener_factory_.socket_, setSocketOption(_, SO_ATTACH_REUSEPORT_CBPF, _, _))
+      .Times(0);
+
+  expectSetsockopt(/* expected_sockopt_level */ IPPROTO_IP,
+                   /* expected_sockopt_name */ ENVOY_IP_PKTINFO,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+  expectSetsockopt(/* expected_sockopt_level */ SOL_SOCKET,
+                   /* expected_sockopt_name */ SO_RXQ_OVFL,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+  expectSetsockopt(/* expected_sockopt_level */ SOL_SOCKET,
+                   /* expected_sockopt_name */ SO_REUSEPORT,
+                   /* expected_value */ 1,
+                   /* expected_num_calls */ 1);
+#ifdef UDP_GRO
+  if (Api::OsSysCallsSingleton::get().supportsUdpGro()) {
+    expectSetsockopt(/* expected_sockopt_level */ SOL_UDP,
+                     /* expected_sockopt_name */ UDP_GRO,
+                     /* expected_value */ 1,
+                     /* expected_num_calls */ 1);
+  }
+#endif
+
+  addOrUpdateListener(listener_proto);
+  EXPECT_EQ(1u, manager_->listeners().size());
+}
+#endif // SO_ATTACH_REUSEPORT_CBPF && __linux__
+
 TEST_P(ListenerManagerImplQuicOnlyTest, QuicListenerFactoryWithExplictConnectionIdConfig) {
   const std::string yaml = TestEnvironment::substitute(R"EOF(
 address:
@@ -1,5 +1,9 @@
 #include "test/extensions/listener_managers/listener_manager/listener_manager_impl_test.h"
 
+#if defined(__linux__)
+#include <linux/filter.h>
+#endif
+
 #include <chrono>
 #include <memory>
 #include <string>
@@ -6260,6 +6264,54 @@ TEST_P(ListenerManagerImplWithRealFiltersTest, LiteralSockoptListenerEnabled) {
   EXPECT_EQ(1U, manager_->listeners().size());
 }
 
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(__linux__)
+TEST_P(ListenerManagerImplWithRealFiltersTest, PinWorkerThreadsAttachesCpuSteeringFilter) {
+  server_.bootstrap_.set_pin_worker_threads(true);
+  envoy::config::listener::v3::Listener listener = createIPv4Listener("PinnedListener");
+  listener.mutable_enable_reuse_port()->set_value(true);
+
+  // Two options: SO_REUSEPORT at prebind plus the CPU steering program, which is applied when the
+  // bound-state options run after socket creation.
+  expectCreateListenSocket(envoy::config::core::v3::SocketOption::STATE_PREBIND,
+                           /* expected_num_options */ 2,
+                           ListenerComponentFactory::BindType::ReusePort);
+  expectSetsockopt(
+      /* expected_sockopt_level */ SOL_SOCKET,
+      /* expected_sockopt_name */ SO_REUSEPORT,
+      /* expected_value */ 1);
+  EXPECT_CALL(*listener_factory_.socket_,
+              setSocketOption(SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, _, sizeof(sock_fprog)))
+      .WillOnce(Invoke([](int, int, const void* optval, socklen_t) -> Api::SysCallIntResult {
+        const auto* prog = static_cast<const sock_fprog*>(optval);
+        EXPECT_EQ(3, prog->len);
+        // ld cpu; mod #concurrency; ret a. The mock server runs with a concurrency of 1.
+        EXPECT_EQ(static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU), prog->filter[0].k);
+        EXPECT_EQ(1, prog->filter[1].k);
+        return {0, 0};
+      }));
+  addOrUpdateListener(listener);
+  EXPECT_EQ(1U, manager_->listeners().size());
+}
+
+TEST_P(ListenerManagerImplWithRealFiltersTest, PinWorkerThreadsDisabledNoCpuSteeringFilter) {
+  envoy::config::listener::v3::Listener listener = createIPv4Listener("UnpinnedListener");
+  listener.mutable_enable_reuse_port()->set_value(true);
+
+  // Without pin_worker_threads only the SO_REUSEPORT option is built.
+  expectCreateListenSocket(envoy::config::core::v3::SocketOption::STATE_PREBIND,
+                           /* expected_num_options */ 1,
+                           ListenerComponentFactory::BindType::ReusePort);
+  expectSetsockopt(
+      /* expected_sockopt_level */ SOL_SOCKET,
+      /* expected_sockopt_name */ SO_REUSEPORT,
+      /* expected_value */ 1);
+  EXPECT_CALL(*listener_factory_.socket_, setSocketOption(_, SO_ATTACH_REUSEPORT_CBPF, _, _))
+      .Times(0);
+  addOrUpdateListener(listener);
+  EXPECT_EQ(1U, manager_->listeners().size());
+}
+#endif
+
 TEST_P(ListenerManagerImplWithRealFiltersTest,
        LiteralSockoptListenerEnabledWithMultiAddressesNoOverrideOpts) {
   const envoy::config::listener::v3::Listener listener = parseListenerFromV3Yaml(R"EOF(
@@ -1195,6 +1195,48 @@ TEST_P(DnsImplTest, RemoteAsyncLookup) {
              0 /*get_addr_failure*/, 0 /*timeouts*/);
 }
 
+// Validate that a second resolve() for an identical in-flight query joins the first one instead
+// of issuing a duplicate query, and that both callers receive the results.
+TEST_P(DnsImplTest, InflightQueryDeduplication) {
+  server_->addHosts("some.good.domain", {"201.134.56.7"}, RecordType::A);
+
+  EXPECT_NE(nullptr, resolveWithExpectations("some.good.domain", DnsLookupFamily::V4Only,
+                                             DnsResolver::ResolutionStatus::Success,
+                                             {"201.134.56.7"}, {}, absl::nullopt));
+  bool joined_callback_fired = false;
+  ActiveDnsQuery* joined_query = resolver_->resolve(
+      "some.good.domain", DnsLookupFamily::V4Only,
+      [&](DnsResolver::ResolutionStatus status, std::list<DnsResponse>&& results) {
+        EXPECT_EQ(DnsResolver::ResolutionStatus::Success, status);
+        EXPECT_THAT(getAddressAsStringList(results), UnorderedElementsAreArray({"201.134.56.7"}));
+        joined_callback_fired = true;
+      });
+  EXPECT_NE(nullptr, joined_query);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+
+  EXPECT_TRUE(joined_callback_fired);
+  EXPECT_EQ(1, stats_store_.counter("dns.cares.deduplicated_resolutions").value());
+  checkStats(1 /*resolve_total*/, 0 /*pending_resolutions*/, 0 /*not_found*/,
+             0 /*get_addr_failure*/, 0 /*timeouts*/);
+}
+
+// Validate that a joined query that is cancelled does not get its callback while the other
+// caller of the shared query still does.
+TEST_P(DnsImplTest, InflightQueryDeduplicationCancel) {
+  server_->addHosts("some.good.domain", {"201.134.56.7"}, RecordType::A);
+
+  EXPECT_NE(nullptr, resolveWithExpectations("some.good.domain", DnsLookupFamily::V4Only,
+                                             DnsResolver::ResolutionStatus::Success,
+                                             {"201.134.56.7"}, {}, absl::nullopt));
+  ActiveDnsQuery* joined_query = resolveWithUnreferencedParameters(
+      "some.good.domain", DnsLookupFamily::V4Only, false /*expected_to_execute*/);
+  EXPECT_NE(nullptr, joined_query);
+  joined_query->cancel(Network::ActiveDnsQuery::CancelReason::QueryAbandoned);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+
+  EXPECT_EQ(1, stats_store_.counter("dns.cares.deduplicated_resolutions").value());
+}
+
 // Validate that multiple A records are correctly passed to the callback.
 TEST_P(DnsImplTest, MultiARecordLookup) {
   server_->addHosts("some.good.domain", {"201.134.56.7", "123.4.5.6", "6.5.4.3"}, RecordType::A);
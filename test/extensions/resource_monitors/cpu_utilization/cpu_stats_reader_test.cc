@@ -0,0 +1,52 @@
+#include "source/extensions/resource_monitors/cpu_utilization/cpu_stats_reader.h"
+
+#include "test/test_common/environment.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace ResourceMonitors {
+namespace CpuUtilizationMonitor {
+namespace {
+
+TEST(LinuxCpuStatsReader, ReadsCpuTimes) {
+  const std::string temp_path = TestEnvironment::writeStringToFileForTest(
+      "cpu_stats", "cpu  10 20 30 40 50 60 70 80 90 100\n"
+                   "cpu0 10 20 30 40 50 60 70 80 90 100\n");
+  LinuxCpuStatsReader reader(temp_path);
+  const CpuTimes cpu_times = reader.getCpuTimes();
+  EXPECT_TRUE(cpu_times.is_valid);
+  EXPECT_EQ(cpu_times.work_time, 60);   // user + nice + system
+  EXPECT_EQ(cpu_times.total_time, 280); // first 7 counters
+}
+
+TEST(LinuxCpuStatsReader, CannotReadFile) {
+  LinuxCpuStatsReader reader(TestEnvironment::temporaryPath("nonexistent_cpu_stats"));
+  const CpuTimes cpu_times = reader.getCpuTimes();
+  EXPECT_FALSE(cpu_times.is_valid);
+  EXPECT_EQ(cpu_times.work_time, 0);
+  EXPECT_EQ(cpu_times.total_time, 0);
+}
+
+TEST(LinuxCpuStatsReader, UnexpectedIdentifier) {
+  const std::string temp_path = TestEnvironment::writeStringToFileForTest(
+      "cpu_stats_bad_identifier", "spu  10 20 30 40 50 60 70\n");
+  LinuxCpuStatsReader reader(temp_path);
+  const CpuTimes cpu_times = reader.getCpuTimes();
+  EXPECT_FALSE(cpu_times.is_valid);
+}
+
+TEST(LinuxCpuStatsReader, TruncatedLine) {
+  const std::string temp_path =
+      TestEnvironment::writeStringToFileForTest("cpu_stats_truncated", "cpu  10 20 30\n");
+  LinuxCpuStatsReader reader(temp_path);
+  const CpuTimes cpu_times = reader.getCpuTimes();
+  EXPECT_FALSE(cpu_times.is_valid);
+}
+
+} // namespace
+} // namespace CpuUtilizationMonitor
+} // namespace ResourceMonitors
+} // namespace Extensions
+} // namespace Envoy
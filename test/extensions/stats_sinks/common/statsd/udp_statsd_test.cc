@@ -14,6 +14,7 @@
 #include "test/mocks/thread_local/mocks.h"
 #include "test/test_common/environment.h"
 #include "test/test_common/network_utility.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
 #include "gmock/gmock.h"
@@ -116,6 +117,54 @@ TEST_P(UdpStatsdSinkTest, InitWithIpAddress) {
   tls_.shutdownThread();
 }
 
+TEST_P(UdpStatsdSinkTest, FlushOnlyChangedMetrics) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.statsd_flush_only_changed_metrics", "true"}});
+
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  NiceMock<Stats::MockMetricSnapshot> snapshot;
+  Network::Test::UdpSyncPeer server(GetParam());
+  UdpStatsdSink sink(tls_, server.localAddress(), false);
+
+  // The unchanged counter and gauge only appear in the full views and must not
+  // be serialized.
+  NiceMock<Stats::MockCounter> unchanged_counter;
+  unchanged_counter.name_ = "unchanged_counter";
+  unchanged_counter.used_ = true;
+  snapshot.counters_.push_back({0, unchanged_counter});
+
+  NiceMock<Stats::MockGauge> unchanged_gauge;
+  unchanged_gauge.name_ = "unchanged_gauge";
+  unchanged_gauge.value_ = 1;
+  unchanged_gauge.used_ = true;
+  snapshot.gauges_.push_back(unchanged_gauge);
+
+  NiceMock<Stats::MockCounter> counter;
+  counter.name_ = "test_counter";
+  counter.used_ = true;
+  counter.latch_ = 1;
+  snapshot.counters_.push_back({1, counter});
+  snapshot.changed_counters_.push_back({1, counter});
+
+  NiceMock<Stats::MockGauge> gauge;
+  gauge.name_ = "test_gauge";
+  gauge.value_ = 2;
+  gauge.used_ = true;
+  snapshot.gauges_.push_back(gauge);
+  snapshot.changed_gauges_.push_back(gauge);
+
+  sink.flush(snapshot);
+  Network::UdpRecvData data;
+  server.recv(data);
+  EXPECT_EQ("envoy.test_counter:1|c", data.buffer_->toString());
+  Network::UdpRecvData data2;
+  server.recv(data2);
+  EXPECT_EQ("envoy.test_gauge:2|g", data2.buffer_->toString());
+
+  tls_.shutdownThread();
+}
+
 class UdpStatsdSinkWithTagsTest : public testing::TestWithParam<Network::Address::IpVersion> {};
 INSTANTIATE_TEST_SUITE_P(IpVersions, UdpStatsdSinkWithTagsTest,
                          testing::ValuesIn(TestEnvironment::getIpVersionsForTest()),
@@ -200,6 +249,63 @@ TEST(UdpStatsdSinkTest, CheckActualStats) {
   tls_.shutdownThread();
 }
 
+// With histogram aggregation enabled, samples are buffered per histogram and emitted as a
+// single multi-value packet when the sink flushes.
+TEST(UdpStatsdSinkTest, AggregatedHistogramsEmittedOnFlush) {
+  NiceMock<Stats::MockMetricSnapshot> snapshot;
+  auto writer_ptr = std::make_shared<NiceMock<MockWriter>>();
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  UdpStatsdSink sink(tls_, writer_ptr, true, getDefaultPrefix(), absl::nullopt,
+                     getDefaultTagFormat(), true);
+
+  std::vector<Stats::Tag> tags = {Stats::Tag{"node", "test"}};
+  NiceMock<Stats::MockHistogram> timer;
+  timer.name_ = "test_timer";
+  timer.setTags(tags);
+
+  // No datagrams are written while samples accumulate.
+  EXPECT_CALL(*std::dynamic_pointer_cast<NiceMock<MockWriter>>(writer_ptr), write(_)).Times(0);
+  sink.onHistogramComplete(timer, 5);
+  sink.onHistogramComplete(timer, 6);
+  sink.onHistogramComplete(timer, 7);
+
+  // The flush emits one multi-value packet and empties the buffer.
+  EXPECT_CALL(*std::dynamic_pointer_cast<NiceMock<MockWriter>>(writer_ptr),
+              write("envoy.test_timer:5:6:7|ms|#node:test"));
+  sink.flush(snapshot);
+
+  // Nothing further is emitted once the buffer has been flushed.
+  sink.flush(snapshot);
+
+  tls_.shutdownThread();
+}
+
+// Buffered histogram samples are split across messages so that each rendered message stays
+// within the configured datagram budget.
+TEST(UdpStatsdSinkTest, AggregatedHistogramDatagramBudget) {
+  NiceMock<Stats::MockMetricSnapshot> snapshot;
+  auto writer_ptr = std::make_shared<NiceMock<MockWriter>>();
+  writer_ptr->delegateBufferFake();
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  UdpStatsdSink sink(tls_, writer_ptr, false, getDefaultPrefix(), 38, getDefaultTagFormat(),
+                     true);
+
+  NiceMock<Stats::MockHistogram> timer;
+  timer.name_ = "test_timer";
+  sink.onHistogramComplete(timer, 100000);
+  sink.onHistogramComplete(timer, 200000);
+  sink.onHistogramComplete(timer, 300000);
+
+  EXPECT_CALL(*std::dynamic_pointer_cast<NiceMock<MockWriter>>(writer_ptr), writeBuffer(_))
+      .Times(2);
+  sink.flush(snapshot);
+  EXPECT_EQ(writer_ptr->buffer_writes.size(), 2);
+  EXPECT_EQ("envoy.test_timer:100000:200000|ms", writer_ptr->buffer_writes.at(0));
+  EXPECT_EQ("envoy.test_timer:300000|ms", writer_ptr->buffer_writes.at(1));
+
+  tls_.shutdownThread();
+}
+
 TEST(UdpStatsdSinkTest, CheckMetricLargerThanBuffer) {
   NiceMock<Stats::MockMetricSnapshot> snapshot;
   auto writer_ptr = std::make_shared<NiceMock<MockWriter>>();
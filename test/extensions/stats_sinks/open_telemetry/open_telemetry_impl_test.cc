@@ -39,13 +39,17 @@ public:
                                          bool report_histograms_as_deltas = false,
                                          bool emit_tags_as_attributes = true,
                                          bool use_tag_extracted_name = true,
-                                         const std::string& stat_prefix = "") {
+                                         const std::string& stat_prefix = "",
+                                         bool report_changed_metrics_only = false,
+                                         uint32_t max_metrics_per_export_request = 0) {
     envoy::extensions::stat_sinks::open_telemetry::v3::SinkConfig sink_config;
     sink_config.set_report_counters_as_deltas(report_counters_as_deltas);
     sink_config.set_report_histograms_as_deltas(report_histograms_as_deltas);
     sink_config.mutable_emit_tags_as_attributes()->set_value(emit_tags_as_attributes);
     sink_config.mutable_use_tag_extracted_name()->set_value(use_tag_extracted_name);
     sink_config.set_prefix(stat_prefix);
+    sink_config.set_report_changed_metrics_only(report_changed_metrics_only);
+    sink_config.set_max_metrics_per_export_request(max_metrics_per_export_request);
 
     return std::make_shared<OtlpOptions>(sink_config);
   }
@@ -134,6 +138,16 @@ TEST_F(OpenTelemetryGrpcMetricsExporterImplTest, PartialSuccess) {
 
 class OtlpMetricsFlusherTests : public OpenTelemetryStatsSinkTests {
 public:
+  // Flushes the snapshot and expects all metrics to land in a single export request.
+  MetricsExportRequestSharedPtr flushSingleRequest(const OtlpMetricsFlusherImpl& flusher) {
+    MetricsExportRequestList requests = flusher.flush(snapshot_);
+    EXPECT_EQ(1, requests.size());
+    if (requests.empty()) {
+      return std::make_shared<MetricsExportRequest>();
+    }
+    return MetricsExportRequestSharedPtr{std::move(requests.front())};
+  }
+
   void expectMetricsCount(MetricsExportRequestSharedPtr& request, int count) {
     EXPECT_EQ(1, request->resource_metrics().size());
     EXPECT_EQ(1, request->resource_metrics()[0].scope_metrics().size());
@@ -219,7 +233,7 @@ TEST_F(OtlpMetricsFlusherTests, MetricsWithDefaultOptions) {
   addGaugeToSnapshot("test_gauge", 1);
   addHistogramToSnapshot("test_histogram");
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 3);
 
   {
@@ -241,7 +255,7 @@ TEST_F(OtlpMetricsFlusherTests, MetricsWithDefaultOptions) {
   }
 
   gauge_storage_.back()->used_ = false;
-  metrics = flusher.flush(snapshot_);
+  metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 2);
 }
 
@@ -252,7 +266,7 @@ TEST_F(OtlpMetricsFlusherTests, MetricsWithStatsPrefix) {
   addGaugeToSnapshot("test_gauge", 1);
   addHistogramToSnapshot("test_histogram");
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 3);
   expectGauge(metricAt(0, metrics), getTagExtractedName("prefix.test_gauge"), 1);
   expectSum(metricAt(1, metrics), getTagExtractedName("prefix.test_counter"), 1, false);
@@ -266,7 +280,7 @@ TEST_F(OtlpMetricsFlusherTests, MetricsWithNoTaggedName) {
   addGaugeToSnapshot("test_gauge", 1);
   addHistogramToSnapshot("test_histogram");
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 3);
   expectGauge(metricAt(0, metrics), "test_gauge", 1);
   expectSum(metricAt(1, metrics), "test_counter", 1, false);
@@ -280,7 +294,7 @@ TEST_F(OtlpMetricsFlusherTests, MetricsWithNoAttributes) {
   addGaugeToSnapshot("test_gauge", 1);
   addHistogramToSnapshot("test_histogram");
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 3);
 
   {
@@ -308,7 +322,7 @@ TEST_F(OtlpMetricsFlusherTests, GaugeMetric) {
   addGaugeToSnapshot("test_gauge1", 1);
   addGaugeToSnapshot("test_gauge2", 2);
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 2);
   expectGauge(metricAt(0, metrics), getTagExtractedName("test_gauge1"), 1);
   expectGauge(metricAt(1, metrics), getTagExtractedName("test_gauge2"), 2);
@@ -320,7 +334,7 @@ TEST_F(OtlpMetricsFlusherTests, CumulativeCounterMetric) {
   addCounterToSnapshot("test_counter1", 1, 1);
   addCounterToSnapshot("test_counter2", 2, 3);
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 2);
   expectSum(metricAt(0, metrics), getTagExtractedName("test_counter1"), 1, false);
   expectSum(metricAt(1, metrics), getTagExtractedName("test_counter2"), 3, false);
@@ -332,7 +346,7 @@ TEST_F(OtlpMetricsFlusherTests, DeltaCounterMetric) {
   addCounterToSnapshot("test_counter1", 1, 1);
   addCounterToSnapshot("test_counter2", 2, 3);
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 2);
   expectSum(metricAt(0, metrics), getTagExtractedName("test_counter1"), 1, true);
   expectSum(metricAt(1, metrics), getTagExtractedName("test_counter2"), 2, true);
@@ -344,7 +358,7 @@ TEST_F(OtlpMetricsFlusherTests, CumulativeHistogramMetric) {
   addHistogramToSnapshot("test_histogram1");
   addHistogramToSnapshot("test_histogram2");
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 2);
   expectHistogram(metricAt(0, metrics), getTagExtractedName("test_histogram1"), false);
   expectHistogram(metricAt(1, metrics), getTagExtractedName("test_histogram2"), false);
@@ -356,12 +370,67 @@ TEST_F(OtlpMetricsFlusherTests, DeltaHistogramMetric) {
   addHistogramToSnapshot("test_histogram1", true);
   addHistogramToSnapshot("test_histogram2", true);
 
-  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
   expectMetricsCount(metrics, 2);
   expectHistogram(metricAt(0, metrics), getTagExtractedName("test_histogram1"), true);
   expectHistogram(metricAt(1, metrics), getTagExtractedName("test_histogram2"), true);
 }
 
+TEST_F(OtlpMetricsFlusherTests, ChangedMetricsOnly) {
+  OtlpMetricsFlusherImpl flusher(otlpOptions(true, true, true, true, "", true));
+
+  addCounterToSnapshot("test_counter1", 0, 5);
+  addCounterToSnapshot("test_counter2", 2, 3);
+  addGaugeToSnapshot("test_gauge", 1);
+  // The delta histogram has new interval samples; the cumulative one does not.
+  addHistogramToSnapshot("test_histogram1", true);
+  addHistogramToSnapshot("test_histogram2", false);
+
+  // Only the gauge, the counter with a non-zero delta, and the histogram with new samples
+  // are flushed.
+  MetricsExportRequestSharedPtr metrics = flushSingleRequest(flusher);
+  expectMetricsCount(metrics, 3);
+  expectGauge(metricAt(0, metrics), getTagExtractedName("test_gauge"), 1);
+  expectSum(metricAt(1, metrics), getTagExtractedName("test_counter2"), 2, true);
+  expectHistogram(metricAt(2, metrics), getTagExtractedName("test_histogram1"), true);
+}
+
+TEST_F(OtlpMetricsFlusherTests, BatchedExportRequests) {
+  OtlpMetricsFlusherImpl flusher(otlpOptions(false, false, true, true, "", false, 2));
+
+  addGaugeToSnapshot("test_gauge1", 1);
+  addGaugeToSnapshot("test_gauge2", 2);
+  addCounterToSnapshot("test_counter1", 1, 1);
+  addCounterToSnapshot("test_counter2", 2, 3);
+  addHistogramToSnapshot("test_histogram1");
+
+  // Five metrics with a batch size of two are split into three requests.
+  MetricsExportRequestList requests = flusher.flush(snapshot_);
+  EXPECT_EQ(3, requests.size());
+
+  MetricsExportRequestSharedPtr batch = std::move(requests[0]);
+  expectMetricsCount(batch, 2);
+  expectGauge(metricAt(0, batch), getTagExtractedName("test_gauge1"), 1);
+  expectGauge(metricAt(1, batch), getTagExtractedName("test_gauge2"), 2);
+
+  batch = std::move(requests[1]);
+  expectMetricsCount(batch, 2);
+  expectSum(metricAt(0, batch), getTagExtractedName("test_counter1"), 1, false);
+  expectSum(metricAt(1, batch), getTagExtractedName("test_counter2"), 3, false);
+
+  batch = std::move(requests[2]);
+  expectMetricsCount(batch, 1);
+  expectHistogram(metricAt(0, batch), getTagExtractedName("test_histogram1"), false);
+}
+
+TEST_F(OtlpMetricsFlusherTests, NoRequestForUnchangedSnapshot) {
+  OtlpMetricsFlusherImpl flusher(otlpOptions(true, true, true, true, "", true));
+
+  addCounterToSnapshot("test_counter", 0, 5);
+
+  EXPECT_TRUE(flusher.flush(snapshot_).empty());
+}
+
 class MockOpenTelemetryGrpcMetricsExporter : public OpenTelemetryGrpcMetricsExporter {
 public:
   MOCK_METHOD(void, send, (MetricsExportRequestPtr &&));
@@ -371,7 +440,7 @@ public:
 
 class MockOtlpMetricsFlusher : public OtlpMetricsFlusher {
 public:
-  MOCK_METHOD(MetricsExportRequestPtr, flush, (Stats::MetricSnapshot&), (const));
+  MOCK_METHOD(MetricsExportRequestList, flush, (Stats::MetricSnapshot&), (const));
 };
 
 class OpenTelemetryGrpcSinkTests : public OpenTelemetryStatsSinkTests {
@@ -385,14 +454,26 @@ public:
 };
 
 TEST_F(OpenTelemetryGrpcSinkTests, BasicFlow) {
-  MetricsExportRequestPtr request = std::make_unique<MetricsExportRequest>();
-  EXPECT_CALL(*flusher_, flush(_)).WillOnce(Return(ByMove(std::move(request))));
+  MetricsExportRequestList requests;
+  requests.push_back(std::make_unique<MetricsExportRequest>());
+  EXPECT_CALL(*flusher_, flush(_)).WillOnce(Return(ByMove(std::move(requests))));
   EXPECT_CALL(*exporter_, send(_));
 
   OpenTelemetryGrpcSink sink(flusher_, exporter_);
   sink.flush(snapshot_);
 }
 
+TEST_F(OpenTelemetryGrpcSinkTests, BatchedFlow) {
+  MetricsExportRequestList requests;
+  requests.push_back(std::make_unique<MetricsExportRequest>());
+  requests.push_back(std::make_unique<MetricsExportRequest>());
+  EXPECT_CALL(*flusher_, flush(_)).WillOnce(Return(ByMove(std::move(requests))));
+  EXPECT_CALL(*exporter_, send(_)).Times(2);
+
+  OpenTelemetryGrpcSink sink(flusher_, exporter_);
+  sink.flush(snapshot_);
+}
+
 } // namespace
 } // namespace OpenTelemetry
 } // namespace StatSinks
@@ -51,7 +51,9 @@ public:
                             std::unique_ptr<TcpStatsSocket>& tcp_stats_socket) {
     if (enable_periodic) {
       timer = new NiceMock<Event::MockTimer>(&transport_callbacks_.connection_.dispatcher_);
-      EXPECT_CALL(*timer, enableTimer(std::chrono::milliseconds(1000), _)).Times(AtLeast(1));
+      // The period is adaptive (it backs off while the connection is idle), so only pin the
+      // exact durations in tests that cover the schedule.
+      EXPECT_CALL(*timer, enableTimer(_, _)).Times(AtLeast(1));
     }
     auto inner_socket = std::make_unique<NiceMock<Network::MockTransportSocket>>();
     inner_socket_out = inner_socket.get();
@@ -93,16 +95,30 @@ public:
   struct tcp_info tcp_info_;
 };
 
-// Validate that the configured update_period is honored, and that stats are updated when the timer
-// fires.
+// Validate that stats are updated when the timer fires, and that the collection period backs
+// off while the connection is idle (no segment movement) and tightens back to the configured
+// update_period when traffic resumes.
 TEST_F(TcpStatsTest, Periodic) {
   initialize(true);
 
-  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(1000), _));
+  // No segments have moved, so the period doubles after each collection, capping at 8x the
+  // configured period.
+  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(2000), _));
   tcp_info_.tcpi_notsent_bytes = 42;
   timer_->callback_();
   EXPECT_EQ(42, gaugeValue("cx_tx_unsent_bytes"));
 
+  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(4000), _));
+  timer_->callback_();
+  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(8000), _)).Times(2);
+  timer_->callback_();
+  timer_->callback_();
+
+  // Traffic resumes; collection reverts to the configured period.
+  tcp_info_.tcpi_segs_out = 1;
+  EXPECT_CALL(*timer_, enableTimer(std::chrono::milliseconds(1000), _));
+  timer_->callback_();
+
   EXPECT_CALL(*timer_, disableTimer());
   tcp_stats_socket_->closeSocket(Network::ConnectionEvent::RemoteClose);
 }
@@ -6121,6 +6121,14 @@ TEST_P(SslReadBufferLimitTest, NoLimit) {
   readBufferLimitTest(0, 256 * 1024, 256 * 1024, 1, false);
 }
 
+// Verify that data transfers intact with dynamic record sizing enabled, which caps early records
+// at ~MTU size before ramping up to full sized records.
+TEST_P(SslReadBufferLimitTest, NoLimitDynamicRecordSizing) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues({{"envoy.reloadable_features.tls_dynamic_record_sizing", "true"}});
+  readBufferLimitTest(0, 256 * 1024, 256 * 1024, 1, false);
+}
+
 TEST_P(SslReadBufferLimitTest, NoLimitReserveSpace) { readBufferLimitTest(0, 512, 512, 1, true); }
 
 TEST_P(SslReadBufferLimitTest, NoLimitSmallWrites) {
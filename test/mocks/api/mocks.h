@@ -122,6 +122,8 @@ public:
   MOCK_METHOD(SysCallSocketResult, duplicate, (os_fd_t sockfd));
   MOCK_METHOD(SysCallSizeResult, write, (os_fd_t sockfd, const void* buffer, size_t length));
   MOCK_METHOD(SysCallBoolResult, socketTcpInfo, (os_fd_t sockfd, EnvoyTcpInfo* tcp_info));
+  MOCK_METHOD(SysCallSizeResult, sendfile, (os_fd_t out_fd, os_fd_t in_fd, off_t* offset, size_t count));
+  MOCK_METHOD(bool, supportsSendfile, (), (const));
   MOCK_METHOD(bool, supportsMmsg, (), (const));
   MOCK_METHOD(bool, supportsUdpGro, (), (const));
   MOCK_METHOD(bool, supportsIpTransparent, (Network::Address::IpVersion version), (const));
@@ -148,8 +148,17 @@ public:
   MOCK_METHOD(void, exit, ());
   MOCK_METHOD(SignalEvent*, listenForSignal_, (signal_t signal_num, SignalCb cb));
   MOCK_METHOD(void, post, (PostCb callback));
+
+  // Forward batches to the mocked single callback overload so that existing post(_) expectations
+  // keep working without gmock overload disambiguation.
+  void post(absl::Span<PostCb> callbacks) override {
+    for (PostCb& callback : callbacks) {
+      post(std::move(callback));
+    }
+  }
   MOCK_METHOD(void, deleteInDispatcherThread, (DispatcherThreadDeletableConstPtr deletable));
   MOCK_METHOD(void, run, (RunType type));
+  MOCK_METHOD(void, enableBusyPolling, (std::chrono::microseconds idle_budget));
   MOCK_METHOD(void, pushTrackedObject, (const ScopeTrackedObject* object));
   MOCK_METHOD(void, popTrackedObject, (const ScopeTrackedObject* expected_object));
   MOCK_METHOD(bool, trackedObjectStackIsEmpty, (), (const));
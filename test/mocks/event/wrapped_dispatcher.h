@@ -86,6 +86,8 @@ public:
 
   void exit() override { impl_.exit(); }
 
+  void post(absl::Span<PostCb> callbacks) override { impl_.post(callbacks); }
+
   SignalEventPtr listenForSignal(signal_t signal_num, SignalCb cb) override {
     return impl_.listenForSignal(signal_num, std::move(cb));
   }
@@ -98,6 +100,10 @@ public:
 
   void run(RunType type) override { impl_.run(type); }
 
+  void enableBusyPolling(std::chrono::microseconds idle_budget) override {
+    impl_.enableBusyPolling(idle_budget);
+  }
+
   Buffer::WatermarkFactory& getWatermarkFactory() override { return impl_.getWatermarkFactory(); }
   void pushTrackedObject(const ScopeTrackedObject* object) override {
     return impl_.pushTrackedObject(object);
@@ -393,6 +393,8 @@ public:
   MOCK_METHOD(void, onDestroy, ());
   MOCK_METHOD(void, onMatchCallback, (const Matcher::Action&));
   MOCK_METHOD(LocalErrorStatus, onLocalReply, (const LocalReplyData&));
+  MOCK_METHOD(bool, isBodyPassThrough, (), (const));
+  MOCK_METHOD(bool, isTrailerPassThrough, (), (const));
 
   // Http::StreamDecoderFilter
   MOCK_METHOD(FilterHeadersStatus, decodeHeaders, (RequestHeaderMap & headers, bool end_stream));
@@ -420,6 +422,8 @@ public:
   MOCK_METHOD(void, onDestroy, ());
   MOCK_METHOD(void, onMatchCallback, (const Matcher::Action&));
   MOCK_METHOD(LocalErrorStatus, onLocalReply, (const LocalReplyData&));
+  MOCK_METHOD(bool, isBodyPassThrough, (), (const));
+  MOCK_METHOD(bool, isTrailerPassThrough, (), (const));
 
   // Http::MockStreamEncoderFilter
   MOCK_METHOD(Filter1xxHeadersStatus, encode1xxHeaders, (ResponseHeaderMap & headers));
@@ -443,6 +447,8 @@ public:
   MOCK_METHOD(void, onDestroy, ());
   MOCK_METHOD(void, onMatchCallback, (const Matcher::Action&));
   MOCK_METHOD(LocalErrorStatus, onLocalReply, (const LocalReplyData&));
+  MOCK_METHOD(bool, isBodyPassThrough, (), (const));
+  MOCK_METHOD(bool, isTrailerPassThrough, (), (const));
 
   // Http::StreamDecoderFilter
   MOCK_METHOD(FilterHeadersStatus, decodeHeaders, (RequestHeaderMap & headers, bool end_stream));
@@ -45,6 +45,15 @@ public:
   MOCK_METHOD(void, onCancel, (Request * req, int32_t result, bool injected));
   MOCK_METHOD(void, onShutdown, (Request * req, int32_t result, bool injected));
   MOCK_METHOD(void, injectCompletion, (Request::RequestType type));
+  MOCK_METHOD(void, close, ());
+  MOCK_METHOD(void, write, (Buffer::Instance & data));
+};
+
+class MockIoUringHandler : public IoUringHandler {
+public:
+  MOCK_METHOD(void, onAcceptSocket, (AcceptedSocketParam & param));
+  MOCK_METHOD(void, onRead, (ReadParam & param));
+  MOCK_METHOD(void, onWrite, (WriteParam & param));
 };
 
 } // namespace Io
@@ -38,6 +38,8 @@ public:
   MOCK_METHOD(Api::IoCallUint64Result, recvmmsg,
               (RawSliceArrays & slices, uint32_t self_port, RecvMsgOutput& output));
   MOCK_METHOD(Api::IoCallUint64Result, recv, (void* buffer, size_t length, int flags));
+  MOCK_METHOD(Api::IoCallUint64Result, sendFile, (os_fd_t in_fd, off_t& offset, uint64_t length));
+  MOCK_METHOD(bool, supportsSendfile, (), (const));
   MOCK_METHOD(bool, supportsMmsg, (), (const));
   MOCK_METHOD(bool, supportsUdpGro, (), (const));
   MOCK_METHOD(Api::SysCallIntResult, bind, (Address::InstanceConstSharedPtr address));
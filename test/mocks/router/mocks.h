@@ -66,6 +66,14 @@ public:
   const std::vector<Matchers::StringMatcherPtr>& allowOrigins() const override {
     return allow_origins_;
   };
+  bool originAllowed(absl::string_view origin) const override {
+    for (const auto& allow_origin : allow_origins_) {
+      if (allow_origin->match("*") || allow_origin->match(origin)) {
+        return true;
+      }
+    }
+    return false;
+  };
   const std::string& allowMethods() const override { return allow_methods_; };
   const std::string& allowHeaders() const override { return allow_headers_; };
   const std::string& exposeHeaders() const override { return expose_headers_; };
@@ -543,6 +551,7 @@ public:
   MOCK_METHOD(bool, usesVhds, (), (const));
   MOCK_METHOD(bool, mostSpecificHeaderMutationsWins, (), (const));
   MOCK_METHOD(uint32_t, maxDirectResponseBodySizeBytes, (), (const));
+  MOCK_METHOD(bool, supportsRouteMemoization, (), (const));
 
   std::shared_ptr<MockRoute> route_;
   std::list<Http::LowerCaseString> internal_only_headers_;
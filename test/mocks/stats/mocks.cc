@@ -67,6 +67,8 @@ MockParentHistogram::~MockParentHistogram() = default;
 MockMetricSnapshot::MockMetricSnapshot() {
   ON_CALL(*this, counters()).WillByDefault(ReturnRef(counters_));
   ON_CALL(*this, gauges()).WillByDefault(ReturnRef(gauges_));
+  ON_CALL(*this, changedCounters()).WillByDefault(ReturnRef(changed_counters_));
+  ON_CALL(*this, changedGauges()).WillByDefault(ReturnRef(changed_gauges_));
   ON_CALL(*this, histograms()).WillByDefault(ReturnRef(histograms_));
   ON_CALL(*this, snapshotTime()).WillByDefault(Return(snapshot_time_));
 }
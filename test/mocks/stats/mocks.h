@@ -162,6 +162,7 @@ public:
   MOCK_METHOD(void, set, (uint64_t value));
   MOCK_METHOD(void, setParentValue, (uint64_t parent_value));
   MOCK_METHOD(void, sub, (uint64_t amount));
+  MOCK_METHOD(bool, latchChanged, ());
   MOCK_METHOD(void, mergeImportMode, (ImportMode));
   MOCK_METHOD(bool, used, (), (const));
   MOCK_METHOD(bool, hidden, (), (const));
@@ -252,12 +253,16 @@ public:
 
   MOCK_METHOD(const std::vector<CounterSnapshot>&, counters, ());
   MOCK_METHOD(const std::vector<std::reference_wrapper<const Gauge>>&, gauges, ());
+  MOCK_METHOD(const std::vector<CounterSnapshot>&, changedCounters, ());
+  MOCK_METHOD(const std::vector<std::reference_wrapper<const Gauge>>&, changedGauges, ());
   MOCK_METHOD(const std::vector<std::reference_wrapper<const ParentHistogram>>&, histograms, ());
   MOCK_METHOD(const std::vector<std::reference_wrapper<const TextReadout>>&, textReadouts, ());
   MOCK_METHOD(SystemTime, snapshotTime, (), (const));
 
   std::vector<CounterSnapshot> counters_;
   std::vector<std::reference_wrapper<const Gauge>> gauges_;
+  std::vector<CounterSnapshot> changed_counters_;
+  std::vector<std::reference_wrapper<const Gauge>> changed_gauges_;
   std::vector<std::reference_wrapper<const ParentHistogram>> histograms_;
   std::vector<std::reference_wrapper<const TextReadout>> text_readouts_;
   SystemTime snapshot_time_;
@@ -39,6 +39,7 @@ public:
   MOCK_METHOD(Http::AsyncClient&, httpAsyncClient, ());
   MOCK_METHOD(Tcp::AsyncTcpClientPtr, tcpAsyncClient,
               (LoadBalancerContext * context, Tcp::AsyncTcpClientOptionsConstSharedPtr options));
+  MOCK_METHOD(void, drainConnPools, (ConnectionPool::DrainBehavior drain_behavior));
 
   NiceMock<MockClusterMockPrioritySet> cluster_;
   NiceMock<MockLoadBalancer> lb_;
@@ -147,8 +147,10 @@ TEST_P(AdminInstanceTest, Help) {
       name_regex: Dump only the currently loaded configurations whose names match the specified regex. Can be used with both resource and mask query parameters.
       include_eds: Dump currently loaded configuration including EDS. See the response definition for more information
   /contention: dump current Envoy mutex contention stats (if enabled)
+  /cpu_profile_dump: dump the most recently collected CPU profile (if any)
   /cpuprofiler (POST): enable/disable the CPU profiler
       enable: enables the CPU profiler; One of (y, n)
+      seconds: stops the profiler automatically after this many seconds
   /drain_listeners (POST): drain listeners
       graceful: When draining listeners, enter a graceful drain period prior to closing listeners. This behaviour and duration is configurable via server options or CLI
       inboundonly: Drains all inbound listeners. traffic_direction field in envoy_v3_api_msg_config.listener.v3.Listener is used to determine whether a listener is inbound or outbound.
@@ -167,6 +169,7 @@ TEST_P(AdminInstanceTest, Help) {
       paths: Change multiple logging levels by setting to <logger_name1>:<desired_level1>,<logger_name2>:<desired_level2>.
       level: desired logging level; One of (, trace, debug, info, warning, error, critical, off)
   /memory: print current allocation/heap usage
+  /memory_detail: print detailed allocator statistics including per-size-class usage
   /quitquitquit (POST): exit the server
   /ready: print server state, return 200 if LIVE, otherwise return 503
   /reopen_logs (POST): reopen access logs
@@ -29,6 +29,48 @@ TEST_P(AdminInstanceTest, AdminCpuProfiler) {
   EXPECT_FALSE(Profiler::Cpu::profilerEnabled());
 }
 
+TEST_P(AdminInstanceTest, AdminCpuProfilerTimed) {
+  Buffer::OwnedImpl data;
+  Http::TestResponseHeaderMapImpl header_map;
+
+  // The seconds parameter is only valid when starting the profiler.
+  EXPECT_EQ(Http::Code::BadRequest,
+            postCallback("/cpuprofiler?enable=n&seconds=5", header_map, data));
+  EXPECT_EQ(Http::Code::BadRequest,
+            postCallback("/cpuprofiler?enable=y&seconds=0", header_map, data));
+  EXPECT_EQ(Http::Code::BadRequest,
+            postCallback("/cpuprofiler?enable=y&seconds=bogus", header_map, data));
+
+#ifdef PROFILER_AVAILABLE
+  EXPECT_EQ(Http::Code::OK, postCallback("/cpuprofiler?enable=y&seconds=30", header_map, data));
+  EXPECT_TRUE(Profiler::Cpu::profilerEnabled());
+  EXPECT_EQ(Http::Code::OK, postCallback("/cpuprofiler?enable=n", header_map, data));
+#else
+  EXPECT_EQ(Http::Code::InternalServerError,
+            postCallback("/cpuprofiler?enable=y&seconds=30", header_map, data));
+#endif
+  EXPECT_FALSE(Profiler::Cpu::profilerEnabled());
+}
+
+TEST_P(AdminInstanceTest, AdminCpuProfileDump) {
+  Http::TestResponseHeaderMapImpl header_map;
+
+  // No profile has been collected yet.
+  Buffer::OwnedImpl not_found_data;
+  EXPECT_CALL(server_.api_.file_system_, fileExists(cpu_profile_path_))
+      .WillOnce(testing::Return(false));
+  EXPECT_EQ(Http::Code::NotFound, getCallback("/cpu_profile_dump", header_map, not_found_data));
+
+  // A collected profile is served verbatim.
+  Buffer::OwnedImpl dump_data;
+  EXPECT_CALL(server_.api_.file_system_, fileExists(cpu_profile_path_))
+      .WillOnce(testing::Return(true));
+  EXPECT_CALL(server_.api_.file_system_, fileReadToEnd(cpu_profile_path_))
+      .WillOnce(testing::Return(absl::StatusOr<std::string>("profile data")));
+  EXPECT_EQ(Http::Code::OK, getCallback("/cpu_profile_dump", header_map, dump_data));
+  EXPECT_EQ("profile data", dump_data.toString());
+}
+
 TEST_P(AdminInstanceTest, AdminHeapProfilerOnRepeatedRequest) {
   Buffer::OwnedImpl data;
   Http::TestResponseHeaderMapImpl header_map;
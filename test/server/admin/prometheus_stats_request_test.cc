@@ -0,0 +1,148 @@
+#include <memory>
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/stats/custom_stat_namespaces_impl.h"
+#include "source/common/stats/thread_local_store.h"
+#include "source/server/admin/prometheus_stats_request.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/stats/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+using testing::HasSubstr;
+using testing::NiceMock;
+using testing::StartsWith;
+
+namespace Envoy {
+namespace Server {
+
+class PrometheusStatsRequestTest : public testing::Test {
+protected:
+  PrometheusStatsRequestTest() : pool_(symbol_table_), alloc_(symbol_table_), store_(alloc_) {
+    store_.addSink(sink_);
+    store_.initializeThreading(main_thread_dispatcher_, tls_);
+  }
+
+  ~PrometheusStatsRequestTest() override {
+    tls_.shutdownGlobalThreading();
+    store_.shutdownThreading();
+    tls_.shutdownThread();
+  }
+
+  std::unique_ptr<PrometheusStatsRequest> makeRequest(bool used_only,
+                                                      bool text_readouts = false) {
+    StatsParams params;
+    params.used_only_ = used_only;
+    params.prometheus_text_readouts_ = text_readouts;
+    params.format_ = StatsFormat::Prometheus;
+    return std::make_unique<PrometheusStatsRequest>(store_, params, custom_namespaces_);
+  }
+
+  // Executes a request, counting the chunks that were generated.
+  uint32_t iterateChunks(PrometheusStatsRequest& request) {
+    Http::TestResponseHeaderMapImpl response_headers;
+    Http::Code code = request.start(response_headers);
+    EXPECT_EQ(Http::Code::OK, code);
+    Buffer::OwnedImpl data;
+    uint32_t num_chunks = 0;
+    bool more = true;
+    do {
+      more = request.nextChunk(data);
+      uint64_t size = data.length();
+      if (size > 0) {
+        ++num_chunks;
+        data.drain(size);
+      }
+    } while (more);
+    return num_chunks;
+  }
+
+  // Executes a request, returning the rendered buffer as a string.
+  std::string response(PrometheusStatsRequest& request) {
+    Http::TestResponseHeaderMapImpl response_headers;
+    Http::Code code = request.start(response_headers);
+    EXPECT_EQ(Http::Code::OK, code);
+    Buffer::OwnedImpl data;
+    while (request.nextChunk(data)) {
+    }
+    return data.toString();
+  }
+
+  Stats::StatName makeStatName(absl::string_view name) { return pool_.add(name); }
+
+  Stats::SymbolTableImpl symbol_table_;
+  Stats::StatNamePool pool_;
+  Stats::AllocatorImpl alloc_;
+  NiceMock<Stats::MockSink> sink_;
+  NiceMock<Event::MockDispatcher> main_thread_dispatcher_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  Stats::ThreadLocalStoreImpl store_;
+  Stats::CustomStatNamespacesImpl custom_namespaces_;
+};
+
+TEST_F(PrometheusStatsRequestTest, Empty) {
+  EXPECT_EQ(0, iterateChunks(*makeRequest(false)));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneCounter) {
+  store_.rootScope()->counterFromStatName(makeStatName("foo"));
+  std::string out = response(*makeRequest(false));
+  EXPECT_THAT(out, StartsWith("# TYPE envoy_foo counter\n"));
+  EXPECT_THAT(out, HasSubstr("envoy_foo{} 0\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneGauge) {
+  store_.rootScope()->gaugeFromStatName(makeStatName("foo"), Stats::Gauge::ImportMode::Accumulate);
+  EXPECT_THAT(response(*makeRequest(false)), StartsWith("# TYPE envoy_foo gauge\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneHistogram) {
+  store_.rootScope()->histogramFromStatName(makeStatName("foo"),
+                                            Stats::Histogram::Unit::Milliseconds);
+  EXPECT_THAT(response(*makeRequest(false)), StartsWith("# TYPE envoy_foo histogram\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, TextReadoutsOnlyOnRequest) {
+  store_.rootScope()->textReadoutFromStatName(makeStatName("foo"));
+  EXPECT_EQ(0, iterateChunks(*makeRequest(false)));
+  EXPECT_THAT(response(*makeRequest(false, true)), StartsWith("# TYPE envoy_foo gauge\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneStatUsedOnly) {
+  store_.rootScope()->counterFromStatName(makeStatName("foo"));
+  EXPECT_EQ(0, iterateChunks(*makeRequest(true)));
+}
+
+TEST_F(PrometheusStatsRequestTest, ManyStatsSmallChunkSize) {
+  for (uint32_t i = 0; i < 100; ++i) {
+    store_.rootScope()->counterFromStatName(makeStatName(absl::StrCat("foo", i)));
+  }
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest(false);
+  request->setChunkSize(100);
+  EXPECT_EQ(34, iterateChunks(*request));
+}
+
+TEST_F(PrometheusStatsRequestTest, FamiliesGroupedByTagExtractedName) {
+  // Two counters sharing a tag-extracted name must land under a single TYPE
+  // line even though they are distinct stats.
+  store_.rootScope()->counterFromStatNameWithTags(
+      makeStatName("c1"), Stats::StatNameTagVector{{makeStatName("a"), makeStatName("b")}});
+  store_.rootScope()->counterFromStatNameWithTags(
+      makeStatName("c1"), Stats::StatNameTagVector{{makeStatName("a"), makeStatName("c")}});
+  store_.rootScope()->counterFromStatName(makeStatName("foo"));
+  const std::string out = response(*makeRequest(false));
+  uint32_t num_type_lines = 0;
+  for (size_t pos = out.find("# TYPE"); pos != std::string::npos;
+       pos = out.find("# TYPE", pos + 1)) {
+    ++num_type_lines;
+  }
+  EXPECT_EQ(2, num_type_lines);
+  EXPECT_THAT(out, HasSubstr("envoy_c1{a=\"b\"} 0\n"));
+  EXPECT_THAT(out, HasSubstr("envoy_c1{a=\"c\"} 0\n"));
+}
+
+} // namespace Server
+} // namespace Envoy
@@ -62,6 +62,17 @@ TEST_P(AdminInstanceTest, Memory) {
                                   Property(&envoy::admin::v3::Memory::total_thread_cache, Ge(0))));
 }
 
+TEST_P(AdminInstanceTest, MemoryDetail) {
+  Http::TestResponseHeaderMapImpl header_map;
+  Buffer::OwnedImpl response;
+#if defined(TCMALLOC) || defined(GPERFTOOLS_TCMALLOC)
+  EXPECT_EQ(Http::Code::OK, getCallback("/memory_detail", header_map, response));
+  EXPECT_FALSE(response.toString().empty());
+#else
+  EXPECT_EQ(Http::Code::NotImplemented, getCallback("/memory_detail", header_map, response));
+#endif
+}
+
 TEST_P(AdminInstanceTest, GetReadyRequest) {
   NiceMock<Init::MockManager> initManager;
   ON_CALL(server_, initManager()).WillByDefault(ReturnRef(initManager));
@@ -1,6 +1,7 @@
 #include "source/common/buffer/buffer_impl.h"
 #include "source/server/admin/stats_params.h"
 
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
 
 namespace Envoy {
@@ -80,5 +81,34 @@ TEST(StatsParamsTest, ParseParamsFilter) {
   }
 }
 
+TEST(StatsParamsTest, FilterPrefix) {
+  Buffer::OwnedImpl response;
+
+  auto filter_prefix = [&response](absl::string_view filter) -> std::string {
+    StatsParams params;
+    EXPECT_EQ(Http::Code::OK, params.parse(absl::StrCat("?filter=", filter), response));
+    return params.filter_prefix_;
+  };
+
+  // Unanchored filters do not constrain the start of the name.
+  EXPECT_EQ("", filter_prefix("foo"));
+
+  // Anchored literals yield a prefix; an escaped dot is part of it, while an
+  // unescaped dot or other metacharacter ends it.
+  EXPECT_EQ("cluster.", filter_prefix("^cluster\\."));
+  EXPECT_EQ("cluster.foo", filter_prefix("^cluster\\.foo"));
+  EXPECT_EQ("server", filter_prefix("^server.uptime"));
+  EXPECT_EQ("cluster", filter_prefix("^cluster(\\.foo)?"));
+  EXPECT_EQ("http", filter_prefix("^http\\.[a-z]+"));
+
+  // A quantifier can make the preceding character optional, so it is dropped.
+  EXPECT_EQ("cluster.fo", filter_prefix("^cluster\\.foo?"));
+  EXPECT_EQ("a", filter_prefix("^ab*"));
+
+  // Alternation means the anchored prefix is not required for a match.
+  EXPECT_EQ("", filter_prefix("^cluster\\.|^http\\."));
+  EXPECT_EQ("", filter_prefix("^(?i)foo"));
+}
+
 } // namespace Server
 } // namespace Envoy
@@ -11,7 +11,9 @@
 
 #include "gtest/gtest.h"
 
+using testing::HasSubstr;
 using testing::NiceMock;
+using testing::Not;
 using testing::StartsWith;
 
 namespace Envoy {
@@ -177,16 +179,44 @@ TEST_F(StatsRequestTest, OneStatHiddenInclude) {
       1, iterateChunks(*makeHiddenRequest(HiddenFlag::Include, StatsFormat::Text, StatsType::All)));
 }
 
+TEST_F(StatsRequestTest, FilterPrefixPrunesScopes) {
+  Stats::ScopeSharedPtr foo_scope = store_.createScope("foo");
+  Stats::ScopeSharedPtr bar_scope = store_.createScope("bar");
+  foo_scope->counterFromStatName(makeStatName("c1"));
+  bar_scope->counterFromStatName(makeStatName("c1"));
+
+  // An anchored filter only visits scopes compatible with its literal prefix.
+  {
+    StatsParams params;
+    Buffer::OwnedImpl err;
+    ASSERT_EQ(Http::Code::OK, params.parse("?filter=^foo\\.", err));
+    StatsRequest request(store_, params);
+    const std::string out = response(request);
+    EXPECT_THAT(out, HasSubstr("foo.c1"));
+    EXPECT_THAT(out, Not(HasSubstr("bar.c1")));
+  }
+
+  // An unanchored filter still scans all scopes.
+  {
+    StatsParams params;
+    Buffer::OwnedImpl err;
+    ASSERT_EQ(Http::Code::OK, params.parse("?filter=c1", err));
+    StatsRequest request(store_, params);
+    const std::string out = response(request);
+    EXPECT_THAT(out, HasSubstr("foo.c1"));
+    EXPECT_THAT(out, HasSubstr("bar.c1"));
+  }
+}
+
 TEST_F(StatsRequestTest, OneStatJson) {
   store_.rootScope()->counterFromStatName(makeStatName("foo"));
   EXPECT_THAT(response(*makeRequest(false, StatsFormat::Json, StatsType::All)), StartsWith("{"));
 }
 
 TEST_F(StatsRequestTest, OneStatPrometheus) {
-  // Currently the rendering infrastructure does not support Prometheus -- that
-  // gets rendered using a different code-path. This will be fixed at some
-  // point, to make Prometheus consume less resource, and when that occurs this
-  // test can exercise that.
+  // The StatsRequest rendering infrastructure does not support Prometheus --
+  // that format is streamed by PrometheusStatsRequest instead, which is
+  // exercised in prometheus_stats_request_test.cc.
   store_.rootScope()->counterFromStatName(makeStatName("foo"));
   EXPECT_ENVOY_BUG(iterateChunks(*makeRequest(false, StatsFormat::Prometheus, StatsType::All), true,
                                  Http::Code::BadRequest),
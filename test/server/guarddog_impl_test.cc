@@ -383,6 +383,29 @@ TEST_P(GuardDogMissTest, MissCountTest) {
   sometimes_pet_dog = nullptr;
 }
 
+TEST_P(GuardDogMissTest, LoopLatencyHistogram) {
+  // The recorded latency values are only deterministic in simulated time.
+  if (GetParam() == TimeSystemType::Real) {
+    return;
+  }
+
+  // The time between consecutive touches should be recorded into the per-thread loop latency
+  // histogram regardless of whether any miss threshold is crossed.
+  initGuardDog(stats_store_, config_miss_);
+  auto pet_dog = guard_dog_->createWatchDog(api_->threadFactory().currentThreadId(), "test_thread",
+                                            mock_dispatcher_);
+  time_system_->advanceTimeWait(std::chrono::milliseconds(100));
+  pet_dog->touch();
+  time_system_->advanceTimeWait(std::chrono::milliseconds(250));
+  pet_dog->touch();
+  // createWatchDog() itself touches the watchdog twice with no elapsed time in between, which
+  // accounts for the leading zero value.
+  EXPECT_THAT(stats_store_.histogramValues("server.test_thread.loop_latency_us", false),
+              ElementsAre(0, 100000, 250000));
+  guard_dog_->stopWatching(pet_dog);
+  pet_dog = nullptr;
+}
+
 TEST_P(GuardDogTestBase, StartStopTest) {
   NiceMock<Stats::MockStore> stats;
   NiceMock<Configuration::MockWatchdog> config(0, 0, 0, 0, 0, std::vector<std::string>{});
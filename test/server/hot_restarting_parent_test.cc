@@ -1,3 +1,4 @@
+#include <map>
 #include <memory>
 
 #include "source/common/network/address_impl.h"
@@ -267,6 +268,77 @@ TEST_F(HotRestartingParentTest, ExportStatsToChild) {
   }
 }
 
+TEST_F(HotRestartingParentTest, ExportStatsToChildChunked) {
+  Stats::TestUtil::TestStore store;
+  MockListenerManager listener_manager;
+  EXPECT_CALL(server_, listenerManager()).WillRepeatedly(ReturnRef(listener_manager));
+  EXPECT_CALL(listener_manager, numConnections()).WillRepeatedly(Return(7));
+  EXPECT_CALL(server_, stats()).WillRepeatedly(ReturnRef(store));
+
+  // Enough long-named counters to overflow a single chunk several times over.
+  const std::string name_prefix(64, 'x');
+  constexpr uint64_t NumCounters = 4096;
+  for (uint64_t i = 0; i < NumCounters; ++i) {
+    store.counter(name_prefix + std::to_string(i)).add(i + 1);
+  }
+  store.gauge("g1", Stats::Gauge::ImportMode::Accumulate).set(123);
+
+  HotRestartMessage::Request::Stats request;
+  request.set_allow_chunking(true);
+  std::map<std::string, uint64_t> counter_deltas;
+  std::map<std::string, uint64_t> gauges;
+  uint64_t num_chunks = 0;
+  bool more_chunks_remain = true;
+  while (more_chunks_remain) {
+    HotRestartMessage::Reply::Stats stats;
+    hot_restarting_parent_.exportStatsToChild(request, &stats);
+    ++num_chunks;
+    EXPECT_EQ(7, stats.num_connections());
+    for (const auto& [name, value] : stats.counter_deltas()) {
+      // Each stat must appear in exactly one chunk of an export cycle.
+      EXPECT_TRUE(counter_deltas.emplace(name, value).second) << name;
+    }
+    for (const auto& [name, value] : stats.gauges()) {
+      EXPECT_TRUE(gauges.emplace(name, value).second) << name;
+    }
+    more_chunks_remain = stats.more_chunks_remain();
+  }
+  EXPECT_GT(num_chunks, 1);
+  EXPECT_EQ(NumCounters, counter_deltas.size());
+  for (uint64_t i = 0; i < NumCounters; ++i) {
+    EXPECT_EQ(i + 1, counter_deltas[name_prefix + std::to_string(i)]);
+  }
+  EXPECT_EQ(123, gauges.at("g1"));
+
+  // The next cycle re-exports gauges but drops counters that did not change, just as repeated
+  // unchunked exports do.
+  store.counter(name_prefix + "0").inc();
+  HotRestartMessage::Reply::Stats stats;
+  hot_restarting_parent_.exportStatsToChild(request, &stats);
+  EXPECT_FALSE(stats.more_chunks_remain());
+  EXPECT_EQ(1, stats.counter_deltas().size());
+  EXPECT_EQ(1, stats.counter_deltas().at(name_prefix + "0"));
+  EXPECT_EQ(123, stats.gauges().at("g1"));
+}
+
+TEST_F(HotRestartingParentTest, ExportStatsToChildNoChunkingForOldChild) {
+  Stats::TestUtil::TestStore store;
+  MockListenerManager listener_manager;
+  EXPECT_CALL(server_, listenerManager()).WillRepeatedly(ReturnRef(listener_manager));
+  EXPECT_CALL(listener_manager, numConnections()).WillRepeatedly(Return(0));
+  EXPECT_CALL(server_, stats()).WillRepeatedly(ReturnRef(store));
+
+  // A child that does not set allow_chunking gets everything in one reply.
+  store.counter("c1").inc();
+  store.gauge("g1", Stats::Gauge::ImportMode::Accumulate).set(123);
+  HotRestartMessage::Request::Stats request;
+  HotRestartMessage::Reply::Stats stats;
+  hot_restarting_parent_.exportStatsToChild(request, &stats);
+  EXPECT_FALSE(stats.more_chunks_remain());
+  EXPECT_EQ(1, stats.counter_deltas().at("c1"));
+  EXPECT_EQ(123, stats.gauges().at("g1"));
+}
+
 TEST_F(HotRestartingParentTest, RetainDynamicStats) {
   MockListenerManager listener_manager;
   Stats::SymbolTableImpl parent_symbol_table;
@@ -114,6 +114,53 @@ TEST(ServerInstanceUtil, flushHelper) {
   InstanceUtil::flushMetricsToSinks(sinks, mock_store, time_system);
 }
 
+TEST(ServerInstanceUtil, flushChangedOnly) {
+  InSequence s;
+
+  Stats::TestUtil::TestStore store;
+  Event::SimulatedTimeSystem time_system;
+  Stats::Counter& c = store.counter("hello");
+  Stats::Gauge& g1 = store.gauge("world", Stats::Gauge::ImportMode::Accumulate);
+  Stats::Gauge& g2 = store.gauge("idle", Stats::Gauge::ImportMode::Accumulate);
+  c.inc();
+  g1.set(5);
+  g2.set(7);
+
+  std::list<Stats::SinkPtr> sinks;
+  Stats::MockSink* sink = new StrictMock<Stats::MockSink>();
+  sinks.emplace_back(sink);
+
+  // On the first flush everything has changed.
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.changedCounters().size(), 1);
+    EXPECT_EQ(snapshot.changedCounters()[0].counter_.get().name(), "hello");
+    EXPECT_EQ(snapshot.changedCounters()[0].delta_, 1);
+    EXPECT_EQ(snapshot.changedGauges().size(), 2);
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, time_system);
+
+  // Only the counter moves before the second flush; the full views still
+  // contain every metric.
+  c.inc();
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.gauges().size(), 2);
+    ASSERT_EQ(snapshot.changedCounters().size(), 1);
+    EXPECT_EQ(snapshot.changedCounters()[0].delta_, 1);
+    EXPECT_TRUE(snapshot.changedGauges().empty());
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, time_system);
+
+  // Only one gauge moves before the third flush.
+  g1.set(6);
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_TRUE(snapshot.changedCounters().empty());
+    ASSERT_EQ(snapshot.changedGauges().size(), 1);
+    EXPECT_EQ(snapshot.changedGauges()[0].get().name(), "world");
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, time_system);
+}
+
 TEST(ServerInstanceUtil, flushImportModeUninitializedGauges) {
   InSequence s;
 
@@ -546,6 +593,14 @@ TEST_P(ServerInstanceImplTest, EmptyShutdownLifecycleNotifications) {
                   .histogramFromString("server.initialization_time_ms",
                                        Stats::Histogram::Unit::Milliseconds)
                   .used());
+  // The startup phase timeline should have been recorded, from the bootstrap load through worker
+  // startup.
+  EXPECT_TRUE(
+      TestUtility::findGauge(stats_store_, "server.startup_bootstrap_load_time_ms")->used());
+  EXPECT_TRUE(
+      TestUtility::findGauge(stats_store_, "server.startup_primary_clusters_init_time_ms")->used());
+  EXPECT_TRUE(
+      TestUtility::findGauge(stats_store_, "server.startup_workers_start_time_ms")->used());
   EXPECT_EQ(0L, TestUtility::findGauge(stats_store_, "server.state")->value());
 }
 
@@ -1,3 +1,7 @@
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include "envoy/network/exception.h"
 
 #include "source/common/api/api_impl.h"
@@ -30,12 +34,12 @@ std::function<void()> emptyCallback = []() {};
 
 class WorkerImplTest : public testing::Test {
 public:
-  WorkerImplTest()
+  WorkerImplTest(absl::optional<uint32_t> cpu_affinity = absl::nullopt)
       : api_(Api::createApiForTest()), dispatcher_(api_->allocateDispatcher("worker_test")),
         no_exit_timer_(dispatcher_->createTimer([]() -> void {})),
         stat_names_(api_->rootScope().symbolTable()),
         worker_(tls_, hooks_, std::move(dispatcher_), Network::ConnectionHandlerPtr{handler_},
-                overload_manager_, *api_, stat_names_) {
+                overload_manager_, *api_, stat_names_, cpu_affinity) {
     // In the real worker the watchdog has timers that prevent exit. Here we need to prevent event
     // loop exit since we use mock timers.
     no_exit_timer_->enableTimer(std::chrono::hours(1));
@@ -158,6 +162,34 @@ TEST_F(WorkerImplTest, WorkerInvokesProvidedCallback) {
   worker_.stop();
 }
 
+#ifdef __linux__
+class WorkerImplPinnedTest : public WorkerImplTest {
+public:
+  WorkerImplPinnedTest() : WorkerImplTest(/*cpu_affinity=*/0) {}
+};
+
+TEST_F(WorkerImplPinnedTest, WorkerThreadPinnedToCpu) {
+  // The start callback runs on the worker thread, so it observes the affinity the worker was
+  // constructed with. The affinity is applied by the creating thread after the worker thread
+  // starts, so the callback waits for start() to return before reading the mask.
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  absl::Notification started;
+  absl::Notification affinity_read;
+  worker_.start(guard_dog_, [&started, &cpuset, &affinity_read]() {
+    started.WaitForNotification();
+    EXPECT_EQ(0, sched_getaffinity(0, sizeof(cpuset), &cpuset));
+    affinity_read.Notify();
+  });
+  started.Notify();
+
+  affinity_read.WaitForNotification();
+  EXPECT_EQ(1, CPU_COUNT(&cpuset));
+  EXPECT_TRUE(CPU_ISSET(0, &cpuset));
+  worker_.stop();
+}
+#endif
+
 } // namespace
 } // namespace Server
 } // namespace Envoy
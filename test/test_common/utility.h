@@ -1051,6 +1051,11 @@ public:
     header_map_->addCopy(key, value);
     header_map_->verifyByteSizeInternalForTest();
   }
+  void
+  addCopyBulk(absl::Span<const std::pair<absl::string_view, absl::string_view>> headers) override {
+    header_map_->addCopyBulk(headers);
+    header_map_->verifyByteSizeInternalForTest();
+  }
   void appendCopy(const LowerCaseString& key, absl::string_view value) override {
     header_map_->appendCopy(key, value);
     header_map_->verifyByteSizeInternalForTest();